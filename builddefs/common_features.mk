@@ -131,6 +131,7 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device.c
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_drivers.c
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_auto_mouse.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_hires.c
         ifneq ($(strip $(POINTING_DEVICE_DRIVER)), custom)
             SRC += drivers/sensors/$(strip $(POINTING_DEVICE_DRIVER)).c
             OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(strip $(shell echo $(POINTING_DEVICE_DRIVER) | tr '[:lower:]' '[:upper:]'))
@@ -635,6 +636,15 @@ ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     ifneq ($(strip $(CUSTOM_MATRIX)), lite)
         # Include the standard or split matrix code if needed
         QUANTUM_SRC += $(QUANTUM_DIR)/matrix.c
+
+        ifeq ($(strip $(MATRIX_SCAN_TIMER_ENABLE)), yes)
+            ifneq ($(strip $(PLATFORM)), CHIBIOS)
+                $(call CATASTROPHIC_ERROR,Invalid MATRIX_SCAN_TIMER_ENABLE,MATRIX_SCAN_TIMER_ENABLE is only supported on ChibiOS)
+            endif
+            OPT_DEFS += -DMATRIX_SCAN_TIMER_ENABLE
+            OPT_DEFS += -DHAL_USE_GPT=TRUE
+            SRC += $(PLATFORM_COMMON_DIR)/matrix_scan_timer.c
+        endif
     endif
 endif
 
@@ -645,7 +655,7 @@ ifneq ($(strip $(DEBOUNCE_TYPE)), custom)
 endif
 
 
-VALID_SERIAL_DRIVER_TYPES := bitbang usart vendor
+VALID_SERIAL_DRIVER_TYPES := bitbang usart usart_stream vendor
 
 SERIAL_DRIVER ?= bitbang
 ifeq ($(filter $(SERIAL_DRIVER),$(VALID_SERIAL_DRIVER_TYPES)),)
@@ -679,6 +689,9 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
         OPT_DEFS += -DSERIAL_DRIVER_$(strip $(shell echo $(SERIAL_DRIVER) | tr '[:lower:]' '[:upper:]'))
         ifeq ($(strip $(SERIAL_DRIVER)), bitbang)
             QUANTUM_LIB_SRC += serial.c
+        else ifeq ($(strip $(SERIAL_DRIVER)), usart_stream)
+            QUANTUM_SRC += $(QUANTUM_DIR)/split_common/split_stream.c
+            QUANTUM_LIB_SRC += serial_usart_stream.c
         else
             QUANTUM_LIB_SRC += serial_protocol.c
             QUANTUM_LIB_SRC += serial_$(strip $(SERIAL_DRIVER)).c
@@ -952,11 +965,26 @@ endif
 ifeq ($(strip $(I2C_DRIVER_REQUIRED)), yes)
     OPT_DEFS += -DHAL_USE_I2C=TRUE
     QUANTUM_LIB_SRC += i2c_master.c
+
+    ifeq ($(strip $(I2C_ASYNC_ENABLE)), yes)
+        ifneq ($(strip $(PLATFORM)), CHIBIOS)
+            $(call CATASTROPHIC_ERROR,Invalid I2C_ASYNC_ENABLE,I2C_ASYNC_ENABLE is only supported on ChibiOS)
+        endif
+        OPT_DEFS += -DI2C_ASYNC_ENABLE
+        QUANTUM_LIB_SRC += i2c_async.c
+    endif
 endif
 
 ifeq ($(strip $(SPI_DRIVER_REQUIRED)), yes)
     OPT_DEFS += -DHAL_USE_SPI=TRUE
     QUANTUM_LIB_SRC += spi_master.c
+
+    ifeq ($(strip $(SPI_ASYNC_ENABLE)), yes)
+        ifneq ($(strip $(PLATFORM)), CHIBIOS)
+            $(call CATASTROPHIC_ERROR,Invalid SPI_ASYNC_ENABLE,SPI_ASYNC_ENABLE is only supported on ChibiOS)
+        endif
+        OPT_DEFS += -DSPI_ASYNC_ENABLE
+    endif
 endif
 
 ifeq ($(strip $(UART_DRIVER_REQUIRED)), yes)
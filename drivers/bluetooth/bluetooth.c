@@ -22,6 +22,9 @@
 #elif defined(BLUETOOTH_RN42)
 #    include "rn42.h"
 #endif
+#ifdef KEYBOARD_IDLE_ENABLE
+#    include "keyboard.h"
+#endif
 
 void bluetooth_init(void) {
 #if defined(BLUETOOTH_BLUEFRUIT_LE)
@@ -34,6 +37,10 @@ void bluetooth_init(void) {
 void bluetooth_task(void) {
 #if defined(BLUETOOTH_BLUEFRUIT_LE)
     bluefruit_le_task();
+#    ifdef KEYBOARD_IDLE_ENABLE
+    // The module's send queue and battery level are polled
+    keyboard_idle_request(KEYBOARD_IDLE_SCAN_INTERVAL);
+#    endif
 #endif
 }
 
@@ -22,6 +22,9 @@
 #include "usb_device_state.h"
 #include "util.h"
 #include <stdlib.h>
+#ifdef KEYBOARD_IDLE_ENABLE
+#    include "keyboard.h"
+#endif
 
 static pin_t solenoid_pads[] = SOLENOID_PINS;
 #define NUMBER_OF_SOLENOIDS ARRAY_SIZE(solenoid_pads)
@@ -122,6 +125,10 @@ void solenoid_check(void) {
             solenoid_stop(i);
             continue;
         }
+#ifdef KEYBOARD_IDLE_ENABLE
+        // The dwell and buzz periods are timed to the millisecond
+        keyboard_idle_request(KEYBOARD_IDLE_SCAN_INTERVAL);
+#endif
 
         // Check whether to buzz the solenoid on and off
         if (haptic_config.buzz) {
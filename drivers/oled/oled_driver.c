@@ -30,6 +30,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <string.h>
 #include "progmem.h"
 #include "wait.h"
+#ifdef KEYBOARD_IDLE_ENABLE
+#    include "keyboard.h"
+#    include "util.h"
+#endif
 
 // Used commands from spec sheet: https://cdn-shop.adafruit.com/datasheets/SSD1306.pdf
 // for SH1106: https://www.velleman.eu/downloads/29/infosheets/sh1106_datasheet.pdf
@@ -966,6 +970,17 @@ void oled_task(void) {
 #    endif
     }
 #endif
+
+#ifdef KEYBOARD_IDLE_ENABLE
+    // oled_task_user() draws whatever it likes, so it runs at the scan rate, or once per update interval
+    if (oled_active) {
+#    if OLED_UPDATE_INTERVAL > 0
+        keyboard_idle_request(OLED_UPDATE_INTERVAL - MIN(timer_elapsed(oled_update_timeout), OLED_UPDATE_INTERVAL));
+#    else
+        keyboard_idle_request(KEYBOARD_IDLE_SCAN_INTERVAL);
+#    endif
+    }
+#endif
 }
 
 __attribute__((weak)) bool oled_task_kb(void) {
@@ -3,8 +3,12 @@
 
 #ifdef QUANTUM_PAINTER_DUMMY_COMMS_ENABLE
 
+#    include <string.h>
 #    include "qp_comms_dummy.h"
 
+// Nothing goes over the wire, but keep track of what would have, so drivers can be profiled on the host
+static dummy_comms_stats_t dummy_comms_stats;
+
 static bool dummy_comms_init(painter_device_t device) {
     // No-op.
     return true;
@@ -20,10 +24,38 @@ static void dummy_comms_stop(painter_device_t device) {
 }
 
 uint32_t dummy_comms_send(painter_device_t device, const void *data, uint32_t byte_count) {
-    // No-op.
+    dummy_comms_stats.transactions++;
+    dummy_comms_stats.bytes += byte_count;
     return byte_count;
 }
 
+static void dummy_comms_send_command(painter_device_t device, uint8_t cmd) {
+    dummy_comms_stats.transactions++;
+    dummy_comms_stats.commands++;
+    dummy_comms_stats.bytes++;
+}
+
+static void dummy_comms_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
+    // Same layout as the SPI D/C implementation: command, delay, argument count, arguments
+    for (size_t i = 0; i < sequence_len;) {
+        uint8_t command   = sequence[i];
+        uint8_t num_bytes = sequence[i + 2];
+        dummy_comms_send_command(device, command);
+        if (num_bytes > 0) {
+            dummy_comms_send(device, &sequence[i + 3], num_bytes);
+        }
+        i += (3 + num_bytes);
+    }
+}
+
+void dummy_comms_get_stats(dummy_comms_stats_t *stats) {
+    memcpy(stats, &dummy_comms_stats, sizeof(dummy_comms_stats_t));
+}
+
+void dummy_comms_reset_stats(void) {
+    memset(&dummy_comms_stats, 0, sizeof(dummy_comms_stats_t));
+}
+
 painter_comms_vtable_t dummy_comms_vtable = {
     // These are all effective no-op's because they're not actually needed.
     .comms_init  = dummy_comms_init,
@@ -31,4 +63,16 @@ painter_comms_vtable_t dummy_comms_vtable = {
     .comms_stop  = dummy_comms_stop,
     .comms_send  = dummy_comms_send};
 
+painter_comms_with_command_vtable_t dummy_comms_with_command_vtable = {
+    .base =
+        {
+            .comms_init  = dummy_comms_init,
+            .comms_start = dummy_comms_start,
+            .comms_stop  = dummy_comms_stop,
+            .comms_send  = dummy_comms_send,
+        },
+    .send_command          = dummy_comms_send_command,
+    .bulk_command_sequence = dummy_comms_bulk_command_sequence,
+};
+
 #endif // QUANTUM_PAINTER_DUMMY_COMMS_ENABLE
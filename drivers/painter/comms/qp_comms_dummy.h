@@ -6,6 +6,17 @@
 
 #    include "qp_internal.h"
 
-extern painter_comms_vtable_t dummy_comms_vtable;
+// Totals of everything sent through either dummy vtable since the last reset
+typedef struct dummy_comms_stats_t {
+    uint32_t transactions; // every command and every data send
+    uint32_t commands;     // commands only, a subset of transactions
+    uint32_t bytes;        // command bytes plus data bytes
+} dummy_comms_stats_t;
+
+extern painter_comms_vtable_t              dummy_comms_vtable;
+extern painter_comms_with_command_vtable_t dummy_comms_with_command_vtable;
+
+void dummy_comms_get_stats(dummy_comms_stats_t *stats);
+void dummy_comms_reset_stats(void);
 
 #endif // QUANTUM_PAINTER_DUMMY_COMMS_ENABLE
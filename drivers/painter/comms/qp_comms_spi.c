@@ -3,6 +3,8 @@
 
 #ifdef QUANTUM_PAINTER_SPI_ENABLE
 
+#    include <string.h>
+#    include "atomic_util.h"
 #    include "spi_master.h"
 #    include "qp_comms_spi.h"
 
@@ -52,11 +54,105 @@ void qp_comms_spi_stop(painter_device_t device) {
     gpio_write_pin_high(comms_config->chip_select_pin);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asynchronous SPI support
+
+#    ifdef QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+
+#        ifndef SPI_ASYNC_ENABLE
+#            error "QUANTUM_PAINTER_SPI_ASYNC_ENABLE requires SPI_ASYNC_ENABLE = yes in rules.mk"
+#        endif
+
+typedef struct qp_comms_spi_async_buffer_t {
+    volatile bool busy;
+    uint8_t       data[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+} qp_comms_spi_async_buffer_t;
+
+// Staging buffers, filled round-robin so the caller can prepare the next block while the previous one is on the wire
+static qp_comms_spi_async_buffer_t qp_comms_spi_async_buffers[QUANTUM_PAINTER_SPI_ASYNC_BUFFERS];
+static uint8_t                     qp_comms_spi_async_next_buffer = 0;
+
+static volatile uint8_t      qp_comms_spi_async_queue_depth = 0;
+static painter_comms_stats_t qp_comms_spi_async_stats       = {0};
+
+// Invoked from interrupt context once a staging buffer has been sent
+static void qp_comms_spi_async_complete(void *cb_arg) {
+    qp_comms_spi_async_buffer_t *buffer = (qp_comms_spi_async_buffer_t *)cb_arg;
+    qp_comms_spi_async_queue_depth--;
+    qp_comms_spi_async_stats.transfers++;
+    buffer->busy = false;
+}
+
+uint32_t qp_comms_spi_async_send_data(painter_device_t device, const void *data, uint32_t byte_count) {
+    uint32_t       bytes_remaining = byte_count;
+    const uint8_t *p               = (const uint8_t *)data;
+
+    while (bytes_remaining > 0) {
+        qp_comms_spi_async_buffer_t *buffer = &qp_comms_spi_async_buffers[qp_comms_spi_async_next_buffer];
+        qp_comms_spi_async_next_buffer      = (qp_comms_spi_async_next_buffer + 1) % QUANTUM_PAINTER_SPI_ASYNC_BUFFERS;
+
+        // Wait for the staging buffer to be sent before reusing it
+        if (buffer->busy) {
+            qp_comms_spi_async_stats.stalls++;
+            while (buffer->busy && spi_async_busy()) {
+            }
+        }
+
+        uint32_t bytes_this_loop = QP_MIN(bytes_remaining, sizeof(buffer->data));
+        memcpy(buffer->data, p, bytes_this_loop);
+        buffer->busy = true;
+        // The completion callback decrements the depth from interrupt context
+        ATOMIC_BLOCK_FORCEON {
+            qp_comms_spi_async_queue_depth++;
+            if (qp_comms_spi_async_queue_depth > qp_comms_spi_async_stats.max_queue_depth) {
+                qp_comms_spi_async_stats.max_queue_depth = qp_comms_spi_async_queue_depth;
+            }
+        }
+        if (spi_transmit_async(buffer->data, bytes_this_loop, qp_comms_spi_async_complete, buffer) != SPI_STATUS_SUCCESS) {
+            buffer->busy = false;
+            ATOMIC_BLOCK_FORCEON {
+                qp_comms_spi_async_queue_depth--;
+            }
+            break;
+        }
+
+        p += bytes_this_loop;
+        bytes_remaining -= bytes_this_loop;
+    }
+
+    return byte_count - bytes_remaining;
+}
+
+void qp_comms_spi_async_stop(painter_device_t device) {
+    // Chip select is released by the SPI driver once the queued transfers are done
+    spi_stop();
+}
+
+bool qp_comms_spi_async_busy(painter_device_t device) {
+    return spi_async_busy();
+}
+
+void qp_comms_spi_async_get_stats(painter_device_t device, painter_comms_stats_t *stats) {
+    ATOMIC_BLOCK_FORCEON {
+        *stats             = qp_comms_spi_async_stats;
+        stats->queue_depth = qp_comms_spi_async_queue_depth;
+    }
+}
+
+#    endif // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+
 const painter_comms_vtable_t spi_comms_vtable = {
     .comms_init  = qp_comms_spi_init,
     .comms_start = qp_comms_spi_start,
-    .comms_send  = qp_comms_spi_send_data,
-    .comms_stop  = qp_comms_spi_stop,
+#    ifdef QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+    .comms_send  = qp_comms_spi_async_send_data,
+    .comms_stop  = qp_comms_spi_async_stop,
+    .comms_busy  = qp_comms_spi_async_busy,
+    .comms_stats = qp_comms_spi_async_get_stats,
+#    else  // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+    .comms_send = qp_comms_spi_send_data,
+    .comms_stop = qp_comms_spi_stop,
+#    endif // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -94,12 +190,20 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
     gpio_write_pin_high(comms_config->dc_pin);
+#        ifdef QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+    return qp_comms_spi_async_send_data(device, data, byte_count);
+#        else  // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
     return qp_comms_spi_send_data(device, data, byte_count);
+#        endif // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
 }
 
 void qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+#        ifdef QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+    // Queued data still needs D/C held high
+    spi_async_wait(SPI_TIMEOUT_INFINITE);
+#        endif // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
     gpio_write_pin_low(comms_config->dc_pin);
     spi_write(cmd);
 }
@@ -134,7 +238,13 @@ const painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
             .comms_init  = qp_comms_spi_dc_reset_init,
             .comms_start = qp_comms_spi_start,
             .comms_send  = qp_comms_spi_dc_reset_send_data,
-            .comms_stop  = qp_comms_spi_stop,
+#        ifdef QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+            .comms_stop  = qp_comms_spi_async_stop,
+            .comms_busy  = qp_comms_spi_async_busy,
+            .comms_stats = qp_comms_spi_async_get_stats,
+#        else  // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+            .comms_stop = qp_comms_spi_stop,
+#        endif // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .bulk_command_sequence = qp_comms_spi_dc_reset_bulk_command_sequence,
@@ -26,6 +26,18 @@ void     qp_comms_spi_stop(painter_device_t device);
 
 extern const painter_comms_vtable_t spi_comms_vtable;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asynchronous SPI support
+
+#    ifdef QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+
+uint32_t qp_comms_spi_async_send_data(painter_device_t device, const void* data, uint32_t byte_count);
+void     qp_comms_spi_async_stop(painter_device_t device);
+bool     qp_comms_spi_async_busy(painter_device_t device);
+void     qp_comms_spi_async_get_stats(painter_device_t device, painter_comms_stats_t* stats);
+
+#    endif // QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // SPI with D/C and RST pins
 
@@ -21,6 +21,23 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_DIRTY_RECTS
+/**
+ * @def This controls the maximum number of separate dirty rectangles each surface keeps track of. Each one is sent to
+ *      the target as its own viewport, so updates in distant parts of the surface don't drag everything in between
+ *      along with them. Setting this to 1 tracks a single bounding box.
+ */
+#    define SURFACE_DIRTY_RECTS 4
+#endif
+
+#ifndef SURFACE_DIRTY_MERGE_THRESHOLD
+/**
+ * @def This controls how many clean pixels may be sent to avoid tracking another dirty rectangle. Rectangles are
+ *      merged, or grown to cover a new pixel, when that costs no more than this many extra pixels.
+ */
+#    define SURFACE_DIRTY_MERGE_THRESHOLD 64
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -53,7 +70,8 @@ painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_h
 /**
  * Helper method to draw the contents of the framebuffer to the target device.
  *
- * After successful completion, the dirty area is reset.
+ * Only the dirty rectangles are transferred, each as its own viewport on the target. After successful completion, the
+ * dirty area is reset.
  *
  * @param surface[in] the surface to copy from
  * @param target[in] the target device to copy into
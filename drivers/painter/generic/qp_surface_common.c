@@ -29,24 +29,105 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
-void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
-    // Maintain dirty region
-    if (dirty->l > x) {
-        dirty->l        = x;
-        dirty->is_dirty = true;
+static inline uint32_t rect_area(uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    return (uint32_t)(r - l + 1) * (uint32_t)(b - t + 1);
+}
+
+static inline bool rect_contains(const surface_dirty_rect_t *rect, uint16_t x, uint16_t y) {
+    return x >= rect->l && x <= rect->r && y >= rect->t && y <= rect->b;
+}
+
+// Number of clean pixels that would be sent if the rectangle grew to include the pixel
+static inline uint32_t rect_growth(const surface_dirty_rect_t *rect, uint16_t x, uint16_t y) {
+    return rect_area(QP_MIN(rect->l, x), QP_MIN(rect->t, y), QP_MAX(rect->r, x), QP_MAX(rect->b, y)) - rect_area(rect->l, rect->t, rect->r, rect->b);
+}
+
+// Merges other rectangles into the given one for as long as the union wastes few enough pixels
+static void qp_surface_merge_dirty(surface_dirty_data_t *dirty, uint8_t index) {
+    bool merged = true;
+    while (merged) {
+        merged                     = false;
+        surface_dirty_rect_t *rect = &dirty->rects[index];
+        for (uint8_t i = 0; i < dirty->count; ++i) {
+            if (i == index) {
+                continue;
+            }
+            surface_dirty_rect_t *other = &dirty->rects[i];
+
+            // Pixels covered by both are only counted once
+            uint16_t il      = QP_MAX(rect->l, other->l);
+            uint16_t it      = QP_MAX(rect->t, other->t);
+            uint16_t ir      = QP_MIN(rect->r, other->r);
+            uint16_t ib      = QP_MIN(rect->b, other->b);
+            uint32_t overlap = (il <= ir && it <= ib) ? rect_area(il, it, ir, ib) : 0;
+            uint32_t covered = rect_area(rect->l, rect->t, rect->r, rect->b) + rect_area(other->l, other->t, other->r, other->b) - overlap;
+            uint16_t ul      = QP_MIN(rect->l, other->l);
+            uint16_t ut      = QP_MIN(rect->t, other->t);
+            uint16_t ur      = QP_MAX(rect->r, other->r);
+            uint16_t ub      = QP_MAX(rect->b, other->b);
+            if (rect_area(ul, ut, ur, ub) > covered + SURFACE_DIRTY_MERGE_THRESHOLD) {
+                continue;
+            }
+
+            rect->l = ul;
+            rect->t = ut;
+            rect->r = ur;
+            rect->b = ub;
+
+            // Fill the hole with the last rectangle, keeping track of ours if it was the one moved
+            uint8_t last = dirty->count - 1;
+            if (i != last) {
+                dirty->rects[i] = dirty->rects[last];
+            }
+            if (index == last) {
+                index = i;
+            }
+            dirty->count--;
+            merged = true;
+            break;
+        }
     }
-    if (dirty->r < x) {
-        dirty->r        = x;
-        dirty->is_dirty = true;
+    dirty->last = index;
+}
+
+void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
+    // Fast path, the pixel is next to the previous one
+    if (dirty->count > 0 && rect_contains(&dirty->rects[dirty->last], x, y)) {
+        return;
     }
-    if (dirty->t > y) {
-        dirty->t        = y;
-        dirty->is_dirty = true;
+
+    // Find the rectangle that is cheapest to grow
+    uint8_t  best        = 0;
+    uint32_t best_growth = UINT32_MAX;
+    for (uint8_t i = 0; i < dirty->count; ++i) {
+        if (rect_contains(&dirty->rects[i], x, y)) {
+            dirty->last = i;
+            return;
+        }
+        uint32_t growth = rect_growth(&dirty->rects[i], x, y);
+        if (growth < best_growth) {
+            best        = i;
+            best_growth = growth;
+        }
     }
-    if (dirty->b < y) {
-        dirty->b        = y;
-        dirty->is_dirty = true;
+
+    // Start a new rectangle if growing would waste too much, and there's room for one
+    if (best_growth > SURFACE_DIRTY_MERGE_THRESHOLD && dirty->count < SURFACE_DIRTY_RECTS) {
+        surface_dirty_rect_t *rect = &dirty->rects[dirty->count];
+        rect->l = rect->r = x;
+        rect->t = rect->b = y;
+        dirty->last       = dirty->count++;
+        return;
     }
+
+    surface_dirty_rect_t *rect = &dirty->rects[best];
+    rect->l                    = QP_MIN(rect->l, x);
+    rect->t                    = QP_MIN(rect->t, y);
+    rect->r                    = QP_MAX(rect->r, x);
+    rect->b                    = QP_MAX(rect->b, y);
+
+    // The grown rectangle may now be worth combining with its neighbours
+    qp_surface_merge_dirty(dirty, best);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,11 +138,12 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     memset(surface->buffer, 0, SURFACE_REQUIRED_BUFFER_BYTE_SIZE(driver->panel_width, driver->panel_height, driver->native_bits_per_pixel));
 
-    surface->dirty.l        = 0;
-    surface->dirty.t        = 0;
-    surface->dirty.r        = surface->base.panel_width - 1;
-    surface->dirty.b        = surface->base.panel_height - 1;
-    surface->dirty.is_dirty = true;
+    surface->dirty.rects[0].l = 0;
+    surface->dirty.rects[0].t = 0;
+    surface->dirty.rects[0].r = surface->base.panel_width - 1;
+    surface->dirty.rects[0].b = surface->base.panel_height - 1;
+    surface->dirty.count      = 1;
+    surface->dirty.last       = 0;
 
     return true;
 }
@@ -80,9 +162,8 @@ bool qp_surface_clear(painter_device_t device) {
 bool qp_surface_flush(painter_device_t device) {
     painter_driver_t *        driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
-    surface->dirty.l = surface->dirty.t = UINT16_MAX;
-    surface->dirty.r = surface->dirty.b = 0;
-    surface->dirty.is_dirty             = false;
+    surface->dirty.count = 0;
+    surface->dirty.last  = 0;
     return true;
 }
 
@@ -111,7 +192,7 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
     painter_driver_t *        target_driver  = (painter_driver_t *)target;
 
     // If we're not dirty... we're done.
-    if (!surface_handle->dirty.is_dirty) {
+    if (!entire_surface && surface_handle->dirty.count == 0) {
         qp_dprintf("qp_surface_draw: ok (not dirty, skipping)\n");
         return true;
     }
@@ -122,16 +203,20 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
         return false;
     }
 
-    // Offload to the pixdata transfer function
+    // Offload each rectangle to the pixdata transfer function
     surface_painter_driver_vtable_t *vtable = (surface_painter_driver_vtable_t *)surface_driver->driver_vtable;
-    bool                             ok     = vtable->target_pixdata_transfer(surface_driver, target_driver, x, y, entire_surface);
-    if (!ok) {
-        qp_dprintf("qp_surface_draw: fail (could not transfer pixel data)\n");
-        return false;
+    surface_dirty_rect_t             whole  = {0, 0, surface_driver->panel_width - 1, surface_driver->panel_height - 1};
+    const surface_dirty_rect_t *     rects  = entire_surface ? &whole : surface_handle->dirty.rects;
+    uint8_t                          count  = entire_surface ? 1 : surface_handle->dirty.count;
+    for (uint8_t i = 0; i < count; ++i) {
+        if (!vtable->target_pixdata_transfer(surface_driver, target_driver, x, y, &rects[i])) {
+            qp_dprintf("qp_surface_draw: fail (could not transfer pixel data)\n");
+            return false;
+        }
     }
 
     // Clear the dirty info for the surface
-    ok = qp_flush(surface);
+    bool ok = qp_flush(surface);
     if (!ok) {
         qp_dprintf("qp_surface_draw: fail (could not flush)\n");
         return false;
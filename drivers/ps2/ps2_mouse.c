@@ -25,6 +25,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "report.h"
 #include "debug.h"
 #include "ps2.h"
+#ifdef KEYBOARD_IDLE_ENABLE
+#    include "keyboard.h"
+#endif
 
 /* ============================= MACROS ============================ */
 
@@ -75,6 +78,11 @@ void ps2_mouse_task(void) {
     static uint8_t buttons_prev = 0;
     extern int     tp_buttons;
 
+#ifdef KEYBOARD_IDLE_ENABLE
+    // Packets are polled, or picked up from the receive buffer
+    keyboard_idle_request(KEYBOARD_IDLE_SCAN_INTERVAL);
+#endif
+
     /* receives packet from mouse */
 #ifdef PS2_MOUSE_USE_REMOTE_MODE
     uint8_t rcv;
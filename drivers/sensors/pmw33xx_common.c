@@ -14,6 +14,14 @@
 #include "wait.h"
 #include "spi_master.h"
 #include "progmem.h"
+#if defined(PMW33XX_MOTION_ASYNC)
+#    include "atomic_util.h"
+#    include "gpio.h"
+#    if defined(PROTOCOL_CHIBIOS)
+#        include <ch.h>
+#        include <hal.h>
+#    endif
+#endif
 
 extern const uint8_t pmw33xx_firmware_data[PMW33XX_FIRMWARE_LENGTH] PROGMEM;
 extern const uint8_t pmw33xx_firmware_signature[3] PROGMEM;
@@ -24,6 +32,49 @@ static const pin_t cs_pins_right[] = PMW33XX_CS_PINS_RIGHT;
 static bool in_burst_left[ARRAY_SIZE(cs_pins_left)]   = {0};
 static bool in_burst_right[ARRAY_SIZE(cs_pins_right)] = {0};
 
+#if defined(PMW33XX_MOTION_ASYNC)
+#    define PMW33XX_MAX_SENSORS MAX(ARRAY_SIZE(cs_pins_left), ARRAY_SIZE(cs_pins_right))
+
+_Static_assert(PMW33XX_MAX_SENSORS <= 8, "PMW33XX_MOTION_ASYNC supports up to 8 sensors");
+
+static const pin_t motion_pins_left[]  = PMW33XX_MOTION_PINS;
+static const pin_t motion_pins_right[] = PMW33XX_MOTION_PINS_RIGHT;
+
+_Static_assert(ARRAY_SIZE(motion_pins_left) == ARRAY_SIZE(cs_pins_left), "PMW33XX_MOTION_PINS must have one pin per sensor");
+_Static_assert(ARRAY_SIZE(motion_pins_right) == ARRAY_SIZE(cs_pins_right), "PMW33XX_MOTION_PINS_RIGHT must have one pin per sensor");
+
+typedef struct {
+    int32_t                delta_x;
+    int32_t                delta_y;
+    bool                   is_motion;
+    bool                   is_lifted;
+    pmw33xx_motion_stats_t stats;
+} pmw33xx_motion_t;
+
+static pmw33xx_motion_t motion_state[PMW33XX_MAX_SENSORS] = {0};
+static volatile uint8_t motion_pending                    = 0;
+static volatile uint8_t motion_ready                      = 0; // Sensors set up by pmw33xx_init()
+static bool             motion_started                    = false;
+
+// Once reads run in the background, each access to a sensor holds the lock until its trailing delays are over. The bus
+// itself is shared with other SPI devices by spi_start() and spi_stop().
+#    define pmw33xx_lock()                        \
+        do {                                      \
+            if (motion_started) {                 \
+                pmw33xx_motion_backend_lock();    \
+            }                                     \
+        } while (0)
+#    define pmw33xx_unlock()                      \
+        do {                                      \
+            if (motion_started) {                 \
+                pmw33xx_motion_backend_unlock();  \
+            }                                     \
+        } while (0)
+#else
+#    define pmw33xx_lock()
+#    define pmw33xx_unlock()
+#endif
+
 bool __attribute__((cold)) pmw33xx_upload_firmware(uint8_t sensor);
 bool __attribute__((cold)) pmw33xx_check_signature(uint8_t sensor);
 
@@ -44,7 +95,9 @@ bool pmw33xx_spi_start(uint8_t sensor) {
 }
 
 bool pmw33xx_write(uint8_t sensor, uint8_t reg_addr, uint8_t data) {
+    pmw33xx_lock();
     if (!pmw33xx_spi_start(sensor)) {
+        pmw33xx_unlock();
         return false;
     }
 
@@ -55,6 +108,8 @@ bool pmw33xx_write(uint8_t sensor, uint8_t reg_addr, uint8_t data) {
     // send address of the register, with MSBit = 1 to indicate it's a write
     uint8_t command[2] = {reg_addr | 0x80, data};
     if (spi_transmit(command, sizeof(command)) != SPI_STATUS_SUCCESS) {
+        spi_stop();
+        pmw33xx_unlock();
         return false;
     }
 
@@ -65,11 +120,14 @@ bool pmw33xx_write(uint8_t sensor, uint8_t reg_addr, uint8_t data) {
     // tSWW/tSWR (=18us) minus tSCLK-NCS. Could be shortened, but it looks like
     // a safe lower bound
     wait_us(145);
+    pmw33xx_unlock();
     return true;
 }
 
 uint8_t pmw33xx_read(uint8_t sensor, uint8_t reg_addr) {
+    pmw33xx_lock();
     if (!pmw33xx_spi_start(sensor)) {
+        pmw33xx_unlock();
         return 0;
     }
 
@@ -85,6 +143,7 @@ uint8_t pmw33xx_read(uint8_t sensor, uint8_t reg_addr) {
 
     //  tSRW/tSRR (=20us) mins tSCLK-NCS
     wait_us(19);
+    pmw33xx_unlock();
     return data;
 }
 
@@ -108,7 +167,9 @@ bool pmw33xx_upload_firmware(uint8_t sensor) {
     wait_ms(10);
     pmw33xx_write(sensor, REG_SROM_Enable, 0x18);
 
+    pmw33xx_lock();
     if (!pmw33xx_spi_start(sensor)) {
+        pmw33xx_unlock();
         return false;
     }
 
@@ -120,6 +181,11 @@ bool pmw33xx_upload_firmware(uint8_t sensor) {
         wait_us(15);
     }
     wait_us(200);
+#if defined(PMW33XX_MOTION_ASYNC)
+    // Nothing else may use the bus once unlocked
+    spi_stop();
+#endif
+    pmw33xx_unlock();
 
     pmw33xx_read(sensor, REG_SROM_ID);
     pmw33xx_write(sensor, REG_Config2, 0x00);
@@ -131,16 +197,24 @@ bool pmw33xx_init(uint8_t sensor) {
     if (sensor >= pmw33xx_number_of_sensors) {
         return false;
     }
+#if defined(PMW33XX_MOTION_ASYNC)
+    ATOMIC_BLOCK_FORCEON {
+        motion_ready &= ~(1 << sensor);
+    }
+#endif
     spi_init();
 
     // power up, need to first drive NCS high then low. the datasheet does not
     // say for how long, 40us works well in practice.
+    pmw33xx_lock();
     if (!pmw33xx_spi_start(sensor)) {
+        pmw33xx_unlock();
         return false;
     }
     wait_us(40);
     spi_stop();
     wait_us(40);
+    pmw33xx_unlock();
 
     if (!pmw33xx_write(sensor, REG_Power_Up_Reset, 0x5a)) {
         return false;
@@ -175,10 +249,25 @@ bool pmw33xx_init(uint8_t sensor) {
         return false;
     }
 
+#if defined(PMW33XX_MOTION_ASYNC)
+    ATOMIC_BLOCK_FORCEON {
+        motion_ready |= 1 << sensor;
+        // Motion from before the sensor was set up has no edge left to trigger on
+        motion_pending |= 1 << sensor;
+    }
+    if (motion_started) {
+        pmw33xx_motion_backend_wake();
+    }
+#endif
+
     return true;
 }
 
-pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
+/**
+ * In the background, the wait for the sensor sleeps instead, so that the main
+ * loop keeps running in the meantime.
+ */
+static pmw33xx_report_t pmw33xx_read_burst_impl(uint8_t sensor, bool background) {
     pmw33xx_report_t report = {0};
 
     if (sensor >= pmw33xx_number_of_sensors) {
@@ -193,12 +282,21 @@ pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
         in_burst[sensor] = true;
     }
 
+    pmw33xx_lock();
     if (!pmw33xx_spi_start(sensor)) {
+        pmw33xx_unlock();
         return report;
     }
 
     spi_write(REG_Motion_Burst);
-    wait_us(35); // waits for tSRAD_MOTBR
+#if defined(PMW33XX_MOTION_ASYNC)
+    if (background) {
+        pmw33xx_motion_backend_sleep_us(35); // waits for tSRAD_MOTBR
+    } else
+#endif
+    {
+        wait_us(35); // waits for tSRAD_MOTBR
+    }
 
     spi_receive((uint8_t*)&report, sizeof(report));
 
@@ -208,6 +306,7 @@ pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
     }
 
     spi_stop();
+    pmw33xx_unlock();
 
     pd_dprintf("PMW33XX (%d): motion: 0x%x dx: %i dy: %i\n", sensor, report.motion.w, report.delta_x, report.delta_y);
 
@@ -216,3 +315,174 @@ pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
 
     return report;
 }
+
+pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
+    return pmw33xx_read_burst_impl(sensor, false);
+}
+
+#if defined(PMW33XX_MOTION_ASYNC)
+void pmw33xx_motion_start(void) {
+    for (uint8_t sensor = 0; sensor < pmw33xx_number_of_sensors; sensor++) {
+        // MOTION is an open drain output, asserted low
+        gpio_set_pin_input_high(motion_pins[sensor]);
+    }
+
+    ATOMIC_BLOCK_FORCEON {
+        // Motion from before the interrupts were set up has no edge left to trigger on
+        motion_pending = motion_ready;
+    }
+    motion_started = true;
+    pmw33xx_motion_backend_start();
+    pmw33xx_motion_backend_wake();
+}
+
+void pmw33xx_motion_interrupt_i(uint8_t sensor) {
+    // Until pmw33xx_init() is done with the sensor, which then reads it anyway
+    if (sensor >= pmw33xx_number_of_sensors || !(motion_ready & (1 << sensor))) {
+        return;
+    }
+
+    motion_state[sensor].stats.interrupts++;
+    if (motion_pending & (1 << sensor)) {
+        motion_state[sensor].stats.missed++;
+    }
+    motion_pending |= 1 << sensor;
+}
+
+bool pmw33xx_motion_service(void) {
+    uint8_t pending = 0;
+    ATOMIC_BLOCK_FORCEON {
+        pending        = motion_pending & motion_ready;
+        motion_pending = 0;
+    }
+
+    for (uint8_t sensor = 0; sensor < pmw33xx_number_of_sensors; sensor++) {
+        if (!(pending & (1 << sensor))) {
+            continue;
+        }
+
+        pmw33xx_report_t report = pmw33xx_read_burst_impl(sensor, true);
+        ATOMIC_BLOCK_FORCEON {
+            pmw33xx_motion_t *state = &motion_state[sensor];
+            state->stats.bursts++;
+            // Deltas read while lifted are noise, the same as when polled
+            state->is_lifted |= report.motion.b.is_lifted;
+            if (report.motion.b.is_motion && !report.motion.b.is_lifted) {
+                if (state->is_motion) {
+                    state->stats.merged++;
+                }
+                state->delta_x += report.delta_x;
+                state->delta_y += report.delta_y;
+                state->is_motion = true;
+            }
+        }
+    }
+
+    // A pin still asserted after its burst has new motion, or a read that failed, without another edge to tell
+    bool again = false;
+    for (uint8_t sensor = 0; sensor < pmw33xx_number_of_sensors; sensor++) {
+        if ((motion_ready & (1 << sensor)) && !gpio_read_pin(motion_pins[sensor])) {
+            ATOMIC_BLOCK_FORCEON {
+                motion_pending |= 1 << sensor;
+            }
+            again = true;
+        }
+    }
+    return again;
+}
+
+pmw33xx_report_t pmw33xx_motion_consume(uint8_t sensor) {
+    pmw33xx_report_t report = {0};
+
+    if (sensor >= pmw33xx_number_of_sensors) {
+        return report;
+    }
+
+    ATOMIC_BLOCK_FORCEON {
+        pmw33xx_motion_t *state = &motion_state[sensor];
+        report.delta_x          = CONSTRAIN(state->delta_x, INT16_MIN, INT16_MAX);
+        report.delta_y          = CONSTRAIN(state->delta_y, INT16_MIN, INT16_MAX);
+        state->delta_x -= report.delta_x;
+        state->delta_y -= report.delta_y;
+
+        report.motion.b.is_motion = state->is_motion;
+        report.motion.b.is_lifted = state->is_lifted && !state->is_motion;
+        state->is_motion          = state->delta_x != 0 || state->delta_y != 0;
+        state->is_lifted          = false;
+    }
+    return report;
+}
+
+pmw33xx_motion_stats_t pmw33xx_motion_get_stats(uint8_t sensor) {
+    pmw33xx_motion_stats_t stats = {0};
+    if (sensor < pmw33xx_number_of_sensors) {
+        ATOMIC_BLOCK_FORCEON {
+            stats = motion_state[sensor].stats;
+        }
+    }
+    return stats;
+}
+
+void pmw33xx_motion_reset_stats(void) {
+    ATOMIC_BLOCK_FORCEON {
+        for (uint8_t sensor = 0; sensor < PMW33XX_MAX_SENSORS; sensor++) {
+            memset(&motion_state[sensor].stats, 0, sizeof(pmw33xx_motion_stats_t));
+        }
+    }
+}
+
+#    if defined(PROTOCOL_CHIBIOS)
+static MUTEX_DECL(pmw33xx_mutex);
+static BSEMAPHORE_DECL(motion_semaphore, true);
+
+static void motion_pin_callback(void *arg) {
+    chSysLockFromISR();
+    pmw33xx_motion_interrupt_i((uint8_t)(uintptr_t)arg);
+    chBSemSignalI(&motion_semaphore);
+    chSysUnlockFromISR();
+}
+
+#        ifndef PMW33XX_MOTION_THREAD_STACK_SIZE
+#            define PMW33XX_MOTION_THREAD_STACK_SIZE 256
+#        endif
+
+static THD_WORKING_AREA(waMotionThread, PMW33XX_MOTION_THREAD_STACK_SIZE);
+static THD_FUNCTION(MotionThread, arg) {
+    (void)arg;
+    chRegSetThreadName("pmw33xx_motion");
+
+    while (true) {
+        chBSemWait(&motion_semaphore);
+        // Motion keeps coming while the sensor moves, read it again a tick later rather than back to back
+        while (pmw33xx_motion_service()) {
+            chThdSleep(1);
+        }
+    }
+}
+
+void pmw33xx_motion_backend_start(void) {
+    for (uint8_t sensor = 0; sensor < pmw33xx_number_of_sensors; sensor++) {
+        palEnableLineEvent(motion_pins[sensor], PAL_EVENT_MODE_FALLING_EDGE);
+        palSetLineCallback(motion_pins[sensor], motion_pin_callback, (void *)(uintptr_t)sensor);
+    }
+    // Above the main loop, which never sleeps, and asleep itself while waiting on the sensor or the bus
+    chThdCreateStatic(waMotionThread, sizeof(waMotionThread), NORMALPRIO + 1, MotionThread, NULL);
+}
+
+void pmw33xx_motion_backend_wake(void) {
+    chBSemSignal(&motion_semaphore);
+}
+
+void pmw33xx_motion_backend_lock(void) {
+    chMtxLock(&pmw33xx_mutex);
+}
+
+void pmw33xx_motion_backend_unlock(void) {
+    chMtxUnlock(&pmw33xx_mutex);
+}
+
+void pmw33xx_motion_backend_sleep_us(uint16_t us) {
+    chThdSleepMicroseconds(us);
+}
+#    endif
+#endif
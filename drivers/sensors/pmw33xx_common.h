@@ -90,6 +90,35 @@ _Static_assert(sizeof((pmw33xx_report_t){0}.motion) == 1, "pmw33xx_report_t.moti
         { PMW33XX_CS_PIN_RIGHT }
 #endif
 
+#if defined(PMW33XX_MOTION_ASYNC)
+#    if defined(__AVR__)
+#        error "PMW33XX_MOTION_ASYNC is only supported on ChibiOS"
+#    endif
+#    if defined(POINTING_DEVICE_MOTION_PIN)
+#        error "POINTING_DEVICE_MOTION_PIN would skip motion already read in the background, use PMW33XX_MOTION_PIN with PMW33XX_MOTION_ASYNC instead"
+#    endif
+
+// Support single and plural spellings
+#    ifndef PMW33XX_MOTION_PINS
+#        ifndef PMW33XX_MOTION_PIN
+#            error "No motion pin defined -- missing PMW33XX_MOTION_PIN or PMW33XX_MOTION_PINS, required by PMW33XX_MOTION_ASYNC"
+#        endif
+#        define PMW33XX_MOTION_PINS \
+            { PMW33XX_MOTION_PIN }
+#    endif
+
+// Support single spelling and default to be the same as left side
+#    if !defined(PMW33XX_MOTION_PINS_RIGHT)
+#        if !defined(PMW33XX_MOTION_PIN_RIGHT)
+#            define PMW33XX_MOTION_PIN_RIGHT PMW33XX_MOTION_PIN
+#        endif
+#        define PMW33XX_MOTION_PINS_RIGHT \
+            { PMW33XX_MOTION_PIN_RIGHT }
+#    endif
+
+#    define motion_pins (is_keyboard_left() ? motion_pins_left : motion_pins_right)
+#endif
+
 // Defines so the old variable names are swapped by the appropiate value on each half
 #define cs_pins (is_keyboard_left() ? cs_pins_left : cs_pins_right)
 #define in_burst (is_keyboard_left() ? in_burst_left : in_burst_right)
@@ -170,3 +199,49 @@ uint8_t pmw33xx_read(uint8_t sensor, uint8_t reg_addr);
  * @return false Write failed, do not proceed operation
  */
 bool pmw33xx_write(uint8_t sensor, uint8_t reg_addr, uint8_t data);
+
+#if defined(PMW33XX_MOTION_ASYNC)
+typedef struct pmw33xx_motion_stats_t {
+    uint32_t interrupts; // Motion interrupts taken
+    uint32_t bursts;     // Burst reads done in the background
+    uint32_t merged;     // Bursts whose motion was added to motion not consumed yet
+    uint32_t missed;     // Interrupts that came in with a burst read already pending, and were folded into it
+} pmw33xx_motion_stats_t;
+
+/**
+ * @brief Starts reading all sensors in the background whenever their motion
+ * pin fires. Call once after every sensor was initialized, from then on
+ * pmw33xx_motion_consume() replaces pmw33xx_read_burst().
+ */
+void pmw33xx_motion_start(void);
+
+/**
+ * @brief Takes the motion read from the given sensor since the last call.
+ * Deltas beyond the range of a report are left for the next call.
+ *
+ * @param sensor Index of the sensors chip select pin
+ * @return pmw33xx_report_t Accumulated deltas, with is_motion set if there
+ * are any and is_lifted set if the sensor was lifted since
+ */
+pmw33xx_report_t pmw33xx_motion_consume(uint8_t sensor);
+
+/**
+ * @brief Gets the background read counters of the given sensor.
+ *
+ * @param sensor Index of the sensors chip select pin
+ */
+pmw33xx_motion_stats_t pmw33xx_motion_get_stats(uint8_t sensor);
+
+void pmw33xx_motion_reset_stats(void);
+
+// Backend interface, called by the platform's interrupt and thread
+void pmw33xx_motion_interrupt_i(uint8_t sensor); // With the system locked
+bool pmw33xx_motion_service(void);               // Reads the pending sensors, true if any has motion again
+
+// Implemented by the platform
+void pmw33xx_motion_backend_start(void);
+void pmw33xx_motion_backend_wake(void); // Has pmw33xx_motion_service() called soon, as after an interrupt
+void pmw33xx_motion_backend_lock(void);
+void pmw33xx_motion_backend_unlock(void);
+void pmw33xx_motion_backend_sleep_us(uint16_t us);
+#endif
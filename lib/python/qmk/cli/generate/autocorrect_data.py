@@ -232,6 +232,90 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     return [b for e in table for b in serialize(e)]  # Serialize final table.
 
 
+def serialize_flat_trie(trie: Dict[str, Any]) -> List[int]:
+    """Serializes the trie in the flat format, with sorted child arrays.
+  Nodes are laid out depth first from the root at offset 0:
+    leaf:   128 | backspaces, then the null-terminated correction
+    chain:  64 | length (1-63), then that many keycodes, followed directly by the child node
+    branch: child count (2-28), then the sorted keycodes, then a little endian 16-bit offset per child
+  Args:
+    trie: Dict of dicts.
+  Returns:
+    List of ints in the range 0-255.
+  """
+    data = []
+
+    def leaf_data(typo: str, correction: str) -> List[int]:
+        word_boundary_ending = typo[-1] == ':'
+        typo = typo.strip(':')
+        i = 0
+        while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+            i += 1
+        backspaces = len(typo) - i - 1 + word_boundary_ending
+        assert 0 <= backspaces <= 63
+        return [backspaces + 128] + list(bytes(correction[i:], 'ascii')) + [0]
+
+    def emit(trie_node: Dict[str, Any]) -> int:
+        offset = len(data)
+        if 'LEAF' in trie_node:
+            data.extend(leaf_data(*trie_node['LEAF']))
+        elif len(trie_node) == 1:
+            chars = []
+            while len(trie_node) == 1 and 'LEAF' not in trie_node:
+                c, trie_node = next(iter(trie_node.items()))
+                chars.append(TYPO_CHARS[c])
+            for start in range(0, len(chars), 63):
+                chunk = chars[start:start + 63]
+                data.extend([64 | len(chunk)] + chunk)
+            emit(trie_node)
+        else:
+            children = sorted(trie_node.items(), key=lambda item: TYPO_CHARS[item[0]])
+            data.append(len(children))
+            data.extend(TYPO_CHARS[c] for c, _ in children)
+            links = len(data)
+            data.extend([0, 0] * len(children))
+            for n, (_, child) in enumerate(children):
+                child_offset = emit(child)
+                if child_offset > 0xffff:
+                    cli.log.error('{fg_red}Error:{fg_reset} The autocorrection table is too large, a node link exceeds 64KB limit. Try reducing the autocorrection dict to fewer entries.')
+                    sys.exit(1)
+                data[links + 2 * n] = child_offset & 255
+                data[links + 2 * n + 1] = child_offset >> 8
+        return offset
+
+    emit(trie)
+    return data
+
+
+def bloom_hash(keycodes: List[int]) -> int:
+    """Hashes the last keycodes typed, newest first. Must match autocorrect_bloom_hash() in process_autocorrect.c."""
+    h = 0
+    for kc in keycodes:
+        h = (h * 33 + kc) & 0xffff
+    return h
+
+
+def make_bloom_filter(autocorrections: List[Tuple[str, str]], suffix_length: int) -> List[int]:
+    """Makes a filter over the last `suffix_length` characters of every typo.
+  A keystroke can only complete a typo if the hash of the buffer's last characters has its bit set, so most keystrokes
+  are rejected without walking the trie.
+  Returns:
+    List of ints in the range 0-255, a power of two bytes long.
+  """
+    suffixes = {tuple(TYPO_CHARS[c] for c in reversed(typo[-suffix_length:])) for typo, _ in autocorrections}
+
+    # Roughly 8 bits per suffix keeps false positives around one in eight
+    bits = 64
+    while bits < 8 * len(suffixes) and bits < 8192:
+        bits *= 2
+
+    bloom = [0] * (bits // 8)
+    for suffix in suffixes:
+        bit = bloom_hash(list(suffix)) & (bits - 1)
+        bloom[bit >> 3] |= 1 << (bit & 7)
+    return bloom
+
+
 def encode_link(link: Dict[str, Any]) -> List[int]:
     """Encodes a node link as two bytes."""
     byte_offset = link['byte_offset']
@@ -254,11 +338,15 @@ def to_hex(b: int) -> str:
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a configurator export is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('-f', '--flat', arg_only=True, action='store_true', help="Generate the flat trie format, with sorted child arrays and a suffix bloom filter")
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
     trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    if cli.args.flat:
+        data = serialize_flat_trie(trie)
+    else:
+        data = serialize_trie(autocorrections, trie)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -283,6 +371,18 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
     autocorrect_data_h_lines.append('')
+
+    if cli.args.flat:
+        suffix_length = min(3, len(min_typo))
+        bloom = make_bloom_filter(autocorrections, suffix_length)
+        autocorrect_data_h_lines.append('#define AUTOCORRECT_FLAT_TRIE')
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_BLOOM_SUFFIX {suffix_length}')
+        autocorrect_data_h_lines.append(f'#define AUTOCORRECT_BLOOM_BITS {len(bloom) * 8}')
+        autocorrect_data_h_lines.append('')
+        autocorrect_data_h_lines.append('static const uint8_t autocorrect_bloom[AUTOCORRECT_BLOOM_BITS / 8] PROGMEM = {')
+        autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, bloom))), width=100, subsequent_indent='    '))
+        autocorrect_data_h_lines.append('};')
+        autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
     autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
     autocorrect_data_h_lines.append('};')
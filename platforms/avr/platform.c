@@ -16,6 +16,17 @@
 
 #include "platform_deps.h"
 
+#ifdef KEYBOARD_IDLE_ENABLE
+#    include <avr/sleep.h>
+#    include "timer.h"
+#endif
+
+#ifdef TASK_PROFILER_ENABLE
+#    include <util/atomic.h>
+#    include "timer_avr.h"
+#    include "task_profiler.h"
+#endif
+
 static void disable_jtag(void) {
 // To use PF4-7 (PC2-5 on ATmega32A), disable JTAG by writing JTD bit twice within four cycles.
 #if (defined(__AVR_AT90USB646__) || defined(__AVR_AT90USB647__) || defined(__AVR_AT90USB1286__) || defined(__AVR_AT90USB1287__) || defined(__AVR_ATmega16U4__) || defined(__AVR_ATmega32U4__))
@@ -30,3 +41,57 @@ static void disable_jtag(void) {
 void platform_setup(void) {
     disable_jtag();
 }
+
+#ifdef KEYBOARD_IDLE_ENABLE
+static volatile bool idle_wake_pending = false;
+
+void platform_idle_wait(uint32_t timeout_ms) {
+    uint32_t start = timer_read32();
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    // The timer interrupt wakes the MCU every millisecond
+    while (timer_elapsed32(start) < timeout_ms) {
+        cli();
+        if (idle_wake_pending) {
+            sei();
+            break;
+        }
+        sleep_enable();
+        sei();
+        sleep_cpu();
+        sleep_disable();
+    }
+    idle_wake_pending = false;
+}
+
+void platform_idle_wake(void) {
+    idle_wake_pending = true;
+}
+#endif
+
+#ifdef TASK_PROFILER_ENABLE
+extern volatile uint32_t timer_count;
+
+#    if defined(TIFR0)
+#        define TIMER0_COMPARE_PENDING() (TIFR0 & _BV(OCF0A))
+#    else
+#        define TIMER0_COMPARE_PENDING() (TIFR & _BV(OCF0))
+#    endif
+
+uint32_t task_profiler_ticks(void) {
+    uint32_t count;
+    uint8_t  raw;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        count = timer_count;
+        raw   = TIMER_RAW;
+        // The counter may have wrapped after interrupts were disabled
+        if (TIMER0_COMPARE_PENDING() && raw < (TIMER_RAW_TOP / 2)) {
+            count++;
+        }
+    }
+    return count * (TIMER_RAW_TOP + 1) + raw;
+}
+
+uint32_t task_profiler_tick_frequency(void) {
+    return TIMER_RAW_FREQ;
+}
+#endif
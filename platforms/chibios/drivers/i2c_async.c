@@ -0,0 +1,302 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "i2c_async.h"
+#include <stddef.h>
+#include "atomic_util.h"
+#include "timer.h"
+
+typedef enum {
+    I2C_ASYNC_FREE,
+    I2C_ASYNC_CLAIMED, // Being filled in by the caller, not visible to the backend yet
+    I2C_ASYNC_PENDING,
+    I2C_ASYNC_ACTIVE,
+    I2C_ASYNC_DONE,
+} i2c_async_state_t;
+
+typedef struct i2c_async_slot_t {
+    i2c_async_request_t  request;
+    i2c_async_callback_t callback;
+    void                *cb_arg;
+    uint32_t             sequence;
+    i2c_status_t         status;
+    uint8_t              regaddr[2];
+    uint8_t              priority;
+    bool                 blocking; // Reaped by i2c_async_blocking() rather than i2c_async_task()
+    volatile uint8_t     state;
+} i2c_async_slot_t;
+
+// The last slot is kept for i2c_async_blocking(), so that it never waits for the queue or runs callbacks
+#define BLOCKING_SLOT I2C_ASYNC_QUEUE_SIZE
+
+static i2c_async_slot_t  slots[I2C_ASYNC_QUEUE_SIZE + 1];
+static i2c_async_slot_t *active_slot   = NULL;
+static uint32_t          next_sequence = 0;
+static i2c_async_stats_t stats         = {0};
+
+// Completed transactions waiting for their callback, in completion order. Blocking ones are reaped by their caller.
+static uint8_t done_queue[I2C_ASYNC_QUEUE_SIZE];
+static uint8_t done_head  = 0;
+static uint8_t done_count = 0;
+
+// Set while i2c_async_task() invokes callbacks, which must not wait for it
+static bool in_task = false;
+
+static bool i2c_async_try_claim(i2c_async_slot_t *slot) {
+    ATOMIC_BLOCK_FORCEON {
+        if (slot->state == I2C_ASYNC_FREE) {
+            slot->state = I2C_ASYNC_CLAIMED;
+            if (++stats.queue_depth > stats.max_queue_depth) {
+                stats.max_queue_depth = stats.queue_depth;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns NULL if the queue is full and this is called from a callback
+static i2c_async_slot_t *i2c_async_claim(void) {
+    while (true) {
+        for (uint8_t i = 0; i < I2C_ASYNC_QUEUE_SIZE; i++) {
+            if (i2c_async_try_claim(&slots[i])) {
+                return &slots[i];
+            }
+        }
+
+        // Full, slots are only freed once their callbacks have run, which a callback cannot wait for
+        if (in_task) {
+            return NULL;
+        }
+        i2c_async_task();
+        i2c_async_backend_yield();
+    }
+}
+
+static void i2c_async_release(i2c_async_slot_t *slot) {
+    slot->state = I2C_ASYNC_FREE;
+    stats.queue_depth--;
+}
+
+static void i2c_async_queue(i2c_async_slot_t *slot, uint8_t priority, bool blocking, i2c_async_callback_t callback, void *cb_arg) {
+    // Only blocking transactions may jump ahead of everything queued
+    if (!blocking && priority > I2C_ASYNC_PRIORITY_HIGH) {
+        priority = I2C_ASYNC_PRIORITY_HIGH;
+    }
+    slot->callback = callback;
+    slot->cb_arg   = cb_arg;
+    slot->priority = priority;
+    slot->blocking = blocking;
+    ATOMIC_BLOCK_FORCEON {
+        slot->sequence = next_sequence++;
+        slot->state    = I2C_ASYNC_PENDING;
+    }
+    i2c_async_backend_kick();
+}
+
+static i2c_status_t i2c_async_submit(const i2c_async_request_t *request, uint8_t priority, i2c_async_callback_t callback, void *cb_arg) {
+    if (request->tx_length == 0 && request->rx_length == 0) {
+        return I2C_STATUS_ERROR;
+    }
+
+    i2c_async_slot_t *slot = i2c_async_claim();
+    if (slot == NULL) {
+        return I2C_STATUS_ERROR;
+    }
+    slot->request = *request;
+    i2c_async_queue(slot, priority, false, callback, cb_arg);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout, uint8_t priority, i2c_async_callback_t callback, void *cb_arg) {
+    i2c_async_request_t request = {.address = address, .tx_data = data, .tx_length = length, .timeout = timeout};
+    return i2c_async_submit(&request, priority, callback, cb_arg);
+}
+
+i2c_status_t i2c_receive_async(uint8_t address, uint8_t *data, uint16_t length, uint16_t timeout, uint8_t priority, i2c_async_callback_t callback, void *cb_arg) {
+    i2c_async_request_t request = {.address = address, .rx_data = data, .rx_length = length, .timeout = timeout};
+    return i2c_async_submit(&request, priority, callback, cb_arg);
+}
+
+static i2c_status_t i2c_async_read_register(uint8_t devaddr, uint16_t regaddr, uint8_t reglen, uint8_t *data, uint16_t length, uint16_t timeout, uint8_t priority, i2c_async_callback_t callback, void *cb_arg) {
+    if (length == 0) {
+        return I2C_STATUS_ERROR;
+    }
+
+    // The register address is kept in the slot, so the caller needn't keep it alive
+    i2c_async_slot_t *slot = i2c_async_claim();
+    if (slot == NULL) {
+        return I2C_STATUS_ERROR;
+    }
+    if (reglen == 2) {
+        slot->regaddr[0] = regaddr >> 8;
+        slot->regaddr[1] = regaddr & 0xFF;
+    } else {
+        slot->regaddr[0] = regaddr;
+    }
+    slot->request = (i2c_async_request_t){.address = devaddr, .tx_data = slot->regaddr, .tx_length = reglen, .rx_data = data, .rx_length = length, .timeout = timeout};
+    i2c_async_queue(slot, priority, false, callback, cb_arg);
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_read_register_async(uint8_t devaddr, uint8_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout, uint8_t priority, i2c_async_callback_t callback, void *cb_arg) {
+    return i2c_async_read_register(devaddr, regaddr, 1, data, length, timeout, priority, callback, cb_arg);
+}
+
+i2c_status_t i2c_read_register16_async(uint8_t devaddr, uint16_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout, uint8_t priority, i2c_async_callback_t callback, void *cb_arg) {
+    return i2c_async_read_register(devaddr, regaddr, 2, data, length, timeout, priority, callback, cb_arg);
+}
+
+bool i2c_async_busy(void) {
+    return stats.queue_depth > 0;
+}
+
+void i2c_async_task(void) {
+    // Callbacks are never nested, a callback waiting on the queue gets the rest of them after it returns
+    if (in_task) {
+        return;
+    }
+
+    in_task = true;
+    while (true) {
+        i2c_async_callback_t callback = NULL;
+        void                *cb_arg   = NULL;
+        i2c_status_t         status   = I2C_STATUS_SUCCESS;
+        bool                 found    = false;
+
+        ATOMIC_BLOCK_FORCEON {
+            if (done_count > 0) {
+                i2c_async_slot_t *slot = &slots[done_queue[done_head]];
+                done_head              = (done_head + 1) % I2C_ASYNC_QUEUE_SIZE;
+                done_count--;
+
+                callback = slot->callback;
+                cb_arg   = slot->cb_arg;
+                status   = slot->status;
+                found    = true;
+                i2c_async_release(slot);
+            }
+        }
+
+        if (!found) {
+            break;
+        }
+        // The slot is already free, so the callback may queue the next transaction
+        if (callback) {
+            callback(status, cb_arg);
+        }
+    }
+    in_task = false;
+}
+
+i2c_status_t i2c_async_wait(uint16_t timeout) {
+    // The callbacks it would wait for only run once the current one returns
+    if (in_task) {
+        return I2C_STATUS_ERROR;
+    }
+
+    uint16_t timeout_timer = timer_read();
+    while (true) {
+        i2c_async_task();
+        if (!i2c_async_busy()) {
+            return I2C_STATUS_SUCCESS;
+        }
+        if ((timeout != I2C_TIMEOUT_INFINITE) && (timer_elapsed(timeout_timer) >= timeout)) {
+            return I2C_STATUS_TIMEOUT;
+        }
+        i2c_async_backend_yield();
+    }
+}
+
+void i2c_async_get_stats(i2c_async_stats_t *stats_out) {
+    ATOMIC_BLOCK_FORCEON {
+        *stats_out = stats;
+    }
+}
+
+void i2c_async_reset_stats(void) {
+    ATOMIC_BLOCK_FORCEON {
+        stats = (i2c_async_stats_t){.queue_depth = stats.queue_depth, .max_queue_depth = stats.queue_depth};
+    }
+}
+
+i2c_status_t i2c_async_blocking(const i2c_async_request_t *request) {
+    i2c_async_slot_t *slot = &slots[BLOCKING_SLOT];
+
+    // Always free here, blocking callers are serialised by the backend lock
+    i2c_async_backend_lock();
+    i2c_async_try_claim(slot);
+    slot->request = *request;
+    i2c_async_queue(slot, I2C_ASYNC_PRIORITY_BLOCKING, true, NULL, NULL);
+    i2c_async_backend_wait_blocking();
+
+    i2c_status_t status = slot->status;
+    ATOMIC_BLOCK_FORCEON {
+        i2c_async_release(slot);
+    }
+    i2c_async_backend_unlock();
+    return status;
+}
+
+const i2c_async_request_t *i2c_async_next(void) {
+    const i2c_async_request_t *request = NULL;
+
+    ATOMIC_BLOCK_FORCEON {
+        if (active_slot == NULL) {
+            // Highest priority first, then oldest first
+            i2c_async_slot_t *next = NULL;
+            for (uint8_t i = 0; i <= BLOCKING_SLOT; i++) {
+                i2c_async_slot_t *slot = &slots[i];
+                if (slot->state == I2C_ASYNC_PENDING && (next == NULL || slot->priority > next->priority || (slot->priority == next->priority && (int32_t)(slot->sequence - next->sequence) < 0))) {
+                    next = slot;
+                }
+            }
+
+            if (next != NULL) {
+                for (uint8_t i = 0; i <= BLOCKING_SLOT; i++) {
+                    i2c_async_slot_t *slot = &slots[i];
+                    if (slot->state == I2C_ASYNC_PENDING && (int32_t)(slot->sequence - next->sequence) < 0) {
+                        stats.preemptions++;
+                        break;
+                    }
+                }
+
+                next->state = I2C_ASYNC_ACTIVE;
+                active_slot = next;
+                request     = &next->request;
+            }
+        }
+    }
+
+    return request;
+}
+
+void i2c_async_complete(i2c_status_t status, uint32_t busy_time_us) {
+    bool blocking = false;
+
+    ATOMIC_BLOCK_FORCEON {
+        i2c_async_slot_t *slot = active_slot;
+        if (slot != NULL) {
+            stats.transactions++;
+            stats.busy_time_us += busy_time_us;
+            if (status == I2C_STATUS_SUCCESS) {
+                stats.bytes += slot->request.tx_length + slot->request.rx_length;
+            } else {
+                stats.errors++;
+            }
+
+            slot->status = status;
+            blocking     = slot->blocking;
+            if (!blocking) {
+                done_queue[(done_head + done_count) % I2C_ASYNC_QUEUE_SIZE] = slot - slots;
+                done_count++;
+            }
+            slot->state = I2C_ASYNC_DONE;
+            active_slot = NULL;
+        }
+    }
+
+    if (blocking) {
+        i2c_async_backend_signal_blocking();
+    }
+}
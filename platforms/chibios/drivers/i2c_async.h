@@ -0,0 +1,141 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/* Queue of I2C transactions, executed one at a time by a backend in the
+ * background. The highest priority transaction waiting is always the next one
+ * on the bus, so a short, urgent read only waits for the transaction already
+ * in progress rather than for everything queued before it.
+ *
+ * Completion callbacks are invoked from i2c_async_task() or i2c_async_wait(),
+ * never from the backend or a blocking transaction, so they may use the rest
+ * of the firmware freely. They are never nested: from a callback, queueing
+ * fails instead of waiting if the queue is full, and i2c_async_wait() fails.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "i2c_master.h"
+
+#ifndef I2C_ASYNC_QUEUE_SIZE
+#    define I2C_ASYNC_QUEUE_SIZE 8
+#endif
+
+#if I2C_ASYNC_QUEUE_SIZE > 255
+#    error "I2C_ASYNC_QUEUE_SIZE must be 255 or less"
+#endif
+
+#define I2C_ASYNC_PRIORITY_LOW 0
+#define I2C_ASYNC_PRIORITY_NORMAL 1
+#define I2C_ASYNC_PRIORITY_HIGH 2
+// Used by the blocking API, so that it never waits behind queued transactions. Higher priorities passed to the
+// asynchronous API are treated as I2C_ASYNC_PRIORITY_HIGH.
+#define I2C_ASYNC_PRIORITY_BLOCKING 3
+
+typedef void (*i2c_async_callback_t)(i2c_status_t status, void *cb_arg);
+
+typedef struct i2c_async_stats_t {
+    uint32_t transactions;    // Transactions completed, successfully or not
+    uint32_t errors;          // Transactions that failed or timed out
+    uint32_t bytes;           // Bytes sent and received
+    uint32_t busy_time_us;    // Time the bus spent on transactions, compare against elapsed time for utilisation
+    uint32_t preemptions;     // Transactions started ahead of a lower priority one queued earlier
+    uint8_t  queue_depth;     // Transactions queued or in progress right now
+    uint8_t  max_queue_depth; // Peak of queue_depth
+} i2c_async_stats_t;
+
+/**
+ * Queues a write of `length` bytes to `address`. The data must stay untouched until the callback has been invoked.
+ * If I2C_ASYNC_QUEUE_SIZE transactions are already queued, invokes the callbacks of completed ones until a slot is free,
+ * or returns I2C_STATUS_ERROR if called from a callback.
+ */
+i2c_status_t i2c_transmit_async(uint8_t address, const uint8_t *data, uint16_t length, uint16_t timeout, uint8_t priority, i2c_async_callback_t callback, void *cb_arg);
+
+/**
+ * Queues a read of `length` bytes from `address` into `data`, which is only valid once the callback has been invoked.
+ */
+i2c_status_t i2c_receive_async(uint8_t address, uint8_t *data, uint16_t length, uint16_t timeout, uint8_t priority, i2c_async_callback_t callback, void *cb_arg);
+
+/**
+ * Queues a read of `length` bytes starting at register `regaddr` of `devaddr`.
+ */
+i2c_status_t i2c_read_register_async(uint8_t devaddr, uint8_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout, uint8_t priority, i2c_async_callback_t callback, void *cb_arg);
+
+/**
+ * Queues a read of `length` bytes starting at 16-bit register `regaddr` of `devaddr`.
+ */
+i2c_status_t i2c_read_register16_async(uint8_t devaddr, uint16_t regaddr, uint8_t *data, uint16_t length, uint16_t timeout, uint8_t priority, i2c_async_callback_t callback, void *cb_arg);
+
+/**
+ * Returns true while any transaction is queued, in progress, or waiting for its callback.
+ */
+bool i2c_async_busy(void);
+
+/**
+ * Invokes the callbacks of completed transactions until none are left, or `timeout` milliseconds have passed. Returns
+ * I2C_STATUS_ERROR if called from a callback.
+ */
+i2c_status_t i2c_async_wait(uint16_t timeout);
+
+/**
+ * Invokes the callbacks of transactions that have completed since the last call. Called from the main loop.
+ */
+void i2c_async_task(void);
+
+void i2c_async_get_stats(i2c_async_stats_t *stats);
+
+/**
+ * Zeroes the counters in the statistics, and sets the peak queue depth to the current one, to start a new measurement.
+ */
+void i2c_async_reset_stats(void);
+
+// Interface to the backend executing the queue, i2c_master.c on ChibiOS
+
+typedef struct i2c_async_request_t {
+    uint8_t        address;
+    const uint8_t *tx_data;
+    uint16_t       tx_length;
+    uint8_t       *rx_data;
+    uint16_t       rx_length;
+    uint16_t       timeout;
+} i2c_async_request_t;
+
+/**
+ * Queues `request` at I2C_ASYNC_PRIORITY_BLOCKING and waits for it to complete. The request and its buffers only need
+ * to live until this returns. It has a slot of its own, so it neither waits for a full queue nor invokes callbacks.
+ */
+i2c_status_t i2c_async_blocking(const i2c_async_request_t *request);
+
+/**
+ * Takes the next transaction for the backend to execute, or NULL if nothing is queued. Only one transaction may be
+ * taken at a time, and must be followed by i2c_async_complete().
+ */
+const i2c_async_request_t *i2c_async_next(void);
+
+/**
+ * Reports the outcome of the transaction taken with i2c_async_next(), along with how long it occupied the bus.
+ */
+void i2c_async_complete(i2c_status_t status, uint32_t busy_time_us);
+
+/**
+ * Implemented by the backend: a transaction has been queued, start on it if the bus is idle.
+ */
+void i2c_async_backend_kick(void);
+
+/**
+ * Implemented by the backend: the caller is waiting for a transaction to complete.
+ */
+void i2c_async_backend_yield(void);
+
+/**
+ * Implemented by the backend: serialises i2c_async_blocking() between threads.
+ */
+void i2c_async_backend_lock(void);
+void i2c_async_backend_unlock(void);
+
+/**
+ * Implemented by the backend: waits for i2c_async_backend_signal_blocking(), which i2c_async_complete() calls once the
+ * transaction of i2c_async_blocking() is done.
+ */
+void i2c_async_backend_wait_blocking(void);
+void i2c_async_backend_signal_blocking(void);
@@ -27,6 +27,7 @@
  */
 
 #include "i2c_master.h"
+#include "i2c_async.h"
 #include "gpio.h"
 #include "chibios_config.h"
 #include <string.h>
@@ -149,34 +150,111 @@ __attribute__((weak)) void i2c_init(void) {
     }
 }
 
-i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+/**
+ * @brief Executes a transaction on the bus, writing and then reading if both
+ * have a length.
+ */
+static i2c_status_t i2c_execute(const i2c_async_request_t* request) {
     i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
+    msg_t status;
+    if (request->tx_length == 0) {
+        status = i2cMasterReceiveTimeout(&I2C_DRIVER, (request->address >> 1), request->rx_data, request->rx_length, TIME_MS2I(request->timeout));
+    } else {
+        status = i2cMasterTransmitTimeout(&I2C_DRIVER, (request->address >> 1), request->tx_data, request->tx_length, request->rx_data, request->rx_length, TIME_MS2I(request->timeout));
+    }
     return i2c_epilogue(status);
 }
 
+#ifdef I2C_ASYNC_ENABLE
+#    ifndef I2C_ASYNC_THREAD_STACK_SIZE
+#        define I2C_ASYNC_THREAD_STACK_SIZE 256
+#    endif
+
+static THD_WORKING_AREA(waI2CAsyncThread, I2C_ASYNC_THREAD_STACK_SIZE);
+static binary_semaphore_t i2c_async_work;
+static MUTEX_DECL(i2c_async_blocking_mutex);
+static BSEMAPHORE_DECL(i2c_async_blocking_done, true);
+
+/**
+ * @brief Works through the transaction queue, sleeping while it is empty. It
+ * runs above the main loop so that the bus is never left idle while work is
+ * queued, but spends nearly all of its time blocked on the I2C driver.
+ */
+static THD_FUNCTION(I2CAsyncThread, arg) {
+    (void)arg;
+    chRegSetThreadName("i2c_async");
+
+    while (true) {
+        const i2c_async_request_t* request = i2c_async_next();
+        if (request == NULL) {
+            chBSemWait(&i2c_async_work);
+            continue;
+        }
+
+        systime_t    start  = chVTGetSystemTimeX();
+        i2c_status_t status = i2c_execute(request);
+        i2c_async_complete(status, TIME_I2US(chVTTimeElapsedSinceX(start)));
+    }
+}
+
+void i2c_async_backend_kick(void) {
+    static bool is_started = false;
+    if (!is_started) {
+        is_started = true;
+        chBSemObjectInit(&i2c_async_work, true);
+        chThdCreateStatic(waI2CAsyncThread, sizeof(waI2CAsyncThread), NORMALPRIO + 1, I2CAsyncThread, NULL);
+    }
+    chBSemSignal(&i2c_async_work);
+}
+
+void i2c_async_backend_yield(void) {
+    chThdYield();
+}
+
+void i2c_async_backend_lock(void) {
+    chMtxLock(&i2c_async_blocking_mutex);
+}
+
+void i2c_async_backend_unlock(void) {
+    chMtxUnlock(&i2c_async_blocking_mutex);
+}
+
+void i2c_async_backend_wait_blocking(void) {
+    chBSemWait(&i2c_async_blocking_done);
+}
+
+void i2c_async_backend_signal_blocking(void) {
+    chBSemSignal(&i2c_async_blocking_done);
+}
+
+// Blocking transactions go through the queue as well, so they cannot collide with one in progress
+#    define i2c_submit(request) i2c_async_blocking(request)
+#else
+#    define i2c_submit(request) i2c_execute(request)
+#endif
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_request_t request = {.address = address, .tx_data = data, .tx_length = length, .timeout = timeout};
+    return i2c_submit(&request);
+}
+
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (address >> 1), data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    i2c_async_request_t request = {.address = address, .rx_data = data, .rx_length = length, .timeout = timeout};
+    return i2c_submit(&request);
 }
 
 i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-
     uint8_t complete_packet[length + 1];
     for (uint16_t i = 0; i < length; i++) {
         complete_packet[i + 1] = data[i];
     }
     complete_packet[0] = regaddr;
 
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), complete_packet, length + 1, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    i2c_async_request_t request = {.address = devaddr, .tx_data = complete_packet, .tx_length = length + 1, .timeout = timeout};
+    return i2c_submit(&request);
 }
 
 i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-
     uint8_t complete_packet[length + 2];
     for (uint16_t i = 0; i < length; i++) {
         complete_packet[i + 2] = data[i];
@@ -184,21 +262,19 @@ i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8
     complete_packet[0] = regaddr >> 8;
     complete_packet[1] = regaddr & 0xFF;
 
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), complete_packet, length + 2, 0, 0, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    i2c_async_request_t request = {.address = devaddr, .tx_data = complete_packet, .tx_length = length + 2, .timeout = timeout};
+    return i2c_submit(&request);
 }
 
 i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    i2c_async_request_t request = {.address = devaddr, .tx_data = &regaddr, .tx_length = 1, .rx_data = data, .rx_length = length, .timeout = timeout};
+    return i2c_submit(&request);
 }
 
 i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
-    i2cStart(&I2C_DRIVER, &i2cconfig);
-    uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
-    msg_t   status             = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
-    return i2c_epilogue(status);
+    uint8_t             register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
+    i2c_async_request_t request            = {.address = devaddr, .tx_data = register_packet, .tx_length = 2, .rx_data = data, .rx_length = length, .timeout = timeout};
+    return i2c_submit(&request);
 }
 
 __attribute__((weak)) i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout) {
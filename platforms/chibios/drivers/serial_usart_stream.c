@@ -0,0 +1,422 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+ * Full-duplex split transport that streams frames in both directions at once, instead of running one transaction at a
+ * time. The USART is driven by DMA: received bytes land in a circular buffer, and each frame goes out in a single
+ * transfer. A thread on either half drains the one and refills the other, and the framing, acknowledgements and
+ * retransmissions are left to split_stream.c.
+ *
+ * Transactions without a slave callback don't wait for the other half at all: data for the slave is queued, and data
+ * from the slave is already in shared memory, pushed by the slave as soon as it changed. Transactions with a callback
+ * wait until everything queued before them was acknowledged, and then for the slave's response, as the callback may
+ * depend on earlier data and the caller may depend on its result.
+ */
+
+#include <ch.h>
+#include <hal.h>
+#include <string.h>
+
+#include "serial.h"
+#include "serial_usart.h"
+#include "split_stream.h"
+#include "synchronization_util.h"
+#include "transport.h"
+#include "timer.h"
+
+#if !defined(MCU_STM32) || !HAL_USE_SERIAL
+#    error The usart_stream split transport requires an STM32 MCU with the SERIAL driver enabled.
+#endif
+
+#if !defined(SERIAL_USART_FULL_DUPLEX)
+#    error The usart_stream split transport requires SERIAL_USART_FULL_DUPLEX, with separate TX and RX lines.
+#endif
+
+#if !defined(SERIAL_USART_TX_DMA_STREAM) || !defined(SERIAL_USART_RX_DMA_STREAM)
+#    error "please consult your MCU's datasheet and specify in your config.h: #define SERIAL_USART_TX_DMA_STREAM and SERIAL_USART_RX_DMA_STREAM, e.g. STM32_DMA1_STREAM4"
+#endif
+#ifndef SERIAL_USART_TX_DMA_CHANNEL
+#    define SERIAL_USART_TX_DMA_CHANNEL 0
+#endif
+#ifndef SERIAL_USART_RX_DMA_CHANNEL
+#    define SERIAL_USART_RX_DMA_CHANNEL 0
+#endif
+#if (STM32_DMA_SUPPORTS_DMAMUX == TRUE) && (!defined(SERIAL_USART_TX_DMAMUX_ID) || !defined(SERIAL_USART_RX_DMAMUX_ID))
+#    error "please consult your MCU's datasheet and specify in your config.h: #define SERIAL_USART_TX_DMAMUX_ID STM32_DMAMUX1_USART?_TX and SERIAL_USART_RX_DMAMUX_ID STM32_DMAMUX1_USART?_RX"
+#endif
+
+// Received bytes the thread may fall behind by, before they are overwritten
+#ifndef SERIAL_USART_STREAM_RX_BUFFER_SIZE
+#    define SERIAL_USART_STREAM_RX_BUFFER_SIZE 256
+#endif
+
+// Interval of frames that only keep the link alive, when there is nothing else to send
+#ifndef SERIAL_USART_STREAM_KEEPALIVE
+#    define SERIAL_USART_STREAM_KEEPALIVE 2
+#endif
+
+#if SERIAL_USART_STREAM_KEEPALIVE >= SPLIT_STREAM_TIMEOUT
+#    error "SERIAL_USART_STREAM_KEEPALIVE must be shorter than SPLIT_STREAM_TIMEOUT"
+#endif
+
+_Static_assert(NUM_TOTAL_TRANSACTIONS <= SPLIT_STREAM_MAX_CHANNELS, "Too many split transactions for the usart_stream transport");
+_Static_assert(RPC_M2S_BUFFER_SIZE + SPLIT_STREAM_RECORD_HEADER_SIZE <= SPLIT_STREAM_MAX_PAYLOAD, "RPC_M2S_BUFFER_SIZE too large for SPLIT_STREAM_MAX_PAYLOAD");
+_Static_assert(RPC_S2M_BUFFER_SIZE + SPLIT_STREAM_RECORD_HEADER_SIZE <= SPLIT_STREAM_MAX_PAYLOAD, "RPC_S2M_BUFFER_SIZE too large for SPLIT_STREAM_MAX_PAYLOAD");
+
+#if defined(USART_RDR_RDR)
+#    define USART_RX_REGISTER(usart) (&(usart)->RDR)
+#    define USART_TX_REGISTER(usart) (&(usart)->TDR)
+#else
+#    define USART_RX_REGISTER(usart) (&(usart)->DR)
+#    define USART_TX_REGISTER(usart) (&(usart)->DR)
+#endif
+
+/* USARTs with FIFOs name the interrupt enables after both of their meanings. */
+#if !defined(USART_CR1_RXNEIE) && defined(USART_CR1_RXNEIE_RXFNEIE)
+#    define USART_CR1_RXNEIE USART_CR1_RXNEIE_RXFNEIE
+#endif
+#if !defined(USART_CR1_TXEIE) && defined(USART_CR1_TXEIE_TXFNFIE)
+#    define USART_CR1_TXEIE USART_CR1_TXEIE_TXFNFIE
+#endif
+
+#define CHANNEL_BIT(id) ((split_stream_mask_t)1 << (id))
+
+#if defined(SERIAL_USART_CONFIG)
+static QMKSerialConfig serial_config = SERIAL_USART_CONFIG;
+#else
+static QMKSerialConfig serial_config = {
+    .speed = (SERIAL_USART_SPEED),
+    .cr1   = (SERIAL_USART_CR1),
+    .cr2   = (SERIAL_USART_CR2),
+    .cr3   = (SERIAL_USART_CR3),
+};
+#endif
+
+static QMKSerialDriver* serial_driver = (QMKSerialDriver*)&SERIAL_USART_DRIVER;
+
+static split_stream_t stream;
+static bool           is_initiator = false;
+
+// Channels the slave answered since the master last queued them
+static split_stream_mask_t responses = 0;
+// Signalled whenever frames arrive, for transactions waiting on acknowledgements or responses
+static BSEMAPHORE_DECL(progress, true);
+
+// Target to initiator contents as last sent, to find the ones that changed since
+static split_shared_memory_t sent_shmem;
+
+static uint8_t rx_buffer[SERIAL_USART_STREAM_RX_BUFFER_SIZE];
+static size_t  rx_position = 0;
+static uint8_t tx_frame[SPLIT_STREAM_MAX_FRAME_SIZE];
+
+/**
+ * @brief Initiate pins for USART peripheral. Full-duplex configuration.
+ */
+__attribute__((weak)) void usart_init(void) {
+#if defined(USE_GPIOV1)
+    palSetLineMode(SERIAL_USART_TX_PIN, PAL_MODE_ALTERNATE_PUSHPULL);
+    palSetLineMode(SERIAL_USART_RX_PIN, PAL_MODE_INPUT);
+#else
+    palSetLineMode(SERIAL_USART_TX_PIN, PAL_MODE_ALTERNATE(SERIAL_USART_TX_PAL_MODE) | PAL_OUTPUT_TYPE_PUSHPULL | PAL_OUTPUT_SPEED_HIGHEST);
+    palSetLineMode(SERIAL_USART_RX_PIN, PAL_MODE_ALTERNATE(SERIAL_USART_RX_PAL_MODE) | PAL_OUTPUT_TYPE_PUSHPULL | PAL_OUTPUT_SPEED_HIGHEST);
+#endif
+
+#if defined(USART_REMAP)
+    USART_REMAP;
+#endif
+}
+
+/**
+ * @brief Overridable master specific initializations.
+ */
+__attribute__((weak, nonnull)) void usart_master_init(QMKSerialDriver** driver) {
+    (void)driver;
+    usart_init();
+}
+
+/**
+ * @brief Overridable slave specific initializations.
+ */
+__attribute__((weak, nonnull)) void usart_slave_init(QMKSerialDriver** driver) {
+    (void)driver;
+    usart_init();
+}
+
+static uint8_t initiator_size(uint8_t id) {
+    return split_transaction_table[id].initiator2target_buffer_size;
+}
+
+static void initiator_read(uint8_t id, uint8_t* data) {
+    split_transaction_desc_t* transaction = &split_transaction_table[id];
+    memcpy(data, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size);
+}
+
+static void initiator_write(uint8_t id, const uint8_t* data, uint8_t length) {
+    split_transaction_desc_t* transaction = &split_transaction_table[id];
+    if (length == transaction->target2initiator_buffer_size) {
+        memcpy(split_trans_target2initiator_buffer(transaction), data, length);
+        responses |= CHANNEL_BIT(id);
+    }
+}
+
+static uint8_t target_size(uint8_t id) {
+    return split_transaction_table[id].target2initiator_buffer_size;
+}
+
+static void target_read(uint8_t id, uint8_t* data) {
+    split_transaction_desc_t* transaction = &split_transaction_table[id];
+    memcpy(data, split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size);
+    memcpy(((uint8_t*)&sent_shmem) + transaction->target2initiator_offset, data, transaction->target2initiator_buffer_size);
+}
+
+static void target_write(uint8_t id, const uint8_t* data, uint8_t length) {
+    split_transaction_desc_t* transaction = &split_transaction_table[id];
+    if (length != transaction->initiator2target_buffer_size) {
+        return;
+    }
+    memcpy(split_trans_initiator2target_buffer(transaction), data, length);
+
+    /* Allow any slave processing to occur, and answer it. */
+    if (transaction->slave_callback) {
+        transaction->slave_callback(transaction->initiator2target_buffer_size, split_trans_initiator2target_buffer(transaction), transaction->target2initiator_buffer_size, split_trans_target2initiator_buffer(transaction));
+        split_stream_mark_dirty(&stream, id);
+    }
+}
+
+static const split_stream_callbacks_t initiator_callbacks = {initiator_size, initiator_read, initiator_write};
+static const split_stream_callbacks_t target_callbacks    = {target_size, target_read, target_write};
+
+/**
+ * @brief Queues the target to initiator buffers the slave changed since they were last sent. This runs right before
+ * each frame is built, so buffers changed by a slave callback travel in the same frame as its response.
+ */
+static void queue_target_changes(void) {
+    for (uint8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        split_transaction_desc_t* transaction = &split_transaction_table[id];
+        /* Responses to callbacks are only sent once the callback ran. */
+        if (transaction->slave_callback || transaction->target2initiator_buffer_size == 0) {
+            continue;
+        }
+        if (memcmp(split_trans_target2initiator_buffer(transaction), ((uint8_t*)&sent_shmem) + transaction->target2initiator_offset, transaction->target2initiator_buffer_size) != 0) {
+            split_stream_mark_dirty(&stream, id);
+        }
+    }
+}
+
+static void stream_receive(void) {
+    size_t   end    = sizeof(rx_buffer) - dmaStreamGetTransactionSize(SERIAL_USART_RX_DMA_STREAM);
+    uint32_t frames = stream.stats.frames_received;
+    if (end == sizeof(rx_buffer)) {
+        end = 0;
+    }
+    if (end == rx_position) {
+        return;
+    }
+
+    split_shared_memory_lock();
+    if (end < rx_position) {
+        split_stream_receive(&stream, &rx_buffer[rx_position], sizeof(rx_buffer) - rx_position);
+        rx_position = 0;
+    }
+    split_stream_receive(&stream, &rx_buffer[rx_position], end - rx_position);
+    rx_position = end;
+    split_shared_memory_unlock();
+
+    if (stream.stats.frames_received != frames) {
+        chBSemSignal(&progress);
+    }
+}
+
+static void stream_send(uint16_t length) {
+    dmaStreamDisable(SERIAL_USART_TX_DMA_STREAM);
+    dmaStreamSetMemory0(SERIAL_USART_TX_DMA_STREAM, tx_frame);
+    dmaStreamSetTransactionSize(SERIAL_USART_TX_DMA_STREAM, length);
+    dmaStreamSetMode(SERIAL_USART_TX_DMA_STREAM, STM32_DMA_CR_CHSEL(SERIAL_USART_TX_DMA_CHANNEL) | STM32_DMA_CR_DIR_M2P | STM32_DMA_CR_PSIZE_BYTE | STM32_DMA_CR_MSIZE_BYTE | STM32_DMA_CR_MINC | STM32_DMA_CR_PL(3));
+    dmaStreamEnable(SERIAL_USART_TX_DMA_STREAM);
+}
+
+/**
+ * @brief This thread runs on both halves, receiving frames as they come in and sending the next one whenever the
+ * previous is out.
+ */
+static THD_WORKING_AREA(waStreamThread, 1024);
+static THD_FUNCTION(StreamThread, arg) {
+    (void)arg;
+    chRegSetThreadName("split_stream_tx_rx");
+
+    uint32_t last_send = timer_read32();
+    while (true) {
+        stream_receive();
+
+#if defined(USART_ICR_ORECF)
+        /* Errors don't stop the DMA, the frame checksums catch what they corrupted. */
+        serial_driver->usart->ICR = USART_ICR_ORECF | USART_ICR_FECF | USART_ICR_PECF | USART_ICR_NCF;
+#endif
+
+        /* The last frame has been handed to the USART, the next one can be built. */
+        if (dmaStreamGetTransactionSize(SERIAL_USART_TX_DMA_STREAM) == 0) {
+            uint16_t length = 0;
+
+            split_shared_memory_lock();
+            if (!is_initiator) {
+                queue_target_changes();
+            }
+            if (split_stream_ready(&stream) || timer_elapsed32(last_send) >= SERIAL_USART_STREAM_KEEPALIVE) {
+                length = split_stream_build_frame(&stream, tx_frame);
+            }
+            split_shared_memory_unlock();
+
+            if (length) {
+                stream_send(length);
+                last_send = timer_read32();
+            }
+        }
+
+        chThdSleep(1);
+    }
+}
+
+/**
+ * @brief Starts the USART, and hands its data registers over to DMA.
+ */
+static void stream_driver_start(void) {
+    sdStart(serial_driver, &serial_config);
+
+    USART_TypeDef* usart = serial_driver->usart;
+    usart->CR1 &= ~(USART_CR1_RXNEIE | USART_CR1_TXEIE | USART_CR1_TCIE | USART_CR1_PEIE);
+    usart->CR3 &= ~USART_CR3_EIE;
+    usart->CR3 |= USART_CR3_DMAR | USART_CR3_DMAT;
+
+    dmaStreamAlloc(SERIAL_USART_RX_DMA_STREAM - STM32_DMA_STREAM(0), 10, NULL, NULL);
+    dmaStreamSetPeripheral(SERIAL_USART_RX_DMA_STREAM, USART_RX_REGISTER(usart));
+    dmaStreamSetMemory0(SERIAL_USART_RX_DMA_STREAM, rx_buffer);
+    dmaStreamSetTransactionSize(SERIAL_USART_RX_DMA_STREAM, sizeof(rx_buffer));
+    dmaStreamSetMode(SERIAL_USART_RX_DMA_STREAM, STM32_DMA_CR_CHSEL(SERIAL_USART_RX_DMA_CHANNEL) | STM32_DMA_CR_DIR_P2M | STM32_DMA_CR_PSIZE_BYTE | STM32_DMA_CR_MSIZE_BYTE | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC | STM32_DMA_CR_PL(3));
+
+    dmaStreamAlloc(SERIAL_USART_TX_DMA_STREAM - STM32_DMA_STREAM(0), 10, NULL, NULL);
+    dmaStreamSetPeripheral(SERIAL_USART_TX_DMA_STREAM, USART_TX_REGISTER(usart));
+
+#if (STM32_DMA_SUPPORTS_DMAMUX == TRUE)
+    // If the MCU has a DMAMUX we need to assign the correct resource
+    dmaSetRequestSource(SERIAL_USART_RX_DMA_STREAM, SERIAL_USART_RX_DMAMUX_ID);
+    dmaSetRequestSource(SERIAL_USART_TX_DMA_STREAM, SERIAL_USART_TX_DMAMUX_ID);
+#endif
+
+    dmaStreamEnable(SERIAL_USART_RX_DMA_STREAM);
+}
+
+static void stream_start(bool initiator) {
+    const split_stream_callbacks_t* callbacks = initiator ? &initiator_callbacks : &target_callbacks;
+
+    /* Callbacks must not run again when a half restarts, and empty buffers have nothing to resend. */
+    split_stream_mask_t events = 0;
+    for (uint8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        if (split_transaction_table[id].slave_callback || callbacks->size(id) == 0) {
+            events |= CHANNEL_BIT(id);
+        }
+    }
+
+    is_initiator = initiator;
+    split_stream_init(&stream, callbacks, NUM_TOTAL_TRANSACTIONS, events);
+    stream_driver_start();
+
+    chThdCreateStatic(waStreamThread, sizeof(waStreamThread), HIGHPRIO, StreamThread, NULL);
+}
+
+/**
+ * @brief Slave specific initializations.
+ */
+void soft_serial_target_init(void) {
+    usart_slave_init(&serial_driver);
+    stream_start(false);
+}
+
+/**
+ * @brief Master specific initializations.
+ */
+void soft_serial_initiator_init(void) {
+    usart_master_init(&serial_driver);
+
+#if defined(SERIAL_USART_PIN_SWAP)
+    serial_config.cr2 |= USART_CR2_SWAP; // master has swapped TX/RX pins
+#endif
+
+    stream_start(true);
+}
+
+static bool nothing_pending(uint8_t id) {
+    (void)id;
+    for (uint8_t channel = 0; channel < NUM_TOTAL_TRANSACTIONS; channel++) {
+        if (split_stream_pending(&stream, channel)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool response_received(uint8_t id) {
+    return responses & CHANNEL_BIT(id);
+}
+
+/**
+ * @brief Waits until `condition` holds, re-checking it whenever frames arrive.
+ */
+static bool wait_for(bool (*condition)(uint8_t), uint8_t id) {
+    uint32_t start = timer_read32();
+    while (true) {
+        split_shared_memory_lock();
+        bool done = condition(id);
+        split_shared_memory_unlock();
+
+        if (done) {
+            return true;
+        }
+        if (timer_elapsed32(start) >= SERIAL_USART_TIMEOUT) {
+            return false;
+        }
+        chBSemWaitTimeout(&progress, TIME_MS2I(1));
+    }
+}
+
+/**
+ * @brief Queue a transaction for the slave half, waiting for its response only if it has a slave callback.
+ *
+ * @param index Transaction Table index of the transaction to start.
+ * @return bool Indicates success of transaction.
+ */
+bool soft_serial_transaction(int index) {
+    /* Sanity check that we are actually starting a valid transaction. */
+    if (unlikely(index < 0 || index >= NUM_TOTAL_TRANSACTIONS)) {
+        serial_dprintf("SPLIT: illegal transaction id\n");
+        return false;
+    }
+
+    split_transaction_desc_t* transaction = &split_transaction_table[index];
+
+    if (transaction->slave_callback) {
+        if (unlikely(!wait_for(nothing_pending, index))) {
+            serial_dprintf("SPLIT: earlier transactions unacknowledged\n");
+            return false;
+        }
+
+        split_shared_memory_lock();
+        responses &= ~CHANNEL_BIT(index);
+        split_stream_mark_dirty(&stream, index);
+        split_shared_memory_unlock();
+
+        if (unlikely(!wait_for(response_received, index))) {
+            serial_dprintf("SPLIT: no response from slave\n");
+            return false;
+        }
+        return true;
+    }
+
+    split_shared_memory_lock();
+    if (transaction->initiator2target_buffer_size) {
+        split_stream_mark_dirty(&stream, index);
+    }
+    bool connected = split_stream_connected(&stream);
+    split_shared_memory_unlock();
+
+    return connected;
+}
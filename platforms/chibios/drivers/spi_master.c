@@ -20,12 +20,79 @@
 
 static bool spiStarted = false;
 
+// Held from spi_start() to spi_stop(), or until the transfers queued before a deferred stop are done, so that threads
+// take turns on the bus rather than having spi_start() fail
+static BSEMAPHORE_DECL(spiBus, false);
+static thread_t *spiOwner = NULL;
+
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
 static pin_t currentSlavePin;
 #endif
 
 static SPIConfig spiConfig;
 
+// Only set while a spi_stop() waits for asynchronous transfers to finish
+static volatile bool spiStopPending = false;
+
+#ifdef SPI_ASYNC_ENABLE
+typedef struct spi_async_transfer_t {
+    const uint8_t       *data;
+    uint16_t             length;
+    spi_async_callback_t callback;
+    void                *cb_arg;
+} spi_async_transfer_t;
+
+// Asynchronous transfers waiting to go out, the one at the head is on the wire
+static spi_async_transfer_t spiAsyncQueue[SPI_ASYNC_QUEUE_SIZE];
+static volatile uint8_t     spiAsyncHead  = 0;
+static volatile uint8_t     spiAsyncCount = 0;
+
+static inline void spi_release_slave_i(void) {
+#    if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
+    if (currentSlavePin != NO_PIN) {
+        gpio_write_pin_high(currentSlavePin);
+    }
+#    endif
+    spiUnselectI(&SPI_DRIVER);
+}
+
+// Invoked from interrupt context at the end of every transfer, synchronous ones included. A transfer that failed is
+// treated as done, so that the queue keeps moving.
+static void spi_async_complete(SPIDriver *spip) {
+    if (spiAsyncCount == 0) {
+        return;
+    }
+
+    // Still counted as pending while the callback runs, so anyone polling sees its side effects once the queue drains
+    spi_async_transfer_t *done = &spiAsyncQueue[spiAsyncHead];
+    if (done->callback) {
+        done->callback(done->cb_arg);
+    }
+
+    osalSysLockFromISR();
+    spiAsyncHead = (spiAsyncHead + 1) % SPI_ASYNC_QUEUE_SIZE;
+    spiAsyncCount--;
+    if (spiAsyncCount > 0) {
+        spi_async_transfer_t *next = &spiAsyncQueue[spiAsyncHead];
+        spiStartSendI(spip, next->length, next->data);
+    } else if (spiStopPending) {
+        // spi_stop() was called with transfers in flight, let the slave and the bus go now that they are done
+        spi_release_slave_i();
+        chBSemSignalI(&spiBus);
+    }
+    osalSysUnlockFromISR();
+}
+#endif // SPI_ASYNC_ENABLE
+
+// Finishes a spi_stop() that had to wait for asynchronous transfers, once the bus has been taken again
+static void spi_complete_deferred_stop(void) {
+    if (spiStopPending) {
+        spiStop(&SPI_DRIVER);
+        spiStopPending = false;
+        spiStarted     = false;
+    }
+}
+
 __attribute__((weak)) void spi_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
@@ -64,7 +131,8 @@ __attribute__((weak)) void spi_init(void) {
 }
 
 bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
-    if (spiStarted) {
+    // Started twice by the same thread, which would otherwise wait for itself
+    if (spiStarted && !spiStopPending && spiOwner == chThdGetSelfX()) {
         return false;
     }
 #if SPI_SELECT_MODE != SPI_SELECT_MODE_NONE
@@ -82,8 +150,17 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
     if (roundedDivisor < 2 || roundedDivisor > 256) {
         return false;
     }
+#else
+    if (divisor < 1) {
+        return false;
+    }
 #endif
 
+    // Waits for whichever thread has the bus, spiConfig included
+    chBSemWait(&spiBus);
+    spi_complete_deferred_stop();
+    spiOwner = chThdGetSelfX();
+
 #if defined(K20x) || defined(KL2x)
     spiConfig.tar0 = SPIx_CTARn_FMSZ(7) | SPIx_CTARn_ASC(1);
 
@@ -162,10 +239,6 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
         osalDbgAssert(lsbFirst != FALSE, "unsupported lsbFirst");
     }
 
-    if (divisor < 1) {
-        return false;
-    }
-
     spiConfig.SPI_BaudRatePrescaler = (divisor << 2);
 
     switch (mode) {
@@ -280,6 +353,14 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
 #    error "Unsupported SPI_SELECT_MODE"
 #endif
 
+#ifdef SPI_ASYNC_ENABLE
+#    ifdef HAL_LLD_SELECT_SPI_V2
+    spiConfig.data_cb  = spi_async_complete;
+    spiConfig.error_cb = spi_async_complete;
+#    else
+    spiConfig.end_cb = spi_async_complete;
+#    endif
+#endif
     spiStart(&SPI_DRIVER, &spiConfig);
     spiSelect(&SPI_DRIVER);
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
@@ -292,6 +373,10 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
 }
 
 spi_status_t spi_write(uint8_t data) {
+#ifdef SPI_ASYNC_ENABLE
+    spi_async_wait(SPI_TIMEOUT_INFINITE);
+#endif
+
     uint8_t rxData;
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
@@ -299,6 +384,10 @@ spi_status_t spi_write(uint8_t data) {
 }
 
 spi_status_t spi_read(void) {
+#ifdef SPI_ASYNC_ENABLE
+    spi_async_wait(SPI_TIMEOUT_INFINITE);
+#endif
+
     uint8_t data = 0;
     spiReceive(&SPI_DRIVER, 1, &data);
 
@@ -306,17 +395,76 @@ spi_status_t spi_read(void) {
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+#ifdef SPI_ASYNC_ENABLE
+    spi_async_wait(SPI_TIMEOUT_INFINITE);
+#endif
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+#ifdef SPI_ASYNC_ENABLE
+    spi_async_wait(SPI_TIMEOUT_INFINITE);
+#endif
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+#ifdef SPI_ASYNC_ENABLE
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length, spi_async_callback_t callback, void *cb_arg) {
+    if (!spiStarted || spiStopPending || length == 0) {
+        return SPI_STATUS_ERROR;
+    }
+
+    // Wait for a free slot in the queue
+    uint16_t timeout_timer = timer_read();
+    while (spiAsyncCount >= SPI_ASYNC_QUEUE_SIZE) {
+        if (timer_elapsed(timeout_timer) >= SPI_ASYNC_TIMEOUT) {
+            return SPI_STATUS_TIMEOUT;
+        }
+    }
+
+    osalSysLock();
+    spi_async_transfer_t *transfer = &spiAsyncQueue[(spiAsyncHead + spiAsyncCount) % SPI_ASYNC_QUEUE_SIZE];
+    transfer->data                 = data;
+    transfer->length               = length;
+    transfer->callback             = callback;
+    transfer->cb_arg               = cb_arg;
+    if (spiAsyncCount++ == 0) {
+        spiStartSendI(&SPI_DRIVER, length, data);
+    }
+    osalSysUnlock();
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_async_busy(void) {
+    return spiAsyncCount > 0;
+}
+
+spi_status_t spi_async_wait(uint16_t timeout) {
+    uint16_t timeout_timer = timer_read();
+    while (spiAsyncCount > 0) {
+        if ((timeout != SPI_TIMEOUT_INFINITE) && (timer_elapsed(timeout_timer) >= timeout)) {
+            return SPI_STATUS_TIMEOUT;
+        }
+    }
+    return SPI_STATUS_SUCCESS;
+}
+#endif // SPI_ASYNC_ENABLE
+
 void spi_stop(void) {
-    if (spiStarted) {
+    if (spiStarted && !spiStopPending) {
+#ifdef SPI_ASYNC_ENABLE
+        osalSysLock();
+        if (spiAsyncCount > 0) {
+            // Transfers are still in flight, the completion interrupt releases the slave and the bus once they are done
+            spiStopPending = true;
+            osalSysUnlock();
+            return;
+        }
+        osalSysUnlock();
+#endif
+
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
         if (currentSlavePin != NO_PIN) {
             gpio_write_pin_high(currentSlavePin);
@@ -325,5 +473,6 @@ void spi_stop(void) {
         spiUnselect(&SPI_DRIVER);
         spiStop(&SPI_DRIVER);
         spiStarted = false;
+        chBSemSignal(&spiBus);
     }
 }
@@ -72,6 +72,19 @@ typedef int16_t spi_status_t;
 #define SPI_TIMEOUT_IMMEDIATE (0)
 #define SPI_TIMEOUT_INFINITE (0xFFFF)
 
+#ifdef SPI_ASYNC_ENABLE
+#    ifndef SPI_ASYNC_QUEUE_SIZE
+#        define SPI_ASYNC_QUEUE_SIZE 2
+#    endif
+
+#    ifndef SPI_ASYNC_TIMEOUT
+#        define SPI_ASYNC_TIMEOUT 100
+#    endif
+
+// Invoked from interrupt context once an asynchronous transfer has been sent
+typedef void (*spi_async_callback_t)(void *cb_arg);
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -87,6 +100,19 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
 spi_status_t spi_receive(uint8_t *data, uint16_t length);
 
+#ifdef SPI_ASYNC_ENABLE
+/**
+ * Queues data to be sent in the background, waiting up to SPI_ASYNC_TIMEOUT if SPI_ASYNC_QUEUE_SIZE transfers are
+ * already queued. The data must stay untouched until the callback fires. Any synchronous operation waits for the queue
+ * to drain, and spi_stop() defers releasing the slave until it has.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length, spi_async_callback_t callback, void *cb_arg);
+
+bool spi_async_busy(void);
+
+spi_status_t spi_async_wait(uint16_t timeout);
+#endif
+
 void spi_stop(void);
 #ifdef __cplusplus
 }
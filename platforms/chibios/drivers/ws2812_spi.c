@@ -69,6 +69,15 @@
 #    define WS2812_SPI_BUFFER_MODE 0 // normal buffer
 #endif
 
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+#    if defined(WS2812_SPI_USE_CIRCULAR_BUFFER) || defined(WS2812_SPI_SYNC)
+#        error "WS2812_SPI_DOUBLE_BUFFER cannot be combined with WS2812_SPI_USE_CIRCULAR_BUFFER or WS2812_SPI_SYNC"
+#    endif
+#    define WS2812_SPI_END_CB ws2812_spi_end_cb
+#else
+#    define WS2812_SPI_END_CB NULL
+#endif
+
 #if defined(USE_GPIOV1)
 #    define WS2812_SCK_OUTPUT_MODE PAL_MODE_ALTERNATE_PUSHPULL
 #else
@@ -86,7 +95,35 @@
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+#define TXBUF_SIZE (PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE)
+
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+/*
+ * The next frame is encoded into txbuf[back_buffer] while DMA sends the other one. If the previous transfer is
+ * still running when a frame is ready, it is marked pending and the end of transfer callback swaps and starts it,
+ * so ws2812_setleds() never waits for the SPI.
+ */
+static uint8_t       txbuf[2][TXBUF_SIZE] = {0};
+static uint8_t       back_buffer          = 0;
+static volatile bool spi_busy             = false;
+static volatile bool frame_pending        = false;
+#    define WS2812_TXBUF txbuf[back_buffer]
+
+static void ws2812_spi_end_cb(SPIDriver* spip) {
+    osalSysLockFromISR();
+    if (frame_pending) {
+        frame_pending = false;
+        spiStartSendI(spip, TXBUF_SIZE, txbuf[back_buffer]);
+        back_buffer ^= 1;
+    } else {
+        spi_busy = false;
+    }
+    osalSysUnlockFromISR();
+}
+#else
+static uint8_t txbuf[TXBUF_SIZE] = {0};
+#    define WS2812_TXBUF txbuf
+#endif
 
 /*
  * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
@@ -107,7 +144,7 @@ static uint8_t get_protocol_eq(uint8_t data, int pos) {
 }
 
 static void set_led_color_rgb(rgb_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+    uint8_t* tx_start = &WS2812_TXBUF[PREAMBLE_SIZE];
 
 #if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
     for (int j = 0; j < 4; j++)
@@ -151,7 +188,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_CIRCULAR == TRUE
         WS2812_SPI_BUFFER_MODE,
 #    endif
-        NULL, // end_cb
+        WS2812_SPI_END_CB, // end_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
 #    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
@@ -170,7 +207,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_SLAVE_MODE == TRUE
         false,
 #    endif
-        NULL, // data_cb
+        WS2812_SPI_END_CB, // data_cb
         NULL, // error_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
@@ -194,13 +231,30 @@ void ws2812_setleds(rgb_led_t* ledarray, uint16_t leds) {
         s_init = true;
     }
 
+#ifdef WS2812_SPI_DOUBLE_BUFFER
+    // Take back a frame that is still waiting for the SPI, it is about to be replaced anyway
+    osalSysLock();
+    frame_pending = false;
+    osalSysUnlock();
+#endif
+
     for (uint8_t i = 0; i < leds; i++) {
         set_led_color_rgb(ledarray[i], i);
     }
 
     // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
     // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
-#ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
+#if defined(WS2812_SPI_DOUBLE_BUFFER)
+    osalSysLock();
+    if (spi_busy) {
+        frame_pending = true;
+    } else {
+        spi_busy = true;
+        spiStartSendI(&WS2812_SPI_DRIVER, TXBUF_SIZE, txbuf[back_buffer]);
+        back_buffer ^= 1;
+    }
+    osalSysUnlock();
+#elif !defined(WS2812_SPI_USE_CIRCULAR_BUFFER)
 #    ifdef WS2812_SPI_SYNC
     spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
 #    else
@@ -0,0 +1,26 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <ch.h>
+#include <hal.h>
+
+#include "matrix.h"
+
+#ifndef MATRIX_SCAN_TIMER_DRIVER
+#    error "MATRIX_SCAN_TIMER_ENABLE requires MATRIX_SCAN_TIMER_DRIVER to be set to an unused GPT driver, e.g. GPTD3"
+#endif
+
+static void matrix_scan_timer_callback(GPTDriver *gptp) {
+    (void)gptp;
+    matrix_scan_timer_tick();
+}
+
+static const GPTConfig matrix_scan_timer_config = {
+    .frequency = 1000000, // 1MHz, so the interval is in microseconds
+    .callback  = matrix_scan_timer_callback,
+};
+
+void matrix_scan_timer_start(uint16_t period_us) {
+    gptStart(&MATRIX_SCAN_TIMER_DRIVER, &matrix_scan_timer_config);
+    gptStartContinuous(&MATRIX_SCAN_TIMER_DRIVER, period_us);
+}
@@ -16,7 +16,59 @@
 
 #include "platform_deps.h"
 
+#ifdef TASK_PROFILER_ENABLE
+#    include "task_profiler.h"
+#endif
+
 void platform_setup(void) {
     halInit();
     chSysInit();
-}
\ No newline at end of file
+}
+
+#ifdef KEYBOARD_IDLE_ENABLE
+static thread_reference_t idle_thread       = NULL;
+static bool               idle_wake_pending = false;
+
+void platform_idle_wait(uint32_t timeout_ms) {
+    osalSysLock();
+    if (!idle_wake_pending) {
+        // The idle thread takes over while suspended, which executes WFI where the port supports it
+        osalThreadSuspendTimeoutS(&idle_thread, TIME_MS2I(timeout_ms));
+    }
+    idle_wake_pending = false;
+    osalSysUnlock();
+}
+
+void platform_idle_wake(void) {
+    osalSysLockFromISR();
+    idle_wake_pending = true;
+    osalThreadResumeI(&idle_thread, MSG_OK);
+    osalSysUnlockFromISR();
+}
+#endif
+
+#ifdef TASK_PROFILER_ENABLE
+#    if PORT_SUPPORTS_RT == TRUE
+// DWT CYCCNT on Cortex-M3 and up
+uint32_t task_profiler_ticks(void) {
+    return chSysGetRealtimeCounterX();
+}
+
+uint32_t task_profiler_tick_frequency(void) {
+#        if defined(STM32_SYSCLK)
+    return STM32_SYSCLK;
+#        else
+    return 0;
+#        endif
+}
+#    else
+// No cycle counter available, fall back to the system tick
+uint32_t task_profiler_ticks(void) {
+    return chVTGetSystemTimeX();
+}
+
+uint32_t task_profiler_tick_frequency(void) {
+    return CH_CFG_ST_FREQUENCY;
+}
+#    endif
+#endif
@@ -0,0 +1,27 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/* Just enough of the ChibiOS kernel for building ChibiOS drivers in unit tests,
+ * see spi_master_mock.h for what the calls do.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+    uint8_t id;
+} thread_t;
+
+typedef struct {
+    bool taken;
+} binary_semaphore_t;
+
+#define BSEMAPHORE_DECL(name, taken) binary_semaphore_t name = {taken}
+
+thread_t *chThdGetSelfX(void);
+void      chThdSleepMilliseconds(uint32_t ms);
+
+void chBSemWait(binary_semaphore_t *bsp);
+void chBSemSignal(binary_semaphore_t *bsp);
+void chBSemSignalI(binary_semaphore_t *bsp);
@@ -0,0 +1,22 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+// Pins are plain numbers, only their direction and level are kept
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef uint8_t pin_t;
+
+#define NO_PIN (pin_t)(~0)
+
+#define B13 13
+#define B14 14
+#define B15 15
+
+void gpio_set_pin_input(pin_t pin);
+void gpio_set_pin_output(pin_t pin);
+void gpio_write_pin_high(pin_t pin);
+void gpio_write_pin_low(pin_t pin);
+bool gpio_read_pin(pin_t pin);
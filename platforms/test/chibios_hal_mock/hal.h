@@ -0,0 +1,65 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/* Just enough of the ChibiOS HAL for building ChibiOS drivers in unit tests,
+ * see spi_master_mock.h for what the calls do. Shadows the empty hal.h of the
+ * test platform for tests that put this directory first.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define FALSE false
+
+#define osalDbgAssert(c, remark) ((void)(c))
+
+void osalSysLock(void);
+void osalSysUnlock(void);
+void osalSysLockFromISR(void);
+void osalSysUnlockFromISR(void);
+
+#define PAL_PORT(line) 0
+#define PAL_PAD(line) (line)
+#define PAL_MODE_ALTERNATE(n) (n)
+#define PAL_OUTPUT_TYPE_PUSHPULL 0
+#define PAL_OUTPUT_SPEED_HIGHEST 0
+#define palSetPadMode(port, pad, mode) ((void)(port), (void)(pad), (void)(mode))
+
+#define SPI_SELECT_MODE_NONE 0
+#define SPI_SELECT_MODE_PAD 1
+#define SPI_SELECT_MODE SPI_SELECT_MODE_PAD
+
+#define SPI_CR1_CPHA (1 << 0)
+#define SPI_CR1_CPOL (1 << 1)
+#define SPI_CR1_BR_0 (1 << 3)
+#define SPI_CR1_BR_1 (1 << 4)
+#define SPI_CR1_BR_2 (1 << 5)
+#define SPI_CR1_LSBFIRST (1 << 7)
+
+typedef struct SPIDriver SPIDriver;
+typedef void (*spicallback_t)(SPIDriver *spip);
+
+typedef struct {
+    spicallback_t end_cb;
+    uint32_t      ssport;
+    uint32_t      sspad;
+    uint16_t      cr1;
+} SPIConfig;
+
+struct SPIDriver {
+    const SPIConfig *config;
+};
+
+extern SPIDriver SPID2;
+
+void spiStart(SPIDriver *spip, const SPIConfig *config);
+void spiStop(SPIDriver *spip);
+void spiSelect(SPIDriver *spip);
+void spiUnselect(SPIDriver *spip);
+void spiUnselectI(SPIDriver *spip);
+void spiExchange(SPIDriver *spip, size_t n, const void *txbuf, void *rxbuf);
+void spiSend(SPIDriver *spip, size_t n, const void *txbuf);
+void spiReceive(SPIDriver *spip, size_t n, void *rxbuf);
+void spiStartSendI(SPIDriver *spip, size_t n, const void *txbuf);
@@ -0,0 +1,144 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "i2c_async_mock.h"
+#include <string.h>
+#include "i2c_async.h"
+
+#define MOCK_DEVICE_COUNT 4
+
+typedef struct {
+    bool         present;
+    uint8_t      address;
+    uint8_t      pointer;
+    i2c_status_t failure;
+    uint8_t      registers[256];
+} mock_device_t;
+
+static mock_device_t devices[MOCK_DEVICE_COUNT];
+static uint8_t       log_addresses[I2C_ASYNC_MOCK_LOG_SIZE];
+static size_t        log_length    = 0;
+static size_t        kicks         = 0;
+static bool          locked        = false;
+static bool          blocking_done = false;
+
+static mock_device_t *find_device(uint8_t address) {
+    for (size_t i = 0; i < MOCK_DEVICE_COUNT; i++) {
+        if (devices[i].present && devices[i].address == address) {
+            return &devices[i];
+        }
+    }
+    return NULL;
+}
+
+void i2c_async_mock_reset(void) {
+    memset(devices, 0, sizeof(devices));
+    log_length = 0;
+    kicks      = 0;
+}
+
+uint8_t *i2c_async_mock_add_device(uint8_t address) {
+    for (size_t i = 0; i < MOCK_DEVICE_COUNT; i++) {
+        if (!devices[i].present) {
+            devices[i].present = true;
+            devices[i].address = address;
+            return devices[i].registers;
+        }
+    }
+    return NULL;
+}
+
+void i2c_async_mock_fail(uint8_t address, i2c_status_t status) {
+    mock_device_t *device = find_device(address);
+    if (device) {
+        device->failure = status;
+    }
+}
+
+// The first byte written sets the register pointer, further bytes are written from it and reads continue from it
+static i2c_status_t execute(const i2c_async_request_t *request) {
+    mock_device_t *device = find_device(request->address);
+    if (device == NULL) {
+        return I2C_STATUS_ERROR;
+    }
+    if (device->failure != I2C_STATUS_SUCCESS) {
+        return device->failure;
+    }
+
+    for (uint16_t i = 0; i < request->tx_length; i++) {
+        if (i == 0) {
+            device->pointer = request->tx_data[0];
+        } else {
+            device->registers[device->pointer++] = request->tx_data[i];
+        }
+    }
+    for (uint16_t i = 0; i < request->rx_length; i++) {
+        request->rx_data[i] = device->registers[device->pointer++];
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+bool i2c_async_mock_step(void) {
+    const i2c_async_request_t *request = i2c_async_next();
+    if (request == NULL) {
+        return false;
+    }
+
+    if (log_length < I2C_ASYNC_MOCK_LOG_SIZE) {
+        log_addresses[log_length++] = request->address;
+    }
+    uint32_t busy_time_us = (1 + request->tx_length + request->rx_length) * I2C_ASYNC_MOCK_BYTE_TIME_US;
+    i2c_async_complete(execute(request), busy_time_us);
+    return true;
+}
+
+size_t i2c_async_mock_run(void) {
+    size_t count = 0;
+    while (i2c_async_mock_step()) {
+        count++;
+    }
+    return count;
+}
+
+size_t i2c_async_mock_log_length(void) {
+    return log_length;
+}
+
+const uint8_t *i2c_async_mock_log(void) {
+    return log_addresses;
+}
+
+size_t i2c_async_mock_kicks(void) {
+    return kicks;
+}
+
+bool i2c_async_mock_locked(void) {
+    return locked;
+}
+
+void i2c_async_backend_kick(void) {
+    kicks++;
+}
+
+void i2c_async_backend_yield(void) {
+    i2c_async_mock_step();
+}
+
+void i2c_async_backend_lock(void) {
+    locked = true;
+}
+
+void i2c_async_backend_unlock(void) {
+    locked = false;
+}
+
+// Runs the bus until the blocking transaction is done, which is always next
+void i2c_async_backend_wait_blocking(void) {
+    while (!blocking_done && i2c_async_mock_step()) {
+    }
+    blocking_done = false;
+}
+
+void i2c_async_backend_signal_blocking(void) {
+    blocking_done = true;
+}
@@ -0,0 +1,45 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/* Backend for the I2C transaction queue that executes against simulated
+ * register-file devices instead of a bus. Nothing happens on a kick, the
+ * queue only advances through i2c_async_mock_step(), or while a caller waits
+ * in i2c_async_backend_yield() or i2c_async_backend_wait_blocking(), so tests
+ * control exactly when the "bus" runs.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "i2c_master.h"
+
+// Simulated bus time per byte, including the address byte, at 400kHz
+#define I2C_ASYNC_MOCK_BYTE_TIME_US 25
+
+#define I2C_ASYNC_MOCK_LOG_SIZE 64
+
+// Forgets every device, failure and logged transaction
+void i2c_async_mock_reset(void);
+
+// Adds a device with 256 zeroed registers at `address`, returning its registers
+uint8_t *i2c_async_mock_add_device(uint8_t address);
+
+// Fails every transaction to `address` with `status`, or stops failing with I2C_STATUS_SUCCESS
+void i2c_async_mock_fail(uint8_t address, i2c_status_t status);
+
+// Executes the next queued transaction, returning false if there was none
+bool i2c_async_mock_step(void);
+
+// Executes queued transactions until there are none left, returning how many were executed
+size_t i2c_async_mock_run(void);
+
+// Addresses of the transactions executed since the last reset, in order
+size_t         i2c_async_mock_log_length(void);
+const uint8_t *i2c_async_mock_log(void);
+
+// Times the backend was told that a transaction had been queued
+size_t i2c_async_mock_kicks(void);
+
+// Whether a blocking transaction holds the backend lock
+bool i2c_async_mock_locked(void);
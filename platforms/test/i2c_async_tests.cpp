@@ -0,0 +1,348 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "i2c_master.h"
+#include "i2c_async_mock.h"
+#include "timer.h"
+void simulate_async_tick(uint32_t t);
+}
+
+namespace {
+
+constexpr uint8_t  DEVICE_A = 0x20 << 1;
+constexpr uint8_t  DEVICE_B = 0x21 << 1;
+constexpr uint8_t  DEVICE_C = 0x22 << 1;
+constexpr uint16_t TIMEOUT  = 100;
+
+struct Completion {
+    i2c_status_t status;
+    int          id;
+};
+
+std::vector<Completion> completions;
+
+void record_completion(i2c_status_t status, void *cb_arg) {
+    completions.push_back({status, (int)(intptr_t)cb_arg});
+}
+
+void *id(int value) {
+    return (void *)(intptr_t)value;
+}
+
+} // namespace
+
+class I2CAsync : public testing::Test {
+   public:
+    uint8_t *registers_a;
+    uint8_t *registers_b;
+
+    void SetUp() override {
+        timer_clear();
+        i2c_async_mock_reset();
+        registers_a = i2c_async_mock_add_device(DEVICE_A);
+        registers_b = i2c_async_mock_add_device(DEVICE_B);
+        i2c_async_mock_add_device(DEVICE_C);
+        for (int i = 0; i < 256; i++) {
+            registers_a[i] = i;
+            registers_b[i] = 255 - i;
+        }
+        i2c_async_reset_stats();
+        completions.clear();
+    }
+
+    void TearDown() override {
+        // Leave an empty queue for the next test
+        i2c_async_mock_run();
+        i2c_async_task();
+    }
+
+    std::vector<uint8_t> executed(void) {
+        return std::vector<uint8_t>(i2c_async_mock_log(), i2c_async_mock_log() + i2c_async_mock_log_length());
+    }
+
+    std::vector<int> completed_ids(void) {
+        std::vector<int> ids;
+        for (const Completion &completion : completions) {
+            ids.push_back(completion.id);
+        }
+        return ids;
+    }
+};
+
+TEST_F(I2CAsync, CallbacksOnlyFromTask) {
+    uint8_t data[3] = {0};
+    EXPECT_EQ(i2c_read_register_async(DEVICE_A, 0x10, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(1)), I2C_STATUS_SUCCESS);
+    EXPECT_EQ(i2c_async_mock_kicks(), 1u);
+    EXPECT_TRUE(i2c_async_busy());
+
+    EXPECT_EQ(i2c_async_mock_run(), 1u);
+    EXPECT_TRUE(completions.empty());
+    // Still waiting for its callback
+    EXPECT_TRUE(i2c_async_busy());
+
+    i2c_async_task();
+    ASSERT_EQ(completions.size(), 1u);
+    EXPECT_EQ(completions[0].status, I2C_STATUS_SUCCESS);
+    EXPECT_EQ(completions[0].id, 1);
+    EXPECT_EQ(data[0], 0x10);
+    EXPECT_EQ(data[1], 0x11);
+    EXPECT_EQ(data[2], 0x12);
+    EXPECT_FALSE(i2c_async_busy());
+}
+
+TEST_F(I2CAsync, HigherPriorityRunsFirst) {
+    static const uint8_t payload[2] = {0x00, 0xAA};
+    i2c_transmit_async(DEVICE_A, payload, sizeof(payload), TIMEOUT, I2C_ASYNC_PRIORITY_LOW, record_completion, id(1));
+    i2c_transmit_async(DEVICE_B, payload, sizeof(payload), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(2));
+    i2c_transmit_async(DEVICE_C, payload, sizeof(payload), TIMEOUT, I2C_ASYNC_PRIORITY_HIGH, record_completion, id(3));
+
+    i2c_async_mock_run();
+    EXPECT_EQ(executed(), (std::vector<uint8_t>{DEVICE_C, DEVICE_B, DEVICE_A}));
+
+    i2c_async_task();
+    EXPECT_EQ(completed_ids(), (std::vector<int>{3, 2, 1}));
+
+    i2c_async_stats_t stats;
+    i2c_async_get_stats(&stats);
+    EXPECT_EQ(stats.preemptions, 2u);
+}
+
+TEST_F(I2CAsync, OldestFirstWithinPriority) {
+    static const uint8_t payload[1] = {0x00};
+    i2c_transmit_async(DEVICE_B, payload, sizeof(payload), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(1));
+    i2c_transmit_async(DEVICE_A, payload, sizeof(payload), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(2));
+    i2c_async_mock_step();
+    // Queued behind the one already waiting, despite the free slot in front of it
+    i2c_transmit_async(DEVICE_C, payload, sizeof(payload), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(3));
+    i2c_async_mock_run();
+
+    EXPECT_EQ(executed(), (std::vector<uint8_t>{DEVICE_B, DEVICE_A, DEVICE_C}));
+    i2c_async_task();
+    EXPECT_EQ(completed_ids(), (std::vector<int>{1, 2, 3}));
+
+    i2c_async_stats_t stats;
+    i2c_async_get_stats(&stats);
+    EXPECT_EQ(stats.preemptions, 0u);
+}
+
+TEST_F(I2CAsync, PreemptionOnlyAtTransactionBoundary) {
+    static const uint8_t payload[1] = {0x00};
+    i2c_transmit_async(DEVICE_A, payload, sizeof(payload), TIMEOUT, I2C_ASYNC_PRIORITY_LOW, record_completion, id(1));
+    i2c_transmit_async(DEVICE_B, payload, sizeof(payload), TIMEOUT, I2C_ASYNC_PRIORITY_LOW, record_completion, id(2));
+
+    // The backend has started on A when the urgent read arrives
+    ASSERT_NE(i2c_async_next(), nullptr);
+    EXPECT_EQ(i2c_async_next(), nullptr);
+    uint8_t data[1];
+    i2c_receive_async(DEVICE_C, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_HIGH, record_completion, id(3));
+    i2c_async_complete(I2C_STATUS_SUCCESS, 50);
+
+    i2c_async_mock_run();
+    EXPECT_EQ(executed(), (std::vector<uint8_t>{DEVICE_C, DEVICE_B}));
+    i2c_async_task();
+    EXPECT_EQ(completed_ids(), (std::vector<int>{1, 3, 2}));
+}
+
+TEST_F(I2CAsync, Errors) {
+    uint8_t data[2];
+    i2c_async_mock_fail(DEVICE_B, I2C_STATUS_TIMEOUT);
+    i2c_receive_async(DEVICE_A, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(1));
+    i2c_receive_async(DEVICE_B, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(2));
+    i2c_receive_async(0x50 << 1, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(3));
+    EXPECT_EQ(i2c_transmit_async(DEVICE_A, data, 0, TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(4)), I2C_STATUS_ERROR);
+    EXPECT_EQ(i2c_read_register_async(DEVICE_A, 0, data, 0, TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(5)), I2C_STATUS_ERROR);
+
+    EXPECT_EQ(i2c_async_wait(I2C_TIMEOUT_INFINITE), I2C_STATUS_SUCCESS);
+    ASSERT_EQ(completions.size(), 3u);
+    EXPECT_EQ(completions[0].status, I2C_STATUS_SUCCESS);
+    EXPECT_EQ(completions[1].status, I2C_STATUS_TIMEOUT);
+    EXPECT_EQ(completions[2].status, I2C_STATUS_ERROR);
+
+    i2c_async_stats_t stats;
+    i2c_async_get_stats(&stats);
+    EXPECT_EQ(stats.transactions, 3u);
+    EXPECT_EQ(stats.errors, 2u);
+    EXPECT_EQ(stats.bytes, 2u);
+}
+
+TEST_F(I2CAsync, Stats) {
+    uint8_t       data[4];
+    const uint8_t payload[3] = {0x40, 1, 2};
+    i2c_transmit_async(DEVICE_A, payload, sizeof(payload), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, NULL, NULL);
+    i2c_read_register_async(DEVICE_A, 0x40, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, NULL, NULL);
+    i2c_read_register16_async(DEVICE_B, 0x0102, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, NULL, NULL);
+
+    i2c_async_stats_t stats;
+    i2c_async_get_stats(&stats);
+    EXPECT_EQ(stats.queue_depth, 3u);
+    EXPECT_EQ(stats.max_queue_depth, 3u);
+
+    i2c_async_wait(I2C_TIMEOUT_INFINITE);
+    EXPECT_EQ(data[0], 255 - 2);
+
+    i2c_async_get_stats(&stats);
+    EXPECT_EQ(stats.transactions, 3u);
+    EXPECT_EQ(stats.errors, 0u);
+    EXPECT_EQ(stats.bytes, 3u + (1 + 4) + (2 + 4));
+    EXPECT_EQ(stats.busy_time_us, (stats.bytes + 3) * I2C_ASYNC_MOCK_BYTE_TIME_US);
+    EXPECT_EQ(stats.preemptions, 0u);
+    EXPECT_EQ(stats.queue_depth, 0u);
+    EXPECT_EQ(stats.max_queue_depth, 3u);
+
+    i2c_async_reset_stats();
+    i2c_async_get_stats(&stats);
+    EXPECT_EQ(stats.transactions, 0u);
+    EXPECT_EQ(stats.busy_time_us, 0u);
+    EXPECT_EQ(stats.max_queue_depth, 0u);
+}
+
+TEST_F(I2CAsync, RegisterAddressNeedNotOutliveCall) {
+    uint8_t data[2];
+    {
+        uint8_t regaddr = 0x30;
+        i2c_read_register_async(DEVICE_A, regaddr, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(1));
+        regaddr = 0;
+    }
+    i2c_async_wait(I2C_TIMEOUT_INFINITE);
+    EXPECT_EQ(data[0], 0x30);
+    EXPECT_EQ(data[1], 0x31);
+}
+
+TEST_F(I2CAsync, FullQueueWaitsForSlot) {
+    uint8_t data[I2C_ASYNC_QUEUE_SIZE + 1][1];
+    for (int i = 0; i < I2C_ASYNC_QUEUE_SIZE; i++) {
+        i2c_read_register_async(DEVICE_A, i, data[i], 1, TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(i));
+    }
+    EXPECT_TRUE(completions.empty());
+
+    // Runs the backend and the callbacks until a slot is free
+    i2c_read_register_async(DEVICE_A, 0x80, data[I2C_ASYNC_QUEUE_SIZE], 1, TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(I2C_ASYNC_QUEUE_SIZE));
+    EXPECT_EQ(completions.size(), 1u);
+
+    i2c_async_wait(I2C_TIMEOUT_INFINITE);
+    ASSERT_EQ(completions.size(), (size_t)I2C_ASYNC_QUEUE_SIZE + 1);
+    for (int i = 0; i <= I2C_ASYNC_QUEUE_SIZE; i++) {
+        EXPECT_EQ(completions[i].id, i);
+    }
+    EXPECT_EQ(data[I2C_ASYNC_QUEUE_SIZE][0], 0x80);
+
+    i2c_async_stats_t stats;
+    i2c_async_get_stats(&stats);
+    EXPECT_EQ(stats.max_queue_depth, I2C_ASYNC_QUEUE_SIZE);
+}
+
+TEST_F(I2CAsync, BlockingJumpsQueue) {
+    uint8_t data[2];
+    for (int i = 0; i < 3; i++) {
+        i2c_receive_async(DEVICE_A, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_HIGH, record_completion, id(i));
+    }
+
+    uint8_t             regaddr = 0x10;
+    uint8_t             value   = 0;
+    i2c_async_request_t request = {.address = DEVICE_B, .tx_data = &regaddr, .tx_length = 1, .rx_data = &value, .rx_length = 1, .timeout = TIMEOUT};
+    EXPECT_EQ(i2c_async_blocking(&request), I2C_STATUS_SUCCESS);
+    EXPECT_EQ(value, 255 - 0x10);
+
+    // Only the blocking transaction has run, and it has no callback
+    EXPECT_EQ(executed(), (std::vector<uint8_t>{DEVICE_B}));
+    EXPECT_TRUE(completions.empty());
+
+    i2c_async_mock_fail(DEVICE_B, I2C_STATUS_ERROR);
+    EXPECT_EQ(i2c_async_blocking(&request), I2C_STATUS_ERROR);
+
+    i2c_async_wait(I2C_TIMEOUT_INFINITE);
+    EXPECT_EQ(completed_ids(), (std::vector<int>{0, 1, 2}));
+}
+
+TEST_F(I2CAsync, BlockingDoesNotWaitForFullQueue) {
+    uint8_t data[I2C_ASYNC_QUEUE_SIZE][1];
+    for (int i = 0; i < I2C_ASYNC_QUEUE_SIZE; i++) {
+        i2c_read_register_async(DEVICE_A, i, data[i], 1, TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(i));
+    }
+    i2c_async_mock_run();
+
+    // Every slot is waiting for its callback, which the blocking transaction leaves to the main loop
+    uint8_t             regaddr = 0x20;
+    uint8_t             value   = 0;
+    i2c_async_request_t request = {.address = DEVICE_B, .tx_data = &regaddr, .tx_length = 1, .rx_data = &value, .rx_length = 1, .timeout = TIMEOUT};
+    EXPECT_EQ(i2c_async_blocking(&request), I2C_STATUS_SUCCESS);
+    EXPECT_EQ(value, 255 - 0x20);
+    EXPECT_TRUE(completions.empty());
+    EXPECT_FALSE(i2c_async_mock_locked());
+
+    i2c_async_task();
+    EXPECT_EQ(completions.size(), (size_t)I2C_ASYNC_QUEUE_SIZE);
+}
+
+TEST_F(I2CAsync, PriorityIsClampedBelowBlocking) {
+    static const uint8_t payload[1] = {0x00};
+    i2c_transmit_async(DEVICE_A, payload, sizeof(payload), TIMEOUT, I2C_ASYNC_PRIORITY_BLOCKING + 1, record_completion, id(1));
+
+    uint8_t             value   = 0;
+    i2c_async_request_t request = {.address = DEVICE_B, .rx_data = &value, .rx_length = 1, .timeout = TIMEOUT};
+    EXPECT_EQ(i2c_async_blocking(&request), I2C_STATUS_SUCCESS);
+    EXPECT_EQ(executed(), (std::vector<uint8_t>{DEVICE_B}));
+}
+
+TEST_F(I2CAsync, CallbackGetsErrorFromFullQueue) {
+    static uint8_t                   data[1];
+    static std::vector<i2c_status_t> results;
+    results.clear();
+
+    // The first callback frees its own slot, the others are still waiting for theirs
+    i2c_async_callback_t fill = [](i2c_status_t status, void *cb_arg) {
+        record_completion(status, cb_arg);
+        if (completions.size() == 1) {
+            results.push_back(i2c_receive_async(DEVICE_A, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, NULL, NULL));
+            results.push_back(i2c_receive_async(DEVICE_A, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, NULL, NULL));
+            results.push_back(i2c_async_wait(I2C_TIMEOUT_INFINITE));
+        }
+    };
+    i2c_receive_async(DEVICE_B, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, fill, id(0));
+    for (int i = 1; i < I2C_ASYNC_QUEUE_SIZE; i++) {
+        i2c_receive_async(DEVICE_A, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(i));
+    }
+    i2c_async_mock_run();
+    i2c_async_task();
+
+    EXPECT_EQ(results, (std::vector<i2c_status_t>{I2C_STATUS_SUCCESS, I2C_STATUS_ERROR, I2C_STATUS_ERROR}));
+    // The rest of the callbacks still ran, after the one that tried to wait
+    EXPECT_EQ(completed_ids(), (std::vector<int>{0, 1, 2, 3}));
+}
+
+TEST_F(I2CAsync, CallbackMayQueueMore) {
+    static uint8_t data[1];
+    static int     remaining;
+    remaining = 3;
+
+    i2c_async_callback_t chain = [](i2c_status_t status, void *cb_arg) {
+        record_completion(status, cb_arg);
+        if (--remaining > 0) {
+            i2c_receive_async(DEVICE_A, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, (i2c_async_callback_t)cb_arg, cb_arg);
+        }
+    };
+    i2c_receive_async(DEVICE_A, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, chain, (void *)chain);
+
+    EXPECT_EQ(i2c_async_wait(I2C_TIMEOUT_INFINITE), I2C_STATUS_SUCCESS);
+    EXPECT_EQ(completions.size(), 3u);
+    EXPECT_EQ(i2c_async_mock_log_length(), 3u);
+}
+
+TEST_F(I2CAsync, WaitTimesOut) {
+    uint8_t data[1];
+    i2c_receive_async(DEVICE_A, data, sizeof(data), TIMEOUT, I2C_ASYNC_PRIORITY_NORMAL, record_completion, id(1));
+
+    // The backend is stuck on the transaction, and the clock moves on
+    ASSERT_NE(i2c_async_next(), nullptr);
+    simulate_async_tick(1);
+    EXPECT_EQ(i2c_async_wait(10), I2C_STATUS_TIMEOUT);
+    EXPECT_TRUE(completions.empty());
+
+    i2c_async_complete(I2C_STATUS_SUCCESS, 50);
+    EXPECT_EQ(i2c_async_wait(10), I2C_STATUS_SUCCESS);
+    EXPECT_EQ(completions.size(), 1u);
+}
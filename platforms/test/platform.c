@@ -16,6 +16,45 @@
 
 #include "platform_deps.h"
 
+#ifdef KEYBOARD_IDLE_ENABLE
+#    include <stdbool.h>
+#    include "wait.h"
+#endif
+
+#ifdef TASK_PROFILER_ENABLE
+#    include <time.h>
+#    include "task_profiler.h"
+#endif
+
 void platform_setup(void) {
     // do nothing
-}
\ No newline at end of file
+}
+
+#ifdef KEYBOARD_IDLE_ENABLE
+static bool idle_wake_pending = false;
+
+void platform_idle_wait(uint32_t timeout_ms) {
+    if (!idle_wake_pending) {
+        // Simulated time just moves on to the deadline
+        wait_ms(timeout_ms);
+    }
+    idle_wake_pending = false;
+}
+
+void platform_idle_wake(void) {
+    idle_wake_pending = true;
+}
+#endif
+
+#ifdef TASK_PROFILER_ENABLE
+// Real host clock, the simulated timer does not advance while tasks run
+uint32_t task_profiler_ticks(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+
+uint32_t task_profiler_tick_frequency(void) {
+    return 1000000000UL;
+}
+#endif
@@ -23,3 +23,21 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+i2c_async_DEFS := -DI2C_ASYNC_ENABLE -DI2C_ASYNC_QUEUE_SIZE=4 -DIGNORE_ATOMIC_BLOCK
+i2c_async_INC := $(PLATFORM_PATH)/chibios/drivers/
+i2c_async_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/i2c_async_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/i2c_async_mock.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/chibios/drivers/i2c_async.c
+
+spi_master_async_DEFS := -DSPI_ASYNC_ENABLE -DSPI_ASYNC_QUEUE_SIZE=2
+spi_master_async_INC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/chibios_hal_mock/ \
+	$(PLATFORM_PATH)/chibios/drivers/
+spi_master_async_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/spi_master_async_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/spi_master_mock.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c \
+	$(PLATFORM_PATH)/chibios/drivers/spi_master.c
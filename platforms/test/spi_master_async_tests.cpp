@@ -0,0 +1,192 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "spi_master.h"
+#include "spi_master_mock.h"
+#include "timer.h"
+void simulate_async_tick(uint32_t t);
+}
+
+namespace {
+
+constexpr pin_t   SLAVE_PIN = 4;
+constexpr uint8_t MODE      = 0;
+constexpr uint8_t DIVISOR   = 8;
+
+std::vector<int> callbacks;
+
+void record_callback(void *cb_arg) {
+    // The interrupt only moves on to the next transfer after the callback
+    EXPECT_FALSE(spi_master_mock_on_wire());
+    callbacks.push_back((int)(intptr_t)cb_arg);
+}
+
+void *id(int value) {
+    return (void *)(intptr_t)value;
+}
+
+} // namespace
+
+class SpiMasterAsync : public testing::Test {
+   public:
+    const uint8_t block_a[3] = {0xA0, 0xA1, 0xA2};
+    const uint8_t block_b[2] = {0xB0, 0xB1};
+    const uint8_t block_c[1] = {0xC0};
+
+    void SetUp() override {
+        timer_clear();
+        spi_init();
+        spi_master_mock_reset();
+        callbacks.clear();
+        ASSERT_TRUE(spi_start(SLAVE_PIN, false, MODE, DIVISOR));
+    }
+
+    void TearDown() override {
+        // Leave the bus free for the next test
+        while (spi_master_mock_complete()) {
+        }
+        spi_stop();
+        EXPECT_FALSE(spi_async_busy());
+        EXPECT_FALSE(spi_master_mock_selected());
+        EXPECT_EQ(spi_master_mock_errors(), 0);
+    }
+
+    std::vector<uint8_t> sent() {
+        return std::vector<uint8_t>(spi_master_mock_sent(), spi_master_mock_sent() + spi_master_mock_sent_length());
+    }
+};
+
+TEST_F(SpiMasterAsync, QueuedTransfersAreSentInOrderFromTheInterrupt) {
+    EXPECT_EQ(spi_transmit_async(block_a, sizeof(block_a), record_callback, id(1)), SPI_STATUS_SUCCESS);
+    EXPECT_EQ(spi_transmit_async(block_b, sizeof(block_b), record_callback, id(2)), SPI_STATUS_SUCCESS);
+    EXPECT_TRUE(spi_master_mock_on_wire());
+    EXPECT_TRUE(spi_async_busy());
+    EXPECT_EQ(spi_master_mock_sent_length(), 0);
+
+    ASSERT_TRUE(spi_master_mock_complete());
+    EXPECT_EQ(callbacks, std::vector<int>({1}));
+    EXPECT_TRUE(spi_master_mock_on_wire());
+    EXPECT_EQ(spi_master_mock_started_from_isr(), 1);
+
+    ASSERT_TRUE(spi_master_mock_complete());
+    EXPECT_EQ(callbacks, std::vector<int>({1, 2}));
+    EXPECT_FALSE(spi_master_mock_on_wire());
+    EXPECT_FALSE(spi_async_busy());
+    EXPECT_EQ(sent(), std::vector<uint8_t>({0xA0, 0xA1, 0xA2, 0xB0, 0xB1}));
+}
+
+TEST_F(SpiMasterAsync, TransfersQueuedAfterTheQueueDrainedStartStraightAway) {
+    EXPECT_EQ(spi_transmit_async(block_a, sizeof(block_a), record_callback, id(1)), SPI_STATUS_SUCCESS);
+    ASSERT_TRUE(spi_master_mock_complete());
+    EXPECT_FALSE(spi_master_mock_on_wire());
+
+    EXPECT_EQ(spi_transmit_async(block_b, sizeof(block_b), record_callback, id(2)), SPI_STATUS_SUCCESS);
+    EXPECT_TRUE(spi_master_mock_on_wire());
+    EXPECT_EQ(spi_master_mock_started_from_isr(), 0);
+    ASSERT_TRUE(spi_master_mock_complete());
+    EXPECT_EQ(callbacks, std::vector<int>({1, 2}));
+}
+
+TEST_F(SpiMasterAsync, StopWithTransfersInFlightReleasesTheSlaveOnceTheyAreDone) {
+    EXPECT_EQ(spi_transmit_async(block_a, sizeof(block_a), record_callback, id(1)), SPI_STATUS_SUCCESS);
+    EXPECT_EQ(spi_transmit_async(block_b, sizeof(block_b), record_callback, id(2)), SPI_STATUS_SUCCESS);
+
+    spi_stop();
+    EXPECT_TRUE(spi_master_mock_selected());
+    EXPECT_EQ(spi_transmit_async(block_c, sizeof(block_c), record_callback, id(3)), SPI_STATUS_ERROR);
+
+    ASSERT_TRUE(spi_master_mock_complete());
+    EXPECT_TRUE(spi_master_mock_selected());
+    ASSERT_TRUE(spi_master_mock_complete());
+    EXPECT_FALSE(spi_master_mock_selected());
+    EXPECT_EQ(callbacks, std::vector<int>({1, 2}));
+
+    // The bus is free again, without waiting
+    EXPECT_FALSE(spi_async_busy());
+    EXPECT_TRUE(spi_start(SLAVE_PIN, false, MODE, DIVISOR));
+    EXPECT_TRUE(spi_master_mock_selected());
+    EXPECT_EQ(spi_master_mock_waits(), 0);
+}
+
+TEST_F(SpiMasterAsync, StartFinishesADeferredStop) {
+    EXPECT_EQ(spi_transmit_async(block_a, sizeof(block_a), record_callback, id(1)), SPI_STATUS_SUCCESS);
+    spi_stop();
+    ASSERT_TRUE(spi_master_mock_complete());
+
+    EXPECT_TRUE(spi_start(SLAVE_PIN, false, MODE, DIVISOR));
+    EXPECT_TRUE(spi_master_mock_selected());
+    EXPECT_EQ(spi_transmit_async(block_b, sizeof(block_b), record_callback, id(2)), SPI_STATUS_SUCCESS);
+}
+
+TEST_F(SpiMasterAsync, AnotherThreadWaitsForTheQueuedTransfers) {
+    EXPECT_EQ(spi_transmit_async(block_a, sizeof(block_a), record_callback, id(1)), SPI_STATUS_SUCCESS);
+    EXPECT_EQ(spi_transmit_async(block_b, sizeof(block_b), record_callback, id(2)), SPI_STATUS_SUCCESS);
+    spi_stop();
+
+    // Such as a sensor read from its own thread while a display is being drawn
+    spi_master_mock_switch_thread(1);
+    EXPECT_TRUE(spi_start(SLAVE_PIN + 1, false, MODE, DIVISOR));
+    EXPECT_EQ(spi_master_mock_waits(), 1);
+    EXPECT_EQ(callbacks, std::vector<int>({1, 2}));
+    EXPECT_TRUE(spi_master_mock_selected());
+    EXPECT_EQ(spi_transmit(block_c, sizeof(block_c)), SPI_STATUS_SUCCESS);
+    spi_stop();
+
+    spi_master_mock_switch_thread(0);
+    EXPECT_TRUE(spi_start(SLAVE_PIN, false, MODE, DIVISOR));
+    EXPECT_EQ(spi_master_mock_waits(), 1);
+    EXPECT_EQ(sent(), std::vector<uint8_t>({0xA0, 0xA1, 0xA2, 0xB0, 0xB1, 0xC0}));
+}
+
+TEST_F(SpiMasterAsync, StartedTwiceByTheSameThreadFails) {
+    EXPECT_FALSE(spi_start(SLAVE_PIN, false, MODE, DIVISOR));
+    EXPECT_EQ(spi_master_mock_waits(), 0);
+    EXPECT_TRUE(spi_master_mock_selected());
+}
+
+TEST_F(SpiMasterAsync, SynchronousTransfersGoOutAfterTheQueue) {
+    EXPECT_EQ(spi_transmit_async(block_a, sizeof(block_a), record_callback, id(1)), SPI_STATUS_SUCCESS);
+    ASSERT_TRUE(spi_master_mock_complete());
+
+    // The end of transfer interrupt also fires for synchronous transfers, with nothing queued
+    EXPECT_EQ(spi_transmit(block_b, sizeof(block_b)), SPI_STATUS_SUCCESS);
+    EXPECT_EQ(spi_write(0x55), 0);
+    EXPECT_EQ(callbacks, std::vector<int>({1}));
+    EXPECT_EQ(sent(), std::vector<uint8_t>({0xA0, 0xA1, 0xA2, 0xB0, 0xB1, 0x55}));
+}
+
+TEST_F(SpiMasterAsync, WaitTimesOutWhileATransferIsOnTheWire) {
+    EXPECT_EQ(spi_transmit_async(block_a, sizeof(block_a), record_callback, id(1)), SPI_STATUS_SUCCESS);
+    simulate_async_tick(1);
+    EXPECT_EQ(spi_async_wait(10), SPI_STATUS_TIMEOUT);
+    EXPECT_EQ(spi_async_wait(SPI_TIMEOUT_IMMEDIATE), SPI_STATUS_TIMEOUT);
+
+    ASSERT_TRUE(spi_master_mock_complete());
+    EXPECT_EQ(spi_async_wait(10), SPI_STATUS_SUCCESS);
+}
+
+TEST_F(SpiMasterAsync, FullQueueTimesOut) {
+    EXPECT_EQ(spi_transmit_async(block_a, sizeof(block_a), record_callback, id(1)), SPI_STATUS_SUCCESS);
+    EXPECT_EQ(spi_transmit_async(block_b, sizeof(block_b), record_callback, id(2)), SPI_STATUS_SUCCESS);
+    simulate_async_tick(1);
+    EXPECT_EQ(spi_transmit_async(block_c, sizeof(block_c), record_callback, id(3)), SPI_STATUS_TIMEOUT);
+
+    // The queued transfers are unaffected, and there is room again once one of them is done
+    ASSERT_TRUE(spi_master_mock_complete());
+    EXPECT_EQ(spi_transmit_async(block_c, sizeof(block_c), record_callback, id(3)), SPI_STATUS_SUCCESS);
+    while (spi_master_mock_complete()) {
+    }
+    EXPECT_EQ(callbacks, std::vector<int>({1, 2, 3}));
+}
+
+TEST_F(SpiMasterAsync, NothingIsQueuedWithoutAStartedBus) {
+    spi_stop();
+    EXPECT_EQ(spi_transmit_async(block_a, sizeof(block_a), record_callback, id(1)), SPI_STATUS_ERROR);
+    EXPECT_FALSE(spi_master_mock_on_wire());
+    ASSERT_TRUE(spi_start(SLAVE_PIN, false, MODE, DIVISOR));
+    EXPECT_EQ(spi_transmit_async(block_a, 0, record_callback, id(1)), SPI_STATUS_ERROR);
+}
@@ -0,0 +1,242 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "spi_master_mock.h"
+#include <string.h>
+// From chibios_hal_mock/, not the empty hal.h next to this file
+#include <ch.h>
+#include <hal.h>
+#include "gpio.h"
+
+SPIDriver SPID2;
+
+static bool           started  = false;
+static bool           selected = false;
+static bool           locked   = false;
+static bool           in_isr   = false;
+static const uint8_t *wire_data;
+static size_t         wire_length     = 0;
+static uint8_t        sent[SPI_MASTER_MOCK_LOG_SIZE];
+static size_t         sent_length     = 0;
+static size_t         isr_starts      = 0;
+static size_t         waits           = 0;
+static size_t         errors          = 0;
+static thread_t       threads[2]      = {{0}, {1}};
+static thread_t      *current_thread  = &threads[0];
+static bool           pin_levels[256] = {0};
+
+static void log_sent(const void *data, size_t n) {
+    for (size_t i = 0; i < n && sent_length < SPI_MASTER_MOCK_LOG_SIZE; i++) {
+        sent[sent_length++] = data ? ((const uint8_t *)data)[i] : 0xFF;
+    }
+}
+
+// A new transfer needs a started driver, a selected slave and an idle wire
+static void check_transfer(void) {
+    if (!started || !selected || wire_length > 0) {
+        errors++;
+    }
+}
+
+static void check_locked(void) {
+    if (!locked) {
+        errors++;
+    }
+}
+
+static void end_of_transfer(SPIDriver *spip) {
+    if (spip->config && spip->config->end_cb) {
+        in_isr = true;
+        spip->config->end_cb(spip);
+        in_isr = false;
+    }
+}
+
+// Synchronous transfers, as spiSend() and friends run them, including the callback at the end
+static void transfer(SPIDriver *spip, size_t n, const void *txbuf) {
+    check_transfer();
+    if (locked || in_isr) {
+        errors++;
+    }
+    log_sent(txbuf, n);
+    end_of_transfer(spip);
+}
+
+void spi_master_mock_reset(void) {
+    wire_length = 0;
+    sent_length    = 0;
+    isr_starts     = 0;
+    waits          = 0;
+    errors         = 0;
+    current_thread = &threads[0];
+}
+
+void spi_master_mock_switch_thread(uint8_t thread) {
+    current_thread = &threads[thread];
+}
+
+size_t spi_master_mock_waits(void) {
+    return waits;
+}
+
+bool spi_master_mock_complete(void) {
+    if (wire_length == 0) {
+        return false;
+    }
+    log_sent(wire_data, wire_length);
+    wire_length = 0;
+    end_of_transfer(&SPID2);
+    return true;
+}
+
+bool spi_master_mock_on_wire(void) {
+    return wire_length > 0;
+}
+
+bool spi_master_mock_started(void) {
+    return started;
+}
+
+bool spi_master_mock_selected(void) {
+    return selected;
+}
+
+size_t spi_master_mock_sent_length(void) {
+    return sent_length;
+}
+
+const uint8_t *spi_master_mock_sent(void) {
+    return sent;
+}
+
+size_t spi_master_mock_started_from_isr(void) {
+    return isr_starts;
+}
+
+size_t spi_master_mock_errors(void) {
+    return errors;
+}
+
+thread_t *chThdGetSelfX(void) {
+    return current_thread;
+}
+
+void chThdSleepMilliseconds(uint32_t ms) {}
+
+void chBSemWait(binary_semaphore_t *bsp) {
+    if (locked || in_isr) {
+        errors++;
+    }
+    if (bsp->taken) {
+        waits++;
+        while (bsp->taken && spi_master_mock_complete()) {
+        }
+        if (bsp->taken) {
+            // Nothing left that would signal it, a real thread would wait forever
+            errors++;
+        }
+    }
+    bsp->taken = true;
+}
+
+void chBSemSignal(binary_semaphore_t *bsp) {
+    if (locked || in_isr) {
+        errors++;
+    }
+    bsp->taken = false;
+}
+
+void chBSemSignalI(binary_semaphore_t *bsp) {
+    check_locked();
+    bsp->taken = false;
+}
+
+void osalSysLock(void) {
+    if (locked || in_isr) {
+        errors++;
+    }
+    locked = true;
+}
+
+void osalSysUnlock(void) {
+    check_locked();
+    locked = false;
+}
+
+void osalSysLockFromISR(void) {
+    if (locked || !in_isr) {
+        errors++;
+    }
+    locked = true;
+}
+
+void osalSysUnlockFromISR(void) {
+    check_locked();
+    locked = false;
+}
+
+void spiStart(SPIDriver *spip, const SPIConfig *config) {
+    spip->config = config;
+    started      = true;
+}
+
+void spiStop(SPIDriver *spip) {
+    if (wire_length > 0) {
+        errors++;
+    }
+    started  = false;
+    selected = false;
+}
+
+void spiSelect(SPIDriver *spip) {
+    selected = true;
+}
+
+void spiUnselect(SPIDriver *spip) {
+    selected = false;
+}
+
+void spiUnselectI(SPIDriver *spip) {
+    check_locked();
+    selected = false;
+}
+
+void spiExchange(SPIDriver *spip, size_t n, const void *txbuf, void *rxbuf) {
+    transfer(spip, n, txbuf);
+    memset(rxbuf, 0, n);
+}
+
+void spiSend(SPIDriver *spip, size_t n, const void *txbuf) {
+    transfer(spip, n, txbuf);
+}
+
+void spiReceive(SPIDriver *spip, size_t n, void *rxbuf) {
+    transfer(spip, n, NULL);
+    memset(rxbuf, 0, n);
+}
+
+void spiStartSendI(SPIDriver *spip, size_t n, const void *txbuf) {
+    check_locked();
+    check_transfer();
+    if (in_isr) {
+        isr_starts++;
+    }
+    wire_data   = txbuf;
+    wire_length = n;
+}
+
+void gpio_set_pin_input(pin_t pin) {}
+
+void gpio_set_pin_output(pin_t pin) {}
+
+void gpio_write_pin_high(pin_t pin) {
+    pin_levels[pin] = true;
+}
+
+void gpio_write_pin_low(pin_t pin) {
+    pin_levels[pin] = false;
+}
+
+bool gpio_read_pin(pin_t pin) {
+    return pin_levels[pin];
+}
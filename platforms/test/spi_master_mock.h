@@ -0,0 +1,51 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/* ChibiOS SPI driver and kernel calls for running the real ChibiOS
+ * spi_master.c against, see chibios_hal_mock/. Synchronous transfers finish
+ * straight away. An asynchronous transfer stays on the wire until
+ * spi_master_mock_complete() fires its end of transfer interrupt, so tests
+ * control exactly when the queue advances. Misuse of the driver, such as
+ * starting a transfer while another is on the wire or calling an I-class
+ * function without the system lock, is counted rather than asserted.
+ *
+ * Tests switch between simulated threads to share the bus. A thread waiting
+ * on a taken semaphore fires end of transfer interrupts until it is free, as
+ * the other side would, and counts an error if it never would be.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SPI_MASTER_MOCK_LOG_SIZE 256
+
+// Forgets every sent byte, wait and error, drops the transfer on the wire, and switches back to thread 0
+void spi_master_mock_reset(void);
+
+// Makes the following calls from another thread
+void spi_master_mock_switch_thread(uint8_t thread);
+
+// Times a thread had to wait on a semaphore since the last reset
+size_t spi_master_mock_waits(void);
+
+// Fires the end of transfer interrupt for the asynchronous transfer on the wire, returning false if there was none
+bool spi_master_mock_complete(void);
+
+// Whether an asynchronous transfer is on the wire
+bool spi_master_mock_on_wire(void);
+
+// Whether the driver is started, and the slave selected
+bool spi_master_mock_started(void);
+bool spi_master_mock_selected(void);
+
+// Bytes of the transfers finished since the last reset, in order
+size_t         spi_master_mock_sent_length(void);
+const uint8_t *spi_master_mock_sent(void);
+
+// Transfers started from the end of transfer interrupt since the last reset
+size_t spi_master_mock_started_from_isr(void);
+
+// Misuses of the driver since the last reset
+size_t spi_master_mock_errors(void);
@@ -1 +1,3 @@
 TEST_LIST += eeprom_legacy_emulated_flash_tiny eeprom_legacy_emulated_flash_large
+TEST_LIST += i2c_async
+TEST_LIST += spi_master_async
@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -316,16 +317,15 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
-/** \brief Layer switch get layer
+#ifndef NO_ACTION_LAYER
+/** \brief Resolve layer
  *
- * Gets the layer based on key info
+ * Walks the given layer stack from the top and returns the first layer whose action for the key is not transparent
  */
-uint8_t layer_switch_get_layer(keypos_t key) {
-#ifndef NO_ACTION_LAYER
+static uint8_t layer_resolve(layer_state_t layers, keypos_t key) {
     action_t action;
     action.code = ACTION_TRANSPARENT;
 
-    layer_state_t layers = layer_state | default_layer_state;
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
@@ -337,6 +337,94 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     }
     /* fall back to layer 0 */
     return 0;
+}
+#endif
+
+#ifdef LAYER_CACHE_ENABLE
+/** \brief resolved layer cache
+ *
+ * Each slot holds the resolved layer of every matrix position for one combined (layer_state | default_layer_state)
+ * value. Entries are filled in lazily, so switching to a new layer stack only costs a slot reset.
+ */
+#    define LAYER_CACHE_UNRESOLVED 0xFF
+
+typedef struct {
+    layer_state_t layers;
+    bool          in_use;
+    uint8_t       resolved[MATRIX_ROWS * MATRIX_COLS];
+} layer_cache_slot_t;
+
+static layer_cache_slot_t layer_cache[LAYER_CACHE_SLOTS];
+static uint8_t            layer_cache_current = 0;
+
+/** \brief Get layer cache slot
+ *
+ * Returns the slot for the supplied layer stack, recycling the least recently claimed slot on a miss
+ */
+static layer_cache_slot_t *layer_cache_get_slot(layer_state_t layers) {
+    layer_cache_slot_t *slot = &layer_cache[layer_cache_current];
+    if (slot->in_use && slot->layers == layers) {
+        return slot;
+    }
+
+    for (uint8_t i = 0; i < LAYER_CACHE_SLOTS; i++) {
+        if (layer_cache[i].in_use && layer_cache[i].layers == layers) {
+            layer_cache_current = i;
+            return &layer_cache[i];
+        }
+    }
+
+    layer_cache_current = (layer_cache_current + 1) % LAYER_CACHE_SLOTS;
+    slot                = &layer_cache[layer_cache_current];
+    slot->layers        = layers;
+    slot->in_use        = true;
+    memset(slot->resolved, LAYER_CACHE_UNRESOLVED, sizeof(slot->resolved));
+    return slot;
+}
+
+/** \brief Layer cache invalidate
+ *
+ * Drops every cached entry. Must be called whenever the keymap contents change.
+ */
+void layer_cache_invalidate(void) {
+    for (uint8_t i = 0; i < LAYER_CACHE_SLOTS; i++) {
+        layer_cache[i].in_use = false;
+    }
+}
+
+/** \brief Layer cache invalidate key
+ *
+ * Drops the cached entries of a single key position, in every slot
+ */
+void layer_cache_invalidate_key(keypos_t key) {
+    if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        return;
+    }
+    const uint16_t entry_number = (uint16_t)(key.row * MATRIX_COLS) + key.col;
+    for (uint8_t i = 0; i < LAYER_CACHE_SLOTS; i++) {
+        layer_cache[i].resolved[entry_number] = LAYER_CACHE_UNRESOLVED;
+    }
+}
+#endif
+
+/** \brief Layer switch get layer
+ *
+ * Gets the layer based on key info
+ */
+uint8_t layer_switch_get_layer(keypos_t key) {
+#ifndef NO_ACTION_LAYER
+    layer_state_t layers = layer_state | default_layer_state;
+#    ifdef LAYER_CACHE_ENABLE
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        layer_cache_slot_t *slot         = layer_cache_get_slot(layers);
+        const uint16_t      entry_number = (uint16_t)(key.row * MATRIX_COLS) + key.col;
+        if (slot->resolved[entry_number] == LAYER_CACHE_UNRESOLVED) {
+            slot->resolved[entry_number] = layer_resolve(layers, key);
+        }
+        return slot->resolved[entry_number];
+    }
+#    endif
+    return layer_resolve(layers, key);
 #else
     return get_highest_layer(default_layer_state);
 #endif
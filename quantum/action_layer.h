@@ -71,6 +71,19 @@ typedef uint32_t layer_state_t;
 #    error Layer Mask size not specified.  HOW?!
 #endif
 
+#if defined(LAYER_CACHE_ENABLE) && defined(NO_ACTION_LAYER)
+#    undef LAYER_CACHE_ENABLE
+#endif
+
+#ifdef LAYER_CACHE_ENABLE
+#    ifndef LAYER_CACHE_SLOTS
+#        define LAYER_CACHE_SLOTS 2
+#    endif
+#    if LAYER_CACHE_SLOTS < 1 || LAYER_CACHE_SLOTS > 255
+#        error LAYER_CACHE_SLOTS must be between 1 and 255
+#    endif
+#endif
+
 /*
  * Default Layer
  */
@@ -163,6 +176,12 @@ uint8_t read_source_layers_cache(keypos_t key);
 #endif
 action_t store_or_get_action(bool pressed, keypos_t key);
 
+#ifdef LAYER_CACHE_ENABLE
+/* drop cached layer lookups, call after changing the keymap at runtime */
+void layer_cache_invalidate(void);
+void layer_cache_invalidate_key(keypos_t key);
+#endif
+
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
@@ -109,6 +109,47 @@ RGB hsv_to_rgb_nocie(HSV hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
 
+/*
+ * Shift that selects each of r, g and b from the { v, p, q, t } word packed by hsv_to_rgb_batch(), per hue region.
+ * Region 6 is only reached by h == 255 and is the same as region 0, matching the switch in hsv_to_rgb_impl().
+ */
+static const uint8_t hsv_region_shift[7][3] PROGMEM = {
+    {0, 24, 8}, {16, 0, 8}, {8, 0, 24}, {8, 16, 0}, {24, 8, 0}, {0, 8, 16}, {0, 24, 8},
+};
+
+/** \brief Converts count HSV values, producing exactly the same output as hsv_to_rgb()
+ *
+ * Rather than switching on the hue region per value, p, q, t and v are packed into a single word and each channel
+ * is picked out of it with a table driven shift. Keeps the loop free of unpredictable branches and divisions.
+ */
+void hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t h = hsv[i].h;
+        uint16_t s = hsv[i].s;
+#ifdef USE_CIE1931_CURVE
+        uint16_t v = pgm_read_byte(&CIE1931_CURVE[hsv[i].v]);
+#else
+        uint16_t v = hsv[i].v;
+#endif
+
+        // (h * 193) >> 13 equals h * 6 / 255 for every 8 bit hue
+        uint8_t region    = (h * 193) >> 13;
+        uint8_t remainder = (h * 2 - region * 85) * 3;
+
+        uint32_t p     = (v * (255 - s)) >> 8;
+        uint32_t q     = (v * (255 - ((s * remainder) >> 8))) >> 8;
+        uint32_t t     = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+        uint32_t lanes = v | (p << 8) | (q << 16) | (t << 24);
+
+        // Zero saturation clears every shift, so all channels pick v
+        uint8_t mask = -(uint8_t)(s != 0);
+
+        rgb[i].r = lanes >> (pgm_read_byte(&hsv_region_shift[region][0]) & mask);
+        rgb[i].g = lanes >> (pgm_read_byte(&hsv_region_shift[region][1]) & mask);
+        rgb[i].b = lanes >> (pgm_read_byte(&hsv_region_shift[region][2]) & mask);
+    }
+}
+
 #ifdef RGBW
 void convert_rgb_to_rgbw(rgb_led_t *led) {
     // Determine lowest value in all three colors, put that into
@@ -46,6 +46,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "audio.h"
 #endif /* AUDIO_ENABLE */
 
+#ifdef TASK_PROFILER_ENABLE
+#    include "task_profiler.h"
+#endif
+
 static bool command_common(uint8_t code);
 static void command_common_help(void);
 static void print_version(void);
@@ -115,6 +119,9 @@ static void command_common_help(void) {
         STR(MAGIC_KEY_VERSION) ":	Version\n"
         STR(MAGIC_KEY_STATUS) ":	Status\n"
         STR(MAGIC_KEY_CONSOLE) ":	Activate Console Mode\n"
+#ifdef TASK_PROFILER_ENABLE
+        STR(MAGIC_KEY_TASK_PROFILER) ":	Print and Reset Task Profile\n"
+#endif
 
 #if MAGIC_KEY_SWITCH_LAYER_WITH_CUSTOM
         STR(MAGIC_KEY_LAYER0) ":	Switch to Layer 0\n"
@@ -438,6 +445,15 @@ static bool command_common(uint8_t code) {
             print_status();
             break;
 
+#ifdef TASK_PROFILER_ENABLE
+
+        // print task profile, then start a new measurement window
+        case MAGIC_KC(MAGIC_KEY_TASK_PROFILER):
+            task_profiler_print();
+            task_profiler_reset();
+            break;
+#endif
+
 #ifdef NKRO_ENABLE
 
         // NKRO toggle
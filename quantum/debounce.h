@@ -3,6 +3,18 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "matrix.h"
+#include "timer.h"
+
+/*
+ * The debounce algorithms take the time from here rather than timer_read_fast(). With MATRIX_SCAN_TIMER_ENABLE,
+ * matrix_scan() can catch up on several queued scans at once, and each is debounced at the time it was taken.
+ */
+#ifdef MATRIX_SCAN_TIMER_ENABLE
+#    define debounce_timer_read_fast() matrix_last_scan_time_fast()
+#else
+#    define debounce_timer_read_fast() timer_read_fast()
+#endif
+#define debounce_timer_elapsed_fast(last) TIMER_DIFF_FAST(debounce_timer_read_fast(), last)
 
 /**
  * @brief Debounce raw matrix events according to the choosen debounce algorithm.
@@ -75,7 +75,7 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
     cooked_changed    = false;
 
     if (counters_need_update) {
-        fast_timer_t now          = timer_read_fast();
+        fast_timer_t now          = debounce_timer_read_fast();
         fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
 
         last_time    = now;
@@ -91,7 +91,7 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 
     if (changed) {
         if (!updated_last) {
-            last_time = timer_read_fast();
+            last_time = debounce_timer_read_fast();
         }
 
         start_debounce_counters(raw, cooked, num_rows);
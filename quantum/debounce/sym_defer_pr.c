@@ -35,7 +35,7 @@ void debounce_init(uint8_t num_rows) {
     countdowns = (uint8_t*)calloc(num_rows, sizeof(uint8_t));
     last_raw   = (matrix_row_t*)calloc(num_rows, sizeof(matrix_row_t));
 
-    last_time = timer_read();
+    last_time = (uint16_t)debounce_timer_read_fast();
 }
 
 void debounce_free(void) {
@@ -46,7 +46,7 @@ void debounce_free(void) {
 }
 
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
-    uint16_t now           = timer_read();
+    uint16_t now           = (uint16_t)debounce_timer_read_fast();
     uint16_t elapsed16     = TIMER_DIFF_16(now, last_time);
     last_time              = now;
     uint8_t elapsed        = (elapsed16 > 255) ? 255 : elapsed16;
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/* sym_defer_pk built under different names, used as the reference for sym_defer_pk_sparse */
+#define debounce reference_debounce
+#define debounce_init reference_debounce_init
+#define debounce_free reference_debounce_free
+
+#include "../sym_defer_pk.c"
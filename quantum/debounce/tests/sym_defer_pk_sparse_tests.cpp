@@ -0,0 +1,117 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <random>
+
+#include "debounce_test_common.h"
+
+extern "C" {
+#include "debounce.h"
+
+void reference_debounce_init(uint8_t num_rows);
+bool reference_debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed);
+void reference_debounce_free(void);
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+TEST_F(DebounceTest, FarCornerKeys) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{MATRIX_ROWS - 1, MATRIX_COLS - 1, DOWN}}, {}},
+        {2, {{0, 0, DOWN}}, {}},
+
+        {5, {}, {{MATRIX_ROWS - 1, MATRIX_COLS - 1, DOWN}}},
+        {7, {}, {{0, 0, DOWN}}},
+
+        {8, {{MATRIX_ROWS - 1, MATRIX_COLS - 1, UP}, {0, 0, UP}}, {}},
+        {13, {}, {{MATRIX_ROWS - 1, MATRIX_COLS - 1, UP}, {0, 0, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, WholeRowAndColumn) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{3, 0, DOWN}, {3, 5, DOWN}, {3, 11, DOWN}, {3, 23, DOWN}, {0, 23, DOWN}, {7, 23, DOWN}}, {}},
+        /* One key in the row bounces, which only restarts that key */
+        {2, {{3, 5, UP}}, {}},
+        {3, {{3, 5, DOWN}}, {}},
+
+        {5, {}, {{3, 0, DOWN}, {3, 11, DOWN}, {3, 23, DOWN}, {0, 23, DOWN}, {7, 23, DOWN}}},
+        {8, {}, {{3, 5, DOWN}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, KeyBouncesWhileOthersSettle) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{1, 20, DOWN}}, {}},
+        {1, {{6, 2, DOWN}}, {}},
+        {2, {{1, 20, UP}}, {}},
+        {3, {{1, 20, DOWN}}, {}},
+        {4, {{1, 20, UP}}, {}},
+
+        {6, {}, {{6, 2, DOWN}}},
+        /* Back where it started, no output */
+        {20, {}, {}},
+    });
+    runEvents();
+}
+
+/*
+ * Feeds the same random bouncy input to sym_defer_pk and sym_defer_pk_sparse, at irregular scan intervals, and
+ * requires identical cooked matrices and return values after every scan.
+ */
+class DebounceSparseEquivalence : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        debounce_init(MATRIX_ROWS);
+        reference_debounce_init(MATRIX_ROWS);
+    }
+
+    void TearDown() override {
+        debounce_free();
+        reference_debounce_free();
+    }
+};
+
+TEST_F(DebounceSparseEquivalence, RandomInput) {
+    std::mt19937 rng(1234);
+
+    matrix_row_t raw[MATRIX_ROWS]       = {0};
+    matrix_row_t cooked[MATRIX_ROWS]    = {0};
+    matrix_row_t reference[MATRIX_ROWS] = {0};
+
+    set_time(7777);
+    for (int scan = 0; scan < 200000; scan++) {
+        bool changed = false;
+
+        // Mostly idle scans, with bursts of key changes and contact bounce
+        uint32_t roll = rng() % 100;
+        if (roll < 8) {
+            uint8_t flips = 1 + rng() % (roll < 2 ? 12 : 2);
+            for (uint8_t i = 0; i < flips; i++) {
+                // Most changes hit a handful of keys, so that they bounce while their counters are running
+                uint8_t key = rng() % 4 ? rng() % 6 : rng() % (MATRIX_ROWS * MATRIX_COLS);
+                raw[key % MATRIX_ROWS] ^= (matrix_row_t)1 << (key / MATRIX_ROWS);
+            }
+            changed = true;
+        }
+
+        bool cooked_changed    = debounce(raw, cooked, MATRIX_ROWS, changed);
+        bool reference_changed = reference_debounce(raw, reference, MATRIX_ROWS, changed);
+
+        ASSERT_EQ(cooked_changed, reference_changed) << "scan " << scan;
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            ASSERT_EQ(cooked[row], reference[row]) << "scan " << scan << " row " << +row;
+        }
+
+        // 0-2ms between scans, with the occasional long stall
+        advance_time(rng() % 1000 == 0 ? 300 : rng() % 3);
+    }
+}
@@ -4,154 +4,255 @@
 #include <stddef.h>
 #include <timer.h>
 #include <deferred_exec.h>
+#ifdef KEYBOARD_IDLE_ENABLE
+#    include "keyboard.h"
+#endif
 
 #ifndef MAX_DEFERRED_EXECUTORS
 #    define MAX_DEFERRED_EXECUTORS 8
 #endif
 
+#if MAX_DEFERRED_EXECUTORS > 255
+#    error "MAX_DEFERRED_EXECUTORS must be 255 or less"
+#endif
+
 //------------------------------------
 // Helpers
 //
+// The heap array of a table is a permutation of all executor slots, split into three regions:
+//   [0, pending)                               -- pending executors, as a binary min-heap ordered by trigger time
+//   [pending, pending + executed)              -- executors that already ran during the current task invocation
+//   [pending + executed, count)                -- free slots
+// Every executor knows its own position in the heap array, so insertion, cancellation and extension never search.
 
-static deferred_token current_token = 0;
+static inline void table_init(deferred_executor_table_t *table) {
+    if (!table->initialised) {
+        for (uint8_t i = 0; i < table->count; ++i) {
+            table->heap[i]                 = i;
+            table->executors[i].heap_index = i;
+        }
+        table->initialised = true;
+    }
+}
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+static inline bool trigger_before(deferred_executor_table_t *table, uint8_t a, uint8_t b) {
+    return ((int32_t)TIMER_DIFF_32(table->executors[table->heap[a]].trigger_time, table->executors[table->heap[b]].trigger_time)) < 0;
+}
+
+static inline void heap_swap(deferred_executor_table_t *table, uint8_t a, uint8_t b) {
+    uint8_t slot_a = table->heap[a];
+    uint8_t slot_b = table->heap[b];
+
+    table->heap[a]                      = slot_b;
+    table->heap[b]                      = slot_a;
+    table->executors[slot_a].heap_index = b;
+    table->executors[slot_b].heap_index = a;
+}
+
+static void heap_sift_up(deferred_executor_table_t *table, uint8_t pos) {
+    while (pos > 0) {
+        uint8_t parent = (pos - 1) / 2;
+        if (!trigger_before(table, pos, parent)) {
+            break;
+        }
+        heap_swap(table, pos, parent);
+        pos = parent;
     }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
+}
+
+static void heap_sift_down(deferred_executor_table_t *table, uint8_t pos) {
+    while (true) {
+        uint16_t child = 2 * (uint16_t)pos + 1;
+        if (child >= table->pending) {
+            break;
+        }
+        if (child + 1 < table->pending && trigger_before(table, child + 1, child)) {
+            ++child;
         }
+        if (!trigger_before(table, child, pos)) {
+            break;
+        }
+        heap_swap(table, pos, child);
+        pos = child;
     }
-    return true;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
-        ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+static inline void heap_update(deferred_executor_table_t *table, uint8_t pos) {
+    uint8_t slot = table->heap[pos];
+    heap_sift_up(table, pos);
+    heap_sift_down(table, table->executors[slot].heap_index);
+}
+
+static inline deferred_executor_t *find_executor(deferred_executor_table_t *table, deferred_token token) {
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return NULL;
+    }
+    // The low byte of a token is the slot + 1, the high byte counts how many times the slot has been used
+    uint8_t slot = (uint8_t)(token & 0xFF) - 1;
+    if (slot >= table->count) {
+        return NULL;
+    }
+    deferred_executor_t *entry = &table->executors[slot];
+    if (entry->token != token || !entry->callback) {
+        return NULL;
+    }
+    return entry;
+}
+
+// A stale token only matches again after its slot has been reused 256 times, whatever the size of the table
+static inline deferred_token next_token(deferred_executor_table_t *table, uint8_t slot) {
+    uint8_t generation = (uint8_t)(table->executors[slot].token >> 8) + 1;
+    return ((deferred_token)generation << 8) | (slot + 1);
+}
+
+static void release_executor(deferred_executor_table_t *table, deferred_executor_t *entry) {
+    uint8_t pos = entry->heap_index;
+
+    if (pos < table->pending) {
+        // Replace with the last pending executor, then move the released slot across the executed region
+        uint8_t last = table->pending - 1;
+        heap_swap(table, pos, last);
+        --table->pending;
+        if (pos < table->pending) {
+            heap_update(table, pos);
         }
+        heap_swap(table, table->pending, table->pending + table->executed);
+    } else {
+        heap_swap(table, pos, table->pending + table->executed - 1);
+        --table->executed;
     }
-    return current_token;
+
+    // Keep the token, the next allocation of this slot derives a different one from it
+    entry->trigger_time = 0;
+    entry->callback     = NULL;
+    entry->cb_arg       = NULL;
 }
 
 //------------------------------------
 // Advanced API: used when a custom-allocated table is used, primarily for core code.
 //
 
-deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_count, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
-    // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
-    if (!table || table_count == 0 || delay_ms == 0 || !callback) {
+deferred_token defer_exec_advanced(deferred_executor_table_t *table, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
+    // Ignore queueing if the table isn't valid, it's a zero-time delay, or the callback is not valid
+    if (!table || table->count == 0 || delay_ms == 0 || !callback) {
         return INVALID_DEFERRED_TOKEN;
     }
+    table_init(table);
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
-
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Claim the first free slot, none available if the table is full
+    uint8_t free_pos = table->pending + table->executed;
+    if (free_pos >= table->count) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+    if (table->executed > 0) {
+        heap_swap(table, free_pos, table->pending);
     }
+    uint8_t              slot  = table->heap[table->pending++];
+    deferred_executor_t *entry = &table->executors[slot];
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry
+    entry->token        = next_token(table, slot);
+    entry->trigger_time = timer_read32() + delay_ms;
+    entry->callback     = callback;
+    entry->cb_arg       = cb_arg;
+    heap_sift_up(table, entry->heap_index);
+    return entry->token;
 }
 
-bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
+bool extend_deferred_exec_advanced(deferred_executor_table_t *table, deferred_token token, uint32_t delay_ms) {
     // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
-    if (!table || table_count == 0 || delay_ms == 0 || token == INVALID_DEFERRED_TOKEN) {
+    if (!table || table->count == 0 || delay_ms == 0 || token == INVALID_DEFERRED_TOKEN) {
         return false;
     }
+    table_init(table);
 
-    // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    deferred_executor_t *entry = find_executor(table, token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    entry->trigger_time = timer_read32() + delay_ms;
+    if (entry->heap_index < table->pending) {
+        heap_update(table, entry->heap_index);
+    }
+    return true;
 }
 
-bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
+bool cancel_deferred_exec_advanced(deferred_executor_table_t *table, deferred_token token) {
     // Ignore request if the table/token are not valid
-    if (!table || table_count == 0 || token == INVALID_DEFERRED_TOKEN) {
+    if (!table || table->count == 0 || token == INVALID_DEFERRED_TOKEN) {
         return false;
     }
+    table_init(table);
 
-    // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    deferred_executor_t *entry = find_executor(table, token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    release_executor(table, entry);
+    return true;
+}
+
+bool deferred_exec_advanced_next_deadline(deferred_executor_table_t *table, uint32_t *trigger_time) {
+    if (!table || table->pending == 0) {
+        return false;
+    }
+    *trigger_time = table->executors[table->heap[0]].trigger_time;
+    return true;
 }
 
-void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
+void deferred_exec_advanced_task(deferred_executor_table_t *table) {
     uint32_t now = timer_read32();
 
     // Throttle only once per millisecond
-    if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
-        *last_execution_time = now;
+    if (((int32_t)TIMER_DIFF_32(now, table->last_execution_time)) > 0) {
+        table->last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        // Keep taking the earliest executor until it is in the future
+        while (table->pending > 0) {
+            uint8_t              slot       = table->heap[0];
+            deferred_executor_t *entry      = &table->executors[slot];
             deferred_token       curr_token = entry->token;
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
-
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
-
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
-                }
+            if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) > 0) {
+                break;
             }
+
+            // Move it to the executed region, so an executor that is behind schedule only runs once per invocation
+            heap_swap(table, 0, table->pending - 1);
+            --table->pending;
+            ++table->executed;
+            heap_sift_down(table, 0);
+
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+            // If the token has changed or the executor is pending again, then the callback has canceled and re-queued. Skip further processing.
+            if (entry->token != curr_token || !entry->callback || entry->heap_index < table->pending) {
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                entry->trigger_time += delay_ms;
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                release_executor(table, entry);
+            }
+        }
+
+        // Return everything that is repeating to the heap
+        while (table->executed > 0) {
+            --table->executed;
+            ++table->pending;
+            heap_sift_up(table, table->pending - 1);
         }
     }
 }
@@ -160,18 +261,41 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
 // Basic API: used by user-mode code, guaranteed to not collide with core deferred execution
 //
 
-static uint32_t            last_deferred_exec_check                = 0;
-static deferred_executor_t basic_executors[MAX_DEFERRED_EXECUTORS] = {0};
+DEFERRED_EXECUTOR_TABLE(basic_executors, MAX_DEFERRED_EXECUTORS);
 
 deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
-    return defer_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, delay_ms, callback, cb_arg);
+    deferred_token token = defer_exec_advanced(&basic_executors, delay_ms, callback, cb_arg);
+#ifdef KEYBOARD_IDLE_ENABLE
+    if (token != INVALID_DEFERRED_TOKEN) {
+        keyboard_idle_request(delay_ms);
+    }
+#endif
+    return token;
 }
 bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
-    return extend_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token, delay_ms);
+    bool extended = extend_deferred_exec_advanced(&basic_executors, token, delay_ms);
+#ifdef KEYBOARD_IDLE_ENABLE
+    if (extended) {
+        keyboard_idle_request(delay_ms);
+    }
+#endif
+    return extended;
 }
 bool cancel_deferred_exec(deferred_token token) {
-    return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
+    return cancel_deferred_exec_advanced(&basic_executors, token);
+}
+bool deferred_exec_next_deadline(uint32_t *trigger_time) {
+    return deferred_exec_advanced_next_deadline(&basic_executors, trigger_time);
 }
 void deferred_exec_task(void) {
-    deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
+    deferred_exec_advanced_task(&basic_executors);
+
+#ifdef KEYBOARD_IDLE_ENABLE
+    // Sleep no longer than the next deadline; anything overdue runs on the next millisecond because of the throttle
+    uint32_t trigger_time;
+    if (deferred_exec_next_deadline(&trigger_time)) {
+        int32_t delay = (int32_t)TIMER_DIFF_32(trigger_time, timer_read32());
+        keyboard_idle_request(delay > 0 ? delay : 1);
+    }
+#endif
 }
@@ -14,7 +14,7 @@
 /**
  * @typedef A token that can be used to cancel or extend an existing deferred execution.
  */
-typedef uint8_t deferred_token;
+typedef uint16_t deferred_token;
 
 /**
  * @def The constant used to denote an invalid deferred execution token.
@@ -60,6 +60,14 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
  */
 bool cancel_deferred_exec(deferred_token token);
 
+/**
+ * Retrieves the trigger time of the earliest pending deferred execution.
+ *
+ * @param trigger_time[out] the earliest trigger time -- equivalent time-space as timer_read32()
+ * @return true if anything is pending, otherwise false
+ */
+bool deferred_exec_next_deadline(uint32_t *trigger_time);
+
 /**
  * Forward declaration for the main loop in order to execute any deferred executors. Should not be invoked by keyboard/user code.
  */
@@ -72,50 +80,82 @@ void deferred_exec_task(void);
 /**
  * @struct Structure for containing self-hosted deferred executor tables.
  * @brief Core-side code can use this to create their own tables without impacting on the use of users' ability to add deferred execution.
- *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array.
+ *        Code outside deferred_exec.c should not worry about internals of this struct, and should declare tables with DEFERRED_EXECUTOR_TABLE().
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
+    uint8_t                heap_index;
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
 } deferred_executor_t;
 
+/**
+ * @struct A table of deferred executors, kept as a binary min-heap ordered by trigger time.
+ * @brief Tokens encode the executor slot, so lookups by token don't search the table, and how often the slot was reused. Tables hold at most 255 executors.
+ */
+typedef struct deferred_executor_table_t {
+    deferred_executor_t *executors;
+    uint8_t *            heap;
+    uint8_t              count;
+    uint8_t              pending;
+    uint8_t              executed;
+    bool                 initialised;
+    uint32_t             last_execution_time;
+} deferred_executor_table_t;
+
+/**
+ * @def Declares a static deferred executor table with storage for the given number of executors.
+ */
+#define DEFERRED_EXECUTOR_TABLE(name, table_count)                   \
+    static deferred_executor_t       name##_executors[table_count]; \
+    static uint8_t                   name##_heap[table_count];      \
+    static deferred_executor_table_t name = {.executors = name##_executors, .heap = name##_heap, .count = (table_count)}
+
 /**
  * Configures the supplied deferred executor to be executed after the required number of milliseconds.
  *
  * @param table[in] the custom table used for storage
- * @param table_count[in] the number of available items in the table
  * @param delay_ms[in] the number of milliseconds before executing the callback
  * @param callback[in] the executor to invoke
  * @param cb_arg[in] the argument to pass to the executor, may be NULL if unused by the executor
  * @return a token usable for extension/cancellation, or INVALID_DEFERRED_TOKEN if an error occurred
  */
-deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_count, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg);
+deferred_token defer_exec_advanced(deferred_executor_table_t *table, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg);
 
 /**
  * Allows for extending the timeframe before an existing deferred execution is invoked.
  *
+ * @param table[in] the custom table used for storage
  * @param token[in] the returned value from defer_exec for the deferred execution you wish to extend
  * @param delay_ms[in] the number of milliseconds before executing the callback
  * @return true if the token was extended successfully, otherwise false
  */
-bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms);
+bool extend_deferred_exec_advanced(deferred_executor_table_t *table, deferred_token token, uint32_t delay_ms);
 
 /**
  * Allows for cancellation of an existing deferred execution.
  *
+ * @param table[in] the custom table used for storage
  * @param token[in] the returned value from defer_exec for the deferred execution you wish to cancel
  * @return true if the token was cancelled successfully, otherwise false
  */
-bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token);
+bool cancel_deferred_exec_advanced(deferred_executor_table_t *table, deferred_token token);
+
+/**
+ * Retrieves the trigger time of the earliest pending deferred execution in the table.
+ *
+ * @param table[in] the custom table used for storage
+ * @param trigger_time[out] the earliest trigger time -- equivalent time-space as timer_read32()
+ * @return true if anything is pending, otherwise false
+ */
+bool deferred_exec_advanced_next_deadline(deferred_executor_table_t *table, uint32_t *trigger_time);
 
 /**
  * Forward declaration for the main loop in order to execute any custom table deferred executors. Should not be invoked by keyboard/user code.
  * Needed for any custom-allocated deferred execution tables. Any core tasks should add appropriate invocation to quantum/main.c.
+ * Execution is throttled to once per millisecond, and each executor runs at most once per invocation.
  *
  * @param table[in] the custom table used for storage
- * @param table_count[in] the number of available items in the table
- * @param last_execution_time[in,out] the last execution time -- this will be checked first to determine if execution is needed, and updated if execution occurred
  */
-void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time);
+void deferred_exec_advanced_task(deferred_executor_table_t *table);
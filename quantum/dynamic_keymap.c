@@ -14,13 +14,20 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "eeprom.h"
 #include "progmem.h"
 #include "send_string.h"
 #include "keycodes.h"
+#include "timer.h"
+#ifdef KEYBOARD_IDLE_ENABLE
+#    include "keyboard.h"
+#endif
+#include "util.h"
 
 #ifdef VIA_ENABLE
 #    include "via.h"
@@ -101,6 +108,146 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+// The mirror takes as much RAM as the keymap takes EEPROM, which AVR boards rarely have to spare
+#if !defined(DYNAMIC_KEYMAP_RAM_MIRROR) && !defined(DYNAMIC_KEYMAP_NO_RAM_MIRROR) && !defined(__AVR__)
+#    define DYNAMIC_KEYMAP_RAM_MIRROR
+#endif
+
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+#    ifndef DYNAMIC_KEYMAP_WRITEBACK_DELAY
+#        define DYNAMIC_KEYMAP_WRITEBACK_DELAY 500
+#    endif
+
+#    ifndef DYNAMIC_KEYMAP_WRITEBACK_BLOCK_SIZE
+#        define DYNAMIC_KEYMAP_WRITEBACK_BLOCK_SIZE 16
+#    endif
+
+#    define DYNAMIC_KEYMAP_KEYMAP_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+#    ifdef ENCODER_MAP_ENABLE
+#        define DYNAMIC_KEYMAP_ENCODER_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * NUM_ENCODERS * 2 * 2)
+#    else
+#        define DYNAMIC_KEYMAP_ENCODER_SIZE 0
+#    endif
+#    define DYNAMIC_KEYMAP_MIRROR_SIZE (DYNAMIC_KEYMAP_KEYMAP_SIZE + DYNAMIC_KEYMAP_ENCODER_SIZE)
+#    define DYNAMIC_KEYMAP_MIRROR_BLOCKS ((DYNAMIC_KEYMAP_MIRROR_SIZE + DYNAMIC_KEYMAP_WRITEBACK_BLOCK_SIZE - 1) / DYNAMIC_KEYMAP_WRITEBACK_BLOCK_SIZE)
+
+// RAM copy of the keymap followed by the encoder map, in the same big endian layout as EEPROM.
+// Writes land here first and are copied back to EEPROM one block at a time, once they stop arriving.
+static uint8_t  dynamic_keymap_mirror[DYNAMIC_KEYMAP_MIRROR_SIZE];
+static uint8_t  dynamic_keymap_dirty[(DYNAMIC_KEYMAP_MIRROR_BLOCKS + 7) / 8];
+static uint16_t dynamic_keymap_dirty_blocks = 0;
+static uint16_t dynamic_keymap_last_write   = 0;
+
+static void dynamic_keymap_mirror_mark_dirty(uint16_t offset, uint16_t size) {
+    for (uint16_t block = offset / DYNAMIC_KEYMAP_WRITEBACK_BLOCK_SIZE; block <= (offset + size - 1) / DYNAMIC_KEYMAP_WRITEBACK_BLOCK_SIZE; block++) {
+        if (!(dynamic_keymap_dirty[block / 8] & (1 << (block % 8)))) {
+            dynamic_keymap_dirty[block / 8] |= 1 << (block % 8);
+            dynamic_keymap_dirty_blocks++;
+        }
+    }
+    dynamic_keymap_last_write = timer_read();
+}
+
+static void dynamic_keymap_mirror_write_block(uint16_t block) {
+    uint16_t start = block * DYNAMIC_KEYMAP_WRITEBACK_BLOCK_SIZE;
+    uint16_t end   = MIN(start + DYNAMIC_KEYMAP_WRITEBACK_BLOCK_SIZE, DYNAMIC_KEYMAP_MIRROR_SIZE);
+    // The encoder map is not necessarily adjacent to the keymap in EEPROM, so blocks spanning both are split
+    if (start < DYNAMIC_KEYMAP_KEYMAP_SIZE) {
+        uint16_t keymap_end = MIN(end, DYNAMIC_KEYMAP_KEYMAP_SIZE);
+        eeprom_update_block(&dynamic_keymap_mirror[start], (uint8_t *)DYNAMIC_KEYMAP_EEPROM_ADDR + start, keymap_end - start);
+        start = keymap_end;
+    }
+    if (start < end) {
+        eeprom_update_block(&dynamic_keymap_mirror[start], (uint8_t *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR + start - DYNAMIC_KEYMAP_KEYMAP_SIZE, end - start);
+    }
+    dynamic_keymap_dirty[block / 8] &= ~(1 << (block % 8));
+    dynamic_keymap_dirty_blocks--;
+}
+
+static void dynamic_keymap_mirror_write_next(void) {
+    for (uint16_t block = 0; block < DYNAMIC_KEYMAP_MIRROR_BLOCKS; block++) {
+        if (dynamic_keymap_dirty[block / 8] & (1 << (block % 8))) {
+            dynamic_keymap_mirror_write_block(block);
+            return;
+        }
+    }
+}
+
+static inline uint16_t dynamic_keymap_mirror_read(uint16_t offset) {
+    return ((uint16_t)dynamic_keymap_mirror[offset] << 8) | dynamic_keymap_mirror[offset + 1];
+}
+
+static inline void dynamic_keymap_mirror_write(uint16_t offset, uint16_t keycode) {
+    if (dynamic_keymap_mirror_read(offset) == keycode) return;
+    dynamic_keymap_mirror[offset]     = (uint8_t)(keycode >> 8);
+    dynamic_keymap_mirror[offset + 1] = (uint8_t)(keycode & 0xFF);
+    dynamic_keymap_mirror_mark_dirty(offset, 2);
+}
+
+static inline uint16_t dynamic_keymap_key_to_mirror_offset(uint8_t layer, uint8_t row, uint8_t column) {
+    return (((layer * MATRIX_ROWS) + row) * MATRIX_COLS + column) * 2;
+}
+
+#    ifdef ENCODER_MAP_ENABLE
+static inline uint16_t dynamic_keymap_encoder_to_mirror_offset(uint8_t layer, uint8_t encoder_id, bool clockwise) {
+    return DYNAMIC_KEYMAP_KEYMAP_SIZE + (((layer * NUM_ENCODERS) + encoder_id) * 2 + (clockwise ? 0 : 1)) * 2;
+}
+#    endif // ENCODER_MAP_ENABLE
+#endif     // DYNAMIC_KEYMAP_RAM_MIRROR
+
+/** \brief Loads the RAM mirror of the keymap and encoder map from EEPROM. */
+void dynamic_keymap_init(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    eeprom_read_block(dynamic_keymap_mirror, (void *)DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_KEYMAP_SIZE);
+#    ifdef ENCODER_MAP_ENABLE
+    eeprom_read_block(&dynamic_keymap_mirror[DYNAMIC_KEYMAP_KEYMAP_SIZE], (void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR, DYNAMIC_KEYMAP_ENCODER_SIZE);
+#    endif // ENCODER_MAP_ENABLE
+    memset(dynamic_keymap_dirty, 0, sizeof(dynamic_keymap_dirty));
+    dynamic_keymap_dirty_blocks = 0;
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+}
+
+/** \brief Writes pending keymap changes back to EEPROM
+ *
+ * Nothing is written until DYNAMIC_KEYMAP_WRITEBACK_DELAY has passed since the last change, so a burst of edits from
+ * the host results in a single write-back. One block is written per call to keep the main loop responsive.
+ */
+void dynamic_keymap_task(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    if (dynamic_keymap_dirty_blocks == 0) {
+        return;
+    }
+    uint16_t elapsed = timer_elapsed(dynamic_keymap_last_write);
+    if (elapsed >= DYNAMIC_KEYMAP_WRITEBACK_DELAY) {
+        dynamic_keymap_mirror_write_next();
+        elapsed = DYNAMIC_KEYMAP_WRITEBACK_DELAY;
+    }
+#    ifdef KEYBOARD_IDLE_ENABLE
+    if (dynamic_keymap_dirty_blocks > 0) {
+        keyboard_idle_request(DYNAMIC_KEYMAP_WRITEBACK_DELAY - elapsed);
+    }
+#    endif
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+}
+
+/** \brief Writes all pending keymap changes back to EEPROM immediately. */
+void dynamic_keymap_flush(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    while (dynamic_keymap_dirty_blocks > 0) {
+        dynamic_keymap_mirror_write_next();
+    }
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+}
+
+/** \brief Returns true while keymap changes are waiting to be written back to EEPROM. */
+bool dynamic_keymap_writeback_pending(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    return dynamic_keymap_dirty_blocks > 0;
+#else
+    return false;
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+}
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -112,19 +259,30 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
 
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    return dynamic_keymap_mirror_read(dynamic_keymap_key_to_mirror_offset(layer, row, column));
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
     return keycode;
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_write(dynamic_keymap_key_to_mirror_offset(layer, row, column), keycode);
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+#ifdef LAYER_CACHE_ENABLE
+    layer_cache_invalidate_key((keypos_t){.row = row, .col = column});
+#endif
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -134,19 +292,27 @@ void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id
 
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    return dynamic_keymap_mirror_read(dynamic_keymap_encoder_to_mirror_offset(layer, encoder_id, clockwise));
+#    else
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
     keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
     return keycode;
+#    endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
+#    ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    dynamic_keymap_mirror_write(dynamic_keymap_encoder_to_mirror_offset(layer, encoder_id, clockwise), keycode);
+#    else
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+#    endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -165,12 +331,19 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+    // A reset is usually followed by marking the EEPROM valid, so don't leave it half written
+    dynamic_keymap_flush();
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *target                     = data;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    uint16_t valid = offset < dynamic_keymap_eeprom_size ? MIN(size, dynamic_keymap_eeprom_size - offset) : 0;
+    memcpy(data, &dynamic_keymap_mirror[offset], valid);
+    memset(data + valid, 0x00, size - valid);
+#else
+    void *   source = ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + offset;
+    uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
             *target = eeprom_read_byte(source);
@@ -180,12 +353,20 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
         source++;
         target++;
     }
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *source                     = data;
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+    uint16_t valid = offset < dynamic_keymap_eeprom_size ? MIN(size, dynamic_keymap_eeprom_size - offset) : 0;
+    if (valid > 0 && memcmp(&dynamic_keymap_mirror[offset], data, valid) != 0) {
+        memcpy(&dynamic_keymap_mirror[offset], data, valid);
+        dynamic_keymap_mirror_mark_dirty(offset, valid);
+    }
+#else
+    void *   target = ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + offset;
+    uint8_t *source = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
             eeprom_update_byte(target, *source);
@@ -193,6 +374,10 @@ void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
         source++;
         target++;
     }
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+#ifdef LAYER_CACHE_ENABLE
+    layer_cache_invalidate();
+#endif
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -220,7 +405,7 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   source = ((void *)DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + offset;
     uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -234,7 +419,7 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   target = ((void *)DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + offset;
     uint8_t *source = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
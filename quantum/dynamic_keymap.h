@@ -18,6 +18,10 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+void     dynamic_keymap_init(void);
+void     dynamic_keymap_task(void);
+void     dynamic_keymap_flush(void);
+bool     dynamic_keymap_writeback_pending(void);
 uint8_t  dynamic_keymap_get_layer_count(void);
 void *   dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column);
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column);
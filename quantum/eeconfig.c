@@ -9,6 +9,10 @@
 #    include "eeprom_driver.h"
 #endif
 
+#if defined(DYNAMIC_KEYMAP_ENABLE)
+#    include "dynamic_keymap.h"
+#endif
+
 #if defined(HAPTIC_ENABLE)
 #    include "haptic.h"
 #endif
@@ -45,6 +49,10 @@ __attribute__((weak)) void eeconfig_init_kb(void) {
 void eeconfig_init_quantum(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_erase();
+#    if defined(DYNAMIC_KEYMAP_ENABLE)
+    // The keymap's RAM mirror would otherwise still match the keymap that was just erased
+    dynamic_keymap_init();
+#    endif
 #endif
 
     eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
@@ -109,6 +117,10 @@ void eeconfig_enable(void) {
 void eeconfig_disable(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_erase();
+#    if defined(DYNAMIC_KEYMAP_ENABLE)
+    // The keymap's RAM mirror would otherwise still match the keymap that was just erased
+    dynamic_keymap_init();
+#    endif
 #endif
     eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
 }
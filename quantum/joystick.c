@@ -16,6 +16,9 @@
 
 #include "joystick.h"
 #include "wait.h"
+#ifdef KEYBOARD_IDLE_ENABLE
+#    include "keyboard.h"
+#endif
 
 #if defined(JOYSTICK_ANALOG)
 #    include "analog.h"
@@ -151,4 +154,8 @@ void joystick_init(void) {
 
 void joystick_task(void) {
     joystick_read_axes();
+#ifdef KEYBOARD_IDLE_ENABLE
+    // Axes are polled, and don't raise an interrupt when they move
+    keyboard_idle_request(KEYBOARD_IDLE_SCAN_INTERVAL);
+#endif
 }
@@ -0,0 +1,63 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "key_event_queue.h"
+
+/*
+ * Free running indices, the difference between them is the number of queued events. The producer only ever writes
+ * the head and the consumer only ever writes the tail, and each side reads the other's index with acquire semantics
+ * after it was stored with release semantics, so a slot is never read before it is written or overwritten before it
+ * is read. The indices are single bytes so that loading and storing them is atomic on every platform, AVR included.
+ * The overflow count is only ever written by the producer.
+ */
+static keyevent_t        key_event_queue[KEY_EVENT_QUEUE_SIZE];
+static uint8_t           key_event_queue_head = 0;
+static uint8_t           key_event_queue_tail = 0;
+static volatile uint16_t overflow_count       = 0;
+
+bool key_event_queue_push(keyevent_t event) {
+    uint8_t head = key_event_queue_head;
+    uint8_t tail = __atomic_load_n(&key_event_queue_tail, __ATOMIC_ACQUIRE);
+    if ((uint8_t)(head - tail) >= KEY_EVENT_QUEUE_SIZE) {
+        overflow_count++;
+        return false;
+    }
+    key_event_queue[head & (KEY_EVENT_QUEUE_SIZE - 1)] = event;
+    // Publish the slot only once it has been written
+    __atomic_store_n(&key_event_queue_head, (uint8_t)(head + 1), __ATOMIC_RELEASE);
+    return true;
+}
+
+bool key_event_queue_pop(keyevent_t *event) {
+    uint8_t tail = key_event_queue_tail;
+    uint8_t head = __atomic_load_n(&key_event_queue_head, __ATOMIC_ACQUIRE);
+    if (head == tail) {
+        return false;
+    }
+    *event = key_event_queue[tail & (KEY_EVENT_QUEUE_SIZE - 1)];
+    // Hand the slot back only once it has been read
+    __atomic_store_n(&key_event_queue_tail, (uint8_t)(tail + 1), __ATOMIC_RELEASE);
+    return true;
+}
+
+uint8_t key_event_queue_count(void) {
+    uint8_t tail = __atomic_load_n(&key_event_queue_tail, __ATOMIC_ACQUIRE);
+    return (uint8_t)(__atomic_load_n(&key_event_queue_head, __ATOMIC_ACQUIRE) - tail);
+}
+
+bool key_event_queue_is_full(void) {
+    return key_event_queue_count() >= KEY_EVENT_QUEUE_SIZE;
+}
+
+uint16_t key_event_queue_overflows(void) {
+    // Two bytes can't be loaded atomically on AVR, so read until the producer didn't bump the count halfway through
+    uint16_t overflows;
+    do {
+        overflows = overflow_count;
+    } while (overflows != overflow_count);
+    return overflows;
+}
+
+void key_event_queue_clear(void) {
+    __atomic_store_n(&key_event_queue_tail, __atomic_load_n(&key_event_queue_head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
@@ -0,0 +1,70 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    Single producer, single consumer queue of key events.
+
+    The producer pushes timestamped events and the consumer (action processing in the main loop) pops them in order.
+    Neither side masks interrupts or takes a lock: the producer only moves the head, the consumer only moves the tail,
+    and each publishes its index with release semantics for the other to load with acquire semantics.
+
+    That only holds with exactly one producer and exactly one consumer:
+    - The producer is either the matrix scan in matrix_task(), or a custom matrix pushing from its interrupt handler.
+      Never both: a custom matrix that pushes its own events must not also report them through matrix_get_row().
+    - The consumer is the main loop. key_event_queue_pop() and key_event_queue_clear() are consumer only.
+    - key_event_queue_count() and key_event_queue_is_full() may be called from either side. The result can only be
+      stale in the caller's favour: the producer sees at most as many free slots as there are, the consumer sees at
+      most as many queued events as there are.
+
+    key_event_queue_push() drops the event, and counts it, when the queue is full. It never makes room itself.
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "keyboard.h"
+
+#ifndef KEY_EVENT_QUEUE_SIZE
+#    define KEY_EVENT_QUEUE_SIZE 16
+#endif
+
+// Events processed per main loop iteration, the rest wait for the next iteration
+#ifndef KEY_EVENT_QUEUE_BUDGET
+#    define KEY_EVENT_QUEUE_BUDGET KEY_EVENT_QUEUE_SIZE
+#endif
+
+#if KEY_EVENT_QUEUE_SIZE < 2 || KEY_EVENT_QUEUE_SIZE > 128 || (KEY_EVENT_QUEUE_SIZE & (KEY_EVENT_QUEUE_SIZE - 1)) != 0
+#    error "KEY_EVENT_QUEUE_SIZE must be a power of two between 2 and 128"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \brief Adds an event to the queue. Producer only.
+ *
+ * Returns false, and counts an overflow, if the queue is full. The event is dropped.
+ */
+bool key_event_queue_push(keyevent_t event);
+
+/** \brief Takes the oldest event off the queue. Consumer only.
+ *
+ * Returns false if the queue is empty.
+ */
+bool key_event_queue_pop(keyevent_t *event);
+
+/** \brief Number of events waiting. */
+uint8_t key_event_queue_count(void);
+
+/** \brief True if the next push would be dropped. */
+bool key_event_queue_is_full(void);
+
+/** \brief Total number of events dropped because the queue was full. */
+uint16_t key_event_queue_overflows(void);
+
+/** \brief Drops all queued events. Consumer only. */
+void key_event_queue_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
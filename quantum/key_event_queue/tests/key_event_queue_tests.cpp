@@ -0,0 +1,200 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+
+extern "C" {
+#include "key_event_queue.h"
+}
+
+namespace {
+
+// Spread a sequence number over the event fields, so that any torn or reordered slot shows up
+keyevent_t make_event(uint32_t sequence) {
+    keyevent_t event = {};
+    event.key.row    = sequence & 0xFF;
+    event.key.col    = (sequence >> 8) & 0xFF;
+    event.time       = sequence >> 16;
+    event.type       = KEY_EVENT;
+    event.pressed    = sequence & 1;
+    return event;
+}
+
+uint32_t event_sequence(const keyevent_t &event) {
+    return event.key.row | (event.key.col << 8) | ((uint32_t)event.time << 16);
+}
+
+} // namespace
+
+class KeyEventQueue : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        key_event_queue_clear();
+    }
+};
+
+TEST_F(KeyEventQueue, EventsComeOutInOrder) {
+    keyevent_t event;
+    EXPECT_FALSE(key_event_queue_pop(&event));
+
+    for (uint32_t i = 0; i < 10; i++) {
+        EXPECT_TRUE(key_event_queue_push(make_event(i)));
+    }
+    EXPECT_EQ(key_event_queue_count(), 10);
+    for (uint32_t i = 0; i < 10; i++) {
+        ASSERT_TRUE(key_event_queue_pop(&event));
+        EXPECT_EQ(event_sequence(event), i);
+        EXPECT_EQ(event.pressed, (bool)(i & 1));
+    }
+    EXPECT_FALSE(key_event_queue_pop(&event));
+    EXPECT_EQ(key_event_queue_count(), 0);
+}
+
+TEST_F(KeyEventQueue, FullQueueDropsAndCounts) {
+    uint16_t overflows = key_event_queue_overflows();
+
+    for (uint32_t i = 0; i < KEY_EVENT_QUEUE_SIZE; i++) {
+        EXPECT_TRUE(key_event_queue_push(make_event(i)));
+    }
+    EXPECT_FALSE(key_event_queue_push(make_event(100)));
+    EXPECT_FALSE(key_event_queue_push(make_event(101)));
+    EXPECT_EQ(key_event_queue_overflows() - overflows, 2);
+    EXPECT_EQ(key_event_queue_count(), KEY_EVENT_QUEUE_SIZE);
+
+    // Events that made it in are untouched, and there is room again once one is taken out
+    keyevent_t event;
+    ASSERT_TRUE(key_event_queue_pop(&event));
+    EXPECT_EQ(event_sequence(event), 0);
+    EXPECT_TRUE(key_event_queue_push(make_event(102)));
+    for (uint32_t i = 1; i < KEY_EVENT_QUEUE_SIZE; i++) {
+        ASSERT_TRUE(key_event_queue_pop(&event));
+        EXPECT_EQ(event_sequence(event), i);
+    }
+    ASSERT_TRUE(key_event_queue_pop(&event));
+    EXPECT_EQ(event_sequence(event), 102);
+}
+
+TEST_F(KeyEventQueue, IndicesWrapAround) {
+    keyevent_t event;
+    for (uint32_t i = 0; i < 1000; i++) {
+        ASSERT_TRUE(key_event_queue_push(make_event(i)));
+        ASSERT_TRUE(key_event_queue_push(make_event(i + 1)));
+        ASSERT_TRUE(key_event_queue_pop(&event));
+        ASSERT_EQ(event_sequence(event), i);
+        ASSERT_TRUE(key_event_queue_pop(&event));
+        ASSERT_EQ(event_sequence(event), i + 1);
+    }
+}
+
+TEST_F(KeyEventQueue, IsFullOnlyWhenPushWouldDrop) {
+    for (uint32_t i = 0; i < KEY_EVENT_QUEUE_SIZE; i++) {
+        EXPECT_FALSE(key_event_queue_is_full());
+        EXPECT_TRUE(key_event_queue_push(make_event(i)));
+    }
+    EXPECT_TRUE(key_event_queue_is_full());
+
+    keyevent_t event;
+    ASSERT_TRUE(key_event_queue_pop(&event));
+    EXPECT_FALSE(key_event_queue_is_full());
+}
+
+TEST_F(KeyEventQueue, SlowConsumerOnlyLosesOverflows) {
+    const uint32_t count     = 1000;
+    uint16_t       overflows = key_event_queue_overflows();
+
+    // One pop for every three pushes, so that the queue keeps filling up
+    keyevent_t event;
+    uint32_t   received = 0;
+    uint32_t   last     = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        key_event_queue_push(make_event(i));
+        if (i % 3 == 2 && key_event_queue_pop(&event)) {
+            uint32_t sequence = event_sequence(event);
+            ASSERT_TRUE(received == 0 || sequence > last) << "event " << sequence << " came after " << last;
+            last = sequence;
+            received++;
+        }
+    }
+    while (key_event_queue_pop(&event)) {
+        uint32_t sequence = event_sequence(event);
+        ASSERT_GT(sequence, last);
+        last = sequence;
+        received++;
+    }
+
+    // Every pop after the queue first fills up makes room for exactly one of the next three pushes
+    uint16_t dropped = key_event_queue_overflows() - overflows;
+    EXPECT_EQ(received + dropped, count);
+    EXPECT_EQ(last, count - 1);
+    EXPECT_EQ(received, KEY_EVENT_QUEUE_SIZE + count / 3);
+}
+
+// The producer and the consumer run on their own threads, as an interrupt and the main loop would
+TEST_F(KeyEventQueue, ConcurrentProducerLosesNothingWhenRetrying) {
+    const uint32_t count = 200000;
+
+    std::thread producer([count] {
+        for (uint32_t i = 0; i < count; i++) {
+            while (!key_event_queue_push(make_event(i))) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    keyevent_t event;
+    uint32_t   expected = 0;
+    while (expected < count) {
+        if (!key_event_queue_pop(&event)) {
+            std::this_thread::yield();
+            continue;
+        }
+        uint32_t sequence = event_sequence(event);
+        if (sequence != expected) {
+            producer.join();
+            FAIL() << "expected event " << expected << " but got " << sequence;
+        }
+        expected++;
+    }
+    producer.join();
+    EXPECT_EQ(key_event_queue_count(), 0);
+}
+
+TEST_F(KeyEventQueue, ConcurrentOverflowsAreAccountedFor) {
+    // Few enough that the 16 bit overflow count can't wrap
+    const uint32_t    count     = 50000;
+    uint16_t          overflows = key_event_queue_overflows();
+    std::atomic<bool> done{false};
+
+    std::thread producer([count, &done] {
+        for (uint32_t i = 0; i < count; i++) {
+            key_event_queue_push(make_event(i));
+        }
+        done = true;
+    });
+
+    // A slow consumer, so that the queue keeps filling up
+    keyevent_t event;
+    uint32_t   received = 0;
+    uint32_t   last     = 0;
+    while (!done || key_event_queue_count()) {
+        if (!key_event_queue_pop(&event)) {
+            std::this_thread::yield();
+            continue;
+        }
+        uint32_t sequence = event_sequence(event);
+        if (received && sequence <= last) {
+            producer.join();
+            FAIL() << "event " << sequence << " came after " << last;
+        }
+        last = sequence;
+        received++;
+        std::this_thread::yield();
+    }
+    producer.join();
+
+    uint16_t dropped = key_event_queue_overflows() - overflows;
+    EXPECT_EQ(received + dropped, count);
+}
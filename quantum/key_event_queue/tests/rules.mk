@@ -0,0 +1,5 @@
+key_event_queue_DEFS := -DKEY_EVENT_QUEUE_ENABLE -DKEY_EVENT_QUEUE_SIZE=16
+
+key_event_queue_SRC := \
+    $(QUANTUM_PATH)/key_event_queue/tests/key_event_queue_tests.cpp \
+    $(QUANTUM_PATH)/key_event_queue.c
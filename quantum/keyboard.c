@@ -24,6 +24,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "led.h"
 #include "keycode.h"
 #include "timer.h"
+#include "wait.h"
 #include "sync_timer.h"
 #include "print.h"
 #include "debug.h"
@@ -32,6 +33,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "task_profiler.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -104,6 +106,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
+#ifdef KEY_EVENT_QUEUE_ENABLE
+#    include "key_event_queue.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
@@ -140,6 +148,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef OS_DETECTION_ENABLE
 #    include "os_detection.h"
 #endif
+#ifdef I2C_ASYNC_ENABLE
+#    include "i2c_master.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -189,6 +200,73 @@ void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timesta
     last_input_modification_time           = MAX(matrix_timestamp, MAX(encoder_timestamp, pointing_device_timestamp));
 }
 
+#ifdef KEYBOARD_IDLE_ENABLE
+static uint32_t idle_delay = KEYBOARD_IDLE_TIMEOUT;
+
+/** \brief keyboard_idle_request
+ *
+ * Requests that the main loop runs again within the given amount of milliseconds. The earliest request wins. Tasks
+ * call this every time they run, for the next time they have something to do.
+ */
+void keyboard_idle_request(uint32_t delay_ms) {
+    if (delay_ms < idle_delay) {
+        idle_delay = delay_ms;
+    }
+}
+
+/** \brief keyboard_idle_wake
+ *
+ * Ends the current idle period, e.g. from a matrix interrupt.
+ */
+void keyboard_idle_wake(void) {
+    platform_idle_wake();
+}
+
+/** \brief matrix_idle_wake_arm
+ *
+ * Matrices that can raise an interrupt on a key press (e.g. by driving every output and enabling an edge interrupt on
+ * every input) override this, and call keyboard_idle_wake() from that interrupt. The default matrix scans one line at
+ * a time and has no wake source, so the main loop keeps polling it every KEYBOARD_IDLE_SCAN_INTERVAL.
+ */
+__attribute__((weak)) bool matrix_idle_wake_arm(void) {
+    return false;
+}
+
+__attribute__((weak)) void matrix_idle_wake_disarm(void) {}
+
+/** \brief platform_idle_wait
+ *
+ * Fallback for platforms without a low power wait.
+ */
+__attribute__((weak)) void platform_idle_wait(uint32_t timeout_ms) {
+    wait_ms(timeout_ms);
+}
+
+__attribute__((weak)) void platform_idle_wake(void) {}
+
+/** \brief keyboard_idle_task
+ *
+ * Sleeps until the earliest deadline requested during this main loop iteration, or KEYBOARD_IDLE_TIMEOUT if nothing is
+ * pending. Sleeping past KEYBOARD_IDLE_SCAN_INTERVAL needs the matrix to wake the main loop on a key press.
+ */
+void keyboard_idle_task(void) {
+    uint32_t delay = idle_delay;
+    idle_delay     = KEYBOARD_IDLE_TIMEOUT;
+    if (delay == 0) {
+        return;
+    }
+
+    bool wake_armed = delay > KEYBOARD_IDLE_SCAN_INTERVAL && matrix_idle_wake_arm();
+    if (!wake_armed && delay > KEYBOARD_IDLE_SCAN_INTERVAL) {
+        delay = KEYBOARD_IDLE_SCAN_INTERVAL;
+    }
+    platform_idle_wait(delay);
+    if (wake_armed) {
+        matrix_idle_wake_disarm();
+    }
+}
+#endif
+
 // Only enable this if console is enabled to print to
 #if defined(DEBUG_MATRIX_SCAN_RATE)
 static uint32_t matrix_timer           = 0;
@@ -408,6 +486,9 @@ void quantum_init(void) {
 void keyboard_init(void) {
     timer_init();
     sync_timer_init();
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_init();
+#endif
 #ifdef VIA_ENABLE
     via_init();
 #endif
@@ -520,6 +601,30 @@ static inline void generate_tick_event(void) {
     }
 }
 
+#ifdef KEY_EVENT_QUEUE_ENABLE
+/** \brief Consumer side of the key event queue
+ *
+ * Processes at most KEY_EVENT_QUEUE_BUDGET queued events, or generates a tick event if there are none. Runs from
+ * keyboard_task() after the scan, never from the producer, see key_event_queue.h.
+ */
+static void key_event_queue_task(void) {
+    keyevent_t event;
+    uint8_t    processed = 0;
+    while (processed < KEY_EVENT_QUEUE_BUDGET && key_event_queue_pop(&event)) {
+        action_exec(event);
+        processed++;
+    }
+    if (!processed) {
+        generate_tick_event();
+    }
+#    ifdef KEYBOARD_IDLE_ENABLE
+    if (key_event_queue_count()) {
+        keyboard_idle_request(0);
+    }
+#    endif
+}
+#endif
+
 /**
  * @brief This task scans the keyboards matrix and processes any key presses
  * that occur.
@@ -527,9 +632,15 @@ static inline void generate_tick_event(void) {
  * @return true Matrix did change
  * @return false Matrix didn't change
  */
+#ifdef KEYBOARD_IDLE_ENABLE
+static bool matrix_keys_down = false;
+#endif
+
 static bool matrix_task(void) {
     if (!matrix_can_read()) {
+#ifndef KEY_EVENT_QUEUE_ENABLE
         generate_tick_event();
+#endif
         return false;
     }
 
@@ -545,7 +656,9 @@ static bool matrix_task(void) {
 
     // Short-circuit the complete matrix processing if it is not necessary
     if (!matrix_changed) {
+#ifndef KEY_EVENT_QUEUE_ENABLE
         generate_tick_event();
+#endif
         return matrix_changed;
     }
 
@@ -557,7 +670,7 @@ static bool matrix_task(void) {
 
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         const matrix_row_t current_row = matrix_get_row(row);
-        const matrix_row_t row_changes = current_row ^ matrix_previous[row];
+        matrix_row_t       row_changes = current_row ^ matrix_previous[row];
 
         if (!row_changes || has_ghost_in_row(row, current_row)) {
             continue;
@@ -569,15 +682,37 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+                    keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+#ifdef MATRIX_SCAN_TIMER_ENABLE
+                    // Stamp the event with the time the key was scanned, not the time the main loop got to it
+                    event.time = matrix_last_scan_time();
+#endif
+#ifdef KEY_EVENT_QUEUE_ENABLE
+                    // The scan is the producer and never processes events itself. A change that doesn't fit is left
+                    // out of matrix_previous, so that a later scan finds it again once the consumer made room.
+                    if (key_event_queue_is_full()) {
+                        row_changes &= ~col_mask;
+                        continue;
+                    }
+                    key_event_queue_push(event);
+#else
+                    action_exec(event);
+#endif
                 }
 
                 switch_events(row, col, key_pressed);
             }
         }
 
-        matrix_previous[row] = current_row;
+        matrix_previous[row] ^= row_changes;
+    }
+
+#ifdef KEYBOARD_IDLE_ENABLE
+    matrix_keys_down = false;
+    for (uint8_t row = 0; row < MATRIX_ROWS && !matrix_keys_down; row++) {
+        matrix_keys_down = matrix_previous[row] != 0;
     }
+#endif
 
     return matrix_changed;
 }
@@ -613,97 +748,115 @@ void quantum_task(void) {
 #endif
 
 #if defined(AUDIO_ENABLE) && !defined(NO_MUSIC_MODE)
-    music_task();
+    TASK_PROFILE(MUSIC, music_task());
 #endif
 
 #ifdef KEY_OVERRIDE_ENABLE
-    key_override_task();
+    TASK_PROFILE(KEY_OVERRIDE, key_override_task());
 #endif
 
 #ifdef SEQUENCER_ENABLE
-    sequencer_task();
+    TASK_PROFILE(SEQUENCER, sequencer_task());
 #endif
 
 #ifdef TAP_DANCE_ENABLE
-    tap_dance_task();
+    TASK_PROFILE(TAP_DANCE, tap_dance_task());
 #endif
 
 #ifdef COMBO_ENABLE
-    combo_task();
+    TASK_PROFILE(COMBO, combo_task());
 #endif
 
 #ifdef LEADER_ENABLE
-    leader_task();
+    TASK_PROFILE(LEADER, leader_task());
 #endif
 
 #ifdef WPM_ENABLE
-    decay_wpm();
+    TASK_PROFILE(WPM, decay_wpm());
 #endif
 
 #ifdef DIP_SWITCH_ENABLE
-    dip_switch_task();
+    TASK_PROFILE(DIP_SWITCH, dip_switch_task());
 #endif
 
 #ifdef AUTO_SHIFT_ENABLE
-    autoshift_matrix_scan();
+    TASK_PROFILE(AUTO_SHIFT, autoshift_matrix_scan());
 #endif
 
 #ifdef CAPS_WORD_ENABLE
-    caps_word_task();
+    TASK_PROFILE(CAPS_WORD, caps_word_task());
 #endif
 
 #ifdef SECURE_ENABLE
-    secure_task();
+    TASK_PROFILE(SECURE, secure_task());
+#endif
+
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    TASK_PROFILE(DYNAMIC_KEYMAP, dynamic_keymap_task());
 #endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    bool                         matrix_changed;
+    TASK_PROFILE(MATRIX, matrix_changed = matrix_task());
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
+#ifdef KEY_EVENT_QUEUE_ENABLE
+    TASK_PROFILE(KEY_EVENT_QUEUE, key_event_queue_task());
+#endif
+
     quantum_task();
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
-    split_watchdog_task();
+    TASK_PROFILE(SPLIT_WATCHDOG, split_watchdog_task());
+#endif
+
+#ifdef I2C_ASYNC_ENABLE
+    TASK_PROFILE(I2C_ASYNC, i2c_async_task());
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
-    rgblight_task();
+    TASK_PROFILE(RGBLIGHT, rgblight_task());
 #endif
 
 #ifdef LED_MATRIX_ENABLE
-    led_matrix_task();
+    TASK_PROFILE(LED_MATRIX, led_matrix_task());
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    TASK_PROFILE(RGB_MATRIX, rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
 #    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
-    backlight_task();
+    TASK_PROFILE(BACKLIGHT, backlight_task());
 #    endif
 #endif
 
 #ifdef ENCODER_ENABLE
-    if (encoder_task()) {
+    bool encoder_changed;
+    TASK_PROFILE(ENCODER, encoder_changed = encoder_task());
+    if (encoder_changed) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    bool pointing_device_changed;
+    TASK_PROFILE(POINTING_DEVICE, pointing_device_changed = pointing_device_task());
+    if (pointing_device_changed) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef OLED_ENABLE
-    oled_task();
+    TASK_PROFILE(OLED, oled_task());
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
@@ -711,7 +864,7 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ST7565_ENABLE
-    st7565_task();
+    TASK_PROFILE(ST7565, st7565_task());
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) st7565_on();
@@ -720,32 +873,43 @@ void keyboard_task(void) {
 
 #ifdef MOUSEKEY_ENABLE
     // mousekey repeat & acceleration
-    mousekey_task();
+    TASK_PROFILE(MOUSEKEY, mousekey_task());
 #endif
 
 #ifdef PS2_MOUSE_ENABLE
-    ps2_mouse_task();
+    TASK_PROFILE(PS2_MOUSE, ps2_mouse_task());
 #endif
 
 #ifdef MIDI_ENABLE
-    midi_task();
+    TASK_PROFILE(MIDI, midi_task());
 #endif
 
 #ifdef JOYSTICK_ENABLE
-    joystick_task();
+    TASK_PROFILE(JOYSTICK, joystick_task());
 #endif
 
 #ifdef BLUETOOTH_ENABLE
-    bluetooth_task();
+    TASK_PROFILE(BLUETOOTH, bluetooth_task());
 #endif
 
 #ifdef HAPTIC_ENABLE
-    haptic_task();
+    TASK_PROFILE(HAPTIC, haptic_task());
 #endif
 
-    led_task();
+    TASK_PROFILE(LED, led_task());
 
 #ifdef OS_DETECTION_ENABLE
-    os_detection_task();
+    TASK_PROFILE(OS_DETECTION, os_detection_task());
+#endif
+
+#ifdef HOST_COALESCE_REPORTS
+    host_task();
+#endif
+
+#ifdef KEYBOARD_IDLE_ENABLE
+    // Held keys and recent input keep the scan rate up, so that tapping, combos and one shots see timely tick events
+    if (matrix_keys_down || last_input_activity_elapsed() < KEYBOARD_IDLE_ACTIVITY_PERIOD) {
+        keyboard_idle_request(KEYBOARD_IDLE_SCAN_INTERVAL);
+    }
 #endif
 }
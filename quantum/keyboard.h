@@ -139,6 +139,30 @@ void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timesta
 
 uint32_t get_matrix_scan_rate(void);
 
+#ifdef KEYBOARD_IDLE_ENABLE
+// Longest sleep while the matrix has to be polled, i.e. keys are held, input was recent or there is no wake source
+#    ifndef KEYBOARD_IDLE_SCAN_INTERVAL
+#        define KEYBOARD_IDLE_SCAN_INTERVAL 1
+#    endif
+// Longest sleep while nothing is pending and the matrix armed a wake source
+#    ifndef KEYBOARD_IDLE_TIMEOUT
+#        define KEYBOARD_IDLE_TIMEOUT 100
+#    endif
+#    ifndef KEYBOARD_IDLE_ACTIVITY_PERIOD
+#        define KEYBOARD_IDLE_ACTIVITY_PERIOD 1000
+#    endif
+
+void keyboard_idle_request(uint32_t delay_ms); // Ask for the main loop to run again within delay_ms milliseconds
+void keyboard_idle_wake(void);                 // Cut the current idle period short, safe to call from interrupt handlers
+void keyboard_idle_task(void);                 // To be executed by the main loop after all other tasks, sleeps until the earliest deadline
+
+bool matrix_idle_wake_arm(void);    // Make any key press call keyboard_idle_wake(), returns false if the matrix can't
+void matrix_idle_wake_disarm(void); // Undo matrix_idle_wake_arm() before the next scan
+
+void platform_idle_wait(uint32_t timeout_ms); // Platform specific low power wait, returns early once platform_idle_wake() is called
+void platform_idle_wake(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -348,6 +348,16 @@ void led_matrix_task(void) {
             led_task_sync();
             break;
     }
+
+#ifdef KEYBOARD_IDLE_ENABLE
+    // A frame takes several main loop iterations, after that the next one is due once the flush limit has passed. Once
+    // the LEDs are off there is nothing left to render until something changes.
+    if (led_task_state != SYNCING) {
+        keyboard_idle_request(0);
+    } else if (effect) {
+        keyboard_idle_request(LED_MATRIX_LED_FLUSH_LIMIT - MIN(sync_timer_elapsed32(g_led_timer), LED_MATRIX_LED_FLUSH_LIMIT));
+    }
+#endif
 }
 
 void led_matrix_indicators(void) {
@@ -15,6 +15,7 @@
  */
 
 #include "keyboard.h"
+#include "task_profiler.h"
 
 void platform_setup(void);
 
@@ -38,7 +39,7 @@ void protocol_task(void) __attribute__((weak));
 void protocol_task(void) {
     protocol_pre_task();
 
-    keyboard_task();
+    TASK_PROFILE(KEYBOARD, keyboard_task());
 
     protocol_post_task();
 }
@@ -62,15 +63,20 @@ int main(void) {
 #ifdef QUANTUM_PAINTER_ENABLE
         // Run Quantum Painter task
         void qp_internal_task(void);
-        qp_internal_task();
+        TASK_PROFILE(QUANTUM_PAINTER, qp_internal_task());
 #endif
 
 #ifdef DEFERRED_EXEC_ENABLE
         // Run deferred executions
         void deferred_exec_task(void);
-        deferred_exec_task();
+        TASK_PROFILE(DEFERRED_EXEC, deferred_exec_task());
 #endif // DEFERRED_EXEC_ENABLE
 
-        housekeeping_task();
+        TASK_PROFILE(HOUSEKEEPING, housekeeping_task());
+
+#ifdef KEYBOARD_IDLE_ENABLE
+        // Sleep until the next task deadline
+        keyboard_idle_task();
+#endif
     }
 }
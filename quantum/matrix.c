@@ -21,6 +21,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "atomic_util.h"
+#ifdef MATRIX_SCAN_TIMER_ENABLE
+#    include "timer.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -270,6 +273,125 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#ifdef MATRIX_SCAN_TIMER_ENABLE
+#    if !defined(DIRECT_PINS) && (DIODE_DIRECTION != COL2ROW)
+#        error "MATRIX_SCAN_TIMER_ENABLE only supports DIRECT_PINS and COL2ROW matrices"
+#    endif
+
+#    ifndef MATRIX_SCAN_TIMER_PERIOD_US
+#        define MATRIX_SCAN_TIMER_PERIOD_US 30
+#    endif
+
+#    ifndef MATRIX_SCAN_TIMER_RING_SIZE
+#        define MATRIX_SCAN_TIMER_RING_SIZE 8
+#    endif
+
+/*
+ * A hardware timer interrupt scans one row per tick: it reads the row selected on the previous tick, unselects it
+ * and selects the next one, so the timer period doubles as the select and unselect delay. Every completed scan is
+ * queued as a snapshot, stamped with the tick count, and matrix_scan() only consumes snapshots. The scan rate no
+ * longer depends on how long the rest of the main loop takes.
+ */
+typedef struct matrix_snapshot_t {
+    uint32_t     tick;
+    matrix_row_t rows[ROWS_PER_HAND];
+} matrix_snapshot_t;
+
+static matrix_snapshot_t snapshots[MATRIX_SCAN_TIMER_RING_SIZE];
+// Release stores and acquire loads, so that a snapshot is complete before its slot is published, and read before the slot is handed back
+static uint8_t           snapshot_head = 0; // only written by the timer interrupt
+static uint8_t           snapshot_tail = 0; // only written by matrix_scan()
+static volatile uint32_t scan_ticks    = 0;
+static volatile uint16_t scan_overruns = 0;
+static matrix_row_t      scan_rows[ROWS_PER_HAND];
+static uint8_t           scan_row       = 0;
+static fast_timer_t      last_scan_time = 0;
+
+// The interrupt already runs with the main loop masked, so the pins are driven without the atomic helpers
+static inline void matrix_scan_timer_select_row(uint8_t row) {
+#    ifndef DIRECT_PINS
+    pin_t pin = row_pins[row];
+    if (pin != NO_PIN) {
+        gpio_set_pin_output(pin);
+        gpio_write_pin_low(pin);
+    }
+#    endif
+}
+
+static inline void matrix_scan_timer_unselect_row(uint8_t row) {
+#    ifndef DIRECT_PINS
+    pin_t pin = row_pins[row];
+    if (pin != NO_PIN) {
+#        ifdef MATRIX_UNSELECT_DRIVE_HIGH
+        gpio_set_pin_output(pin);
+        gpio_write_pin_high(pin);
+#        else
+        gpio_set_pin_input_high(pin);
+#        endif
+    }
+#    endif
+}
+
+static inline matrix_row_t matrix_scan_timer_read_row(uint8_t row) {
+#    ifndef DIRECT_PINS
+    if (row_pins[row] == NO_PIN) {
+        return 0;
+    }
+#    endif
+
+    matrix_row_t row_value   = 0;
+    matrix_row_t row_shifter = MATRIX_ROW_SHIFTER;
+    for (uint8_t col_index = 0; col_index < MATRIX_COLS; col_index++, row_shifter <<= 1) {
+#    ifdef DIRECT_PINS
+        row_value |= readMatrixPin(direct_pins[row][col_index]) ? 0 : row_shifter;
+#    else
+        row_value |= readMatrixPin(col_pins[col_index]) ? 0 : row_shifter;
+#    endif
+    }
+    return row_value;
+}
+
+/** \brief Advances the scan by one row, called from the timer interrupt set up by matrix_scan_timer_start() */
+void matrix_scan_timer_tick(void) {
+    scan_ticks++;
+
+    scan_rows[scan_row] = matrix_scan_timer_read_row(scan_row);
+    matrix_scan_timer_unselect_row(scan_row);
+
+    if (++scan_row == ROWS_PER_HAND) {
+        scan_row = 0;
+
+        uint8_t head = snapshot_head;
+        uint8_t next = (head + 1) % MATRIX_SCAN_TIMER_RING_SIZE;
+        if (next == __atomic_load_n(&snapshot_tail, __ATOMIC_ACQUIRE)) {
+            // The main loop has fallen behind, drop this scan and keep the queued ones in order
+            scan_overruns++;
+        } else {
+            snapshots[head].tick = scan_ticks;
+            memcpy(snapshots[head].rows, scan_rows, sizeof(scan_rows));
+            __atomic_store_n(&snapshot_head, next, __ATOMIC_RELEASE);
+        }
+    }
+
+    matrix_scan_timer_select_row(scan_row);
+}
+
+/** \brief Number of completed scans dropped because the main loop did not consume them in time */
+uint16_t matrix_scan_timer_overruns(void) {
+    return scan_overruns;
+}
+
+/** \brief timer_read() value at which the snapshot behind the last matrix_scan() result was taken */
+uint16_t matrix_last_scan_time(void) {
+    return (uint16_t)last_scan_time;
+}
+
+/** \brief timer_read_fast() value at which the snapshot behind the last matrix_scan() result was taken */
+fast_timer_t matrix_last_scan_time_fast(void) {
+    return last_scan_time;
+}
+#endif
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     // Set pinout for right half if pinout for that half is defined
@@ -307,8 +429,16 @@ void matrix_init(void) {
     memset(matrix, 0, sizeof(matrix));
     memset(raw_matrix, 0, sizeof(raw_matrix));
 
+#ifdef MATRIX_SCAN_TIMER_ENABLE
+    last_scan_time = timer_read_fast();
+#endif
     debounce_init(ROWS_PER_HAND);
 
+#ifdef MATRIX_SCAN_TIMER_ENABLE
+    matrix_scan_timer_select_row(scan_row);
+    matrix_scan_timer_start(MATRIX_SCAN_TIMER_PERIOD_US);
+#endif
+
     matrix_init_kb();
 }
 
@@ -320,6 +450,47 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 }
 #endif
 
+#ifdef MATRIX_SCAN_TIMER_ENABLE
+uint8_t matrix_scan(void) {
+    bool changed = false;
+
+    do {
+        bool    raw_changed = false;
+        uint8_t tail        = snapshot_tail;
+        if (tail != __atomic_load_n(&snapshot_head, __ATOMIC_ACQUIRE)) {
+            matrix_snapshot_t *snapshot = &snapshots[tail];
+
+            raw_changed = memcmp(raw_matrix, snapshot->rows, sizeof(snapshot->rows)) != 0;
+            if (raw_changed) memcpy(raw_matrix, snapshot->rows, sizeof(snapshot->rows));
+
+            // The debounce algorithms read this as the current time, see debounce_timer_read_fast()
+            fast_timer_t scan_time = timer_read_fast() - (fast_timer_t)((scan_ticks - snapshot->tick) * MATRIX_SCAN_TIMER_PERIOD_US / 1000);
+            // Rounding to milliseconds must not take the time backwards
+            if (timer_expired_fast(scan_time, last_scan_time)) {
+                last_scan_time = scan_time;
+            }
+
+            __atomic_store_n(&snapshot_tail, (uint8_t)((tail + 1) % MATRIX_SCAN_TIMER_RING_SIZE), __ATOMIC_RELEASE);
+        } else {
+            last_scan_time = timer_read_fast();
+        }
+
+#    ifdef SPLIT_KEYBOARD
+        changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, raw_changed);
+#    else
+        changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, raw_changed);
+#    endif
+        // Stop at the first scan that changes the debounced matrix, so that no key transition gets merged away
+    } while (!changed && snapshot_tail != __atomic_load_n(&snapshot_head, __ATOMIC_ACQUIRE));
+
+#    ifdef SPLIT_KEYBOARD
+    changed |= matrix_post_scan();
+#    else
+    matrix_scan_kb();
+#    endif
+    return (uint8_t)changed;
+}
+#else
 uint8_t matrix_scan(void) {
     matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
 
@@ -347,3 +518,4 @@ uint8_t matrix_scan(void) {
 #endif
     return (uint8_t)changed;
 }
+#endif
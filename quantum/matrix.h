@@ -20,6 +20,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <stdint.h>
 #include <stdbool.h>
 #include "gpio.h"
+#ifdef MATRIX_SCAN_TIMER_ENABLE
+#    include "timer.h"
+#endif
 
 /* diode directions */
 #define COL2ROW 0
@@ -75,6 +78,17 @@ void matrix_scan_kb(void);
 void matrix_init_user(void);
 void matrix_scan_user(void);
 
+#ifdef MATRIX_SCAN_TIMER_ENABLE
+/* start the platform timer that calls matrix_scan_timer_tick() every period_us microseconds */
+void matrix_scan_timer_start(uint16_t period_us);
+void matrix_scan_timer_tick(void);
+/* completed scans dropped because matrix_scan() fell behind */
+uint16_t matrix_scan_timer_overruns(void);
+/* timer_read() value of the scan behind the current matrix state */
+uint16_t     matrix_last_scan_time(void);
+fast_timer_t matrix_last_scan_time_fast(void);
+#endif
+
 #ifdef SPLIT_KEYBOARD
 bool matrix_post_scan(void);
 void matrix_slave_scan_kb(void);
@@ -0,0 +1,26 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 2
+#define MATRIX_COLS 2
+#define MATRIX_ROW_PINS \
+    { 0, 1 }
+#define MATRIX_COL_PINS \
+    { 2, 3 }
+#define DIODE_DIRECTION COL2ROW
+
+// Two rows, so one full scan per millisecond
+#define MATRIX_SCAN_TIMER_PERIOD_US 500
+#define MATRIX_SCAN_TIMER_RING_SIZE 16
+#define DEBOUNCE 5
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "mock.h"
+
+#ifdef __cplusplus
+};
+#endif
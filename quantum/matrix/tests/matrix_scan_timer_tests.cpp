@@ -0,0 +1,118 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "timer.h"
+void set_time(uint32_t t);
+
+extern matrix_row_t matrix[MATRIX_ROWS];
+}
+
+namespace {
+
+uint32_t now_us = 0;
+
+uint32_t now_ms() {
+    return now_us / 1000;
+}
+
+// One full scan by the timer interrupt, with the main loop's clock keeping up with it
+void scan() {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_scan_timer_tick();
+        now_us += MATRIX_SCAN_TIMER_PERIOD_US;
+    }
+    set_time(now_ms());
+}
+
+} // namespace
+
+class MatrixScanTimer : public ::testing::Test {
+   protected:
+    uint16_t overruns;
+
+    static void SetUpTestSuite() {
+        set_time(0);
+        matrix_init();
+    }
+
+    void SetUp() override {
+        // Release everything and let the main loop catch up with every scan
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                mock_set_key(row, col, false);
+            }
+        }
+        for (int i = 0; i < 2 * DEBOUNCE; i++) {
+            scan();
+            matrix_scan();
+        }
+        overruns = matrix_scan_timer_overruns();
+    }
+};
+
+TEST_F(MatrixScanTimer, TimerIsStartedOnInit) {
+    EXPECT_EQ(mock_scan_timer_starts, 1);
+}
+
+TEST_F(MatrixScanTimer, PressAndReleaseWithinOneLoopAreBothReported) {
+    uint32_t start = now_ms();
+
+    mock_set_key(0, 1, true);
+    for (int i = 0; i < 7; i++) {
+        scan();
+    }
+    mock_set_key(0, 1, false);
+    for (int i = 0; i < 7; i++) {
+        scan();
+    }
+
+    // Each queued scan is debounced at the time it was taken, not at the time the main loop got to it
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_EQ(matrix[0], 0b10);
+    EXPECT_EQ(matrix_last_scan_time(), (uint16_t)(start + 1 + DEBOUNCE));
+
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_EQ(matrix[0], 0);
+    EXPECT_EQ(matrix_last_scan_time(), (uint16_t)(start + 8 + DEBOUNCE));
+
+    EXPECT_FALSE(matrix_scan());
+    EXPECT_EQ(matrix_scan_timer_overruns(), overruns);
+}
+
+TEST_F(MatrixScanTimer, BounceShorterThanDebounceIsFiltered) {
+    mock_set_key(1, 1, true);
+    for (int i = 0; i < DEBOUNCE - 1; i++) {
+        scan();
+    }
+    mock_set_key(1, 1, false);
+    for (int i = 0; i < 2 * DEBOUNCE; i++) {
+        scan();
+    }
+
+    EXPECT_FALSE(matrix_scan());
+    EXPECT_EQ(matrix[1], 0);
+}
+
+TEST_F(MatrixScanTimer, OverrunsAreCounted) {
+    uint32_t start = now_ms();
+
+    // The ring keeps one slot free, so the last of these scans has nowhere to go
+    mock_set_key(1, 0, true);
+    for (int i = 0; i < MATRIX_SCAN_TIMER_RING_SIZE; i++) {
+        scan();
+    }
+    EXPECT_EQ(matrix_scan_timer_overruns() - overruns, 1);
+
+    // The scans that were queued are still consumed in order
+    EXPECT_TRUE(matrix_scan());
+    EXPECT_EQ(matrix[1], 0b01);
+    EXPECT_EQ(matrix_last_scan_time(), (uint16_t)(start + 1 + DEBOUNCE));
+    EXPECT_FALSE(matrix_scan());
+
+    scan();
+    EXPECT_EQ(matrix_scan_timer_overruns() - overruns, 1);
+}
@@ -0,0 +1,60 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "matrix.h"
+#include "mock.h"
+
+#define MOCK_PINS 4
+
+static bool output[MOCK_PINS];
+static bool level[MOCK_PINS];
+static bool keys[MATRIX_ROWS][MATRIX_COLS];
+
+static const pin_t row_pins[MATRIX_ROWS] = MATRIX_ROW_PINS;
+static const pin_t col_pins[MATRIX_COLS] = MATRIX_COL_PINS;
+
+matrix_row_t raw_matrix[MATRIX_ROWS];
+matrix_row_t matrix[MATRIX_ROWS];
+
+uint8_t mock_scan_timer_starts = 0;
+
+void mock_set_pin_output(pin_t pin) {
+    output[pin] = true;
+}
+
+void mock_set_pin_input_high(pin_t pin) {
+    output[pin] = false;
+    level[pin]  = true;
+}
+
+void mock_write_pin(pin_t pin, bool value) {
+    level[pin] = value;
+}
+
+// A column reads low while a pressed key connects it to a row driven low
+bool mock_read_pin(pin_t pin) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (col_pins[col] == pin && keys[row][col] && output[row_pins[row]] && !level[row_pins[row]]) {
+                return false;
+            }
+        }
+    }
+    return output[pin] ? level[pin] : true;
+}
+
+void mock_set_key(uint8_t row, uint8_t col, bool pressed) {
+    keys[row][col] = pressed;
+}
+
+void matrix_scan_timer_start(uint16_t period_us) {
+    mock_scan_timer_starts++;
+}
+
+void matrix_init_kb(void) {}
+
+void matrix_scan_kb(void) {}
+
+void matrix_output_select_delay(void) {}
+
+void matrix_output_unselect_delay(uint8_t line, bool key_pressed) {}
@@ -0,0 +1,25 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint8_t pin_t;
+
+#define gpio_set_pin_output(pin) mock_set_pin_output(pin)
+#define gpio_set_pin_input_high(pin) mock_set_pin_input_high(pin)
+#define gpio_write_pin_low(pin) mock_write_pin(pin, false)
+#define gpio_write_pin_high(pin) mock_write_pin(pin, true)
+#define gpio_read_pin(pin) mock_read_pin(pin)
+
+void mock_set_pin_output(pin_t pin);
+void mock_set_pin_input_high(pin_t pin);
+void mock_write_pin(pin_t pin, bool level);
+bool mock_read_pin(pin_t pin);
+
+// Closes the switch between row pin `row` and column pin `col`
+void mock_set_key(uint8_t row, uint8_t col, bool pressed);
+
+// Number of times matrix_scan_timer_start() was called
+extern uint8_t mock_scan_timer_starts;
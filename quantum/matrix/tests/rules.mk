@@ -0,0 +1,9 @@
+matrix_scan_timer_DEFS := -DMATRIX_SCAN_TIMER_ENABLE -DIGNORE_ATOMIC_BLOCK
+matrix_scan_timer_CONFIG := $(QUANTUM_PATH)/matrix/tests/config_mock.h
+
+matrix_scan_timer_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/debounce/sym_defer_g.c \
+	$(QUANTUM_PATH)/matrix/tests/mock.c \
+	$(QUANTUM_PATH)/matrix/tests/matrix_scan_timer_tests.cpp \
+	$(QUANTUM_PATH)/matrix.c
@@ -130,6 +130,31 @@ bool qp_flush(painter_device_t device) {
     return ret;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_busy
+
+bool qp_busy(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok || !driver->comms_vtable->comms_busy) {
+        return false;
+    }
+
+    return driver->comms_vtable->comms_busy(device);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_get_comms_stats
+
+bool qp_get_comms_stats(painter_device_t device, painter_comms_stats_t *stats) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok || !stats || !driver->comms_vtable->comms_stats) {
+        return false;
+    }
+
+    driver->comms_vtable->comms_stats(device, stats);
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_get_*
 
@@ -56,6 +56,24 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+/**
+ * @def This controls how many decoded glyphs are kept in RAM for text rendering. Glyphs are cached in the display's
+ *      native pixel format, so redrawing text skips font decoding, and adjacent cached glyphs are sent to the display
+ *      as a single block. Each entry requires \ref QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE bytes of RAM, plus a small
+ *      amount of metadata. Set to 0 to disable the cache.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 0
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES
+
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE
+/**
+ * @def This controls the maximum size in bytes of a single cached glyph, in the display's native pixel format. Glyphs
+ *      that do not fit are drawn directly from the font as if the cache was disabled.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE 512
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -72,6 +90,15 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_SPI_ASYNC_BUFFERS
+/**
+ * @def This controls how many staging buffers of QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE bytes are used when SPI
+ *      transfers are asynchronous (QUANTUM_PAINTER_SPI_ASYNC_ENABLE). One is filled while the others are being sent;
+ *      it should not exceed the SPI driver's SPI_ASYNC_QUEUE_SIZE.
+ */
+#    define QUANTUM_PAINTER_SPI_ASYNC_BUFFERS 2
+#endif // QUANTUM_PAINTER_SPI_ASYNC_BUFFERS
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -129,6 +156,16 @@ typedef struct painter_font_desc_t {
  */
 typedef const painter_font_desc_t *painter_font_handle_t;
 
+/**
+ * @typedef Transfer statistics for a device's comms, as retrieved by \ref qp_get_comms_stats.
+ */
+typedef struct painter_comms_stats_t {
+    uint32_t transfers;       ///< Number of asynchronous transfers completed
+    uint32_t stalls;          ///< Number of times a send had to wait for a staging buffer to free up
+    uint8_t  queue_depth;     ///< Number of transfers currently queued or in flight
+    uint8_t  max_queue_depth; ///< Highest number of transfers queued or in flight at once
+} painter_comms_stats_t;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API
 
@@ -175,6 +212,29 @@ bool qp_clear(painter_device_t device);
  */
 bool qp_flush(painter_device_t device);
 
+/**
+ * Checks whether a device is still transmitting data in the background.
+ *
+ * @note Only asynchronous comms (such as SPI with QUANTUM_PAINTER_SPI_ASYNC_ENABLE) can return true here; drawing
+ *       APIs may return before everything has been sent. Subsequent operations wait for outstanding transfers as
+ *       required, so this is only needed to know when the bus is actually idle.
+ *
+ * @param device[in] the handle of the device to query
+ * @return true if transfers are still queued or in flight
+ * @return false if the device is idle
+ */
+bool qp_busy(painter_device_t device);
+
+/**
+ * Retrieves the transfer statistics of a device's comms.
+ *
+ * @param device[in] the handle of the device to query
+ * @param stats[out] the statistics, including the current queue depth
+ * @return true if the comms driver keeps statistics
+ * @return false if the comms driver does not keep statistics
+ */
+bool qp_get_comms_stats(painter_device_t device, painter_comms_stats_t *stats);
+
 /**
  * Retrieves the width of the display.
  *
@@ -36,6 +36,76 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 255
+#    error "QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES must be 255 or less"
+#endif
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
+// A glyph decoded into a device's native pixel format, laid out row by row exactly as the viewport expects it
+typedef struct qp_glyph_cache_entry_t {
+    const qff_font_handle_t *font; // NULL if the entry is free
+    painter_device_t         device;
+    uint32_t                 code_point;
+    uint32_t                 last_used;
+    qp_pixel_t               fg_hsv888;
+    qp_pixel_t               bg_hsv888;
+    uint8_t                  width;
+    uint8_t                  data[QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE];
+} qp_glyph_cache_entry_t;
+
+static qp_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES] = {0};
+static uint32_t               glyph_cache_clock                                  = 0;
+
+static inline bool qp_glyph_cache_colors_match(const qff_font_handle_t *qff_font, const qp_glyph_cache_entry_t *entry, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    // Fonts with their own palette, or in native format, ignore the requested colors
+    if (qff_font->has_palette || qff_font->bpp > 8) {
+        return true;
+    }
+    return entry->fg_hsv888.hsv888.h == fg_hsv888.hsv888.h && entry->fg_hsv888.hsv888.s == fg_hsv888.hsv888.s && entry->fg_hsv888.hsv888.v == fg_hsv888.hsv888.v //
+           && entry->bg_hsv888.hsv888.h == bg_hsv888.hsv888.h && entry->bg_hsv888.hsv888.s == bg_hsv888.hsv888.s && entry->bg_hsv888.hsv888.v == bg_hsv888.hsv888.v;
+}
+
+static qp_glyph_cache_entry_t *qp_glyph_cache_find(const qff_font_handle_t *qff_font, painter_device_t device, uint32_t code_point, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        qp_glyph_cache_entry_t *entry = &glyph_cache[i];
+        if (entry->font == qff_font && entry->code_point == code_point && entry->device == device && qp_glyph_cache_colors_match(qff_font, entry, fg_hsv888, bg_hsv888)) {
+            entry->last_used = ++glyph_cache_clock;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Returns a free entry, evicting the least recently used one if there are none
+static qp_glyph_cache_entry_t *qp_glyph_cache_claim(void) {
+    qp_glyph_cache_entry_t *victim = &glyph_cache[0];
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (!glyph_cache[i].font) {
+            victim = &glyph_cache[i];
+            break;
+        }
+        if ((int32_t)(glyph_cache[i].last_used - victim->last_used) < 0) {
+            victim = &glyph_cache[i];
+        }
+    }
+    victim->font = NULL;
+    return victim;
+}
+
+static void qp_glyph_cache_invalidate_font(const qff_font_handle_t *qff_font) {
+    for (int i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES; ++i) {
+        if (glyph_cache[i].font == qff_font) {
+            glyph_cache[i].font = NULL;
+        }
+    }
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -151,6 +221,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // The slot may be reused by a different font, so its glyphs can't stay around
+    qp_glyph_cache_invalidate_font(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -345,6 +420,15 @@ typedef struct code_point_iter_drawglyph_state_t {
     qp_internal_byte_input_callback   input_callback;
     qp_internal_byte_input_state_t *  input_state;
     qp_internal_pixel_output_state_t *output_state;
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Glyph cache
+    qp_pixel_t              fg_hsv888;
+    qp_pixel_t              bg_hsv888;
+    bool                    font_prepared;
+    uint8_t                 run_capacity;
+    uint8_t                 run_length;
+    qp_glyph_cache_entry_t *run[QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES];
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
 } code_point_iter_drawglyph_state_t;
 
 // Codepoint handler callback: drawing
@@ -369,6 +453,174 @@ static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_f
     return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
 }
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Cached string drawing implementation
+
+// Output state used when decoding a glyph into a cache entry instead of the pixdata buffer
+typedef struct qp_glyph_cache_output_state_t {
+    painter_device_t device;
+    uint8_t *        buffer;
+    uint32_t         write_pos;
+} qp_glyph_cache_output_state_t;
+
+static bool qp_glyph_cache_pixel_appender(qp_pixel_t *palette, uint8_t index, void *cb_arg) {
+    qp_glyph_cache_output_state_t *state  = (qp_glyph_cache_output_state_t *)cb_arg;
+    painter_driver_t *             driver = (painter_driver_t *)state->device;
+    return driver->driver_vtable->append_pixels(state->device, state->buffer, palette, state->write_pos++, 1, &index);
+}
+
+static bool qp_glyph_cache_byte_appender(uint8_t byteval, void *cb_arg) {
+    qp_glyph_cache_output_state_t *state  = (qp_glyph_cache_output_state_t *)cb_arg;
+    painter_driver_t *             driver = (painter_driver_t *)state->device;
+    return driver->driver_vtable->append_pixdata(state->device, state->buffer, state->write_pos++, byteval);
+}
+
+// Decodes the glyph the stream is positioned at into the supplied cache entry
+static bool qp_glyph_cache_decode(qff_font_handle_t *qff_font, code_point_iter_drawglyph_state_t *state, uint32_t pixel_count, qp_glyph_cache_entry_t *entry) {
+    painter_driver_t *            driver       = (painter_driver_t *)state->device;
+    qp_glyph_cache_output_state_t output_state = {.device = state->device, .buffer = entry->data, .write_pos = 0};
+
+    // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_drawtext_prepare_glyph_for_render()
+    state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
+
+    if (qff_font->bpp <= 8) {
+        return qp_internal_decode_palette(state->device, pixel_count, qff_font->bpp, state->input_callback, state->input_state, qp_internal_global_pixel_lookup_table, qp_glyph_cache_pixel_appender, &output_state);
+    }
+
+    if (qff_font->bpp != driver->native_bits_per_pixel) {
+        qp_dprintf("Font's bpp (%d) doesn't match the target display's native_bits_per_pixel (%d)\n", qff_font->bpp, driver->native_bits_per_pixel);
+        return false;
+    }
+    return qp_internal_send_bytes(state->device, pixel_count * qff_font->bpp / 8, state->input_callback, state->input_state, qp_glyph_cache_byte_appender, &output_state);
+}
+
+// Sets up the palette the first time a glyph actually needs decoding, strings entirely in the cache never need it
+static bool qp_drawtext_prepare_font_once(qff_font_handle_t *qff_font, code_point_iter_drawglyph_state_t *state) {
+    if (!state->font_prepared) {
+        uint32_t data_offset;
+        if (!qp_drawtext_prepare_font_for_render(state->device, qff_font, state->fg_hsv888, state->bg_hsv888, &data_offset)) {
+            return false;
+        }
+        state->font_prepared = true;
+    }
+    return true;
+}
+
+// Sends all pending glyphs to the display as one block, using a single viewport
+static bool qp_drawtext_flush_glyph_run(qff_font_handle_t *qff_font, code_point_iter_drawglyph_state_t *state) {
+    if (state->run_length == 0) {
+        return true;
+    }
+
+    painter_driver_t *driver    = (painter_driver_t *)state->device;
+    uint8_t           height    = qff_font->base.line_height;
+    uint16_t          run_width = 0;
+    for (uint8_t i = 0; i < state->run_length; ++i) {
+        run_width += state->run[i]->width;
+    }
+
+    driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + run_width - 1, state->ypos + height - 1);
+
+    bool ret = true;
+    if (state->run_length == 1) {
+        // A lone glyph is already laid out the way the display expects
+        ret = driver->driver_vtable->pixdata(state->device, state->run[0]->data, ((uint32_t)run_width) * height);
+    } else {
+        // Interleave the rows of each glyph through the pixdata buffer -- runs are only built for byte-aligned pixel formats
+        uint8_t  bytes_per_pixel = driver->native_bits_per_pixel / 8;
+        uint32_t max_bytes       = qp_internal_num_pixels_in_buffer(state->device) * bytes_per_pixel;
+        uint32_t write_pos       = 0;
+        for (uint8_t y = 0; ret && y < height; ++y) {
+            for (uint8_t i = 0; ret && i < state->run_length; ++i) {
+                uint32_t       row_bytes = ((uint32_t)state->run[i]->width) * bytes_per_pixel;
+                const uint8_t *src       = &state->run[i]->data[y * row_bytes];
+                while (row_bytes > 0) {
+                    uint32_t chunk = MIN(row_bytes, max_bytes - write_pos);
+                    memcpy(&qp_internal_global_pixdata_buffer[write_pos], src, chunk);
+                    write_pos += chunk;
+                    src += chunk;
+                    row_bytes -= chunk;
+                    if (write_pos == max_bytes) {
+                        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, write_pos / bytes_per_pixel)) {
+                            ret = false;
+                            break;
+                        }
+                        write_pos = 0;
+                    }
+                }
+            }
+        }
+        if (ret && write_pos > 0) {
+            ret = driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, write_pos / bytes_per_pixel);
+        }
+    }
+
+    // Move the x-position for the next glyph
+    state->xpos += run_width;
+    state->run_length = 0;
+    return ret;
+}
+
+// Draws each codepoint from the glyph cache, decoding any glyph that isn't there yet
+static bool qp_drawtext_cached(qff_font_handle_t *qff_font, const char *str, code_point_iter_drawglyph_state_t *state) {
+    painter_driver_t *driver = (painter_driver_t *)state->device;
+    uint8_t           height = qff_font->base.line_height;
+
+    while (*str) {
+        int32_t code_point = 0;
+        str                = decode_utf8(str, &code_point);
+        if (code_point < 0) {
+            qp_dprintf("Invalid unicode code point decoded. Cannot render.\n");
+            return false;
+        }
+
+        // Make room first, so that claiming an entry can never evict one still waiting in the run
+        if (state->run_length == state->run_capacity && !qp_drawtext_flush_glyph_run(qff_font, state)) {
+            return false;
+        }
+
+        qp_glyph_cache_entry_t *entry = qp_glyph_cache_find(qff_font, state->device, code_point, state->fg_hsv888, state->bg_hsv888);
+        if (!entry) {
+            uint8_t width;
+            if (!qp_drawtext_prepare_font_once(qff_font, state) || !qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+                qp_dprintf("Failed to prepare glyph for rendering.\n");
+                return false;
+            }
+
+            uint32_t pixel_count = ((uint32_t)width) * height;
+            if ((pixel_count * driver->native_bits_per_pixel + 7) / 8 > QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE) {
+                // Too large to cache, stream it straight to the display instead
+                if (!qp_drawtext_flush_glyph_run(qff_font, state) || !qp_font_code_point_handler_drawglyph(qff_font, code_point, width, height, state)) {
+                    qp_dprintf("Failed to execute glyph handler.\n");
+                    return false;
+                }
+                continue;
+            }
+
+            entry = qp_glyph_cache_claim();
+            if (!qp_glyph_cache_decode(qff_font, state, pixel_count, entry)) {
+                qp_dprintf("Failed to decode glyph into the cache.\n");
+                return false;
+            }
+            entry->font       = qff_font;
+            entry->device     = state->device;
+            entry->code_point = code_point;
+            entry->last_used  = ++glyph_cache_clock;
+            entry->fg_hsv888  = state->fg_hsv888;
+            entry->bg_hsv888  = state->bg_hsv888;
+            entry->width      = width;
+        }
+
+        state->run[state->run_length++] = entry;
+    }
+
+    return qp_drawtext_flush_glyph_run(qff_font, state);
+}
+
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_textwidth
 
@@ -441,7 +693,19 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
 
     qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    // Palette setup is deferred until a glyph needs decoding. Runs of cached glyphs are combined into a single
+    // transfer, which needs whole bytes per pixel -- other formats send each glyph on its own.
+    state.fg_hsv888     = fg_hsv888;
+    state.bg_hsv888     = bg_hsv888;
+    state.font_prepared = false;
+    state.run_capacity  = (driver->native_bits_per_pixel % 8 == 0) ? QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES : 1;
+    state.run_length    = 0;
+
+    bool ret = qp_drawtext_cached(qff_font, str, &state);
+#else  // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
+    uint32_t data_offset;
     if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
         qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
         qp_comms_stop(device);
@@ -450,6 +714,7 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
 
     // Iterate the codepoints with the drawglyph callback
     bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES > 0
 
     qp_dprintf("qp_drawtext_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
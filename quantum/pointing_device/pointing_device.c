@@ -24,6 +24,9 @@
 #ifdef MOUSEKEY_ENABLE
 #    include "mousekey.h"
 #endif
+#ifdef KEYBOARD_IDLE_ENABLE
+#    include "keyboard.h"
+#endif
 
 #if (defined(POINTING_DEVICE_ROTATION_90) + defined(POINTING_DEVICE_ROTATION_180) + defined(POINTING_DEVICE_ROTATION_270)) > 1
 #    error More than one rotation selected.  This is not supported.
@@ -235,12 +238,25 @@ __attribute__((weak)) bool pointing_device_task(void) {
 
 #if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
-    if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
+    uint32_t        elapsed   = timer_elapsed32(last_exec);
+    if (elapsed < POINTING_DEVICE_TASK_THROTTLE_MS) {
+#    ifdef KEYBOARD_IDLE_ENABLE
+        keyboard_idle_request(POINTING_DEVICE_TASK_THROTTLE_MS - elapsed);
+#    endif
         return false;
     }
     last_exec = timer_read32();
 #endif
 
+#ifdef KEYBOARD_IDLE_ENABLE
+    // The sensor is polled, so come back for the next poll
+#    if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
+    keyboard_idle_request(POINTING_DEVICE_TASK_THROTTLE_MS);
+#    else
+    keyboard_idle_request(KEYBOARD_IDLE_SCAN_INTERVAL);
+#    endif
+#endif
+
     // Gather report info
 #ifdef POINTING_DEVICE_MOTION_PIN
 #    if defined(SPLIT_POINTING_ENABLE)
@@ -284,7 +300,11 @@ __attribute__((weak)) bool pointing_device_task(void) {
     }
     local_mouse_report = is_keyboard_left() ? pointing_device_task_combined_kb(local_mouse_report, shared_mouse_report) : pointing_device_task_combined_kb(shared_mouse_report, local_mouse_report);
 #else
+#    ifdef POINTING_DEVICE_HIRES_ENABLE
+    local_mouse_report = pointing_device_hires_task(local_mouse_report);
+#    else
     local_mouse_report = pointing_device_adjust_by_defines(local_mouse_report);
+#    endif
     local_mouse_report = pointing_device_task_kb(local_mouse_report);
 #endif
     // automatic mouse layer function
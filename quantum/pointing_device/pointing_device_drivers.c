@@ -450,6 +450,9 @@ const pointing_device_driver_t pointing_device_driver = {
 #elif defined(POINTING_DEVICE_DRIVER_pmw3360) || defined(POINTING_DEVICE_DRIVER_pmw3389)
 static void pmw33xx_init_wrapper(void) {
     pmw33xx_init(0);
+#    if defined(PMW33XX_MOTION_ASYNC)
+    pmw33xx_motion_start();
+#    endif
 }
 
 static void pmw33xx_set_cpi_wrapper(uint16_t cpi) {
@@ -461,8 +464,12 @@ static uint16_t pmw33xx_get_cpi_wrapper(void) {
 }
 
 report_mouse_t pmw33xx_get_report(report_mouse_t mouse_report) {
-    pmw33xx_report_t report    = pmw33xx_read_burst(0);
-    static bool      in_motion = false;
+#    if defined(PMW33XX_MOTION_ASYNC)
+    pmw33xx_report_t report = pmw33xx_motion_consume(0);
+#    else
+    pmw33xx_report_t report = pmw33xx_read_burst(0);
+#    endif
+    static bool in_motion = false;
 
     if (report.motion.b.is_lifted) {
         return mouse_report;
@@ -0,0 +1,136 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef POINTING_DEVICE_HIRES_ENABLE
+
+#    include "pointing_device.h"
+#    include "pointing_device_hires.h"
+
+#    if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
+#        error "POINTING_DEVICE_HIRES_ENABLE is not supported with POINTING_DEVICE_COMBINED"
+#    endif
+
+#    define HIRES_ONE 256
+
+#    if POINTING_DEVICE_HIRES_ROTATION_ANGLE % 360 != 0
+#        define HIRES_ROTATION_RADIANS (POINTING_DEVICE_HIRES_ROTATION_ANGLE * 3.14159265358979 / 180)
+// In 1/16384ths, folded at compile time
+static const int32_t rotation_cos = (int32_t)__builtin_round(__builtin_cos(HIRES_ROTATION_RADIANS) * 16384);
+static const int32_t rotation_sin = (int32_t)__builtin_round(__builtin_sin(HIRES_ROTATION_RADIANS) * 16384);
+#    endif
+
+// Motion not reported yet, in 1/256ths of a count
+static int32_t accumulated_x = 0;
+static int32_t accumulated_y = 0;
+static int32_t accumulated_h = 0;
+static int32_t accumulated_v = 0;
+static bool    scrolling     = false;
+
+static int32_t constrain_i32(int32_t value, int32_t low, int32_t high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+__attribute__((weak)) uint16_t pointing_device_hires_gain_kb(uint16_t speed, uint16_t gain) {
+    return pointing_device_hires_gain_user(speed, gain);
+}
+
+__attribute__((weak)) uint16_t pointing_device_hires_gain_user(uint16_t speed, uint16_t gain) {
+    return gain;
+}
+
+static uint16_t pointing_device_hires_gain(uint16_t speed) {
+    uint32_t gain = POINTING_DEVICE_HIRES_SCALE;
+#    if POINTING_DEVICE_HIRES_ACCEL_SLOPE > 0
+    if (speed > POINTING_DEVICE_HIRES_ACCEL_OFFSET) {
+        gain += (uint32_t)(speed - POINTING_DEVICE_HIRES_ACCEL_OFFSET) * POINTING_DEVICE_HIRES_ACCEL_SLOPE;
+        if (gain > POINTING_DEVICE_HIRES_ACCEL_LIMIT) {
+            gain = POINTING_DEVICE_HIRES_ACCEL_LIMIT;
+        }
+    }
+#    endif
+    gain = pointing_device_hires_gain_kb(speed, gain);
+    return gain > POINTING_DEVICE_HIRES_GAIN_MAX ? POINTING_DEVICE_HIRES_GAIN_MAX : gain;
+}
+
+// Whole counts and the fraction separately, so that neither product overflows
+static int32_t pointing_device_hires_scale(int32_t value, uint16_t gain) {
+    return (value / HIRES_ONE) * gain + (value % HIRES_ONE) * gain / HIRES_ONE;
+}
+
+// Takes whole steps of `size` out of `accumulated`, as many as `limit` allows, and keeps up to `limit` more for later
+static int32_t pointing_device_hires_quantize(int32_t *accumulated, int32_t size, int32_t limit) {
+    // Towards zero, so that a fraction waits for more motion in the same direction
+    int32_t steps = constrain_i32(*accumulated / size, -limit, limit);
+    *accumulated  = constrain_i32(*accumulated - steps * size, -limit * size, limit * size);
+    return steps;
+}
+
+report_mouse_t pointing_device_hires_task(report_mouse_t mouse_report) {
+    int32_t x = mouse_report.x;
+    int32_t y = mouse_report.y;
+
+    // The same quarter turns and inversions as pointing_device_adjust_by_defines(), exact in any case
+#    if defined(POINTING_DEVICE_ROTATION_90)
+    int32_t rotated = x;
+    x               = y;
+    y               = -rotated;
+#    elif defined(POINTING_DEVICE_ROTATION_180)
+    x = -x;
+    y = -y;
+#    elif defined(POINTING_DEVICE_ROTATION_270)
+    int32_t rotated = x;
+    x               = -y;
+    y               = rotated;
+#    endif
+#    if defined(POINTING_DEVICE_INVERT_X)
+    x = -x;
+#    endif
+#    if defined(POINTING_DEVICE_INVERT_Y)
+    y = -y;
+#    endif
+
+    uint16_t ax    = x < 0 ? -x : x;
+    uint16_t ay    = y < 0 ? -y : y;
+    uint16_t speed = ax > ay ? ax + ay / 2 : ay + ax / 2;
+
+#    if POINTING_DEVICE_HIRES_ROTATION_ANGLE % 360 != 0
+    // From 1/16384ths to 1/256ths
+    int32_t motion_x = (x * rotation_cos - y * rotation_sin) / 64;
+    int32_t motion_y = (x * rotation_sin + y * rotation_cos) / 64;
+#    else
+    int32_t motion_x = x * HIRES_ONE;
+    int32_t motion_y = y * HIRES_ONE;
+#    endif
+
+    if (scrolling) {
+        accumulated_h += motion_x;
+        accumulated_v += motion_y;
+        mouse_report.x = 0;
+        mouse_report.y = 0;
+        mouse_report.h = constrain_i32(mouse_report.h + pointing_device_hires_quantize(&accumulated_h, POINTING_DEVICE_HIRES_SCROLL_DIVISOR_H * HIRES_ONE, INT8_MAX), INT8_MIN, INT8_MAX);
+        mouse_report.v = constrain_i32(mouse_report.v + pointing_device_hires_quantize(&accumulated_v, POINTING_DEVICE_HIRES_SCROLL_DIVISOR_V * HIRES_ONE, INT8_MAX), INT8_MIN, INT8_MAX);
+    } else {
+        uint16_t gain = pointing_device_hires_gain(speed);
+        accumulated_x += pointing_device_hires_scale(motion_x, gain);
+        accumulated_y += pointing_device_hires_scale(motion_y, gain);
+        mouse_report.x = pointing_device_hires_quantize(&accumulated_x, HIRES_ONE, XY_REPORT_MAX);
+        mouse_report.y = pointing_device_hires_quantize(&accumulated_y, HIRES_ONE, XY_REPORT_MAX);
+    }
+    return mouse_report;
+}
+
+void pointing_device_hires_set_scrolling(bool enable) {
+    if (scrolling != enable) {
+        accumulated_x = 0;
+        accumulated_y = 0;
+        accumulated_h = 0;
+        accumulated_v = 0;
+    }
+    scrolling = enable;
+}
+
+bool pointing_device_hires_get_scrolling(void) {
+    return scrolling;
+}
+
+#endif
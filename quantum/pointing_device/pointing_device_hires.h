@@ -0,0 +1,85 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+/*
+ * High resolution motion pipeline. Motion from the driver is kept in fixed point, with 8 fractional bits, through
+ * rotation, gain and scrolling, and only quantized into the mouse report at the very end. Whatever does not fit the
+ * report, fractions of a count included, is carried over to the next one instead of being dropped.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "report.h"
+
+// Rotation by any angle in degrees, counterclockwise, after POINTING_DEVICE_ROTATION_* and POINTING_DEVICE_INVERT_*
+#ifndef POINTING_DEVICE_HIRES_ROTATION_ANGLE
+#    define POINTING_DEVICE_HIRES_ROTATION_ANGLE 0
+#endif
+
+// Gain applied to the cursor, in 1/256ths: 256 moves it by one count per sensor count
+#ifndef POINTING_DEVICE_HIRES_SCALE
+#    define POINTING_DEVICE_HIRES_SCALE 256
+#endif
+
+// Acceleration: above ACCEL_OFFSET counts per report, each further count adds ACCEL_SLOPE to the gain, up to ACCEL_LIMIT
+#ifndef POINTING_DEVICE_HIRES_ACCEL_OFFSET
+#    define POINTING_DEVICE_HIRES_ACCEL_OFFSET 0
+#endif
+#ifndef POINTING_DEVICE_HIRES_ACCEL_SLOPE
+#    define POINTING_DEVICE_HIRES_ACCEL_SLOPE 0
+#endif
+#ifndef POINTING_DEVICE_HIRES_ACCEL_LIMIT
+#    define POINTING_DEVICE_HIRES_ACCEL_LIMIT (4 * POINTING_DEVICE_HIRES_SCALE)
+#endif
+
+// Counts of motion per scroll step while scrolling
+#ifndef POINTING_DEVICE_HIRES_SCROLL_DIVISOR_H
+#    define POINTING_DEVICE_HIRES_SCROLL_DIVISOR_H 8
+#endif
+#ifndef POINTING_DEVICE_HIRES_SCROLL_DIVISOR_V
+#    define POINTING_DEVICE_HIRES_SCROLL_DIVISOR_V 8
+#endif
+
+// Keeps products of counts and gains within 32 bits
+#define POINTING_DEVICE_HIRES_GAIN_MAX 8191
+
+#if POINTING_DEVICE_HIRES_SCALE > POINTING_DEVICE_HIRES_GAIN_MAX || POINTING_DEVICE_HIRES_ACCEL_LIMIT > POINTING_DEVICE_HIRES_GAIN_MAX
+#    error "POINTING_DEVICE_HIRES_SCALE and POINTING_DEVICE_HIRES_ACCEL_LIMIT must be 8191 or less"
+#endif
+#if POINTING_DEVICE_HIRES_ACCEL_SLOPE > 0 && POINTING_DEVICE_HIRES_ACCEL_LIMIT < POINTING_DEVICE_HIRES_SCALE
+#    error "POINTING_DEVICE_HIRES_ACCEL_LIMIT must not be below POINTING_DEVICE_HIRES_SCALE"
+#endif
+#if POINTING_DEVICE_HIRES_SCROLL_DIVISOR_H == 0 || POINTING_DEVICE_HIRES_SCROLL_DIVISOR_V == 0
+#    error "POINTING_DEVICE_HIRES_SCROLL_DIVISOR_H and POINTING_DEVICE_HIRES_SCROLL_DIVISOR_V must not be 0"
+#endif
+
+/**
+ * @brief Applies the pipeline to a report from the driver, in place of pointing_device_adjust_by_defines().
+ *
+ * @param[in] mouse_report report_mouse_t with the sensor counts since the last report
+ * @return report_mouse_t with the motion that fits the report
+ */
+report_mouse_t pointing_device_hires_task(report_mouse_t mouse_report);
+
+/**
+ * @brief Sends motion as scrolling instead of moving the cursor, dropping what was left over in the old mode.
+ *
+ * @param[in] scrolling bool
+ */
+void pointing_device_hires_set_scrolling(bool scrolling);
+bool pointing_device_hires_get_scrolling(void);
+
+/**
+ * @brief Cursor gain, in 1/256ths, for the given speed.
+ *
+ * The default follows POINTING_DEVICE_HIRES_SCALE and POINTING_DEVICE_HIRES_ACCEL_*, and can be replaced at keyboard
+ * or user level. Results above POINTING_DEVICE_HIRES_GAIN_MAX are limited to it.
+ *
+ * @param[in] speed uint16_t approximate length of the motion in this report, in counts
+ * @param[in] gain uint16_t gain from the level below
+ * @return uint16_t gain to use
+ */
+uint16_t pointing_device_hires_gain_kb(uint16_t speed, uint16_t gain);
+uint16_t pointing_device_hires_gain_user(uint16_t speed, uint16_t gain);
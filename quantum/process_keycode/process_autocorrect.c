@@ -19,8 +19,150 @@
 #    include "autocorrect_data_default.h"
 #endif
 
+// Ring buffer of the most recent keycodes, `typo_buffer_end` is one past the newest
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
+static uint8_t typo_buffer_end                     = 1;
+
+#define AUTOCORRECT_NO_MATCH UINT16_MAX
+
+/**
+ * @brief reads from the typo buffer
+ *
+ * @param i age of the keycode, 0 being the newest, must be less than typo_buffer_size
+ * @return the keycode
+ */
+static inline uint8_t typo_buffer_get(uint8_t i) {
+    return typo_buffer[typo_buffer_end > i ? typo_buffer_end - 1 - i : typo_buffer_end + AUTOCORRECT_MAX_LENGTH - 1 - i];
+}
+
+/**
+ * @brief appends to the typo buffer, dropping the oldest keycode if it is full
+ *
+ * @param keycode keycode to append
+ */
+static inline void typo_buffer_push(uint8_t keycode) {
+    if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
+        typo_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
+    }
+    typo_buffer[typo_buffer_end] = keycode;
+    typo_buffer_end              = typo_buffer_end + 1 < AUTOCORRECT_MAX_LENGTH ? typo_buffer_end + 1 : 0;
+    ++typo_buffer_size;
+}
+
+#ifdef AUTOCORRECT_FLAT_TRIE
+/**
+ * @brief hashes the last AUTOCORRECT_BLOOM_SUFFIX keycodes, newest first, as the generator does
+ *
+ * @return the hash
+ */
+static inline uint16_t autocorrect_bloom_hash(void) {
+    uint16_t hash = 0;
+    for (uint8_t i = 0; i < AUTOCORRECT_BLOOM_SUFFIX; ++i) {
+        hash = hash * 33 + typo_buffer_get(i);
+    }
+    return hash;
+}
+
+/**
+ * @brief searches the flat trie for a typo ending the buffer
+ *
+ * Branch nodes keep their keycodes sorted, so each one is a binary search rather than a scan, and a bloom filter over
+ * the last few keycodes of every typo rejects most keystrokes before the trie is touched at all.
+ *
+ * @return offset of the matching leaf in `autocorrect_data`, or AUTOCORRECT_NO_MATCH
+ */
+static uint16_t autocorrect_find_typo(void) {
+    uint16_t bit = autocorrect_bloom_hash() & (AUTOCORRECT_BLOOM_BITS - 1);
+    if (!(pgm_read_byte(autocorrect_bloom + (bit >> 3)) & (1 << (bit & 7)))) {
+        return AUTOCORRECT_NO_MATCH;
+    }
+
+    uint16_t state = 0;
+    uint8_t  i     = 0;
+    while (state < DICTIONARY_SIZE) {
+        uint8_t code = pgm_read_byte(autocorrect_data + state);
+
+        if (code & 128) { // Leaf, the whole typo has been matched.
+            return state;
+        }
+        if (i >= typo_buffer_size) {
+            return AUTOCORRECT_NO_MATCH;
+        }
+
+        if (code & 64) { // Chain of single-child nodes, followed directly by its child.
+            uint8_t length = code & 63;
+            for (uint8_t j = 1; j <= length; ++j, ++i) {
+                if (i >= typo_buffer_size || pgm_read_byte(autocorrect_data + state + j) != typo_buffer_get(i)) {
+                    return AUTOCORRECT_NO_MATCH;
+                }
+            }
+            state += length + 1;
+        } else { // Branch, with sorted keycodes followed by the child links.
+            uint8_t const key_i = typo_buffer_get(i++);
+            uint8_t       lo    = 0;
+            uint8_t       hi    = code;
+            while (lo < hi) {
+                uint8_t mid = (lo + hi) / 2;
+                uint8_t key = pgm_read_byte(autocorrect_data + state + 1 + mid);
+                if (key < key_i) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            if (lo >= code || pgm_read_byte(autocorrect_data + state + 1 + lo) != key_i) {
+                return AUTOCORRECT_NO_MATCH;
+            }
+            uint16_t link = state + 1 + code + 2 * lo;
+            state         = pgm_read_byte(autocorrect_data + link) | pgm_read_byte(autocorrect_data + link + 1) << 8;
+        }
+    }
+
+    // Invalid index, only possible with a bug or data corruption.
+    return AUTOCORRECT_NO_MATCH;
+}
+#else
+/**
+ * @brief searches the trie for a typo ending the buffer
+ *
+ * @return offset of the matching leaf in `autocorrect_data`, or AUTOCORRECT_NO_MATCH
+ */
+static uint16_t autocorrect_find_typo(void) {
+    uint16_t state = 0;
+    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
+    for (uint8_t i = 0; i < typo_buffer_size; ++i) {
+        uint8_t const key_i = typo_buffer_get(i);
+
+        if (code & 64) { // Check for match in node with multiple children.
+            code &= 63;
+            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
+                if (!code) return AUTOCORRECT_NO_MATCH;
+            }
+            // Follow link to child node.
+            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
+            // Check for match in node with single child.
+        } else if (code != key_i) {
+            return AUTOCORRECT_NO_MATCH;
+        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
+            ++state;
+        }
+
+        // Stop if `state` becomes an invalid index. This should not normally
+        // happen, it is a safeguard in case of a bug, data corruption, etc.
+        if (state >= DICTIONARY_SIZE) {
+            return AUTOCORRECT_NO_MATCH;
+        }
+
+        code = pgm_read_byte(autocorrect_data + state);
+
+        if (code & 128) { // A typo was found!
+            return state;
+        }
+    }
+    return AUTOCORRECT_NO_MATCH;
+}
+#endif
 
 /**
  * @brief function for querying the enabled state of autocorrect
@@ -251,6 +393,7 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
             // Remove last character from the buffer.
             if (typo_buffer_size > 0) {
                 --typo_buffer_size;
+                typo_buffer_end = typo_buffer_end > 0 ? typo_buffer_end - 1 : AUTOCORRECT_MAX_LENGTH - 1;
             }
             return true;
         case KC_QUOTE:
@@ -265,111 +408,81 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
             return true;
     }
 
-    // Rotate oldest character if buffer is full.
-    if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
-        memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
-        typo_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
-    }
-
-    // Append `keycode` to buffer.
-    typo_buffer[typo_buffer_size++] = keycode;
+    // Append `keycode` to buffer, rotating out the oldest character if it is full.
+    typo_buffer_push(keycode);
     // Return if buffer is smaller than the shortest word.
     if (typo_buffer_size < AUTOCORRECT_MIN_LENGTH) {
         return true;
     }
 
     // Check for typo in buffer using a trie stored in `autocorrect_data`.
-    uint16_t state = 0;
-    uint8_t  code  = pgm_read_byte(autocorrect_data + state);
-    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
-        uint8_t const key_i = typo_buffer[i];
-
-        if (code & 64) { // Check for match in node with multiple children.
-            code &= 63;
-            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
-                if (!code) return true;
-            }
-            // Follow link to child node.
-            state = (pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8);
-            // Check for match in node with single child.
-        } else if (code != key_i) {
-            return true;
-        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
-            ++state;
-        }
+    uint16_t state = autocorrect_find_typo();
+    if (state == AUTOCORRECT_NO_MATCH) {
+        return true;
+    }
 
-        // Stop if `state` becomes an invalid index. This should not normally
-        // happen, it is a safeguard in case of a bug, data corruption, etc.
-        if (state >= DICTIONARY_SIZE) {
-            return true;
+    // A typo was found! Apply autocorrect.
+    uint8_t const code       = pgm_read_byte(autocorrect_data + state);
+    const uint8_t backspaces = (code & 63) + !record->event.pressed;
+    const char *  changes    = (const char *)(autocorrect_data + state + 1);
+
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    bool    space_last = typo_buffer_get(0) == KC_SPC;
+    for (uint8_t i = 0; i < typo_buffer_size; ++i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer_get(i) == KC_SPC && i != 0) {
+            break;
         }
 
-        code = pgm_read_byte(autocorrect_data + state);
-
-        if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char *  changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
+        ++typo_len;
+    }
 
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
 
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
+    // convert buffer of keycodes into a string, oldest first
+    uint8_t typo_newest = space_last ? 1 : 0;
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer_get(typo_newest + typo_len - 1 - i) - KC_A + 'a';
+    }
 
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    strcpy_P(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
         }
+        send_string_P(changes);
+    }
+
+    if (keycode == KC_SPC) {
+        typo_buffer[0]   = KC_SPC;
+        typo_buffer_end  = 1;
+        typo_buffer_size = 1;
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
     }
-    return true;
 }
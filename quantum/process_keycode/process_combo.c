@@ -26,6 +26,7 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "keymap_introspection.h"
+#include "debug.h"
 
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
@@ -278,6 +279,79 @@ static inline void _find_key_index_and_count(const uint16_t *keys, uint16_t keyc
     }
 }
 
+#ifdef COMBO_INDEX_SIZE
+/* Sorted by keycode, then by combo index, so that combos sharing a key are
+ * still processed in the order they are defined in. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+    uint8_t  key_index;
+    uint8_t  key_count;
+} combo_index_entry_t;
+static combo_index_entry_t combo_index[COMBO_INDEX_SIZE];
+static uint16_t            combo_index_size  = 0;
+static bool                combo_index_built = false;
+static bool                combo_index_valid = false;
+
+static void build_combo_index(void) {
+    combo_index_built = true;
+    combo_index_valid = true;
+    combo_index_size  = 0;
+
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        combo_t *combo     = combo_get(idx);
+        uint8_t  key_count = 0;
+        while (pgm_read_word(&combo->keys[key_count]) != COMBO_END) {
+            key_count++;
+        }
+
+        for (uint8_t key_index = 0; key_index < key_count; key_index++) {
+            uint16_t keycode = pgm_read_word(&combo->keys[key_index]);
+
+            /* Repeated keys resolve to their last position, like _find_key_index_and_count(). */
+            uint16_t pos = combo_index_size;
+            while (pos > 0 && combo_index[pos - 1].keycode > keycode) {
+                pos--;
+            }
+            if (pos > 0 && combo_index[pos - 1].keycode == keycode && combo_index[pos - 1].combo_index == idx) {
+                combo_index[pos - 1].key_index = key_index;
+                continue;
+            }
+
+            if (combo_index_size >= COMBO_INDEX_SIZE) {
+                dprintf("combo: COMBO_INDEX_SIZE too small, falling back to linear search\n");
+                combo_index_valid = false;
+                return;
+            }
+            for (uint16_t i = combo_index_size; i > pos; i--) {
+                combo_index[i] = combo_index[i - 1];
+            }
+            combo_index[pos] = (combo_index_entry_t){
+                .keycode     = keycode,
+                .combo_index = idx,
+                .key_index   = key_index,
+                .key_count   = key_count,
+            };
+            combo_index_size++;
+        }
+    }
+}
+
+/* Returns the position of the first entry for the keycode, or combo_index_size if there is none. */
+static uint16_t combo_index_find(uint16_t keycode) {
+    uint16_t lo = 0, hi = combo_index_size;
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (combo_index[mid].keycode < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+#endif
+
 void drop_combo_from_buffer(uint16_t combo_index) {
     /* Mark a combo as processed from the buffer. If the buffer is in the
      * beginning of the buffer, drop it.  */
@@ -414,16 +488,7 @@ static bool keys_pressed_in_order(uint16_t combo_index, combo_t *combo, uint16_t
 }
 #endif
 
-static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
-    uint8_t  key_count = 0;
-    uint16_t key_index = -1;
-    _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
-
-    /* Continue processing if key isn't part of current combo. */
-    if (-1 == (int16_t)key_index) {
-        return false;
-    }
-
+static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index, uint16_t key_index, uint8_t key_count) {
     bool key_is_part_of_combo = (!COMBO_DISABLED(combo) && is_combo_enabled()
 #if defined(COMBO_MUST_PRESS_IN_ORDER) || defined(COMBO_MUST_PRESS_IN_ORDER_PER_COMBO)
                                  && keys_pressed_in_order(combo_index, combo, key_index, keycode, record)
@@ -535,8 +600,7 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
 }
 
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    bool is_combo_key          = false;
-    bool no_combo_keys_pressed = true;
+    bool is_combo_key = false;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -564,10 +628,31 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_INDEX_SIZE
+    if (!combo_index_built) {
+        build_combo_index();
+    }
+    /* KC_NO matches the COMBO_END terminator of every combo in the linear search, keep that behaviour. */
+    if (combo_index_valid && keycode != COMBO_END) {
+        for (uint16_t pos = combo_index_find(keycode); pos < combo_index_size && combo_index[pos].keycode == keycode; ++pos) {
+            combo_index_entry_t *entry = &combo_index[pos];
+            is_combo_key |= process_single_combo(combo_get(entry->combo_index), keycode, record, entry->combo_index, entry->key_index, entry->key_count);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo     = combo_get(idx);
+            uint8_t  key_count = 0;
+            uint16_t key_index = -1;
+            _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
+
+            /* Continue processing if key isn't part of current combo. */
+            if (-1 == (int16_t)key_index) {
+                continue;
+            }
+            is_combo_key |= process_single_combo(combo, keycode, record, idx, key_index, key_count);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
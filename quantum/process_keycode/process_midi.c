@@ -20,6 +20,9 @@
 #include "qmk_midi.h"
 #include "timer.h"
 #include "debug.h"
+#ifdef KEYBOARD_IDLE_ENABLE
+#    include "keyboard.h"
+#endif
 
 #ifdef MIDI_BASIC
 
@@ -247,6 +250,10 @@ bool process_midi(uint16_t keycode, keyrecord_t *record) {
 
 void midi_task(void) {
     midi_device_process(&midi_device);
+#ifdef KEYBOARD_IDLE_ENABLE
+    // Incoming MIDI is polled from the USB endpoint
+    keyboard_idle_request(KEYBOARD_IDLE_SCAN_INTERVAL);
+#endif
 #ifdef MIDI_ADVANCED
     if (timer_elapsed(midi_modulation_timer) < midi_config.modulation_interval) return;
     midi_modulation_timer = timer_read();
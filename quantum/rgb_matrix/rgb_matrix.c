@@ -39,6 +39,21 @@ __attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
     return hsv_to_rgb(hsv);
 }
 
+/** \brief Converts the colors produced by the effect runners
+ *
+ * Goes through rgb_matrix_hsv_to_rgb() for each LED, so that keyboards overriding it keep their conversion, unless
+ * RGB_MATRIX_BATCH_COLOR_CONVERSION is defined.
+ */
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint8_t count) {
+#ifdef RGB_MATRIX_BATCH_COLOR_CONVERSION
+    hsv_to_rgb_batch(hsv, rgb, count);
+#else
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = rgb_matrix_hsv_to_rgb(hsv[i]);
+    }
+#endif
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -77,6 +92,12 @@ static uint8_t         rgb_last_effect   = UINT8_MAX;
 static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
 static rgb_task_states rgb_task_state    = SYNCING;
 
+// static effect tracking
+static rgb_config_t rgb_static_config;
+static bool         rgb_static_skip      = false;
+static bool         rgb_effect_rendering = false;
+static bool         rgb_frame_overdrawn  = true;
+
 // double buffers
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -144,10 +165,12 @@ void rgb_matrix_update_pwm_buffers(void) {
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    rgb_frame_overdrawn |= !rgb_effect_rendering;
     rgb_matrix_driver.set_color(index, red, green, blue);
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    rgb_frame_overdrawn |= !rgb_effect_rendering;
 #if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_SPLIT)
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
@@ -239,6 +262,40 @@ static bool rgb_matrix_none(effect_params_t *params) {
     return false;
 }
 
+/** \brief Effects that only depend on rgb_matrix_config, and draw the same frame every time
+ *
+ * These are rendered once, and then only again when their settings change, or something other than the effect
+ * (indicators, user code) drew over the frame.
+ */
+static bool rgb_matrix_effect_is_static(uint8_t effect) {
+#ifdef RGB_MATRIX_DISABLE_STATIC_SKIP
+    return false;
+#else
+    switch (effect) {
+        case RGB_MATRIX_SOLID_COLOR:
+#    ifdef ENABLE_RGB_MATRIX_ALPHAS_MODS
+        case RGB_MATRIX_ALPHAS_MODS:
+#    endif
+#    ifdef ENABLE_RGB_MATRIX_GRADIENT_UP_DOWN
+        case RGB_MATRIX_GRADIENT_UP_DOWN:
+#    endif
+#    ifdef ENABLE_RGB_MATRIX_GRADIENT_LEFT_RIGHT
+        case RGB_MATRIX_GRADIENT_LEFT_RIGHT:
+#    endif
+            return true;
+        default:
+            return false;
+    }
+#endif
+}
+
+static bool rgb_matrix_static_skip(effect_params_t *params) {
+    // Leave the previous frame in place, but step through the LED ranges like the effect would, for the indicators
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    (void)led_min;
+    return rgb_matrix_check_finished_leds(led_max);
+}
+
 static void rgb_task_timers(void) {
 #if defined(RGB_MATRIX_KEYREACTIVE_ENABLED)
     uint32_t deltaTime = sync_timer_elapsed32(rgb_timer_buffer);
@@ -286,9 +343,21 @@ static void rgb_task_render(uint8_t effect) {
         rgb_matrix_set_color_all(0, 0, 0);
     }
 
+    if (rgb_effect_params.iter == 0) {
+        rgb_static_skip     = !rgb_effect_params.init && !rgb_frame_overdrawn && rgb_matrix_effect_is_static(effect) && memcmp(&rgb_static_config, &rgb_matrix_config, sizeof(rgb_config_t)) == 0;
+        rgb_static_config   = rgb_matrix_config;
+        rgb_frame_overdrawn = false;
+    }
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
-    switch (effect) {
+    rgb_effect_rendering = true;
+    switch (rgb_static_skip ? RGB_MATRIX_EFFECT_MAX : effect) {
+        // Not an actual effect, the last frame of a static effect is still current
+        case RGB_MATRIX_EFFECT_MAX:
+            rendering = rgb_matrix_static_skip(&rgb_effect_params);
+            break;
+
         case RGB_MATRIX_NONE:
             rendering = rgb_matrix_none(&rgb_effect_params);
             break;
@@ -321,10 +390,12 @@ static void rgb_task_render(uint8_t effect) {
         // Factory default magic value
         case UINT8_MAX: {
             rgb_matrix_test();
-            rgb_task_state = FLUSHING;
+            rgb_effect_rendering = false;
+            rgb_task_state       = FLUSHING;
         }
             return;
     }
+    rgb_effect_rendering = false;
 
     rgb_effect_params.iter++;
 
@@ -383,6 +454,16 @@ void rgb_matrix_task(void) {
             rgb_task_sync();
             break;
     }
+
+#ifdef KEYBOARD_IDLE_ENABLE
+    // A frame takes several main loop iterations, after that the next one is due once the flush limit has passed. Once
+    // the LEDs are off there is nothing left to render until something changes.
+    if (rgb_task_state != SYNCING) {
+        keyboard_idle_request(0);
+    } else if (effect) {
+        keyboard_idle_request(RGB_MATRIX_LED_FLUSH_LIMIT - MIN(sync_timer_elapsed32(g_rgb_timer), RGB_MATRIX_LED_FLUSH_LIMIT));
+    }
+#endif
 }
 
 void rgb_matrix_indicators(void) {
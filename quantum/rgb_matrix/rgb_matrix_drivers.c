@@ -20,6 +20,7 @@
 #include "keyboard.h"
 #include "color.h"
 #include "util.h"
+#include "task_profiler.h"
 
 /* Each driver needs to define the struct
  *    const rgb_matrix_driver_t rgb_matrix_driver;
@@ -148,7 +149,7 @@ static void init(void) {
 
 static void flush(void) {
     if (ws2812_dirty) {
-        ws2812_setleds(rgb_matrix_ws2812_array, WS2812_LED_COUNT);
+        TASK_PROFILE(WS2812_FLUSH, ws2812_setleds(rgb_matrix_ws2812_array, WS2812_LED_COUNT));
         ws2812_dirty = false;
     }
 }
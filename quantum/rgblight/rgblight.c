@@ -23,6 +23,9 @@
 #include "debug.h"
 #include "util.h"
 #include "led_tables.h"
+#ifdef KEYBOARD_IDLE_ENABLE
+#    include "keyboard.h"
+#endif
 #include <lib/lib8tion/lib8tion.h>
 #ifdef EEPROM_ENABLE
 #    include "eeprom.h"
@@ -1039,6 +1042,14 @@ static void rgblight_effect_dummy(animation_status_t *anim) {
     **/
 }
 
+#    ifdef KEYBOARD_IDLE_ENABLE
+/** \brief Asks the main loop to come back when the given sync_timer_read() time is reached */
+static void rgblight_idle_request(uint16_t due) {
+    uint16_t now = sync_timer_read();
+    keyboard_idle_request(timer_expired(now, due) ? 0 : TIMER_DIFF_16(due, now));
+}
+#    endif
+
 void rgblight_timer_task(void) {
     if (rgblight_status.timer_enabled) {
         effect_func_t effect_func   = rgblight_effect_dummy;
@@ -1162,6 +1173,18 @@ void rgblight_timer_task(void) {
 #        endif
     }
 #    endif
+
+#    ifdef KEYBOARD_IDLE_ENABLE
+    // Static modes have nothing to do until something changes, animations until their next step is due
+    if (rgblight_status.timer_enabled) {
+        rgblight_idle_request(animation_status.last_timer);
+    }
+#        if defined(RGBLIGHT_LAYERS) && defined(RGBLIGHT_LAYER_BLINK)
+    if (_blinking_layer_mask != 0) {
+        rgblight_idle_request(_repeat_timer);
+    }
+#        endif
+#    endif
 }
 
 #endif /* RGBLIGHT_USE_TIMER */
@@ -5,9 +5,14 @@
 
 #if defined(RGBLIGHT_WS2812)
 #    include "ws2812.h"
+#    include "task_profiler.h"
+
+static void setleds(rgb_led_t *ledarray, uint16_t number_of_leds) {
+    TASK_PROFILE(WS2812_FLUSH, ws2812_setleds(ledarray, number_of_leds));
+}
 
 const rgblight_driver_t rgblight_driver = {
-    .setleds = ws2812_setleds,
+    .setleds = setleds,
 };
 
 #elif defined(RGBLIGHT_APA102)
@@ -0,0 +1,252 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "split_stream.h"
+#include <string.h>
+#include "crc.h"
+#include "timer.h"
+
+_Static_assert((SPLIT_STREAM_WINDOW & (SPLIT_STREAM_WINDOW - 1)) == 0, "SPLIT_STREAM_WINDOW must be a power of two");
+_Static_assert(SPLIT_STREAM_WINDOW <= 16, "SPLIT_STREAM_WINDOW too large for in_flight_valid");
+
+// The ack fields describe frames received from the other half
+#define SPLIT_STREAM_FLAG_ACK_VALID 0x01
+// Sent until answered with SPLIT_STREAM_FLAG_WELCOME: the sender has (re)started, with fresh sequence numbers and
+// nothing of the other half's state
+#define SPLIT_STREAM_FLAG_HELLO 0x02
+// The other half's HELLO has been seen, and the ack fields follow its fresh sequence numbers
+#define SPLIT_STREAM_FLAG_WELCOME 0x04
+
+// Offsets into the frame header
+#define FRAME_SEQUENCE 1
+#define FRAME_ACK 2
+#define FRAME_ACK_BITS 3
+#define FRAME_FLAGS 4
+#define FRAME_LENGTH 5
+#define FRAME_HEADER_CRC 6
+
+#define CHANNEL_BIT(channel) ((split_stream_mask_t)1 << (channel))
+
+void split_stream_init(split_stream_t *stream, const split_stream_callbacks_t *callbacks, uint8_t channel_count, split_stream_mask_t event_channels) {
+    memset(stream, 0, sizeof(split_stream_t));
+    stream->callbacks      = callbacks;
+    stream->all_channels   = channel_count >= SPLIT_STREAM_MAX_CHANNELS ? ~(split_stream_mask_t)0 : CHANNEL_BIT(channel_count) - 1;
+    stream->state_channels = stream->all_channels & ~event_channels;
+    stream->dirty          = stream->state_channels;
+}
+
+void split_stream_mark_dirty(split_stream_t *stream, uint8_t channel) {
+    stream->dirty |= CHANNEL_BIT(channel) & stream->all_channels;
+}
+
+bool split_stream_pending(const split_stream_t *stream, uint8_t channel) {
+    if (stream->dirty & CHANNEL_BIT(channel)) {
+        return true;
+    }
+    for (uint8_t slot = 0; slot < SPLIT_STREAM_WINDOW; slot++) {
+        if ((stream->in_flight_valid & (1 << slot)) && (stream->in_flight[slot] & CHANNEL_BIT(channel))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool split_stream_ready(const split_stream_t *stream) {
+    return stream->dirty || stream->ack_pending || !stream->welcomed || stream->welcome_pending;
+}
+
+bool split_stream_connected(const split_stream_t *stream) {
+    return stream->received_any && timer_elapsed32(stream->last_receive_time) < SPLIT_STREAM_TIMEOUT;
+}
+
+// Sends the channels of the frame in `slot` again, except those already in a later frame that is still in flight
+static void split_stream_resend(split_stream_t *stream, uint8_t slot) {
+    split_stream_mask_t superseded = 0;
+    for (uint8_t other = 0; other < SPLIT_STREAM_WINDOW; other++) {
+        if ((stream->in_flight_valid & (1 << other)) && (int8_t)(stream->in_flight_sequence[other] - stream->in_flight_sequence[slot]) > 0) {
+            superseded |= stream->in_flight[other];
+        }
+    }
+
+    split_stream_mask_t resend = stream->in_flight[slot] & ~superseded;
+    if (resend) {
+        stream->dirty |= resend;
+        stream->stats.retransmits++;
+    }
+}
+
+uint16_t split_stream_build_frame(split_stream_t *stream, uint8_t *frame) {
+    uint8_t sequence = stream->next_sequence++;
+    uint8_t slot     = sequence & (SPLIT_STREAM_WINDOW - 1);
+
+    // The frame that used this slot went out a whole window ago, and has still not been acknowledged
+    if (stream->in_flight_valid & (1 << slot)) {
+        split_stream_resend(stream, slot);
+        stream->in_flight_valid &= ~(1 << slot);
+    }
+
+    // Lowest channels first, the rest wait for the next frame if they don't fit
+    uint8_t            *payload = &frame[SPLIT_STREAM_HEADER_SIZE];
+    uint8_t             length  = 0;
+    split_stream_mask_t sent    = 0;
+    for (uint8_t channel = 0; channel < SPLIT_STREAM_MAX_CHANNELS && (stream->dirty & ~sent); channel++) {
+        if (!(stream->dirty & CHANNEL_BIT(channel))) {
+            continue;
+        }
+        uint8_t size = stream->callbacks->size(channel);
+        if (length + SPLIT_STREAM_RECORD_HEADER_SIZE + size > SPLIT_STREAM_MAX_PAYLOAD) {
+            continue;
+        }
+        payload[length]     = channel;
+        payload[length + 1] = size;
+        stream->callbacks->read(channel, &payload[length + SPLIT_STREAM_RECORD_HEADER_SIZE]);
+        length += SPLIT_STREAM_RECORD_HEADER_SIZE + size;
+        sent |= CHANNEL_BIT(channel);
+    }
+
+    stream->dirty &= ~sent;
+    if (sent) {
+        stream->in_flight[slot]          = sent;
+        stream->in_flight_sequence[slot] = sequence;
+        stream->in_flight_valid |= 1 << slot;
+    }
+
+    frame[0]              = SPLIT_STREAM_SYNC;
+    frame[FRAME_SEQUENCE] = sequence;
+    frame[FRAME_ACK]      = stream->last_sequence;
+    frame[FRAME_ACK_BITS] = stream->ack_bits;
+    frame[FRAME_FLAGS]    = (stream->received_any ? SPLIT_STREAM_FLAG_ACK_VALID : 0) | (stream->welcomed ? 0 : SPLIT_STREAM_FLAG_HELLO) | (stream->welcome_pending ? SPLIT_STREAM_FLAG_WELCOME : 0);
+    frame[FRAME_LENGTH]     = length;
+    frame[FRAME_HEADER_CRC] = crc8(&frame[1], FRAME_HEADER_CRC - 1);
+    stream->welcome_pending = false;
+    stream->ack_pending     = false;
+
+    uint16_t size = SPLIT_STREAM_HEADER_SIZE + length;
+    frame[size]   = crc8(&frame[1], size - 1);
+    stream->stats.frames_sent++;
+    return size + 1;
+}
+
+static void split_stream_acknowledge(split_stream_t *stream, uint8_t ack, uint8_t ack_bits) {
+    uint16_t resolved = 0;
+    for (uint8_t slot = 0; slot < SPLIT_STREAM_WINDOW; slot++) {
+        if (!(stream->in_flight_valid & (1 << slot))) {
+            continue;
+        }
+
+        uint8_t age = ack - stream->in_flight_sequence[slot];
+        if (age >= 0x80) {
+            // Sent after the newest frame the other half has seen, no news yet
+            continue;
+        }
+        if (age != 0 && (age > 8 || !(ack_bits & (1 << (age - 1))))) {
+            // A later frame arrived but this one didn't, and the wire doesn't reorder
+            split_stream_resend(stream, slot);
+        }
+        resolved |= 1 << slot;
+    }
+    // Only now, so that frames acknowledged here still supersede the lost ones before them
+    stream->in_flight_valid &= ~resolved;
+}
+
+static void split_stream_handle_frame(split_stream_t *stream, const uint8_t *frame) {
+    uint8_t flags = frame[FRAME_FLAGS];
+    if (flags & SPLIT_STREAM_FLAG_HELLO) {
+        // The other half has (re)started: follow its new sequence numbers, and send it all state again
+        stream->received_any    = false;
+        stream->dirty          |= stream->state_channels;
+        stream->welcome_pending = true;
+    }
+    if (flags & SPLIT_STREAM_FLAG_WELCOME) {
+        stream->welcomed = true;
+    }
+    // Until welcomed, acknowledgements may still refer to the sequence numbers from before a restart
+    if ((flags & SPLIT_STREAM_FLAG_ACK_VALID) && stream->welcomed) {
+        split_stream_acknowledge(stream, frame[FRAME_ACK], frame[FRAME_ACK_BITS]);
+    }
+
+    uint8_t sequence = frame[FRAME_SEQUENCE];
+    if (stream->received_any) {
+        uint8_t distance = sequence - stream->last_sequence;
+        if (distance == 0 || distance >= 0x80) {
+            // Older than what has been applied already
+            return;
+        }
+        stream->ack_bits = distance > 8 ? 0 : (uint8_t)((stream->ack_bits << distance) | (1 << (distance - 1)));
+    } else {
+        stream->received_any = true;
+        stream->ack_bits     = 0;
+    }
+    stream->last_sequence     = sequence;
+    stream->last_receive_time = timer_read32();
+    stream->stats.frames_received++;
+
+    const uint8_t *payload = &frame[SPLIT_STREAM_HEADER_SIZE];
+    uint8_t        length  = frame[FRAME_LENGTH];
+    if (length > 0) {
+        stream->ack_pending = true;
+    }
+    for (uint8_t offset = 0; offset + SPLIT_STREAM_RECORD_HEADER_SIZE <= length;) {
+        uint8_t channel = payload[offset];
+        uint8_t size    = payload[offset + 1];
+        offset += SPLIT_STREAM_RECORD_HEADER_SIZE;
+        if (offset + size > length) {
+            break;
+        }
+        if (channel < SPLIT_STREAM_MAX_CHANNELS && (stream->all_channels & CHANNEL_BIT(channel))) {
+            stream->callbacks->write(channel, &payload[offset], size);
+        }
+        offset += size;
+    }
+}
+
+static void split_stream_discard(split_stream_t *stream, uint16_t count) {
+    memmove(stream->rx_buffer, &stream->rx_buffer[count], stream->rx_length - count);
+    stream->rx_length -= count;
+}
+
+static void split_stream_parse(split_stream_t *stream) {
+    while (stream->rx_length > 0) {
+        if (stream->rx_buffer[0] != SPLIT_STREAM_SYNC) {
+            stream->stats.skipped_bytes++;
+            split_stream_discard(stream, 1);
+            continue;
+        }
+        if (stream->rx_length < SPLIT_STREAM_HEADER_SIZE) {
+            return;
+        }
+        if (stream->rx_buffer[FRAME_LENGTH] > SPLIT_STREAM_MAX_PAYLOAD || crc8(&stream->rx_buffer[1], FRAME_HEADER_CRC - 1) != stream->rx_buffer[FRAME_HEADER_CRC]) {
+            // Not a header after all
+            stream->stats.skipped_bytes++;
+            split_stream_discard(stream, 1);
+            continue;
+        }
+
+        uint16_t size = SPLIT_STREAM_HEADER_SIZE + stream->rx_buffer[FRAME_LENGTH] + 1;
+        if (stream->rx_length < size) {
+            return;
+        }
+
+        if (crc8(&stream->rx_buffer[1], size - 2) == stream->rx_buffer[size - 1]) {
+            split_stream_handle_frame(stream, stream->rx_buffer);
+            split_stream_discard(stream, size);
+        } else {
+            // A corrupted frame, or rarely a false header: look for the next sync byte within it
+            stream->stats.crc_errors++;
+            stream->stats.skipped_bytes++;
+            split_stream_discard(stream, 1);
+        }
+    }
+}
+
+void split_stream_receive(split_stream_t *stream, const uint8_t *data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        // Nothing else can start a frame, so there's no need to buffer it
+        if (stream->rx_length == 0 && data[i] != SPLIT_STREAM_SYNC) {
+            stream->stats.skipped_bytes++;
+            continue;
+        }
+        stream->rx_buffer[stream->rx_length++] = data[i];
+        split_stream_parse(stream);
+    }
+}
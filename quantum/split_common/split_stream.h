@@ -0,0 +1,133 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+ * Framing and link layer of the streaming split transport. Both halves send frames back to back, each carrying the
+ * channels (split transaction IDs) that changed since they were last sent, and acknowledge what they receive from the
+ * other half in every frame they send:
+ *
+ *   [sync] [sequence] [ack] [ack bits] [flags] [payload length] [header crc8] [(channel, length, data ...) ...] [crc8]
+ *
+ * `ack` is the newest sequence number received, and bit n of `ack bits` is set if sequence number ack - 1 - n was
+ * received too. Channels of a frame that is reported missing, or has not been acknowledged SPLIT_STREAM_WINDOW frames
+ * later, are sent again with their current contents, so the receiver always ends up with the latest state rather than
+ * every intermediate one. Bytes that do not form a valid frame are skipped one at a time until the next sync byte
+ * that does. The header has its own checksum, so that a sync byte in noise or payload is rejected right away, rather
+ * than holding up the frames after it while the payload length it claims comes in.
+ *
+ * Channels carry state by default, and all of them are sent again whenever the other half restarts. Event channels are
+ * only sent when marked, as applying them again would repeat what they ask the other half to do.
+ *
+ * The layer knows nothing of the hardware: received bytes are fed in with split_stream_receive(), and frames to send
+ * are built with split_stream_build_frame() whenever the transmitter is free.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef SPLIT_STREAM_MAX_PAYLOAD
+#    define SPLIT_STREAM_MAX_PAYLOAD 96
+#endif
+
+#ifndef SPLIT_STREAM_TIMEOUT
+#    define SPLIT_STREAM_TIMEOUT 20
+#endif
+
+#if SPLIT_STREAM_MAX_PAYLOAD > 248
+#    error "SPLIT_STREAM_MAX_PAYLOAD must be 248 or less"
+#endif
+
+#define SPLIT_STREAM_MAX_CHANNELS 64
+// Frames in flight before an unacknowledged one is sent again, a power of two
+#define SPLIT_STREAM_WINDOW 16
+
+#define SPLIT_STREAM_SYNC 0xA5
+#define SPLIT_STREAM_HEADER_SIZE 7
+#define SPLIT_STREAM_RECORD_HEADER_SIZE 2
+#define SPLIT_STREAM_MAX_FRAME_SIZE (SPLIT_STREAM_HEADER_SIZE + SPLIT_STREAM_MAX_PAYLOAD + 1)
+
+typedef uint64_t split_stream_mask_t;
+
+typedef struct split_stream_callbacks_t {
+    // Size of what this side sends on `channel`, 0 for channels that are only a notification
+    uint8_t (*size)(uint8_t channel);
+    // Copies the current contents of `channel` into `data`
+    void (*read)(uint8_t channel, uint8_t *data);
+    // Applies `length` bytes received on `channel`, called with every record of a frame before the next frame
+    void (*write)(uint8_t channel, const uint8_t *data, uint8_t length);
+} split_stream_callbacks_t;
+
+typedef struct split_stream_stats_t {
+    uint32_t frames_sent;
+    uint32_t frames_received;
+    uint32_t crc_errors;    // Frames dropped for a bad checksum
+    uint32_t skipped_bytes; // Bytes thrown away while looking for the next frame
+    uint32_t retransmits;   // Frames lost, or never acknowledged, whose channels had to be sent again
+} split_stream_stats_t;
+
+typedef struct split_stream_t {
+    const split_stream_callbacks_t *callbacks;
+    split_stream_mask_t             all_channels;
+    split_stream_mask_t             state_channels; // Sent again in full when the other half restarts
+    split_stream_mask_t             dirty;
+
+    // Sending side
+    uint8_t             next_sequence;
+    split_stream_mask_t in_flight[SPLIT_STREAM_WINDOW]; // Channels of each unacknowledged frame, by sequence number
+    uint8_t             in_flight_sequence[SPLIT_STREAM_WINDOW];
+    uint16_t            in_flight_valid;
+    bool                welcomed;        // The other half knows of our sequence numbers since split_stream_init()
+    bool                welcome_pending; // The other half has restarted, and needs to know that we noticed
+
+    // Receiving side
+    bool     received_any;
+    bool     ack_pending; // A frame with records arrived since the last frame was built
+    uint8_t  last_sequence;
+    uint8_t  ack_bits;
+    uint32_t last_receive_time;
+    uint16_t rx_length;
+    uint8_t  rx_buffer[SPLIT_STREAM_MAX_FRAME_SIZE];
+
+    split_stream_stats_t stats;
+} split_stream_t;
+
+/**
+ * Resets `stream`, with `channel_count` channels described by `callbacks`. Every channel not in `event_channels` is
+ * queued to be sent, and queued again whenever the other half restarts.
+ */
+void split_stream_init(split_stream_t *stream, const split_stream_callbacks_t *callbacks, uint8_t channel_count, split_stream_mask_t event_channels);
+
+/**
+ * Queues `channel` to be sent in a following frame, with its contents as of when that frame is built.
+ */
+void split_stream_mark_dirty(split_stream_t *stream, uint8_t channel);
+
+/**
+ * Returns true while `channel` is queued, or sent but not yet acknowledged.
+ */
+bool split_stream_pending(const split_stream_t *stream, uint8_t channel);
+
+/**
+ * Returns true if the next frame has something to carry beyond repeating the last acknowledgements: queued channels,
+ * handshake flags, or acknowledgement of records that just arrived. Other frames only need to be sent often enough to
+ * keep the link from timing out.
+ */
+bool split_stream_ready(const split_stream_t *stream);
+
+/**
+ * Returns true if a valid frame has been received within the last SPLIT_STREAM_TIMEOUT milliseconds.
+ */
+bool split_stream_connected(const split_stream_t *stream);
+
+/**
+ * Builds the next frame into `frame`, which must hold SPLIT_STREAM_MAX_FRAME_SIZE bytes, and returns its length. A
+ * frame is always built, without records if nothing is queued, so that acknowledgements keep flowing.
+ */
+uint16_t split_stream_build_frame(split_stream_t *stream, uint8_t *frame);
+
+/**
+ * Feeds `length` received bytes to `stream`, applying the records of every valid frame completed by them.
+ */
+void split_stream_receive(split_stream_t *stream, const uint8_t *data, size_t length);
@@ -0,0 +1,177 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "mock.h"
+#include "action_layer.h"
+#include "action_util.h"
+#include "transactions.h"
+#include "transport.h"
+#include "serial.h"
+
+/*
+ * Both halves run in the same process. The shared memory and the globals replicated by the transactions are swapped
+ * in and out when switching sides, and soft_serial_transaction() plays the part of the wire.
+ */
+
+typedef struct mock_side_state_t {
+    split_shared_memory_t shmem;
+    layer_state_t         layer_state;
+    layer_state_t         default_layer_state;
+    uint8_t               mods;
+    uint8_t               weak_mods;
+    uint8_t               oneshot_mods;
+    uint8_t               leds;
+} mock_side_state_t;
+
+layer_state_t layer_state;
+layer_state_t default_layer_state;
+uint8_t       mock_host_leds;
+uint8_t       mock_split_leds;
+
+static uint8_t mods;
+static uint8_t weak_mods;
+static uint8_t oneshot_mods;
+
+static mock_side_state_t      sides[2];
+static mock_side_t            current_side;
+static mock_order_t           callback_order;
+static mock_transport_stats_t stats;
+static uint8_t                fail_count;
+static bool                   corrupt_response;
+
+static void save_side(mock_side_state_t *state) {
+    memcpy(&state->shmem, split_shmem, sizeof(split_shared_memory_t));
+    state->layer_state         = layer_state;
+    state->default_layer_state = default_layer_state;
+    state->mods                = mods;
+    state->weak_mods           = weak_mods;
+    state->oneshot_mods        = oneshot_mods;
+    state->leds                = mock_split_leds;
+}
+
+static void load_side(const mock_side_state_t *state) {
+    memcpy(split_shmem, &state->shmem, sizeof(split_shared_memory_t));
+    layer_state         = state->layer_state;
+    default_layer_state = state->default_layer_state;
+    mods                = state->mods;
+    weak_mods           = state->weak_mods;
+    oneshot_mods        = state->oneshot_mods;
+    mock_split_leds     = state->leds;
+}
+
+void mock_transport_reset(mock_order_t order) {
+    memset(sides, 0, sizeof(sides));
+    memset(&stats, 0, sizeof(stats));
+    load_side(&sides[MOCK_SIDE_MASTER]);
+    current_side     = MOCK_SIDE_MASTER;
+    callback_order   = order;
+    fail_count       = 0;
+    corrupt_response = false;
+    mock_host_leds   = 0;
+}
+
+void mock_transport_select(mock_side_t side) {
+    if (side != current_side) {
+        save_side(&sides[current_side]);
+        load_side(&sides[side]);
+        current_side = side;
+    }
+}
+
+void mock_transport_fail_next(uint8_t count) {
+    fail_count = count;
+}
+
+void mock_transport_corrupt_next_response(void) {
+    corrupt_response = true;
+}
+
+const mock_transport_stats_t *mock_transport_stats(void) {
+    return &stats;
+}
+
+static void run_slave_callback(split_transaction_desc_t *trans) {
+    if (trans->slave_callback) {
+        mock_transport_select(MOCK_SIDE_SLAVE);
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        mock_transport_select(MOCK_SIDE_MASTER);
+    }
+}
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+bool soft_serial_transaction(int sstd_index) {
+    split_transaction_desc_t *trans = &split_transaction_table[sstd_index];
+
+    // Handshake plus both directions, like the serial driver puts them on the wire
+    stats.round_trips++;
+    stats.bytes += 2 + trans->initiator2target_buffer_size + trans->target2initiator_buffer_size;
+
+    if (fail_count) {
+        fail_count--;
+        return false;
+    }
+
+    if (callback_order == MOCK_ORDER_CALLBACK_FIRST) {
+        run_slave_callback(trans);
+    }
+
+    save_side(&sides[MOCK_SIDE_MASTER]);
+    memcpy(((uint8_t *)&sides[MOCK_SIDE_SLAVE].shmem) + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+
+    if (callback_order == MOCK_ORDER_RECEIVE_FIRST) {
+        run_slave_callback(trans);
+    }
+
+    memcpy(split_trans_target2initiator_buffer(trans), ((uint8_t *)&sides[MOCK_SIDE_SLAVE].shmem) + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+    if (corrupt_response && trans->target2initiator_buffer_size) {
+        split_trans_target2initiator_buffer(trans)[trans->target2initiator_buffer_size - 1] ^= 0xFF;
+        corrupt_response = false;
+    }
+    return true;
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+uint8_t host_keyboard_leds(void) {
+    return mock_host_leds;
+}
+
+void set_split_host_keyboard_leds(uint8_t led_state) {
+    mock_split_leds = led_state;
+}
+
+uint8_t get_mods(void) {
+    return mods;
+}
+
+void set_mods(uint8_t new_mods) {
+    mods = new_mods;
+}
+
+uint8_t get_weak_mods(void) {
+    return weak_mods;
+}
+
+void set_weak_mods(uint8_t new_mods) {
+    weak_mods = new_mods;
+}
+
+uint8_t get_oneshot_mods(void) {
+    return oneshot_mods;
+}
+
+void set_oneshot_mods(uint8_t new_mods) {
+    oneshot_mods = new_mods;
+}
+
+uint32_t sync_timer_read32(void) {
+    return timer_read32();
+}
+
+void sync_timer_update(uint32_t time) {}
@@ -0,0 +1,28 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum { MOCK_SIDE_MASTER, MOCK_SIDE_SLAVE } mock_side_t;
+
+typedef enum {
+    MOCK_ORDER_RECEIVE_FIRST,  // ChibiOS serial, I2C: slave callback runs after the frame was received
+    MOCK_ORDER_CALLBACK_FIRST, // AVR serial: slave callback runs before the frame is received
+} mock_order_t;
+
+typedef struct mock_transport_stats_t {
+    uint32_t round_trips;
+    uint32_t bytes;
+} mock_transport_stats_t;
+
+void mock_transport_reset(mock_order_t order);
+void mock_transport_select(mock_side_t side);
+void mock_transport_fail_next(uint8_t count);
+void mock_transport_corrupt_next_response(void);
+
+const mock_transport_stats_t *mock_transport_stats(void);
+
+extern uint8_t mock_host_leds;
+extern uint8_t mock_split_leds;
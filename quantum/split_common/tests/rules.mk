@@ -0,0 +1,22 @@
+split_transport_INC := $(QUANTUM_PATH)/split_common $(TOP_DIR)/drivers
+split_transport_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock.h
+
+split_transport_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/split_common/tests/mock.c \
+	$(QUANTUM_PATH)/split_common/tests/split_transport_tests.cpp \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c
+
+split_transport_batch_DEFS := -DSPLIT_TRANSPORT_BATCH
+split_transport_batch_INC := $(split_transport_INC)
+split_transport_batch_CONFIG := $(split_transport_CONFIG)
+split_transport_batch_SRC := $(split_transport_SRC)
+
+split_stream_INC := $(QUANTUM_PATH)/split_common
+split_stream_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/split_common/split_stream.c \
+	$(QUANTUM_PATH)/split_common/tests/split_stream_tests.cpp
@@ -0,0 +1,398 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <string.h>
+#include <functional>
+#include <vector>
+
+extern "C" {
+#include "crc.h"
+#include "split_stream.h"
+}
+
+extern "C" void set_time(uint32_t t);
+extern "C" void advance_time(uint32_t ms);
+
+namespace {
+
+constexpr uint8_t CHANNELS     = 6;
+constexpr uint8_t CHANNEL_SIZE = 8;
+// Large enough that only a few fit in one frame
+constexpr uint8_t LARGE_CHANNEL      = CHANNELS - 1;
+constexpr uint8_t LARGE_CHANNEL_SIZE = 60;
+
+// One half of the link: what it sends on each channel, and what it has received from the other half
+struct Endpoint {
+    split_stream_t       stream;
+    uint8_t              tx[CHANNELS][LARGE_CHANNEL_SIZE];
+    uint8_t              rx[CHANNELS][LARGE_CHANNEL_SIZE];
+    std::vector<uint8_t> writes;
+};
+
+Endpoint endpoints[2];
+
+template <int side>
+uint8_t channel_size(uint8_t channel) {
+    return channel == LARGE_CHANNEL ? LARGE_CHANNEL_SIZE : CHANNEL_SIZE;
+}
+
+template <int side>
+void channel_read(uint8_t channel, uint8_t *data) {
+    memcpy(data, endpoints[side].tx[channel], channel_size<side>(channel));
+}
+
+template <int side>
+void channel_write(uint8_t channel, const uint8_t *data, uint8_t length) {
+    memcpy(endpoints[side].rx[channel], data, length);
+    endpoints[side].writes.push_back(channel);
+}
+
+const split_stream_callbacks_t callbacks[2] = {
+    {channel_size<0>, channel_read<0>, channel_write<0>},
+    {channel_size<1>, channel_read<1>, channel_write<1>},
+};
+
+} // namespace
+
+class SplitStream : public ::testing::Test {
+   protected:
+    Endpoint &master = endpoints[0];
+    Endpoint &slave  = endpoints[1];
+
+    // Applied to each frame on its way to the other half, may change or drop it
+    std::function<void(int from, std::vector<uint8_t> &frame)> wire;
+
+    void SetUp() override {
+        set_time(0);
+        wire = nullptr;
+        for (int side = 0; side < 2; side++) {
+            memset(endpoints[side].tx, 0, sizeof(endpoints[side].tx));
+            memset(endpoints[side].rx, 0, sizeof(endpoints[side].rx));
+            endpoints[side].writes.clear();
+            split_stream_init(&endpoints[side].stream, &callbacks[side], CHANNELS, 0);
+        }
+    }
+
+    void send(int from) {
+        std::vector<uint8_t> frame(SPLIT_STREAM_MAX_FRAME_SIZE);
+        frame.resize(split_stream_build_frame(&endpoints[from].stream, frame.data()));
+        if (wire) {
+            wire(from, frame);
+        }
+        split_stream_receive(&endpoints[!from].stream, frame.data(), frame.size());
+    }
+
+    // Both halves send one frame each, as they do continuously on the real wire
+    void exchange(int count = 1) {
+        for (int i = 0; i < count; i++) {
+            advance_time(1);
+            send(0);
+            send(1);
+        }
+    }
+
+    void settle(void) {
+        exchange(4);
+        master.writes.clear();
+        slave.writes.clear();
+    }
+
+    void set(Endpoint &endpoint, uint8_t channel, uint8_t value) {
+        memset(endpoint.tx[channel], value, channel_size<0>(channel));
+        split_stream_mark_dirty(&endpoint.stream, channel);
+    }
+
+    bool received(Endpoint &endpoint, uint8_t channel, uint8_t value) {
+        for (uint8_t i = 0; i < channel_size<0>(channel); i++) {
+            if (endpoint.rx[channel][i] != value) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+TEST_F(SplitStream, InitialSync) {
+    for (uint8_t channel = 0; channel < CHANNELS; channel++) {
+        memset(master.tx[channel], 0x10 + channel, channel_size<0>(channel));
+        memset(slave.tx[channel], 0x20 + channel, channel_size<0>(channel));
+    }
+    EXPECT_FALSE(split_stream_connected(&master.stream));
+
+    exchange(3);
+    for (uint8_t channel = 0; channel < CHANNELS; channel++) {
+        EXPECT_TRUE(received(slave, channel, 0x10 + channel)) << "channel " << (int)channel;
+        EXPECT_TRUE(received(master, channel, 0x20 + channel)) << "channel " << (int)channel;
+        EXPECT_FALSE(split_stream_pending(&master.stream, channel));
+    }
+    EXPECT_TRUE(split_stream_connected(&master.stream));
+    EXPECT_TRUE(split_stream_connected(&slave.stream));
+    EXPECT_EQ(master.stream.stats.crc_errors + slave.stream.stats.crc_errors, 0u);
+    EXPECT_EQ(master.stream.stats.retransmits + slave.stream.stats.retransmits, 0u);
+}
+
+TEST_F(SplitStream, ChangeArrivesWithNextFrame) {
+    settle();
+
+    set(slave, 1, 0x5A);
+    EXPECT_TRUE(split_stream_pending(&slave.stream, 1));
+    send(1);
+    EXPECT_TRUE(received(master, 1, 0x5A));
+    EXPECT_EQ(master.writes, std::vector<uint8_t>{1});
+    // Delivered, but not known to be until the master's next frame
+    EXPECT_TRUE(split_stream_pending(&slave.stream, 1));
+    send(0);
+    EXPECT_FALSE(split_stream_pending(&slave.stream, 1));
+
+    // Unchanged channels are not sent again
+    exchange(5);
+    EXPECT_EQ(master.writes, std::vector<uint8_t>{1});
+    EXPECT_EQ(slave.writes, std::vector<uint8_t>{});
+}
+
+TEST_F(SplitStream, RecordsOfOneFrameApplyTogether) {
+    settle();
+
+    set(slave, 3, 0x33);
+    set(slave, 0, 0x30);
+    send(1);
+    EXPECT_EQ(master.writes, (std::vector<uint8_t>{0, 3}));
+}
+
+TEST_F(SplitStream, CorruptedFrameIsResent) {
+    settle();
+
+    bool corrupt = true;
+    wire         = [&](int from, std::vector<uint8_t> &frame) {
+        if (from == 0 && corrupt && frame[SPLIT_STREAM_HEADER_SIZE - 1] > 0) {
+            frame[SPLIT_STREAM_HEADER_SIZE + 3] ^= 0x10;
+            corrupt = false;
+        }
+    };
+    set(master, 2, 0x42);
+    exchange(1);
+    EXPECT_TRUE(received(slave, 2, 0));
+    EXPECT_EQ(slave.stream.stats.crc_errors, 1u);
+
+    // The slave's next frame reports the gap, and the master sends the channel again
+    exchange(2);
+    EXPECT_TRUE(received(slave, 2, 0x42));
+    EXPECT_EQ(master.stream.stats.retransmits, 1u);
+    exchange(1);
+    EXPECT_FALSE(split_stream_pending(&master.stream, 2));
+}
+
+TEST_F(SplitStream, LostFrameIsResent) {
+    settle();
+
+    int dropped = 0;
+    wire        = [&](int from, std::vector<uint8_t> &frame) {
+        if (from == 1 && dropped < 2) {
+            frame.clear();
+            dropped++;
+        }
+    };
+    set(slave, 4, 0x44);
+    exchange(1);
+    set(slave, 1, 0x11);
+    exchange(1);
+    EXPECT_TRUE(received(master, 4, 0));
+    EXPECT_TRUE(received(master, 1, 0));
+
+    exchange(3);
+    EXPECT_TRUE(received(master, 4, 0x44));
+    EXPECT_TRUE(received(master, 1, 0x11));
+    EXPECT_EQ(slave.stream.stats.retransmits, 2u);
+    EXPECT_EQ(master.stream.stats.crc_errors, 0u);
+}
+
+TEST_F(SplitStream, LatestStateWins) {
+    settle();
+
+    // The link is down for a while, and the channel keeps changing
+    bool down = true;
+    wire      = [&](int from, std::vector<uint8_t> &frame) {
+        if (down) {
+            frame.clear();
+        }
+    };
+    for (uint8_t value = 1; value <= 40; value++) {
+        set(master, 0, value);
+        exchange(1);
+    }
+    advance_time(SPLIT_STREAM_TIMEOUT);
+    EXPECT_FALSE(split_stream_connected(&master.stream));
+    EXPECT_TRUE(split_stream_pending(&master.stream, 0));
+
+    down = false;
+    exchange(SPLIT_STREAM_WINDOW + 2);
+    EXPECT_TRUE(received(slave, 0, 40));
+    EXPECT_EQ(slave.writes, std::vector<uint8_t>{0});
+    EXPECT_FALSE(split_stream_pending(&master.stream, 0));
+    EXPECT_TRUE(split_stream_connected(&master.stream));
+}
+
+TEST_F(SplitStream, ResyncsAfterNoise) {
+    settle();
+
+    bool garble = true;
+    wire        = [&](int from, std::vector<uint8_t> &frame) {
+        if (from == 1 && garble) {
+            // A truncated frame, then noise that looks like the start of a frame
+            static const uint8_t noise[] = {0x00, SPLIT_STREAM_SYNC, 0x01, SPLIT_STREAM_SYNC, 0x07, 0x00, 0x00, 0xFF, 0x02};
+            std::vector<uint8_t> garbled(frame.begin(), frame.begin() + 4);
+            garbled.insert(garbled.end(), noise, noise + sizeof(noise));
+            garbled.insert(garbled.end(), frame.begin(), frame.end());
+            frame  = garbled;
+            garble = false;
+        }
+    };
+    set(slave, 3, 0x77);
+    exchange(1);
+    EXPECT_TRUE(received(master, 3, 0x77));
+    EXPECT_GT(master.stream.stats.skipped_bytes, 0u);
+}
+
+TEST_F(SplitStream, FalseHeaderRejected) {
+    settle();
+
+    // A sync byte followed by a header claiming more payload than the frames after it hold, but failing its checksum
+    bool garble = true;
+    wire        = [&](int from, std::vector<uint8_t> &frame) {
+        if (from == 1 && garble) {
+            uint8_t noise[] = {SPLIT_STREAM_SYNC, 0x07, 0x00, 0x00, 0x01, SPLIT_STREAM_MAX_PAYLOAD, 0x00};
+            noise[6]        = crc8(&noise[1], 5) ^ 0x01;
+            frame.insert(frame.begin(), noise, noise + sizeof(noise));
+            garble = false;
+        }
+    };
+    set(slave, 3, 0x77);
+    exchange(1);
+    EXPECT_TRUE(received(master, 3, 0x77));
+    EXPECT_EQ(master.stream.stats.skipped_bytes, 7u);
+    EXPECT_EQ(master.stream.stats.crc_errors, 0u);
+}
+
+TEST_F(SplitStream, ByteAtATime) {
+    settle();
+
+    set(slave, 2, 0x22);
+    set(slave, LARGE_CHANNEL, 0x55);
+    std::vector<uint8_t> frame(SPLIT_STREAM_MAX_FRAME_SIZE);
+    frame.resize(split_stream_build_frame(&slave.stream, frame.data()));
+    for (uint8_t byte : frame) {
+        EXPECT_TRUE(received(master, 2, 0));
+        split_stream_receive(&master.stream, &byte, 1);
+    }
+    EXPECT_TRUE(received(master, 2, 0x22));
+    EXPECT_TRUE(received(master, LARGE_CHANNEL, 0x55));
+}
+
+TEST_F(SplitStream, ChannelsSpreadOverFrames) {
+    settle();
+
+    for (uint8_t channel = 0; channel < CHANNELS; channel++) {
+        set(slave, channel, 0x60 + channel);
+    }
+    send(1);
+    // Everything up to the large channel fits, which then goes in the next frame
+    EXPECT_EQ(master.writes, (std::vector<uint8_t>{0, 1, 2, 3, 4}));
+    EXPECT_TRUE(split_stream_pending(&slave.stream, LARGE_CHANNEL));
+    send(1);
+    EXPECT_TRUE(received(master, LARGE_CHANNEL, 0x60 + LARGE_CHANNEL));
+
+    // Both frames are acknowledged by the next one from the master
+    send(0);
+    for (uint8_t channel = 0; channel < CHANNELS; channel++) {
+        EXPECT_FALSE(split_stream_pending(&slave.stream, channel));
+    }
+}
+
+TEST_F(SplitStream, PeerRestart) {
+    for (uint8_t channel = 0; channel < CHANNELS; channel++) {
+        memset(master.tx[channel], 0x80 + channel, channel_size<0>(channel));
+    }
+    settle();
+    for (uint8_t i = 0; i < 100; i++) {
+        exchange(1);
+    }
+
+    // The slave starts over, with nothing from the master and its sequence numbers reset
+    memset(slave.rx, 0, sizeof(slave.rx));
+    split_stream_init(&slave.stream, &callbacks[1], CHANNELS, 0);
+    exchange(3);
+    for (uint8_t channel = 0; channel < CHANNELS; channel++) {
+        EXPECT_TRUE(received(slave, channel, 0x80 + channel)) << "channel " << (int)channel;
+    }
+}
+
+TEST_F(SplitStream, EventsNotReplayedOnRestart) {
+    constexpr uint8_t EVENT_CHANNEL = 2;
+    split_stream_init(&master.stream, &callbacks[0], CHANNELS, 1 << EVENT_CHANNEL);
+    settle();
+
+    set(master, EVENT_CHANNEL, 0x42);
+    exchange(2);
+    EXPECT_EQ(slave.writes, (std::vector<uint8_t>{EVENT_CHANNEL}));
+
+    slave.writes.clear();
+    split_stream_init(&slave.stream, &callbacks[1], CHANNELS, 0);
+    exchange(3);
+    EXPECT_EQ(slave.writes, (std::vector<uint8_t>{0, 1, 3, 4, LARGE_CHANNEL}));
+}
+
+TEST_F(SplitStream, ReadyOnlyWithNews) {
+    settle();
+    EXPECT_FALSE(split_stream_ready(&master.stream));
+    EXPECT_FALSE(split_stream_ready(&slave.stream));
+
+    set(master, 1, 0x11);
+    EXPECT_TRUE(split_stream_ready(&master.stream));
+    send(0);
+    EXPECT_FALSE(split_stream_ready(&master.stream));
+    // The records need acknowledging, but the frame that does so doesn't
+    EXPECT_TRUE(split_stream_ready(&slave.stream));
+    send(1);
+    EXPECT_FALSE(split_stream_ready(&slave.stream));
+    EXPECT_FALSE(split_stream_ready(&master.stream));
+    EXPECT_FALSE(split_stream_pending(&master.stream, 1));
+}
+
+TEST_F(SplitStream, ConvergesUnderRandomErrors) {
+    uint32_t rng = 0x1234567;
+    auto     next = [&rng](uint32_t bound) {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        return rng % bound;
+    };
+
+    wire = [&](int from, std::vector<uint8_t> &frame) {
+        uint32_t roll = next(100);
+        if (roll < 10) {
+            frame.clear();
+        } else if (roll < 20) {
+            frame[next(frame.size())] ^= 1 << next(8);
+        } else if (roll < 25) {
+            frame.resize(next(frame.size()));
+        }
+    };
+
+    // Well past a sequence number wrap
+    for (int i = 0; i < 2000; i++) {
+        set(next(2) ? master : slave, next(CHANNELS), next(256));
+        exchange(1);
+    }
+
+    wire = nullptr;
+    exchange(SPLIT_STREAM_WINDOW + 2);
+    for (uint8_t channel = 0; channel < CHANNELS; channel++) {
+        EXPECT_EQ(memcmp(master.rx[channel], slave.tx[channel], channel_size<0>(channel)), 0) << "channel " << (int)channel;
+        EXPECT_EQ(memcmp(slave.rx[channel], master.tx[channel], channel_size<0>(channel)), 0) << "channel " << (int)channel;
+        EXPECT_FALSE(split_stream_pending(&master.stream, channel));
+        EXPECT_FALSE(split_stream_pending(&slave.stream, channel));
+    }
+    EXPECT_GT(master.stream.stats.retransmits, 0u);
+    EXPECT_GT(slave.stream.stats.crc_errors, 0u);
+}
@@ -0,0 +1,163 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <string.h>
+
+extern "C" {
+#include "timer.h"
+#include "action_layer.h"
+#include "action_util.h"
+#include "transactions.h"
+#include "transport.h"
+#include "split_common/tests/mock.h"
+}
+
+extern "C" void set_time(uint32_t t);
+extern "C" void advance_time(uint32_t ms);
+
+#define HALF_ROWS ((MATRIX_ROWS) / 2)
+
+class SplitTransport : public ::testing::Test {
+   protected:
+    matrix_row_t master_matrix[HALF_ROWS];
+    matrix_row_t slave_matrix[HALF_ROWS];
+    matrix_row_t received_matrix[HALF_ROWS];
+    matrix_row_t slave_master_matrix[HALF_ROWS];
+
+    void SetUp() override {
+        set_time(0);
+        mock_transport_reset(MOCK_ORDER_RECEIVE_FIRST);
+        memset(master_matrix, 0, sizeof(master_matrix));
+        memset(slave_matrix, 0, sizeof(slave_matrix));
+        memset(received_matrix, 0, sizeof(received_matrix));
+        memset(slave_master_matrix, 0, sizeof(slave_master_matrix));
+        // Settle both halves, so every test starts from an agreed state
+        for (int i = 0; i < 3; i++) {
+            scan();
+        }
+    }
+
+    bool scan(void) {
+        advance_time(1);
+        mock_transport_select(MOCK_SIDE_SLAVE);
+        transactions_slave(slave_master_matrix, slave_matrix);
+        mock_transport_select(MOCK_SIDE_MASTER);
+        return transactions_master(master_matrix, received_matrix);
+    }
+
+    void expect_slave_state(layer_state_t layers, uint8_t mods, uint8_t leds) {
+        // Let the slave apply whatever the master sent during the last scan
+        mock_transport_select(MOCK_SIDE_SLAVE);
+        transactions_slave(slave_master_matrix, slave_matrix);
+        EXPECT_EQ(layer_state, layers);
+        EXPECT_EQ(get_mods(), mods);
+        EXPECT_EQ(mock_split_leds, leds);
+        mock_transport_select(MOCK_SIDE_MASTER);
+    }
+
+    void expect_matrix_received(int scan_index) {
+        for (int row = 0; row < HALF_ROWS; row++) {
+            EXPECT_EQ(received_matrix[row], slave_matrix[row]) << "row " << row << " on scan " << scan_index;
+        }
+    }
+
+    /*
+     * Typing on the slave half while the master changes layers, mods and host LEDs now and then. Never more than one
+     * slave row changes per scan, which is what real typing looks like.
+     */
+    void run_typing_scenario(int scans) {
+        for (int i = 0; i < scans; i++) {
+            slave_matrix[(i / 7) % HALF_ROWS] ^= (matrix_row_t)1 << (i % MATRIX_COLS);
+            if (i % 50 == 10) {
+                layer_state = (layer_state_t)1 << ((i / 50) % 4);
+            }
+            if (i % 20 == 5) {
+                set_mods(get_mods() ^ 0x02);
+            }
+            if (i % 200 == 100) {
+                mock_host_leds ^= 0x02;
+            }
+            ASSERT_TRUE(scan());
+            expect_matrix_received(i);
+        }
+        expect_slave_state(layer_state, get_mods(), mock_host_leds);
+    }
+};
+
+TEST_F(SplitTransport, ReplicatesTypingScenario) {
+    const int scans = 1000;
+
+    const mock_transport_stats_t before = *mock_transport_stats();
+    run_typing_scenario(scans);
+    const mock_transport_stats_t *after = mock_transport_stats();
+
+    uint32_t round_trips = after->round_trips - before.round_trips;
+    uint32_t bytes       = after->bytes - before.bytes;
+    RecordProperty("round_trips", round_trips);
+    RecordProperty("bytes", bytes);
+
+#ifdef SPLIT_TRANSPORT_BATCH
+    // Everything fits into one frame per scan, and the slave matrix delta comes back with it
+    EXPECT_EQ(round_trips, scans);
+#else
+    // At least the matrix checksum every scan, plus the matrix itself on every change
+    EXPECT_GE(round_trips, 2 * scans);
+#endif
+}
+
+TEST_F(SplitTransport, ReplicatesWithCallbackBeforeReceive) {
+    mock_transport_reset(MOCK_ORDER_CALLBACK_FIRST);
+    run_typing_scenario(500);
+    // The slave sees each frame one transaction late with this ordering, run one more scan to flush the last one
+    ASSERT_TRUE(scan());
+    expect_slave_state(layer_state, get_mods(), mock_host_leds);
+}
+
+TEST_F(SplitTransport, ReplicatesManyRowsChangingAtOnce) {
+    for (int i = 0; i < 10; i++) {
+        for (int row = 0; row < HALF_ROWS; row++) {
+            slave_matrix[row] = (matrix_row_t)(i * 37 + row * 11);
+        }
+        ASSERT_TRUE(scan());
+        expect_matrix_received(i);
+    }
+}
+
+TEST_F(SplitTransport, RecoversFromFailedTransaction) {
+    layer_state = 0x04;
+    set_mods(0x20);
+    slave_matrix[1] = 0x81;
+    mock_transport_fail_next(3);
+    ASSERT_TRUE(scan());
+    expect_matrix_received(0);
+    expect_slave_state(0x04, 0x20, 0);
+}
+
+#ifdef SPLIT_TRANSPORT_BATCH
+
+TEST_F(SplitTransport, BatchIdleScanUsesShortFrame) {
+    const mock_transport_stats_t before = *mock_transport_stats();
+    ASSERT_TRUE(scan());
+    const mock_transport_stats_t *after = mock_transport_stats();
+
+    EXPECT_EQ(after->round_trips - before.round_trips, 1);
+    EXPECT_EQ(after->bytes - before.bytes, 2 + SPLIT_BATCH_HEADER_SIZE + SPLIT_BATCH_SHORT_PAYLOAD + SPLIT_BATCH_RESPONSE_SIZE);
+}
+
+TEST_F(SplitTransport, BatchResyncsAfterCorruptResponse) {
+    slave_matrix[0] = 0x01;
+    mock_transport_corrupt_next_response();
+    ASSERT_TRUE(scan());
+
+    // The corrupt delta is dropped, and the full matrix is fetched on the next scan
+    slave_matrix[2] = 0x10;
+    ASSERT_TRUE(scan());
+    expect_matrix_received(1);
+
+    slave_matrix[3] = 0x40;
+    ASSERT_TRUE(scan());
+    expect_matrix_received(2);
+}
+
+#endif // SPLIT_TRANSPORT_BATCH
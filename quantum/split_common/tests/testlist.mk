@@ -0,0 +1,4 @@
+TEST_LIST += \
+	split_transport \
+	split_transport_batch \
+	split_stream
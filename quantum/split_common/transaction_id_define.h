@@ -16,6 +16,13 @@
 
 #pragma once
 
+// Also included from the C++ transport tests
+#ifdef __cplusplus
+#    define TRANSACTION_ID_STATIC_ASSERT static_assert
+#else
+#    define TRANSACTION_ID_STATIC_ASSERT _Static_assert
+#endif
+
 enum serial_transaction_id {
 #ifdef USE_I2C
     I2C_EXECUTE_CALLBACK,
@@ -24,6 +31,11 @@ enum serial_transaction_id {
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
 
+#ifdef SPLIT_TRANSPORT_BATCH
+    SYNC_BATCH_SHORT,
+    SYNC_BATCH_LONG,
+#endif // SPLIT_TRANSPORT_BATCH
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -122,4 +134,4 @@ enum serial_transaction_id {
 };
 
 // Ensure we only use 5 bits for transaction
-_Static_assert(NUM_TOTAL_TRANSACTIONS <= (1 << 5), "Max number of usable transactions exceeded");
+TRANSACTION_ID_STATIC_ASSERT(NUM_TOTAL_TRANSACTIONS <= (1 << 5), "Max number of usable transactions exceeded");
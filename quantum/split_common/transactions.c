@@ -84,7 +84,12 @@
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
+#ifdef SPLIT_TRANSPORT_BATCH
+static bool batch_write(int8_t id, const void *data, size_t length);
+#    define transport_write(id, data, length) batch_write(id, data, length)
+#else // SPLIT_TRANSPORT_BATCH
+#    define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
+#endif // SPLIT_TRANSPORT_BATCH
 #define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
 #define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
 
@@ -199,13 +204,219 @@ static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row
 }
 
 // clang-format off
-#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#ifdef SPLIT_TRANSPORT_BATCH
+// The slave matrix is delivered with the batch response instead, see below
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER()
+#else // SPLIT_TRANSPORT_BATCH
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#endif // SPLIT_TRANSPORT_BATCH
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
 // clang-format on
 
+////////////////////////////////////////////////////
+// Batched sync
+
+#ifdef SPLIT_TRANSPORT_BATCH
+
+/*
+ * Instead of one transaction per feature, plain master to slave writes are staged in the master's copy of the shared
+ * memory and marked dirty. Once per cycle all dirty fields are packed into a single frame, in transaction ID order:
+ *
+ *   [sequence | resync request] [dirty bits] [payload of each dirty transaction ...]
+ *
+ * The slave answers in the same round trip with the changes to its matrix since the previous response:
+ *
+ *   [resync flag | changed row count] [(row index, row value) ...] [crc8 of the resulting matrix]
+ *
+ * Frames with no more than SPLIT_BATCH_SHORT_PAYLOAD bytes of payload go out as SYNC_BATCH_SHORT, so idle cycles stay
+ * small on transports with fixed transaction sizes. If the delta doesn't fit or the master's copy fails the checksum,
+ * the full matrix is fetched with the regular matrix transactions.
+ */
+
+_Static_assert(SPLIT_BATCH_HEADER_SIZE + SPLIT_BATCH_LONG_PAYLOAD <= UINT8_MAX, "SPLIT_BATCH_LONG_PAYLOAD too large");
+_Static_assert(SPLIT_BATCH_SHORT_PAYLOAD <= SPLIT_BATCH_LONG_PAYLOAD, "SPLIT_BATCH_SHORT_PAYLOAD must not exceed SPLIT_BATCH_LONG_PAYLOAD");
+_Static_assert(SPLIT_BATCH_MATRIX_DELTA_ROWS < 0x80, "SPLIT_BATCH_MATRIX_DELTA_ROWS too large");
+
+#    define BATCH_SEQUENCE_MASK 0x7F
+#    define BATCH_RESYNC_FLAG 0x80
+
+static uint8_t batch_dirty[SPLIT_BATCH_MASK_SIZE] = {0};
+static uint8_t batch_payload_size                 = 0;
+static bool    batch_resync_requested             = true;
+
+static bool batch_is_eligible(int8_t id) {
+    const split_transaction_desc_t *trans = &split_transaction_table[id];
+#    if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+    // RPC request data has to arrive before its execute call
+    if (id == PUT_RPC_REQ_DATA) return false;
+#    endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+    return trans->slave_callback == NULL && trans->target2initiator_buffer_size == 0 && trans->initiator2target_buffer_size > 0;
+}
+
+static bool batch_write(int8_t id, const void *data, size_t length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    bool                      dirty = batch_dirty[id / 8] & (1 << (id % 8));
+
+    if (!batch_is_eligible(id) || (!dirty && batch_payload_size + trans->initiator2target_buffer_size > SPLIT_BATCH_LONG_PAYLOAD)) {
+        return transport_execute_transaction(id, data, length, NULL, 0);
+    }
+
+    size_t len = trans->initiator2target_buffer_size < length ? trans->initiator2target_buffer_size : length;
+    memcpy(split_trans_initiator2target_buffer(trans), data, len);
+    if (!dirty) {
+        batch_dirty[id / 8] |= (1 << (id % 8));
+        batch_payload_size += trans->initiator2target_buffer_size;
+    }
+    return true;
+}
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t      sequence                       = 0;
+    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0};
+    uint8_t             frame[sizeof_member(split_batch_sync_t, frame)];
+    uint8_t             response[SPLIT_BATCH_RESPONSE_SIZE];
+
+    // Every attempt gets a new sequence number, so the slave never mistakes changed contents for a repeat
+    sequence = (sequence + 1) & BATCH_SEQUENCE_MASK;
+    frame[0] = sequence | (batch_resync_requested ? BATCH_RESYNC_FLAG : 0);
+    memcpy(&frame[1], batch_dirty, SPLIT_BATCH_MASK_SIZE);
+
+    uint8_t *payload = &frame[SPLIT_BATCH_HEADER_SIZE];
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; ++id) {
+        if (batch_dirty[id / 8] & (1 << (id % 8))) {
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            memcpy(payload, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+            payload += trans->initiator2target_buffer_size;
+        }
+    }
+
+    int8_t id = batch_payload_size <= SPLIT_BATCH_SHORT_PAYLOAD ? SYNC_BATCH_SHORT : SYNC_BATCH_LONG;
+    memset(payload, 0, &frame[split_transaction_table[id].initiator2target_buffer_size] - payload);
+    if (!transport_execute_transaction(id, frame, split_transaction_table[id].initiator2target_buffer_size, response, sizeof(response))) {
+        return false;
+    }
+
+    // Frame delivered, everything staged so far is now on the slave
+    memset(batch_dirty, 0, sizeof(batch_dirty));
+    batch_payload_size = 0;
+
+    bool okay = true;
+    if (response[0] & BATCH_RESYNC_FLAG) {
+        okay = slave_matrix_handlers_master(master_matrix, slave_matrix);
+        if (okay) {
+            memcpy(last_matrix, slave_matrix, sizeof(last_matrix));
+        }
+        batch_resync_requested = !okay;
+        return okay;
+    }
+
+    matrix_row_t temp_matrix[(MATRIX_ROWS) / 2];
+    uint8_t      count = response[0];
+    memcpy(temp_matrix, last_matrix, sizeof(temp_matrix));
+    for (uint8_t i = 0; i < count && i < SPLIT_BATCH_MATRIX_DELTA_ROWS; ++i) {
+        const uint8_t *entry = &response[1 + i * (1 + sizeof(matrix_row_t))];
+        if (entry[0] < (MATRIX_ROWS) / 2) {
+            memcpy(&temp_matrix[entry[0]], &entry[1], sizeof(matrix_row_t));
+        }
+    }
+
+    if (count <= SPLIT_BATCH_MATRIX_DELTA_ROWS && response[SPLIT_BATCH_RESPONSE_SIZE - 1] == crc8(temp_matrix, sizeof(temp_matrix))) {
+        memcpy(last_matrix, temp_matrix, sizeof(last_matrix));
+        batch_resync_requested = false;
+    } else {
+        // Our copy has diverged from the slave's baseline, ask for the full matrix next cycle
+        batch_resync_requested = true;
+    }
+    // Copy out the last-known-good matrix state to the slave matrix
+    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    return okay;
+}
+
+static void batch_unpack_frame(void) {
+    static uint8_t last_sequence = 0xFF;
+    const uint8_t *frame         = split_shmem->batch.frame;
+
+    // Only unpack each frame once, so one-shot fields like rgblight change flags aren't replayed
+    uint8_t sequence = frame[0] & BATCH_SEQUENCE_MASK;
+    if (sequence == last_sequence) {
+        return;
+    }
+    last_sequence = sequence;
+
+    const uint8_t *payload = &frame[SPLIT_BATCH_HEADER_SIZE];
+    const uint8_t *end     = &frame[sizeof(split_shmem->batch.frame)];
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; ++id) {
+        if (frame[1 + id / 8] & (1 << (id % 8))) {
+            split_transaction_desc_t *trans = &split_transaction_table[id];
+            if (payload + trans->initiator2target_buffer_size > end) {
+                break;
+            }
+            memcpy(split_trans_initiator2target_buffer(trans), payload, trans->initiator2target_buffer_size);
+            payload += trans->initiator2target_buffer_size;
+        }
+    }
+}
+
+static void batch_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    static matrix_row_t baseline[(MATRIX_ROWS) / 2] = {0};
+    const matrix_row_t *current                     = split_shmem->smatrix.matrix;
+    uint8_t            *response                    = split_shmem->batch.response;
+
+    /*
+     * Unpack here rather than in the slave's main loop, so that a frame can't be overwritten by the next one before it
+     * was applied. Depending on the transport this is either the current frame or the previous one; either way every
+     * frame is unpacked exactly once, in order.
+     */
+    batch_unpack_frame();
+
+    bool    resync = split_shmem->batch.frame[0] & BATCH_RESYNC_FLAG;
+    uint8_t count  = 0;
+    memset(response, 0, SPLIT_BATCH_RESPONSE_SIZE);
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2 && !resync; ++row) {
+        if (current[row] != baseline[row]) {
+            if (count == SPLIT_BATCH_MATRIX_DELTA_ROWS) {
+                resync = true;
+                break;
+            }
+            uint8_t *entry = &response[1 + count * (1 + sizeof(matrix_row_t))];
+            entry[0]       = row;
+            memcpy(&entry[1], &current[row], sizeof(matrix_row_t));
+            ++count;
+        }
+    }
+
+    if (resync) {
+        // The master fetches the full matrix with GET_SLAVE_MATRIX_DATA
+        memset(response, 0, SPLIT_BATCH_RESPONSE_SIZE);
+        response[0] = BATCH_RESYNC_FLAG;
+        memcpy(baseline, current, sizeof(baseline));
+    } else {
+        response[0] = count;
+        for (uint8_t i = 0; i < count; ++i) {
+            const uint8_t *entry = &response[1 + i * (1 + sizeof(matrix_row_t))];
+            memcpy(&baseline[entry[0]], &entry[1], sizeof(matrix_row_t));
+        }
+    }
+    response[SPLIT_BATCH_RESPONSE_SIZE - 1] = crc8(baseline, sizeof(baseline));
+}
+
+// clang-format off
+#    define TRANSACTIONS_BATCH_MASTER() TRANSACTION_HANDLER_MASTER(batch)
+#    define TRANSACTIONS_BATCH_REGISTRATIONS \
+    [SYNC_BATCH_SHORT] = { SPLIT_BATCH_HEADER_SIZE + SPLIT_BATCH_SHORT_PAYLOAD, offsetof(split_shared_memory_t, batch.frame), SPLIT_BATCH_RESPONSE_SIZE, offsetof(split_shared_memory_t, batch.response), batch_slave_callback }, \
+    [SYNC_BATCH_LONG]  = { SPLIT_BATCH_HEADER_SIZE + SPLIT_BATCH_LONG_PAYLOAD, offsetof(split_shared_memory_t, batch.frame), SPLIT_BATCH_RESPONSE_SIZE, offsetof(split_shared_memory_t, batch.response), batch_slave_callback },
+// clang-format on
+
+#else // SPLIT_TRANSPORT_BATCH
+
+#    define TRANSACTIONS_BATCH_MASTER()
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSPORT_BATCH
+
 ////////////////////////////////////////////////////
 // Master matrix
 
@@ -921,6 +1132,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 
     // clang-format off
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
+    TRANSACTIONS_BATCH_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
     TRANSACTIONS_SYNC_TIMER_REGISTRATIONS
@@ -969,6 +1181,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_BATCH_MASTER();
     return true;
 }
 
@@ -89,6 +89,7 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 #else // USE_I2C
 
 #    include "serial.h"
+#    include "synchronization_util.h"
 
 static split_shared_memory_t shared_memory;
 split_shared_memory_t *const split_shmem = &shared_memory;
@@ -104,7 +105,10 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
+        // Streaming transports access the shared memory from their own thread
+        split_shared_memory_lock();
         memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+        split_shared_memory_unlock();
     }
 
     if (!soft_serial_transaction(id)) {
@@ -113,7 +117,9 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 
     if (target2initiator_length > 0) {
         size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+        split_shared_memory_lock();
         memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+        split_shared_memory_unlock();
     }
 
     return true;
@@ -22,6 +22,7 @@
 #include "progmem.h"
 #include "action_layer.h"
 #include "matrix.h"
+#include "transaction_id_define.h"
 
 #ifndef RPC_M2S_BUFFER_SIZE
 #    define RPC_M2S_BUFFER_SIZE 32
@@ -31,6 +32,26 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifdef SPLIT_TRANSPORT_BATCH
+#    ifndef SPLIT_BATCH_SHORT_PAYLOAD
+#        define SPLIT_BATCH_SHORT_PAYLOAD 8
+#    endif // SPLIT_BATCH_SHORT_PAYLOAD
+
+#    ifndef SPLIT_BATCH_LONG_PAYLOAD
+#        define SPLIT_BATCH_LONG_PAYLOAD 48
+#    endif // SPLIT_BATCH_LONG_PAYLOAD
+
+#    ifndef SPLIT_BATCH_MATRIX_DELTA_ROWS
+#        define SPLIT_BATCH_MATRIX_DELTA_ROWS 2
+#    endif // SPLIT_BATCH_MATRIX_DELTA_ROWS
+
+// Frame header: sequence/flags byte followed by one dirty bit per transaction ID
+#    define SPLIT_BATCH_MASK_SIZE ((NUM_TOTAL_TRANSACTIONS + 7) / 8)
+#    define SPLIT_BATCH_HEADER_SIZE (1 + SPLIT_BATCH_MASK_SIZE)
+// Response: delta header, changed rows as (index, value) pairs, checksum of the resulting matrix
+#    define SPLIT_BATCH_RESPONSE_SIZE (2 + (SPLIT_BATCH_MATRIX_DELTA_ROWS) * (1 + sizeof(matrix_row_t)))
+#endif // SPLIT_TRANSPORT_BATCH
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -57,6 +78,13 @@ typedef struct _split_slave_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
 
+#ifdef SPLIT_TRANSPORT_BATCH
+typedef struct _split_batch_sync_t {
+    uint8_t frame[SPLIT_BATCH_HEADER_SIZE + SPLIT_BATCH_LONG_PAYLOAD];
+    uint8_t response[SPLIT_BATCH_RESPONSE_SIZE];
+} split_batch_sync_t;
+#endif // SPLIT_TRANSPORT_BATCH
+
 #ifdef SPLIT_TRANSPORT_MIRROR
 typedef struct _split_master_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
@@ -153,6 +181,10 @@ typedef struct _split_shared_memory_t {
 
     split_slave_matrix_sync_t smatrix;
 
+#ifdef SPLIT_TRANSPORT_BATCH
+    split_batch_sync_t batch;
+#endif // SPLIT_TRANSPORT_BATCH
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
 #endif // SPLIT_TRANSPORT_MIRROR
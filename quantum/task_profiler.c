@@ -0,0 +1,316 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "task_profiler.h"
+#include "timer.h"
+#include "print.h"
+
+typedef struct task_profiler_stats_t {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint16_t histogram[TASK_PROFILER_BUCKETS];
+} task_profiler_stats_t;
+
+static task_profiler_stats_t task_stats[TASK_PROFILER_COUNT];
+
+static const char *const task_names[TASK_PROFILER_COUNT] = {
+    [TASK_PROFILER_KEYBOARD] = "keyboard",
+    [TASK_PROFILER_MATRIX]   = "matrix",
+#ifdef KEY_EVENT_QUEUE_ENABLE
+    [TASK_PROFILER_KEY_EVENT_QUEUE] = "key_event_queue",
+#endif
+#ifdef SPLIT_WATCHDOG_ENABLE
+    [TASK_PROFILER_SPLIT_WATCHDOG] = "split_watchdog",
+#endif
+#ifdef I2C_ASYNC_ENABLE
+    [TASK_PROFILER_I2C_ASYNC] = "i2c_async",
+#endif
+#ifdef RGBLIGHT_ENABLE
+    [TASK_PROFILER_RGBLIGHT] = "rgblight",
+#endif
+#ifdef LED_MATRIX_ENABLE
+    [TASK_PROFILER_LED_MATRIX] = "led_matrix",
+#endif
+#ifdef RGB_MATRIX_ENABLE
+    [TASK_PROFILER_RGB_MATRIX] = "rgb_matrix",
+#endif
+#ifdef BACKLIGHT_ENABLE
+    [TASK_PROFILER_BACKLIGHT] = "backlight",
+#endif
+#ifdef ENCODER_ENABLE
+    [TASK_PROFILER_ENCODER] = "encoder",
+#endif
+#ifdef POINTING_DEVICE_ENABLE
+    [TASK_PROFILER_POINTING_DEVICE] = "pointing",
+#endif
+#ifdef OLED_ENABLE
+    [TASK_PROFILER_OLED] = "oled",
+#endif
+#ifdef ST7565_ENABLE
+    [TASK_PROFILER_ST7565] = "st7565",
+#endif
+#ifdef MOUSEKEY_ENABLE
+    [TASK_PROFILER_MOUSEKEY] = "mousekey",
+#endif
+#ifdef PS2_MOUSE_ENABLE
+    [TASK_PROFILER_PS2_MOUSE] = "ps2_mouse",
+#endif
+#ifdef MIDI_ENABLE
+    [TASK_PROFILER_MIDI] = "midi",
+#endif
+#ifdef JOYSTICK_ENABLE
+    [TASK_PROFILER_JOYSTICK] = "joystick",
+#endif
+#ifdef BLUETOOTH_ENABLE
+    [TASK_PROFILER_BLUETOOTH] = "bluetooth",
+#endif
+#ifdef HAPTIC_ENABLE
+    [TASK_PROFILER_HAPTIC] = "haptic",
+#endif
+    [TASK_PROFILER_LED] = "led",
+#ifdef OS_DETECTION_ENABLE
+    [TASK_PROFILER_OS_DETECTION] = "os_detection",
+#endif
+#if defined(AUDIO_ENABLE) && !defined(NO_MUSIC_MODE)
+    [TASK_PROFILER_MUSIC] = "music",
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+    [TASK_PROFILER_KEY_OVERRIDE] = "key_override",
+#endif
+#ifdef SEQUENCER_ENABLE
+    [TASK_PROFILER_SEQUENCER] = "sequencer",
+#endif
+#ifdef TAP_DANCE_ENABLE
+    [TASK_PROFILER_TAP_DANCE] = "tap_dance",
+#endif
+#ifdef COMBO_ENABLE
+    [TASK_PROFILER_COMBO] = "combo",
+#endif
+#ifdef LEADER_ENABLE
+    [TASK_PROFILER_LEADER] = "leader",
+#endif
+#ifdef WPM_ENABLE
+    [TASK_PROFILER_WPM] = "wpm",
+#endif
+#ifdef DIP_SWITCH_ENABLE
+    [TASK_PROFILER_DIP_SWITCH] = "dip_switch",
+#endif
+#ifdef AUTO_SHIFT_ENABLE
+    [TASK_PROFILER_AUTO_SHIFT] = "auto_shift",
+#endif
+#ifdef CAPS_WORD_ENABLE
+    [TASK_PROFILER_CAPS_WORD] = "caps_word",
+#endif
+#ifdef SECURE_ENABLE
+    [TASK_PROFILER_SECURE] = "secure",
+#endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    [TASK_PROFILER_DYNAMIC_KEYMAP] = "dynamic_keymap",
+#endif
+#ifdef QUANTUM_PAINTER_ENABLE
+    [TASK_PROFILER_QUANTUM_PAINTER] = "quantum_painter",
+#endif
+#ifdef DEFERRED_EXEC_ENABLE
+    [TASK_PROFILER_DEFERRED_EXEC] = "deferred_exec",
+#endif
+#if defined(RGBLIGHT_WS2812) || defined(RGB_MATRIX_WS2812)
+    [TASK_PROFILER_WS2812_FLUSH] = "ws2812_flush",
+#endif
+    [TASK_PROFILER_HOUSEKEEPING] = "housekeeping",
+};
+
+/** \brief Fallback counter for platforms without a dedicated profiling clock
+ *
+ * Millisecond resolution only; platforms override this with a cycle accurate source.
+ */
+__attribute__((weak)) uint32_t task_profiler_ticks(void) {
+    return timer_read32();
+}
+
+__attribute__((weak)) uint32_t task_profiler_tick_frequency(void) {
+    return 1000;
+}
+
+/*
+ * Histogram buckets are log2 with one extra mantissa bit, so each power of two is split in two halves:
+ * 0, 1, 2, 3, 4-5, 6-7, 8-11, 12-15, 16-23, ... The last bucket collects everything above.
+ */
+static uint8_t bucket_index(uint32_t ticks) {
+    if (ticks < 4) {
+        return ticks;
+    }
+    uint8_t msb   = (sizeof(unsigned long) * 8 - 1) - __builtin_clzl(ticks);
+    uint8_t index = (msb << 1) | ((ticks >> (msb - 1)) & 1);
+    return index < TASK_PROFILER_BUCKETS ? index : TASK_PROFILER_BUCKETS - 1;
+}
+
+static uint32_t bucket_upper_bound(uint8_t index) {
+    if (index < 4) {
+        return index;
+    }
+    uint8_t  msb   = index >> 1;
+    uint32_t lower = (1UL << msb) | ((uint32_t)(index & 1) << (msb - 1));
+    return lower + (1UL << (msb - 1)) - 1;
+}
+
+void task_profiler_record(uint8_t task, uint32_t ticks) {
+    if (task >= TASK_PROFILER_COUNT) {
+        return;
+    }
+    task_profiler_stats_t *stats = &task_stats[task];
+
+    if (stats->count == 0 || ticks < stats->min) {
+        stats->min = ticks;
+    }
+    if (ticks > stats->max) {
+        stats->max = ticks;
+    }
+    if (stats->count < UINT32_MAX) {
+        stats->count++;
+        stats->sum += ticks;
+    }
+
+    uint16_t *bucket = &stats->histogram[bucket_index(ticks)];
+    if (*bucket == UINT16_MAX) {
+        // Age the whole histogram rather than saturate, which keeps the distribution shape intact
+        for (uint8_t i = 0; i < TASK_PROFILER_BUCKETS; i++) {
+            stats->histogram[i] >>= 1;
+        }
+    }
+    (*bucket)++;
+}
+
+void task_profiler_reset(void) {
+    memset(task_stats, 0, sizeof(task_stats));
+}
+
+const char *task_profiler_task_name(uint8_t task) {
+    if (task >= TASK_PROFILER_COUNT) {
+        return NULL;
+    }
+    return task_names[task];
+}
+
+bool task_profiler_get_summary(uint8_t task, task_profiler_summary_t *summary) {
+    if (task >= TASK_PROFILER_COUNT) {
+        return false;
+    }
+    const task_profiler_stats_t *stats = &task_stats[task];
+
+    memset(summary, 0, sizeof(task_profiler_summary_t));
+    if (stats->count == 0) {
+        return true;
+    }
+
+    summary->count = stats->count;
+    summary->min   = stats->min;
+    summary->max   = stats->max;
+    summary->avg   = (uint32_t)(stats->sum / stats->count);
+
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < TASK_PROFILER_BUCKETS; i++) {
+        total += stats->histogram[i];
+    }
+    uint32_t target     = total - total / 100;
+    uint32_t cumulative = 0;
+    summary->p99        = stats->max;
+    for (uint8_t i = 0; i < TASK_PROFILER_BUCKETS; i++) {
+        cumulative += stats->histogram[i];
+        if (cumulative >= target) {
+            uint32_t upper = bucket_upper_bound(i);
+            if (i < TASK_PROFILER_BUCKETS - 1 && upper < stats->max) {
+                summary->p99 = upper;
+            }
+            break;
+        }
+    }
+    if (summary->p99 < summary->min) {
+        summary->p99 = summary->min;
+    }
+    return true;
+}
+
+void task_profiler_print(void) {
+    xprintf("\n\t- Task profile (%lu Hz ticks) -\n", task_profiler_tick_frequency());
+    xprintf("%-16s %10s %10s %10s %10s %10s\n", "task", "count", "min", "avg", "max", "p99");
+    for (uint8_t i = 0; i < TASK_PROFILER_COUNT; i++) {
+        task_profiler_summary_t summary;
+        task_profiler_get_summary(i, &summary);
+        xprintf("%-16s %10lu %10lu %10lu %10lu %10lu\n", task_names[i], summary.count, summary.min, summary.avg, summary.max, summary.p99);
+    }
+}
+
+enum task_profiler_raw_hid_command {
+    task_profiler_raw_hid_get_info    = 0x01,
+    task_profiler_raw_hid_get_summary = 0x02,
+    task_profiler_raw_hid_reset       = 0x03,
+    task_profiler_raw_hid_unhandled   = 0xFF,
+};
+
+static void write_u32_be(uint8_t *data, uint32_t value) {
+    data[0] = (value >> 24) & 0xFF;
+    data[1] = (value >> 16) & 0xFF;
+    data[2] = (value >> 8) & 0xFF;
+    data[3] = value & 0xFF;
+}
+
+/** \brief Handles a task profiler query received over raw HID
+ *
+ * Request layout is { TASK_PROFILER_RAW_HID_COMMAND_ID, command, args... }, the response is written back in place
+ * with multi-byte values big-endian. Returns false if the packet is not addressed to the profiler, in which case
+ * data is left untouched; otherwise the caller is expected to send data back with raw_hid_send().
+ *
+ * get_info:    { id, 0x01 } -> { id, 0x01, task count, tick frequency (u32) }
+ * get_summary: { id, 0x02, task } -> { id, 0x02, task, count, min, avg, max, p99 (u32 each), name (truncated) }
+ * reset:       { id, 0x03 } -> { id, 0x03 }
+ */
+bool task_profiler_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 3 || data[0] != TASK_PROFILER_RAW_HID_COMMAND_ID) {
+        return false;
+    }
+
+    uint8_t *command_id   = &(data[1]);
+    uint8_t *command_data = &(data[2]);
+    uint8_t  data_length  = length - 2;
+
+    switch (*command_id) {
+        case task_profiler_raw_hid_get_info: {
+            if (data_length < 5) {
+                *command_id = task_profiler_raw_hid_unhandled;
+                break;
+            }
+            command_data[0] = TASK_PROFILER_COUNT;
+            write_u32_be(&command_data[1], task_profiler_tick_frequency());
+            break;
+        }
+        case task_profiler_raw_hid_get_summary: {
+            task_profiler_summary_t summary;
+            if (data_length < 21 || !task_profiler_get_summary(command_data[0], &summary)) {
+                *command_id = task_profiler_raw_hid_unhandled;
+                break;
+            }
+            write_u32_be(&command_data[1], summary.count);
+            write_u32_be(&command_data[5], summary.min);
+            write_u32_be(&command_data[9], summary.avg);
+            write_u32_be(&command_data[13], summary.max);
+            write_u32_be(&command_data[17], summary.p99);
+            if (data_length > 21) {
+                strncpy((char *)&command_data[21], task_names[command_data[0]], data_length - 21);
+                command_data[data_length - 1] = 0;
+            }
+            break;
+        }
+        case task_profiler_raw_hid_reset: {
+            task_profiler_reset();
+            break;
+        }
+        default: {
+            *command_id = task_profiler_raw_hid_unhandled;
+            break;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,178 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/*
+    Per-task timing statistics for the main loop.
+
+    Every task invoked from keyboard_task() and quantum_task() is wrapped with TASK_PROFILE(), which records the
+    elapsed platform ticks into a per-task min/avg/max and a log2 histogram used for the p99 estimate. Ticks are
+    CPU cycles on ChibiOS (DWT CYCCNT), timer0 counts on AVR and nanoseconds in the host test build.
+
+    When TASK_PROFILER_ENABLE is not defined TASK_PROFILE() reduces to the plain call.
+*/
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef TASK_PROFILER_ENABLE
+
+#    ifndef TASK_PROFILER_BUCKETS
+#        ifdef __AVR__
+#            define TASK_PROFILER_BUCKETS 32
+#        else
+#            define TASK_PROFILER_BUCKETS 48
+#        endif
+#    endif
+
+#    if TASK_PROFILER_BUCKETS < 8 || TASK_PROFILER_BUCKETS > 64
+#        error "TASK_PROFILER_BUCKETS must be between 8 and 64"
+#    endif
+
+#    ifndef TASK_PROFILER_RAW_HID_COMMAND_ID
+#        define TASK_PROFILER_RAW_HID_COMMAND_ID 0xF0
+#    endif
+
+enum task_profiler_task {
+    TASK_PROFILER_KEYBOARD = 0,
+    TASK_PROFILER_MATRIX,
+#    ifdef KEY_EVENT_QUEUE_ENABLE
+    TASK_PROFILER_KEY_EVENT_QUEUE,
+#    endif
+#    ifdef SPLIT_WATCHDOG_ENABLE
+    TASK_PROFILER_SPLIT_WATCHDOG,
+#    endif
+#    ifdef I2C_ASYNC_ENABLE
+    TASK_PROFILER_I2C_ASYNC,
+#    endif
+#    ifdef RGBLIGHT_ENABLE
+    TASK_PROFILER_RGBLIGHT,
+#    endif
+#    ifdef LED_MATRIX_ENABLE
+    TASK_PROFILER_LED_MATRIX,
+#    endif
+#    ifdef RGB_MATRIX_ENABLE
+    TASK_PROFILER_RGB_MATRIX,
+#    endif
+#    ifdef BACKLIGHT_ENABLE
+    TASK_PROFILER_BACKLIGHT,
+#    endif
+#    ifdef ENCODER_ENABLE
+    TASK_PROFILER_ENCODER,
+#    endif
+#    ifdef POINTING_DEVICE_ENABLE
+    TASK_PROFILER_POINTING_DEVICE,
+#    endif
+#    ifdef OLED_ENABLE
+    TASK_PROFILER_OLED,
+#    endif
+#    ifdef ST7565_ENABLE
+    TASK_PROFILER_ST7565,
+#    endif
+#    ifdef MOUSEKEY_ENABLE
+    TASK_PROFILER_MOUSEKEY,
+#    endif
+#    ifdef PS2_MOUSE_ENABLE
+    TASK_PROFILER_PS2_MOUSE,
+#    endif
+#    ifdef MIDI_ENABLE
+    TASK_PROFILER_MIDI,
+#    endif
+#    ifdef JOYSTICK_ENABLE
+    TASK_PROFILER_JOYSTICK,
+#    endif
+#    ifdef BLUETOOTH_ENABLE
+    TASK_PROFILER_BLUETOOTH,
+#    endif
+#    ifdef HAPTIC_ENABLE
+    TASK_PROFILER_HAPTIC,
+#    endif
+    TASK_PROFILER_LED,
+#    ifdef OS_DETECTION_ENABLE
+    TASK_PROFILER_OS_DETECTION,
+#    endif
+#    if defined(AUDIO_ENABLE) && !defined(NO_MUSIC_MODE)
+    TASK_PROFILER_MUSIC,
+#    endif
+#    ifdef KEY_OVERRIDE_ENABLE
+    TASK_PROFILER_KEY_OVERRIDE,
+#    endif
+#    ifdef SEQUENCER_ENABLE
+    TASK_PROFILER_SEQUENCER,
+#    endif
+#    ifdef TAP_DANCE_ENABLE
+    TASK_PROFILER_TAP_DANCE,
+#    endif
+#    ifdef COMBO_ENABLE
+    TASK_PROFILER_COMBO,
+#    endif
+#    ifdef LEADER_ENABLE
+    TASK_PROFILER_LEADER,
+#    endif
+#    ifdef WPM_ENABLE
+    TASK_PROFILER_WPM,
+#    endif
+#    ifdef DIP_SWITCH_ENABLE
+    TASK_PROFILER_DIP_SWITCH,
+#    endif
+#    ifdef AUTO_SHIFT_ENABLE
+    TASK_PROFILER_AUTO_SHIFT,
+#    endif
+#    ifdef CAPS_WORD_ENABLE
+    TASK_PROFILER_CAPS_WORD,
+#    endif
+#    ifdef SECURE_ENABLE
+    TASK_PROFILER_SECURE,
+#    endif
+#    ifdef DYNAMIC_KEYMAP_ENABLE
+    TASK_PROFILER_DYNAMIC_KEYMAP,
+#    endif
+#    ifdef QUANTUM_PAINTER_ENABLE
+    TASK_PROFILER_QUANTUM_PAINTER,
+#    endif
+#    ifdef DEFERRED_EXEC_ENABLE
+    TASK_PROFILER_DEFERRED_EXEC,
+#    endif
+#    if defined(RGBLIGHT_WS2812) || defined(RGB_MATRIX_WS2812)
+    TASK_PROFILER_WS2812_FLUSH,
+#    endif
+    TASK_PROFILER_HOUSEKEEPING,
+    TASK_PROFILER_COUNT,
+};
+
+typedef struct task_profiler_summary_t {
+    uint32_t count;
+    uint32_t min;
+    uint32_t avg;
+    uint32_t max;
+    uint32_t p99;
+} task_profiler_summary_t;
+
+/** \brief Reads the free running profiling counter, provided by the platform. */
+uint32_t task_profiler_ticks(void);
+
+/** \brief Frequency of task_profiler_ticks() in Hz, or 0 if unknown. */
+uint32_t task_profiler_tick_frequency(void);
+
+void        task_profiler_record(uint8_t task, uint32_t ticks);
+void        task_profiler_reset(void);
+bool        task_profiler_get_summary(uint8_t task, task_profiler_summary_t *summary);
+const char *task_profiler_task_name(uint8_t task);
+void        task_profiler_print(void);
+bool        task_profiler_raw_hid_receive(uint8_t *data, uint8_t length);
+
+#    define TASK_PROFILE(task, call)                                                                 \
+        do {                                                                                         \
+            uint32_t task_profile_start_ = task_profiler_ticks();                                    \
+            call;                                                                                    \
+            task_profiler_record(TASK_PROFILER_##task, task_profiler_ticks() - task_profile_start_); \
+        } while (0)
+
+#else
+
+#    define TASK_PROFILE(task, call) \
+        do {                         \
+            call;                    \
+        } while (0)
+
+#endif
@@ -0,0 +1,2060 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Generated from autocorrect_dict.txt, the reference model matches typed keys against these rather than the trie.
+
+#pragma once
+
+static const struct {
+    const char *typo;
+    const char *correction;
+} autocorrect_benchmark_entries[] = {
+    {"ykcoqrz", "kycoqrz"},
+    {"itisfx:", "tiisfx"},
+    {"ucdszht", "udcszht"},
+    {"cxvdvpacrd", "cxdvvpacrd"},
+    {":sbbkrwdjds", "bsbkrwdjds"},
+    {"hqxppqnqg", "qhxppqnqg"},
+    {"svgxgaeqd", "svggxaeqd"},
+    {"abllwog", "ballwog"},
+    {"htegqt", "thegqt"},
+    {"svgqnmft", "svgnqmft"},
+    {"uimpzkcahh", "iumpzkcahh"},
+    {"rkxeimpbyr", "rkxeimbpyr"},
+    {":mqzhldroh", "mqhzldroh"},
+    {":gefztbbst", "gefztbsbt"},
+    {"xtitmikmyr", "xtitmimkyr"},
+    {"sfsvkt", "sfsvtk"},
+    {"vqkyxb", "vqkxyb"},
+    {"gewhuws", "gehwuws"},
+    {"ieikjo:", "eiikjo"},
+    {":aehxqtvbbs", "ahexqtvbbs"},
+    {"qxyixidemt", "qxyixiedmt"},
+    {"xevgrmx", "xvegrmx"},
+    {":texysua", "texsyua"},
+    {"bdlfqdlsj", "bdlqfdlsj"},
+    {"ldunoapxsv", "lduonapxsv"},
+    {"idtekjv", "idtejkv"},
+    {"fadzmwt", "fadzmtw"},
+    {"ierwxdo", "ierwxod"},
+    {":madqlzz", "mdaqlzz"},
+    {":ojasov", "joasov"},
+    {"olfmazfjbo", "olfmzafjbo"},
+    {"jcnjpitax", "jcnjiptax"},
+    {"zikegnuyrh", "zikegnyurh"},
+    {"uetogcyptr", "uetogcpytr"},
+    {"njenqzfho", "njenqfzho"},
+    {"hbamnyem", "hbanmyem"},
+    {"lqaqpgge:", "lqqapgge"},
+    {"zldqua", "zdlqua"},
+    {"krhmaaya:", "rkhmaaya"},
+    {"esmixk", "esimxk"},
+    {"ojyfqgagvr", "ojyfqgavgr"},
+    {"kqgjqyxuw", "kqjgqyxuw"},
+    {"tetbfaadh", "ttebfaadh"},
+    {"lubqcu", "lubquc"},
+    {":eoouvccy", "oeouvccy"},
+    {":haogiok", "hagoiok"},
+    {"dhsymq:", "dhsmyq"},
+    {"umoepvwtla", "uomepvwtla"},
+    {"vsdafhzedg", "vsdafhzdeg"},
+    {"vjtgpucor", "vjtgpuocr"},
+    {"awcdoqk", "awcdokq"},
+    {"cbucsv", "cubcsv"},
+    {"ygnbomwhpr", "ygnbomwphr"},
+    {"dwifmvmlww", "dwfimvmlww"},
+    {"gkbzuyb:", "kgbzuyb"},
+    {"ieybll", "eiybll"},
+    {"lomacvwqfw:", "lomacvwqwf"},
+    {"jypobt", "jypbot"},
+    {"lysvjtcf", "lysvjtfc"},
+    {"dajbgntr", "dajbgnrt"},
+    {"nimfweedm", "nimwfeedm"},
+    {"kjzycf", "kjyzcf"},
+    {"jtzria", "jtzira"},
+    {"tvzzrj", "tvzzjr"},
+    {"cshynf", "cshnyf"},
+    {":kvxqtmb", "kvxqtbm"},
+    {"ppozzk", "ppozkz"},
+    {":utzphijdtl", "uztphijdtl"},
+    {"duomocy", "duomoyc"},
+    {"hoygvayg:", "hoygvagy"},
+    {":nlfexixf", "nlefxixf"},
+    {":nodfrq", "nodrfq"},
+    {"yldcvje", "yldvcje"},
+    {"tgfdyufbwh:", "tgdfyufbwh"},
+    {"azhcgghrbv", "azhcggrhbv"},
+    {"tkppxqw", "tpkpxqw"},
+    {"bpphgfzm", "bppghfzm"},
+    {"merpqhrmgj", "merpqhrmjg"},
+    {"hxnbbok", "hnxbbok"},
+    {":veogtugca", "evogtugca"},
+    {":tswnrn", "tswnnr"},
+    {"rqcyinbrm", "rqcyinbmr"},
+    {"iyrpssn", "iyrpsns"},
+    {"jikomdgj", "jikomdjg"},
+    {"meydke", "medyke"},
+    {"avfdyq", "avdfyq"},
+    {"exqnfamgj", "exqnfagmj"},
+    {"sirlnibla", "silrnibla"},
+    {":nfbldrklv", "nfblrdklv"},
+    {"bkmvjap", "bkmjvap"},
+    {"qicngp", "qicgnp"},
+    {"myftvsev", "mfytvsev"},
+    {"uzcsifqlc", "uzcsiqflc"},
+    {":musyiewgb", "musiyewgb"},
+    {"dkeaag", "dekaag"},
+    {"rqbzrnaql", "rqbzrnalq"},
+    {":fnesricg", "fnesrigc"},
+    {"cvaipgia", "cvaipgai"},
+    {"ozaebv", "zoaebv"},
+    {"jtgcmyahek", "jtgcmyhaek"},
+    {"rgqhftml", "grqhftml"},
+    {"qavkmzq", "aqvkmzq"},
+    {":leizxf", "liezxf"},
+    {"qbuwkjrf:", "bquwkjrf"},
+    {"tiqqsastm", "tiqqssatm"},
+    {"xulcnd", "xlucnd"},
+    {"srpbmj", "srpbjm"},
+    {"xbwputf", "xbwptuf"},
+    {"qfqiwkdbw", "qfqiwkdwb"},
+    {"iczxpsnf", "iczxpnsf"},
+    {"dfypowijs:", "dfyopwijs"},
+    {":mfyebsol", "mfyebosl"},
+    {"sdsfhw", "ssdfhw"},
+    {"tbevyo", "tbveyo"},
+    {"mlrqfkom", "mlqrfkom"},
+    {":tpnpuifcvs", "ptnpuifcvs"},
+    {"txtnovl", "txtnolv"},
+    {"otvfdla:", "ovtfdla"},
+    {":zckcpdlg", "zkccpdlg"},
+    {":krhofvcf", "krhofcvf"},
+    {"zgorpcimud", "zgorpcimdu"},
+    {"dropauy", "drpoauy"},
+    {"pswlmvi", "pslwmvi"},
+    {"qeehhwgby:", "qeehhwgyb"},
+    {"uhlpewew", "uhplewew"},
+    {":sleepk", "slepek"},
+    {"achnitpck", "acnhitpck"},
+    {":uiwguug", "iuwguug"},
+    {"xrsnrv", "xrnsrv"},
+    {":dysiia", "ydsiia"},
+    {"nygyqlrg", "nygyqlgr"},
+    {":oekikgdvs", "oekkigdvs"},
+    {"joviuo", "ojviuo"},
+    {"catfjv", "ctafjv"},
+    {"axarkzamic", "aaxrkzamic"},
+    {":aqvbdoj", "aqvbodj"},
+    {"rmdqvol", "rdmqvol"},
+    {"zviypmewh", "zvipymewh"},
+    {"yodudhbpb", "yoduhdbpb"},
+    {"kxjsmpgnts", "kjxsmpgnts"},
+    {"lmmxpijp", "lmmxpipj"},
+    {"wdgtpbue", "wgdtpbue"},
+    {"ghusps", "hgusps"},
+    {"tbmcrq", "tbmrcq"},
+    {":kejsntkp", "kesjntkp"},
+    {"sqembyb", "sqmebyb"},
+    {"dmcdctgt", "dmcdcttg"},
+    {"ginqnd", "ginqdn"},
+    {":eflqozfbp", "efloqzfbp"},
+    {"porogcutnh", "porogcunth"},
+    {"nhpvhzf", "nhphvzf"},
+    {"lxejztzmbp", "lxejztzmpb"},
+    {":skbkdivou", "skkbdivou"},
+    {"lyhczxb", "lyhcxzb"},
+    {":dhpbsy", "dphbsy"},
+    {"wlkaijj", "wlakijj"},
+    {"zspkhk", "zsphkk"},
+    {"vvapyswixg", "vvapyswigx"},
+    {":mpggdbxs", "mpggbdxs"},
+    {"ovwcnl", "vowcnl"},
+    {"zyucrfi", "zycurfi"},
+    {":ipnpbe", "ippnbe"},
+    {"lfwtfkqa", "lwftfkqa"},
+    {":iptsnqszp", "itpsnqszp"},
+    {"vhokoaosxz:", "vhokoaoxsz"},
+    {"guekovqej", "geukovqej"},
+    {"jizlybtuk", "jizlytbuk"},
+    {"dcvxifysqx", "dcxvifysqx"},
+    {"lnjeqpbsyl", "lnjeqpbsly"},
+    {"dngsrarg", "dngsarrg"},
+    {"wtoywy", "wtoyyw"},
+    {":ugcgcs", "gucgcs"},
+    {":vfyulq", "vfuylq"},
+    {"waxkaklss", "waxkkalss"},
+    {"ayrwerxqp", "ayrwexrqp"},
+    {"gcicvi", "gccivi"},
+    {"iaxltt", "ixaltt"},
+    {"qexicpi", "eqxicpi"},
+    {"ttqmya", "tqtmya"},
+    {":ozobavk", "ozoabvk"},
+    {"knfewuxm", "knefwuxm"},
+    {"crtusgoo", "crtusogo"},
+    {":rumsuoi", "rumsuio"},
+    {"vahwhd", "avhwhd"},
+    {"yjspkrao", "jyspkrao"},
+    {"szbayuvg", "sbzayuvg"},
+    {"zajazw:", "zjaazw"},
+    {":hipnfoarpb", "hipnfoarbp"},
+    {"ijlmhbojqt:", "ijlmhbjoqt"},
+    {"kqddvggst", "kqddvgsgt"},
+    {"yrdpldtl:", "ydrpldtl"},
+    {"lydleo", "yldleo"},
+    {":cnwedql", "cwnedql"},
+    {"bvqlic", "bvlqic"},
+    {":pvrzlxfxw", "pvrlzxfxw"},
+    {"sawsfs", "saswfs"},
+    {"vyzdgqa", "vzydgqa"},
+    {"isvldgbgof:", "ivsldgbgof"},
+    {"pwvugrahx", "wpvugrahx"},
+    {":btzvfqfqef", "btzvfqqfef"},
+    {"llkbtlyrn", "llkbtlynr"},
+    {"zihnoxphy", "zihonxphy"},
+    {"urqbye", "uqrbye"},
+    {":ihtxywy", "ihxtywy"},
+    {"zrtgonat", "zrtgnoat"},
+    {"oiukruxftv", "oiukurxftv"},
+    {"kgzswyuqdg", "gkzswyuqdg"},
+    {"cztcxlyhwk:", "cztclxyhwk"},
+    {"sbrkcic", "sbrkicc"},
+    {"hpfbeyldkn", "phfbeyldkn"},
+    {"smxmevj", "smmxevj"},
+    {":jjrmpxy", "jjrmpyx"},
+    {"yibqoj", "yibqjo"},
+    {"ggoqgvue", "ggoqguve"},
+    {"khxcaxus", "khxacxus"},
+    {":qgadazpsvp", "qgadazpspv"},
+    {"rzajxjkige", "rzaxjjkige"},
+    {"pxecduid", "pxecdudi"},
+    {"iaazqkcdx", "iaazqkdcx"},
+    {"vnizagtc", "vnizatgc"},
+    {"rpaooq:", "rpaoqo"},
+    {"cwovpqkvff", "cwovpqvkff"},
+    {"lshcxo", "lhscxo"},
+    {"ekjcee", "kejcee"},
+    {"bhnnthvtx:", "bhnnhtvtx"},
+    {"vtszwpzzyv", "vtswzpzzyv"},
+    {":qcpgsmtux", "qcgpsmtux"},
+    {":zmwzcyw", "zwmzcyw"},
+    {":ttuqzhat", "ttuqzaht"},
+    {"fbnjdeucfz", "fbnjeducfz"},
+    {"oydrrsspja", "odyrrsspja"},
+    {"qywestybqp", "qywestybpq"},
+    {":cenyolfvy", "cneyolfvy"},
+    {"jyhofjoaz", "jyhofjaoz"},
+    {"gauuyscv", "guauyscv"},
+    {"usodewnvfw", "suodewnvfw"},
+    {"ipmhdl", "pimhdl"},
+    {"qpwvlsr", "qpwlvsr"},
+    {"bessbcuuu", "besbscuuu"},
+    {"gcwgigre", "gcgwigre"},
+    {"dwyiuuvvj", "wdyiuuvvj"},
+    {"gcldrih:", "cgldrih"},
+    {"ukmemwpdbg", "ukmemwpdgb"},
+    {"qswiyy", "sqwiyy"},
+    {"uqylcghn", "quylcghn"},
+    {"kcqlaop", "kcqalop"},
+    {":gszfaevtuv", "gszafevtuv"},
+    {"qmalzmt:", "mqalzmt"},
+    {":rgxgsdp", "rgxgdsp"},
+    {"qpbzgjin", "qpbzgijn"},
+    {"gkkoavmdqu", "gkkoamvdqu"},
+    {"hrqwzoqy", "hrqwzoyq"},
+    {"unxbavczti", "unxbacvzti"},
+    {"kdhscosxa", "kdhsocsxa"},
+    {":lygnhdgr", "lygnhdrg"},
+    {":iuqdewiq", "iuqedwiq"},
+    {"ccwwlf", "ccwwfl"},
+    {"qnkqdxlub", "qknqdxlub"},
+    {"akekxrjt", "akkexrjt"},
+    {"clgckepsu", "clgckepus"},
+    {"bxxtdsyap", "bxxtdysap"},
+    {"zlvdtnii", "zvldtnii"},
+    {":grqcuqhkw", "grqcquhkw"},
+    {"evwlyz", "vewlyz"},
+    {":raqpmalwm", "rqapmalwm"},
+    {"kczoeays", "kczoeyas"},
+    {":asxnnaqukj", "asxnnqaukj"},
+    {"muqgycahg", "muqgyachg"},
+    {"sjuyqabc", "sjuqyabc"},
+    {"uzbfvz", "zubfvz"},
+    {":sjhnlomx", "sjhnolmx"},
+    {"gfiyeckwba", "fgiyeckwba"},
+    {"wnlqpl", "nwlqpl"},
+    {"lpnfpcnckm", "lnpfpcnckm"},
+    {"xoldan:", "xodlan"},
+    {"wpzyfzp", "wpzfyzp"},
+    {"rywmgn", "rywmng"},
+    {"rkfooo", "rkofoo"},
+    {"wzmohezw", "wmzohezw"},
+    {"yirmlkwn", "yirmklwn"},
+    {"gxedidzo", "gxdeidzo"},
+    {"soptsar", "soptsra"},
+    {":nomjgbfja", "nmojgbfja"},
+    {"yyrxzljhl", "yyrxlzjhl"},
+    {":psusfle", "psusfel"},
+    {"lkvvli", "klvvli"},
+    {"ukdqnlik", "ukdqnilk"},
+    {"hompaxdf", "hmopaxdf"},
+    {"irpfoxecqz", "irpofxecqz"},
+    {"mxblvou", "mxblovu"},
+    {"frkdkg", "frkdgk"},
+    {"rahymv", "rahmyv"},
+    {"xhpmrjj", "xhpmjrj"},
+    {"imijyv", "miijyv"},
+    {"tcsmrzspbw", "tcsmrzsbpw"},
+    {"qnqloobswd", "qqnloobswd"},
+    {"hilgukdoxn", "hilugkdoxn"},
+    {"hyifrorsul", "hyifrosrul"},
+    {"mqhnukmhk", "mqhnumkhk"},
+    {":skytjph", "syktjph"},
+    {"gmpiwjgw", "gmipwjgw"},
+    {"hkavtxity", "hkavtxiyt"},
+    {"rpbapzlrp", "rpbapzrlp"},
+    {"hirkhva", "ihrkhva"},
+    {"iiutvysr", "iuitvysr"},
+    {"aaflzcxilp", "aafzlcxilp"},
+    {"qvlsxmw", "qvlxsmw"},
+    {":qyxrwzuqra", "qyxwrzuqra"},
+    {"myglrlig", "mygrllig"},
+    {"kavkvh", "kvakvh"},
+    {"urcrfruycd:", "urcrfruydc"},
+    {"adkhfhfu", "adkfhhfu"},
+    {"qqprgj", "qqpgrj"},
+    {"vkxgxd", "kvxgxd"},
+    {"lomytnf", "lomyntf"},
+    {"stgpoeci", "stgopeci"},
+    {"idzdgy", "idzgdy"},
+    {":bhdzmgu", "bhdmzgu"},
+    {"ixohnfcxj", "ixohnfcjx"},
+    {":mrfsetqucn", "mrfsetqunc"},
+    {":osdyrzwt", "osydrzwt"},
+    {"oqwqksy", "oqwqsky"},
+    {"nhekknm", "nheknkm"},
+    {"vgvudisis", "vgvudsiis"},
+    {"eylmxpygrf", "elymxpygrf"},
+    {"hmqslgyji", "hmqslgjyi"},
+    {"gshzaqjzd", "gshzajqzd"},
+    {"hdvxqdcbwp", "hdvxqdcwbp"},
+    {":icctean", "icctena"},
+    {"lcplcnel", "clplcnel"},
+    {"tfhjpcbc:", "tfhjpccb"},
+    {"bikvwtcl", "bikwvtcl"},
+    {"qxeljdgawn", "qxejldgawn"},
+    {"duhscpj", "dushcpj"},
+    {":qfqgfo", "qfgqfo"},
+    {"qfljjxbf", "fqljjxbf"},
+    {"tdncbrsqrc:", "tdncrbsqrc"},
+    {":fhmprt", "fhmptr"},
+    {"wgecjbbuo", "wgecjbubo"},
+    {"npptfkm", "nppftkm"},
+    {":rcecitobqr", "crecitobqr"},
+    {":wprflp", "wprlfp"},
+    {"uytipeq:", "uytpieq"},
+    {"vnkyuvhny", "vnykuvhny"},
+    {"fsuhzdty:", "fsuzhdty"},
+    {"owuxdxxs", "owudxxxs"},
+    {"fgxpqn", "fgxqpn"},
+    {"fbqmxjs", "fbqxmjs"},
+    {"vxnvgpdptz", "vxnvgpdtpz"},
+    {"bnxgawkge", "bxngawkge"},
+    {":oosnsk", "osonsk"},
+    {"gfytalmxe", "gyftalmxe"},
+    {"tvcbxtekgt", "tvcbxtegkt"},
+    {"rtlvnay", "rtlvany"},
+    {"qdyuyplzd", "dqyuyplzd"},
+    {"aowabtfep", "aowabtefp"},
+    {"prbacklysp", "prbacklsyp"},
+    {"rrmpsaazyt", "rrmpasazyt"},
+    {"vogilz", "voiglz"},
+    {"ulthntzrw", "luthntzrw"},
+    {":qokuktyw", "qokuktwy"},
+    {":szjkhiha", "szkjhiha"},
+    {"laupjlly:", "lapujlly"},
+    {"hkwotcifj:", "hkwtocifj"},
+    {"jdggoeq", "jdggoqe"},
+    {":ktjwwx", "kjtwwx"},
+    {":vwgwnmghzy", "vwgwmnghzy"},
+    {":dssyqfh", "sdsyqfh"},
+    {"cudjskjlwc", "cudsjkjlwc"},
+    {"gzeomrjvy", "gzeomrjyv"},
+    {"gbgtgsd", "ggbtgsd"},
+    {"lkzcdqwz", "klzcdqwz"},
+    {"oymkypxc", "oymykpxc"},
+    {"hdwktfngfs", "dhwktfngfs"},
+    {"spudhuw", "spuduhw"},
+    {"umpahco", "mupahco"},
+    {"olfkojx", "oflkojx"},
+    {":vubasixrob", "vubasixorb"},
+    {"txhtslfs", "txhtlsfs"},
+    {"mzpvatyvcr", "mzpavtyvcr"},
+    {":jgasihz", "jagsihz"},
+    {"lcsscqucsz", "lcscsqucsz"},
+    {":frecff", "frceff"},
+    {"oxawhe", "oxahwe"},
+    {"vgisxf", "vgsixf"},
+    {":hdyaqdl", "dhyaqdl"},
+    {"eqskce", "esqkce"},
+    {"ceeplpfzd", "ceeplpfdz"},
+    {"ifbohq", "ifbhoq"},
+    {":mqkshqhdwj", "mqskhqhdwj"},
+    {"mlsfvlmfj", "mslfvlmfj"},
+    {"vzoplqvnsz", "vozplqvnsz"},
+    {"iuttpzip", "iuttzpip"},
+    {"pxgogo", "pxoggo"},
+    {"vjtqegmnk", "vjtqegmkn"},
+    {"mjryxbfi", "mjryxbif"},
+    {"wpxcxeii", "wpxcxiei"},
+    {":nhagdphkx", "nahgdphkx"},
+    {":hseoeir", "sheoeir"},
+    {":xkixms", "kxixms"},
+    {"nuydzp", "nuydpz"},
+    {"fzvmsxc", "fzvmxsc"},
+    {"tmskwbj", "tmswkbj"},
+    {"dlbmkmfohg", "ldbmkmfohg"},
+    {"bvunwrmcgf:", "bvunwrmcfg"},
+    {"wuxzvvuzwf", "wuzxvvuzwf"},
+    {"rvzctxdr", "vrzctxdr"},
+    {":wkzwqbnsl", "kwzwqbnsl"},
+    {"qlgslc", "lqgslc"},
+    {"pgwkmkogyp", "pgkwmkogyp"},
+    {"ilswrptv", "islwrptv"},
+    {":zomcrp", "zomcpr"},
+    {"mlfjvgrdy", "mlfjvgryd"},
+    {"ufafsodqu", "uaffsodqu"},
+    {"gznyfqp", "gzynfqp"},
+    {":pacrikgo", "pacrikog"},
+    {"kirrxsdy", "kirrxdsy"},
+    {"cpmelduk", "cpmeludk"},
+    {"npbqgdeix", "npqbgdeix"},
+    {"mdndlvf", "dmndlvf"},
+    {"bewvggafvl", "bewvggaflv"},
+    {"erizrby", "erizryb"},
+    {"jjbfir:", "jjbfri"},
+    {":ymbypje", "ymbpyje"},
+    {"schsnz", "cshsnz"},
+    {"scjjebvui", "csjjebvui"},
+    {"xvdutmyoi:", "xvdumtyoi"},
+    {":ktyuuozo", "tkyuuozo"},
+    {"wqiixb", "wiqixb"},
+    {"jxezsnu", "xjezsnu"},
+    {"pdncobm", "pdncbom"},
+    {"qxrghwocfx", "qxrghwocxf"},
+    {":xfbobxfqt", "xfbobxqft"},
+    {"msdohr", "mdsohr"},
+    {"wcapbqbwzb", "wacpbqbwzb"},
+    {"kcidllwb:", "kcidllbw"},
+    {"bwqirzjilg:", "bwqirzjlig"},
+    {"bhfwgzd", "bfhwgzd"},
+    {"oprkojmq", "orpkojmq"},
+    {"rpmrcftszz", "rmprcftszz"},
+    {"eikokqcx", "eikokqxc"},
+    {"kotgcx", "kotcgx"},
+    {"hmlblpo", "hmlblop"},
+    {":vjridcevz", "vjirdcevz"},
+    {"qdnbubsohg", "qdnbbusohg"},
+    {"xyxzkbignm", "xyxzkbginm"},
+    {"bqfireyoq", "bqfireyqo"},
+    {":xdzyjuxk", "xzdyjuxk"},
+    {"pisrzc", "ipsrzc"},
+    {"xepspeoqzq", "xesppeoqzq"},
+    {"zstzgwmx", "sztzgwmx"},
+    {"heapgnn", "heapngn"},
+    {"upyhom", "uphyom"},
+    {"ktqybn", "ktqbyn"},
+    {"javornowx", "ajvornowx"},
+    {"bqjpnjika", "bqjpnijka"},
+    {"ptmrufi", "ptmurfi"},
+    {"ssyanxuse", "ssaynxuse"},
+    {"rtevmvu:", "retvmvu"},
+    {"gpobhng", "gpobhgn"},
+    {":grbnnqxcpd", "grbnnxqcpd"},
+    {"xjhnjtqb", "xjhnjtbq"},
+    {"zyojwdu:", "zyojdwu"},
+    {"tjoezeylj", "tjozeeylj"},
+    {":xgoshglzeg", "xgoshgzleg"},
+    {":hwuekloz", "hwuekolz"},
+    {"pdjzwogym", "pdjzwgoym"},
+    {"pxzeuw", "pxezuw"},
+    {"nfamea", "nfamae"},
+    {"hxynenii", "hyxnenii"},
+    {"xcegqpnjd", "xcegqpndj"},
+    {"zeaczi", "zecazi"},
+    {"nwqbpaqy:", "nwqpbaqy"},
+    {"jzkkeb", "jzkkbe"},
+    {"qijemqar", "qiejmqar"},
+    {"qjpttfj", "jqpttfj"},
+    {"sbfbvi:", "sbbfvi"},
+    {"lwkwvzzkki", "lwkwvzzkik"},
+    {"xfmdsfas:", "xfmdsfsa"},
+    {"apopqq", "appoqq"},
+    {"dfydrycb", "dyfdrycb"},
+    {"bpgoik", "bgpoik"},
+    {"hgzqtket", "hgqztket"},
+    {"lqcrpcowkd", "lqcrpcwokd"},
+    {"nyejmhqduh", "ynejmhqduh"},
+    {"yqnqph", "yqnpqh"},
+    {"pdaoqcthxl", "pdaoqctxhl"},
+    {"cpuemaqjxj", "cpuemaqxjj"},
+    {"icehrndsmv", "icehnrdsmv"},
+    {"ronewojnf", "roneowjnf"},
+    {"hvhqgguhna", "hvhqgughna"},
+    {":tdxodyj", "txdodyj"},
+    {":xpxeiqdq", "xpxieqdq"},
+    {"ctvxsrl", "ctvxrsl"},
+    {"tbwulvexnq", "tbwulevxnq"},
+    {"zwcuqw", "wzcuqw"},
+    {"qqvaup", "qvqaup"},
+    {":remxssf", "remxsfs"},
+    {"owwonouap", "owwoonuap"},
+    {"wxfqchu", "wxfqcuh"},
+    {"hodrjfeppf", "hodrjfpepf"},
+    {":irjexzqesk", "irejxzqesk"},
+    {"wzlvtrni", "wlzvtrni"},
+    {"zdkjcyk", "zdjkcyk"},
+    {"uppqwlt:", "uppqwtl"},
+    {"hafhuaokfz:", "hafhuakofz"},
+    {":kekpuvxo", "kekpvuxo"},
+    {"jxbwobf", "xjbwobf"},
+    {"ztzlvc", "ztzlcv"},
+    {"ddtdyrj:", "ddtdryj"},
+    {":pzubsaxvg", "pzubsavxg"},
+    {"owgsktf", "owgstkf"},
+    {"ciqyabqj", "ciqyaqbj"},
+    {"uudgzny", "uudgnzy"},
+    {"gzodomy", "gzoodmy"},
+    {"ghcpvmt", "ghcvpmt"},
+    {"wmmtrp", "wmtmrp"},
+    {"lrgdjfmo", "lrgdfjmo"},
+    {"kkwhigcj", "kkwhgicj"},
+    {"gwayoefj:", "gwaoyefj"},
+    {":ezfjrif", "ezfrjif"},
+    {"szxbvo", "szxvbo"},
+    {"hyntlu", "hynltu"},
+    {"rhipyaao", "rhipyaoa"},
+    {"vccpou", "vccpuo"},
+    {"fiilyi", "fiiyli"},
+    {"rtekpd", "trekpd"},
+    {"njsihpo", "jnsihpo"},
+    {"pxzkcry", "pxzkrcy"},
+    {"chmdkljm", "cmhdkljm"},
+    {"twjsbfnnm", "wtjsbfnnm"},
+    {":zfcejcdyri", "zfcejcdryi"},
+    {"mkimnlroa", "mkimnlrao"},
+    {"gaqblmr", "gabqlmr"},
+    {"qedvvtjzn", "qedvvjtzn"},
+    {"dbwflvfhf", "bdwflvfhf"},
+    {"ykjzig", "ykjizg"},
+    {"pykefm", "pykfem"},
+    {"ubfddbzy", "ubdfdbzy"},
+    {"kpwyprll", "kwpyprll"},
+    {"gncwcgrk", "ngcwcgrk"},
+    {"fcanfnhqs", "fcafnnhqs"},
+    {"mefyyvaxa", "mefyyvxaa"},
+    {"pbotgg:", "pbtogg"},
+    {"ewulwtatqz", "ewulwttaqz"},
+    {"egyihtkmn", "geyihtkmn"},
+    {"sfulydef", "sfuldyef"},
+    {"xedniuamix", "xedniaumix"},
+    {":nldpxh", "lndpxh"},
+    {"sdfzjiuvn:", "sdzfjiuvn"},
+    {"annqbxqe", "annqbqxe"},
+    {"rdxutlblo:", "rdxutlbol"},
+    {"nioroka", "nioorka"},
+    {"uygacyrz", "ugyacyrz"},
+    {":nbbbriliq", "nbbbirliq"},
+    {":flmtcgmk", "lfmtcgmk"},
+    {"zztpltdfge:", "ztzpltdfge"},
+    {"vkjaxdj", "kvjaxdj"},
+    {"rqxphldqg", "qrxphldqg"},
+    {"cwgmixs", "cwmgixs"},
+    {"cwtixkmczb", "cwitxkmczb"},
+    {":gjqaspcr", "gjqsapcr"},
+    {"eqcdcngz", "eqccdngz"},
+    {"yqjmantygq", "yqjamntygq"},
+    {"vemhcjjbkf", "vemchjjbkf"},
+    {"jhkpuuuazy:", "jhkpuuuayz"},
+    {":aadoqlkiso", "aadqolkiso"},
+    {"xxcamq", "xcxamq"},
+    {"yvtiyhpbm", "yvtyihpbm"},
+    {"spuuojqia:", "spuujoqia"},
+    {":zyklki", "zylkki"},
+    {"dwptbgvxh:", "dpwtbgvxh"},
+    {"eecivj:", "eecvij"},
+    {"wcojkwzzf", "wcojkwzfz"},
+    {"ndsaml:", "ndsmal"},
+    {"vchjoop", "vchjopo"},
+    {"lgajfzzue", "lgajzfzue"},
+    {":azyhaxodsh", "ayzhaxodsh"},
+    {"vwpmktjkz", "vpwmktjkz"},
+    {"efzyaterak", "efzytaerak"},
+    {"vdbihwlnl", "vdbihwnll"},
+    {":jfhcncqrbh", "jfhcncqbrh"},
+    {"ylruxr", "ylrurx"},
+    {":vfrlmpspxw", "vfrlmppsxw"},
+    {":ofcuydh", "focuydh"},
+    {":nrprwcge", "nrrpwcge"},
+    {"xmjwier:", "xmjwire"},
+    {"jqedwsi", "jqedswi"},
+    {"bhpferxa", "hbpferxa"},
+    {"qmaqorrpjr", "qmaqorprjr"},
+    {"zyvitioc", "zyvitico"},
+    {"xzuonrwfa", "xuzonrwfa"},
+    {"dekehyjkm", "dekheyjkm"},
+    {"lugzwtv", "lguzwtv"},
+    {"urdgvweff", "rudgvweff"},
+    {"regescfy", "regescyf"},
+    {":dcfiust", "dcfuist"},
+    {"cmukrrojh", "mcukrrojh"},
+    {":onfypxchj", "ofnypxchj"},
+    {"ephoafn", "epohafn"},
+    {":hixyxqidh", "hixyqxidh"},
+    {"oqbtlo", "qobtlo"},
+    {"aanwmjs", "aanwmsj"},
+    {"trpxfpzbf", "trpxpfzbf"},
+    {"rzhdmu", "rzhmdu"},
+    {"yxoiln", "yxoinl"},
+    {"qjdoqqrk", "qjdoqqkr"},
+    {"obnrpkcdj:", "onbrpkcdj"},
+    {"pnlhrgd", "pnlhgrd"},
+    {"wtiigrhsk", "witigrhsk"},
+    {":hppsbznejs", "hppsbznesj"},
+    {"rcgomnnq:", "rcgmonnq"},
+    {"dneuww", "ndeuww"},
+    {"lsyuwid", "lsyuwdi"},
+    {"rwwnzhc", "rwwznhc"},
+    {":pvjngkuhw", "vpjngkuhw"},
+    {":vqfmlqzmh", "vqfmlqmzh"},
+    {"sgogjjwcqb", "gsogjjwcqb"},
+    {"alrdinf", "arldinf"},
+    {"tvxeaj", "tvxaej"},
+    {"chhzqt", "chhqzt"},
+    {":pptkvbqlkj", "pptkvbqljk"},
+    {"mxagtbiib", "mxatgbiib"},
+    {"bxwrputwa", "bxwprutwa"},
+    {"ejlbhnoe", "ejlbhone"},
+    {"gqxnckphcf", "qgxnckphcf"},
+    {"fmvqdwsapp", "fmvqwdsapp"},
+    {"jadjuwq", "jadjwuq"},
+    {"bidthelmlv:", "ibdthelmlv"},
+    {"fkccgffhdz", "fkccgffdhz"},
+    {"ooilwmuyog", "ooilwmyuog"},
+    {":anpimllu", "anpmillu"},
+    {":ytkbmgpbpp", "ytkmbgpbpp"},
+    {"gdvbavani", "gdvabvani"},
+    {"okwcuym", "okwcumy"},
+    {":mbmesn", "bmmesn"},
+    {"qsffofzwdi:", "sqffofzwdi"},
+    {":ckmsppetjy", "ckmspptejy"},
+    {":jnsozht", "jnszoht"},
+    {"rlsgsng", "rlsgsgn"},
+    {"pieuyd", "piueyd"},
+    {"vkkdhx:", "vkkdxh"},
+    {"dscefverz", "dcsefverz"},
+    {"asmmiuxgy", "asmmuixgy"},
+    {"hdaoxxebx", "dhaoxxebx"},
+    {":volyqyz", "ovlyqyz"},
+    {"szcdbv", "szcbdv"},
+    {"bdlzrhrd", "bdzlrhrd"},
+    {"ermkkgaz", "ermkgkaz"},
+    {"aqzwyiht", "qazwyiht"},
+    {":sfwcbf", "sfwbcf"},
+    {"uijvnemnyk", "uijnvemnyk"},
+    {"hzkirhi", "hzkihri"},
+    {"wnhrsegbbo", "wnrhsegbbo"},
+    {"oiqcrroxk", "oiqcrrxok"},
+    {"cqyjbrybg", "cqyjbrygb"},
+    {"ixduzsvl", "ixudzsvl"},
+    {"ulsiydr", "ulsyidr"},
+    {"pthrkd", "ptrhkd"},
+    {"xgwcsgkylg", "gxwcsgkylg"},
+    {":qemneq", "qemnqe"},
+    {"unbyoqu", "ubnyoqu"},
+    {"bjmgjrao:", "bjmjgrao"},
+    {"azeutjqmtv", "azeutqjmtv"},
+    {":ucvaxyt", "uvcaxyt"},
+    {"plyjas", "plyjsa"},
+    {"hsmyyfbk", "hsmyybfk"},
+    {"ywokscde", "ywoksdce"},
+    {"smyumpyq", "smyumypq"},
+    {"hwqxblj", "whqxblj"},
+    {"ucvgkc", "ucvgck"},
+    {"yifgjsz", "yifgjzs"},
+    {"idimfkxybb", "idimfkxbyb"},
+    {"wsbifsr", "wsibfsr"},
+    {"kbuztjnqti", "kubztjnqti"},
+    {"adlpod", "aldpod"},
+    {"plyraonccm", "plryaonccm"},
+    {":ozwnbxvjmd", "ozwnxbvjmd"},
+    {"mtsquh:", "mtsuqh"},
+    {":bautam", "bauatm"},
+    {"onhdpq", "nohdpq"},
+    {"rqxuphavmu", "rxquphavmu"},
+    {"tlwrkx:", "tlwkrx"},
+    {"pdcdsd", "dpcdsd"},
+    {"azwfgcna", "awzfgcna"},
+    {"waxzklson", "wazxklson"},
+    {"sgipmnp", "sgipnmp"},
+    {":akjywx", "akjwyx"},
+    {"bbtcnasmn", "bbtcnasnm"},
+    {"kvghiz", "vkghiz"},
+    {"ksbyhfvokp", "ksbyhfvopk"},
+    {"qlzbwdy", "qlzbdwy"},
+    {"rvuleru", "ruvleru"},
+    {"mchpdcel", "mchpcdel"},
+    {"vfvhyfhnfb", "vfvhyhfnfb"},
+    {":mgjikxjarf", "gmjikxjarf"},
+    {"fyrdvfni:", "fyrvdfni"},
+    {"cbyjafma", "cybjafma"},
+    {"ddwiar", "ddwair"},
+    {"ppxxmoztpl", "ppxxmozptl"},
+    {"mnupakqctg", "mnupakcqtg"},
+    {"ukscsdeju:", "uksscdeju"},
+    {"tydbtkn:", "ytdbtkn"},
+    {"kczzqep", "kczqzep"},
+    {"scokvst", "scokvts"},
+    {"smasnyu", "samsnyu"},
+    {"ysiszfjha", "ysiszfhja"},
+    {"hyagivs", "yhagivs"},
+    {"vpbhyhe", "vbphyhe"},
+    {"cdoehxc", "cdeohxc"},
+    {"koxkdi", "kokxdi"},
+    {"chvjiwxmb", "hcvjiwxmb"},
+    {"wuqodo", "wuqood"},
+    {"udizjfg", "udijzfg"},
+    {"iatbluzzhh", "iatblzuzhh"},
+    {"kgmtux", "kgtmux"},
+    {"jrggpubz", "jrgpgubz"},
+    {"xnvnlh", "xvnnlh"},
+    {":yoxbdsa", "yobxdsa"},
+    {"ogdckuzij", "odgckuzij"},
+    {"utfhhlimf:", "utfhhilmf"},
+    {"xhxotk", "hxxotk"},
+    {"lzficczf", "lzfciczf"},
+    {"gwrmzh", "gwmrzh"},
+    {"gukprdbv", "gukprbdv"},
+    {"bkvvtvi", "bvkvtvi"},
+    {":dcrtkyohvt", "dcrtykohvt"},
+    {"phvorl", "phovrl"},
+    {"ywpaaecsu", "ywpaaecus"},
+    {":ysnjdmxmlr", "ysnjdmxmrl"},
+    {"tqzvdiedf", "tqzvdeidf"},
+    {"nbxubfpgw", "bnxubfpgw"},
+    {"hsgana", "hsgnaa"},
+    {"enebkyidgv", "enebkyigdv"},
+    {"bcryhwj", "cbryhwj"},
+    {"xrbrmi:", "xrrbmi"},
+    {":ssivmnx", "ssivnmx"},
+    {"ylxbmc", "yxlbmc"},
+    {"ilqctlikz", "ilqtclikz"},
+    {"smqyzjbng", "smqyjzbng"},
+    {"bvpztchv", "bvpztcvh"},
+    {"yvufnh", "vyufnh"},
+    {"txrorbsm", "txrorbms"},
+    {"yyuhim", "yyuhmi"},
+    {"dsarbmgr", "dsrabmgr"},
+    {"ekqsteq:", "eqksteq"},
+    {"vlnkalj", "vlnaklj"},
+    {"xbcnorot", "bxcnorot"},
+    {":zgwzmyq", "zgwmzyq"},
+    {":fepjloj", "fepjolj"},
+    {"zexwdadnh", "zexwdandh"},
+    {"acroxpg", "acropxg"},
+    {"fysskqscg", "fsyskqscg"},
+    {"hjwmqa", "jhwmqa"},
+    {"byuowuve", "byuwouve"},
+    {"ehxjceqiqh", "exhjceqiqh"},
+    {"mkgofd", "mkgodf"},
+    {"hpuylunqo", "hpuyulnqo"},
+    {"kgantoowrc", "kgantoworc"},
+    {"klibiw", "klbiiw"},
+    {"wygicpsgju", "wgyicpsgju"},
+    {"uqioar", "uqiaor"},
+    {"qzeavulrhn", "qzeavulhrn"},
+    {"kxhuihi", "kxhuhii"},
+    {"hxdxnavbfk", "hxdxnavfbk"},
+    {":xtbdcmzyw", "xtdbcmzyw"},
+    {"ugljuapf", "guljuapf"},
+    {"kzmbrpx", "zkmbrpx"},
+    {"fjgljhjkcw", "fjgljjhkcw"},
+    {"kunoslpaql", "kuonslpaql"},
+    {"xgldmy", "xlgdmy"},
+    {"tegkhbiceq", "etgkhbiceq"},
+    {":rigklpkrnz", "rigkplkrnz"},
+    {"ejuluvc", "ejuulvc"},
+    {"ijgbexkff", "ijgbexfkf"},
+    {"xcqxcwp:", "xcxqcwp"},
+    {"epwaeajeoc", "epwaejaeoc"},
+    {"cjdsebr", "cjdserb"},
+    {"mmqbqzezjb:", "mmqbqzejzb"},
+    {"cuvacapqx", "cuvaacpqx"},
+    {"fayzprdfvt", "fazyprdfvt"},
+    {"elkicr", "eklicr"},
+    {"mlvotydd:", "mlvotdyd"},
+    {"wifwjy", "iwfwjy"},
+    {"iulcqa", "iulcaq"},
+    {"ztvofxqxo", "ztvofxxqo"},
+    {"dmdjixqi", "dmdjixiq"},
+    {"bagnwdbq", "bangwdbq"},
+    {"ysaxzxpshr", "ysaxzxphsr"},
+    {"scujzfvcwr", "scujzfvwcr"},
+    {"duyaindj", "duyanidj"},
+    {":lrpwtvlrvg", "lrpwtvrlvg"},
+    {"gvbsakwav", "gbvsakwav"},
+    {"stgbktvsvy", "stgbkvtsvy"},
+    {":qieehbmvgu", "qieehbmgvu"},
+    {":ygmimz", "ygimmz"},
+    {":qgjmabbgf", "qjgmabbgf"},
+    {"daslikjxh:", "daslkijxh"},
+    {"acmjqona", "acmjqoan"},
+    {"mwkpfimm:", "mkwpfimm"},
+    {"gwtrlyvd:", "gwtrlvyd"},
+    {"vtfaltxr", "vftaltxr"},
+    {"xehamrwrd", "xheamrwrd"},
+    {"adqngkciwo", "daqngkciwo"},
+    {"mmmtbnpl", "mmmtbpnl"},
+    {"kxkuqmdp:", "kxkuqmpd"},
+    {"sjhvledh", "sjhvldeh"},
+    {"pxukjbtdc", "pxukjbdtc"},
+    {"yuwbemzij", "yubwemzij"},
+    {"cigxnnzjgr", "cigxnnjzgr"},
+    {"autoxbx", "auotxbx"},
+    {"lxnmxkbip", "lxnmxkibp"},
+    {"dvzvmqdt", "dvzmvqdt"},
+    {"uagtfigo:", "uagtfgio"},
+    {":wjburgltfg", "wjbrugltfg"},
+    {":tgwfvxdov", "tgwfxvdov"},
+    {"bcloec", "bcloce"},
+    {":kntfoakp", "nktfoakp"},
+    {"bpgjcz", "bgpjcz"},
+    {":wbpjulo", "wbpjluo"},
+    {"tneckj:", "tncekj"},
+    {"lqdxdlaz", "qldxdlaz"},
+    {"zkqznmp", "zqkznmp"},
+    {"pqtmydnqx", "pqtmyndqx"},
+    {"idoguufdy", "idoguudfy"},
+    {"hbodwecu", "hbowdecu"},
+    {"hjbxop", "hjbxpo"},
+    {"ljprpx", "ljrppx"},
+    {"hxlnjx:", "hxnljx"},
+    {"zejwlkfi", "ezjwlkfi"},
+    {"ewluov", "weluov"},
+    {":loxytbog", "loxybtog"},
+    {":kwqeoix", "kwqeiox"},
+    {"xfjzwpqm", "xfzjwpqm"},
+    {"eenhfwiau", "eenhwfiau"},
+    {"kbfwowlhuc", "kbfowwlhuc"},
+    {"uwslsvksdy", "uwslsvkdsy"},
+    {":uaakzsaqzo", "uaakzsazqo"},
+    {"kpfkunujvu", "kfpkunujvu"},
+    {":tbzokkelhe", "tbozkkelhe"},
+    {"tqqlma", "qtqlma"},
+    {"xmyqzgiadh", "mxyqzgiadh"},
+    {"lsodmy", "slodmy"},
+    {":cemhhkdz", "cemhhdkz"},
+    {"nucxgelwg", "nucxgewlg"},
+    {":mknhbba", "mkhnbba"},
+    {"qbxzsn:", "bqxzsn"},
+    {"gxnlcif", "gxnclif"},
+    {"sbjbgvmna", "sjbbgvmna"},
+    {"csinoy:", "csiony"},
+    {"qhtonk:", "qthonk"},
+    {":wkzatfxdhx", "wzkatfxdhx"},
+    {":igsiuckcj", "igisuckcj"},
+    {"zlyykxa", "zlyykax"},
+    {"qtspdm", "qtsdpm"},
+    {":gjknnis", "gjknins"},
+    {"ljygcvbvo", "ljygvcbvo"},
+    {"rdobpoc", "rdbopoc"},
+    {"hqmldha", "hqmdlha"},
+    {"rpvehuvk", "rpveuhvk"},
+    {"qqzpvvl", "qqzvpvl"},
+    {"qrxcza", "qrxzca"},
+    {"cefwgugwee", "cefwuggwee"},
+    {"nbuxpkznx", "nbuxkpznx"},
+    {"cfeuky", "cfueky"},
+    {"iegcagwvft:", "iegacgwvft"},
+    {":pygnex", "ypgnex"},
+    {":rkloek", "rkolek"},
+    {"folynad", "folyand"},
+    {"ociipe", "coiipe"},
+    {":kveruxb", "kveurxb"},
+    {"cmiuylmu", "mciuylmu"},
+    {"dgpfugyh", "gdpfugyh"},
+    {"dvdgjfy", "dvdgfjy"},
+    {"zmsirwz", "zsmirwz"},
+    {":tgksty", "tgskty"},
+    {"yfwszw:", "ywfszw"},
+    {"tpclnkcuey", "tplcnkcuey"},
+    {"vamcusuqlv", "vamcsuuqlv"},
+    {"qgwhbxlcgg", "qwghbxlcgg"},
+    {":goxhgkyefg", "ogxhgkyefg"},
+    {"rjvjdgfs", "rjvjgdfs"},
+    {"xsoyrgat", "xsoyrgta"},
+    {"enuokknbo", "enoukknbo"},
+    {"rmqznkex", "rmzqnkex"},
+    {"tmawhkb", "tmawhbk"},
+    {"enaprhaddq", "enaprhdadq"},
+    {"zwkzuggs", "zkwzuggs"},
+    {"dceaswt", "dcesawt"},
+    {"ctllaknk", "ctlalknk"},
+    {":cvtoroawvy", "cvtoroawyv"},
+    {"ltmxsx:", "tlmxsx"},
+    {"trbfyks:", "trbyfks"},
+    {"cvbspan", "cbvspan"},
+    {"ekkkomytzg", "ekkkomyztg"},
+    {"ubousjm", "uobusjm"},
+    {"piuseoi", "piuesoi"},
+    {"ihlyfqusmq", "ihlyqfusmq"},
+    {"shheuqo", "hsheuqo"},
+    {"oiljasxwxy:", "ioljasxwxy"},
+    {"wkuhobiax", "wkuhobaix"},
+    {"kukhfdsmt", "kukfhdsmt"},
+    {"yaxkpkwz", "yaxkkpwz"},
+    {"vdhlaum", "dvhlaum"},
+    {"vphglnf", "vphlgnf"},
+    {"exjuxtlwq", "exjuxltwq"},
+    {":nxcsig", "nxcsgi"},
+    {"vlivzxfz", "vlivzfxz"},
+    {"llenehr", "lleenhr"},
+    {"fgpkauy", "fgkpauy"},
+    {"ebelkyos", "ebelkyso"},
+    {"nyovdmn:", "nyovdnm"},
+    {":bhlcgqwzda", "bhlcqgwzda"},
+    {"zhayogx", "zhaygox"},
+    {"jjiplzgvz", "jjiplzgzv"},
+    {"pkrezfqkt", "prkezfqkt"},
+    {"qxztehoq", "qxtzehoq"},
+    {"bcrivmvbf", "bcrivmvfb"},
+    {"zkrwmtixn", "zkrwmtxin"},
+    {"hbonxql", "hboxnql"},
+    {"bleaagkzea:", "blaeagkzea"},
+    {"vchegjyfp", "vchgejyfp"},
+    {"yoduunm", "youdunm"},
+    {"vdtfeolcl", "vdtfelocl"},
+    {"ctcztlk", "ctctzlk"},
+    {"ihcuggntj:", "ichuggntj"},
+    {"xvzdnsglh", "xvzdnsghl"},
+    {"mdylmdvjvr", "mdylmdvvjr"},
+    {"dbfgkzqlzo", "dbfgkzqloz"},
+    {"aziejzw", "aziezjw"},
+    {"qctlxfjxo", "qtclxfjxo"},
+    {"ypogypr", "ypoygpr"},
+    {"jjznbggfbb", "jjzbnggfbb"},
+    {"dhvjksab:", "hdvjksab"},
+    {"ctlimldkez:", "ctlimldkze"},
+    {"zwhbsoszgt:", "zwhbosszgt"},
+    {"sbxdhv", "sbdxhv"},
+    {"svaevtyhh", "sveavtyhh"},
+    {"tkjdng", "ktjdng"},
+    {"waymkbcbs", "waymkcbbs"},
+    {"ojqwzofptg", "joqwzofptg"},
+    {"vitfodzly:", "vitofdzly"},
+    {"dxxpub", "dxxpbu"},
+    {":vhlvpp", "vhlpvp"},
+    {"iegovhoc", "igeovhoc"},
+    {"szshtg", "szhstg"},
+    {"zinjttm", "iznjttm"},
+    {"tqenmvcqwy", "tqemnvcqwy"},
+    {"jxkkoh", "jxkkho"},
+    {"qmgpiejsoc", "qmgpiesjoc"},
+    {"ineannompn", "inenanompn"},
+    {"fdxvym", "fxdvym"},
+    {"bpyfywwbr", "bpyfwywbr"},
+    {"faqkqm", "faqkmq"},
+    {"bkeyhly", "bekyhly"},
+    {"rrvefaklm", "rrveafklm"},
+    {"hqwcochpa", "hqwcohcpa"},
+    {":kcglvgcwi", "kclgvgcwi"},
+    {"vybiuzfv", "vybizufv"},
+    {":uxaxjmh", "uxaxjhm"},
+    {":pdpjhwy", "pdpjhyw"},
+    {"gorkrls", "gorklrs"},
+    {"vdquajvll", "vduqajvll"},
+    {"xzssow", "xzsosw"},
+    {"xzdxoaduiw", "xzdxoaduwi"},
+    {"npckuvnvs", "npckuvnsv"},
+    {"pfzlyhcj", "fpzlyhcj"},
+    {"hrwlory", "hrlwory"},
+    {"xloejmh", "xloemjh"},
+    {"hpdldw", "hpdlwd"},
+    {"jierkf", "ijerkf"},
+    {"lyyyrbvqn", "lyyyrvbqn"},
+    {"zmghqqi", "zmgqhqi"},
+    {"jhmsys", "jhmyss"},
+    {"xanqtis", "xantqis"},
+    {"xlinvakrj", "xlnivakrj"},
+    {"yrnyzvo", "yrnyzov"},
+    {"altrnthkfe", "altnrthkfe"},
+    {"ceevben", "ceebven"},
+    {"cdtpxewk:", "cdtpxwek"},
+    {"bkmnte", "bkmtne"},
+    {"uyccllze", "yuccllze"},
+    {"owrhmywcg", "owrhymwcg"},
+    {"sxfxiioti:", "sxfxiitoi"},
+    {"ytzqmb", "yztqmb"},
+    {"eglidr:", "elgidr"},
+    {"cadtzrv", "catdzrv"},
+    {"cbpehyr:", "cbpehry"},
+    {"nmepsiy:", "nmespiy"},
+    {"vqzzqdiz", "qvzzqdiz"},
+    {":stpqbk", "stpbqk"},
+    {":cltokqfj", "cltoqkfj"},
+    {"gcqxaamytw", "gcqxaaymtw"},
+    {"keqafo", "keaqfo"},
+    {"zwqofk:", "zwoqfk"},
+    {"icckgqqn", "icckgqnq"},
+    {"zeakjsjlvz:", "zeakjsljvz"},
+    {"vhxpprg", "vhxppgr"},
+    {"nwpotovr", "nwpotvor"},
+    {"iewbkxikbx", "iewbkxikxb"},
+    {"sjbesipmu", "sjebsipmu"},
+    {":gkoxhw", "kgoxhw"},
+    {"ervocuyv", "erovcuyv"},
+    {"ujmgkmtxb", "ujmkgmtxb"},
+    {"tpgtrrdu", "tgptrrdu"},
+    {"tguupc", "tguucp"},
+    {"bwhblhf", "bhwblhf"},
+    {"qkdaskovhz", "qkdsakovhz"},
+    {"hqdmoxngyp", "hdqmoxngyp"},
+    {":zjxwcip", "jzxwcip"},
+    {"aynjysfr", "anyjysfr"},
+    {"xzdybgquw", "xzdybguqw"},
+    {"bggpiadfh", "bggpiadhf"},
+    {"byeyoecrt", "ybeyoecrt"},
+    {"bxvvmdusiu", "bxvvmudsiu"},
+    {"cbysdkm", "cbyskdm"},
+    {":lrsfpn", "lsrfpn"},
+    {":tlliek", "tlilek"},
+    {":ilrxdmpl", "ilxrdmpl"},
+    {"ixyifhzatr", "ixyifhzart"},
+    {":nzimzuym", "nzimzyum"},
+    {"tlvgttosk", "ltvgttosk"},
+    {"livefg", "lievfg"},
+    {"uobgaeo", "uobgeao"},
+    {"zhpoeg", "zhpoge"},
+    {":mlioyoyo", "mliooyyo"},
+    {"oeydgaw:", "eoydgaw"},
+    {"zatnmxjue", "zatnmxjeu"},
+    {"bibhcmu", "ibbhcmu"},
+    {"ofpsaitmxx", "ofpsatimxx"},
+    {":pcnxoopdk", "pcnxoodpk"},
+    {":nfxfigqush", "nxffigqush"},
+    {"mckaca:", "mcakca"},
+    {"dluwdsbcy", "dlwudsbcy"},
+    {"lxjanjlav", "lxjanjalv"},
+    {"gohuolniqw", "ghouolniqw"},
+    {"geefntamr", "geefntmar"},
+    {"gpkzcfn", "gkpzcfn"},
+    {"qzdsipbycm", "qzdsibpycm"},
+    {"cppllb", "cpplbl"},
+    {":fcmijrqq", "fcmirjqq"},
+    {"pjvxtdwc", "pjxvtdwc"},
+    {":rfmxvz", "rfmxzv"},
+    {"gszdczzhh", "gszcdzzhh"},
+    {"drimggnat", "drigmgnat"},
+    {":juqdlfqjgz", "juqdlfqgjz"},
+    {"zyjqkmmy", "zjyqkmmy"},
+    {"zuydhwd", "zudyhwd"},
+    {"oigrpzkto:", "oigprzkto"},
+    {"ffpxqfurc", "ffpxqfucr"},
+    {"asznmc", "aszncm"},
+    {"pnkqhnkl:", "pnqkhnkl"},
+    {":ilyxifhtll", "ilyixfhtll"},
+    {"loxrkrz", "lorxkrz"},
+    {"mcyjcrfm", "mcycjrfm"},
+    {"tnrgis", "trngis"},
+    {"qygpwryt:", "qygpwyrt"},
+    {"pfxpjbvr", "pfxpbjvr"},
+    {"fsucckllmy", "fsuckcllmy"},
+    {"srpbtuzm", "sprbtuzm"},
+    {"mriroxcz", "mriorxcz"},
+    {"iyrpxc", "iyrxpc"},
+    {"dnbfskyt", "dnbsfkyt"},
+    {"ayyswdvig", "aysywdvig"},
+    {"kvfmfqmh", "kvfmfqhm"},
+    {"igvfcmn", "ivgfcmn"},
+    {"ageyeapdza", "ageyeapzda"},
+    {"yihucwqdj", "yihucwqjd"},
+    {"knxkrl", "knxrkl"},
+    {"cppsbkb", "cppsbbk"},
+    {"qjuhlcw", "qujhlcw"},
+    {"qnhsvwdb:", "qnhsvwbd"},
+    {"tzcyrbnue", "tzycrbnue"},
+    {":zkimbugu", "kzimbugu"},
+    {"dmoigde", "dmiogde"},
+    {":oumbenq", "omubenq"},
+    {"dzjzxjoryp:", "djzzxjoryp"},
+    {":mnzmrne", "mnmzrne"},
+    {"gktpsbsc", "gktpbssc"},
+    {"cteddvjqqs", "cteddjvqqs"},
+    {"cjyhmjll", "jcyhmjll"},
+    {"brbyxmt", "brbxymt"},
+    {"zbiegzu", "zbeigzu"},
+    {"eoaymt:", "eoaytm"},
+    {"yrsxnku", "ysrxnku"},
+    {"srlyrjglrl", "srlyrjgrll"},
+    {":vaoapi", "voaapi"},
+    {"dxamrsbc", "dxarmsbc"},
+    {"ctsovbw", "ctsobvw"},
+    {":jbyuyvm", "bjyuyvm"},
+    {"frxeltufnc", "frexltufnc"},
+    {"bdoylrm", "bdolyrm"},
+    {"wpubwg", "pwubwg"},
+    {"fcltfo", "flctfo"},
+    {":zinsngoql", "znisngoql"},
+    {"gqvkzqx:", "gqvzkqx"},
+    {"oawhcry", "oawhcyr"},
+    {"snuxsww", "snusxww"},
+    {"yydogjj", "yyodgjj"},
+    {":ammvcqqmde", "ammvcqqmed"},
+    {":ryxdzaone", "yrxdzaone"},
+    {":velufawuu", "veluafwuu"},
+    {"jlydfstof", "jldyfstof"},
+    {"jyvlvczoe", "jyvlvcoze"},
+    {"rijipq", "irjipq"},
+    {"wakfuucg", "wafkuucg"},
+    {"ismlvooa", "ismlvoao"},
+    {"suksejiub", "suksejibu"},
+    {"nggzvmekqc", "nggzvemkqc"},
+    {":xeumqenpm", "xuemqenpm"},
+    {"wxvvtgvq", "wxvtvgvq"},
+    {"ghchfaqi", "ghchfqai"},
+    {"ppnvhcivol", "pnpvhcivol"},
+    {"gmskiyywy", "gmskiywyy"},
+    {"ihcmhajbn", "ihchmajbn"},
+    {"jeujvwdt", "jeuvjwdt"},
+    {"sppyunkhoj", "spypunkhoj"},
+    {":eigdgmv", "egidgmv"},
+    {"nlrvjsmsv", "nlrjvsmsv"},
+    {"ncnpqxsx", "ncnqpxsx"},
+    {":xmbdgycdpr", "xmbdygcdpr"},
+    {"yzrqydrfv", "yzrqydrvf"},
+    {":bblygq", "blbygq"},
+    {":mkgchecf", "mkgcehcf"},
+    {"sensub", "sesnub"},
+    {":bsmrletn", "bsmreltn"},
+    {"jzkjmlspd:", "zjkjmlspd"},
+    {"zpxaxbdi:", "zpxaxdbi"},
+    {"mxvbczf", "mvxbczf"},
+    {"imhlrv", "ihmlrv"},
+    {"jseknkrz:", "jsekknrz"},
+    {"olkaxbgb", "olkxabgb"},
+    {"mfjvxbmlbm", "mjfvxbmlbm"},
+    {"rmbajg", "rmabjg"},
+    {"ytuelag", "ytuelga"},
+    {":kogghrjor", "koghgrjor"},
+    {"pmkzil", "pmkizl"},
+    {":vowdhec", "vodwhec"},
+    {"jpbfjbe:", "pjbfjbe"},
+    {":bbivtquf", "bbitvquf"},
+    {"ryyqbo", "yryqbo"},
+    {"hfrxht", "hfrxth"},
+    {"jpglyim", "jpglymi"},
+    {"guouvgzzx", "gouuvgzzx"},
+    {"mocnut", "mocunt"},
+    {"rbenuogn", "rbenugon"},
+    {"lowowgyjki", "lowowygjki"},
+    {":wzmdzkryx", "wzmdzkrxy"},
+    {"gqdgxulhu", "gqdgxuhlu"},
+    {":uvmdsglfge", "uvmsdglfge"},
+    {":iszifjdfkl", "izsifjdfkl"},
+    {"nogfhp", "nofghp"},
+    {"pnqgsavzh", "npqgsavzh"},
+    {":ywhfcgjkd", "wyhfcgjkd"},
+    {"dynaipg", "dyniapg"},
+    {"sccxfgsm", "sccxgfsm"},
+    {"fjmjkepxil", "fmjjkepxil"},
+    {":xrfgbors", "xrfgbosr"},
+    {"ogfrcapt:", "ogfrcatp"},
+    {"kcqndol", "kcqdnol"},
+    {"huzazkvp", "huzazvkp"},
+    {"yoghwtqfk", "oyghwtqfk"},
+    {"vcwgoutkvh", "vcwgouktvh"},
+    {":wxesqrmg", "wxeqsrmg"},
+    {"jrfyjpn", "rjfyjpn"},
+    {"xjikxoxah:", "xjikxoxha"},
+    {"zyyhuwx", "zyhyuwx"},
+    {":jrsjte", "jrjste"},
+    {":qgamykyp", "qgaymkyp"},
+    {"jrbtgw:", "rjbtgw"},
+    {"efdmbxaab", "efdbmxaab"},
+    {"vmymdp", "vmydmp"},
+    {":ezseyx", "ezsyex"},
+    {"vepfswdm:", "evpfswdm"},
+    {"bgwgopgao", "bggwopgao"},
+    {"hsegkom", "hsegokm"},
+    {":dractcvefr", "rdactcvefr"},
+    {"airkkbsw", "aikrkbsw"},
+    {"wlyjuz", "wlyujz"},
+    {":ldpcsvzzkc", "ldpcvszzkc"},
+    {"qcbetn", "qbcetn"},
+    {"bfwftxmbd", "bffwtxmbd"},
+    {":fyvukix", "fyvkuix"},
+    {"nqlyzucqcb", "nqlzyucqcb"},
+    {"hlcluuqnlq", "hllcuuqnlq"},
+    {"bklkbi", "bklkib"},
+    {"iwavrlgqv", "iwavlrgqv"},
+    {"mhavza", "mhvaza"},
+    {"qmsygy", "mqsygy"},
+    {"nlyqibzzf", "nlyqizbzf"},
+    {"lxvhxhjo", "lxhvxhjo"},
+    {"aqmvjzucc", "qamvjzucc"},
+    {"ndozxj", "ndzoxj"},
+    {"meicbbdtbl", "emicbbdtbl"},
+    {"kalvmxjr:", "kalvxmjr"},
+    {"jewvompb", "jwevompb"},
+    {"acrpgnmr", "acrpgmnr"},
+    {"zaefucu", "zaefuuc"},
+    {":zkoryfesf", "zkoryfefs"},
+    {"cdvjfizu", "cdvjfziu"},
+    {":fwzzlflu", "fwzzfllu"},
+    {":jrbsghxwd", "jrbshgxwd"},
+    {"oaytqfnyx:", "oatyqfnyx"},
+    {"dlampsced", "dlamspced"},
+    {"mvyesa", "mvyeas"},
+    {"votnmbyml", "vtonmbyml"},
+    {"wgvzvgycj", "wgvzvgcyj"},
+    {"tjroiy", "tjrioy"},
+    {":kjwjfxce", "kwjjfxce"},
+    {"yehtnet", "yehtent"},
+    {"zgktogxgq", "zgktoggxq"},
+    {"oeinqhfur", "oeniqhfur"},
+    {"ytdhgryrk:", "ytdhgyrrk"},
+    {":sqkgjyalsu", "sqkgjaylsu"},
+    {"knrwaumsll", "knrwaumlsl"},
+    {":zugrbq", "zurgbq"},
+    {"jufdziisjh", "jfudziisjh"},
+    {":qeicbl", "qeiclb"},
+    {"hhsigpo", "hhsigop"},
+    {"sebpsumk", "sepbsumk"},
+    {"elmbrqsbr", "elmrbqsbr"},
+    {"svlsmhevl", "svlsmehvl"},
+    {"iaergcx", "iaergxc"},
+    {"egqycmvw", "egyqcmvw"},
+    {"wuyxvbvwik", "wuyxvbvwki"},
+    {"zfuehqgh", "zfueqhgh"},
+    {"druxjvnq", "drujxvnq"},
+    {":sjjvbf", "sjjbvf"},
+    {"euvmluwq:", "evumluwq"},
+    {"kzianisvoh", "kzianisvho"},
+    {"crrnwg", "crnrwg"},
+    {"zprjem", "pzrjem"},
+    {"febuidvtgk", "febiudvtgk"},
+    {":lpwhfecogh", "plwhfecogh"},
+    {"tbzxyl", "tbxzyl"},
+    {":gbquefqdgd", "gbquefdqgd"},
+    {":hwjylz", "hwjlyz"},
+    {"fqlprnoso", "fqlpronso"},
+    {"lrzitvgt", "lzritvgt"},
+    {"eycfelsl", "eyfcelsl"},
+    {"itpvfqc", "iptvfqc"},
+    {":rbeudrfb", "rbeudfrb"},
+    {"inndoiu", "indnoiu"},
+    {"pnddfh", "pnddhf"},
+    {"gopsebam", "gospebam"},
+    {"cmiinjmqw", "ciminjmqw"},
+    {"tewpkcgc", "tewkpcgc"},
+    {"ohrygwkwys:", "ohrygwkyws"},
+    {"bhsqdj", "bshqdj"},
+    {":razdjmch", "razdmjch"},
+    {":zfhwrygik", "zfhwyrgik"},
+    {"ijfijdngvq", "ijfjidngvq"},
+    {":lsrikruv", "lrsikruv"},
+    {":bsrmmnfbf", "bsrmnmfbf"},
+    {"xgjlar", "xgljar"},
+    {"mhtbgmdew", "mhtgbmdew"},
+    {"zwtwzrc", "zwtwrzc"},
+    {"rkxtqu", "krxtqu"},
+    {"bplsozm:", "bpslozm"},
+    {"krqcpfxd", "krqcpxfd"},
+    {"qchoasq", "qchaosq"},
+    {"dsvbewn", "dsvbenw"},
+    {":mpcbmcp", "mpbcmcp"},
+    {"vypvaq", "vpyvaq"},
+    {"bfcxgzecrb", "bfxcgzecrb"},
+    {"rnhqfv", "rnhfqv"},
+    {"uzzwlzojbv", "uzzwzlojbv"},
+    {"jzasqvo", "zjasqvo"},
+    {"eyzybzfti", "eyzyzbfti"},
+    {"eopmxd", "eopxmd"},
+    {"vyzqhfixo", "vyqzhfixo"},
+    {"wmqxzr", "wmqzxr"},
+    {"qgjsxdp", "qgjsxpd"},
+    {"sozwfdgb", "oszwfdgb"},
+    {":vfpevxbhty", "vfpexvbhty"},
+    {"yhstdphkhk", "yhsdtphkhk"},
+    {"rdsqwwdgso", "drsqwwdgso"},
+    {":qcmfwqj", "cqmfwqj"},
+    {"hunbqp:", "hunqbp"},
+    {"wudqrn:", "wduqrn"},
+    {"bflfyokxb", "blffyokxb"},
+    {"nthdcxdhlt", "nthdcxdhtl"},
+    {"tokaarxrjv", "tokaarxrvj"},
+    {"caxtvtffgw", "catxvtffgw"},
+    {"hszlturioc", "hszltuiroc"},
+    {"lcjjavymf", "lcjjavyfm"},
+    {"pxbbbgfttm", "pxbbgbfttm"},
+    {"axettqj", "aexttqj"},
+    {"dfbmfuz", "fdbmfuz"},
+    {"pyiyfpqfy:", "pyifypqfy"},
+    {"kifkwegduq", "kifwkegduq"},
+    {"ftnfierfaa", "ftfnierfaa"},
+    {"efmlyjutgw", "eflmyjutgw"},
+    {"fzroqnc:", "frzoqnc"},
+    {":ofsbvadhui", "ofbsvadhui"},
+    {"rdkzfys", "rdkzfsy"},
+    {"zcbzjkeiub", "zcbzkjeiub"},
+    {"dbmqesec", "dbmqseec"},
+    {"mpboikdnn", "mpbokidnn"},
+    {"ropmsi:", "rompsi"},
+    {"frbmlgwmid", "rfbmlgwmid"},
+    {"teavhvjnap", "etavhvjnap"},
+    {"ohfzeviv", "ohfzevvi"},
+    {"bzwytswc", "bzwytwsc"},
+    {"etyhyy", "eythyy"},
+    {"zxefesiejr", "zxefesijer"},
+    {"egjrry", "gejrry"},
+    {"taamdy", "tamady"},
+    {"fladdxf", "falddxf"},
+    {"kmvsmlti", "kmvsmlit"},
+    {"agxibvw:", "agixbvw"},
+    {"ymfhyyvmhk", "ymfyhyvmhk"},
+    {":zkemfraxm", "zkemrfaxm"},
+    {"rjltcgkaoz", "rljtcgkaoz"},
+    {"ziwbzlehq", "zibwzlehq"},
+    {"oizjdmukh", "iozjdmukh"},
+    {"zlsdllt", "zlsldlt"},
+    {"scqwehuez", "scqewhuez"},
+    {"gipvfeu", "gipvefu"},
+    {"gwnvrbqy", "gwnvbrqy"},
+    {"vlcjydn", "vlcyjdn"},
+    {":zrtirl", "zrtilr"},
+    {"qqiodxk", "qqioxdk"},
+    {"aojjhpq", "oajjhpq"},
+    {"mpdjorexky", "mpdjoerxky"},
+    {"hwkdlawa", "hwkdlaaw"},
+    {"nikstb:", "inkstb"},
+    {"rjxrmtsg", "rjrxmtsg"},
+    {"gptsveijry", "gpstveijry"},
+    {"lijjkg", "lijjgk"},
+    {"cxmhnqzcy", "cxmnhqzcy"},
+    {"rmymwkzu:", "rmymwzku"},
+    {"qvbmbzxby", "qvmbbzxby"},
+    {"bdvaox", "bdvaxo"},
+    {":kfenfv", "kfenvf"},
+    {"fgqcajdel", "fgqcajdle"},
+    {"iyutjfz", "iyujtfz"},
+    {"cbvxrk", "cbvxkr"},
+    {":ibxlyv", "ibxlvy"},
+    {"odvbvugjpv", "ovdbvugjpv"},
+    {"zsbxnqeb", "zsbnxqeb"},
+    {":ksoxdedz", "ksoxddez"},
+    {"yugkdxq", "yukgdxq"},
+    {"qqrvtbmdvp", "qqrvtbmdpv"},
+    {"ebflat", "ebfalt"},
+    {"knxfstvblc", "knxsftvblc"},
+    {":wvqgtpkrpv", "wvqtgpkrpv"},
+    {":erumhkhwr", "erumhhkwr"},
+    {"vsbvyubvo", "vsbvybuvo"},
+    {"cguyvg", "cgyuvg"},
+    {"sarlirkl", "sarlikrl"},
+    {"qkziqymyyz", "qzkiqymyyz"},
+    {"ibmils", "imbils"},
+    {"oihjvn", "oihjnv"},
+    {"qujhxm:", "qujxhm"},
+    {"wsoismmdok", "wsoismmdko"},
+    {"ovpjpnp:", "ovpjppn"},
+    {"nodxphb", "noxdphb"},
+    {":yfporzh", "fyporzh"},
+    {"qdlddsu", "qldddsu"},
+    {":dfjlkpn", "dfjklpn"},
+    {"xfznjasiy", "xzfnjasiy"},
+    {"tobayf", "otbayf"},
+    {"bhqzsmlio", "bhqzslmio"},
+    {"tynkhrkz", "tnykhrkz"},
+    {"blrlqhivae", "bllrqhivae"},
+    {"adhuersy", "aduhersy"},
+    {":axdbhnja", "axbdhnja"},
+    {":poijsb", "pojisb"},
+    {"xckjyezael", "xcjkyezael"},
+    {"xzbdepgu", "xzbedpgu"},
+    {"hyuycf", "yhuycf"},
+    {"mwtfwqcbgp", "mwtfqwcbgp"},
+    {"zdeiopci", "zediopci"},
+    {"qltchua", "qtlchua"},
+    {"dbjxculwau", "dbjxcuwlau"},
+    {":znpinxo", "znipnxo"},
+    {"kthfvelr", "ktfhvelr"},
+    {"qhxywvaac:", "qhxywvaca"},
+    {"qnffrwkdiz:", "qnffrwkdzi"},
+    {"zdmxrj", "zdxmrj"},
+    {":zunuzjixx", "uznuzjixx"},
+    {"xrwato", "xrwaot"},
+    {"yxnyfzejd", "yxnfyzejd"},
+    {"vldmso", "vldmos"},
+    {"eadjsexuty", "eadjesxuty"},
+    {"jqckxbvu", "jqcxkbvu"},
+    {"wffoixsd", "wfofixsd"},
+    {":byekkebosx", "byekkeboxs"},
+    {"gxgbxi", "gxgxbi"},
+    {":xajorxqqhe", "xaojrxqqhe"},
+    {"vikldqpic:", "vilkdqpic"},
+    {"aiiriru", "aiiirru"},
+    {"fhhirfk", "fhihrfk"},
+    {"eyargitk", "eyarigtk"},
+    {"veookksyek", "voeokksyek"},
+    {"hrqtijo", "hrqitjo"},
+    {"rjguym", "rjgyum"},
+    {":ntrrvzu", "ntrrvuz"},
+    {"sprlrcqpcx", "srplrcqpcx"},
+    {"bcicug", "bcciug"},
+    {"qrgxobbxr", "qrgxobbrx"},
+    {":vqwngg", "vwqngg"},
+    {":mwryllrr", "mwrlylrr"},
+    {":icjfxgpnp", "icjfxgppn"},
+    {"pgxubpz", "pgxbupz"},
+    {"rmsqtpacwr", "rmsqtapcwr"},
+    {"fuhmjzjrhp", "fuhmzjjrhp"},
+    {":qberwc", "bqerwc"},
+    {":jhxglgcjes", "jhxglgcjse"},
+    {"lbietfl", "lbietlf"},
+    {"wjslmybm", "jwslmybm"},
+    {"pjfcgqh", "pjfgcqh"},
+    {"leflvtql", "elflvtql"},
+    {"kxdkify", "kxkdify"},
+    {"wppqbz", "pwpqbz"},
+    {"dmcykutsyi", "dmyckutsyi"},
+    {"npococrxyh", "npococryxh"},
+    {"wluscmsb", "wlusmcsb"},
+    {":cdrbzwx", "dcrbzwx"},
+    {":wnanokeo", "wannokeo"},
+    {"itfykj", "tifykj"},
+    {":daoahomn", "doaahomn"},
+    {"kgaxkbiz", "kgaxbkiz"},
+    {":trhmlsjtb", "trhmlsjbt"},
+    {":dgvgqolmo", "dggvqolmo"},
+    {":riosfmce", "riofsmce"},
+    {"isngwvq", "isngwqv"},
+    {"tidijqre", "tidijrqe"},
+    {"borivw", "obrivw"},
+    {"uevjxa:", "uevxja"},
+    {":qiqfnrxaw", "qiqfnraxw"},
+    {"usbiqvisv", "usbivqisv"},
+    {"gndvmvim", "gndmvvim"},
+    {"bhxwpclmd", "bhxwpcmld"},
+    {"hpmrbbv", "phmrbbv"},
+    {":bbpnlndayt", "bpbnlndayt"},
+    {"luuallp", "luaullp"},
+    {"pyoikb", "ypoikb"},
+    {"ylowshnh", "ylowhsnh"},
+    {"fjuvnj", "fjunvj"},
+    {"qerziy", "qerizy"},
+    {"celhna", "clehna"},
+    {"ohqmwx", "ohqmxw"},
+    {"fcbbjqwshi", "fbcbjqwshi"},
+    {"tddgqxaomx", "tddgqaxomx"},
+    {"lodhdnrsv", "loddhnrsv"},
+    {"ypzdzbw", "ypdzzbw"},
+    {"qcrxlso", "qrcxlso"},
+    {"lgdntb:", "lgdnbt"},
+    {"uswavwq", "uwsavwq"},
+    {"exxhbdqyp", "exxbhdqyp"},
+    {"fvjsjrbc", "fvjsrjbc"},
+    {":fsbnquwv", "fsbnquvw"},
+    {":gxjzfbpulf", "gxjfzbpulf"},
+    {"aakeluhalj", "akaeluhalj"},
+    {"lnnbwel", "nlnbwel"},
+    {":uigckt", "uigkct"},
+    {":oauwwkvyz", "oauwwkyvz"},
+    {"oajngfd", "oajngdf"},
+    {"iaplvu", "aiplvu"},
+    {"fdypoe:", "fdyope"},
+    {"qebnhmau:", "qebnhamu"},
+    {"ovutgmrmp", "ovutgmmrp"},
+    {"rshbtror", "rshtbror"},
+    {"cmcftoqbpo", "cmctfoqbpo"},
+    {"ptkumrf", "pktumrf"},
+    {":xbfzvuywkc", "xbfzvyuwkc"},
+    {"wdaybcec", "wdabycec"},
+    {"ynxkuuf", "yxnkuuf"},
+    {"mwxiehosoq", "mwxiehsooq"},
+    {"fjetzoa", "fjtezoa"},
+    {"obgmim", "obgimm"},
+    {"ijdlxi", "ijdxli"},
+    {"drhpifsjwj", "drhpifsjjw"},
+    {"fqymuv", "qfymuv"},
+    {"txffpqz", "xtffpqz"},
+    {"pixoril", "pxioril"},
+    {"wllkqttt", "lwlkqttt"},
+    {"shvswlht", "svhswlht"},
+    {"wolptyn", "wolptny"},
+    {":cbelnoshp", "cbelonshp"},
+    {"esqhca", "eshqca"},
+    {"fekenxv", "fekexnv"},
+    {":vefrwgbff", "vferwgbff"},
+    {"qjbwcbp", "qjwbcbp"},
+    {":wojhyevcn", "owjhyevcn"},
+    {"whdwdetoci", "whdwdteoci"},
+    {"xipqtms:", "xiptqms"},
+    {"kifdoikj", "ikfdoikj"},
+    {"zimozv", "izmozv"},
+    {"nqynmksyjy", "nqynkmsyjy"},
+    {":zgozaszq", "zgzoaszq"},
+    {"rfkodtj", "rfkotdj"},
+    {"yhhwhq", "yhhhwq"},
+    {"hbbmap", "hbmbap"},
+    {"oregmebic", "oregmeibc"},
+    {"znsacbc", "znsabcc"},
+    {"ushyslzzws", "ushyslzwzs"},
+    {"rykxciawk", "yrkxciawk"},
+    {"nukmqbwbj", "nukmqbbwj"},
+    {"ydizdywtdl", "ydizdywdtl"},
+    {":rzrasywxy", "rrzasywxy"},
+    {"csdjdygvv", "csdjdyvgv"},
+    {"kvvkferc", "kvvkefrc"},
+    {":zpdqokeyxj", "zpqdokeyxj"},
+    {"rhiviwfolf", "rhivifwolf"},
+    {"eyvkxrimag", "eyvkxrmiag"},
+    {"mtjdjmrnk", "mtjdjmrkn"},
+    {"jfmmlp", "jmfmlp"},
+    {"hjyozrnp:", "hjyoznrp"},
+    {"btocjzgr", "btojczgr"},
+    {"vpqtrmrc", "vqptrmrc"},
+    {"itfvkv", "iftvkv"},
+    {":aoykdipoe", "aoykdipeo"},
+    {"hyaycdspi", "hyaycdpsi"},
+    {"leiulkiiw", "leilukiiw"},
+    {"llpavpi", "llpvapi"},
+    {":stwohyei", "stwhoyei"},
+    {"jxcbeszh", "jxcbezsh"},
+    {":yjgbzi", "yjgbiz"},
+    {":eusaeirbbp", "eusaeibrbp"},
+    {"rrpcnm", "rprcnm"},
+    {"phnapdpios", "pnhapdpios"},
+    {":bawiygfw", "baiwygfw"},
+    {"pwzjzdw", "pwzzjdw"},
+    {"npomvucor", "npomuvcor"},
+    {"wxntzqba", "wnxtzqba"},
+    {"kwfhmrtwb", "kwfmhrtwb"},
+    {"vwxoipsszu", "vwxoispszu"},
+    {"ybntmk", "byntmk"},
+    {":qtwownxxog", "qtwownxoxg"},
+    {":cfqqafwn", "cfqqafnw"},
+    {"ilubnc", "iulbnc"},
+    {":vpjcqhxrnu", "vpjqchxrnu"},
+    {"rimomx", "rimmox"},
+    {"qntxwvnzm", "qntxwvnmz"},
+    {"zxppopjih", "zxppopijh"},
+    {"lfaqkeyng", "lfqakeyng"},
+    {":mvezxh", "vmezxh"},
+    {"mzfheme", "mzfheem"},
+    {"zfowzzum", "zofwzzum"},
+    {"hyshcfbzhp", "hyshcfzbhp"},
+    {":vsbmbyniq", "vsmbbyniq"},
+    {"vsrngzkjs", "vsrngzjks"},
+    {"lqvves", "qlvves"},
+    {"scawwfl", "scawfwl"},
+    {"gzrmnuw", "grzmnuw"},
+    {":xplfqgfj", "pxlfqgfj"},
+    {"dmcjsadhh", "dmcsjadhh"},
+    {"upuajbt", "upuajtb"},
+    {":xrpjthzjz", "xrpjhtzjz"},
+    {":qqflxtgjiu", "qqfltxgjiu"},
+    {":pszhvhgto", "pzshvhgto"},
+    {"cjayhapcf", "cjahyapcf"},
+    {"xnnwspdpbj", "xnwnspdpbj"},
+    {":vcombicua", "vcombiuca"},
+    {"dohwnqzkpz", "dohwnqzkzp"},
+    {"vmcuwxzgz", "mvcuwxzgz"},
+    {":vvuuokx", "vvuoukx"},
+    {"ewhluo", "ewlhuo"},
+    {"wteynvxr:", "wteynvrx"},
+    {":ikysuusb", "ikyususb"},
+    {"ittcqgsv", "ittqcgsv"},
+    {"eogdlzk", "eodglzk"},
+    {"qjgxvszwfi", "qjgxsvzwfi"},
+    {"jomyrm", "jmoyrm"},
+    {"zojqpyezjg", "zojqpyejzg"},
+    {"jcuhcr", "juchcr"},
+    {"ykzcxwnqy", "yzkcxwnqy"},
+    {"hlqarz", "lhqarz"},
+    {"myyvwsz", "myywvsz"},
+    {"iszrfjc", "iszrfcj"},
+    {"tqhebb", "tqhbeb"},
+    {"lvkrxc", "lvkxrc"},
+    {":xexnqwgwl", "exxnqwgwl"},
+    {":dlqlny", "dllqny"},
+    {":jdxocuo", "jdxocou"},
+    {"eaobceaayx", "eaocbeaayx"},
+    {":wnkezmdgc", "wknezmdgc"},
+    {":fncabbgb", "fnacbbgb"},
+    {"gbazlp", "gbzalp"},
+    {"eycsfhipkz", "eycsfihpkz"},
+    {":jmhflye", "jmhfyle"},
+    {"zdkhtxeqh", "zdkhtxehq"},
+    {"bbzhwuj", "bbhzwuj"},
+    {"bmcdvuping", "bcmdvuping"},
+    {"ntkufmn", "ntkufnm"},
+    {"wllqcfvls", "wllcqfvls"},
+    {"tveuwcumz", "tveuwcmuz"},
+    {":qcjxmhd", "cqjxmhd"},
+    {"pbtjfsb", "pbjtfsb"},
+    {":qkrmria", "qkrmira"},
+    {"gcagvykadw", "gcavgykadw"},
+    {"kjsebkvonj", "kjsbekvonj"},
+    {"xhrgzzxp", "xhgrzzxp"},
+    {"mqmmjdle:", "mqmmjlde"},
+    {"uwmzqghv", "uwmzgqhv"},
+    {"hftwowx", "hftowwx"},
+    {"baxrixnh:", "barxixnh"},
+    {"qfpbrydklp", "qfpbyrdklp"},
+    {"lqwveu", "lqvweu"},
+    {"dsqwtjb", "dsqwjtb"},
+    {"viaqqaoe", "ivaqqaoe"},
+    {"uxiareu", "uxiaeru"},
+    {"fwqjdqjx", "wfqjdqjx"},
+    {"jeakasds:", "jeakadss"},
+    {"azdoxtdm", "azdotxdm"},
+    {":jhuuccdm", "jhuucdcm"},
+    {"agopdfv", "aogpdfv"},
+    {"ufunxmfbug", "ufuxnmfbug"},
+    {"dfmobupec", "fdmobupec"},
+    {"dfdvwibkn", "dfdvwbikn"},
+    {":djqzcvqx", "dqjzcvqx"},
+    {"pvghui", "vpghui"},
+    {"sncpamv", "nscpamv"},
+    {"qvlbhi", "qvlhbi"},
+    {"ogygikxqv", "ogygikxvq"},
+    {":xhamivic", "hxamivic"},
+    {"hijquk", "hiqjuk"},
+    {"mljwti", "lmjwti"},
+    {":arhsgd", "ahrsgd"},
+    {":nsqbuzuhp", "nsqbuuzhp"},
+    {"cnncjqwwfv", "cnncjqwfwv"},
+    {"pldieii", "plideii"},
+    {"xhkiex", "xhkixe"},
+    {":pogkzvbvqc", "pogkzvbqvc"},
+    {":ijtsiccuzk", "ijtsicczuk"},
+    {"eoohccq", "oeohccq"},
+    {"mnfjrhylv", "mnfrjhylv"},
+    {"uevrzzntie", "uevrzznite"},
+    {"ufeqsaxtpb", "uefqsaxtpb"},
+    {"xdyaokb", "xdayokb"},
+    {"qfreidnji", "qfriednji"},
+    {":hbhfnpdxn", "hbfhnpdxn"},
+    {"mbbbxrqle", "mbbbxrlqe"},
+    {"xmhdnw", "mxhdnw"},
+    {":isjwtyifyu", "iswjtyifyu"},
+    {"ajqthqulfx", "ajqthuqlfx"},
+    {"phyifg", "phiyfg"},
+    {"zodieb", "zodibe"},
+    {"tbdyieleee", "btdyieleee"},
+    {":yqckeudr", "ycqkeudr"},
+    {"rfkyccfk", "rkfyccfk"},
+    {":kxzharjbiu", "kzxharjbiu"},
+    {"tdvdinbs", "tdvdinsb"},
+    {"keoduvxk", "keoduvkx"},
+    {"ofammu", "oafmmu"},
+    {"higufc:", "hgiufc"},
+    {":rsgbdd", "rgsbdd"},
+    {"gypyzq", "gypyqz"},
+    {"oyemdwrke", "yoemdwrke"},
+    {"xyxfipyhfr", "xyxfiphyfr"},
+    {"gtavixbp", "gtaivxbp"},
+    {":eyajfx", "eayjfx"},
+    {"rhqrjmaga", "rhqrjmaag"},
+    {"oxdfhjamng", "oxdfhjanmg"},
+    {"nscaisfnt", "ncsaisfnt"},
+    {"fjrrfk", "fjrrkf"},
+    {"nrshhxg", "nrshhgx"},
+    {"hwwihfomp", "hwwhifomp"},
+    {"trudyugz", "truduygz"},
+    {"brrjlqnp", "rbrjlqnp"},
+    {"rkfymkg", "rkfmykg"},
+    {"nszmpj", "snzmpj"},
+    {"eahyargvh", "aehyargvh"},
+    {"igmddim", "imgddim"},
+    {"csdnzjao:", "cdsnzjao"},
+    {"bxlnlwsk", "bxnllwsk"},
+    {"tjphotcd", "tjphtocd"},
+    {":kurnbdlu", "kurbndlu"},
+    {"blswpcirb", "blswpcibr"},
+    {"igswpuncny", "igswpunncy"},
+    {":jrntauyxpn", "jrntauypxn"},
+    {"cklnsbkorl", "cklnbskorl"},
+    {"oqivhu", "oiqvhu"},
+    {"qmfhzn", "qfmhzn"},
+    {":feiuvsanvt", "feiuvsavnt"},
+    {":wtwrrakwt", "wtrwrakwt"},
+    {"viuldbdkwx", "viuldbkdwx"},
+    {":uwfunrt", "ufwunrt"},
+    {"fbyclbs", "fbylcbs"},
+    {":plztvzuwt", "plztvzutw"},
+    {":meusilbthw", "mesuilbthw"},
+    {"nijede", "niejde"},
+    {":jdurfsncu", "jdurfscnu"},
+    {"fxjjrziont", "fxjjrzoint"},
+    {"rswkkaxc", "rswkkxac"},
+    {"pnffifpkg", "pnfffipkg"},
+    {"yrgtlks", "yrtglks"},
+    {"srdkbxx", "srdkxbx"},
+    {":hqkllul", "hqklull"},
+    {"ykxbpeyfm", "ykbxpeyfm"},
+    {"xconyvnq", "xconyvqn"},
+    {":tukijpu", "tukipju"},
+    {"jobocpgi", "jobocpig"},
+    {"irffdr", "irffrd"},
+    {"ucoozei", "ucoozie"},
+    {"axceta", "axctea"},
+    {":vbtfmhd", "vbtfmdh"},
+    {"wcuzqduzf", "wcuqzduzf"},
+    {":mtzvmauavk", "mtzvamuavk"},
+    {"xgrnvsbmce", "gxrnvsbmce"},
+    {":msfnly", "smfnly"},
+    {"bbgyugsv", "bbgyusgv"},
+    {"eswipguhn", "esiwpguhn"},
+    {"fspdnuahol", "fspdnauhol"},
+    {"bfymszsw", "byfmszsw"},
+    {":hlohjvyt", "lhohjvyt"},
+    {"zbhwae", "zhbwae"},
+    {"lsiswnp", "lsiswpn"},
+    {"kmcwkmge", "mkcwkmge"},
+    {"vjpuszo", "vjpusoz"},
+    {"spyktyyhes", "psyktyyhes"},
+    {":rmhosvy", "rmhovsy"},
+    {"qtepwe", "qtepew"},
+    {"wrplvtppm", "wrplvptpm"},
+    {"oofqlli", "ofoqlli"},
+    {"ceakcbgt", "ceakcbtg"},
+    {":nidqhr", "niqdhr"},
+    {"hqvwpyriyq", "hvqwpyriyq"},
+    {"vxozgobl", "vxozgolb"},
+    {"ogljjbv", "olgjjbv"},
+    {"rhkeyourh", "hrkeyourh"},
+    {"nhacdwibp", "nhacdwipb"},
+    {"dvyrjrww:", "vdyrjrww"},
+    {"ioyjhoag:", "oiyjhoag"},
+    {"pkyfnseaqr", "pkyfnesaqr"},
+    {"nsvnqbss", "nsvqnbss"},
+    {":tlkjzavc", "tkljzavc"},
+    {"nymeddmagv", "nyemddmagv"},
+    {"rdyevotlv:", "rdyveotlv"},
+    {"ftkwkzhrjp", "ftkkwzhrjp"},
+    {"wqewfl", "qwewfl"},
+    {"fvkypq", "vfkypq"},
+    {"vgqpfuskni", "vgqpfsukni"},
+    {"ofsrcmkwv:", "ofsrckmwv"},
+    {"awkpxgo", "wakpxgo"},
+    {":hevlyrb", "hevylrb"},
+    {"scjrms", "scjrsm"},
+    {"soyfvnbcti", "soyfvnbcit"},
+    {"fqtkwp", "fqktwp"},
+    {"iziaejnpyb", "izaiejnpyb"},
+    {"doxvrbn", "dovxrbn"},
+    {"pmvdcbqw", "pmvdcqbw"},
+    {"uxsyjntbtj", "uxsynjtbtj"},
+    {"wljcxb", "lwjcxb"},
+    {"iweeio", "iweeoi"},
+    {"ebkyda", "ebykda"},
+    {"pkegylaogz:", "kpegylaogz"},
+    {"xrtkmllop", "xrtmkllop"},
+    {"ujlmyyyi", "uljmyyyi"},
+    {"wmdtlfl", "wdmtlfl"},
+    {":exurtdprt", "exurtpdrt"},
+    {"plggbxxasa", "plggbxaxsa"},
+    {"tbxxhjilnx", "btxxhjilnx"},
+    {"zdecnwao", "zdecnawo"},
+    {"motgou", "motogu"},
+    {"sfgvgilqeo:", "sfgvgliqeo"},
+    {":biqxpysepu", "biqxpsyepu"},
+    {"ttjbvv", "ttbjvv"},
+    {"mslmzoqedn", "mslmozqedn"},
+    {"nanuxhdr", "naunxhdr"},
+    {"ugekic", "uegkic"},
+    {"ieraxiqbrj", "ierxaiqbrj"},
+    {"vdldrxx", "dvldrxx"},
+    {"hdjmpunk", "hdjmpnuk"},
+    {"mpenlia", "mpelnia"},
+    {":tlqwzdredh", "tlwqzdredh"},
+    {"kuqcjliue", "kuqcjluie"},
+    {"rmfmtir", "rfmmtir"},
+    {"dasgfeir", "dasgefir"},
+    {"qnoyvuecbx", "qnoyveucbx"},
+    {"nujbqk", "nujqbk"},
+    {"kmsqfn", "kmsqnf"},
+    {"bkbhgu", "bkbhug"},
+    {"mcktez:", "mctkez"},
+    {":agiuzu", "aguizu"},
+    {"xfqqbnrhoc", "xfqbqnrhoc"},
+    {":fpypklai", "fpyplkai"},
+    {"awwsdb:", "awswdb"},
+    {"gqledwdrdl", "gqlewddrdl"},
+    {"izneny", "inzeny"},
+    {"drxvbrqgsa", "drxbvrqgsa"},
+    {"xudsmymbib", "xusdmymbib"},
+    {":rdxuxzyx", "rdxuxyzx"},
+    {"zqlsrtmpt", "zlqsrtmpt"},
+    {"wgonqyhi", "wognqyhi"},
+    {":flyvhz", "flyhvz"},
+    {":djoyuyjpj", "djouyyjpj"},
+    {"kvvwrh", "vkvwrh"},
+    {"bbdfzolqw", "bbdfzolwq"},
+    {":icmibyalk", "icimbyalk"},
+    {"ohyttznnb:", "ohtytznnb"},
+    {"cryxocrmy", "cryxorcmy"},
+    {":eedmphl", "eedmplh"},
+    {"yqzdfilzy", "qyzdfilzy"},
+    {"mihktduj", "mihtkduj"},
+    {"pohimnvga", "poihmnvga"},
+    {"udsfpxuji:", "udsfxpuji"},
+    {"wpqfyp", "wpqfpy"},
+    {":dkzqiqmz", "dzkqiqmz"},
+    {":nlpnibiclg", "nlpnbiiclg"},
+    {":srspyfopiv", "srsypfopiv"},
+    {"tepznjqh", "tepzjnqh"},
+    {"pgpdoxq", "ppgdoxq"},
+    {"peqisvyn", "peqisyvn"},
+    {"jxyomy:", "jxoymy"},
+    {"plocyzm", "plocymz"},
+    {"nkmozyddt", "nkmozydtd"},
+    {"yqdmhljkmt", "ydqmhljkmt"},
+    {"phoabuk", "phobauk"},
+    {"idrqlei", "irdqlei"},
+    {"xtqceq", "xtqcqe"},
+    {"uygddfl", "ugyddfl"},
+    {"kqpdwjlpu", "kqpdjwlpu"},
+    {"dxaratfv:", "dxraatfv"},
+    {"zhbntmo", "zhnbtmo"},
+    {"ktwglursk", "ktwgulrsk"},
+    {"dwovjpx:", "dwvojpx"},
+    {"bpbkepwwii:", "bpkbepwwii"},
+    {":gwgrpauwp", "ggwrpauwp"},
+    {"tfziuyq", "tfziuqy"},
+    {"dymjwfwhg", "dymjwwfhg"},
+    {"iacpcvta:", "iacpvcta"},
+    {"sibzgdjm", "sibgzdjm"},
+    {"qseefvpgkj", "qseevfpgkj"},
+    {"hkrivnc:", "hkrivcn"},
+    {"gnnhhpvsoi", "gnnhhpvsio"},
+    {":wahcefqu", "wahceqfu"},
+    {"fxacommz", "fxacmomz"},
+    {"vkvievzsg", "vkvievszg"},
+    {"gtofrhitni", "gtorfhitni"},
+    {"eicoaw", "ecioaw"},
+    {"easedxc", "esaedxc"},
+    {"rywhfp", "rwyhfp"},
+    {"rvjlaaf", "vrjlaaf"},
+    {"vzyeeocm:", "zvyeeocm"},
+    {"najjzpwn", "njajzpwn"},
+    {":rduoafhf", "rduoahff"},
+    {"hfvfqr", "hfvqfr"},
+    {"irpehqoljz", "irpehqojlz"},
+    {"juezobryb", "juezboryb"},
+    {"uasksecg", "usaksecg"},
+    {"naosxli", "anosxli"},
+    {"fajbyizdu:", "fajbyidzu"},
+    {":ipllpyqrg", "ipllpyqgr"},
+    {"dmbhqvwqk", "dmbqhvwqk"},
+    {"ebykdcznx", "ebykcdznx"},
+    {"itbiqsquzw", "ibtiqsquzw"},
+    {"emxbvrgkh", "embxvrgkh"},
+    {"widiutnxj:", "widitunxj"},
+    {"iqtdfkj:", "iqtdfjk"},
+    {"evhcpkyd", "evchpkyd"},
+    {"jzyqyv", "zjyqyv"},
+    {"hqkosommp", "hqksoommp"},
+    {":jizwhmiwia", "jziwhmiwia"},
+    {":kqulgqci", "kqulqgci"},
+    {"nnfcdnyv", "nnfdcnyv"},
+    {"kjojesas", "kjjoesas"},
+    {"spwpzearc:", "spwpzaerc"},
+    {"jzfapj", "jzfpaj"},
+    {"xcdpisry", "xcdpsiry"},
+    {"iwmzrt", "iwmrzt"},
+    {"fpxwvw", "fxpwvw"},
+    {"rkzfduvz", "rzkfduvz"},
+    {"xbibbv", "xbbibv"},
+    {"srrppqot", "srrpqpot"},
+    {"uyqtxnign", "uytqxnign"},
+    {"adqybqiw", "aqdybqiw"},
+    {"dyliab", "ydliab"},
+    {"thwbwopd", "thwbowpd"},
+    {"ixfkegv", "ixfekgv"},
+    {"onjagmpcl", "onjagpmcl"},
+    {"gamuheqvto:", "gaumheqvto"},
+    {"gjjgseeayn", "jgjgseeayn"},
+    {"pjseburwq", "pjsebruwq"},
+    {"avkgunbizj:", "avkugnbizj"},
+    {"nwdiox:", "ndwiox"},
+    {"kyfvopdpnp", "kyfvpodpnp"},
+    {":ocjvxkn", "ocjxvkn"},
+    {":hmjhanjbhw", "mhjhanjbhw"},
+    {"kfwrlek", "kwfrlek"},
+    {":emfcozc", "emfcocz"},
+    {"dwbmajssr", "dwbmajsrs"},
+    {"fnevjy", "fnejvy"},
+    {"hnlioieiw", "hnlioeiiw"},
+    {"lglhkggf:", "lghlkggf"},
+    {"jyjxxkc", "jyxjxkc"},
+    {"epojqkzg:", "epojqzkg"},
+    {"pfvcjlptdm", "pfvcjlptmd"},
+    {":lihewo", "liheow"},
+    {"ukledwkbde", "ukledwbkde"},
+    {"jjprkjpnej", "jjrpkjpnej"},
+    {"bofwierjc", "bofweirjc"},
+    {":cbszbsbc", "cbzsbsbc"},
+    {"iubjdwtxoc:", "iubjwdtxoc"},
+    {":lsjklsty", "sljklsty"},
+    {"yyqxdv", "yyqxvd"},
+    {":bcbrnnl", "cbbrnnl"},
+    {":yrhrxi", "yrhrix"},
+    {":qkkfyi", "qkfkyi"},
+    {":qjzlsrotk", "qjzlsortk"},
+    {"ciehtd", "icehtd"},
+    {"gncsis", "gnscis"},
+    {"lrymeexi", "lrymeeix"},
+    {"cqwrcbdje", "qcwrcbdje"},
+    {"dgosbc", "dgoscb"},
+    {"fzdwua", "fzduwa"},
+    {":ylrwfu", "lyrwfu"},
+    {":notxiisi", "ontxiisi"},
+    {"fnxnnz", "nfxnnz"},
+    {"cqjuitfj", "qcjuitfj"},
+    {"wyxcrcn", "wxycrcn"},
+    {"zfmotwemc", "zfmotwecm"},
+    {"jrsryzohgn", "jrsrzyohgn"},
+    {"uyozmwwng", "uyzomwwng"},
+    {"cwoxaonok", "cwoaxonok"},
+    {"duaoszgo", "duoaszgo"},
+    {"jmvyyzd", "jmvyydz"},
+    {"gcmielkshr", "gcmielskhr"},
+    {"voyjtrg", "vojytrg"},
+    {"caazjez", "acazjez"},
+    {"vqgroq", "vqgrqo"},
+    {"ofjyszdnrl", "ofjyzsdnrl"},
+    {":rjvutcbvc", "rvjutcbvc"},
+    {"bonypvgtb", "boynpvgtb"},
+    {":jnsonzz", "njsonzz"},
+    {"xbcgry", "xbcrgy"},
+    {"deswga", "deswag"},
+    {"ricovboyj:", "riocvboyj"},
+    {"milnjxxqgv", "mlinjxxqgv"},
+    {":gtbifhc", "gtibfhc"},
+    {"pymojwpso", "pymjowpso"},
+    {"uahfrwt", "auhfrwt"},
+    {"ylotazgvq", "ylotazvgq"},
+    {"bnqrmhrh", "nbqrmhrh"},
+    {"yxfice", "xyfice"},
+    {"fkexfrygn", "fkefxrygn"},
+    {"xzfpnxejhg", "xzfpnexjhg"},
+    {"xvswgo", "xvsgwo"},
+    {"zbjgimnm", "zjbgimnm"},
+    {"cfulgcqa", "cfulgcaq"},
+    {"bbtqsuc:", "bbtqscu"},
+    {"zrhxhix", "zrxhhix"},
+    {"cdtcedirje", "cdtcdeirje"},
+    {"lnfwndsa", "lfnwndsa"},
+    {"fluxcomddo:", "fluxcomdod"},
+    {":dfftfkn", "dfftkfn"},
+    {"ofyfvncoc", "ofyvfncoc"},
+    {"tmnldlayv", "tmnldalyv"},
+    {":ceumyksv", "ceumyskv"},
+    {"cizclkryv:", "ciczlkryv"},
+    {"uyrkxi", "uykrxi"},
+    {":yqayxih", "yqayixh"},
+    {"zroaqlqz", "zroqalqz"},
+    {"htylyvfhnu", "htylyfvhnu"},
+    {"lxfmaiabw", "lxfmaaibw"},
+    {"vzpgjog", "vzpgojg"},
+    {"fidbwvqtjx", "fidbvwqtjx"},
+    {":embtki", "ebmtki"},
+    {"dxmcvnmqy:", "dxmcnvmqy"},
+    {"sbysyzo:", "sbyyszo"},
+    {"fnbfdmjr", "fnbdfmjr"},
+    {"vzniakk", "vnziakk"},
+    {"oaqiietm", "aoqiietm"},
+    {"lktwrs", "kltwrs"},
+    {"sjlstatub", "sjlsttaub"},
+    {"jhkvvxzq:", "jkhvvxzq"},
+    {"tzqawmlja", "tzaqwmlja"},
+    {"qimwax", "iqmwax"},
+    {"inhrmjuuth:", "inhrmujuth"},
+    {"jkpyex", "kjpyex"},
+    {"sojbtozcuw", "sjobtozcuw"},
+    {"xjukudewmr", "xjukudwemr"},
+    {"xmzdlpr:", "xmzdlrp"},
+    {"cnmkkto", "cnmkkot"},
+    {"xxdtzrlp", "xxdtrzlp"},
+    {"tqqaaf", "tqaqaf"},
+    {"efurwbg", "efurbwg"},
+    {"hrdpckv", "hrpdckv"},
+    {"fdgoumvv", "fgdoumvv"},
+    {"lhdqqwnrxd", "lhdqwqnrxd"},
+    {"xjcczfsad", "xjccfzsad"},
+    {"teukfq:", "teukqf"},
+    {"ztchamq", "zcthamq"},
+    {"nqwlgtu:", "nqwgltu"},
+    {"hxsyptpc:", "hxsyptcp"},
+    {"oehaxbbhe", "eohaxbbhe"},
+    {"htkmmv", "htkmvm"},
+    {"cmfmwf", "cfmmwf"},
+    {"esxgbt", "sexgbt"},
+    {"abueltp", "abeultp"},
+    {"rhqqwv:", "rhqwqv"},
+    {":bqnmgtwx", "bqngmtwx"},
+    {"hvwovvxum", "hvwvovxum"},
+    {"wjueiw", "wjuiew"},
+    {"ydedtnlop:", "yddetnlop"},
+    {"syaapqvrcu:", "syaapqrvcu"},
+    {"molztscrp", "molztcsrp"},
+    {"jxsthjkose", "jxsthjokse"},
+    {"ljaysvnw", "ljayvsnw"},
+    {":kqaknxgyi", "kqakngxyi"},
+    {"emaysti", "emaytsi"},
+    {"ecnenfn", "ecnefnn"},
+    {"ykwtdljk:", "ywktdljk"},
+    {"uxbczreagz", "uxcbzreagz"},
+    {"uhzrkiqw", "uhzrkiwq"},
+    {"ikwgtwo", "ikgwtwo"},
+    {":xbwjvt", "bxwjvt"},
+    {":jwavvr", "jwavrv"},
+    {"nxaqjj", "xnaqjj"},
+    {"aevhsxd", "aevshxd"},
+    {"eyjfwzszic:", "eyjfwszzic"},
+    {"euarzjbad", "eurazjbad"},
+    {"gzquwowmfu", "gzquwomwfu"},
+    {"ociyekf", "oicyekf"},
+    {":yxmhgpy", "yxmhgyp"},
+    {"zpzkadt", "zpzkdat"},
+    {"srfjhbg", "srjfhbg"},
+    {"cubgatdq:", "cubagtdq"},
+    {":gyrehv", "gryehv"},
+    {"tmxyuqbobb", "tmxyqubobb"},
+    {":kldroyj", "kldoryj"},
+    {"eogaol", "eoagol"},
+    {"duaonjs", "dauonjs"},
+    {"ycosffm", "ycsoffm"},
+    {"vpnogb", "vpnobg"},
+    {"qjgyzoj", "jqgyzoj"},
+    {":fuxezmlm", "fuexzmlm"},
+    {"qkcytd:", "kqcytd"},
+    {"ihleretzvl", "ihleertzvl"},
+    {":mziuwbg", "mzuiwbg"},
+    {":kqrvmq", "kqrmvq"},
+    {"bwrksrmci", "bwrksrmic"},
+    {"hbutbt", "hbuttb"},
+    {"aglxvfiej", "algxvfiej"},
+    {"rbnpoyqbmk", "rbnpoyqmbk"},
+    {":mhpokbakt", "mhopkbakt"},
+    {"nmxxme", "nmxxem"},
+    {"qamojismx", "aqmojismx"},
+    {":bufqgjxa", "bufqjgxa"},
+    {"fgfoffyihq", "fgfoffiyhq"},
+    {"wjqclixogw", "wjcqlixogw"},
+    {"mjfffx:", "mfjffx"},
+    {"msfitddj", "msiftddj"},
+    {":fzxasre", "fxzasre"},
+    {"kbtxpj", "kbxtpj"},
+};
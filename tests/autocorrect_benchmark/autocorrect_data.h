@@ -0,0 +1,4383 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Autocorrection dictionary (2048 entries):
+//   ykcoqrz     -> kycoqrz
+//   itisfx:     -> tiisfx
+//   ucdszht     -> udcszht
+//   cxvdvpacrd  -> cxdvvpacrd
+//   :sbbkrwdjds -> bsbkrwdjds
+//   hqxppqnqg   -> qhxppqnqg
+//   svgxgaeqd   -> svggxaeqd
+//   abllwog     -> ballwog
+//   htegqt      -> thegqt
+//   svgqnmft    -> svgnqmft
+//   uimpzkcahh  -> iumpzkcahh
+//   rkxeimpbyr  -> rkxeimbpyr
+//   :mqzhldroh  -> mqhzldroh
+//   :gefztbbst  -> gefztbsbt
+//   xtitmikmyr  -> xtitmimkyr
+//   sfsvkt      -> sfsvtk
+//   vqkyxb      -> vqkxyb
+//   gewhuws     -> gehwuws
+//   ieikjo:     -> eiikjo
+//   :aehxqtvbbs -> ahexqtvbbs
+//   qxyixidemt  -> qxyixiedmt
+//   xevgrmx     -> xvegrmx
+//   :texysua    -> texsyua
+//   bdlfqdlsj   -> bdlqfdlsj
+//   ldunoapxsv  -> lduonapxsv
+//   idtekjv     -> idtejkv
+//   fadzmwt     -> fadzmtw
+//   ierwxdo     -> ierwxod
+//   :madqlzz    -> mdaqlzz
+//   :ojasov     -> joasov
+//   olfmazfjbo  -> olfmzafjbo
+//   jcnjpitax   -> jcnjiptax
+//   zikegnuyrh  -> zikegnyurh
+//   uetogcyptr  -> uetogcpytr
+//   njenqzfho   -> njenqfzho
+//   hbamnyem    -> hbanmyem
+//   lqaqpgge:   -> lqqapgge
+//   zldqua      -> zdlqua
+//   krhmaaya:   -> rkhmaaya
+//   esmixk      -> esimxk
+//   ojyfqgagvr  -> ojyfqgavgr
+//   kqgjqyxuw   -> kqjgqyxuw
+//   tetbfaadh   -> ttebfaadh
+//   lubqcu      -> lubquc
+//   :eoouvccy   -> oeouvccy
+//   :haogiok    -> hagoiok
+//   dhsymq:     -> dhsmyq
+//   umoepvwtla  -> uomepvwtla
+//   vsdafhzedg  -> vsdafhzdeg
+//   vjtgpucor   -> vjtgpuocr
+//   awcdoqk     -> awcdokq
+//   cbucsv      -> cubcsv
+//   ygnbomwhpr  -> ygnbomwphr
+//   dwifmvmlww  -> dwfimvmlww
+//   gkbzuyb:    -> kgbzuyb
+//   ieybll      -> eiybll
+//   lomacvwqfw: -> lomacvwqwf
+//   jypobt      -> jypbot
+//   lysvjtcf    -> lysvjtfc
+//   dajbgntr    -> dajbgnrt
+//   nimfweedm   -> nimwfeedm
+//   kjzycf      -> kjyzcf
+//   jtzria      -> jtzira
+//   tvzzrj      -> tvzzjr
+//   cshynf      -> cshnyf
+//   :kvxqtmb    -> kvxqtbm
+//   ppozzk      -> ppozkz
+//   :utzphijdtl -> uztphijdtl
+//   duomocy     -> duomoyc
+//   hoygvayg:   -> hoygvagy
+//   :nlfexixf   -> nlefxixf
+//   :nodfrq     -> nodrfq
+//   yldcvje     -> yldvcje
+//   tgfdyufbwh: -> tgdfyufbwh
+//   azhcgghrbv  -> azhcggrhbv
+//   tkppxqw     -> tpkpxqw
+//   bpphgfzm    -> bppghfzm
+//   merpqhrmgj  -> merpqhrmjg
+//   hxnbbok     -> hnxbbok
+//   :veogtugca  -> evogtugca
+//   :tswnrn     -> tswnnr
+//   rqcyinbrm   -> rqcyinbmr
+//   iyrpssn     -> iyrpsns
+//   jikomdgj    -> jikomdjg
+//   meydke      -> medyke
+//   avfdyq      -> avdfyq
+//   exqnfamgj   -> exqnfagmj
+//   sirlnibla   -> silrnibla
+//   :nfbldrklv  -> nfblrdklv
+//   bkmvjap     -> bkmjvap
+//   qicngp      -> qicgnp
+//   myftvsev    -> mfytvsev
+//   uzcsifqlc   -> uzcsiqflc
+//   :musyiewgb  -> musiyewgb
+//   dkeaag      -> dekaag
+//   rqbzrnaql   -> rqbzrnalq
+//   :fnesricg   -> fnesrigc
+//   cvaipgia    -> cvaipgai
+//   ozaebv      -> zoaebv
+//   jtgcmyahek  -> jtgcmyhaek
+//   rgqhftml    -> grqhftml
+//   qavkmzq     -> aqvkmzq
+//   :leizxf     -> liezxf
+//   qbuwkjrf:   -> bquwkjrf
+//   tiqqsastm   -> tiqqssatm
+//   xulcnd      -> xlucnd
+//   srpbmj      -> srpbjm
+//   xbwputf     -> xbwptuf
+//   qfqiwkdbw   -> qfqiwkdwb
+//   iczxpsnf    -> iczxpnsf
+//   dfypowijs:  -> dfyopwijs
+//   :mfyebsol   -> mfyebosl
+//   sdsfhw      -> ssdfhw
+//   tbevyo      -> tbveyo
+//   mlrqfkom    -> mlqrfkom
+//   :tpnpuifcvs -> ptnpuifcvs
+//   txtnovl     -> txtnolv
+//   otvfdla:    -> ovtfdla
+//   :zckcpdlg   -> zkccpdlg
+//   :krhofvcf   -> krhofcvf
+//   zgorpcimud  -> zgorpcimdu
+//   dropauy     -> drpoauy
+//   pswlmvi     -> pslwmvi
+//   qeehhwgby:  -> qeehhwgyb
+//   uhlpewew    -> uhplewew
+//   :sleepk     -> slepek
+//   achnitpck   -> acnhitpck
+//   :uiwguug    -> iuwguug
+//   xrsnrv      -> xrnsrv
+//   :dysiia     -> ydsiia
+//   nygyqlrg    -> nygyqlgr
+//   :oekikgdvs  -> oekkigdvs
+//   joviuo      -> ojviuo
+//   catfjv      -> ctafjv
+//   axarkzamic  -> aaxrkzamic
+//   :aqvbdoj    -> aqvbodj
+//   rmdqvol     -> rdmqvol
+//   zviypmewh   -> zvipymewh
+//   yodudhbpb   -> yoduhdbpb
+//   kxjsmpgnts  -> kjxsmpgnts
+//   lmmxpijp    -> lmmxpipj
+//   wdgtpbue    -> wgdtpbue
+//   ghusps      -> hgusps
+//   tbmcrq      -> tbmrcq
+//   :kejsntkp   -> kesjntkp
+//   sqembyb     -> sqmebyb
+//   dmcdctgt    -> dmcdcttg
+//   ginqnd      -> ginqdn
+//   :eflqozfbp  -> efloqzfbp
+//   porogcutnh  -> porogcunth
+//   nhpvhzf     -> nhphvzf
+//   lxejztzmbp  -> lxejztzmpb
+//   :skbkdivou  -> skkbdivou
+//   lyhczxb     -> lyhcxzb
+//   :dhpbsy     -> dphbsy
+//   wlkaijj     -> wlakijj
+//   zspkhk      -> zsphkk
+//   vvapyswixg  -> vvapyswigx
+//   :mpggdbxs   -> mpggbdxs
+//   ovwcnl      -> vowcnl
+//   zyucrfi     -> zycurfi
+//   :ipnpbe     -> ippnbe
+//   lfwtfkqa    -> lwftfkqa
+//   :iptsnqszp  -> itpsnqszp
+//   vhokoaosxz: -> vhokoaoxsz
+//   guekovqej   -> geukovqej
+//   jizlybtuk   -> jizlytbuk
+//   dcvxifysqx  -> dcxvifysqx
+//   lnjeqpbsyl  -> lnjeqpbsly
+//   dngsrarg    -> dngsarrg
+//   wtoywy      -> wtoyyw
+//   :ugcgcs     -> gucgcs
+//   :vfyulq     -> vfuylq
+//   waxkaklss   -> waxkkalss
+//   ayrwerxqp   -> ayrwexrqp
+//   gcicvi      -> gccivi
+//   iaxltt      -> ixaltt
+//   qexicpi     -> eqxicpi
+//   ttqmya      -> tqtmya
+//   :ozobavk    -> ozoabvk
+//   knfewuxm    -> knefwuxm
+//   crtusgoo    -> crtusogo
+//   :rumsuoi    -> rumsuio
+//   vahwhd      -> avhwhd
+//   yjspkrao    -> jyspkrao
+//   szbayuvg    -> sbzayuvg
+//   zajazw:     -> zjaazw
+//   :hipnfoarpb -> hipnfoarbp
+//   ijlmhbojqt: -> ijlmhbjoqt
+//   kqddvggst   -> kqddvgsgt
+//   yrdpldtl:   -> ydrpldtl
+//   lydleo      -> yldleo
+//   :cnwedql    -> cwnedql
+//   bvqlic      -> bvlqic
+//   :pvrzlxfxw  -> pvrlzxfxw
+//   sawsfs      -> saswfs
+//   vyzdgqa     -> vzydgqa
+//   isvldgbgof: -> ivsldgbgof
+//   pwvugrahx   -> wpvugrahx
+//   :btzvfqfqef -> btzvfqqfef
+//   llkbtlyrn   -> llkbtlynr
+//   zihnoxphy   -> zihonxphy
+//   urqbye      -> uqrbye
+//   :ihtxywy    -> ihxtywy
+//   zrtgonat    -> zrtgnoat
+//   oiukruxftv  -> oiukurxftv
+//   kgzswyuqdg  -> gkzswyuqdg
+//   cztcxlyhwk: -> cztclxyhwk
+//   sbrkcic     -> sbrkicc
+//   hpfbeyldkn  -> phfbeyldkn
+//   smxmevj     -> smmxevj
+//   :jjrmpxy    -> jjrmpyx
+//   yibqoj      -> yibqjo
+//   ggoqgvue    -> ggoqguve
+//   khxcaxus    -> khxacxus
+//   :qgadazpsvp -> qgadazpspv
+//   rzajxjkige  -> rzaxjjkige
+//   pxecduid    -> pxecdudi
+//   iaazqkcdx   -> iaazqkdcx
+//   vnizagtc    -> vnizatgc
+//   rpaooq:     -> rpaoqo
+//   cwovpqkvff  -> cwovpqvkff
+//   lshcxo      -> lhscxo
+//   ekjcee      -> kejcee
+//   bhnnthvtx:  -> bhnnhtvtx
+//   vtszwpzzyv  -> vtswzpzzyv
+//   :qcpgsmtux  -> qcgpsmtux
+//   :zmwzcyw    -> zwmzcyw
+//   :ttuqzhat   -> ttuqzaht
+//   fbnjdeucfz  -> fbnjeducfz
+//   oydrrsspja  -> odyrrsspja
+//   qywestybqp  -> qywestybpq
+//   :cenyolfvy  -> cneyolfvy
+//   jyhofjoaz   -> jyhofjaoz
+//   gauuyscv    -> guauyscv
+//   usodewnvfw  -> suodewnvfw
+//   ipmhdl      -> pimhdl
+//   qpwvlsr     -> qpwlvsr
+//   bessbcuuu   -> besbscuuu
+//   gcwgigre    -> gcgwigre
+//   dwyiuuvvj   -> wdyiuuvvj
+//   gcldrih:    -> cgldrih
+//   ukmemwpdbg  -> ukmemwpdgb
+//   qswiyy      -> sqwiyy
+//   uqylcghn    -> quylcghn
+//   kcqlaop     -> kcqalop
+//   :gszfaevtuv -> gszafevtuv
+//   qmalzmt:    -> mqalzmt
+//   :rgxgsdp    -> rgxgdsp
+//   qpbzgjin    -> qpbzgijn
+//   gkkoavmdqu  -> gkkoamvdqu
+//   hrqwzoqy    -> hrqwzoyq
+//   unxbavczti  -> unxbacvzti
+//   kdhscosxa   -> kdhsocsxa
+//   :lygnhdgr   -> lygnhdrg
+//   :iuqdewiq   -> iuqedwiq
+//   ccwwlf      -> ccwwfl
+//   qnkqdxlub   -> qknqdxlub
+//   akekxrjt    -> akkexrjt
+//   clgckepsu   -> clgckepus
+//   bxxtdsyap   -> bxxtdysap
+//   zlvdtnii    -> zvldtnii
+//   :grqcuqhkw  -> grqcquhkw
+//   evwlyz      -> vewlyz
+//   :raqpmalwm  -> rqapmalwm
+//   kczoeays    -> kczoeyas
+//   :asxnnaqukj -> asxnnqaukj
+//   muqgycahg   -> muqgyachg
+//   sjuyqabc    -> sjuqyabc
+//   uzbfvz      -> zubfvz
+//   :sjhnlomx   -> sjhnolmx
+//   gfiyeckwba  -> fgiyeckwba
+//   wnlqpl      -> nwlqpl
+//   lpnfpcnckm  -> lnpfpcnckm
+//   xoldan:     -> xodlan
+//   wpzyfzp     -> wpzfyzp
+//   rywmgn      -> rywmng
+//   rkfooo      -> rkofoo
+//   wzmohezw    -> wmzohezw
+//   yirmlkwn    -> yirmklwn
+//   gxedidzo    -> gxdeidzo
+//   soptsar     -> soptsra
+//   :nomjgbfja  -> nmojgbfja
+//   yyrxzljhl   -> yyrxlzjhl
+//   :psusfle    -> psusfel
+//   lkvvli      -> klvvli
+//   ukdqnlik    -> ukdqnilk
+//   hompaxdf    -> hmopaxdf
+//   irpfoxecqz  -> irpofxecqz
+//   mxblvou     -> mxblovu
+//   frkdkg      -> frkdgk
+//   rahymv      -> rahmyv
+//   xhpmrjj     -> xhpmjrj
+//   imijyv      -> miijyv
+//   tcsmrzspbw  -> tcsmrzsbpw
+//   qnqloobswd  -> qqnloobswd
+//   hilgukdoxn  -> hilugkdoxn
+//   hyifrorsul  -> hyifrosrul
+//   mqhnukmhk   -> mqhnumkhk
+//   :skytjph    -> syktjph
+//   gmpiwjgw    -> gmipwjgw
+//   hkavtxity   -> hkavtxiyt
+//   rpbapzlrp   -> rpbapzrlp
+//   hirkhva     -> ihrkhva
+//   iiutvysr    -> iuitvysr
+//   aaflzcxilp  -> aafzlcxilp
+//   qvlsxmw     -> qvlxsmw
+//   :qyxrwzuqra -> qyxwrzuqra
+//   myglrlig    -> mygrllig
+//   kavkvh      -> kvakvh
+//   urcrfruycd: -> urcrfruydc
+//   adkhfhfu    -> adkfhhfu
+//   qqprgj      -> qqpgrj
+//   vkxgxd      -> kvxgxd
+//   lomytnf     -> lomyntf
+//   stgpoeci    -> stgopeci
+//   idzdgy      -> idzgdy
+//   :bhdzmgu    -> bhdmzgu
+//   ixohnfcxj   -> ixohnfcjx
+//   :mrfsetqucn -> mrfsetqunc
+//   :osdyrzwt   -> osydrzwt
+//   oqwqksy     -> oqwqsky
+//   nhekknm     -> nheknkm
+//   vgvudisis   -> vgvudsiis
+//   eylmxpygrf  -> elymxpygrf
+//   hmqslgyji   -> hmqslgjyi
+//   gshzaqjzd   -> gshzajqzd
+//   hdvxqdcbwp  -> hdvxqdcwbp
+//   :icctean    -> icctena
+//   lcplcnel    -> clplcnel
+//   tfhjpcbc:   -> tfhjpccb
+//   bikvwtcl    -> bikwvtcl
+//   qxeljdgawn  -> qxejldgawn
+//   duhscpj     -> dushcpj
+//   :qfqgfo     -> qfgqfo
+//   qfljjxbf    -> fqljjxbf
+//   tdncbrsqrc: -> tdncrbsqrc
+//   :fhmprt     -> fhmptr
+//   wgecjbbuo   -> wgecjbubo
+//   npptfkm     -> nppftkm
+//   :rcecitobqr -> crecitobqr
+//   :wprflp     -> wprlfp
+//   uytipeq:    -> uytpieq
+//   vnkyuvhny   -> vnykuvhny
+//   fsuhzdty:   -> fsuzhdty
+//   owuxdxxs    -> owudxxxs
+//   fgxpqn      -> fgxqpn
+//   fbqmxjs     -> fbqxmjs
+//   vxnvgpdptz  -> vxnvgpdtpz
+//   bnxgawkge   -> bxngawkge
+//   :oosnsk     -> osonsk
+//   gfytalmxe   -> gyftalmxe
+//   tvcbxtekgt  -> tvcbxtegkt
+//   rtlvnay     -> rtlvany
+//   qdyuyplzd   -> dqyuyplzd
+//   aowabtfep   -> aowabtefp
+//   prbacklysp  -> prbacklsyp
+//   rrmpsaazyt  -> rrmpasazyt
+//   vogilz      -> voiglz
+//   ulthntzrw   -> luthntzrw
+//   :qokuktyw   -> qokuktwy
+//   :szjkhiha   -> szkjhiha
+//   laupjlly:   -> lapujlly
+//   hkwotcifj:  -> hkwtocifj
+//   jdggoeq     -> jdggoqe
+//   :ktjwwx     -> kjtwwx
+//   :vwgwnmghzy -> vwgwmnghzy
+//   :dssyqfh    -> sdsyqfh
+//   cudjskjlwc  -> cudsjkjlwc
+//   gzeomrjvy   -> gzeomrjyv
+//   gbgtgsd     -> ggbtgsd
+//   lkzcdqwz    -> klzcdqwz
+//   oymkypxc    -> oymykpxc
+//   hdwktfngfs  -> dhwktfngfs
+//   spudhuw     -> spuduhw
+//   umpahco     -> mupahco
+//   olfkojx     -> oflkojx
+//   :vubasixrob -> vubasixorb
+//   txhtslfs    -> txhtlsfs
+//   mzpvatyvcr  -> mzpavtyvcr
+//   :jgasihz    -> jagsihz
+//   lcsscqucsz  -> lcscsqucsz
+//   :frecff     -> frceff
+//   oxawhe      -> oxahwe
+//   vgisxf      -> vgsixf
+//   :hdyaqdl    -> dhyaqdl
+//   eqskce      -> esqkce
+//   ceeplpfzd   -> ceeplpfdz
+//   ifbohq      -> ifbhoq
+//   :mqkshqhdwj -> mqskhqhdwj
+//   mlsfvlmfj   -> mslfvlmfj
+//   vzoplqvnsz  -> vozplqvnsz
+//   iuttpzip    -> iuttzpip
+//   pxgogo      -> pxoggo
+//   vjtqegmnk   -> vjtqegmkn
+//   mjryxbfi    -> mjryxbif
+//   wpxcxeii    -> wpxcxiei
+//   :nhagdphkx  -> nahgdphkx
+//   :hseoeir    -> sheoeir
+//   :xkixms     -> kxixms
+//   nuydzp      -> nuydpz
+//   fzvmsxc     -> fzvmxsc
+//   tmskwbj     -> tmswkbj
+//   dlbmkmfohg  -> ldbmkmfohg
+//   bvunwrmcgf: -> bvunwrmcfg
+//   wuxzvvuzwf  -> wuzxvvuzwf
+//   rvzctxdr    -> vrzctxdr
+//   :wkzwqbnsl  -> kwzwqbnsl
+//   qlgslc      -> lqgslc
+//   pgwkmkogyp  -> pgkwmkogyp
+//   ilswrptv    -> islwrptv
+//   :zomcrp     -> zomcpr
+//   mlfjvgrdy   -> mlfjvgryd
+//   ufafsodqu   -> uaffsodqu
+//   gznyfqp     -> gzynfqp
+//   :pacrikgo   -> pacrikog
+//   kirrxsdy    -> kirrxdsy
+//   cpmelduk    -> cpmeludk
+//   npbqgdeix   -> npqbgdeix
+//   mdndlvf     -> dmndlvf
+//   bewvggafvl  -> bewvggaflv
+//   erizrby     -> erizryb
+//   jjbfir:     -> jjbfri
+//   :ymbypje    -> ymbpyje
+//   schsnz      -> cshsnz
+//   scjjebvui   -> csjjebvui
+//   xvdutmyoi:  -> xvdumtyoi
+//   :ktyuuozo   -> tkyuuozo
+//   wqiixb      -> wiqixb
+//   jxezsnu     -> xjezsnu
+//   pdncobm     -> pdncbom
+//   qxrghwocfx  -> qxrghwocxf
+//   :xfbobxfqt  -> xfbobxqft
+//   msdohr      -> mdsohr
+//   wcapbqbwzb  -> wacpbqbwzb
+//   kcidllwb:   -> kcidllbw
+//   bwqirzjilg: -> bwqirzjlig
+//   bhfwgzd     -> bfhwgzd
+//   oprkojmq    -> orpkojmq
+//   rpmrcftszz  -> rmprcftszz
+//   eikokqcx    -> eikokqxc
+//   kotgcx      -> kotcgx
+//   hmlblpo     -> hmlblop
+//   :vjridcevz  -> vjirdcevz
+//   qdnbubsohg  -> qdnbbusohg
+//   xyxzkbignm  -> xyxzkbginm
+//   bqfireyoq   -> bqfireyqo
+//   :xdzyjuxk   -> xzdyjuxk
+//   pisrzc      -> ipsrzc
+//   xepspeoqzq  -> xesppeoqzq
+//   zstzgwmx    -> sztzgwmx
+//   heapgnn     -> heapngn
+//   upyhom      -> uphyom
+//   ktqybn      -> ktqbyn
+//   javornowx   -> ajvornowx
+//   bqjpnjika   -> bqjpnijka
+//   ptmrufi     -> ptmurfi
+//   ssyanxuse   -> ssaynxuse
+//   rtevmvu:    -> retvmvu
+//   gpobhng     -> gpobhgn
+//   :grbnnqxcpd -> grbnnxqcpd
+//   xjhnjtqb    -> xjhnjtbq
+//   zyojwdu:    -> zyojdwu
+//   tjoezeylj   -> tjozeeylj
+//   :xgoshglzeg -> xgoshgzleg
+//   :hwuekloz   -> hwuekolz
+//   pdjzwogym   -> pdjzwgoym
+//   pxzeuw      -> pxezuw
+//   nfamea      -> nfamae
+//   hxynenii    -> hyxnenii
+//   xcegqpnjd   -> xcegqpndj
+//   zeaczi      -> zecazi
+//   nwqbpaqy:   -> nwqpbaqy
+//   jzkkeb      -> jzkkbe
+//   qijemqar    -> qiejmqar
+//   qjpttfj     -> jqpttfj
+//   sbfbvi:     -> sbbfvi
+//   lwkwvzzkki  -> lwkwvzzkik
+//   xfmdsfas:   -> xfmdsfsa
+//   apopqq      -> appoqq
+//   dfydrycb    -> dyfdrycb
+//   bpgoik      -> bgpoik
+//   hgzqtket    -> hgqztket
+//   lqcrpcowkd  -> lqcrpcwokd
+//   nyejmhqduh  -> ynejmhqduh
+//   yqnqph      -> yqnpqh
+//   pdaoqcthxl  -> pdaoqctxhl
+//   cpuemaqjxj  -> cpuemaqxjj
+//   icehrndsmv  -> icehnrdsmv
+//   ronewojnf   -> roneowjnf
+//   hvhqgguhna  -> hvhqgughna
+//   :tdxodyj    -> txdodyj
+//   :xpxeiqdq   -> xpxieqdq
+//   ctvxsrl     -> ctvxrsl
+//   tbwulvexnq  -> tbwulevxnq
+//   zwcuqw      -> wzcuqw
+//   qqvaup      -> qvqaup
+//   :remxssf    -> remxsfs
+//   owwonouap   -> owwoonuap
+//   wxfqchu     -> wxfqcuh
+//   hodrjfeppf  -> hodrjfpepf
+//   :irjexzqesk -> irejxzqesk
+//   wzlvtrni    -> wlzvtrni
+//   zdkjcyk     -> zdjkcyk
+//   uppqwlt:    -> uppqwtl
+//   hafhuaokfz: -> hafhuakofz
+//   :kekpuvxo   -> kekpvuxo
+//   jxbwobf     -> xjbwobf
+//   ztzlvc      -> ztzlcv
+//   ddtdyrj:    -> ddtdryj
+//   :pzubsaxvg  -> pzubsavxg
+//   owgsktf     -> owgstkf
+//   ciqyabqj    -> ciqyaqbj
+//   uudgzny     -> uudgnzy
+//   gzodomy     -> gzoodmy
+//   ghcpvmt     -> ghcvpmt
+//   wmmtrp      -> wmtmrp
+//   lrgdjfmo    -> lrgdfjmo
+//   kkwhigcj    -> kkwhgicj
+//   gwayoefj:   -> gwaoyefj
+//   :ezfjrif    -> ezfrjif
+//   szxbvo      -> szxvbo
+//   hyntlu      -> hynltu
+//   rhipyaao    -> rhipyaoa
+//   vccpou      -> vccpuo
+//   fiilyi      -> fiiyli
+//   rtekpd      -> trekpd
+//   njsihpo     -> jnsihpo
+//   pxzkcry     -> pxzkrcy
+//   chmdkljm    -> cmhdkljm
+//   twjsbfnnm   -> wtjsbfnnm
+//   :zfcejcdyri -> zfcejcdryi
+//   mkimnlroa   -> mkimnlrao
+//   gaqblmr     -> gabqlmr
+//   qedvvtjzn   -> qedvvjtzn
+//   dbwflvfhf   -> bdwflvfhf
+//   ykjzig      -> ykjizg
+//   pykefm      -> pykfem
+//   ubfddbzy    -> ubdfdbzy
+//   kpwyprll    -> kwpyprll
+//   gncwcgrk    -> ngcwcgrk
+//   fcanfnhqs   -> fcafnnhqs
+//   mefyyvaxa   -> mefyyvxaa
+//   pbotgg:     -> pbtogg
+//   ewulwtatqz  -> ewulwttaqz
+//   egyihtkmn   -> geyihtkmn
+//   sfulydef    -> sfuldyef
+//   xedniuamix  -> xedniaumix
+//   :nldpxh     -> lndpxh
+//   sdfzjiuvn:  -> sdzfjiuvn
+//   annqbxqe    -> annqbqxe
+//   rdxutlblo:  -> rdxutlbol
+//   nioroka     -> nioorka
+//   uygacyrz    -> ugyacyrz
+//   :nbbbriliq  -> nbbbirliq
+//   :flmtcgmk   -> lfmtcgmk
+//   zztpltdfge: -> ztzpltdfge
+//   vkjaxdj     -> kvjaxdj
+//   rqxphldqg   -> qrxphldqg
+//   cwgmixs     -> cwmgixs
+//   cwtixkmczb  -> cwitxkmczb
+//   :gjqaspcr   -> gjqsapcr
+//   eqcdcngz    -> eqccdngz
+//   yqjmantygq  -> yqjamntygq
+//   vemhcjjbkf  -> vemchjjbkf
+//   jhkpuuuazy: -> jhkpuuuayz
+//   :aadoqlkiso -> aadqolkiso
+//   xxcamq      -> xcxamq
+//   yvtiyhpbm   -> yvtyihpbm
+//   spuuojqia:  -> spuujoqia
+//   :zyklki     -> zylkki
+//   dwptbgvxh:  -> dpwtbgvxh
+//   eecivj:     -> eecvij
+//   wcojkwzzf   -> wcojkwzfz
+//   ndsaml:     -> ndsmal
+//   vchjoop     -> vchjopo
+//   lgajfzzue   -> lgajzfzue
+//   :azyhaxodsh -> ayzhaxodsh
+//   vwpmktjkz   -> vpwmktjkz
+//   efzyaterak  -> efzytaerak
+//   vdbihwlnl   -> vdbihwnll
+//   :jfhcncqrbh -> jfhcncqbrh
+//   ylruxr      -> ylrurx
+//   :vfrlmpspxw -> vfrlmppsxw
+//   :ofcuydh    -> focuydh
+//   :nrprwcge   -> nrrpwcge
+//   xmjwier:    -> xmjwire
+//   jqedwsi     -> jqedswi
+//   bhpferxa    -> hbpferxa
+//   qmaqorrpjr  -> qmaqorprjr
+//   zyvitioc    -> zyvitico
+//   xzuonrwfa   -> xuzonrwfa
+//   dekehyjkm   -> dekheyjkm
+//   lugzwtv     -> lguzwtv
+//   urdgvweff   -> rudgvweff
+//   regescfy    -> regescyf
+//   :dcfiust    -> dcfuist
+//   cmukrrojh   -> mcukrrojh
+//   :onfypxchj  -> ofnypxchj
+//   ephoafn     -> epohafn
+//   :hixyxqidh  -> hixyqxidh
+//   oqbtlo      -> qobtlo
+//   aanwmjs     -> aanwmsj
+//   trpxfpzbf   -> trpxpfzbf
+//   rzhdmu      -> rzhmdu
+//   yxoiln      -> yxoinl
+//   qjdoqqrk    -> qjdoqqkr
+//   obnrpkcdj:  -> onbrpkcdj
+//   pnlhrgd     -> pnlhgrd
+//   wtiigrhsk   -> witigrhsk
+//   :hppsbznejs -> hppsbznesj
+//   rcgomnnq:   -> rcgmonnq
+//   dneuww      -> ndeuww
+//   lsyuwid     -> lsyuwdi
+//   rwwnzhc     -> rwwznhc
+//   :pvjngkuhw  -> vpjngkuhw
+//   :vqfmlqzmh  -> vqfmlqmzh
+//   sgogjjwcqb  -> gsogjjwcqb
+//   alrdinf     -> arldinf
+//   tvxeaj      -> tvxaej
+//   chhzqt      -> chhqzt
+//   :pptkvbqlkj -> pptkvbqljk
+//   mxagtbiib   -> mxatgbiib
+//   bxwrputwa   -> bxwprutwa
+//   ejlbhnoe    -> ejlbhone
+//   gqxnckphcf  -> qgxnckphcf
+//   fmvqdwsapp  -> fmvqwdsapp
+//   jadjuwq     -> jadjwuq
+//   bidthelmlv: -> ibdthelmlv
+//   fkccgffhdz  -> fkccgffdhz
+//   ooilwmuyog  -> ooilwmyuog
+//   :anpimllu   -> anpmillu
+//   :ytkbmgpbpp -> ytkmbgpbpp
+//   gdvbavani   -> gdvabvani
+//   okwcuym     -> okwcumy
+//   :mbmesn     -> bmmesn
+//   qsffofzwdi: -> sqffofzwdi
+//   :ckmsppetjy -> ckmspptejy
+//   :jnsozht    -> jnszoht
+//   rlsgsng     -> rlsgsgn
+//   pieuyd      -> piueyd
+//   vkkdhx:     -> vkkdxh
+//   dscefverz   -> dcsefverz
+//   asmmiuxgy   -> asmmuixgy
+//   hdaoxxebx   -> dhaoxxebx
+//   :volyqyz    -> ovlyqyz
+//   szcdbv      -> szcbdv
+//   bdlzrhrd    -> bdzlrhrd
+//   ermkkgaz    -> ermkgkaz
+//   aqzwyiht    -> qazwyiht
+//   :sfwcbf     -> sfwbcf
+//   uijvnemnyk  -> uijnvemnyk
+//   hzkirhi     -> hzkihri
+//   wnhrsegbbo  -> wnrhsegbbo
+//   oiqcrroxk   -> oiqcrrxok
+//   cqyjbrybg   -> cqyjbrygb
+//   ixduzsvl    -> ixudzsvl
+//   ulsiydr     -> ulsyidr
+//   pthrkd      -> ptrhkd
+//   xgwcsgkylg  -> gxwcsgkylg
+//   :qemneq     -> qemnqe
+//   unbyoqu     -> ubnyoqu
+//   bjmgjrao:   -> bjmjgrao
+//   azeutjqmtv  -> azeutqjmtv
+//   :ucvaxyt    -> uvcaxyt
+//   plyjas      -> plyjsa
+//   hsmyyfbk    -> hsmyybfk
+//   ywokscde    -> ywoksdce
+//   smyumpyq    -> smyumypq
+//   hwqxblj     -> whqxblj
+//   ucvgkc      -> ucvgck
+//   yifgjsz     -> yifgjzs
+//   idimfkxybb  -> idimfkxbyb
+//   wsbifsr     -> wsibfsr
+//   kbuztjnqti  -> kubztjnqti
+//   adlpod      -> aldpod
+//   plyraonccm  -> plryaonccm
+//   :ozwnbxvjmd -> ozwnxbvjmd
+//   mtsquh:     -> mtsuqh
+//   :bautam     -> bauatm
+//   onhdpq      -> nohdpq
+//   rqxuphavmu  -> rxquphavmu
+//   tlwrkx:     -> tlwkrx
+//   pdcdsd      -> dpcdsd
+//   azwfgcna    -> awzfgcna
+//   waxzklson   -> wazxklson
+//   sgipmnp     -> sgipnmp
+//   :akjywx     -> akjwyx
+//   bbtcnasmn   -> bbtcnasnm
+//   kvghiz      -> vkghiz
+//   ksbyhfvokp  -> ksbyhfvopk
+//   qlzbwdy     -> qlzbdwy
+//   rvuleru     -> ruvleru
+//   mchpdcel    -> mchpcdel
+//   vfvhyfhnfb  -> vfvhyhfnfb
+//   :mgjikxjarf -> gmjikxjarf
+//   fyrdvfni:   -> fyrvdfni
+//   cbyjafma    -> cybjafma
+//   ddwiar      -> ddwair
+//   ppxxmoztpl  -> ppxxmozptl
+//   mnupakqctg  -> mnupakcqtg
+//   ukscsdeju:  -> uksscdeju
+//   tydbtkn:    -> ytdbtkn
+//   kczzqep     -> kczqzep
+//   scokvst     -> scokvts
+//   smasnyu     -> samsnyu
+//   ysiszfjha   -> ysiszfhja
+//   hyagivs     -> yhagivs
+//   vpbhyhe     -> vbphyhe
+//   cdoehxc     -> cdeohxc
+//   koxkdi      -> kokxdi
+//   chvjiwxmb   -> hcvjiwxmb
+//   wuqodo      -> wuqood
+//   udizjfg     -> udijzfg
+//   iatbluzzhh  -> iatblzuzhh
+//   kgmtux      -> kgtmux
+//   jrggpubz    -> jrgpgubz
+//   xnvnlh      -> xvnnlh
+//   :yoxbdsa    -> yobxdsa
+//   ogdckuzij   -> odgckuzij
+//   utfhhlimf:  -> utfhhilmf
+//   xhxotk      -> hxxotk
+//   lzficczf    -> lzfciczf
+//   gwrmzh      -> gwmrzh
+//   gukprdbv    -> gukprbdv
+//   bkvvtvi     -> bvkvtvi
+//   :dcrtkyohvt -> dcrtykohvt
+//   phvorl      -> phovrl
+//   ywpaaecsu   -> ywpaaecus
+//   :ysnjdmxmlr -> ysnjdmxmrl
+//   tqzvdiedf   -> tqzvdeidf
+//   nbxubfpgw   -> bnxubfpgw
+//   hsgana      -> hsgnaa
+//   enebkyidgv  -> enebkyigdv
+//   bcryhwj     -> cbryhwj
+//   xrbrmi:     -> xrrbmi
+//   :ssivmnx    -> ssivnmx
+//   ylxbmc      -> yxlbmc
+//   ilqctlikz   -> ilqtclikz
+//   smqyzjbng   -> smqyjzbng
+//   bvpztchv    -> bvpztcvh
+//   yvufnh      -> vyufnh
+//   txrorbsm    -> txrorbms
+//   yyuhim      -> yyuhmi
+//   dsarbmgr    -> dsrabmgr
+//   ekqsteq:    -> eqksteq
+//   vlnkalj     -> vlnaklj
+//   xbcnorot    -> bxcnorot
+//   :zgwzmyq    -> zgwmzyq
+//   :fepjloj    -> fepjolj
+//   zexwdadnh   -> zexwdandh
+//   acroxpg     -> acropxg
+//   fysskqscg   -> fsyskqscg
+//   hjwmqa      -> jhwmqa
+//   byuowuve    -> byuwouve
+//   ehxjceqiqh  -> exhjceqiqh
+//   mkgofd      -> mkgodf
+//   hpuylunqo   -> hpuyulnqo
+//   kgantoowrc  -> kgantoworc
+//   klibiw      -> klbiiw
+//   wygicpsgju  -> wgyicpsgju
+//   uqioar      -> uqiaor
+//   qzeavulrhn  -> qzeavulhrn
+//   kxhuihi     -> kxhuhii
+//   hxdxnavbfk  -> hxdxnavfbk
+//   :xtbdcmzyw  -> xtdbcmzyw
+//   ugljuapf    -> guljuapf
+//   kzmbrpx     -> zkmbrpx
+//   fjgljhjkcw  -> fjgljjhkcw
+//   kunoslpaql  -> kuonslpaql
+//   xgldmy      -> xlgdmy
+//   tegkhbiceq  -> etgkhbiceq
+//   :rigklpkrnz -> rigkplkrnz
+//   ejuluvc     -> ejuulvc
+//   ijgbexkff   -> ijgbexfkf
+//   xcqxcwp:    -> xcxqcwp
+//   epwaeajeoc  -> epwaejaeoc
+//   cjdsebr     -> cjdserb
+//   mmqbqzezjb: -> mmqbqzejzb
+//   cuvacapqx   -> cuvaacpqx
+//   fayzprdfvt  -> fazyprdfvt
+//   elkicr      -> eklicr
+//   mlvotydd:   -> mlvotdyd
+//   wifwjy      -> iwfwjy
+//   iulcqa      -> iulcaq
+//   ztvofxqxo   -> ztvofxxqo
+//   dmdjixqi    -> dmdjixiq
+//   bagnwdbq    -> bangwdbq
+//   ysaxzxpshr  -> ysaxzxphsr
+//   scujzfvcwr  -> scujzfvwcr
+//   duyaindj    -> duyanidj
+//   :lrpwtvlrvg -> lrpwtvrlvg
+//   gvbsakwav   -> gbvsakwav
+//   stgbktvsvy  -> stgbkvtsvy
+//   :qieehbmvgu -> qieehbmgvu
+//   :ygmimz     -> ygimmz
+//   :qgjmabbgf  -> qjgmabbgf
+//   daslikjxh:  -> daslkijxh
+//   acmjqona    -> acmjqoan
+//   mwkpfimm:   -> mkwpfimm
+//   gwtrlyvd:   -> gwtrlvyd
+//   vtfaltxr    -> vftaltxr
+//   xehamrwrd   -> xheamrwrd
+//   adqngkciwo  -> daqngkciwo
+//   mmmtbnpl    -> mmmtbpnl
+//   kxkuqmdp:   -> kxkuqmpd
+//   sjhvledh    -> sjhvldeh
+//   pxukjbtdc   -> pxukjbdtc
+//   yuwbemzij   -> yubwemzij
+//   cigxnnzjgr  -> cigxnnjzgr
+//   autoxbx     -> auotxbx
+//   lxnmxkbip   -> lxnmxkibp
+//   dvzvmqdt    -> dvzmvqdt
+//   uagtfigo:   -> uagtfgio
+//   :wjburgltfg -> wjbrugltfg
+//   :tgwfvxdov  -> tgwfxvdov
+//   bcloec      -> bcloce
+//   :kntfoakp   -> nktfoakp
+//   bpgjcz      -> bgpjcz
+//   :wbpjulo    -> wbpjluo
+//   tneckj:     -> tncekj
+//   lqdxdlaz    -> qldxdlaz
+//   zkqznmp     -> zqkznmp
+//   pqtmydnqx   -> pqtmyndqx
+//   idoguufdy   -> idoguudfy
+//   hbodwecu    -> hbowdecu
+//   hjbxop      -> hjbxpo
+//   ljprpx      -> ljrppx
+//   hxlnjx:     -> hxnljx
+//   zejwlkfi    -> ezjwlkfi
+//   ewluov      -> weluov
+//   :loxytbog   -> loxybtog
+//   :kwqeoix    -> kwqeiox
+//   xfjzwpqm    -> xfzjwpqm
+//   eenhfwiau   -> eenhwfiau
+//   kbfwowlhuc  -> kbfowwlhuc
+//   uwslsvksdy  -> uwslsvkdsy
+//   :uaakzsaqzo -> uaakzsazqo
+//   kpfkunujvu  -> kfpkunujvu
+//   :tbzokkelhe -> tbozkkelhe
+//   tqqlma      -> qtqlma
+//   xmyqzgiadh  -> mxyqzgiadh
+//   lsodmy      -> slodmy
+//   :cemhhkdz   -> cemhhdkz
+//   nucxgelwg   -> nucxgewlg
+//   :mknhbba    -> mkhnbba
+//   qbxzsn:     -> bqxzsn
+//   gxnlcif     -> gxnclif
+//   sbjbgvmna   -> sjbbgvmna
+//   csinoy:     -> csiony
+//   qhtonk:     -> qthonk
+//   :wkzatfxdhx -> wzkatfxdhx
+//   :igsiuckcj  -> igisuckcj
+//   zlyykxa     -> zlyykax
+//   qtspdm      -> qtsdpm
+//   :gjknnis    -> gjknins
+//   ljygcvbvo   -> ljygvcbvo
+//   rdobpoc     -> rdbopoc
+//   hqmldha     -> hqmdlha
+//   rpvehuvk    -> rpveuhvk
+//   qqzpvvl     -> qqzvpvl
+//   qrxcza      -> qrxzca
+//   cefwgugwee  -> cefwuggwee
+//   nbuxpkznx   -> nbuxkpznx
+//   cfeuky      -> cfueky
+//   iegcagwvft: -> iegacgwvft
+//   :pygnex     -> ypgnex
+//   :rkloek     -> rkolek
+//   folynad     -> folyand
+//   ociipe      -> coiipe
+//   :kveruxb    -> kveurxb
+//   cmiuylmu    -> mciuylmu
+//   dgpfugyh    -> gdpfugyh
+//   dvdgjfy     -> dvdgfjy
+//   zmsirwz     -> zsmirwz
+//   :tgksty     -> tgskty
+//   yfwszw:     -> ywfszw
+//   tpclnkcuey  -> tplcnkcuey
+//   vamcusuqlv  -> vamcsuuqlv
+//   qgwhbxlcgg  -> qwghbxlcgg
+//   :goxhgkyefg -> ogxhgkyefg
+//   rjvjdgfs    -> rjvjgdfs
+//   xsoyrgat    -> xsoyrgta
+//   enuokknbo   -> enoukknbo
+//   rmqznkex    -> rmzqnkex
+//   tmawhkb     -> tmawhbk
+//   enaprhaddq  -> enaprhdadq
+//   zwkzuggs    -> zkwzuggs
+//   dceaswt     -> dcesawt
+//   ctllaknk    -> ctlalknk
+//   :cvtoroawvy -> cvtoroawyv
+//   ltmxsx:     -> tlmxsx
+//   trbfyks:    -> trbyfks
+//   cvbspan     -> cbvspan
+//   ekkkomytzg  -> ekkkomyztg
+//   ubousjm     -> uobusjm
+//   piuseoi     -> piuesoi
+//   ihlyfqusmq  -> ihlyqfusmq
+//   shheuqo     -> hsheuqo
+//   oiljasxwxy: -> ioljasxwxy
+//   wkuhobiax   -> wkuhobaix
+//   kukhfdsmt   -> kukfhdsmt
+//   yaxkpkwz    -> yaxkkpwz
+//   vdhlaum     -> dvhlaum
+//   vphglnf     -> vphlgnf
+//   exjuxtlwq   -> exjuxltwq
+//   :nxcsig     -> nxcsgi
+//   vlivzxfz    -> vlivzfxz
+//   llenehr     -> lleenhr
+//   fgpkauy     -> fgkpauy
+//   ebelkyos    -> ebelkyso
+//   nyovdmn:    -> nyovdnm
+//   :bhlcgqwzda -> bhlcqgwzda
+//   zhayogx     -> zhaygox
+//   jjiplzgvz   -> jjiplzgzv
+//   pkrezfqkt   -> prkezfqkt
+//   qxztehoq    -> qxtzehoq
+//   bcrivmvbf   -> bcrivmvfb
+//   zkrwmtixn   -> zkrwmtxin
+//   hbonxql     -> hboxnql
+//   bleaagkzea: -> blaeagkzea
+//   vchegjyfp   -> vchgejyfp
+//   yoduunm     -> youdunm
+//   vdtfeolcl   -> vdtfelocl
+//   ctcztlk     -> ctctzlk
+//   ihcuggntj:  -> ichuggntj
+//   xvzdnsglh   -> xvzdnsghl
+//   mdylmdvjvr  -> mdylmdvvjr
+//   dbfgkzqlzo  -> dbfgkzqloz
+//   aziejzw     -> aziezjw
+//   qctlxfjxo   -> qtclxfjxo
+//   ypogypr     -> ypoygpr
+//   jjznbggfbb  -> jjzbnggfbb
+//   dhvjksab:   -> hdvjksab
+//   ctlimldkez: -> ctlimldkze
+//   zwhbsoszgt: -> zwhbosszgt
+//   sbxdhv      -> sbdxhv
+//   svaevtyhh   -> sveavtyhh
+//   tkjdng      -> ktjdng
+//   waymkbcbs   -> waymkcbbs
+//   ojqwzofptg  -> joqwzofptg
+//   vitfodzly:  -> vitofdzly
+//   dxxpub      -> dxxpbu
+//   :vhlvpp     -> vhlpvp
+//   iegovhoc    -> igeovhoc
+//   szshtg      -> szhstg
+//   zinjttm     -> iznjttm
+//   tqenmvcqwy  -> tqemnvcqwy
+//   jxkkoh      -> jxkkho
+//   qmgpiejsoc  -> qmgpiesjoc
+//   ineannompn  -> inenanompn
+//   fdxvym      -> fxdvym
+//   bpyfywwbr   -> bpyfwywbr
+//   faqkqm      -> faqkmq
+//   bkeyhly     -> bekyhly
+//   rrvefaklm   -> rrveafklm
+//   hqwcochpa   -> hqwcohcpa
+//   :kcglvgcwi  -> kclgvgcwi
+//   vybiuzfv    -> vybizufv
+//   :uxaxjmh    -> uxaxjhm
+//   :pdpjhwy    -> pdpjhyw
+//   gorkrls     -> gorklrs
+//   vdquajvll   -> vduqajvll
+//   xzssow      -> xzsosw
+//   xzdxoaduiw  -> xzdxoaduwi
+//   npckuvnvs   -> npckuvnsv
+//   pfzlyhcj    -> fpzlyhcj
+//   hrwlory     -> hrlwory
+//   xloejmh     -> xloemjh
+//   hpdldw      -> hpdlwd
+//   jierkf      -> ijerkf
+//   lyyyrbvqn   -> lyyyrvbqn
+//   zmghqqi     -> zmgqhqi
+//   jhmsys      -> jhmyss
+//   xanqtis     -> xantqis
+//   xlinvakrj   -> xlnivakrj
+//   yrnyzvo     -> yrnyzov
+//   altrnthkfe  -> altnrthkfe
+//   ceevben     -> ceebven
+//   cdtpxewk:   -> cdtpxwek
+//   bkmnte      -> bkmtne
+//   uyccllze    -> yuccllze
+//   owrhmywcg   -> owrhymwcg
+//   sxfxiioti:  -> sxfxiitoi
+//   ytzqmb      -> yztqmb
+//   eglidr:     -> elgidr
+//   cadtzrv     -> catdzrv
+//   cbpehyr:    -> cbpehry
+//   nmepsiy:    -> nmespiy
+//   vqzzqdiz    -> qvzzqdiz
+//   :stpqbk     -> stpbqk
+//   :cltokqfj   -> cltoqkfj
+//   gcqxaamytw  -> gcqxaaymtw
+//   keqafo      -> keaqfo
+//   zwqofk:     -> zwoqfk
+//   icckgqqn    -> icckgqnq
+//   zeakjsjlvz: -> zeakjsljvz
+//   vhxpprg     -> vhxppgr
+//   nwpotovr    -> nwpotvor
+//   iewbkxikbx  -> iewbkxikxb
+//   sjbesipmu   -> sjebsipmu
+//   :gkoxhw     -> kgoxhw
+//   ervocuyv    -> erovcuyv
+//   ujmgkmtxb   -> ujmkgmtxb
+//   tpgtrrdu    -> tgptrrdu
+//   tguupc      -> tguucp
+//   bwhblhf     -> bhwblhf
+//   qkdaskovhz  -> qkdsakovhz
+//   hqdmoxngyp  -> hdqmoxngyp
+//   :zjxwcip    -> jzxwcip
+//   aynjysfr    -> anyjysfr
+//   xzdybgquw   -> xzdybguqw
+//   bggpiadfh   -> bggpiadhf
+//   byeyoecrt   -> ybeyoecrt
+//   bxvvmdusiu  -> bxvvmudsiu
+//   cbysdkm     -> cbyskdm
+//   :lrsfpn     -> lsrfpn
+//   :tlliek     -> tlilek
+//   :ilrxdmpl   -> ilxrdmpl
+//   ixyifhzatr  -> ixyifhzart
+//   :nzimzuym   -> nzimzyum
+//   tlvgttosk   -> ltvgttosk
+//   livefg      -> lievfg
+//   uobgaeo     -> uobgeao
+//   zhpoeg      -> zhpoge
+//   :mlioyoyo   -> mliooyyo
+//   oeydgaw:    -> eoydgaw
+//   zatnmxjue   -> zatnmxjeu
+//   bibhcmu     -> ibbhcmu
+//   ofpsaitmxx  -> ofpsatimxx
+//   :pcnxoopdk  -> pcnxoodpk
+//   :nfxfigqush -> nxffigqush
+//   mckaca:     -> mcakca
+//   dluwdsbcy   -> dlwudsbcy
+//   lxjanjlav   -> lxjanjalv
+//   gohuolniqw  -> ghouolniqw
+//   geefntamr   -> geefntmar
+//   gpkzcfn     -> gkpzcfn
+//   qzdsipbycm  -> qzdsibpycm
+//   cppllb      -> cpplbl
+//   :fcmijrqq   -> fcmirjqq
+//   pjvxtdwc    -> pjxvtdwc
+//   :rfmxvz     -> rfmxzv
+//   gszdczzhh   -> gszcdzzhh
+//   drimggnat   -> drigmgnat
+//   :juqdlfqjgz -> juqdlfqgjz
+//   zyjqkmmy    -> zjyqkmmy
+//   zuydhwd     -> zudyhwd
+//   oigrpzkto:  -> oigprzkto
+//   ffpxqfurc   -> ffpxqfucr
+//   asznmc      -> aszncm
+//   pnkqhnkl:   -> pnqkhnkl
+//   :ilyxifhtll -> ilyixfhtll
+//   loxrkrz     -> lorxkrz
+//   mcyjcrfm    -> mcycjrfm
+//   tnrgis      -> trngis
+//   qygpwryt:   -> qygpwyrt
+//   pfxpjbvr    -> pfxpbjvr
+//   fsucckllmy  -> fsuckcllmy
+//   srpbtuzm    -> sprbtuzm
+//   mriroxcz    -> mriorxcz
+//   iyrpxc      -> iyrxpc
+//   dnbfskyt    -> dnbsfkyt
+//   ayyswdvig   -> aysywdvig
+//   kvfmfqmh    -> kvfmfqhm
+//   igvfcmn     -> ivgfcmn
+//   ageyeapdza  -> ageyeapzda
+//   yihucwqdj   -> yihucwqjd
+//   knxkrl      -> knxrkl
+//   cppsbkb     -> cppsbbk
+//   qjuhlcw     -> qujhlcw
+//   qnhsvwdb:   -> qnhsvwbd
+//   tzcyrbnue   -> tzycrbnue
+//   :zkimbugu   -> kzimbugu
+//   dmoigde     -> dmiogde
+//   :oumbenq    -> omubenq
+//   dzjzxjoryp: -> djzzxjoryp
+//   :mnzmrne    -> mnmzrne
+//   gktpsbsc    -> gktpbssc
+//   cteddvjqqs  -> cteddjvqqs
+//   cjyhmjll    -> jcyhmjll
+//   brbyxmt     -> brbxymt
+//   zbiegzu     -> zbeigzu
+//   eoaymt:     -> eoaytm
+//   yrsxnku     -> ysrxnku
+//   srlyrjglrl  -> srlyrjgrll
+//   :vaoapi     -> voaapi
+//   dxamrsbc    -> dxarmsbc
+//   ctsovbw     -> ctsobvw
+//   :jbyuyvm    -> bjyuyvm
+//   frxeltufnc  -> frexltufnc
+//   bdoylrm     -> bdolyrm
+//   wpubwg      -> pwubwg
+//   fcltfo      -> flctfo
+//   :zinsngoql  -> znisngoql
+//   gqvkzqx:    -> gqvzkqx
+//   oawhcry     -> oawhcyr
+//   snuxsww     -> snusxww
+//   yydogjj     -> yyodgjj
+//   :ammvcqqmde -> ammvcqqmed
+//   :ryxdzaone  -> yrxdzaone
+//   :velufawuu  -> veluafwuu
+//   jlydfstof   -> jldyfstof
+//   jyvlvczoe   -> jyvlvcoze
+//   rijipq      -> irjipq
+//   wakfuucg    -> wafkuucg
+//   ismlvooa    -> ismlvoao
+//   suksejiub   -> suksejibu
+//   nggzvmekqc  -> nggzvemkqc
+//   :xeumqenpm  -> xuemqenpm
+//   wxvvtgvq    -> wxvtvgvq
+//   ghchfaqi    -> ghchfqai
+//   ppnvhcivol  -> pnpvhcivol
+//   gmskiyywy   -> gmskiywyy
+//   ihcmhajbn   -> ihchmajbn
+//   jeujvwdt    -> jeuvjwdt
+//   sppyunkhoj  -> spypunkhoj
+//   :eigdgmv    -> egidgmv
+//   nlrvjsmsv   -> nlrjvsmsv
+//   ncnpqxsx    -> ncnqpxsx
+//   :xmbdgycdpr -> xmbdygcdpr
+//   yzrqydrfv   -> yzrqydrvf
+//   :bblygq     -> blbygq
+//   :mkgchecf   -> mkgcehcf
+//   sensub      -> sesnub
+//   :bsmrletn   -> bsmreltn
+//   jzkjmlspd:  -> zjkjmlspd
+//   zpxaxbdi:   -> zpxaxdbi
+//   mxvbczf     -> mvxbczf
+//   imhlrv      -> ihmlrv
+//   jseknkrz:   -> jsekknrz
+//   olkaxbgb    -> olkxabgb
+//   mfjvxbmlbm  -> mjfvxbmlbm
+//   rmbajg      -> rmabjg
+//   ytuelag     -> ytuelga
+//   :kogghrjor  -> koghgrjor
+//   pmkzil      -> pmkizl
+//   :vowdhec    -> vodwhec
+//   jpbfjbe:    -> pjbfjbe
+//   :bbivtquf   -> bbitvquf
+//   ryyqbo      -> yryqbo
+//   hfrxht      -> hfrxth
+//   jpglyim     -> jpglymi
+//   guouvgzzx   -> gouuvgzzx
+//   mocnut      -> mocunt
+//   rbenuogn    -> rbenugon
+//   lowowgyjki  -> lowowygjki
+//   :wzmdzkryx  -> wzmdzkrxy
+//   gqdgxulhu   -> gqdgxuhlu
+//   :uvmdsglfge -> uvmsdglfge
+//   :iszifjdfkl -> izsifjdfkl
+//   nogfhp      -> nofghp
+//   pnqgsavzh   -> npqgsavzh
+//   :ywhfcgjkd  -> wyhfcgjkd
+//   dynaipg     -> dyniapg
+//   sccxfgsm    -> sccxgfsm
+//   fjmjkepxil  -> fmjjkepxil
+//   :xrfgbors   -> xrfgbosr
+//   ogfrcapt:   -> ogfrcatp
+//   kcqndol     -> kcqdnol
+//   huzazkvp    -> huzazvkp
+//   yoghwtqfk   -> oyghwtqfk
+//   vcwgoutkvh  -> vcwgouktvh
+//   :wxesqrmg   -> wxeqsrmg
+//   jrfyjpn     -> rjfyjpn
+//   xjikxoxah:  -> xjikxoxha
+//   zyyhuwx     -> zyhyuwx
+//   :jrsjte     -> jrjste
+//   :qgamykyp   -> qgaymkyp
+//   jrbtgw:     -> rjbtgw
+//   efdmbxaab   -> efdbmxaab
+//   vmymdp      -> vmydmp
+//   :ezseyx     -> ezsyex
+//   vepfswdm:   -> evpfswdm
+//   bgwgopgao   -> bggwopgao
+//   hsegkom     -> hsegokm
+//   :dractcvefr -> rdactcvefr
+//   airkkbsw    -> aikrkbsw
+//   wlyjuz      -> wlyujz
+//   :ldpcsvzzkc -> ldpcvszzkc
+//   qcbetn      -> qbcetn
+//   bfwftxmbd   -> bffwtxmbd
+//   :fyvukix    -> fyvkuix
+//   nqlyzucqcb  -> nqlzyucqcb
+//   hlcluuqnlq  -> hllcuuqnlq
+//   bklkbi      -> bklkib
+//   iwavrlgqv   -> iwavlrgqv
+//   mhavza      -> mhvaza
+//   qmsygy      -> mqsygy
+//   nlyqibzzf   -> nlyqizbzf
+//   lxvhxhjo    -> lxhvxhjo
+//   aqmvjzucc   -> qamvjzucc
+//   ndozxj      -> ndzoxj
+//   meicbbdtbl  -> emicbbdtbl
+//   kalvmxjr:   -> kalvxmjr
+//   jewvompb    -> jwevompb
+//   acrpgnmr    -> acrpgmnr
+//   zaefucu     -> zaefuuc
+//   :zkoryfesf  -> zkoryfefs
+//   cdvjfizu    -> cdvjfziu
+//   :fwzzlflu   -> fwzzfllu
+//   :jrbsghxwd  -> jrbshgxwd
+//   oaytqfnyx:  -> oatyqfnyx
+//   dlampsced   -> dlamspced
+//   mvyesa      -> mvyeas
+//   votnmbyml   -> vtonmbyml
+//   wgvzvgycj   -> wgvzvgcyj
+//   tjroiy      -> tjrioy
+//   :kjwjfxce   -> kwjjfxce
+//   yehtnet     -> yehtent
+//   zgktogxgq   -> zgktoggxq
+//   oeinqhfur   -> oeniqhfur
+//   ytdhgryrk:  -> ytdhgyrrk
+//   :sqkgjyalsu -> sqkgjaylsu
+//   knrwaumsll  -> knrwaumlsl
+//   :zugrbq     -> zurgbq
+//   jufdziisjh  -> jfudziisjh
+//   :qeicbl     -> qeiclb
+//   hhsigpo     -> hhsigop
+//   sebpsumk    -> sepbsumk
+//   elmbrqsbr   -> elmrbqsbr
+//   svlsmhevl   -> svlsmehvl
+//   iaergcx     -> iaergxc
+//   egqycmvw    -> egyqcmvw
+//   wuyxvbvwik  -> wuyxvbvwki
+//   zfuehqgh    -> zfueqhgh
+//   druxjvnq    -> drujxvnq
+//   :sjjvbf     -> sjjbvf
+//   euvmluwq:   -> evumluwq
+//   kzianisvoh  -> kzianisvho
+//   crrnwg      -> crnrwg
+//   zprjem      -> pzrjem
+//   febuidvtgk  -> febiudvtgk
+//   :lpwhfecogh -> plwhfecogh
+//   tbzxyl      -> tbxzyl
+//   :gbquefqdgd -> gbquefdqgd
+//   :hwjylz     -> hwjlyz
+//   fqlprnoso   -> fqlpronso
+//   lrzitvgt    -> lzritvgt
+//   eycfelsl    -> eyfcelsl
+//   itpvfqc     -> iptvfqc
+//   :rbeudrfb   -> rbeudfrb
+//   inndoiu     -> indnoiu
+//   pnddfh      -> pnddhf
+//   gopsebam    -> gospebam
+//   cmiinjmqw   -> ciminjmqw
+//   tewpkcgc    -> tewkpcgc
+//   ohrygwkwys: -> ohrygwkyws
+//   bhsqdj      -> bshqdj
+//   :razdjmch   -> razdmjch
+//   :zfhwrygik  -> zfhwyrgik
+//   ijfijdngvq  -> ijfjidngvq
+//   :lsrikruv   -> lrsikruv
+//   :bsrmmnfbf  -> bsrmnmfbf
+//   xgjlar      -> xgljar
+//   mhtbgmdew   -> mhtgbmdew
+//   zwtwzrc     -> zwtwrzc
+//   rkxtqu      -> krxtqu
+//   bplsozm:    -> bpslozm
+//   krqcpfxd    -> krqcpxfd
+//   qchoasq     -> qchaosq
+//   dsvbewn     -> dsvbenw
+//   :mpcbmcp    -> mpbcmcp
+//   vypvaq      -> vpyvaq
+//   bfcxgzecrb  -> bfxcgzecrb
+//   rnhqfv      -> rnhfqv
+//   uzzwlzojbv  -> uzzwzlojbv
+//   jzasqvo     -> zjasqvo
+//   eyzybzfti   -> eyzyzbfti
+//   eopmxd      -> eopxmd
+//   vyzqhfixo   -> vyqzhfixo
+//   wmqxzr      -> wmqzxr
+//   qgjsxdp     -> qgjsxpd
+//   sozwfdgb    -> oszwfdgb
+//   :vfpevxbhty -> vfpexvbhty
+//   yhstdphkhk  -> yhsdtphkhk
+//   rdsqwwdgso  -> drsqwwdgso
+//   :qcmfwqj    -> cqmfwqj
+//   hunbqp:     -> hunqbp
+//   wudqrn:     -> wduqrn
+//   bflfyokxb   -> blffyokxb
+//   nthdcxdhlt  -> nthdcxdhtl
+//   tokaarxrjv  -> tokaarxrvj
+//   caxtvtffgw  -> catxvtffgw
+//   hszlturioc  -> hszltuiroc
+//   lcjjavymf   -> lcjjavyfm
+//   pxbbbgfttm  -> pxbbgbfttm
+//   axettqj     -> aexttqj
+//   dfbmfuz     -> fdbmfuz
+//   pyiyfpqfy:  -> pyifypqfy
+//   kifkwegduq  -> kifwkegduq
+//   ftnfierfaa  -> ftfnierfaa
+//   efmlyjutgw  -> eflmyjutgw
+//   fzroqnc:    -> frzoqnc
+//   :ofsbvadhui -> ofbsvadhui
+//   rdkzfys     -> rdkzfsy
+//   zcbzjkeiub  -> zcbzkjeiub
+//   dbmqesec    -> dbmqseec
+//   mpboikdnn   -> mpbokidnn
+//   ropmsi:     -> rompsi
+//   frbmlgwmid  -> rfbmlgwmid
+//   teavhvjnap  -> etavhvjnap
+//   ohfzeviv    -> ohfzevvi
+//   bzwytswc    -> bzwytwsc
+//   etyhyy      -> eythyy
+//   zxefesiejr  -> zxefesijer
+//   egjrry      -> gejrry
+//   taamdy      -> tamady
+//   fladdxf     -> falddxf
+//   kmvsmlti    -> kmvsmlit
+//   agxibvw:    -> agixbvw
+//   ymfhyyvmhk  -> ymfyhyvmhk
+//   :zkemfraxm  -> zkemrfaxm
+//   rjltcgkaoz  -> rljtcgkaoz
+//   ziwbzlehq   -> zibwzlehq
+//   oizjdmukh   -> iozjdmukh
+//   zlsdllt     -> zlsldlt
+//   scqwehuez   -> scqewhuez
+//   gipvfeu     -> gipvefu
+//   gwnvrbqy    -> gwnvbrqy
+//   vlcjydn     -> vlcyjdn
+//   :zrtirl     -> zrtilr
+//   qqiodxk     -> qqioxdk
+//   aojjhpq     -> oajjhpq
+//   mpdjorexky  -> mpdjoerxky
+//   hwkdlawa    -> hwkdlaaw
+//   nikstb:     -> inkstb
+//   rjxrmtsg    -> rjrxmtsg
+//   gptsveijry  -> gpstveijry
+//   lijjkg      -> lijjgk
+//   cxmhnqzcy   -> cxmnhqzcy
+//   rmymwkzu:   -> rmymwzku
+//   qvbmbzxby   -> qvmbbzxby
+//   bdvaox      -> bdvaxo
+//   :kfenfv     -> kfenvf
+//   fgqcajdel   -> fgqcajdle
+//   iyutjfz     -> iyujtfz
+//   cbvxrk      -> cbvxkr
+//   :ibxlyv     -> ibxlvy
+//   odvbvugjpv  -> ovdbvugjpv
+//   zsbxnqeb    -> zsbnxqeb
+//   :ksoxdedz   -> ksoxddez
+//   yugkdxq     -> yukgdxq
+//   qqrvtbmdvp  -> qqrvtbmdpv
+//   ebflat      -> ebfalt
+//   knxfstvblc  -> knxsftvblc
+//   :wvqgtpkrpv -> wvqtgpkrpv
+//   :erumhkhwr  -> erumhhkwr
+//   vsbvyubvo   -> vsbvybuvo
+//   cguyvg      -> cgyuvg
+//   sarlirkl    -> sarlikrl
+//   qkziqymyyz  -> qzkiqymyyz
+//   ibmils      -> imbils
+//   oihjvn      -> oihjnv
+//   qujhxm:     -> qujxhm
+//   wsoismmdok  -> wsoismmdko
+//   ovpjpnp:    -> ovpjppn
+//   nodxphb     -> noxdphb
+//   :yfporzh    -> fyporzh
+//   qdlddsu     -> qldddsu
+//   :dfjlkpn    -> dfjklpn
+//   xfznjasiy   -> xzfnjasiy
+//   tobayf      -> otbayf
+//   bhqzsmlio   -> bhqzslmio
+//   tynkhrkz    -> tnykhrkz
+//   blrlqhivae  -> bllrqhivae
+//   adhuersy    -> aduhersy
+//   :axdbhnja   -> axbdhnja
+//   :poijsb     -> pojisb
+//   xckjyezael  -> xcjkyezael
+//   xzbdepgu    -> xzbedpgu
+//   hyuycf      -> yhuycf
+//   mwtfwqcbgp  -> mwtfqwcbgp
+//   zdeiopci    -> zediopci
+//   qltchua     -> qtlchua
+//   dbjxculwau  -> dbjxcuwlau
+//   :znpinxo    -> znipnxo
+//   kthfvelr    -> ktfhvelr
+//   qhxywvaac:  -> qhxywvaca
+//   qnffrwkdiz: -> qnffrwkdzi
+//   zdmxrj      -> zdxmrj
+//   :zunuzjixx  -> uznuzjixx
+//   xrwato      -> xrwaot
+//   yxnyfzejd   -> yxnfyzejd
+//   vldmso      -> vldmos
+//   eadjsexuty  -> eadjesxuty
+//   jqckxbvu    -> jqcxkbvu
+//   wffoixsd    -> wfofixsd
+//   :byekkebosx -> byekkeboxs
+//   gxgbxi      -> gxgxbi
+//   :xajorxqqhe -> xaojrxqqhe
+//   vikldqpic:  -> vilkdqpic
+//   aiiriru     -> aiiirru
+//   fhhirfk     -> fhihrfk
+//   eyargitk    -> eyarigtk
+//   veookksyek  -> voeokksyek
+//   hrqtijo     -> hrqitjo
+//   rjguym      -> rjgyum
+//   :ntrrvzu    -> ntrrvuz
+//   sprlrcqpcx  -> srplrcqpcx
+//   bcicug      -> bcciug
+//   qrgxobbxr   -> qrgxobbrx
+//   :vqwngg     -> vwqngg
+//   :mwryllrr   -> mwrlylrr
+//   :icjfxgpnp  -> icjfxgppn
+//   pgxubpz     -> pgxbupz
+//   rmsqtpacwr  -> rmsqtapcwr
+//   fuhmjzjrhp  -> fuhmzjjrhp
+//   :qberwc     -> bqerwc
+//   :jhxglgcjes -> jhxglgcjse
+//   lbietfl     -> lbietlf
+//   wjslmybm    -> jwslmybm
+//   pjfcgqh     -> pjfgcqh
+//   leflvtql    -> elflvtql
+//   kxdkify     -> kxkdify
+//   wppqbz      -> pwpqbz
+//   dmcykutsyi  -> dmyckutsyi
+//   npococrxyh  -> npococryxh
+//   wluscmsb    -> wlusmcsb
+//   :cdrbzwx    -> dcrbzwx
+//   :wnanokeo   -> wannokeo
+//   itfykj      -> tifykj
+//   :daoahomn   -> doaahomn
+//   kgaxkbiz    -> kgaxbkiz
+//   :trhmlsjtb  -> trhmlsjbt
+//   :dgvgqolmo  -> dggvqolmo
+//   :riosfmce   -> riofsmce
+//   isngwvq     -> isngwqv
+//   tidijqre    -> tidijrqe
+//   borivw      -> obrivw
+//   uevjxa:     -> uevxja
+//   :qiqfnrxaw  -> qiqfnraxw
+//   usbiqvisv   -> usbivqisv
+//   gndvmvim    -> gndmvvim
+//   bhxwpclmd   -> bhxwpcmld
+//   hpmrbbv     -> phmrbbv
+//   :bbpnlndayt -> bpbnlndayt
+//   luuallp     -> luaullp
+//   pyoikb      -> ypoikb
+//   ylowshnh    -> ylowhsnh
+//   fjuvnj      -> fjunvj
+//   qerziy      -> qerizy
+//   celhna      -> clehna
+//   ohqmwx      -> ohqmxw
+//   fcbbjqwshi  -> fbcbjqwshi
+//   tddgqxaomx  -> tddgqaxomx
+//   lodhdnrsv   -> loddhnrsv
+//   ypzdzbw     -> ypdzzbw
+//   qcrxlso     -> qrcxlso
+//   lgdntb:     -> lgdnbt
+//   uswavwq     -> uwsavwq
+//   exxhbdqyp   -> exxbhdqyp
+//   fvjsjrbc    -> fvjsrjbc
+//   :fsbnquwv   -> fsbnquvw
+//   :gxjzfbpulf -> gxjfzbpulf
+//   aakeluhalj  -> akaeluhalj
+//   lnnbwel     -> nlnbwel
+//   :uigckt     -> uigkct
+//   :oauwwkvyz  -> oauwwkyvz
+//   oajngfd     -> oajngdf
+//   iaplvu      -> aiplvu
+//   fdypoe:     -> fdyope
+//   qebnhmau:   -> qebnhamu
+//   ovutgmrmp   -> ovutgmmrp
+//   rshbtror    -> rshtbror
+//   cmcftoqbpo  -> cmctfoqbpo
+//   ptkumrf     -> pktumrf
+//   :xbfzvuywkc -> xbfzvyuwkc
+//   wdaybcec    -> wdabycec
+//   ynxkuuf     -> yxnkuuf
+//   mwxiehosoq  -> mwxiehsooq
+//   fjetzoa     -> fjtezoa
+//   obgmim      -> obgimm
+//   ijdlxi      -> ijdxli
+//   drhpifsjwj  -> drhpifsjjw
+//   fqymuv      -> qfymuv
+//   txffpqz     -> xtffpqz
+//   pixoril     -> pxioril
+//   wllkqttt    -> lwlkqttt
+//   shvswlht    -> svhswlht
+//   wolptyn     -> wolptny
+//   :cbelnoshp  -> cbelonshp
+//   esqhca      -> eshqca
+//   fekenxv     -> fekexnv
+//   :vefrwgbff  -> vferwgbff
+//   qjbwcbp     -> qjwbcbp
+//   :wojhyevcn  -> owjhyevcn
+//   whdwdetoci  -> whdwdteoci
+//   xipqtms:    -> xiptqms
+//   kifdoikj    -> ikfdoikj
+//   zimozv      -> izmozv
+//   nqynmksyjy  -> nqynkmsyjy
+//   :zgozaszq   -> zgzoaszq
+//   rfkodtj     -> rfkotdj
+//   yhhwhq      -> yhhhwq
+//   hbbmap      -> hbmbap
+//   oregmebic   -> oregmeibc
+//   znsacbc     -> znsabcc
+//   ushyslzzws  -> ushyslzwzs
+//   rykxciawk   -> yrkxciawk
+//   nukmqbwbj   -> nukmqbbwj
+//   ydizdywtdl  -> ydizdywdtl
+//   :rzrasywxy  -> rrzasywxy
+//   csdjdygvv   -> csdjdyvgv
+//   kvvkferc    -> kvvkefrc
+//   :zpdqokeyxj -> zpqdokeyxj
+//   rhiviwfolf  -> rhivifwolf
+//   eyvkxrimag  -> eyvkxrmiag
+//   mtjdjmrnk   -> mtjdjmrkn
+//   jfmmlp      -> jmfmlp
+//   hjyozrnp:   -> hjyoznrp
+//   btocjzgr    -> btojczgr
+//   vpqtrmrc    -> vqptrmrc
+//   itfvkv      -> iftvkv
+//   :aoykdipoe  -> aoykdipeo
+//   hyaycdspi   -> hyaycdpsi
+//   leiulkiiw   -> leilukiiw
+//   llpavpi     -> llpvapi
+//   :stwohyei   -> stwhoyei
+//   jxcbeszh    -> jxcbezsh
+//   :yjgbzi     -> yjgbiz
+//   :eusaeirbbp -> eusaeibrbp
+//   rrpcnm      -> rprcnm
+//   phnapdpios  -> pnhapdpios
+//   :bawiygfw   -> baiwygfw
+//   pwzjzdw     -> pwzzjdw
+//   npomvucor   -> npomuvcor
+//   wxntzqba    -> wnxtzqba
+//   kwfhmrtwb   -> kwfmhrtwb
+//   vwxoipsszu  -> vwxoispszu
+//   ybntmk      -> byntmk
+//   :qtwownxxog -> qtwownxoxg
+//   :cfqqafwn   -> cfqqafnw
+//   ilubnc      -> iulbnc
+//   :vpjcqhxrnu -> vpjqchxrnu
+//   rimomx      -> rimmox
+//   qntxwvnzm   -> qntxwvnmz
+//   zxppopjih   -> zxppopijh
+//   lfaqkeyng   -> lfqakeyng
+//   :mvezxh     -> vmezxh
+//   mzfheme     -> mzfheem
+//   zfowzzum    -> zofwzzum
+//   hyshcfbzhp  -> hyshcfzbhp
+//   :vsbmbyniq  -> vsmbbyniq
+//   vsrngzkjs   -> vsrngzjks
+//   lqvves      -> qlvves
+//   scawwfl     -> scawfwl
+//   gzrmnuw     -> grzmnuw
+//   :xplfqgfj   -> pxlfqgfj
+//   dmcjsadhh   -> dmcsjadhh
+//   upuajbt     -> upuajtb
+//   :xrpjthzjz  -> xrpjhtzjz
+//   :qqflxtgjiu -> qqfltxgjiu
+//   :pszhvhgto  -> pzshvhgto
+//   cjayhapcf   -> cjahyapcf
+//   xnnwspdpbj  -> xnwnspdpbj
+//   :vcombicua  -> vcombiuca
+//   dohwnqzkpz  -> dohwnqzkzp
+//   vmcuwxzgz   -> mvcuwxzgz
+//   :vvuuokx    -> vvuoukx
+//   ewhluo      -> ewlhuo
+//   wteynvxr:   -> wteynvrx
+//   :ikysuusb   -> ikyususb
+//   ittcqgsv    -> ittqcgsv
+//   eogdlzk     -> eodglzk
+//   qjgxvszwfi  -> qjgxsvzwfi
+//   jomyrm      -> jmoyrm
+//   zojqpyezjg  -> zojqpyejzg
+//   jcuhcr      -> juchcr
+//   ykzcxwnqy   -> yzkcxwnqy
+//   hlqarz      -> lhqarz
+//   myyvwsz     -> myywvsz
+//   iszrfjc     -> iszrfcj
+//   tqhebb      -> tqhbeb
+//   lvkrxc      -> lvkxrc
+//   :xexnqwgwl  -> exxnqwgwl
+//   :dlqlny     -> dllqny
+//   :jdxocuo    -> jdxocou
+//   eaobceaayx  -> eaocbeaayx
+//   :wnkezmdgc  -> wknezmdgc
+//   :fncabbgb   -> fnacbbgb
+//   gbazlp      -> gbzalp
+//   eycsfhipkz  -> eycsfihpkz
+//   :jmhflye    -> jmhfyle
+//   zdkhtxeqh   -> zdkhtxehq
+//   bbzhwuj     -> bbhzwuj
+//   bmcdvuping  -> bcmdvuping
+//   ntkufmn     -> ntkufnm
+//   wllqcfvls   -> wllcqfvls
+//   tveuwcumz   -> tveuwcmuz
+//   :qcjxmhd    -> cqjxmhd
+//   pbtjfsb     -> pbjtfsb
+//   :qkrmria    -> qkrmira
+//   gcagvykadw  -> gcavgykadw
+//   kjsebkvonj  -> kjsbekvonj
+//   xhrgzzxp    -> xhgrzzxp
+//   mqmmjdle:   -> mqmmjlde
+//   uwmzqghv    -> uwmzgqhv
+//   hftwowx     -> hftowwx
+//   baxrixnh:   -> barxixnh
+//   qfpbrydklp  -> qfpbyrdklp
+//   lqwveu      -> lqvweu
+//   dsqwtjb     -> dsqwjtb
+//   viaqqaoe    -> ivaqqaoe
+//   uxiareu     -> uxiaeru
+//   fwqjdqjx    -> wfqjdqjx
+//   jeakasds:   -> jeakadss
+//   azdoxtdm    -> azdotxdm
+//   :jhuuccdm   -> jhuucdcm
+//   agopdfv     -> aogpdfv
+//   ufunxmfbug  -> ufuxnmfbug
+//   dfmobupec   -> fdmobupec
+//   dfdvwibkn   -> dfdvwbikn
+//   :djqzcvqx   -> dqjzcvqx
+//   pvghui      -> vpghui
+//   sncpamv     -> nscpamv
+//   qvlbhi      -> qvlhbi
+//   ogygikxqv   -> ogygikxvq
+//   :xhamivic   -> hxamivic
+//   hijquk      -> hiqjuk
+//   mljwti      -> lmjwti
+//   :arhsgd     -> ahrsgd
+//   :nsqbuzuhp  -> nsqbuuzhp
+//   cnncjqwwfv  -> cnncjqwfwv
+//   pldieii     -> plideii
+//   xhkiex      -> xhkixe
+//   :pogkzvbvqc -> pogkzvbqvc
+//   :ijtsiccuzk -> ijtsicczuk
+//   eoohccq     -> oeohccq
+//   mnfjrhylv   -> mnfrjhylv
+//   uevrzzntie  -> uevrzznite
+//   ufeqsaxtpb  -> uefqsaxtpb
+//   xdyaokb     -> xdayokb
+//   qfreidnji   -> qfriednji
+//   :hbhfnpdxn  -> hbfhnpdxn
+//   mbbbxrqle   -> mbbbxrlqe
+//   xmhdnw      -> mxhdnw
+//   :isjwtyifyu -> iswjtyifyu
+//   ajqthqulfx  -> ajqthuqlfx
+//   phyifg      -> phiyfg
+//   zodieb      -> zodibe
+//   tbdyieleee  -> btdyieleee
+//   :yqckeudr   -> ycqkeudr
+//   rfkyccfk    -> rkfyccfk
+//   :kxzharjbiu -> kzxharjbiu
+//   tdvdinbs    -> tdvdinsb
+//   keoduvxk    -> keoduvkx
+//   ofammu      -> oafmmu
+//   higufc:     -> hgiufc
+//   :rsgbdd     -> rgsbdd
+//   gypyzq      -> gypyqz
+//   oyemdwrke   -> yoemdwrke
+//   xyxfipyhfr  -> xyxfiphyfr
+//   gtavixbp    -> gtaivxbp
+//   :eyajfx     -> eayjfx
+//   rhqrjmaga   -> rhqrjmaag
+//   oxdfhjamng  -> oxdfhjanmg
+//   nscaisfnt   -> ncsaisfnt
+//   fjrrfk      -> fjrrkf
+//   nrshhxg     -> nrshhgx
+//   hwwihfomp   -> hwwhifomp
+//   trudyugz    -> truduygz
+//   brrjlqnp    -> rbrjlqnp
+//   rkfymkg     -> rkfmykg
+//   nszmpj      -> snzmpj
+//   eahyargvh   -> aehyargvh
+//   igmddim     -> imgddim
+//   csdnzjao:   -> cdsnzjao
+//   bxlnlwsk    -> bxnllwsk
+//   tjphotcd    -> tjphtocd
+//   :kurnbdlu   -> kurbndlu
+//   blswpcirb   -> blswpcibr
+//   igswpuncny  -> igswpunncy
+//   :jrntauyxpn -> jrntauypxn
+//   cklnsbkorl  -> cklnbskorl
+//   oqivhu      -> oiqvhu
+//   qmfhzn      -> qfmhzn
+//   :feiuvsanvt -> feiuvsavnt
+//   :wtwrrakwt  -> wtrwrakwt
+//   viuldbdkwx  -> viuldbkdwx
+//   :uwfunrt    -> ufwunrt
+//   fbyclbs     -> fbylcbs
+//   :plztvzuwt  -> plztvzutw
+//   :meusilbthw -> mesuilbthw
+//   nijede      -> niejde
+//   :jdurfsncu  -> jdurfscnu
+//   fxjjrziont  -> fxjjrzoint
+//   rswkkaxc    -> rswkkxac
+//   pnffifpkg   -> pnfffipkg
+//   yrgtlks     -> yrtglks
+//   srdkbxx     -> srdkxbx
+//   :hqkllul    -> hqklull
+//   ykxbpeyfm   -> ykbxpeyfm
+//   xconyvnq    -> xconyvqn
+//   :tukijpu    -> tukipju
+//   jobocpgi    -> jobocpig
+//   irffdr      -> irffrd
+//   ucoozei     -> ucoozie
+//   axceta      -> axctea
+//   :vbtfmhd    -> vbtfmdh
+//   wcuzqduzf   -> wcuqzduzf
+//   :mtzvmauavk -> mtzvamuavk
+//   xgrnvsbmce  -> gxrnvsbmce
+//   :msfnly     -> smfnly
+//   bbgyugsv    -> bbgyusgv
+//   eswipguhn   -> esiwpguhn
+//   fspdnuahol  -> fspdnauhol
+//   bfymszsw    -> byfmszsw
+//   :hlohjvyt   -> lhohjvyt
+//   zbhwae      -> zhbwae
+//   lsiswnp     -> lsiswpn
+//   kmcwkmge    -> mkcwkmge
+//   vjpuszo     -> vjpusoz
+//   spyktyyhes  -> psyktyyhes
+//   :rmhosvy    -> rmhovsy
+//   qtepwe      -> qtepew
+//   wrplvtppm   -> wrplvptpm
+//   oofqlli     -> ofoqlli
+//   ceakcbgt    -> ceakcbtg
+//   :nidqhr     -> niqdhr
+//   hqvwpyriyq  -> hvqwpyriyq
+//   vxozgobl    -> vxozgolb
+//   ogljjbv     -> olgjjbv
+//   rhkeyourh   -> hrkeyourh
+//   nhacdwibp   -> nhacdwipb
+//   dvyrjrww:   -> vdyrjrww
+//   ioyjhoag:   -> oiyjhoag
+//   pkyfnseaqr  -> pkyfnesaqr
+//   nsvnqbss    -> nsvqnbss
+//   :tlkjzavc   -> tkljzavc
+//   nymeddmagv  -> nyemddmagv
+//   rdyevotlv:  -> rdyveotlv
+//   ftkwkzhrjp  -> ftkkwzhrjp
+//   wqewfl      -> qwewfl
+//   fvkypq      -> vfkypq
+//   vgqpfuskni  -> vgqpfsukni
+//   ofsrcmkwv:  -> ofsrckmwv
+//   awkpxgo     -> wakpxgo
+//   :hevlyrb    -> hevylrb
+//   scjrms      -> scjrsm
+//   soyfvnbcti  -> soyfvnbcit
+//   fqtkwp      -> fqktwp
+//   iziaejnpyb  -> izaiejnpyb
+//   doxvrbn     -> dovxrbn
+//   pmvdcbqw    -> pmvdcqbw
+//   uxsyjntbtj  -> uxsynjtbtj
+//   wljcxb      -> lwjcxb
+//   iweeio      -> iweeoi
+//   ebkyda      -> ebykda
+//   pkegylaogz: -> kpegylaogz
+//   xrtkmllop   -> xrtmkllop
+//   ujlmyyyi    -> uljmyyyi
+//   wmdtlfl     -> wdmtlfl
+//   :exurtdprt  -> exurtpdrt
+//   plggbxxasa  -> plggbxaxsa
+//   tbxxhjilnx  -> btxxhjilnx
+//   zdecnwao    -> zdecnawo
+//   motgou      -> motogu
+//   sfgvgilqeo: -> sfgvgliqeo
+//   :biqxpysepu -> biqxpsyepu
+//   ttjbvv      -> ttbjvv
+//   mslmzoqedn  -> mslmozqedn
+//   nanuxhdr    -> naunxhdr
+//   ugekic      -> uegkic
+//   ieraxiqbrj  -> ierxaiqbrj
+//   vdldrxx     -> dvldrxx
+//   hdjmpunk    -> hdjmpnuk
+//   mpenlia     -> mpelnia
+//   :tlqwzdredh -> tlwqzdredh
+//   kuqcjliue   -> kuqcjluie
+//   rmfmtir     -> rfmmtir
+//   dasgfeir    -> dasgefir
+//   qnoyvuecbx  -> qnoyveucbx
+//   nujbqk      -> nujqbk
+//   kmsqfn      -> kmsqnf
+//   bkbhgu      -> bkbhug
+//   mcktez:     -> mctkez
+//   :agiuzu     -> aguizu
+//   xfqqbnrhoc  -> xfqbqnrhoc
+//   :fpypklai   -> fpyplkai
+//   awwsdb:     -> awswdb
+//   gqledwdrdl  -> gqlewddrdl
+//   izneny      -> inzeny
+//   drxvbrqgsa  -> drxbvrqgsa
+//   xudsmymbib  -> xusdmymbib
+//   :rdxuxzyx   -> rdxuxyzx
+//   zqlsrtmpt   -> zlqsrtmpt
+//   wgonqyhi    -> wognqyhi
+//   :flyvhz     -> flyhvz
+//   :djoyuyjpj  -> djouyyjpj
+//   kvvwrh      -> vkvwrh
+//   bbdfzolqw   -> bbdfzolwq
+//   :icmibyalk  -> icimbyalk
+//   ohyttznnb:  -> ohtytznnb
+//   cryxocrmy   -> cryxorcmy
+//   :eedmphl    -> eedmplh
+//   yqzdfilzy   -> qyzdfilzy
+//   mihktduj    -> mihtkduj
+//   pohimnvga   -> poihmnvga
+//   udsfpxuji:  -> udsfxpuji
+//   wpqfyp      -> wpqfpy
+//   :dkzqiqmz   -> dzkqiqmz
+//   :nlpnibiclg -> nlpnbiiclg
+//   :srspyfopiv -> srsypfopiv
+//   tepznjqh    -> tepzjnqh
+//   pgpdoxq     -> ppgdoxq
+//   peqisvyn    -> peqisyvn
+//   jxyomy:     -> jxoymy
+//   plocyzm     -> plocymz
+//   nkmozyddt   -> nkmozydtd
+//   yqdmhljkmt  -> ydqmhljkmt
+//   phoabuk     -> phobauk
+//   idrqlei     -> irdqlei
+//   xtqceq      -> xtqcqe
+//   uygddfl     -> ugyddfl
+//   kqpdwjlpu   -> kqpdjwlpu
+//   dxaratfv:   -> dxraatfv
+//   zhbntmo     -> zhnbtmo
+//   ktwglursk   -> ktwgulrsk
+//   dwovjpx:    -> dwvojpx
+//   bpbkepwwii: -> bpkbepwwii
+//   :gwgrpauwp  -> ggwrpauwp
+//   tfziuyq     -> tfziuqy
+//   dymjwfwhg   -> dymjwwfhg
+//   iacpcvta:   -> iacpvcta
+//   sibzgdjm    -> sibgzdjm
+//   qseefvpgkj  -> qseevfpgkj
+//   hkrivnc:    -> hkrivcn
+//   gnnhhpvsoi  -> gnnhhpvsio
+//   :wahcefqu   -> wahceqfu
+//   fxacommz    -> fxacmomz
+//   vkvievzsg   -> vkvievszg
+//   gtofrhitni  -> gtorfhitni
+//   eicoaw      -> ecioaw
+//   easedxc     -> esaedxc
+//   rywhfp      -> rwyhfp
+//   rvjlaaf     -> vrjlaaf
+//   vzyeeocm:   -> zvyeeocm
+//   najjzpwn    -> njajzpwn
+//   :rduoafhf   -> rduoahff
+//   hfvfqr      -> hfvqfr
+//   irpehqoljz  -> irpehqojlz
+//   juezobryb   -> juezboryb
+//   uasksecg    -> usaksecg
+//   naosxli     -> anosxli
+//   fajbyizdu:  -> fajbyidzu
+//   :ipllpyqrg  -> ipllpyqgr
+//   dmbhqvwqk   -> dmbqhvwqk
+//   ebykdcznx   -> ebykcdznx
+//   itbiqsquzw  -> ibtiqsquzw
+//   emxbvrgkh   -> embxvrgkh
+//   widiutnxj:  -> widitunxj
+//   iqtdfkj:    -> iqtdfjk
+//   evhcpkyd    -> evchpkyd
+//   jzyqyv      -> zjyqyv
+//   hqkosommp   -> hqksoommp
+//   :jizwhmiwia -> jziwhmiwia
+//   :kqulgqci   -> kqulqgci
+//   nnfcdnyv    -> nnfdcnyv
+//   kjojesas    -> kjjoesas
+//   spwpzearc:  -> spwpzaerc
+//   jzfapj      -> jzfpaj
+//   xcdpisry    -> xcdpsiry
+//   iwmzrt      -> iwmrzt
+//   fpxwvw      -> fxpwvw
+//   rkzfduvz    -> rzkfduvz
+//   xbibbv      -> xbbibv
+//   srrppqot    -> srrpqpot
+//   uyqtxnign   -> uytqxnign
+//   adqybqiw    -> aqdybqiw
+//   dyliab      -> ydliab
+//   thwbwopd    -> thwbowpd
+//   ixfkegv     -> ixfekgv
+//   onjagmpcl   -> onjagpmcl
+//   gamuheqvto: -> gaumheqvto
+//   gjjgseeayn  -> jgjgseeayn
+//   pjseburwq   -> pjsebruwq
+//   avkgunbizj: -> avkugnbizj
+//   nwdiox:     -> ndwiox
+//   kyfvopdpnp  -> kyfvpodpnp
+//   :ocjvxkn    -> ocjxvkn
+//   :hmjhanjbhw -> mhjhanjbhw
+//   kfwrlek     -> kwfrlek
+//   :emfcozc    -> emfcocz
+//   dwbmajssr   -> dwbmajsrs
+//   fnevjy      -> fnejvy
+//   hnlioieiw   -> hnlioeiiw
+//   lglhkggf:   -> lghlkggf
+//   jyjxxkc     -> jyxjxkc
+//   epojqkzg:   -> epojqzkg
+//   pfvcjlptdm  -> pfvcjlptmd
+//   :lihewo     -> liheow
+//   ukledwkbde  -> ukledwbkde
+//   jjprkjpnej  -> jjrpkjpnej
+//   bofwierjc   -> bofweirjc
+//   :cbszbsbc   -> cbzsbsbc
+//   iubjdwtxoc: -> iubjwdtxoc
+//   :lsjklsty   -> sljklsty
+//   yyqxdv      -> yyqxvd
+//   :bcbrnnl    -> cbbrnnl
+//   :yrhrxi     -> yrhrix
+//   :qkkfyi     -> qkfkyi
+//   :qjzlsrotk  -> qjzlsortk
+//   ciehtd      -> icehtd
+//   gncsis      -> gnscis
+//   lrymeexi    -> lrymeeix
+//   cqwrcbdje   -> qcwrcbdje
+//   dgosbc      -> dgoscb
+//   fzdwua      -> fzduwa
+//   :ylrwfu     -> lyrwfu
+//   :notxiisi   -> ontxiisi
+//   fnxnnz      -> nfxnnz
+//   cqjuitfj    -> qcjuitfj
+//   wyxcrcn     -> wxycrcn
+//   zfmotwemc   -> zfmotwecm
+//   jrsryzohgn  -> jrsrzyohgn
+//   uyozmwwng   -> uyzomwwng
+//   cwoxaonok   -> cwoaxonok
+//   duaoszgo    -> duoaszgo
+//   jmvyyzd     -> jmvyydz
+//   gcmielkshr  -> gcmielskhr
+//   voyjtrg     -> vojytrg
+//   caazjez     -> acazjez
+//   vqgroq      -> vqgrqo
+//   ofjyszdnrl  -> ofjyzsdnrl
+//   :rjvutcbvc  -> rvjutcbvc
+//   bonypvgtb   -> boynpvgtb
+//   :jnsonzz    -> njsonzz
+//   xbcgry      -> xbcrgy
+//   deswga      -> deswag
+//   ricovboyj:  -> riocvboyj
+//   milnjxxqgv  -> mlinjxxqgv
+//   :gtbifhc    -> gtibfhc
+//   pymojwpso   -> pymjowpso
+//   uahfrwt     -> auhfrwt
+//   ylotazgvq   -> ylotazvgq
+//   bnqrmhrh    -> nbqrmhrh
+//   yxfice      -> xyfice
+//   fkexfrygn   -> fkefxrygn
+//   xzfpnxejhg  -> xzfpnexjhg
+//   xvswgo      -> xvsgwo
+//   zbjgimnm    -> zjbgimnm
+//   cfulgcqa    -> cfulgcaq
+//   bbtqsuc:    -> bbtqscu
+//   zrhxhix     -> zrxhhix
+//   cdtcedirje  -> cdtcdeirje
+//   lnfwndsa    -> lfnwndsa
+//   fluxcomddo: -> fluxcomdod
+//   :dfftfkn    -> dfftkfn
+//   ofyfvncoc   -> ofyvfncoc
+//   tmnldlayv   -> tmnldalyv
+//   :ceumyksv   -> ceumyskv
+//   cizclkryv:  -> ciczlkryv
+//   uyrkxi      -> uykrxi
+//   :yqayxih    -> yqayixh
+//   zroaqlqz    -> zroqalqz
+//   htylyvfhnu  -> htylyfvhnu
+//   lxfmaiabw   -> lxfmaaibw
+//   vzpgjog     -> vzpgojg
+//   fidbwvqtjx  -> fidbvwqtjx
+//   :embtki     -> ebmtki
+//   dxmcvnmqy:  -> dxmcnvmqy
+//   sbysyzo:    -> sbyyszo
+//   fnbfdmjr    -> fnbdfmjr
+//   vzniakk     -> vnziakk
+//   oaqiietm    -> aoqiietm
+//   lktwrs      -> kltwrs
+//   sjlstatub   -> sjlsttaub
+//   jhkvvxzq:   -> jkhvvxzq
+//   tzqawmlja   -> tzaqwmlja
+//   qimwax      -> iqmwax
+//   inhrmjuuth: -> inhrmujuth
+//   jkpyex      -> kjpyex
+//   sojbtozcuw  -> sjobtozcuw
+//   xjukudewmr  -> xjukudwemr
+//   xmzdlpr:    -> xmzdlrp
+//   cnmkkto     -> cnmkkot
+//   xxdtzrlp    -> xxdtrzlp
+//   tqqaaf      -> tqaqaf
+//   efurwbg     -> efurbwg
+//   hrdpckv     -> hrpdckv
+//   fdgoumvv    -> fgdoumvv
+//   lhdqqwnrxd  -> lhdqwqnrxd
+//   xjcczfsad   -> xjccfzsad
+//   teukfq:     -> teukqf
+//   ztchamq     -> zcthamq
+//   nqwlgtu:    -> nqwgltu
+//   hxsyptpc:   -> hxsyptcp
+//   oehaxbbhe   -> eohaxbbhe
+//   htkmmv      -> htkmvm
+//   cmfmwf      -> cfmmwf
+//   esxgbt      -> sexgbt
+//   abueltp     -> abeultp
+//   rhqqwv:     -> rhqwqv
+//   :bqnmgtwx   -> bqngmtwx
+//   hvwovvxum   -> hvwvovxum
+//   wjueiw      -> wjuiew
+//   ydedtnlop:  -> yddetnlop
+//   syaapqvrcu: -> syaapqrvcu
+//   molztscrp   -> molztcsrp
+//   jxsthjkose  -> jxsthjokse
+//   ljaysvnw    -> ljayvsnw
+//   :kqaknxgyi  -> kqakngxyi
+//   emaysti     -> emaytsi
+//   ecnenfn     -> ecnefnn
+//   ykwtdljk:   -> ywktdljk
+//   uxbczreagz  -> uxcbzreagz
+//   uhzrkiqw    -> uhzrkiwq
+//   ikwgtwo     -> ikgwtwo
+//   :xbwjvt     -> bxwjvt
+//   :jwavvr     -> jwavrv
+//   nxaqjj      -> xnaqjj
+//   aevhsxd     -> aevshxd
+//   eyjfwzszic: -> eyjfwszzic
+//   euarzjbad   -> eurazjbad
+//   gzquwowmfu  -> gzquwomwfu
+//   ociyekf     -> oicyekf
+//   :yxmhgpy    -> yxmhgyp
+//   zpzkadt     -> zpzkdat
+//   srfjhbg     -> srjfhbg
+//   cubgatdq:   -> cubagtdq
+//   :gyrehv     -> gryehv
+//   tmxyuqbobb  -> tmxyqubobb
+//   :kldroyj    -> kldoryj
+//   eogaol      -> eoagol
+//   duaonjs     -> dauonjs
+//   ycosffm     -> ycsoffm
+//   vpnogb      -> vpnobg
+//   qjgyzoj     -> jqgyzoj
+//   :fuxezmlm   -> fuexzmlm
+//   qkcytd:     -> kqcytd
+//   ihleretzvl  -> ihleertzvl
+//   :mziuwbg    -> mzuiwbg
+//   :kqrvmq     -> kqrmvq
+//   bwrksrmci   -> bwrksrmic
+//   hbutbt      -> hbuttb
+//   aglxvfiej   -> algxvfiej
+//   rbnpoyqbmk  -> rbnpoyqmbk
+//   :mhpokbakt  -> mhopkbakt
+//   nmxxme      -> nmxxem
+//   qamojismx   -> aqmojismx
+//   :bufqgjxa   -> bufqjgxa
+//   fgfoffyihq  -> fgfoffiyhq
+//   wjqclixogw  -> wjcqlixogw
+//   mjfffx:     -> mfjffx
+//   msfitddj    -> msiftddj
+//   :fzxasre    -> fxzasre
+//   kbtxpj      -> kbxtpj
+
+#define AUTOCORRECT_MIN_LENGTH 6 // "htegqt"
+#define AUTOCORRECT_MAX_LENGTH 11 // ":sbbkrwdjds"
+#define DICTIONARY_SIZE 35656
+
+#define AUTOCORRECT_FLAT_TRIE
+#define AUTOCORRECT_BLOOM_SUFFIX 3
+#define AUTOCORRECT_BLOOM_BITS 8192
+
+static const uint8_t autocorrect_bloom[AUTOCORRECT_BLOOM_BITS / 8] PROGMEM = {
+    0x10, 0x10, 0x00, 0x80, 0x00, 0x10, 0x20, 0x40, 0x01, 0x11, 0x00, 0x20, 0x28, 0x00, 0x02, 0x0C,
+    0xC4, 0x08, 0x40, 0x40, 0x90, 0x11, 0x00, 0x01, 0x02, 0x2E, 0x60, 0x68, 0x01, 0x81, 0x02, 0x80,
+    0x80, 0xA1, 0x44, 0x20, 0x00, 0x10, 0xC0, 0x18, 0x80, 0x39, 0x84, 0x01, 0x00, 0x00, 0x43, 0x09,
+    0x00, 0x60, 0x0A, 0x00, 0x41, 0x00, 0x04, 0x00, 0x08, 0x08, 0xB8, 0x00, 0x00, 0x00, 0x40, 0x08,
+    0x40, 0x80, 0x02, 0x00, 0x20, 0x11, 0x80, 0x04, 0x00, 0x00, 0x4C, 0x02, 0xE0, 0x14, 0x20, 0x44,
+    0x40, 0x42, 0x6D, 0x04, 0x60, 0x00, 0x50, 0x00, 0x25, 0x20, 0x04, 0x55, 0x00, 0x22, 0xF1, 0xA2,
+    0x00, 0x00, 0x43, 0x45, 0x62, 0x84, 0x08, 0x85, 0x00, 0x40, 0x22, 0xE9, 0x05, 0x00, 0x00, 0x01,
+    0xC6, 0xA0, 0x00, 0x02, 0x00, 0x0A, 0x00, 0x52, 0x00, 0x45, 0x22, 0x20, 0x00, 0x88, 0x20, 0x20,
+    0x05, 0x08, 0x02, 0x04, 0x01, 0x00, 0x08, 0x60, 0x00, 0x48, 0x00, 0x44, 0x00, 0x28, 0xB0, 0x00,
+    0x80, 0x01, 0x04, 0xA2, 0x00, 0x0A, 0x84, 0x00, 0xF0, 0x01, 0x0A, 0x30, 0x20, 0x00, 0x45, 0xA0,
+    0x01, 0x54, 0x01, 0x2A, 0x22, 0x30, 0x12, 0xA2, 0xC6, 0x42, 0x20, 0x02, 0x00, 0x00, 0xA0, 0x00,
+    0x02, 0x50, 0x09, 0x00, 0x88, 0x12, 0x28, 0x01, 0x10, 0x10, 0x18, 0x00, 0xB0, 0x08, 0x00, 0x00,
+    0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x88, 0x06, 0x02, 0x00, 0x20, 0x01, 0x00,
+    0x00, 0x00, 0x50, 0x00, 0x00, 0x01, 0xC4, 0x00, 0x00, 0x04, 0x12, 0x00, 0x42, 0x88, 0xD5, 0x00,
+    0x81, 0x8A, 0x90, 0x64, 0x44, 0x1B, 0x20, 0x03, 0x28, 0x18, 0x02, 0x09, 0x20, 0x20, 0xA4, 0x0F,
+    0x01, 0x8A, 0x04, 0x11, 0x08, 0x02, 0x42, 0x24, 0x38, 0x80, 0x40, 0x48, 0x20, 0x06, 0x80, 0x00,
+    0x00, 0x40, 0x41, 0xD0, 0x00, 0xD0, 0x80, 0x09, 0x02, 0x04, 0x15, 0xC0, 0x00, 0x00, 0x30, 0x20,
+    0xC8, 0x02, 0x4B, 0x05, 0x00, 0x00, 0x2C, 0x40, 0x09, 0x80, 0x20, 0x22, 0x00, 0x01, 0x30, 0x20,
+    0x0E, 0x49, 0x04, 0x00, 0x80, 0x90, 0x21, 0x00, 0x01, 0x45, 0x50, 0x41, 0x01, 0x00, 0x20, 0x42,
+    0x01, 0x48, 0x02, 0x00, 0xC0, 0x28, 0x88, 0x20, 0x61, 0x08, 0x13, 0x84, 0x02, 0x6E, 0x00, 0x00,
+    0x00, 0x10, 0x02, 0x40, 0x58, 0x01, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x80, 0x84, 0x88, 0x00,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x16, 0x80, 0x00, 0x10, 0x80, 0x43,
+    0x68, 0x08, 0x8C, 0x60, 0x04, 0x80, 0x60, 0x24, 0x00, 0x0A, 0x01, 0x19, 0x40, 0x05, 0x80, 0x02,
+    0x20, 0x02, 0xC8, 0x90, 0x90, 0x8C, 0x98, 0xCA, 0x01, 0x5C, 0x08, 0x45, 0x20, 0x00, 0x02, 0x43,
+    0xD4, 0x80, 0x10, 0x0A, 0x20, 0xB0, 0x08, 0x08, 0x01, 0x00, 0x50, 0x90, 0x30, 0x29, 0x08, 0x82,
+    0x21, 0x00, 0x20, 0x00, 0x00, 0x80, 0x04, 0x00, 0xCF, 0x08, 0xA2, 0x02, 0x02, 0x02, 0xC0, 0x01,
+    0x00, 0x03, 0x00, 0xA5, 0x21, 0x88, 0x21, 0xBA, 0x18, 0x4D, 0x4C, 0x02, 0x09, 0x04, 0x80, 0x20,
+    0xC2, 0x19, 0x90, 0x50, 0x84, 0x03, 0x00, 0x84, 0x20, 0x08, 0x04, 0xC9, 0x20, 0x46, 0xE8, 0x02,
+    0x54, 0x22, 0x07, 0x00, 0x40, 0x21, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x08, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x00,
+    0x00, 0x84, 0x11, 0x00, 0x00, 0x00, 0x81, 0x42, 0x48, 0x00, 0x04, 0x11, 0x00, 0xC0, 0x94, 0x0D,
+    0x20, 0x20, 0x89, 0x40, 0x02, 0x82, 0x41, 0x56, 0x00, 0x60, 0x01, 0x90, 0x00, 0x21, 0xD2, 0x09,
+    0x08, 0x45, 0x08, 0x76, 0xC3, 0x4A, 0x04, 0x64, 0x81, 0x00, 0x4C, 0x40, 0x3A, 0x00, 0x0C, 0x00,
+    0x00, 0x44, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x30, 0x08, 0x04, 0x00, 0x10, 0x81, 0x00, 0x01,
+    0xAC, 0x00, 0x08, 0x00, 0x00, 0x08, 0x4C, 0x64, 0x40, 0x0A, 0x04, 0x00, 0x90, 0x9B, 0x28, 0x60,
+    0x12, 0x29, 0x0A, 0x15, 0x00, 0x63, 0x00, 0x27, 0x48, 0x24, 0x31, 0x80, 0x18, 0xA4, 0x00, 0x00,
+    0x88, 0x55, 0x04, 0x51, 0x04, 0x61, 0x00, 0x10, 0x80, 0x20, 0x5C, 0x8A, 0xB8, 0x81, 0x42, 0x18,
+    0x04, 0x10, 0x20, 0xF5, 0x22, 0x04, 0x08, 0x05, 0x15, 0x48, 0x87, 0xC0, 0x10, 0x00, 0x38, 0x01,
+    0x00, 0x04, 0x90, 0x61, 0x08, 0x02, 0x90, 0x0A, 0xA1, 0x0C, 0x00, 0x80, 0x00, 0x19, 0x49, 0x02,
+    0x44, 0x41, 0x80, 0xC8, 0x44, 0x09, 0x30, 0x80, 0x20, 0x21, 0x00, 0x46, 0x76, 0x80, 0x12, 0x80,
+    0x0A, 0x04, 0x0A, 0x04, 0x8C, 0x00, 0xC7, 0x0C, 0x28, 0xA5, 0x00, 0x00, 0x04, 0x8A, 0xA4, 0x33,
+    0x08, 0x30, 0xB8, 0x96, 0x41, 0x02, 0x11, 0x08, 0x80, 0x05, 0x20, 0x04, 0x80, 0x03, 0x02, 0x20,
+    0x23, 0x04, 0x50, 0x18, 0x00, 0x02, 0x02, 0x00, 0x02, 0x08, 0x14, 0x00, 0x48, 0x00, 0x50, 0x00,
+    0x2D, 0x01, 0x20, 0x01, 0x10, 0x00, 0x12, 0x08, 0x09, 0x70, 0x20, 0x20, 0x01, 0x40, 0x0C, 0x10,
+    0x44, 0x96, 0x84, 0xA2, 0x85, 0xE0, 0x00, 0x20, 0xA8, 0xB8, 0x26, 0x1A, 0x46, 0x18, 0x00, 0x8E,
+    0x88, 0x98, 0x72, 0x12, 0x02, 0x82, 0xA6, 0x44, 0x18, 0xC0, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x10, 0xC9, 0x20, 0x01, 0x02, 0x24, 0x08, 0x20, 0x00, 0x40, 0x01, 0x12, 0x03, 0x18,
+    0x04, 0x40, 0x0C, 0x00, 0x08, 0x10, 0x02, 0x28, 0x00, 0xA1, 0x44, 0x92, 0x80, 0x41, 0x11, 0x80,
+    0x61, 0x10, 0x48, 0x63, 0x12, 0x89, 0x08, 0x18, 0x60, 0x8B, 0x86, 0x00, 0xC2, 0x32, 0x19, 0x20,
+    0xCF, 0x24, 0x40, 0x44, 0x82, 0x10, 0xC0, 0x54, 0x69, 0x51, 0x80, 0x31, 0xEF, 0x20, 0x50, 0x00,
+    0x74, 0xC1, 0x40, 0x10, 0xA0, 0x04, 0x88, 0x58, 0x03, 0x00, 0x28, 0x11, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0x02, 0x40, 0x44, 0x28, 0x10, 0x56, 0x20, 0x81, 0x48, 0xE8, 0xA9, 0x80, 0x09,
+    0x85, 0x00, 0x11, 0xE0, 0xC0, 0xCA, 0x16, 0x01, 0xA3, 0x0A, 0x90, 0x41, 0x14, 0x98, 0x00, 0x80,
+    0x52, 0x46, 0x14, 0x82, 0x53, 0xD4, 0x16, 0x10, 0x18, 0x41, 0xF4, 0x40, 0x30, 0x03, 0x01, 0x0D,
+    0x00, 0x44, 0xA4, 0x01, 0x07, 0x08, 0x00, 0x10, 0x00, 0x11, 0x10, 0x40, 0x00, 0xC2, 0x52, 0x84,
+    0x00, 0x0A, 0x00, 0x48, 0x80, 0x20, 0x50, 0x91, 0x81, 0x98, 0x28, 0x41, 0x1D, 0x69, 0xCD, 0x48,
+    0xB8, 0x04, 0x42, 0x06, 0xC8, 0x15, 0x19, 0x56, 0xCA, 0x98, 0x2D, 0xA1, 0xA2, 0x04, 0x44, 0x24,
+    0xA1, 0x11, 0x0C, 0x09, 0xAF, 0xCB, 0x36, 0xB5, 0x38, 0xDF, 0xB2, 0x00, 0x87, 0xC1, 0x75, 0x00,
+    0xAA, 0x9B, 0xD0, 0x02, 0x90, 0x3A, 0x94, 0x41, 0x0D, 0x10, 0xA0, 0x03, 0x03, 0x29, 0x4C, 0x22,
+    0x66, 0x29, 0x30, 0x88, 0x58, 0x01, 0x6B, 0x4A, 0x80, 0xA3, 0xB7, 0x64, 0xA0, 0x73, 0x92, 0x30,
+    0x51, 0x83, 0x45, 0x44, 0xC1, 0x70, 0xDD, 0x92, 0x13, 0x3D, 0x83, 0x78, 0xC2, 0xD0, 0x70, 0xD2,
+    0x06, 0x84, 0x83, 0xC0, 0x19, 0x6A, 0xBF, 0x6E, 0x28, 0x7A, 0xB2, 0x95, 0x28, 0x14, 0x2E, 0x44,
+    0x14, 0x21, 0x25, 0x09, 0xC6, 0x1A, 0x09, 0x0B, 0x04, 0x18, 0x1A, 0x44, 0x08, 0x29, 0x08, 0x10,
+    0x20, 0x00, 0x02, 0x44, 0x04, 0x84, 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x40
+};
+
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    0x1B, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x2C, 0x52, 0x00, 0x1F, 0x05,
+    0x92, 0x09, 0x75, 0x0E, 0x2D, 0x12, 0xB6, 0x16, 0x85, 0x1B, 0x28, 0x21, 0xAF, 0x25, 0xCA, 0x2A,
+    0x1F, 0x30, 0x0C, 0x35, 0x4D, 0x3A, 0x16, 0x3F, 0x66, 0x43, 0x40, 0x48, 0xB4, 0x4D, 0xF7, 0x51,
+    0xE9, 0x56, 0xA4, 0x5A, 0x6E, 0x5F, 0x30, 0x64, 0x88, 0x69, 0x54, 0x6E, 0x3A, 0x73, 0x94, 0x78,
+    0xE9, 0x7D, 0x1A, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0xA1, 0x00, 0xB4,
+    0x00, 0xEE, 0x00, 0x12, 0x01, 0x34, 0x01, 0x3D, 0x01, 0x4F, 0x01, 0x7C, 0x01, 0xAC, 0x01, 0x0B,
+    0x02, 0x5C, 0x02, 0x7B, 0x02, 0xA5, 0x02, 0xC7, 0x02, 0x29, 0x03, 0x54, 0x03, 0x62, 0x03, 0xAE,
+    0x03, 0xC1, 0x03, 0x16, 0x04, 0x20, 0x04, 0x6A, 0x04, 0x79, 0x04, 0x99, 0x04, 0xE9, 0x04, 0xF5,
+    0x04, 0x48, 0x09, 0x15, 0x08, 0x0C, 0x09, 0x11, 0x17, 0x09, 0x87, 0x66, 0x6E, 0x69, 0x65, 0x72,
+    0x66, 0x61, 0x61, 0x00, 0x03, 0x05, 0x14, 0x1A, 0xBE, 0x00, 0xCB, 0x00, 0xDA, 0x00, 0x45, 0x0B,
+    0x11, 0x0E, 0x10, 0x2C, 0x84, 0x68, 0x6E, 0x62, 0x62, 0x61, 0x00, 0x45, 0x1D, 0x17, 0x11, 0x1B,
+    0x1A, 0x86, 0x6E, 0x78, 0x74, 0x7A, 0x71, 0x62, 0x61, 0x00, 0x47, 0x0E, 0x06, 0x08, 0x1C, 0x0C,
+    0x09, 0x0A, 0x89, 0x66, 0x67, 0x69, 0x79, 0x65, 0x63, 0x6B, 0x77, 0x62, 0x61, 0x00, 0x02, 0x0A,
+    0x0B, 0xF5, 0x00, 0x08, 0x01, 0x47, 0x18, 0x17, 0x0A, 0x12, 0x08, 0x19, 0x2C, 0x88, 0x65, 0x76,
+    0x6F, 0x67, 0x74, 0x75, 0x67, 0x63, 0x61, 0x00, 0x43, 0x14, 0x16, 0x08, 0x83, 0x68, 0x71, 0x63,
+    0x61, 0x00, 0x02, 0x1C, 0x1D, 0x19, 0x01, 0x23, 0x01, 0x43, 0x0E, 0x05, 0x08, 0x83, 0x79, 0x6B,
+    0x64, 0x61, 0x00, 0x48, 0x1A, 0x14, 0x0A, 0x06, 0x0F, 0x0B, 0x05, 0x2C, 0x85, 0x71, 0x67, 0x77,
+    0x7A, 0x64, 0x61, 0x00, 0x44, 0x10, 0x04, 0x09, 0x11, 0x81, 0x61, 0x65, 0x00, 0x47, 0x1A, 0x15,
+    0x11, 0x12, 0x18, 0x1D, 0x1B, 0x87, 0x75, 0x7A, 0x6F, 0x6E, 0x72, 0x77, 0x66, 0x61, 0x00, 0x03,
+    0x04, 0x19, 0x1A, 0x59, 0x01, 0x64, 0x01, 0x74, 0x01, 0x46, 0x10, 0x0D, 0x15, 0x14, 0x0B, 0x15,
+    0x81, 0x61, 0x67, 0x00, 0x46, 0x11, 0x10, 0x0C, 0x0B, 0x12, 0x13, 0x86, 0x69, 0x68, 0x6D, 0x6E,
+    0x76, 0x67, 0x61, 0x00, 0x43, 0x16, 0x08, 0x07, 0x81, 0x61, 0x67, 0x00, 0x03, 0x07, 0x0C, 0x0D,
+    0x86, 0x01, 0x91, 0x01, 0xA0, 0x01, 0x44, 0x0F, 0x10, 0x14, 0x0B, 0x83, 0x64, 0x6C, 0x68, 0x61,
+    0x00, 0x46, 0x0B, 0x0E, 0x0D, 0x1D, 0x16, 0x2C, 0x85, 0x6B, 0x6A, 0x68, 0x69, 0x68, 0x61, 0x00,
+    0x46, 0x09, 0x1D, 0x16, 0x0C, 0x16, 0x1C, 0x82, 0x68, 0x6A, 0x61, 0x00, 0x05, 0x0A, 0x0C, 0x0F,
+    0x15, 0x1A, 0xBC, 0x01, 0xC6, 0x01, 0xD3, 0x01, 0xDE, 0x01, 0xF7, 0x01, 0x45, 0x13, 0x0C, 0x04,
+    0x19, 0x06, 0x81, 0x61, 0x69, 0x00, 0x44, 0x16, 0x1C, 0x07, 0x2C, 0x85, 0x79, 0x64, 0x73, 0x69,
+    0x69, 0x61, 0x00, 0x44, 0x11, 0x08, 0x13, 0x10, 0x83, 0x6C, 0x6E, 0x69, 0x61, 0x00, 0x02, 0x10,
+    0x1D, 0xE5, 0x01, 0xEF, 0x01, 0x44, 0x15, 0x0E, 0x14, 0x2C, 0x82, 0x69, 0x72, 0x61, 0x00, 0x42,
+    0x17, 0x0D, 0x82, 0x69, 0x72, 0x61, 0x00, 0x48, 0x0C, 0x10, 0x0B, 0x1A, 0x1D, 0x0C, 0x0D, 0x2C,
+    0x88, 0x7A, 0x69, 0x77, 0x68, 0x6D, 0x69, 0x77, 0x69, 0x61, 0x00, 0x04, 0x09, 0x0F, 0x11, 0x13,
+    0x18, 0x02, 0x2A, 0x02, 0x3A, 0x02, 0x49, 0x02, 0x47, 0x05, 0x0A, 0x0D, 0x10, 0x12, 0x11, 0x2C,
+    0x87, 0x6D, 0x6F, 0x6A, 0x67, 0x62, 0x66, 0x6A, 0x61, 0x00, 0x46, 0x10, 0x1A, 0x04, 0x14, 0x1D,
+    0x17, 0x86, 0x61, 0x71, 0x77, 0x6D, 0x6C, 0x6A, 0x61, 0x00, 0x46, 0x0B, 0x05, 0x07, 0x1B, 0x04,
+    0x2C, 0x85, 0x62, 0x64, 0x68, 0x6E, 0x6A, 0x61, 0x00, 0x47, 0x16, 0x16, 0x15, 0x15, 0x07, 0x1C,
+    0x12, 0x88, 0x64, 0x79, 0x72, 0x72, 0x73, 0x73, 0x70, 0x6A, 0x61, 0x00, 0x02, 0x0C, 0x12, 0x63,
+    0x02, 0x70, 0x02, 0x46, 0x0D, 0x11, 0x13, 0x0D, 0x14, 0x05, 0x83, 0x69, 0x6A, 0x6B, 0x61, 0x00,
+    0x44, 0x15, 0x12, 0x0C, 0x11, 0x83, 0x6F, 0x72, 0x6B, 0x61, 0x00, 0x02, 0x05, 0x17, 0x82, 0x02,
+    0x92, 0x02, 0x46, 0x0C, 0x11, 0x0F, 0x15, 0x0C, 0x16, 0x86, 0x6C, 0x72, 0x6E, 0x69, 0x62, 0x6C,
+    0x61, 0x00, 0x47, 0x1A, 0x19, 0x13, 0x08, 0x12, 0x10, 0x18, 0x88, 0x6F, 0x6D, 0x65, 0x70, 0x76,
+    0x77, 0x74, 0x6C, 0x61, 0x00, 0x02, 0x09, 0x0F, 0xAC, 0x02, 0xBB, 0x02, 0x45, 0x04, 0x0D, 0x1C,
+    0x05, 0x06, 0x86, 0x79, 0x62, 0x6A, 0x61, 0x66, 0x6D, 0x61, 0x00, 0x43, 0x14, 0x14, 0x17, 0x85,
+    0x71, 0x74, 0x71, 0x6C, 0x6D, 0x61, 0x00, 0x05, 0x04, 0x06, 0x0B, 0x10, 0x12, 0xD7, 0x02, 0xE0,
+    0x02, 0xEF, 0x02, 0x0E, 0x03, 0x1F, 0x03, 0x43, 0x0A, 0x16, 0x0B, 0x82, 0x6E, 0x61, 0x61, 0x00,
+    0x45, 0x0A, 0x09, 0x1A, 0x1D, 0x04, 0x86, 0x77, 0x7A, 0x66, 0x67, 0x63, 0x6E, 0x61, 0x00, 0x02,
+    0x0F, 0x18, 0xF6, 0x02, 0x00, 0x03, 0x42, 0x08, 0x06, 0x84, 0x6C, 0x65, 0x68, 0x6E, 0x61, 0x00,
+    0x46, 0x0A, 0x0A, 0x14, 0x0B, 0x19, 0x0B, 0x84, 0x75, 0x67, 0x68, 0x6E, 0x61, 0x00, 0x46, 0x19,
+    0x0A, 0x05, 0x0D, 0x05, 0x16, 0x87, 0x6A, 0x62, 0x62, 0x67, 0x76, 0x6D, 0x6E, 0x61, 0x00, 0x45,
+    0x14, 0x0D, 0x10, 0x06, 0x04, 0x81, 0x61, 0x6E, 0x00, 0x03, 0x12, 0x15, 0x1D, 0x33, 0x03, 0x3D,
+    0x03, 0x48, 0x03, 0x45, 0x19, 0x0F, 0x10, 0x16, 0x0C, 0x81, 0x61, 0x6F, 0x00, 0x46, 0x0F, 0x11,
+    0x10, 0x0C, 0x0E, 0x10, 0x81, 0x61, 0x6F, 0x00, 0x44, 0x17, 0x08, 0x0D, 0x09, 0x84, 0x74, 0x65,
+    0x7A, 0x6F, 0x61, 0x00, 0x47, 0x0B, 0x06, 0x12, 0x06, 0x1A, 0x14, 0x0B, 0x83, 0x68, 0x63, 0x70,
+    0x61, 0x00, 0x04, 0x06, 0x0A, 0x0E, 0x10, 0x6F, 0x03, 0x86, 0x03, 0x93, 0x03, 0xA2, 0x03, 0x02,
+    0x0A, 0x0F, 0x76, 0x03, 0x7F, 0x03, 0x44, 0x0F, 0x18, 0x09, 0x06, 0x81, 0x61, 0x71, 0x00, 0x42,
+    0x18, 0x0C, 0x81, 0x61, 0x71, 0x00, 0x44, 0x07, 0x1D, 0x1C, 0x19, 0x85, 0x7A, 0x79, 0x64, 0x67,
+    0x71, 0x61, 0x00, 0x45, 0x09, 0x17, 0x1A, 0x09, 0x0F, 0x86, 0x77, 0x66, 0x74, 0x66, 0x6B, 0x71,
+    0x61, 0x00, 0x43, 0x1A, 0x0D, 0x0B, 0x85, 0x6A, 0x68, 0x77, 0x6D, 0x71, 0x61, 0x00, 0x49, 0x14,
+    0x18, 0x1D, 0x1A, 0x15, 0x1B, 0x1C, 0x14, 0x2C, 0x86, 0x77, 0x72, 0x7A, 0x75, 0x71, 0x72, 0x61,
+    0x00, 0x04, 0x04, 0x07, 0x08, 0x0A, 0xCE, 0x03, 0xDC, 0x03, 0xFD, 0x03, 0x05, 0x04, 0x47, 0x1B,
+    0x1B, 0x05, 0x0A, 0x0A, 0x0F, 0x13, 0x83, 0x61, 0x78, 0x73, 0x61, 0x00, 0x02, 0x05, 0x11, 0xE3,
+    0x03, 0xEF, 0x03, 0x44, 0x1B, 0x12, 0x1C, 0x2C, 0x84, 0x62, 0x78, 0x64, 0x73, 0x61, 0x00, 0x44,
+    0x1A, 0x09, 0x11, 0x0F, 0x86, 0x66, 0x6E, 0x77, 0x6E, 0x64, 0x73, 0x61, 0x00, 0x43, 0x1C, 0x19,
+    0x10, 0x81, 0x61, 0x73, 0x00, 0x47, 0x14, 0x15, 0x05, 0x19, 0x1B, 0x15, 0x07, 0x86, 0x62, 0x76,
+    0x72, 0x71, 0x67, 0x73, 0x61, 0x00, 0x44, 0x08, 0x06, 0x1B, 0x04, 0x82, 0x74, 0x65, 0x61, 0x00,
+    0x05, 0x06, 0x0B, 0x14, 0x16, 0x1A, 0x30, 0x04, 0x3D, 0x04, 0x4A, 0x04, 0x55, 0x04, 0x61, 0x04,
+    0x47, 0x0C, 0x05, 0x10, 0x12, 0x06, 0x19, 0x2C, 0x82, 0x75, 0x63, 0x61, 0x00, 0x44, 0x06, 0x17,
+    0x0F, 0x14, 0x85, 0x74, 0x6C, 0x63, 0x68, 0x75, 0x61, 0x00, 0x43, 0x07, 0x0F, 0x1D, 0x84, 0x64,
+    0x6C, 0x71, 0x75, 0x61, 0x00, 0x45, 0x1C, 0x1B, 0x08, 0x17, 0x2C, 0x83, 0x73, 0x79, 0x75, 0x61,
+    0x00, 0x43, 0x07, 0x1D, 0x09, 0x82, 0x75, 0x77, 0x61, 0x00, 0x45, 0x0B, 0x0E, 0x15, 0x0C, 0x0B,
+    0x86, 0x69, 0x68, 0x72, 0x6B, 0x68, 0x76, 0x61, 0x00, 0x02, 0x04, 0x17, 0x80, 0x04, 0x8A, 0x04,
+    0x45, 0x0F, 0x07, 0x0E, 0x1A, 0x0B, 0x81, 0x61, 0x77, 0x00, 0x46, 0x18, 0x13, 0x15, 0x1A, 0x1B,
+    0x05, 0x85, 0x70, 0x72, 0x75, 0x74, 0x77, 0x61, 0x00, 0x05, 0x04, 0x0D, 0x0E, 0x15, 0x16, 0xA9,
+    0x04, 0xB5, 0x04, 0xC2, 0x04, 0xCB, 0x04, 0xDB, 0x04, 0x46, 0x19, 0x1C, 0x1C, 0x09, 0x08, 0x10,
+    0x82, 0x78, 0x61, 0x61, 0x00, 0x46, 0x0A, 0x14, 0x09, 0x18, 0x05, 0x2C, 0x83, 0x6A, 0x67, 0x78,
+    0x61, 0x00, 0x44, 0x1C, 0x1C, 0x0F, 0x1D, 0x81, 0x61, 0x78, 0x00, 0x45, 0x08, 0x09, 0x13, 0x0B,
+    0x05, 0x87, 0x68, 0x62, 0x70, 0x66, 0x65, 0x72, 0x78, 0x61, 0x00, 0x46, 0x12, 0x06, 0x16, 0x0B,
+    0x07, 0x0E, 0x84, 0x6F, 0x63, 0x73, 0x78, 0x61, 0x00, 0x44, 0x10, 0x14, 0x17, 0x17, 0x84, 0x71,
+    0x74, 0x6D, 0x79, 0x61, 0x00, 0x03, 0x06, 0x07, 0x19, 0xFF, 0x04, 0x08, 0x05, 0x15, 0x05, 0x43,
+    0x1B, 0x15, 0x14, 0x82, 0x7A, 0x63, 0x61, 0x00, 0x47, 0x13, 0x04, 0x08, 0x1C, 0x08, 0x0A, 0x04,
+    0x82, 0x7A, 0x64, 0x61, 0x00, 0x43, 0x04, 0x0B, 0x10, 0x83, 0x76, 0x61, 0x7A, 0x61, 0x00, 0x17,
+    0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x15,
+    0x16, 0x17, 0x18, 0x1A, 0x1B, 0x1C, 0x1D, 0x65, 0x05, 0x87, 0x05, 0xCB, 0x05, 0xF2, 0x05, 0x19,
+    0x06, 0x3B, 0x06, 0x91, 0x06, 0x9E, 0x06, 0xC6, 0x06, 0xD1, 0x06, 0x08, 0x07, 0x11, 0x07, 0x42,
+    0x07, 0x51, 0x07, 0x9B, 0x07, 0xC0, 0x07, 0xF3, 0x07, 0x31, 0x08, 0x54, 0x08, 0xB4, 0x08, 0xC4,
+    0x08, 0x30, 0x09, 0x66, 0x09, 0x02, 0x04, 0x0C, 0x6C, 0x05, 0x7B, 0x05, 0x46, 0x1B, 0x05, 0x10,
+    0x07, 0x09, 0x08, 0x85, 0x62, 0x6D, 0x78, 0x61, 0x61, 0x62, 0x00, 0x43, 0x0F, 0x1C, 0x07, 0x85,
+    0x79, 0x64, 0x6C, 0x69, 0x61, 0x62, 0x00, 0x04, 0x08, 0x09, 0x12, 0x1C, 0x94, 0x05, 0x9D, 0x05,
+    0xAE, 0x05, 0xBE, 0x05, 0x43, 0x0B, 0x14, 0x17, 0x82, 0x62, 0x65, 0x62, 0x00, 0x47, 0x0A, 0x0A,
+    0x05, 0x11, 0x1D, 0x0D, 0x0D, 0x86, 0x62, 0x6E, 0x67, 0x67, 0x66, 0x62, 0x62, 0x00, 0x47, 0x05,
+    0x14, 0x18, 0x1C, 0x1B, 0x10, 0x17, 0x85, 0x71, 0x75, 0x62, 0x6F, 0x62, 0x62, 0x00, 0x47, 0x1B,
+    0x0E, 0x09, 0x10, 0x0C, 0x07, 0x0C, 0x82, 0x62, 0x79, 0x62, 0x00, 0x02, 0x14, 0x1C, 0xD2, 0x05,
+    0xE3, 0x05, 0x47, 0x06, 0x18, 0x1D, 0x1C, 0x0F, 0x14, 0x11, 0x86, 0x7A, 0x79, 0x75, 0x63, 0x71,
+    0x63, 0x62, 0x00, 0x45, 0x15, 0x07, 0x1C, 0x09, 0x07, 0x86, 0x79, 0x66, 0x64, 0x72, 0x79, 0x63,
+    0x62, 0x00, 0x03, 0x0C, 0x0E, 0x14, 0xFC, 0x05, 0x04, 0x06, 0x0C, 0x06, 0x43, 0x07, 0x12, 0x1D,
+    0x81, 0x62, 0x65, 0x00, 0x43, 0x0E, 0x1D, 0x0D, 0x81, 0x62, 0x65, 0x00, 0x45, 0x11, 0x1B, 0x05,
+    0x16, 0x1D, 0x84, 0x6E, 0x78, 0x71, 0x65, 0x62, 0x00, 0x02, 0x11, 0x15, 0x20, 0x06, 0x2F, 0x06,
+    0x47, 0x0B, 0x09, 0x1C, 0x0B, 0x19, 0x09, 0x19, 0x84, 0x68, 0x66, 0x6E, 0x66, 0x62, 0x00, 0x46,
+    0x07, 0x18, 0x08, 0x05, 0x15, 0x2C, 0x82, 0x66, 0x72, 0x62, 0x00, 0x04, 0x05, 0x07, 0x12, 0x1A,
+    0x48, 0x06, 0x69, 0x06, 0x79, 0x06, 0x81, 0x06, 0x02, 0x05, 0x1B, 0x4F, 0x06, 0x5D, 0x06, 0x45,
+    0x04, 0x06, 0x11, 0x09, 0x2C, 0x85, 0x61, 0x63, 0x62, 0x62, 0x67, 0x62, 0x00, 0x44, 0x04, 0x0E,
+    0x0F, 0x12, 0x84, 0x78, 0x61, 0x62, 0x67, 0x62, 0x00, 0x45, 0x09, 0x1A, 0x1D, 0x12, 0x16, 0x87,
+    0x6F, 0x73, 0x7A, 0x77, 0x66, 0x64, 0x67, 0x62, 0x00, 0x43, 0x11, 0x13, 0x19, 0x81, 0x62, 0x67,
+    0x00, 0x47, 0x08, 0x0C, 0x1C, 0x16, 0x18, 0x10, 0x2C, 0x85, 0x69, 0x79, 0x65, 0x77, 0x67, 0x62,
+    0x00, 0x45, 0x13, 0x1B, 0x07, 0x12, 0x11, 0x84, 0x78, 0x64, 0x70, 0x68, 0x62, 0x00, 0x02, 0x05,
+    0x0C, 0xA5, 0x06, 0xB7, 0x06, 0x47, 0x10, 0x1C, 0x10, 0x16, 0x07, 0x18, 0x1B, 0x87, 0x73, 0x64,
+    0x6D, 0x79, 0x6D, 0x62, 0x69, 0x62, 0x00, 0x46, 0x05, 0x17, 0x0A, 0x04, 0x1B, 0x10, 0x85, 0x74,
+    0x67, 0x62, 0x69, 0x69, 0x62, 0x00, 0x45, 0x17, 0x1A, 0x14, 0x16, 0x07, 0x82, 0x6A, 0x74, 0x62,
+    0x00, 0x04, 0x05, 0x0B, 0x0C, 0x12, 0xDE, 0x06, 0xE7, 0x06, 0xF0, 0x06, 0xFC, 0x06, 0x44, 0x16,
+    0x13, 0x13, 0x06, 0x81, 0x62, 0x6B, 0x00, 0x44, 0x1A, 0x04, 0x10, 0x17, 0x81, 0x62, 0x6B, 0x00,
+    0x43, 0x12, 0x1C, 0x13, 0x85, 0x79, 0x70, 0x6F, 0x69, 0x6B, 0x62, 0x00, 0x44, 0x04, 0x1C, 0x07,
+    0x1B, 0x84, 0x61, 0x79, 0x6F, 0x6B, 0x62, 0x00, 0x44, 0x0F, 0x13, 0x13, 0x06, 0x81, 0x62, 0x6C,
+    0x00, 0x03, 0x14, 0x17, 0x1B, 0x1B, 0x07, 0x26, 0x07, 0x30, 0x07, 0x43, 0x1D, 0x17, 0x1C, 0x84,
+    0x7A, 0x74, 0x71, 0x6D, 0x62, 0x00, 0x45, 0x14, 0x1B, 0x19, 0x0E, 0x2C, 0x81, 0x62, 0x6D, 0x00,
+    0x46, 0x1A, 0x0C, 0x0D, 0x19, 0x0B, 0x06, 0x88, 0x68, 0x63, 0x76, 0x6A, 0x69, 0x77, 0x78, 0x6D,
+    0x62, 0x00, 0x49, 0x15, 0x1B, 0x0C, 0x16, 0x04, 0x05, 0x18, 0x19, 0x2C, 0x82, 0x6F, 0x72, 0x62,
+    0x00, 0x04, 0x05, 0x10, 0x15, 0x17, 0x5E, 0x07, 0x6C, 0x07, 0x7B, 0x07, 0x88, 0x07, 0x46, 0x0B,
+    0x07, 0x18, 0x07, 0x12, 0x1C, 0x84, 0x68, 0x64, 0x62, 0x70, 0x62, 0x00, 0x45, 0x12, 0x19, 0x1A,
+    0x08, 0x0D, 0x86, 0x77, 0x65, 0x76, 0x6F, 0x6D, 0x70, 0x62, 0x00, 0x48, 0x04, 0x12, 0x09, 0x11,
+    0x13, 0x0C, 0x0B, 0x2C, 0x81, 0x62, 0x70, 0x00, 0x47, 0x1B, 0x04, 0x16, 0x14, 0x08, 0x09, 0x18,
+    0x88, 0x65, 0x66, 0x71, 0x73, 0x61, 0x78, 0x74, 0x70, 0x62, 0x00, 0x02, 0x06, 0x17, 0xA2, 0x07,
+    0xB6, 0x07, 0x47, 0x1A, 0x0D, 0x0D, 0x0A, 0x12, 0x0A, 0x16, 0x89, 0x67, 0x73, 0x6F, 0x67, 0x6A,
+    0x6A, 0x77, 0x63, 0x71, 0x62, 0x00, 0x45, 0x0D, 0x11, 0x0B, 0x0D, 0x1B, 0x81, 0x62, 0x71, 0x00,
+    0x03, 0x06, 0x0C, 0x1C, 0xCA, 0x07, 0xDC, 0x07, 0xE7, 0x07, 0x47, 0x08, 0x1D, 0x0A, 0x1B, 0x06,
+    0x09, 0x05, 0x87, 0x78, 0x63, 0x67, 0x7A, 0x65, 0x63, 0x72, 0x62, 0x00, 0x46, 0x06, 0x13, 0x1A,
+    0x16, 0x0F, 0x05, 0x81, 0x62, 0x72, 0x00, 0x45, 0x0F, 0x19, 0x08, 0x0B, 0x2C, 0x83, 0x79, 0x6C,
+    0x72, 0x62, 0x00, 0x04, 0x09, 0x0D, 0x10, 0x18, 0x00, 0x08, 0x0C, 0x08, 0x17, 0x08, 0x23, 0x08,
+    0x44, 0x0D, 0x17, 0x05, 0x13, 0x84, 0x6A, 0x74, 0x66, 0x73, 0x62, 0x00, 0x44, 0x0C, 0x12, 0x13,
+    0x2C, 0x83, 0x6A, 0x69, 0x73, 0x62, 0x00, 0x45, 0x06, 0x16, 0x18, 0x0F, 0x1A, 0x83, 0x6D, 0x63,
+    0x73, 0x62, 0x00, 0x46, 0x18, 0x16, 0x1C, 0x0E, 0x0C, 0x2C, 0x84, 0x75, 0x73, 0x75, 0x73, 0x62,
+    0x00, 0x02, 0x0A, 0x0D, 0x38, 0x08, 0x48, 0x08, 0x46, 0x19, 0x13, 0x1C, 0x11, 0x12, 0x05, 0x86,
+    0x79, 0x6E, 0x70, 0x76, 0x67, 0x74, 0x62, 0x00, 0x47, 0x16, 0x0F, 0x10, 0x0B, 0x15, 0x17, 0x2C,
+    0x81, 0x62, 0x74, 0x00, 0x05, 0x0C, 0x0F, 0x13, 0x16, 0x17, 0x64, 0x08, 0x84, 0x08, 0x95, 0x08,
+    0x9D, 0x08, 0xA7, 0x08, 0x02, 0x08, 0x0D, 0x6B, 0x08, 0x7A, 0x08, 0x46, 0x0E, 0x0D, 0x1D, 0x05,
+    0x06, 0x1D, 0x85, 0x6B, 0x6A, 0x65, 0x69, 0x75, 0x62, 0x00, 0x45, 0x08, 0x16, 0x0E, 0x18, 0x16,
+    0x81, 0x62, 0x75, 0x00, 0x46, 0x1B, 0x07, 0x14, 0x0E, 0x11, 0x14, 0x87, 0x6B, 0x6E, 0x71, 0x64,
+    0x78, 0x6C, 0x75, 0x62, 0x00, 0x43, 0x1B, 0x1B, 0x07, 0x81, 0x62, 0x75, 0x00, 0x43, 0x11, 0x08,
+    0x16, 0x83, 0x73, 0x6E, 0x75, 0x62, 0x00, 0x46, 0x04, 0x17, 0x16, 0x0F, 0x0D, 0x16, 0x83, 0x74,
+    0x61, 0x75, 0x62, 0x00, 0x47, 0x17, 0x15, 0x10, 0x0B, 0x09, 0x1A, 0x0E, 0x85, 0x6D, 0x68, 0x72,
+    0x74, 0x77, 0x62, 0x00, 0x07, 0x06, 0x0C, 0x0E, 0x17, 0x18, 0x1C, 0x1D, 0xDA, 0x08, 0xE6, 0x08,
+    0xF1, 0x08, 0x02, 0x09, 0x11, 0x09, 0x1D, 0x09, 0x26, 0x09, 0x43, 0x0D, 0x0F, 0x1A, 0x85, 0x6C,
+    0x77, 0x6A, 0x63, 0x78, 0x62, 0x00, 0x43, 0x0C, 0x14, 0x1A, 0x84, 0x69, 0x71, 0x69, 0x78, 0x62,
+    0x00, 0x46, 0x12, 0x1C, 0x09, 0x0F, 0x09, 0x05, 0x87, 0x6C, 0x66, 0x66, 0x79, 0x6F, 0x6B, 0x78,
+    0x62, 0x00, 0x46, 0x10, 0x0E, 0x0A, 0x10, 0x0D, 0x18, 0x85, 0x6B, 0x67, 0x6D, 0x74, 0x78, 0x62,
+    0x00, 0x45, 0x15, 0x08, 0x19, 0x0E, 0x2C, 0x83, 0x75, 0x72, 0x78, 0x62, 0x00, 0x43, 0x0E, 0x14,
+    0x19, 0x82, 0x78, 0x79, 0x62, 0x00, 0x44, 0x06, 0x0B, 0x1C, 0x0F, 0x82, 0x78, 0x7A, 0x62, 0x00,
+    0x03, 0x05, 0x13, 0x15, 0x3A, 0x09, 0x46, 0x09, 0x58, 0x09, 0x44, 0x10, 0x08, 0x14, 0x16, 0x84,
+    0x6D, 0x65, 0x62, 0x79, 0x62, 0x00, 0x47, 0x11, 0x0D, 0x08, 0x04, 0x0C, 0x1D, 0x0C, 0x87, 0x61,
+    0x69, 0x65, 0x6A, 0x6E, 0x70, 0x79, 0x62, 0x00, 0x46, 0x05, 0x12, 0x1D, 0x08, 0x18, 0x0D, 0x84,
+    0x62, 0x6F, 0x72, 0x79, 0x62, 0x00, 0x02, 0x06, 0x1A, 0x6D, 0x09, 0x7F, 0x09, 0x47, 0x10, 0x0E,
+    0x1B, 0x0C, 0x17, 0x1A, 0x06, 0x87, 0x69, 0x74, 0x78, 0x6B, 0x6D, 0x63, 0x7A, 0x62, 0x00, 0x47,
+    0x05, 0x14, 0x05, 0x13, 0x04, 0x06, 0x1A, 0x88, 0x61, 0x63, 0x70, 0x62, 0x71, 0x62, 0x77, 0x7A,
+    0x62, 0x00, 0x17, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1D, 0xD8, 0x09, 0x33, 0x0A, 0x46, 0x0A,
+    0x53, 0x0A, 0xA3, 0x0A, 0xC9, 0x0A, 0xE8, 0x0A, 0x4A, 0x0B, 0x68, 0x0B, 0xAA, 0x0B, 0xDE, 0x0B,
+    0x06, 0x0C, 0x2A, 0x0C, 0xB7, 0x0C, 0xC0, 0x0C, 0xF4, 0x0C, 0x42, 0x0D, 0x4F, 0x0D, 0x5B, 0x0D,
+    0x6D, 0x0D, 0xAF, 0x0D, 0xF3, 0x0D, 0x58, 0x0E, 0x04, 0x04, 0x06, 0x15, 0x16, 0xE5, 0x09, 0xF2,
+    0x09, 0xFC, 0x09, 0x08, 0x0A, 0x45, 0x14, 0x1C, 0x18, 0x0D, 0x16, 0x84, 0x71, 0x79, 0x61, 0x62,
+    0x63, 0x00, 0x44, 0x04, 0x16, 0x11, 0x1D, 0x82, 0x62, 0x63, 0x63, 0x00, 0x45, 0x0D, 0x16, 0x0D,
+    0x19, 0x09, 0x83, 0x72, 0x6A, 0x62, 0x63, 0x00, 0x03, 0x05, 0x12, 0x15, 0x12, 0x0A, 0x20, 0x0A,
+    0x27, 0x0A, 0x45, 0x1D, 0x16, 0x05, 0x06, 0x2C, 0x85, 0x7A, 0x73, 0x62, 0x73, 0x62, 0x63, 0x00,
+    0x42, 0x0A, 0x07, 0x81, 0x63, 0x62, 0x00, 0x44, 0x10, 0x04, 0x1B, 0x07, 0x84, 0x72, 0x6D, 0x73,
+    0x62, 0x63, 0x00, 0x47, 0x18, 0x1D, 0x0D, 0x19, 0x10, 0x14, 0x04, 0x88, 0x71, 0x61, 0x6D, 0x76,
+    0x6A, 0x7A, 0x75, 0x63, 0x63, 0x00, 0x47, 0x17, 0x05, 0x0D, 0x0E, 0x18, 0x1B, 0x13, 0x82, 0x64,
+    0x74, 0x63, 0x00, 0x05, 0x06, 0x0B, 0x12, 0x13, 0x16, 0x63, 0x0A, 0x70, 0x0A, 0x7D, 0x0A, 0x85,
+    0x0A, 0x97, 0x0A, 0x45, 0x05, 0x1C, 0x04, 0x07, 0x1A, 0x84, 0x62, 0x79, 0x63, 0x65, 0x63, 0x00,
+    0x45, 0x07, 0x1A, 0x12, 0x19, 0x2C, 0x84, 0x64, 0x77, 0x68, 0x65, 0x63, 0x00, 0x43, 0x0F, 0x06,
+    0x05, 0x81, 0x63, 0x65, 0x00, 0x46, 0x18, 0x05, 0x12, 0x10, 0x09, 0x07, 0x88, 0x66, 0x64, 0x6D,
+    0x6F, 0x62, 0x75, 0x70, 0x65, 0x63, 0x00, 0x45, 0x08, 0x14, 0x10, 0x05, 0x07, 0x83, 0x73, 0x65,
+    0x65, 0x63, 0x00, 0x02, 0x06, 0x07, 0xAA, 0x0A, 0xB7, 0x0A, 0x45, 0x0E, 0x13, 0x1A, 0x08, 0x17,
+    0x84, 0x6B, 0x70, 0x63, 0x67, 0x63, 0x00, 0x47, 0x10, 0x1D, 0x08, 0x0E, 0x11, 0x1A, 0x2C, 0x87,
+    0x6B, 0x6E, 0x65, 0x7A, 0x6D, 0x64, 0x67, 0x63, 0x00, 0x02, 0x09, 0x1D, 0xD0, 0x0A, 0xDD, 0x0A,
+    0x45, 0x0C, 0x05, 0x17, 0x0A, 0x2C, 0x84, 0x69, 0x62, 0x66, 0x68, 0x63, 0x00, 0x44, 0x11, 0x1A,
+    0x1A, 0x15, 0x83, 0x7A, 0x6E, 0x68, 0x63, 0x00, 0x06, 0x05, 0x06, 0x0E, 0x0F, 0x10, 0x19, 0xFB,
+    0x0A, 0x07, 0x0B, 0x11, 0x0B, 0x1C, 0x0B, 0x26, 0x0B, 0x39, 0x0B, 0x46, 0x08, 0x10, 0x0A, 0x08,
+    0x15, 0x12, 0x82, 0x69, 0x62, 0x63, 0x00, 0x44, 0x0E, 0x15, 0x05, 0x16, 0x82, 0x69, 0x63, 0x63,
+    0x00, 0x43, 0x08, 0x0A, 0x18, 0x84, 0x65, 0x67, 0x6B, 0x69, 0x63, 0x00, 0x43, 0x14, 0x19, 0x05,
+    0x83, 0x6C, 0x71, 0x69, 0x63, 0x00, 0x47, 0x04, 0x1D, 0x0E, 0x15, 0x04, 0x1B, 0x04, 0x88, 0x61,
+    0x78, 0x72, 0x6B, 0x7A, 0x61, 0x6D, 0x69, 0x63, 0x00, 0x46, 0x0C, 0x10, 0x04, 0x0B, 0x1B, 0x2C,
+    0x87, 0x68, 0x78, 0x61, 0x6D, 0x69, 0x76, 0x69, 0x63, 0x00, 0x02, 0x09, 0x15, 0x51, 0x0B, 0x5A,
+    0x0B, 0x44, 0x15, 0x1D, 0x16, 0x0C, 0x81, 0x63, 0x6A, 0x00, 0x46, 0x08, 0x0C, 0x1A, 0x09, 0x12,
+    0x05, 0x84, 0x65, 0x69, 0x72, 0x6A, 0x63, 0x00, 0x04, 0x0A, 0x1A, 0x1B, 0x1D, 0x75, 0x0B, 0x7D,
+    0x0B, 0x8D, 0x0B, 0x99, 0x0B, 0x43, 0x19, 0x06, 0x18, 0x81, 0x63, 0x6B, 0x00, 0x48, 0x1C, 0x18,
+    0x19, 0x1D, 0x09, 0x05, 0x1B, 0x2C, 0x84, 0x79, 0x75, 0x77, 0x6B, 0x63, 0x00, 0x44, 0x1B, 0x0D,
+    0x1C, 0x0D, 0x84, 0x78, 0x6A, 0x78, 0x6B, 0x63, 0x00, 0x48, 0x1D, 0x19, 0x16, 0x06, 0x13, 0x07,
+    0x0F, 0x2C, 0x85, 0x76, 0x73, 0x7A, 0x7A, 0x6B, 0x63, 0x00, 0x03, 0x05, 0x14, 0x16, 0xB4, 0x0B,
+    0xC5, 0x0B, 0xD2, 0x0B, 0x47, 0x19, 0x17, 0x16, 0x09, 0x1B, 0x11, 0x0E, 0x86, 0x73, 0x66, 0x74,
+    0x76, 0x62, 0x6C, 0x63, 0x00, 0x46, 0x09, 0x0C, 0x16, 0x06, 0x1D, 0x18, 0x83, 0x71, 0x66, 0x6C,
+    0x63, 0x00, 0x43, 0x0A, 0x0F, 0x14, 0x85, 0x6C, 0x71, 0x67, 0x73, 0x6C, 0x63, 0x00, 0x03, 0x05,
+    0x08, 0x11, 0xE8, 0x0B, 0xF3, 0x0B, 0xFE, 0x0B, 0x43, 0x1B, 0x0F, 0x1C, 0x84, 0x78, 0x6C, 0x62,
+    0x6D, 0x63, 0x00, 0x46, 0x1A, 0x17, 0x12, 0x10, 0x09, 0x1D, 0x81, 0x63, 0x6D, 0x00, 0x43, 0x1D,
+    0x16, 0x04, 0x81, 0x63, 0x6D, 0x00, 0x02, 0x05, 0x09, 0x0D, 0x0C, 0x18, 0x0C, 0x43, 0x18, 0x0F,
+    0x0C, 0x84, 0x75, 0x6C, 0x62, 0x6E, 0x63, 0x00, 0x47, 0x18, 0x17, 0x0F, 0x08, 0x1B, 0x15, 0x09,
+    0x87, 0x65, 0x78, 0x6C, 0x74, 0x75, 0x66, 0x6E, 0x63, 0x00, 0x06, 0x06, 0x08, 0x0B, 0x0C, 0x13,
+    0x16, 0x3D, 0x0C, 0x4C, 0x0C, 0x5B, 0x0C, 0x80, 0x0C, 0x9D, 0x0C, 0xA9, 0x0C, 0x46, 0x11, 0x19,
+    0x09, 0x1C, 0x09, 0x12, 0x85, 0x76, 0x66, 0x6E, 0x63, 0x6F, 0x63, 0x00, 0x47, 0x0D, 0x04, 0x08,
+    0x04, 0x1A, 0x13, 0x08, 0x84, 0x6A, 0x61, 0x65, 0x6F, 0x63, 0x00, 0x02, 0x15, 0x19, 0x62, 0x0C,
+    0x72, 0x0C, 0x46, 0x11, 0x05, 0x14, 0x14, 0x09, 0x1B, 0x86, 0x62, 0x71, 0x6E, 0x72, 0x68, 0x6F,
+    0x63, 0x00, 0x44, 0x12, 0x0A, 0x08, 0x0C, 0x86, 0x67, 0x65, 0x6F, 0x76, 0x68, 0x6F, 0x63, 0x00,
+    0x02, 0x15, 0x17, 0x87, 0x0C, 0x94, 0x0C, 0x46, 0x18, 0x17, 0x0F, 0x1D, 0x16, 0x0B, 0x83, 0x69,
+    0x72, 0x6F, 0x63, 0x00, 0x44, 0x0C, 0x19, 0x1C, 0x1D, 0x81, 0x63, 0x6F, 0x00, 0x44, 0x05, 0x12,
+    0x07, 0x15, 0x84, 0x62, 0x6F, 0x70, 0x6F, 0x63, 0x00, 0x47, 0x0D, 0x08, 0x0C, 0x13, 0x0A, 0x10,
+    0x14, 0x83, 0x73, 0x6A, 0x6F, 0x63, 0x00, 0x44, 0x18, 0x18, 0x0A, 0x17, 0x81, 0x63, 0x70, 0x00,
+    0x03, 0x09, 0x0E, 0x19, 0xCA, 0x0C, 0xD7, 0x0C, 0xE6, 0x0C, 0x44, 0x19, 0x13, 0x17, 0x0C, 0x85,
+    0x70, 0x74, 0x76, 0x66, 0x71, 0x63, 0x00, 0x47, 0x08, 0x10, 0x19, 0x1D, 0x0A, 0x0A, 0x11, 0x84,
+    0x65, 0x6D, 0x6B, 0x71, 0x63, 0x00, 0x48, 0x05, 0x19, 0x1D, 0x0E, 0x0A, 0x12, 0x13, 0x2C, 0x82,
+    0x71, 0x76, 0x63, 0x00, 0x05, 0x08, 0x10, 0x18, 0x1A, 0x1D, 0x04, 0x0D, 0x10, 0x0D, 0x1F, 0x0D,
+    0x2A, 0x0D, 0x38, 0x0D, 0x45, 0x09, 0x0E, 0x19, 0x19, 0x0E, 0x83, 0x65, 0x66, 0x72, 0x63, 0x00,
+    0x45, 0x15, 0x17, 0x14, 0x13, 0x19, 0x86, 0x71, 0x70, 0x74, 0x72, 0x6D, 0x72, 0x63, 0x00, 0x46,
+    0x09, 0x14, 0x1B, 0x13, 0x09, 0x09, 0x81, 0x63, 0x72, 0x00, 0x47, 0x12, 0x12, 0x17, 0x11, 0x04,
+    0x0A, 0x0E, 0x83, 0x77, 0x6F, 0x72, 0x63, 0x00, 0x44, 0x1A, 0x17, 0x1A, 0x1D, 0x82, 0x72, 0x7A,
+    0x63, 0x00, 0x46, 0x05, 0x16, 0x13, 0x17, 0x0E, 0x0A, 0x83, 0x62, 0x73, 0x73, 0x63, 0x00, 0x46,
+    0x0A, 0x04, 0x1D, 0x0C, 0x11, 0x19, 0x82, 0x74, 0x67, 0x63, 0x00, 0x48, 0x0B, 0x0F, 0x1A, 0x12,
+    0x1A, 0x09, 0x05, 0x0E, 0x86, 0x6F, 0x77, 0x77, 0x6C, 0x68, 0x75, 0x63, 0x00, 0x04, 0x04, 0x05,
+    0x0F, 0x18, 0x7A, 0x0D, 0x8A, 0x0D, 0x9C, 0x0D, 0xA4, 0x0D, 0x46, 0x1D, 0x0D, 0x0E, 0x0F, 0x17,
+    0x2C, 0x86, 0x6B, 0x6C, 0x6A, 0x7A, 0x61, 0x76, 0x63, 0x00, 0x47, 0x06, 0x17, 0x18, 0x19, 0x0D,
+    0x15, 0x2C, 0x87, 0x76, 0x6A, 0x75, 0x74, 0x63, 0x62, 0x76, 0x63, 0x00, 0x43, 0x1D, 0x17, 0x1D,
+    0x81, 0x63, 0x76, 0x00, 0x44, 0x0F, 0x18, 0x0D, 0x08, 0x83, 0x75, 0x6C, 0x76, 0x63, 0x00, 0x04,
+    0x07, 0x0F, 0x15, 0x16, 0xBC, 0x0D, 0xCA, 0x0D, 0xDB, 0x0D, 0xE8, 0x0D, 0x45, 0x17, 0x1B, 0x19,
+    0x0D, 0x13, 0x85, 0x78, 0x76, 0x74, 0x64, 0x77, 0x63, 0x00, 0x47, 0x0D, 0x0E, 0x16, 0x0D, 0x07,
+    0x18, 0x06, 0x86, 0x73, 0x6A, 0x6B, 0x6A, 0x6C, 0x77, 0x63, 0x00, 0x44, 0x08, 0x05, 0x14, 0x2C,
+    0x85, 0x62, 0x71, 0x65, 0x72, 0x77, 0x63, 0x00, 0x45, 0x17, 0x1C, 0x1A, 0x1D, 0x05, 0x82, 0x77,
+    0x73, 0x63, 0x00, 0x06, 0x04, 0x07, 0x0B, 0x13, 0x15, 0x16, 0x06, 0x0E, 0x11, 0x0E, 0x1E, 0x0E,
+    0x2A, 0x0E, 0x45, 0x0E, 0x4E, 0x0E, 0x45, 0x0E, 0x0E, 0x1A, 0x16, 0x15, 0x82, 0x78, 0x61, 0x63,
+    0x00, 0x44, 0x08, 0x16, 0x04, 0x08, 0x85, 0x73, 0x61, 0x65, 0x64, 0x78, 0x63, 0x00, 0x44, 0x08,
+    0x12, 0x07, 0x06, 0x84, 0x65, 0x6F, 0x68, 0x78, 0x63, 0x00, 0x02, 0x15, 0x1C, 0x31, 0x0E, 0x39,
+    0x0E, 0x42, 0x1C, 0x0C, 0x82, 0x78, 0x70, 0x63, 0x00, 0x44, 0x0E, 0x10, 0x1C, 0x12, 0x84, 0x79,
+    0x6B, 0x70, 0x78, 0x63, 0x00, 0x43, 0x0E, 0x19, 0x0F, 0x82, 0x78, 0x72, 0x63, 0x00, 0x44, 0x10,
+    0x19, 0x1D, 0x09, 0x82, 0x78, 0x73, 0x63, 0x00, 0x02, 0x12, 0x15, 0x5F, 0x0E, 0x69, 0x0E, 0x45,
+    0x06, 0x09, 0x10, 0x08, 0x2C, 0x81, 0x63, 0x7A, 0x00, 0x43, 0x16, 0x0C, 0x13, 0x85, 0x69, 0x70,
+    0x73, 0x72, 0x7A, 0x63, 0x00, 0x18, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x1A, 0x1B, 0x1C, 0x1D, 0xBE, 0x0E,
+    0xF0, 0x0E, 0x01, 0x0F, 0x0E, 0x0F, 0x1B, 0x0F, 0x2A, 0x0F, 0x42, 0x0F, 0x71, 0x0F, 0xA2, 0x0F,
+    0xD3, 0x0F, 0xF4, 0x0F, 0x29, 0x10, 0x4D, 0x10, 0x67, 0x10, 0x73, 0x10, 0xA5, 0x10, 0xB5, 0x10,
+    0xF0, 0x10, 0x21, 0x11, 0x2E, 0x11, 0x3B, 0x11, 0x73, 0x11, 0xBE, 0x11, 0xDD, 0x11, 0x03, 0x05,
+    0x11, 0x16, 0xC8, 0x0E, 0xD8, 0x0E, 0xE2, 0x0E, 0x46, 0x0D, 0x1D, 0x15, 0x04, 0x18, 0x08, 0x86,
+    0x72, 0x61, 0x7A, 0x6A, 0x62, 0x61, 0x64, 0x00, 0x44, 0x1C, 0x0F, 0x12, 0x09, 0x82, 0x61, 0x6E,
+    0x64, 0x00, 0x46, 0x09, 0x1D, 0x06, 0x06, 0x0D, 0x1B, 0x84, 0x66, 0x7A, 0x73, 0x61, 0x64, 0x00,
+    0x47, 0x10, 0x1B, 0x17, 0x09, 0x1A, 0x09, 0x05, 0x86, 0x66, 0x77, 0x74, 0x78, 0x6D, 0x62, 0x64,
+    0x00, 0x46, 0x17, 0x12, 0x0B, 0x13, 0x0D, 0x17, 0x83, 0x74, 0x6F, 0x63, 0x64, 0x00, 0x45, 0x05,
+    0x0A, 0x16, 0x15, 0x2C, 0x84, 0x67, 0x73, 0x62, 0x64, 0x64, 0x00, 0x47, 0x06, 0x16, 0x13, 0x10,
+    0x04, 0x0F, 0x07, 0x84, 0x73, 0x70, 0x63, 0x65, 0x64, 0x00, 0x02, 0x0A, 0x12, 0x31, 0x0F, 0x3A,
+    0x0F, 0x44, 0x11, 0x0D, 0x04, 0x12, 0x81, 0x64, 0x66, 0x00, 0x43, 0x0A, 0x0E, 0x10, 0x81, 0x64,
+    0x66, 0x00, 0x03, 0x07, 0x15, 0x16, 0x4C, 0x0F, 0x5B, 0x0F, 0x65, 0x0F, 0x48, 0x14, 0x09, 0x08,
+    0x18, 0x14, 0x05, 0x0A, 0x2C, 0x83, 0x64, 0x71, 0x67, 0x64, 0x00, 0x44, 0x0B, 0x0F, 0x11, 0x13,
+    0x82, 0x67, 0x72, 0x64, 0x00, 0x44, 0x0B, 0x15, 0x04, 0x2C, 0x84, 0x68, 0x72, 0x73, 0x67, 0x64,
+    0x00, 0x02, 0x10, 0x1A, 0x78, 0x0F, 0x96, 0x0F, 0x02, 0x09, 0x1B, 0x7F, 0x0F, 0x88, 0x0F, 0x44,
+    0x17, 0x05, 0x19, 0x2C, 0x81, 0x64, 0x68, 0x00, 0x44, 0x0D, 0x06, 0x14, 0x2C, 0x86, 0x63, 0x71,
+    0x6A, 0x78, 0x6D, 0x68, 0x64, 0x00, 0x43, 0x0B, 0x04, 0x19, 0x85, 0x61, 0x76, 0x68, 0x77, 0x68,
+    0x64, 0x00, 0x03, 0x10, 0x18, 0x1A, 0xAC, 0x0F, 0xC0, 0x0F, 0xCA, 0x0F, 0x47, 0x1A, 0x0A, 0x0F,
+    0x10, 0x05, 0x15, 0x09, 0x89, 0x72, 0x66, 0x62, 0x6D, 0x6C, 0x67, 0x77, 0x6D, 0x69, 0x64, 0x00,
+    0x45, 0x07, 0x06, 0x08, 0x1B, 0x13, 0x81, 0x64, 0x69, 0x00, 0x44, 0x18, 0x1C, 0x16, 0x0F, 0x81,
+    0x64, 0x69, 0x00, 0x02, 0x08, 0x11, 0xDA, 0x0F, 0xE9, 0x0F, 0x46, 0x1D, 0x09, 0x1C, 0x11, 0x1B,
+    0x1C, 0x85, 0x66, 0x79, 0x7A, 0x65, 0x6A, 0x64, 0x00, 0x46, 0x13, 0x14, 0x0A, 0x08, 0x06, 0x1B,
+    0x81, 0x64, 0x6A, 0x00, 0x03, 0x0D, 0x15, 0x1A, 0xFE, 0x0F, 0x11, 0x10, 0x1B, 0x10, 0x47, 0x0A,
+    0x06, 0x09, 0x0B, 0x1A, 0x1C, 0x2C, 0x88, 0x77, 0x79, 0x68, 0x66, 0x63, 0x67, 0x6A, 0x6B, 0x64,
+    0x00, 0x43, 0x0B, 0x17, 0x13, 0x83, 0x72, 0x68, 0x6B, 0x64, 0x00, 0x47, 0x12, 0x06, 0x13, 0x15,
+    0x06, 0x14, 0x0F, 0x83, 0x77, 0x6F, 0x6B, 0x64, 0x00, 0x02, 0x0D, 0x0F, 0x30, 0x10, 0x41, 0x10,
+    0x48, 0x19, 0x1B, 0x05, 0x11, 0x1A, 0x1D, 0x12, 0x2C, 0x85, 0x78, 0x62, 0x76, 0x6A, 0x6D, 0x64,
+    0x00, 0x46, 0x06, 0x13, 0x1A, 0x1B, 0x0B, 0x05, 0x82, 0x6D, 0x6C, 0x64, 0x00, 0x02, 0x06, 0x14,
+    0x54, 0x10, 0x5F, 0x10, 0x43, 0x0F, 0x18, 0x1B, 0x84, 0x6C, 0x75, 0x63, 0x6E, 0x64, 0x00, 0x43,
+    0x11, 0x0C, 0x0A, 0x81, 0x64, 0x6E, 0x00, 0x44, 0x13, 0x0F, 0x07, 0x04, 0x84, 0x6C, 0x64, 0x70,
+    0x6F, 0x64, 0x00, 0x03, 0x06, 0x0E, 0x12, 0x7D, 0x10, 0x8D, 0x10, 0x99, 0x10, 0x48, 0x1B, 0x14,
+    0x11, 0x11, 0x05, 0x15, 0x0A, 0x2C, 0x84, 0x78, 0x71, 0x63, 0x70, 0x64, 0x00, 0x43, 0x08, 0x17,
+    0x15, 0x85, 0x74, 0x72, 0x65, 0x6B, 0x70, 0x64, 0x00, 0x45, 0x1A, 0x05, 0x1A, 0x0B, 0x17, 0x83,
+    0x6F, 0x77, 0x70, 0x64, 0x00, 0x47, 0x08, 0x04, 0x0A, 0x1B, 0x0A, 0x19, 0x16, 0x85, 0x67, 0x78,
+    0x61, 0x65, 0x71, 0x64, 0x00, 0x03, 0x06, 0x0B, 0x1A, 0xBF, 0x10, 0xD1, 0x10, 0xDF, 0x10, 0x47,
+    0x04, 0x13, 0x19, 0x07, 0x19, 0x1B, 0x06, 0x87, 0x64, 0x76, 0x76, 0x70, 0x61, 0x63, 0x72, 0x64,
+    0x00, 0x45, 0x15, 0x1D, 0x0F, 0x07, 0x05, 0x85, 0x7A, 0x6C, 0x72, 0x68, 0x72, 0x64, 0x00, 0x46,
+    0x15, 0x10, 0x04, 0x0B, 0x08, 0x1B, 0x87, 0x68, 0x65, 0x61, 0x6D, 0x72, 0x77, 0x72, 0x64, 0x00,
+    0x03, 0x07, 0x0A, 0x1B, 0xFA, 0x10, 0x06, 0x11, 0x13, 0x11, 0x43, 0x06, 0x07, 0x13, 0x85, 0x64,
+    0x70, 0x63, 0x64, 0x73, 0x64, 0x00, 0x44, 0x17, 0x0A, 0x05, 0x0A, 0x85, 0x67, 0x62, 0x74, 0x67,
+    0x73, 0x64, 0x00, 0x45, 0x0C, 0x12, 0x09, 0x09, 0x1A, 0x85, 0x6F, 0x66, 0x69, 0x78, 0x73, 0x64,
+    0x00, 0x44, 0x0B, 0x08, 0x0C, 0x06, 0x85, 0x69, 0x63, 0x65, 0x68, 0x74, 0x64, 0x00, 0x48, 0x10,
+    0x0C, 0x06, 0x13, 0x15, 0x12, 0x0A, 0x1D, 0x81, 0x64, 0x75, 0x00, 0x03, 0x0B, 0x16, 0x1B, 0x45,
+    0x11, 0x51, 0x11, 0x64, 0x11, 0x44, 0x07, 0x1C, 0x18, 0x1D, 0x84, 0x64, 0x79, 0x68, 0x77, 0x64,
+    0x00, 0x47, 0x05, 0x12, 0x12, 0x0F, 0x14, 0x11, 0x14, 0x88, 0x71, 0x6E, 0x6C, 0x6F, 0x6F, 0x62,
+    0x73, 0x77, 0x64, 0x00, 0x47, 0x0B, 0x0A, 0x16, 0x05, 0x15, 0x0D, 0x2C, 0x84, 0x68, 0x67, 0x78,
+    0x77, 0x64, 0x00, 0x05, 0x09, 0x0A, 0x10, 0x15, 0x16, 0x83, 0x11, 0x8E, 0x11, 0x9A, 0x11, 0xA3,
+    0x11, 0xB3, 0x11, 0x45, 0x13, 0x06, 0x14, 0x15, 0x0E, 0x82, 0x78, 0x66, 0x64, 0x00, 0x43, 0x1B,
+    0x0E, 0x19, 0x85, 0x6B, 0x76, 0x78, 0x67, 0x78, 0x64, 0x00, 0x43, 0x13, 0x12, 0x08, 0x82, 0x78,
+    0x6D, 0x64, 0x00, 0x47, 0x11, 0x1A, 0x14, 0x14, 0x07, 0x0B, 0x0F, 0x85, 0x77, 0x71, 0x6E, 0x72,
+    0x78, 0x64, 0x00, 0x44, 0x0B, 0x19, 0x08, 0x04, 0x83, 0x73, 0x68, 0x78, 0x64, 0x00, 0x02, 0x0E,
+    0x18, 0xC5, 0x11, 0xD3, 0x11, 0x45, 0x13, 0x06, 0x0B, 0x19, 0x08, 0x85, 0x63, 0x68, 0x70, 0x6B,
+    0x79, 0x64, 0x00, 0x43, 0x08, 0x0C, 0x13, 0x83, 0x75, 0x65, 0x79, 0x64, 0x00, 0x05, 0x09, 0x0A,
+    0x0D, 0x0F, 0x1C, 0xED, 0x11, 0xF8, 0x11, 0x05, 0x12, 0x12, 0x12, 0x24, 0x12, 0x46, 0x13, 0x0F,
+    0x13, 0x08, 0x08, 0x06, 0x81, 0x64, 0x7A, 0x00, 0x44, 0x1A, 0x09, 0x0B, 0x05, 0x85, 0x66, 0x68,
+    0x77, 0x67, 0x7A, 0x64, 0x00, 0x46, 0x14, 0x04, 0x1D, 0x0B, 0x16, 0x0A, 0x83, 0x6A, 0x71, 0x7A,
+    0x64, 0x00, 0x46, 0x13, 0x1C, 0x18, 0x1C, 0x07, 0x14, 0x88, 0x64, 0x71, 0x79, 0x75, 0x79, 0x70,
+    0x6C, 0x7A, 0x64, 0x00, 0x44, 0x1C, 0x19, 0x10, 0x0D, 0x81, 0x64, 0x7A, 0x00, 0x1A, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x7C, 0x12, 0xA0, 0x12, 0xAC, 0x12, 0x07, 0x13,
+    0x53, 0x13, 0x8D, 0x13, 0x9F, 0x13, 0x02, 0x14, 0x60, 0x14, 0x6E, 0x14, 0xB4, 0x14, 0xD7, 0x14,
+    0xF4, 0x14, 0x0C, 0x15, 0x33, 0x15, 0x73, 0x15, 0x80, 0x15, 0x8C, 0x15, 0xBD, 0x15, 0xE2, 0x15,
+    0xFD, 0x15, 0x5F, 0x16, 0x6D, 0x16, 0x76, 0x16, 0x88, 0x16, 0xA5, 0x16, 0x02, 0x19, 0x1A, 0x83,
+    0x12, 0x95, 0x12, 0x47, 0x0C, 0x0B, 0x14, 0x0F, 0x15, 0x0F, 0x05, 0x87, 0x6C, 0x72, 0x71, 0x68,
+    0x69, 0x76, 0x61, 0x65, 0x00, 0x43, 0x0B, 0x05, 0x1D, 0x84, 0x68, 0x62, 0x77, 0x61, 0x65, 0x00,
+    0x45, 0x13, 0x11, 0x13, 0x0C, 0x2C, 0x83, 0x70, 0x6E, 0x62, 0x65, 0x00, 0x04, 0x0C, 0x0E, 0x10,
+    0x1B, 0xB9, 0x12, 0xC5, 0x12, 0xD0, 0x12, 0xF7, 0x12, 0x43, 0x09, 0x1B, 0x1C, 0x85, 0x78, 0x79,
+    0x66, 0x69, 0x63, 0x65, 0x00, 0x43, 0x16, 0x14, 0x08, 0x84, 0x73, 0x71, 0x6B, 0x63, 0x65, 0x00,
+    0x02, 0x05, 0x09, 0xD7, 0x12, 0xEA, 0x12, 0x46, 0x16, 0x19, 0x11, 0x15, 0x0A, 0x1B, 0x89, 0x67,
+    0x78, 0x72, 0x6E, 0x76, 0x73, 0x62, 0x6D, 0x63, 0x65, 0x00, 0x45, 0x16, 0x12, 0x0C, 0x15, 0x2C,
+    0x84, 0x66, 0x73, 0x6D, 0x63, 0x65, 0x00, 0x46, 0x09, 0x0D, 0x1A, 0x0D, 0x0E, 0x2C, 0x86, 0x77,
+    0x6A, 0x6A, 0x66, 0x78, 0x63, 0x65, 0x00, 0x05, 0x05, 0x06, 0x08, 0x0A, 0x10, 0x17, 0x13, 0x25,
+    0x13, 0x30, 0x13, 0x3A, 0x13, 0x46, 0x13, 0x47, 0x0E, 0x1A, 0x07, 0x08, 0x0F, 0x0E, 0x18, 0x83,
+    0x62, 0x6B, 0x64, 0x65, 0x00, 0x45, 0x16, 0x0E, 0x12, 0x1A, 0x1C, 0x82, 0x64, 0x63, 0x65, 0x00,
+    0x43, 0x0D, 0x0C, 0x11, 0x83, 0x65, 0x6A, 0x64, 0x65, 0x00, 0x44, 0x0C, 0x12, 0x10, 0x07, 0x84,
+    0x69, 0x6F, 0x67, 0x64, 0x65, 0x00, 0x48, 0x14, 0x14, 0x06, 0x19, 0x10, 0x10, 0x04, 0x2C, 0x81,
+    0x65, 0x64, 0x00, 0x03, 0x06, 0x08, 0x1A, 0x5D, 0x13, 0x69, 0x13, 0x7D, 0x13, 0x43, 0x0D, 0x0E,
+    0x08, 0x85, 0x6B, 0x65, 0x6A, 0x63, 0x65, 0x65, 0x00, 0x47, 0x0F, 0x08, 0x0C, 0x1C, 0x07, 0x05,
+    0x17, 0x89, 0x62, 0x74, 0x64, 0x79, 0x69, 0x65, 0x6C, 0x65, 0x65, 0x65, 0x00, 0x47, 0x0A, 0x18,
+    0x0A, 0x1A, 0x09, 0x08, 0x06, 0x85, 0x75, 0x67, 0x67, 0x77, 0x65, 0x65, 0x00, 0x48, 0x0E, 0x0B,
+    0x17, 0x11, 0x15, 0x17, 0x0F, 0x04, 0x86, 0x6E, 0x72, 0x74, 0x68, 0x6B, 0x66, 0x65, 0x00, 0x05,
+    0x06, 0x09, 0x0C, 0x0E, 0x10, 0xAF, 0x13, 0xBE, 0x13, 0xD0, 0x13, 0xE1, 0x13, 0xF2, 0x13, 0x46,
+    0x1A, 0x15, 0x13, 0x15, 0x11, 0x2C, 0x85, 0x72, 0x70, 0x77, 0x63, 0x67, 0x65, 0x00, 0x48, 0x0F,
+    0x0A, 0x16, 0x07, 0x10, 0x19, 0x18, 0x2C, 0x86, 0x73, 0x64, 0x67, 0x6C, 0x66, 0x67, 0x65, 0x00,
+    0x47, 0x0E, 0x0D, 0x1B, 0x0D, 0x04, 0x1D, 0x15, 0x86, 0x78, 0x6A, 0x6A, 0x6B, 0x69, 0x67, 0x65,
+    0x00, 0x46, 0x1A, 0x04, 0x0A, 0x1B, 0x11, 0x05, 0x87, 0x78, 0x6E, 0x67, 0x61, 0x77, 0x6B, 0x67,
+    0x65, 0x00, 0x45, 0x0E, 0x1A, 0x06, 0x10, 0x0E, 0x87, 0x6D, 0x6B, 0x63, 0x77, 0x6B, 0x6D, 0x67,
+    0x65, 0x00, 0x05, 0x05, 0x0F, 0x14, 0x1A, 0x1C, 0x12, 0x14, 0x24, 0x14, 0x37, 0x14, 0x4A, 0x14,
+    0x53, 0x14, 0x46, 0x05, 0x1B, 0x04, 0x0B, 0x08, 0x12, 0x88, 0x65, 0x6F, 0x68, 0x61, 0x78, 0x62,
+    0x62, 0x68, 0x65, 0x00, 0x48, 0x08, 0x0E, 0x0E, 0x12, 0x1D, 0x05, 0x17, 0x2C, 0x87, 0x6F, 0x7A,
+    0x6B, 0x6B, 0x65, 0x6C, 0x68, 0x65, 0x00, 0x48, 0x14, 0x1B, 0x15, 0x12, 0x0D, 0x04, 0x1B, 0x2C,
+    0x87, 0x6F, 0x6A, 0x72, 0x78, 0x71, 0x71, 0x68, 0x65, 0x00, 0x43, 0x04, 0x1B, 0x12, 0x82, 0x68,
+    0x77, 0x65, 0x00, 0x44, 0x0B, 0x05, 0x13, 0x19, 0x85, 0x62, 0x70, 0x68, 0x79, 0x68, 0x65, 0x00,
+    0x48, 0x17, 0x11, 0x1D, 0x1D, 0x15, 0x19, 0x08, 0x18, 0x82, 0x69, 0x74, 0x65, 0x00, 0x04, 0x07,
+    0x13, 0x15, 0x19, 0x7B, 0x14, 0x8D, 0x14, 0x99, 0x14, 0xA9, 0x14, 0x46, 0x05, 0x06, 0x15, 0x1A,
+    0x14, 0x06, 0x88, 0x71, 0x63, 0x77, 0x72, 0x63, 0x62, 0x64, 0x6A, 0x65, 0x00, 0x45, 0x1C, 0x05,
+    0x10, 0x1C, 0x2C, 0x83, 0x70, 0x79, 0x6A, 0x65, 0x00, 0x47, 0x0C, 0x07, 0x08, 0x06, 0x17, 0x07,
+    0x06, 0x85, 0x64, 0x65, 0x69, 0x72, 0x6A, 0x65, 0x00, 0x44, 0x06, 0x07, 0x0F, 0x1C, 0x83, 0x76,
+    0x63, 0x6A, 0x65, 0x00, 0x02, 0x07, 0x15, 0xBB, 0x14, 0xC5, 0x14, 0x43, 0x1C, 0x08, 0x10, 0x83,
+    0x64, 0x79, 0x6B, 0x65, 0x00, 0x46, 0x1A, 0x07, 0x10, 0x08, 0x1C, 0x12, 0x88, 0x79, 0x6F, 0x65,
+    0x6D, 0x64, 0x77, 0x72, 0x6B, 0x65, 0x00, 0x02, 0x09, 0x14, 0xDE, 0x14, 0xE8, 0x14, 0x45, 0x16,
+    0x18, 0x16, 0x13, 0x2C, 0x81, 0x65, 0x6C, 0x00, 0x46, 0x15, 0x1B, 0x05, 0x05, 0x05, 0x10, 0x82,
+    0x6C, 0x71, 0x65, 0x00, 0x02, 0x08, 0x1B, 0xFB, 0x14, 0x04, 0x15, 0x44, 0x0B, 0x09, 0x1D, 0x10,
+    0x81, 0x65, 0x6D, 0x00, 0x43, 0x1B, 0x10, 0x11, 0x81, 0x65, 0x6D, 0x00, 0x02, 0x12, 0x15, 0x13,
+    0x15, 0x26, 0x15, 0x47, 0x04, 0x1D, 0x07, 0x1B, 0x1C, 0x15, 0x2C, 0x88, 0x79, 0x72, 0x78, 0x64,
+    0x7A, 0x61, 0x6F, 0x6E, 0x65, 0x00, 0x45, 0x10, 0x1D, 0x11, 0x10, 0x2C, 0x84, 0x6D, 0x7A, 0x72,
+    0x6E, 0x65, 0x00, 0x04, 0x04, 0x11, 0x13, 0x1D, 0x40, 0x15, 0x50, 0x15, 0x5B, 0x15, 0x67, 0x15,
+    0x45, 0x14, 0x14, 0x04, 0x0C, 0x19, 0x87, 0x69, 0x76, 0x61, 0x71, 0x71, 0x61, 0x6F, 0x65, 0x00,
+    0x45, 0x0B, 0x05, 0x0F, 0x0D, 0x08, 0x82, 0x6F, 0x6E, 0x65, 0x00, 0x47, 0x0C, 0x07, 0x0E, 0x1C,
+    0x12, 0x04, 0x2C, 0x81, 0x65, 0x6F, 0x00, 0x46, 0x06, 0x19, 0x0F, 0x19, 0x1C, 0x0D, 0x82, 0x6F,
+    0x7A, 0x65, 0x00, 0x44, 0x0C, 0x0C, 0x06, 0x12, 0x85, 0x63, 0x6F, 0x69, 0x69, 0x70, 0x65, 0x00,
+    0x46, 0x1B, 0x05, 0x14, 0x11, 0x11, 0x04, 0x82, 0x71, 0x78, 0x65, 0x00, 0x03, 0x0A, 0x14, 0x16,
+    0x96, 0x15, 0xA4, 0x15, 0xAF, 0x15, 0x45, 0x0C, 0x0A, 0x1A, 0x06, 0x0A, 0x85, 0x67, 0x77, 0x69,
+    0x67, 0x72, 0x65, 0x00, 0x45, 0x0D, 0x0C, 0x07, 0x0C, 0x17, 0x82, 0x72, 0x71, 0x65, 0x00, 0x45,
+    0x04, 0x1B, 0x1D, 0x09, 0x2C, 0x85, 0x78, 0x7A, 0x61, 0x73, 0x72, 0x65, 0x00, 0x02, 0x12, 0x18,
+    0xC4, 0x15, 0xD2, 0x15, 0x47, 0x0E, 0x0D, 0x0B, 0x17, 0x16, 0x1B, 0x0D, 0x83, 0x6F, 0x6B, 0x73,
+    0x65, 0x00, 0x46, 0x1B, 0x11, 0x04, 0x1C, 0x16, 0x16, 0x86, 0x61, 0x79, 0x6E, 0x78, 0x75, 0x73,
+    0x65, 0x00, 0x02, 0x0D, 0x11, 0xE9, 0x15, 0xF4, 0x15, 0x44, 0x16, 0x15, 0x0D, 0x2C, 0x83, 0x6A,
+    0x73, 0x74, 0x65, 0x00, 0x43, 0x10, 0x0E, 0x05, 0x82, 0x74, 0x6E, 0x65, 0x00, 0x06, 0x05, 0x0C,
+    0x0D, 0x11, 0x19, 0x1D, 0x10, 0x16, 0x1F, 0x16, 0x2B, 0x16, 0x36, 0x16, 0x46, 0x16, 0x51, 0x16,
+    0x45, 0x13, 0x17, 0x0A, 0x07, 0x1A, 0x86, 0x67, 0x64, 0x74, 0x70, 0x62, 0x75, 0x65, 0x00, 0x46,
+    0x0F, 0x0D, 0x06, 0x14, 0x18, 0x0E, 0x82, 0x75, 0x69, 0x65, 0x00, 0x46, 0x1B, 0x10, 0x11, 0x17,
+    0x04, 0x1D, 0x81, 0x65, 0x75, 0x00, 0x46, 0x05, 0x15, 0x1C, 0x06, 0x1D, 0x17, 0x86, 0x79, 0x63,
+    0x72, 0x62, 0x6E, 0x75, 0x65, 0x00, 0x45, 0x0A, 0x14, 0x12, 0x0A, 0x0A, 0x82, 0x75, 0x76, 0x65,
+    0x00, 0x46, 0x1D, 0x09, 0x0D, 0x04, 0x0A, 0x0F, 0x84, 0x7A, 0x66, 0x7A, 0x75, 0x65, 0x00, 0x46,
+    0x18, 0x1A, 0x12, 0x18, 0x1C, 0x05, 0x84, 0x77, 0x6F, 0x75, 0x76, 0x65, 0x00, 0x44, 0x13, 0x08,
+    0x17, 0x14, 0x81, 0x65, 0x77, 0x00, 0x47, 0x10, 0x0F, 0x04, 0x17, 0x1C, 0x09, 0x0A, 0x87, 0x79,
+    0x66, 0x74, 0x61, 0x6C, 0x6D, 0x78, 0x65, 0x00, 0x02, 0x05, 0x0F, 0x8F, 0x16, 0x9A, 0x16, 0x43,
+    0x14, 0x15, 0x18, 0x84, 0x71, 0x72, 0x62, 0x79, 0x65, 0x00, 0x45, 0x09, 0x0B, 0x10, 0x0D, 0x2C,
+    0x82, 0x79, 0x6C, 0x65, 0x00, 0x46, 0x0F, 0x0F, 0x06, 0x06, 0x1C, 0x18, 0x87, 0x79, 0x75, 0x63,
+    0x63, 0x6C, 0x6C, 0x7A, 0x65, 0x00, 0x18, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0xFF,
+    0x16, 0x1E, 0x17, 0x90, 0x17, 0x04, 0x18, 0x27, 0x18, 0x49, 0x18, 0xA2, 0x18, 0xB5, 0x18, 0xEC,
+    0x18, 0x0A, 0x19, 0x3E, 0x19, 0x71, 0x19, 0x7D, 0x19, 0xD4, 0x19, 0xE5, 0x19, 0x0A, 0x1A, 0x49,
+    0x1A, 0x66, 0x1A, 0x81, 0x1A, 0xA3, 0x1A, 0xB2, 0x1A, 0xD6, 0x1A, 0x15, 0x1B, 0x22, 0x1B, 0x41,
+    0x04, 0x02, 0x0F, 0x14, 0x08, 0x17, 0x15, 0x17, 0x43, 0x0D, 0x19, 0x15, 0x86, 0x76, 0x72, 0x6A,
+    0x6C, 0x61, 0x61, 0x66, 0x00, 0x42, 0x14, 0x17, 0x83, 0x61, 0x71, 0x61, 0x66, 0x00, 0x06, 0x06,
+    0x09, 0x12, 0x19, 0x1B, 0x1D, 0x31, 0x17, 0x3B, 0x17, 0x4A, 0x17, 0x58, 0x17, 0x72, 0x17, 0x82,
+    0x17, 0x44, 0x1A, 0x09, 0x16, 0x2C, 0x82, 0x62, 0x63, 0x66, 0x00, 0x47, 0x11, 0x10, 0x10, 0x15,
+    0x16, 0x05, 0x2C, 0x84, 0x6E, 0x6D, 0x66, 0x62, 0x66, 0x00, 0x44, 0x1A, 0x05, 0x1B, 0x0D, 0x86,
+    0x78, 0x6A, 0x62, 0x77, 0x6F, 0x62, 0x66, 0x00, 0x02, 0x0D, 0x10, 0x5F, 0x17, 0x68, 0x17, 0x43,
+    0x0D, 0x16, 0x2C, 0x82, 0x62, 0x76, 0x66, 0x00, 0x45, 0x19, 0x0C, 0x15, 0x06, 0x05, 0x81, 0x66,
+    0x62, 0x00, 0x45, 0x0D, 0x0D, 0x0F, 0x09, 0x14, 0x87, 0x66, 0x71, 0x6C, 0x6A, 0x6A, 0x78, 0x62,
+    0x66, 0x00, 0x46, 0x13, 0x09, 0x1B, 0x13, 0x15, 0x17, 0x84, 0x70, 0x66, 0x7A, 0x62, 0x66, 0x00,
+    0x06, 0x08, 0x0B, 0x13, 0x17, 0x19, 0x1C, 0xA3, 0x17, 0xB0, 0x17, 0xC4, 0x17, 0xD3, 0x17, 0xDD,
+    0x17, 0xE9, 0x17, 0x46, 0x0B, 0x06, 0x0A, 0x0E, 0x10, 0x2C, 0x83, 0x65, 0x68, 0x63, 0x66, 0x00,
+    0x47, 0x13, 0x0E, 0x06, 0x11, 0x1B, 0x14, 0x0A, 0x89, 0x71, 0x67, 0x78, 0x6E, 0x63, 0x6B, 0x70,
+    0x68, 0x63, 0x66, 0x00, 0x46, 0x04, 0x0B, 0x1C, 0x04, 0x0D, 0x06, 0x85, 0x68, 0x79, 0x61, 0x70,
+    0x63, 0x66, 0x00, 0x45, 0x0D, 0x19, 0x16, 0x1C, 0x0F, 0x81, 0x66, 0x63, 0x00, 0x46, 0x09, 0x12,
+    0x0B, 0x15, 0x0E, 0x2C, 0x82, 0x63, 0x76, 0x66, 0x00, 0x02, 0x18, 0x1D, 0xF0, 0x17, 0xFB, 0x17,
+    0x42, 0x1C, 0x0B, 0x85, 0x79, 0x68, 0x75, 0x79, 0x63, 0x66, 0x00, 0x42, 0x0D, 0x0E, 0x83, 0x79,
+    0x7A, 0x63, 0x66, 0x00, 0x02, 0x08, 0x1B, 0x0B, 0x18, 0x18, 0x18, 0x46, 0x0C, 0x07, 0x19, 0x1D,
+    0x14, 0x17, 0x83, 0x65, 0x69, 0x64, 0x66, 0x00, 0x45, 0x04, 0x13, 0x10, 0x12, 0x0B, 0x86, 0x6D,
+    0x6F, 0x70, 0x61, 0x78, 0x64, 0x66, 0x00, 0x02, 0x07, 0x14, 0x2E, 0x18, 0x3A, 0x18, 0x45, 0x1C,
+    0x0F, 0x18, 0x09, 0x16, 0x83, 0x64, 0x79, 0x65, 0x66, 0x00, 0x48, 0x09, 0x14, 0x09, 0x19, 0x1D,
+    0x17, 0x05, 0x2C, 0x83, 0x71, 0x66, 0x65, 0x66, 0x00, 0x05, 0x05, 0x06, 0x08, 0x0E, 0x19, 0x59,
+    0x18, 0x6B, 0x18, 0x76, 0x18, 0x88, 0x18, 0x94, 0x18, 0x47, 0x0A, 0x1A, 0x15, 0x09, 0x08, 0x19,
+    0x2C, 0x87, 0x66, 0x65, 0x72, 0x77, 0x67, 0x62, 0x66, 0x66, 0x00, 0x44, 0x08, 0x15, 0x09, 0x2C,
+    0x83, 0x63, 0x65, 0x66, 0x66, 0x00, 0x46, 0x1A, 0x19, 0x0A, 0x07, 0x15, 0x18, 0x88, 0x72, 0x75,
+    0x64, 0x67, 0x76, 0x77, 0x65, 0x66, 0x66, 0x00, 0x46, 0x1B, 0x08, 0x05, 0x0A, 0x0D, 0x0C, 0x82,
+    0x66, 0x6B, 0x66, 0x00, 0x47, 0x0E, 0x14, 0x13, 0x19, 0x12, 0x1A, 0x06, 0x83, 0x76, 0x6B, 0x66,
+    0x66, 0x00, 0x48, 0x05, 0x05, 0x04, 0x10, 0x0D, 0x0A, 0x14, 0x2C, 0x87, 0x6A, 0x67, 0x6D, 0x61,
+    0x62, 0x62, 0x67, 0x66, 0x00, 0x02, 0x09, 0x0F, 0xBC, 0x18, 0xDF, 0x18, 0x02, 0x04, 0x19, 0xC3,
+    0x18, 0xCE, 0x18, 0x45, 0x12, 0x18, 0x07, 0x15, 0x2C, 0x82, 0x68, 0x66, 0x66, 0x00, 0x45, 0x0F,
+    0x09, 0x1A, 0x05, 0x07, 0x88, 0x62, 0x64, 0x77, 0x66, 0x6C, 0x76, 0x66, 0x68, 0x66, 0x00, 0x44,
+    0x05, 0x0B, 0x1A, 0x05, 0x85, 0x68, 0x77, 0x62, 0x6C, 0x68, 0x66, 0x00, 0x02, 0x06, 0x15, 0xF3,
+    0x18, 0xFE, 0x18, 0x44, 0x0F, 0x11, 0x1B, 0x0A, 0x83, 0x63, 0x6C, 0x69, 0x66, 0x00, 0x45, 0x0D,
+    0x09, 0x1D, 0x08, 0x2C, 0x83, 0x72, 0x6A, 0x69, 0x66, 0x00, 0x03, 0x05, 0x08, 0x15, 0x14, 0x19,
+    0x25, 0x19, 0x32, 0x19, 0x47, 0x0D, 0x0D, 0x06, 0x0B, 0x10, 0x08, 0x19, 0x86, 0x63, 0x68, 0x6A,
+    0x6A, 0x62, 0x6B, 0x66, 0x00, 0x44, 0x1C, 0x0C, 0x06, 0x12, 0x85, 0x69, 0x63, 0x79, 0x65, 0x6B,
+    0x66, 0x00, 0x43, 0x08, 0x0C, 0x0D, 0x85, 0x69, 0x6A, 0x65, 0x72, 0x6B, 0x66, 0x00, 0x03, 0x12,
+    0x18, 0x1A, 0x48, 0x19, 0x57, 0x19, 0x69, 0x19, 0x47, 0x09, 0x1A, 0x0C, 0x19, 0x0C, 0x0B, 0x15,
+    0x84, 0x66, 0x77, 0x6F, 0x6C, 0x66, 0x00, 0x48, 0x13, 0x05, 0x09, 0x1D, 0x0D, 0x1B, 0x0A, 0x2C,
+    0x86, 0x66, 0x7A, 0x62, 0x70, 0x75, 0x6C, 0x66, 0x00, 0x43, 0x1A, 0x06, 0x06, 0x81, 0x66, 0x6C,
+    0x00, 0x47, 0x1C, 0x19, 0x04, 0x0D, 0x0D, 0x06, 0x0F, 0x81, 0x66, 0x6D, 0x00, 0x06, 0x0C, 0x0D,
+    0x0F, 0x16, 0x17, 0x1C, 0x90, 0x19, 0x9D, 0x19, 0xAB, 0x19, 0xB6, 0x19, 0xC1, 0x19, 0xCB, 0x19,
+    0x44, 0x07, 0x15, 0x0F, 0x04, 0x85, 0x72, 0x6C, 0x64, 0x69, 0x6E, 0x66, 0x00, 0x46, 0x12, 0x1A,
+    0x08, 0x11, 0x12, 0x15, 0x84, 0x6F, 0x77, 0x6A, 0x6E, 0x66, 0x00, 0x44, 0x0A, 0x0B, 0x13, 0x19,
+    0x83, 0x6C, 0x67, 0x6E, 0x66, 0x00, 0x45, 0x13, 0x1B, 0x1D, 0x06, 0x0C, 0x82, 0x6E, 0x73, 0x66,
+    0x00, 0x44, 0x1C, 0x10, 0x12, 0x0F, 0x82, 0x6E, 0x74, 0x66, 0x00, 0x43, 0x0B, 0x16, 0x06, 0x82,
+    0x6E, 0x79, 0x66, 0x00, 0x47, 0x17, 0x16, 0x09, 0x07, 0x1C, 0x0F, 0x0D, 0x86, 0x64, 0x79, 0x66,
+    0x73, 0x74, 0x6F, 0x66, 0x00, 0x02, 0x04, 0x13, 0xEC, 0x19, 0xFC, 0x19, 0x45, 0x18, 0x0D, 0x0F,
+    0x0A, 0x18, 0x87, 0x67, 0x75, 0x6C, 0x6A, 0x75, 0x61, 0x70, 0x66, 0x00, 0x47, 0x08, 0x09, 0x0D,
+    0x15, 0x07, 0x12, 0x0B, 0x83, 0x70, 0x65, 0x70, 0x66, 0x00, 0x03, 0x04, 0x0A, 0x10, 0x14, 0x1A,
+    0x29, 0x1A, 0x3C, 0x1A, 0x48, 0x0D, 0x1B, 0x0E, 0x0C, 0x0D, 0x0A, 0x10, 0x2C, 0x89, 0x67, 0x6D,
+    0x6A, 0x69, 0x6B, 0x78, 0x6A, 0x61, 0x72, 0x66, 0x00, 0x47, 0x1C, 0x13, 0x1B, 0x10, 0x0F, 0x1C,
+    0x08, 0x88, 0x6C, 0x79, 0x6D, 0x78, 0x70, 0x79, 0x67, 0x72, 0x66, 0x00, 0x44, 0x18, 0x0E, 0x17,
+    0x13, 0x85, 0x6B, 0x74, 0x75, 0x6D, 0x72, 0x66, 0x00, 0x02, 0x08, 0x16, 0x50, 0x1A, 0x5C, 0x1A,
+    0x47, 0x09, 0x1C, 0x15, 0x12, 0x0E, 0x1D, 0x2C, 0x81, 0x66, 0x73, 0x00, 0x45, 0x1B, 0x10, 0x08,
+    0x15, 0x2C, 0x81, 0x66, 0x73, 0x00, 0x02, 0x0E, 0x18, 0x6D, 0x1A, 0x77, 0x1A, 0x44, 0x16, 0x0A,
+    0x1A, 0x12, 0x82, 0x74, 0x6B, 0x66, 0x00, 0x44, 0x13, 0x1A, 0x05, 0x1B, 0x82, 0x74, 0x75, 0x66,
+    0x00, 0x02, 0x14, 0x18, 0x88, 0x1A, 0x96, 0x1A, 0x46, 0x17, 0x19, 0x0C, 0x05, 0x05, 0x2C, 0x84,
+    0x74, 0x76, 0x71, 0x75, 0x66, 0x00, 0x44, 0x0E, 0x1B, 0x11, 0x1C, 0x85, 0x78, 0x6E, 0x6B, 0x75,
+    0x75, 0x66, 0x00, 0x45, 0x0F, 0x07, 0x11, 0x07, 0x10, 0x86, 0x64, 0x6D, 0x6E, 0x64, 0x6C, 0x76,
+    0x66, 0x00, 0x02, 0x10, 0x1D, 0xB9, 0x1A, 0xC4, 0x1A, 0x43, 0x09, 0x10, 0x06, 0x84, 0x66, 0x6D,
+    0x6D, 0x77, 0x66, 0x00, 0x47, 0x18, 0x19, 0x19, 0x1D, 0x1B, 0x18, 0x1A, 0x87, 0x7A, 0x78, 0x76,
+    0x76, 0x75, 0x7A, 0x77, 0x66, 0x00, 0x04, 0x07, 0x0C, 0x16, 0x1D, 0xE3, 0x1A, 0xF0, 0x1A, 0xFF,
+    0x1A, 0x09, 0x1B, 0x44, 0x07, 0x04, 0x0F, 0x09, 0x85, 0x61, 0x6C, 0x64, 0x64, 0x78, 0x66, 0x00,
+    0x46, 0x1B, 0x08, 0x09, 0x0F, 0x11, 0x2C, 0x85, 0x65, 0x66, 0x78, 0x69, 0x78, 0x66, 0x00, 0x43,
+    0x0C, 0x0A, 0x19, 0x83, 0x73, 0x69, 0x78, 0x66, 0x00, 0x44, 0x0C, 0x08, 0x0F, 0x2C, 0x84, 0x69,
+    0x65, 0x7A, 0x78, 0x66, 0x00, 0x44, 0x04, 0x05, 0x12, 0x17, 0x85, 0x6F, 0x74, 0x62, 0x61, 0x79,
+    0x66, 0x00, 0x04, 0x06, 0x0B, 0x18, 0x1D, 0x2F, 0x1B, 0x4E, 0x1B, 0x59, 0x1B, 0x68, 0x1B, 0x02,
+    0x05, 0x06, 0x36, 0x1B, 0x42, 0x1B, 0x43, 0x19, 0x1B, 0x10, 0x85, 0x76, 0x78, 0x62, 0x63, 0x7A,
+    0x66, 0x00, 0x44, 0x0C, 0x09, 0x1D, 0x0F, 0x84, 0x63, 0x69, 0x63, 0x7A, 0x66, 0x00, 0x44, 0x19,
+    0x13, 0x0B, 0x11, 0x83, 0x68, 0x76, 0x7A, 0x66, 0x00, 0x46, 0x07, 0x14, 0x1D, 0x18, 0x06, 0x1A,
+    0x85, 0x71, 0x7A, 0x64, 0x75, 0x7A, 0x66, 0x00, 0x02, 0x05, 0x1A, 0x6F, 0x1B, 0x7B, 0x1B, 0x45,
+    0x0C, 0x14, 0x1C, 0x0F, 0x11, 0x83, 0x7A, 0x62, 0x7A, 0x66, 0x00, 0x45, 0x0E, 0x0D, 0x12, 0x06,
+    0x1A, 0x81, 0x66, 0x7A, 0x00, 0x19, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1D, 0xD1,
+    0x1B, 0xFD, 0x1B, 0x49, 0x1C, 0xA0, 0x1C, 0xC8, 0x1C, 0xE6, 0x1C, 0x3E, 0x1D, 0x64, 0x1D, 0xC3,
+    0x1D, 0xFF, 0x1D, 0x1D, 0x1E, 0x53, 0x1E, 0x92, 0x1E, 0xA1, 0x1E, 0x26, 0x1F, 0x77, 0x1F, 0x93,
+    0x1F, 0xBE, 0x1F, 0x05, 0x20, 0x26, 0x20, 0x5C, 0x20, 0x90, 0x20, 0xD2, 0x20, 0xFE, 0x20, 0x1A,
+    0x21, 0x03, 0x04, 0x0F, 0x10, 0xDB, 0x1B, 0xE6, 0x1B, 0xEF, 0x1B, 0x43, 0x08, 0x0E, 0x07, 0x84,
+    0x65, 0x6B, 0x61, 0x61, 0x67, 0x00, 0x44, 0x08, 0x18, 0x17, 0x1C, 0x81, 0x67, 0x61, 0x00, 0x47,
+    0x0C, 0x15, 0x1B, 0x0E, 0x19, 0x1C, 0x08, 0x83, 0x6D, 0x69, 0x61, 0x67, 0x00, 0x04, 0x07, 0x0B,
+    0x1A, 0x1C, 0x0A, 0x1C, 0x16, 0x1C, 0x22, 0x1C, 0x3E, 0x1C, 0x47, 0x13, 0x1A, 0x10, 0x08, 0x10,
+    0x0E, 0x18, 0x81, 0x67, 0x62, 0x00, 0x44, 0x0D, 0x09, 0x15, 0x16, 0x84, 0x6A, 0x66, 0x68, 0x62,
+    0x67, 0x00, 0x02, 0x15, 0x18, 0x29, 0x1C, 0x32, 0x1C, 0x43, 0x18, 0x09, 0x08, 0x82, 0x62, 0x77,
+    0x67, 0x00, 0x44, 0x0C, 0x1D, 0x10, 0x2C, 0x84, 0x75, 0x69, 0x77, 0x62, 0x67, 0x00, 0x46, 0x15,
+    0x05, 0x0D, 0x1C, 0x14, 0x06, 0x81, 0x67, 0x62, 0x00, 0x05, 0x08, 0x0C, 0x16, 0x18, 0x1A, 0x59,
+    0x1C, 0x68, 0x1C, 0x73, 0x1C, 0x84, 0x1C, 0x92, 0x1C, 0x45, 0x16, 0x0E, 0x16, 0x04, 0x18, 0x86,
+    0x73, 0x61, 0x6B, 0x73, 0x65, 0x63, 0x67, 0x00, 0x46, 0x15, 0x16, 0x08, 0x11, 0x09, 0x2C, 0x81,
+    0x67, 0x63, 0x00, 0x46, 0x14, 0x0E, 0x16, 0x16, 0x1C, 0x09, 0x87, 0x73, 0x79, 0x73, 0x6B, 0x71,
+    0x73, 0x63, 0x67, 0x00, 0x45, 0x18, 0x09, 0x0E, 0x04, 0x1A, 0x85, 0x66, 0x6B, 0x75, 0x75, 0x63,
+    0x67, 0x00, 0x46, 0x1C, 0x10, 0x0B, 0x15, 0x1A, 0x12, 0x84, 0x79, 0x6D, 0x77, 0x63, 0x67, 0x00,
+    0x02, 0x08, 0x14, 0xA7, 0x1C, 0xB4, 0x1C, 0x47, 0x1D, 0x0B, 0x09, 0x04, 0x07, 0x16, 0x19, 0x82,
+    0x64, 0x65, 0x67, 0x00, 0x47, 0x18, 0x1C, 0x1A, 0x16, 0x1D, 0x0A, 0x0E, 0x89, 0x67, 0x6B, 0x7A,
+    0x73, 0x77, 0x79, 0x75, 0x71, 0x64, 0x67, 0x00, 0x02, 0x12, 0x1D, 0xCF, 0x1C, 0xD7, 0x1C, 0x43,
+    0x13, 0x0B, 0x1D, 0x81, 0x67, 0x65, 0x00, 0x48, 0x0F, 0x0A, 0x0B, 0x16, 0x12, 0x0A, 0x1B, 0x2C,
+    0x83, 0x7A, 0x6C, 0x65, 0x67, 0x00, 0x04, 0x08, 0x0C, 0x0D, 0x17, 0xF3, 0x1C, 0x17, 0x1D, 0x21,
+    0x1D, 0x2C, 0x1D, 0x02, 0x19, 0x1C, 0xFA, 0x1C, 0x03, 0x1D, 0x42, 0x0C, 0x0F, 0x83, 0x65, 0x76,
+    0x66, 0x67, 0x00, 0x47, 0x0E, 0x0A, 0x0B, 0x1B, 0x12, 0x0A, 0x2C, 0x89, 0x6F, 0x67, 0x78, 0x68,
+    0x67, 0x6B, 0x79, 0x65, 0x66, 0x67, 0x00, 0x43, 0x1C, 0x0B, 0x13, 0x83, 0x69, 0x79, 0x66, 0x67,
+    0x00, 0x44, 0x1D, 0x0C, 0x07, 0x18, 0x83, 0x6A, 0x7A, 0x66, 0x67, 0x00, 0x48, 0x0F, 0x0A, 0x15,
+    0x18, 0x05, 0x0D, 0x1A, 0x2C, 0x86, 0x72, 0x75, 0x67, 0x6C, 0x74, 0x66, 0x67, 0x00, 0x02, 0x06,
+    0x11, 0x45, 0x1D, 0x58, 0x1D, 0x47, 0x0F, 0x1B, 0x05, 0x0B, 0x1A, 0x0A, 0x14, 0x88, 0x77, 0x67,
+    0x68, 0x62, 0x78, 0x6C, 0x63, 0x67, 0x67, 0x00, 0x44, 0x1A, 0x14, 0x19, 0x2C, 0x84, 0x77, 0x71,
+    0x6E, 0x67, 0x67, 0x00, 0x04, 0x04, 0x0D, 0x12, 0x1A, 0x71, 0x1D, 0x7E, 0x1D, 0x8D, 0x1D, 0xB6,
+    0x1D, 0x46, 0x06, 0x1C, 0x0A, 0x14, 0x18, 0x10, 0x83, 0x61, 0x63, 0x68, 0x67, 0x00, 0x47, 0x08,
+    0x1B, 0x11, 0x13, 0x09, 0x1D, 0x1B, 0x84, 0x65, 0x78, 0x6A, 0x68, 0x67, 0x00, 0x02, 0x09, 0x16,
+    0x94, 0x1D, 0xA7, 0x1D, 0x46, 0x10, 0x0E, 0x10, 0x05, 0x0F, 0x07, 0x89, 0x6C, 0x64, 0x62, 0x6D,
+    0x6B, 0x6D, 0x66, 0x6F, 0x68, 0x67, 0x00, 0x46, 0x05, 0x18, 0x05, 0x11, 0x07, 0x14, 0x85, 0x62,
+    0x75, 0x73, 0x6F, 0x68, 0x67, 0x00, 0x46, 0x09, 0x1A, 0x0D, 0x10, 0x1C, 0x07, 0x83, 0x77, 0x66,
+    0x68, 0x67, 0x00, 0x04, 0x0F, 0x16, 0x19, 0x1D, 0xD0, 0x1D, 0xDD, 0x1D, 0xE6, 0x1D, 0xF6, 0x1D,
+    0x45, 0x15, 0x0F, 0x0A, 0x1C, 0x10, 0x84, 0x72, 0x6C, 0x6C, 0x69, 0x67, 0x00, 0x44, 0x06, 0x1B,
+    0x11, 0x2C, 0x81, 0x67, 0x69, 0x00, 0x46, 0x07, 0x1A, 0x16, 0x1C, 0x1C, 0x04, 0x86, 0x73, 0x79,
+    0x77, 0x64, 0x76, 0x69, 0x67, 0x00, 0x43, 0x0D, 0x0E, 0x1C, 0x82, 0x69, 0x7A, 0x67, 0x00, 0x02,
+    0x04, 0x1D, 0x06, 0x1E, 0x10, 0x1E, 0x43, 0x05, 0x10, 0x15, 0x83, 0x61, 0x62, 0x6A, 0x67, 0x00,
+    0x47, 0x08, 0x1C, 0x13, 0x14, 0x0D, 0x12, 0x1D, 0x82, 0x6A, 0x7A, 0x67, 0x00, 0x04, 0x07, 0x0D,
+    0x10, 0x13, 0x2A, 0x1E, 0x32, 0x1E, 0x3A, 0x1E, 0x45, 0x1E, 0x43, 0x0E, 0x15, 0x09, 0x81, 0x67,
+    0x6B, 0x00, 0x43, 0x0D, 0x0C, 0x0F, 0x81, 0x67, 0x6B, 0x00, 0x44, 0x1C, 0x09, 0x0E, 0x15, 0x83,
+    0x6D, 0x79, 0x6B, 0x67, 0x00, 0x46, 0x09, 0x0C, 0x09, 0x09, 0x11, 0x13, 0x84, 0x66, 0x69, 0x70,
+    0x6B, 0x67, 0x00, 0x03, 0x06, 0x07, 0x1C, 0x5D, 0x1E, 0x6E, 0x1E, 0x7E, 0x1E, 0x48, 0x0C, 0x05,
+    0x0C, 0x11, 0x13, 0x0F, 0x11, 0x2C, 0x85, 0x62, 0x69, 0x69, 0x63, 0x6C, 0x67, 0x00, 0x46, 0x13,
+    0x06, 0x0E, 0x06, 0x1D, 0x2C, 0x86, 0x6B, 0x63, 0x63, 0x70, 0x64, 0x6C, 0x67, 0x00, 0x47, 0x0E,
+    0x0A, 0x16, 0x06, 0x1A, 0x0A, 0x1B, 0x89, 0x67, 0x78, 0x77, 0x63, 0x73, 0x67, 0x6B, 0x79, 0x6C,
+    0x67, 0x00, 0x47, 0x15, 0x14, 0x16, 0x08, 0x1B, 0x1A, 0x2C, 0x84, 0x71, 0x73, 0x72, 0x6D, 0x67,
+    0x00, 0x08, 0x05, 0x07, 0x0B, 0x0C, 0x10, 0x16, 0x1A, 0x1C, 0xBA, 0x1E, 0xC8, 0x1E, 0xD4, 0x1E,
+    0xDD, 0x1E, 0xF0, 0x1E, 0xFD, 0x1E, 0x06, 0x1F, 0x16, 0x1F, 0x46, 0x0D, 0x1D, 0x1C, 0x14, 0x10,
+    0x16, 0x84, 0x6A, 0x7A, 0x62, 0x6E, 0x67, 0x00, 0x43, 0x0D, 0x0E, 0x17, 0x85, 0x6B, 0x74, 0x6A,
+    0x64, 0x6E, 0x67, 0x00, 0x44, 0x05, 0x12, 0x13, 0x0A, 0x81, 0x67, 0x6E, 0x00, 0x47, 0x13, 0x18,
+    0x19, 0x07, 0x06, 0x10, 0x05, 0x88, 0x63, 0x6D, 0x64, 0x76, 0x75, 0x70, 0x69, 0x6E, 0x67, 0x00,
+    0x47, 0x04, 0x0D, 0x0B, 0x09, 0x07, 0x1B, 0x12, 0x82, 0x6E, 0x6D, 0x67, 0x00, 0x44, 0x0A, 0x16,
+    0x0F, 0x15, 0x81, 0x67, 0x6E, 0x00, 0x46, 0x1A, 0x10, 0x1D, 0x12, 0x1C, 0x18, 0x86, 0x7A, 0x6F,
+    0x6D, 0x77, 0x77, 0x6E, 0x67, 0x00, 0x46, 0x08, 0x0E, 0x14, 0x04, 0x09, 0x0F, 0x86, 0x71, 0x61,
+    0x6B, 0x65, 0x79, 0x6E, 0x67, 0x00, 0x05, 0x05, 0x0D, 0x1A, 0x1B, 0x1C, 0x36, 0x1F, 0x43, 0x1F,
+    0x4D, 0x1F, 0x5B, 0x1F, 0x69, 0x1F, 0x46, 0x17, 0x1C, 0x1B, 0x12, 0x0F, 0x2C, 0x83, 0x62, 0x74,
+    0x6F, 0x67, 0x00, 0x44, 0x0A, 0x13, 0x1D, 0x19, 0x82, 0x6F, 0x6A, 0x67, 0x00, 0x44, 0x0F, 0x0F,
+    0x05, 0x04, 0x86, 0x62, 0x61, 0x6C, 0x6C, 0x77, 0x6F, 0x67, 0x00, 0x48, 0x1B, 0x11, 0x1A, 0x12,
+    0x1A, 0x17, 0x14, 0x2C, 0x82, 0x6F, 0x78, 0x67, 0x00, 0x47, 0x18, 0x10, 0x1A, 0x0F, 0x0C, 0x12,
+    0x12, 0x83, 0x79, 0x75, 0x6F, 0x67, 0x00, 0x02, 0x0C, 0x1B, 0x7E, 0x1F, 0x89, 0x1F, 0x44, 0x04,
+    0x11, 0x1C, 0x07, 0x83, 0x69, 0x61, 0x70, 0x67, 0x00, 0x44, 0x12, 0x15, 0x06, 0x04, 0x82, 0x70,
+    0x78, 0x67, 0x00, 0x02, 0x07, 0x11, 0x9A, 0x1F, 0xAC, 0x1F, 0x46, 0x0F, 0x0B, 0x13, 0x1B, 0x14,
+    0x15, 0x88, 0x71, 0x72, 0x78, 0x70, 0x68, 0x6C, 0x64, 0x71, 0x67, 0x00, 0x46, 0x14, 0x13, 0x13,
+    0x1B, 0x14, 0x0B, 0x88, 0x71, 0x68, 0x78, 0x70, 0x70, 0x71, 0x6E, 0x71, 0x67, 0x00, 0x05, 0x04,
+    0x0F, 0x13, 0x14, 0x17, 0xCE, 0x1F, 0xDA, 0x1F, 0xE4, 0x1F, 0xED, 0x1F, 0xF9, 0x1F, 0x45, 0x15,
+    0x16, 0x0A, 0x11, 0x07, 0x83, 0x61, 0x72, 0x72, 0x67, 0x00, 0x45, 0x14, 0x1C, 0x0A, 0x1C, 0x11,
+    0x81, 0x67, 0x72, 0x00, 0x44, 0x13, 0x1B, 0x0B, 0x19, 0x81, 0x67, 0x72, 0x00, 0x47, 0x1C, 0x13,
+    0x0F, 0x0F, 0x13, 0x0C, 0x2C, 0x81, 0x67, 0x72, 0x00, 0x44, 0x0D, 0x1C, 0x12, 0x19, 0x84, 0x6A,
+    0x79, 0x74, 0x72, 0x67, 0x00, 0x02, 0x17, 0x1D, 0x0C, 0x20, 0x1A, 0x20, 0x45, 0x10, 0x15, 0x1B,
+    0x0D, 0x15, 0x85, 0x72, 0x78, 0x6D, 0x74, 0x73, 0x67, 0x00, 0x46, 0x19, 0x08, 0x0C, 0x19, 0x0E,
+    0x19, 0x82, 0x73, 0x7A, 0x67, 0x00, 0x03, 0x06, 0x0B, 0x13, 0x30, 0x20, 0x3E, 0x20, 0x48, 0x20,
+    0x47, 0x14, 0x0E, 0x04, 0x13, 0x18, 0x11, 0x10, 0x83, 0x63, 0x71, 0x74, 0x67, 0x00, 0x43, 0x16,
+    0x1D, 0x16, 0x83, 0x68, 0x73, 0x74, 0x67, 0x00, 0x47, 0x09, 0x12, 0x1D, 0x1A, 0x14, 0x0D, 0x12,
+    0x89, 0x6A, 0x6F, 0x71, 0x77, 0x7A, 0x6F, 0x66, 0x70, 0x74, 0x67, 0x00, 0x03, 0x05, 0x06, 0x18,
+    0x66, 0x20, 0x77, 0x20, 0x81, 0x20, 0x47, 0x09, 0x10, 0x1B, 0x11, 0x18, 0x09, 0x18, 0x86, 0x78,
+    0x6E, 0x6D, 0x66, 0x62, 0x75, 0x67, 0x00, 0x43, 0x0C, 0x06, 0x05, 0x83, 0x63, 0x69, 0x75, 0x67,
+    0x00, 0x45, 0x0A, 0x1A, 0x0C, 0x18, 0x2C, 0x86, 0x69, 0x75, 0x77, 0x67, 0x75, 0x75, 0x67, 0x00,
+    0x04, 0x15, 0x18, 0x1B, 0x1C, 0x9D, 0x20, 0xAC, 0x20, 0xBB, 0x20, 0xC8, 0x20, 0x48, 0x0F, 0x19,
+    0x17, 0x1A, 0x13, 0x15, 0x0F, 0x2C, 0x83, 0x72, 0x6C, 0x76, 0x67, 0x00, 0x45, 0x1C, 0x04, 0x05,
+    0x1D, 0x16, 0x86, 0x62, 0x7A, 0x61, 0x79, 0x75, 0x76, 0x67, 0x00, 0x47, 0x04, 0x16, 0x05, 0x18,
+    0x1D, 0x13, 0x2C, 0x82, 0x76, 0x78, 0x67, 0x00, 0x43, 0x18, 0x0A, 0x06, 0x83, 0x79, 0x75, 0x76,
+    0x67, 0x00, 0x03, 0x05, 0x0F, 0x11, 0xDC, 0x20, 0xE8, 0x20, 0xF4, 0x20, 0x43, 0x18, 0x13, 0x1A,
+    0x85, 0x70, 0x77, 0x75, 0x62, 0x77, 0x67, 0x00, 0x46, 0x08, 0x0A, 0x1B, 0x06, 0x18, 0x11, 0x82,
+    0x77, 0x6C, 0x67, 0x00, 0x43, 0x15, 0x15, 0x06, 0x83, 0x6E, 0x72, 0x77, 0x67, 0x00, 0x02, 0x0B,
+    0x0C, 0x05, 0x21, 0x0E, 0x21, 0x44, 0x0B, 0x16, 0x15, 0x11, 0x81, 0x67, 0x78, 0x00, 0x47, 0x1A,
+    0x16, 0x1C, 0x13, 0x04, 0x19, 0x19, 0x81, 0x67, 0x78, 0x00, 0x48, 0x17, 0x1C, 0x10, 0x12, 0x0E,
+    0x0E, 0x0E, 0x08, 0x82, 0x7A, 0x74, 0x67, 0x00, 0x17, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0x6E, 0x21, 0x7D, 0x21, 0x8B, 0x21, 0x03, 0x22, 0x31, 0x22, 0x59, 0x22, 0xBC, 0x22, 0xDA, 0x22,
+    0x06, 0x23, 0x2F, 0x23, 0x4C, 0x23, 0x86, 0x23, 0xC4, 0x23, 0xF3, 0x23, 0x11, 0x24, 0x53, 0x24,
+    0x9C, 0x24, 0xCB, 0x24, 0xE0, 0x24, 0x17, 0x25, 0x27, 0x25, 0x48, 0x25, 0x6C, 0x25, 0x49, 0x15,
+    0x14, 0x06, 0x11, 0x06, 0x0B, 0x09, 0x0D, 0x2C, 0x82, 0x62, 0x72, 0x68, 0x00, 0x47, 0x10, 0x0D,
+    0x07, 0x1D, 0x04, 0x15, 0x2C, 0x83, 0x6D, 0x6A, 0x63, 0x68, 0x00, 0x04, 0x04, 0x08, 0x0C, 0x1C,
+    0x98, 0x21, 0xC2, 0x21, 0xE5, 0x21, 0xF4, 0x21, 0x02, 0x04, 0x0C, 0x9F, 0x21, 0xAF, 0x21, 0x45,
+    0x09, 0x05, 0x17, 0x08, 0x17, 0x87, 0x74, 0x65, 0x62, 0x66, 0x61, 0x61, 0x64, 0x68, 0x00, 0x46,
+    0x0A, 0x1D, 0x14, 0x1C, 0x10, 0x1B, 0x89, 0x6D, 0x78, 0x79, 0x71, 0x7A, 0x67, 0x69, 0x61, 0x64,
+    0x68, 0x00, 0x02, 0x0F, 0x15, 0xC9, 0x21, 0xD3, 0x21, 0x44, 0x19, 0x0B, 0x0D, 0x16, 0x82, 0x64,
+    0x65, 0x68, 0x00, 0x47, 0x07, 0x1D, 0x1A, 0x14, 0x0F, 0x17, 0x2C, 0x87, 0x77, 0x71, 0x7A, 0x64,
+    0x72, 0x65, 0x64, 0x68, 0x00, 0x47, 0x14, 0x1B, 0x1C, 0x1B, 0x0C, 0x0B, 0x2C, 0x84, 0x71, 0x78,
+    0x69, 0x64, 0x68, 0x00, 0x45, 0x18, 0x06, 0x09, 0x12, 0x2C, 0x86, 0x66, 0x6F, 0x63, 0x75, 0x79,
+    0x64, 0x68, 0x00, 0x02, 0x07, 0x14, 0x0A, 0x22, 0x22, 0x22, 0x02, 0x04, 0x07, 0x11, 0x22, 0x1B,
+    0x22, 0x45, 0x0C, 0x13, 0x0A, 0x0A, 0x05, 0x81, 0x68, 0x66, 0x00, 0x42, 0x11, 0x13, 0x81, 0x68,
+    0x66, 0x00, 0x45, 0x1C, 0x16, 0x16, 0x07, 0x2C, 0x86, 0x73, 0x64, 0x73, 0x79, 0x71, 0x66, 0x68,
+    0x00, 0x02, 0x12, 0x14, 0x38, 0x22, 0x4D, 0x22, 0x48, 0x06, 0x08, 0x09, 0x0B, 0x1A, 0x13, 0x0F,
+    0x2C, 0x89, 0x70, 0x6C, 0x77, 0x68, 0x66, 0x65, 0x63, 0x6F, 0x67, 0x68, 0x00, 0x45, 0x0B, 0x08,
+    0x18, 0x09, 0x1D, 0x83, 0x71, 0x68, 0x67, 0x68, 0x00, 0x04, 0x04, 0x07, 0x1C, 0x1D, 0x66, 0x22,
+    0x7A, 0x22, 0x89, 0x22, 0x99, 0x22, 0x47, 0x06, 0x0E, 0x1D, 0x13, 0x10, 0x0C, 0x18, 0x89, 0x69,
+    0x75, 0x6D, 0x70, 0x7A, 0x6B, 0x63, 0x61, 0x68, 0x68, 0x00, 0x46, 0x04, 0x16, 0x0D, 0x06, 0x10,
+    0x07, 0x85, 0x73, 0x6A, 0x61, 0x64, 0x68, 0x68, 0x00, 0x46, 0x17, 0x19, 0x08, 0x04, 0x19, 0x16,
+    0x86, 0x65, 0x61, 0x76, 0x74, 0x79, 0x68, 0x68, 0x00, 0x41, 0x1D, 0x02, 0x06, 0x18, 0xA2, 0x22,
+    0xAF, 0x22, 0x44, 0x07, 0x1D, 0x16, 0x0A, 0x85, 0x63, 0x64, 0x7A, 0x7A, 0x68, 0x68, 0x00, 0x45,
+    0x0F, 0x05, 0x17, 0x04, 0x0C, 0x84, 0x7A, 0x75, 0x7A, 0x68, 0x68, 0x00, 0x02, 0x0D, 0x1B, 0xC3,
+    0x22, 0xCF, 0x22, 0x46, 0x13, 0x12, 0x13, 0x13, 0x1B, 0x1D, 0x82, 0x69, 0x6A, 0x68, 0x00, 0x45,
+    0x1C, 0x04, 0x14, 0x1C, 0x2C, 0x82, 0x69, 0x78, 0x68, 0x00, 0x02, 0x12, 0x16, 0xE1, 0x22, 0xF3,
+    0x22, 0x46, 0x15, 0x15, 0x0E, 0x18, 0x10, 0x06, 0x88, 0x6D, 0x63, 0x75, 0x6B, 0x72, 0x72, 0x6F,
+    0x6A, 0x68, 0x00, 0x47, 0x0C, 0x0C, 0x1D, 0x07, 0x09, 0x18, 0x0D, 0x88, 0x66, 0x75, 0x64, 0x7A,
+    0x69, 0x69, 0x73, 0x6A, 0x68, 0x00, 0x02, 0x0A, 0x18, 0x0D, 0x23, 0x1D, 0x23, 0x46, 0x15, 0x19,
+    0x05, 0x1B, 0x10, 0x08, 0x86, 0x62, 0x78, 0x76, 0x72, 0x67, 0x6B, 0x68, 0x00, 0x46, 0x10, 0x07,
+    0x0D, 0x1D, 0x0C, 0x12, 0x88, 0x69, 0x6F, 0x7A, 0x6A, 0x64, 0x6D, 0x75, 0x6B, 0x68, 0x00, 0x02,
+    0x0A, 0x11, 0x36, 0x23, 0x41, 0x23, 0x46, 0x16, 0x11, 0x07, 0x1D, 0x19, 0x1B, 0x81, 0x68, 0x6C,
+    0x00, 0x43, 0x19, 0x11, 0x1B, 0x84, 0x76, 0x6E, 0x6E, 0x6C, 0x68, 0x00, 0x03, 0x0D, 0x14, 0x1D,
+    0x56, 0x23, 0x6F, 0x23, 0x79, 0x23, 0x02, 0x08, 0x1B, 0x5D, 0x23, 0x66, 0x23, 0x43, 0x12, 0x0F,
+    0x1B, 0x82, 0x6D, 0x6A, 0x68, 0x00, 0x44, 0x04, 0x1B, 0x18, 0x2C, 0x81, 0x68, 0x6D, 0x00, 0x45,
+    0x09, 0x10, 0x09, 0x19, 0x0E, 0x81, 0x68, 0x6D, 0x00, 0x47, 0x14, 0x0F, 0x10, 0x09, 0x14, 0x19,
+    0x2C, 0x82, 0x6D, 0x7A, 0x68, 0x00, 0x04, 0x07, 0x09, 0x0B, 0x17, 0x93, 0x23, 0x9F, 0x23, 0xAB,
+    0x23, 0xB7, 0x23, 0x46, 0x04, 0x07, 0x1A, 0x1B, 0x08, 0x1D, 0x82, 0x6E, 0x64, 0x68, 0x00, 0x43,
+    0x18, 0x19, 0x1C, 0x85, 0x76, 0x79, 0x75, 0x66, 0x6E, 0x68, 0x00, 0x45, 0x16, 0x1A, 0x12, 0x0F,
+    0x1C, 0x83, 0x68, 0x73, 0x6E, 0x68, 0x00, 0x47, 0x18, 0x06, 0x0A, 0x12, 0x15, 0x12, 0x13, 0x82,
+    0x6E, 0x74, 0x68, 0x00, 0x03, 0x0E, 0x15, 0x19, 0xCE, 0x23, 0xD6, 0x23, 0xE7, 0x23, 0x43, 0x0E,
+    0x1B, 0x0D, 0x81, 0x68, 0x6F, 0x00, 0x47, 0x07, 0x0F, 0x0B, 0x1D, 0x14, 0x10, 0x2C, 0x86, 0x68,
+    0x7A, 0x6C, 0x64, 0x72, 0x6F, 0x68, 0x00, 0x47, 0x16, 0x0C, 0x11, 0x04, 0x0C, 0x1D, 0x0E, 0x81,
+    0x68, 0x6F, 0x00, 0x02, 0x0D, 0x14, 0xFA, 0x23, 0x08, 0x24, 0x45, 0x17, 0x1C, 0x0E, 0x16, 0x2C,
+    0x85, 0x79, 0x6B, 0x74, 0x6A, 0x70, 0x68, 0x00, 0x43, 0x11, 0x14, 0x1C, 0x82, 0x70, 0x71, 0x68,
+    0x00, 0x04, 0x08, 0x0A, 0x0C, 0x0D, 0x1E, 0x24, 0x29, 0x24, 0x34, 0x24, 0x47, 0x24, 0x46, 0x1B,
+    0x17, 0x0B, 0x0E, 0x07, 0x1D, 0x81, 0x68, 0x71, 0x00, 0x44, 0x06, 0x09, 0x0D, 0x13, 0x83, 0x67,
+    0x63, 0x71, 0x68, 0x00, 0x47, 0x14, 0x08, 0x06, 0x0D, 0x1B, 0x0B, 0x08, 0x88, 0x78, 0x68, 0x6A,
+    0x63, 0x65, 0x71, 0x69, 0x71, 0x68, 0x00, 0x45, 0x11, 0x1D, 0x13, 0x08, 0x17, 0x83, 0x6A, 0x6E,
+    0x71, 0x68, 0x00, 0x04, 0x0B, 0x18, 0x1A, 0x1C, 0x60, 0x24, 0x70, 0x24, 0x82, 0x24, 0x8E, 0x24,
+    0x45, 0x10, 0x15, 0x14, 0x11, 0x05, 0x87, 0x6E, 0x62, 0x71, 0x72, 0x6D, 0x68, 0x72, 0x68, 0x00,
+    0x46, 0x12, 0x1C, 0x08, 0x0E, 0x0B, 0x15, 0x88, 0x68, 0x72, 0x6B, 0x65, 0x79, 0x6F, 0x75, 0x72,
+    0x68, 0x00, 0x43, 0x19, 0x19, 0x0E, 0x85, 0x76, 0x6B, 0x76, 0x77, 0x72, 0x68, 0x00, 0x47, 0x18,
+    0x11, 0x0A, 0x08, 0x0E, 0x0C, 0x1D, 0x83, 0x79, 0x75, 0x72, 0x68, 0x00, 0x02, 0x07, 0x18, 0xA3,
+    0x24, 0xB7, 0x24, 0x48, 0x12, 0x1B, 0x04, 0x0B, 0x1C, 0x1D, 0x04, 0x2C, 0x88, 0x79, 0x7A, 0x68,
+    0x61, 0x78, 0x6F, 0x64, 0x73, 0x68, 0x00, 0x48, 0x14, 0x0A, 0x0C, 0x09, 0x1B, 0x09, 0x11, 0x2C,
+    0x88, 0x78, 0x66, 0x66, 0x69, 0x67, 0x71, 0x75, 0x73, 0x68, 0x00, 0x48, 0x07, 0x14, 0x0B, 0x10,
+    0x0D, 0x08, 0x1C, 0x11, 0x89, 0x79, 0x6E, 0x65, 0x6A, 0x6D, 0x68, 0x71, 0x64, 0x75, 0x68, 0x00,
+    0x02, 0x0A, 0x0E, 0xE7, 0x24, 0xF9, 0x24, 0x46, 0x15, 0x04, 0x1C, 0x0B, 0x04, 0x08, 0x88, 0x61,
+    0x65, 0x68, 0x79, 0x61, 0x72, 0x67, 0x76, 0x68, 0x00, 0x02, 0x17, 0x19, 0x00, 0x25, 0x0D, 0x25,
+    0x46, 0x18, 0x12, 0x0A, 0x1A, 0x06, 0x19, 0x83, 0x6B, 0x74, 0x76, 0x68, 0x00, 0x42, 0x04, 0x0E,
+    0x84, 0x76, 0x61, 0x6B, 0x76, 0x68, 0x00, 0x47, 0x08, 0x10, 0x13, 0x1C, 0x0C, 0x19, 0x1D, 0x85,
+    0x70, 0x79, 0x6D, 0x65, 0x77, 0x68, 0x00, 0x02, 0x13, 0x1D, 0x2E, 0x25, 0x3B, 0x25, 0x44, 0x07,
+    0x0F, 0x11, 0x2C, 0x85, 0x6C, 0x6E, 0x64, 0x70, 0x78, 0x68, 0x00, 0x44, 0x08, 0x19, 0x10, 0x2C,
+    0x85, 0x76, 0x6D, 0x65, 0x7A, 0x78, 0x68, 0x00, 0x02, 0x0A, 0x1B, 0x4F, 0x25, 0x5F, 0x25, 0x45,
+    0x18, 0x09, 0x13, 0x0A, 0x07, 0x87, 0x67, 0x64, 0x70, 0x66, 0x75, 0x67, 0x79, 0x68, 0x00, 0x47,
+    0x15, 0x06, 0x12, 0x06, 0x12, 0x13, 0x11, 0x82, 0x79, 0x78, 0x68, 0x00, 0x04, 0x10, 0x15, 0x16,
+    0x19, 0x79, 0x25, 0x83, 0x25, 0x92, 0x25, 0x9D, 0x25, 0x43, 0x15, 0x1A, 0x0A, 0x83, 0x6D, 0x72,
+    0x7A, 0x68, 0x00, 0x45, 0x12, 0x13, 0x09, 0x1C, 0x2C, 0x86, 0x66, 0x79, 0x70, 0x6F, 0x72, 0x7A,
+    0x68, 0x00, 0x45, 0x08, 0x05, 0x06, 0x1B, 0x0D, 0x82, 0x7A, 0x73, 0x68, 0x00, 0x46, 0x04, 0x16,
+    0x0A, 0x14, 0x11, 0x13, 0x88, 0x6E, 0x70, 0x71, 0x67, 0x73, 0x61, 0x76, 0x7A, 0x68, 0x00, 0x19,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14,
+    0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0xFB, 0x25, 0x09, 0x26, 0x12, 0x26, 0x65,
+    0x26, 0x70, 0x26, 0x9E, 0x26, 0xEF, 0x26, 0xFA, 0x26, 0x49, 0x27, 0x8F, 0x27, 0xB1, 0x27, 0xF0,
+    0x27, 0x21, 0x28, 0x6C, 0x28, 0x97, 0x28, 0xD5, 0x28, 0xFF, 0x28, 0x0E, 0x29, 0x30, 0x29, 0xA2,
+    0x29, 0xDF, 0x29, 0x0C, 0x2A, 0x1E, 0x2A, 0x5D, 0x2A, 0xB0, 0x2A, 0x47, 0x0F, 0x0E, 0x13, 0x1C,
+    0x13, 0x09, 0x2C, 0x83, 0x6C, 0x6B, 0x61, 0x69, 0x00, 0x44, 0x0E, 0x0F, 0x0E, 0x05, 0x81, 0x69,
+    0x62, 0x00, 0x05, 0x08, 0x10, 0x12, 0x13, 0x14, 0x22, 0x26, 0x2F, 0x26, 0x3A, 0x26, 0x49, 0x26,
+    0x58, 0x26, 0x45, 0x12, 0x13, 0x0A, 0x17, 0x16, 0x84, 0x6F, 0x70, 0x65, 0x63, 0x69, 0x00, 0x46,
+    0x15, 0x16, 0x0E, 0x15, 0x1A, 0x05, 0x81, 0x69, 0x63, 0x00, 0x47, 0x17, 0x08, 0x07, 0x1A, 0x07,
+    0x0B, 0x1A, 0x84, 0x74, 0x65, 0x6F, 0x63, 0x69, 0x00, 0x45, 0x12, 0x0C, 0x08, 0x07, 0x1D, 0x86,
+    0x65, 0x64, 0x69, 0x6F, 0x70, 0x63, 0x69, 0x00, 0x46, 0x0A, 0x0F, 0x18, 0x14, 0x0E, 0x2C, 0x83,
+    0x71, 0x67, 0x63, 0x69, 0x00, 0x44, 0x0E, 0x1B, 0x12, 0x0E, 0x83, 0x6B, 0x78, 0x64, 0x69, 0x00,
+    0x03, 0x0F, 0x1C, 0x1D, 0x7A, 0x26, 0x87, 0x26, 0x95, 0x26, 0x44, 0x14, 0x15, 0x07, 0x0C, 0x85,
+    0x72, 0x64, 0x71, 0x6C, 0x65, 0x69, 0x00, 0x46, 0x0B, 0x12, 0x1A, 0x17, 0x16, 0x2C, 0x84, 0x68,
+    0x6F, 0x79, 0x65, 0x69, 0x00, 0x44, 0x12, 0x12, 0x06, 0x18, 0x81, 0x69, 0x65, 0x00, 0x05, 0x05,
+    0x0E, 0x15, 0x18, 0x1A, 0xAE, 0x26, 0xB8, 0x26, 0xC8, 0x26, 0xD4, 0x26, 0xDF, 0x26, 0x45, 0x1B,
+    0x1C, 0x15, 0x0D, 0x10, 0x81, 0x69, 0x66, 0x00, 0x45, 0x0F, 0x1A, 0x0D, 0x08, 0x1D, 0x87, 0x65,
+    0x7A, 0x6A, 0x77, 0x6C, 0x6B, 0x66, 0x69, 0x00, 0x44, 0x06, 0x18, 0x1C, 0x1D, 0x84, 0x63, 0x75,
+    0x72, 0x66, 0x69, 0x00, 0x44, 0x15, 0x10, 0x17, 0x13, 0x83, 0x75, 0x72, 0x66, 0x69, 0x00, 0x47,
+    0x1D, 0x16, 0x19, 0x1B, 0x0A, 0x0D, 0x14, 0x85, 0x73, 0x76, 0x7A, 0x77, 0x66, 0x69, 0x00, 0x46,
+    0x13, 0x06, 0x12, 0x05, 0x12, 0x0D, 0x81, 0x69, 0x67, 0x00, 0x05, 0x05, 0x0C, 0x15, 0x16, 0x1C,
+    0x0A, 0x27, 0x13, 0x27, 0x1D, 0x27, 0x27, 0x27, 0x3A, 0x27, 0x43, 0x0F, 0x19, 0x14, 0x82, 0x68,
+    0x62, 0x69, 0x00, 0x44, 0x18, 0x0B, 0x1B, 0x0E, 0x82, 0x68, 0x69, 0x69, 0x00, 0x44, 0x0C, 0x0E,
+    0x1D, 0x0B, 0x82, 0x68, 0x72, 0x69, 0x00, 0x47, 0x1A, 0x14, 0x0D, 0x05, 0x05, 0x06, 0x09, 0x88,
+    0x62, 0x63, 0x62, 0x6A, 0x71, 0x77, 0x73, 0x68, 0x69, 0x00, 0x45, 0x14, 0x11, 0x12, 0x0A, 0x1A,
+    0x86, 0x6F, 0x67, 0x6E, 0x71, 0x79, 0x68, 0x69, 0x00, 0x02, 0x08, 0x11, 0x50, 0x27, 0x6C, 0x27,
+    0x02, 0x0C, 0x1B, 0x57, 0x27, 0x62, 0x27, 0x43, 0x07, 0x0F, 0x13, 0x84, 0x69, 0x64, 0x65, 0x69,
+    0x69, 0x00, 0x44, 0x06, 0x1B, 0x13, 0x1A, 0x82, 0x69, 0x65, 0x69, 0x00, 0x02, 0x08, 0x17, 0x73,
+    0x27, 0x81, 0x27, 0x44, 0x11, 0x1C, 0x1B, 0x0B, 0x86, 0x79, 0x78, 0x6E, 0x65, 0x6E, 0x69, 0x69,
+    0x00, 0x44, 0x07, 0x19, 0x0F, 0x1D, 0x86, 0x76, 0x6C, 0x64, 0x74, 0x6E, 0x69, 0x69, 0x00, 0x02,
+    0x11, 0x1C, 0x96, 0x27, 0xA5, 0x27, 0x46, 0x07, 0x0C, 0x08, 0x15, 0x09, 0x14, 0x85, 0x69, 0x65,
+    0x64, 0x6E, 0x6A, 0x69, 0x00, 0x46, 0x0A, 0x0F, 0x16, 0x14, 0x10, 0x0B, 0x82, 0x6A, 0x79, 0x69,
+    0x00, 0x04, 0x0D, 0x0E, 0x0F, 0x17, 0xBE, 0x27, 0xCD, 0x27, 0xD9, 0x27, 0xE4, 0x27, 0x47, 0x1C,
+    0x0A, 0x1A, 0x12, 0x1A, 0x12, 0x0F, 0x84, 0x79, 0x67, 0x6A, 0x6B, 0x69, 0x00, 0x47, 0x1D, 0x1D,
+    0x19, 0x1A, 0x0E, 0x1A, 0x0F, 0x81, 0x69, 0x6B, 0x00, 0x44, 0x0E, 0x1C, 0x1D, 0x2C, 0x83, 0x6C,
+    0x6B, 0x6B, 0x69, 0x00, 0x44, 0x05, 0x10, 0x08, 0x2C, 0x84, 0x62, 0x6D, 0x74, 0x6B, 0x69, 0x00,
+    0x03, 0x0F, 0x19, 0x1B, 0xFA, 0x27, 0x07, 0x28, 0x13, 0x28, 0x44, 0x14, 0x09, 0x12, 0x12, 0x85,
+    0x66, 0x6F, 0x71, 0x6C, 0x6C, 0x69, 0x00, 0x43, 0x19, 0x0E, 0x0F, 0x85, 0x6B, 0x6C, 0x76, 0x76,
+    0x6C, 0x69, 0x00, 0x44, 0x16, 0x12, 0x04, 0x11, 0x86, 0x61, 0x6E, 0x6F, 0x73, 0x78, 0x6C, 0x69,
+    0x00, 0x04, 0x04, 0x0E, 0x15, 0x17, 0x2E, 0x28, 0x3D, 0x28, 0x4C, 0x28, 0x5B, 0x28, 0x46, 0x19,
+    0x04, 0x05, 0x19, 0x07, 0x0A, 0x85, 0x61, 0x62, 0x76, 0x61, 0x6E, 0x69, 0x00, 0x47, 0x16, 0x18,
+    0x09, 0x13, 0x14, 0x0A, 0x19, 0x84, 0x73, 0x75, 0x6B, 0x6E, 0x69, 0x00, 0x45, 0x17, 0x19, 0x0F,
+    0x1D, 0x1A, 0x86, 0x6C, 0x7A, 0x76, 0x74, 0x72, 0x6E, 0x69, 0x00, 0x47, 0x0C, 0x0B, 0x15, 0x09,
+    0x12, 0x17, 0x0A, 0x86, 0x72, 0x66, 0x68, 0x69, 0x74, 0x6E, 0x69, 0x00, 0x03, 0x08, 0x16, 0x18,
+    0x76, 0x28, 0x81, 0x28, 0x8D, 0x28, 0x44, 0x16, 0x18, 0x0C, 0x13, 0x83, 0x65, 0x73, 0x6F, 0x69,
+    0x00, 0x47, 0x19, 0x13, 0x0B, 0x0B, 0x11, 0x11, 0x0A, 0x81, 0x69, 0x6F, 0x00, 0x45, 0x16, 0x10,
+    0x18, 0x15, 0x2C, 0x81, 0x69, 0x6F, 0x00, 0x04, 0x04, 0x06, 0x16, 0x19, 0xA4, 0x28, 0xB0, 0x28,
+    0xBE, 0x28, 0xCA, 0x28, 0x44, 0x12, 0x04, 0x19, 0x2C, 0x84, 0x6F, 0x61, 0x61, 0x70, 0x69, 0x00,
+    0x44, 0x0C, 0x1B, 0x08, 0x14, 0x86, 0x65, 0x71, 0x78, 0x69, 0x63, 0x70, 0x69, 0x00, 0x46, 0x07,
+    0x06, 0x1C, 0x04, 0x1C, 0x0B, 0x82, 0x70, 0x73, 0x69, 0x00, 0x44, 0x04, 0x13, 0x0F, 0x0F, 0x83,
+    0x76, 0x61, 0x70, 0x69, 0x00, 0x03, 0x04, 0x14, 0x1B, 0xDF, 0x28, 0xEA, 0x28, 0xF5, 0x28, 0x45,
+    0x09, 0x0B, 0x06, 0x0B, 0x0A, 0x82, 0x71, 0x61, 0x69, 0x00, 0x44, 0x0B, 0x0A, 0x10, 0x1D, 0x83,
+    0x71, 0x68, 0x71, 0x69, 0x00, 0x45, 0x0C, 0x0D, 0x07, 0x10, 0x07, 0x81, 0x69, 0x71, 0x00, 0x49,
+    0x1C, 0x07, 0x06, 0x0D, 0x08, 0x06, 0x09, 0x1D, 0x2C, 0x82, 0x72, 0x79, 0x69, 0x00, 0x02, 0x0C,
+    0x1A, 0x15, 0x29, 0x26, 0x29, 0x46, 0x0C, 0x1B, 0x17, 0x12, 0x11, 0x2C, 0x87, 0x6F, 0x6E, 0x74,
+    0x78, 0x69, 0x69, 0x73, 0x69, 0x00, 0x44, 0x07, 0x08, 0x14, 0x0D, 0x82, 0x73, 0x77, 0x69, 0x00,
+    0x07, 0x06, 0x09, 0x0F, 0x14, 0x16, 0x1A, 0x1D, 0x46, 0x29, 0x52, 0x29, 0x60, 0x29, 0x6A, 0x29,
+    0x7D, 0x29, 0x87, 0x29, 0x93, 0x29, 0x47, 0x05, 0x11, 0x19, 0x09, 0x1C, 0x12, 0x16, 0x81, 0x69,
+    0x74, 0x00, 0x46, 0x1D, 0x05, 0x1C, 0x1D, 0x1C, 0x08, 0x84, 0x7A, 0x62, 0x66, 0x74, 0x69, 0x00,
+    0x45, 0x10, 0x16, 0x19, 0x10, 0x0E, 0x81, 0x69, 0x74, 0x00, 0x47, 0x11, 0x0D, 0x17, 0x1D, 0x18,
+    0x05, 0x0E, 0x88, 0x75, 0x62, 0x7A, 0x74, 0x6A, 0x6E, 0x71, 0x74, 0x69, 0x00, 0x44, 0x1C, 0x04,
+    0x10, 0x08, 0x82, 0x74, 0x73, 0x69, 0x00, 0x43, 0x0D, 0x0F, 0x10, 0x85, 0x6C, 0x6D, 0x6A, 0x77,
+    0x74, 0x69, 0x00, 0x47, 0x06, 0x19, 0x04, 0x05, 0x1B, 0x11, 0x18, 0x84, 0x63, 0x76, 0x7A, 0x74,
+    0x69, 0x00, 0x02, 0x0B, 0x19, 0xA9, 0x29, 0xCD, 0x29, 0x02, 0x07, 0x0A, 0xB0, 0x29, 0xC2, 0x29,
+    0x47, 0x04, 0x19, 0x05, 0x16, 0x09, 0x12, 0x2C, 0x87, 0x62, 0x73, 0x76, 0x61, 0x64, 0x68, 0x75,
+    0x69, 0x00, 0x42, 0x19, 0x13, 0x85, 0x76, 0x70, 0x67, 0x68, 0x75, 0x69, 0x00, 0x46, 0x05, 0x08,
+    0x0D, 0x0D, 0x06, 0x16, 0x88, 0x63, 0x73, 0x6A, 0x6A, 0x65, 0x62, 0x76, 0x75, 0x69, 0x00, 0x03,
+    0x06, 0x10, 0x17, 0xE9, 0x29, 0xF3, 0x29, 0xFF, 0x29, 0x43, 0x0C, 0x06, 0x0A, 0x83, 0x63, 0x69,
+    0x76, 0x69, 0x00, 0x44, 0x0F, 0x1A, 0x16, 0x13, 0x84, 0x6C, 0x77, 0x6D, 0x76, 0x69, 0x00, 0x44,
+    0x19, 0x19, 0x0E, 0x05, 0x85, 0x76, 0x6B, 0x76, 0x74, 0x76, 0x69, 0x00, 0x48, 0x06, 0x0A, 0x19,
+    0x0F, 0x0A, 0x06, 0x0E, 0x2C, 0x86, 0x6C, 0x67, 0x76, 0x67, 0x63, 0x77, 0x69, 0x00, 0x05, 0x05,
+    0x08, 0x0E, 0x0F, 0x15, 0x2E, 0x2A, 0x37, 0x2A, 0x41, 0x2A, 0x4B, 0x2A, 0x54, 0x2A, 0x43, 0x0A,
+    0x1B, 0x0A, 0x82, 0x78, 0x62, 0x69, 0x00, 0x45, 0x08, 0x10, 0x1C, 0x15, 0x0F, 0x81, 0x69, 0x78,
+    0x00, 0x43, 0x15, 0x1C, 0x18, 0x83, 0x6B, 0x72, 0x78, 0x69, 0x00, 0x43, 0x07, 0x0D, 0x0C, 0x82,
+    0x78, 0x6C, 0x69, 0x00, 0x44, 0x0B, 0x15, 0x1C, 0x2C, 0x81, 0x69, 0x78, 0x00, 0x05, 0x09, 0x0A,
+    0x0F, 0x16, 0x1C, 0x6D, 0x2A, 0x78, 0x2A, 0x86, 0x2A, 0x8F, 0x2A, 0xA1, 0x2A, 0x44, 0x0E, 0x0E,
+    0x14, 0x2C, 0x83, 0x66, 0x6B, 0x79, 0x69, 0x00, 0x47, 0x1B, 0x11, 0x0E, 0x04, 0x14, 0x0E, 0x2C,
+    0x83, 0x67, 0x78, 0x79, 0x69, 0x00, 0x43, 0x0C, 0x0C, 0x09, 0x82, 0x79, 0x6C, 0x69, 0x00, 0x47,
+    0x17, 0x18, 0x0E, 0x1C, 0x06, 0x10, 0x07, 0x87, 0x79, 0x63, 0x6B, 0x75, 0x74, 0x73, 0x79, 0x69,
+    0x00, 0x45, 0x1C, 0x10, 0x0F, 0x0D, 0x18, 0x86, 0x6C, 0x6A, 0x6D, 0x79, 0x79, 0x79, 0x69, 0x00,
+    0x02, 0x05, 0x06, 0xB7, 0x2A, 0xC0, 0x2A, 0x44, 0x0A, 0x0D, 0x1C, 0x2C, 0x81, 0x69, 0x7A, 0x00,
+    0x43, 0x04, 0x08, 0x1D, 0x83, 0x63, 0x61, 0x7A, 0x69, 0x00, 0x19, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x19, 0x1A, 0x1B, 0x1C, 0x16, 0x2B, 0x20, 0x2B, 0x55, 0x2B, 0x9B, 0x2B, 0xEB, 0x2B, 0x29, 0x2C,
+    0x88, 0x2C, 0xC2, 0x2C, 0xD5, 0x2C, 0xFD, 0x2C, 0x38, 0x2D, 0x91, 0x2D, 0xDB, 0x2D, 0xE4, 0x2D,
+    0x05, 0x2E, 0x53, 0x2E, 0x9E, 0x2E, 0xCF, 0x2E, 0x0F, 0x2F, 0x1F, 0x2F, 0x40, 0x2F, 0x60, 0x2F,
+    0x85, 0x2F, 0xBC, 0x2F, 0xFE, 0x2F, 0x44, 0x08, 0x1B, 0x19, 0x17, 0x82, 0x61, 0x65, 0x6A, 0x00,
+    0x02, 0x13, 0x1A, 0x27, 0x2B, 0x39, 0x2B, 0x47, 0x07, 0x13, 0x16, 0x1A, 0x11, 0x11, 0x1B, 0x87,
+    0x77, 0x6E, 0x73, 0x70, 0x64, 0x70, 0x62, 0x6A, 0x00, 0x02, 0x05, 0x0E, 0x40, 0x2B, 0x4B, 0x2B,
+    0x45, 0x14, 0x10, 0x0E, 0x18, 0x11, 0x82, 0x62, 0x77, 0x6A, 0x00, 0x43, 0x16, 0x10, 0x17, 0x83,
+    0x77, 0x6B, 0x62, 0x6A, 0x00, 0x04, 0x0A, 0x0B, 0x0E, 0x1C, 0x62, 0x2B, 0x6E, 0x2B, 0x7E, 0x2B,
+    0x8F, 0x2B, 0x45, 0x0C, 0x0B, 0x1A, 0x0E, 0x0E, 0x83, 0x67, 0x69, 0x63, 0x6A, 0x00, 0x45, 0x1C,
+    0x0F, 0x1D, 0x09, 0x13, 0x87, 0x66, 0x70, 0x7A, 0x6C, 0x79, 0x68, 0x63, 0x6A, 0x00, 0x47, 0x06,
+    0x18, 0x0C, 0x16, 0x0A, 0x0C, 0x2C, 0x86, 0x69, 0x73, 0x75, 0x63, 0x6B, 0x63, 0x6A, 0x00, 0x46,
+    0x0A, 0x19, 0x1D, 0x19, 0x0A, 0x1A, 0x82, 0x63, 0x79, 0x6A, 0x00, 0x04, 0x07, 0x11, 0x14, 0x1B,
+    0xA8, 0x2B, 0xB6, 0x2B, 0xC2, 0x2B, 0xDD, 0x2B, 0x45, 0x17, 0x0C, 0x09, 0x16, 0x10, 0x85, 0x69,
+    0x66, 0x74, 0x64, 0x64, 0x6A, 0x00, 0x45, 0x0C, 0x04, 0x1C, 0x18, 0x07, 0x83, 0x6E, 0x69, 0x64,
+    0x6A, 0x00, 0x02, 0x16, 0x1A, 0xC9, 0x2B, 0xD3, 0x2B, 0x42, 0x0B, 0x05, 0x84, 0x73, 0x68, 0x71,
+    0x64, 0x6A, 0x00, 0x45, 0x06, 0x18, 0x0B, 0x0C, 0x1C, 0x81, 0x6A, 0x64, 0x00, 0x44, 0x04, 0x0D,
+    0x0E, 0x19, 0x86, 0x6B, 0x76, 0x6A, 0x61, 0x78, 0x64, 0x6A, 0x00, 0x03, 0x0C, 0x11, 0x14, 0xF5,
+    0x2B, 0x06, 0x2C, 0x18, 0x2C, 0x46, 0x09, 0x19, 0x1B, 0x0F, 0x0A, 0x04, 0x87, 0x6C, 0x67, 0x78,
+    0x76, 0x66, 0x69, 0x65, 0x6A, 0x00, 0x47, 0x13, 0x0D, 0x0E, 0x15, 0x13, 0x0D, 0x0D, 0x87, 0x72,
+    0x70, 0x6B, 0x6A, 0x70, 0x6E, 0x65, 0x6A, 0x00, 0x46, 0x19, 0x12, 0x0E, 0x08, 0x18, 0x0A, 0x87,
+    0x65, 0x75, 0x6B, 0x6F, 0x76, 0x71, 0x65, 0x6A, 0x00, 0x04, 0x0A, 0x10, 0x14, 0x17, 0x36, 0x2C,
+    0x47, 0x2C, 0x58, 0x2C, 0x65, 0x2C, 0x46, 0x14, 0x09, 0x0F, 0x13, 0x1B, 0x2C, 0x87, 0x70, 0x78,
+    0x6C, 0x66, 0x71, 0x67, 0x66, 0x6A, 0x00, 0x46, 0x0F, 0x19, 0x09, 0x16, 0x0F, 0x10, 0x87, 0x73,
+    0x6C, 0x66, 0x76, 0x6C, 0x6D, 0x66, 0x6A, 0x00, 0x46, 0x0E, 0x12, 0x17, 0x0F, 0x06, 0x2C, 0x83,
+    0x71, 0x6B, 0x66, 0x6A, 0x00, 0x02, 0x0C, 0x17, 0x6C, 0x2C, 0x7B, 0x2C, 0x44, 0x18, 0x0D, 0x14,
+    0x06, 0x87, 0x71, 0x63, 0x6A, 0x75, 0x69, 0x74, 0x66, 0x6A, 0x00, 0x43, 0x13, 0x0D, 0x14, 0x86,
+    0x6A, 0x71, 0x70, 0x74, 0x74, 0x66, 0x6A, 0x00, 0x03, 0x07, 0x10, 0x15, 0x92, 0x2C, 0x9C, 0x2C,
+    0xB9, 0x2C, 0x45, 0x10, 0x12, 0x0E, 0x0C, 0x0D, 0x81, 0x6A, 0x67, 0x00, 0x02, 0x04, 0x15, 0xA3,
+    0x2C, 0xAE, 0x2C, 0x45, 0x09, 0x11, 0x14, 0x1B, 0x08, 0x82, 0x67, 0x6D, 0x6A, 0x00, 0x46, 0x0B,
+    0x14, 0x13, 0x15, 0x08, 0x10, 0x81, 0x6A, 0x67, 0x00, 0x43, 0x13, 0x14, 0x14, 0x82, 0x67, 0x72,
+    0x6A, 0x00, 0x48, 0x06, 0x1B, 0x13, 0x1C, 0x09, 0x11, 0x12, 0x2C, 0x87, 0x66, 0x6E, 0x79, 0x70,
+    0x78, 0x63, 0x68, 0x6A, 0x00, 0x41, 0x1D, 0x02, 0x10, 0x18, 0xDE, 0x2C, 0xED, 0x2C, 0x45, 0x08,
+    0x05, 0x1A, 0x18, 0x1C, 0x86, 0x62, 0x77, 0x65, 0x6D, 0x7A, 0x69, 0x6A, 0x00, 0x45, 0x0E, 0x06,
+    0x07, 0x0A, 0x12, 0x87, 0x64, 0x67, 0x63, 0x6B, 0x75, 0x7A, 0x69, 0x6A, 0x00, 0x04, 0x0A, 0x0C,
+    0x14, 0x15, 0x0A, 0x2D, 0x16, 0x2D, 0x22, 0x2D, 0x2E, 0x2D, 0x44, 0x12, 0x07, 0x1C, 0x1C, 0x84,
+    0x6F, 0x64, 0x67, 0x6A, 0x6A, 0x00, 0x44, 0x04, 0x0E, 0x0F, 0x1A, 0x84, 0x61, 0x6B, 0x69, 0x6A,
+    0x6A, 0x00, 0x43, 0x04, 0x1B, 0x11, 0x85, 0x78, 0x6E, 0x61, 0x71, 0x6A, 0x6A, 0x00, 0x44, 0x10,
+    0x13, 0x0B, 0x1B, 0x82, 0x6A, 0x72, 0x6A, 0x00, 0x05, 0x0A, 0x0C, 0x0F, 0x18, 0x1C, 0x48, 0x2D,
+    0x58, 0x2D, 0x68, 0x2D, 0x75, 0x2D, 0x85, 0x2D, 0x47, 0x13, 0x19, 0x09, 0x08, 0x08, 0x16, 0x14,
+    0x85, 0x76, 0x66, 0x70, 0x67, 0x6B, 0x6A, 0x00, 0x45, 0x12, 0x07, 0x09, 0x0C, 0x0E, 0x87, 0x69,
+    0x6B, 0x66, 0x64, 0x6F, 0x69, 0x6B, 0x6A, 0x00, 0x48, 0x14, 0x05, 0x19, 0x0E, 0x17, 0x13, 0x13,
+    0x2C, 0x81, 0x6A, 0x6B, 0x00, 0x48, 0x14, 0x04, 0x11, 0x11, 0x1B, 0x16, 0x04, 0x2C, 0x84, 0x71,
+    0x61, 0x75, 0x6B, 0x6A, 0x00, 0x43, 0x09, 0x17, 0x0C, 0x85, 0x74, 0x69, 0x66, 0x79, 0x6B, 0x6A,
+    0x00, 0x03, 0x04, 0x05, 0x1C, 0x9B, 0x2D, 0xBE, 0x2D, 0xCC, 0x2D, 0x02, 0x0B, 0x0E, 0xA2, 0x2D,
+    0xB4, 0x2D, 0x46, 0x18, 0x0F, 0x08, 0x0E, 0x04, 0x04, 0x88, 0x6B, 0x61, 0x65, 0x6C, 0x75, 0x68,
+    0x61, 0x6C, 0x6A, 0x00, 0x43, 0x11, 0x0F, 0x19, 0x83, 0x61, 0x6B, 0x6C, 0x6A, 0x00, 0x44, 0x1B,
+    0x14, 0x1A, 0x0B, 0x86, 0x77, 0x68, 0x71, 0x78, 0x62, 0x6C, 0x6A, 0x00, 0x46, 0x08, 0x1D, 0x08,
+    0x12, 0x0D, 0x17, 0x85, 0x7A, 0x65, 0x65, 0x79, 0x6C, 0x6A, 0x00, 0x44, 0x05, 0x13, 0x15, 0x16,
+    0x81, 0x6A, 0x6D, 0x00, 0x02, 0x12, 0x19, 0xEB, 0x2D, 0xFC, 0x2D, 0x47, 0x19, 0x0E, 0x05, 0x08,
+    0x16, 0x0D, 0x0E, 0x86, 0x62, 0x65, 0x6B, 0x76, 0x6F, 0x6E, 0x6A, 0x00, 0x43, 0x18, 0x0D, 0x09,
+    0x82, 0x6E, 0x76, 0x6A, 0x00, 0x05, 0x07, 0x0B, 0x0F, 0x14, 0x1D, 0x15, 0x2E, 0x20, 0x2E, 0x32,
+    0x2E, 0x3D, 0x2E, 0x45, 0x2E, 0x45, 0x05, 0x19, 0x14, 0x04, 0x2C, 0x82, 0x6F, 0x64, 0x6A, 0x00,
+    0x47, 0x0E, 0x11, 0x18, 0x1C, 0x13, 0x13, 0x16, 0x87, 0x79, 0x70, 0x75, 0x6E, 0x6B, 0x68, 0x6F,
+    0x6A, 0x00, 0x45, 0x0D, 0x13, 0x08, 0x09, 0x2C, 0x82, 0x6F, 0x6C, 0x6A, 0x00, 0x43, 0x05, 0x0C,
+    0x1C, 0x81, 0x6A, 0x6F, 0x00, 0x44, 0x1C, 0x0A, 0x0D, 0x14, 0x86, 0x6A, 0x71, 0x67, 0x79, 0x7A,
+    0x6F, 0x6A, 0x00, 0x05, 0x04, 0x06, 0x0D, 0x10, 0x1B, 0x63, 0x2E, 0x6C, 0x2E, 0x78, 0x2E, 0x88,
+    0x2E, 0x94, 0x2E, 0x43, 0x09, 0x1D, 0x0D, 0x82, 0x70, 0x61, 0x6A, 0x00, 0x44, 0x16, 0x0B, 0x18,
+    0x07, 0x84, 0x73, 0x68, 0x63, 0x70, 0x6A, 0x00, 0x47, 0x1C, 0x18, 0x1C, 0x12, 0x0D, 0x07, 0x2C,
+    0x85, 0x75, 0x79, 0x79, 0x6A, 0x70, 0x6A, 0x00, 0x43, 0x1D, 0x16, 0x11, 0x85, 0x73, 0x6E, 0x7A,
+    0x6D, 0x70, 0x6A, 0x00, 0x43, 0x17, 0x05, 0x0E, 0x83, 0x78, 0x74, 0x70, 0x6A, 0x00, 0x03, 0x05,
+    0x17, 0x1A, 0xA8, 0x2E, 0xB3, 0x2E, 0xC0, 0x2E, 0x45, 0x04, 0x1C, 0x14, 0x0C, 0x06, 0x82, 0x71,
+    0x62, 0x6A, 0x00, 0x44, 0x17, 0x08, 0x1B, 0x04, 0x85, 0x65, 0x78, 0x74, 0x74, 0x71, 0x6A, 0x00,
+    0x45, 0x09, 0x10, 0x06, 0x14, 0x2C, 0x86, 0x63, 0x71, 0x6D, 0x66, 0x77, 0x71, 0x6A, 0x00, 0x04,
+    0x05, 0x0E, 0x1B, 0x1D, 0xDC, 0x2E, 0xED, 0x2E, 0xFD, 0x2E, 0x07, 0x2F, 0x47, 0x14, 0x0C, 0x1B,
+    0x04, 0x15, 0x08, 0x0C, 0x86, 0x78, 0x61, 0x69, 0x71, 0x62, 0x72, 0x6A, 0x00, 0x46, 0x04, 0x19,
+    0x11, 0x0C, 0x0F, 0x1B, 0x86, 0x6E, 0x69, 0x76, 0x61, 0x6B, 0x72, 0x6A, 0x00, 0x43, 0x10, 0x07,
+    0x1D, 0x83, 0x78, 0x6D, 0x72, 0x6A, 0x00, 0x43, 0x1D, 0x19, 0x17, 0x81, 0x6A, 0x72, 0x00, 0x47,
+    0x0F, 0x07, 0x14, 0x09, 0x0F, 0x07, 0x05, 0x85, 0x71, 0x66, 0x64, 0x6C, 0x73, 0x6A, 0x00, 0x02,
+    0x05, 0x07, 0x26, 0x2F, 0x36, 0x2F, 0x47, 0x17, 0x11, 0x0D, 0x1C, 0x16, 0x1B, 0x18, 0x85, 0x6E,
+    0x6A, 0x74, 0x62, 0x74, 0x6A, 0x00, 0x44, 0x12, 0x0E, 0x09, 0x15, 0x82, 0x74, 0x64, 0x6A, 0x00,
+    0x02, 0x07, 0x1A, 0x47, 0x2F, 0x54, 0x2F, 0x45, 0x17, 0x0E, 0x0B, 0x0C, 0x10, 0x84, 0x74, 0x6B,
+    0x64, 0x75, 0x6A, 0x00, 0x44, 0x0B, 0x1D, 0x05, 0x05, 0x84, 0x68, 0x7A, 0x77, 0x75, 0x6A, 0x00,
+    0x02, 0x08, 0x19, 0x67, 0x2F, 0x73, 0x2F, 0x44, 0x10, 0x1B, 0x10, 0x16, 0x84, 0x6D, 0x78, 0x65,
+    0x76, 0x6A, 0x00, 0x46, 0x18, 0x18, 0x0C, 0x1C, 0x1A, 0x07, 0x88, 0x77, 0x64, 0x79, 0x69, 0x75,
+    0x75, 0x76, 0x76, 0x6A, 0x00, 0x03, 0x07, 0x0B, 0x0D, 0x8F, 0x2F, 0xA2, 0x2F, 0xB0, 0x2F, 0x48,
+    0x0B, 0x14, 0x0B, 0x16, 0x0E, 0x14, 0x10, 0x2C, 0x87, 0x73, 0x6B, 0x68, 0x71, 0x68, 0x64, 0x77,
+    0x6A, 0x00, 0x44, 0x1C, 0x15, 0x06, 0x05, 0x86, 0x63, 0x62, 0x72, 0x79, 0x68, 0x77, 0x6A, 0x00,
+    0x47, 0x16, 0x09, 0x0C, 0x13, 0x0B, 0x15, 0x07, 0x81, 0x6A, 0x77, 0x00, 0x04, 0x06, 0x0D, 0x1C,
+    0x1D, 0xC9, 0x2F, 0xD4, 0x2F, 0xE1, 0x2F, 0xF4, 0x2F, 0x46, 0x09, 0x11, 0x0B, 0x12, 0x1B, 0x0C,
+    0x81, 0x6A, 0x78, 0x00, 0x47, 0x14, 0x04, 0x10, 0x08, 0x18, 0x13, 0x06, 0x82, 0x78, 0x6A, 0x6A,
+    0x00, 0x48, 0x08, 0x0E, 0x12, 0x14, 0x07, 0x13, 0x1D, 0x2C, 0x87, 0x71, 0x64, 0x6F, 0x6B, 0x65,
+    0x79, 0x78, 0x6A, 0x00, 0x43, 0x12, 0x07, 0x11, 0x83, 0x7A, 0x6F, 0x78, 0x6A, 0x00, 0x02, 0x07,
+    0x12, 0x05, 0x30, 0x13, 0x30, 0x45, 0x12, 0x1B, 0x07, 0x17, 0x2C, 0x85, 0x78, 0x64, 0x6F, 0x64,
+    0x79, 0x6A, 0x00, 0x45, 0x15, 0x07, 0x0F, 0x0E, 0x2C, 0x83, 0x6F, 0x72, 0x79, 0x6A, 0x00, 0x19,
+    0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14,
+    0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x6B, 0x30, 0x7C, 0x30, 0x98, 0x30, 0xA9,
+    0x30, 0xB7, 0x30, 0x0B, 0x31, 0x5F, 0x31, 0x71, 0x31, 0xBA, 0x31, 0xF8, 0x31, 0x06, 0x32, 0x29,
+    0x32, 0x6E, 0x32, 0xA9, 0x32, 0xEB, 0x32, 0xF6, 0x32, 0x21, 0x33, 0x4D, 0x33, 0xBE, 0x33, 0xF0,
+    0x33, 0x2A, 0x34, 0x5F, 0x34, 0x72, 0x34, 0xBC, 0x34, 0xE0, 0x34, 0x48, 0x15, 0x08, 0x17, 0x04,
+    0x1C, 0x1D, 0x09, 0x08, 0x85, 0x74, 0x61, 0x65, 0x72, 0x61, 0x6B, 0x00, 0x02, 0x09, 0x14, 0x83,
+    0x30, 0x8E, 0x30, 0x45, 0x1C, 0x1C, 0x10, 0x16, 0x0B, 0x82, 0x62, 0x66, 0x6B, 0x00, 0x44, 0x13,
+    0x17, 0x16, 0x2C, 0x82, 0x62, 0x71, 0x6B, 0x00, 0x47, 0x13, 0x17, 0x0C, 0x11, 0x0B, 0x06, 0x04,
+    0x86, 0x6E, 0x68, 0x69, 0x74, 0x70, 0x63, 0x6B, 0x00, 0x48, 0x13, 0x12, 0x12, 0x1B, 0x11, 0x06,
+    0x13, 0x2C, 0x82, 0x64, 0x70, 0x6B, 0x00, 0x05, 0x0B, 0x0C, 0x0F, 0x12, 0x1C, 0xC7, 0x30, 0xD5,
+    0x30, 0xE0, 0x30, 0xED, 0x30, 0xF8, 0x30, 0x47, 0x04, 0x1C, 0x10, 0x06, 0x0A, 0x17, 0x0D, 0x83,
+    0x68, 0x61, 0x65, 0x6B, 0x00, 0x44, 0x0F, 0x0F, 0x17, 0x2C, 0x83, 0x69, 0x6C, 0x65, 0x6B, 0x00,
+    0x44, 0x15, 0x1A, 0x09, 0x0E, 0x85, 0x77, 0x66, 0x72, 0x6C, 0x65, 0x6B, 0x00, 0x44, 0x0F, 0x0E,
+    0x15, 0x2C, 0x83, 0x6F, 0x6C, 0x65, 0x6B, 0x00, 0x47, 0x16, 0x0E, 0x0E, 0x12, 0x12, 0x08, 0x19,
+    0x88, 0x6F, 0x65, 0x6F, 0x6B, 0x6B, 0x73, 0x79, 0x65, 0x6B, 0x00, 0x04, 0x05, 0x06, 0x14, 0x15,
+    0x18, 0x31, 0x25, 0x31, 0x34, 0x31, 0x46, 0x31, 0x47, 0x19, 0x04, 0x11, 0x1B, 0x07, 0x1B, 0x0B,
+    0x82, 0x66, 0x62, 0x6B, 0x00, 0x45, 0x06, 0x1C, 0x0E, 0x09, 0x15, 0x86, 0x6B, 0x66, 0x79, 0x63,
+    0x63, 0x66, 0x6B, 0x00, 0x46, 0x17, 0x1A, 0x0B, 0x0A, 0x12, 0x1C, 0x88, 0x6F, 0x79, 0x67, 0x68,
+    0x77, 0x74, 0x71, 0x66, 0x6B, 0x00, 0x02, 0x0C, 0x15, 0x4D, 0x31, 0x58, 0x31, 0x43, 0x0B, 0x0B,
+    0x09, 0x84, 0x69, 0x68, 0x72, 0x66, 0x6B, 0x00, 0x42, 0x0D, 0x09, 0x81, 0x6B, 0x66, 0x00, 0x48,
+    0x17, 0x19, 0x07, 0x0C, 0x18, 0x05, 0x08, 0x09, 0x86, 0x69, 0x75, 0x64, 0x76, 0x74, 0x67, 0x6B,
+    0x00, 0x02, 0x0E, 0x10, 0x78, 0x31, 0x97, 0x31, 0x02, 0x0B, 0x13, 0x7F, 0x31, 0x8F, 0x31, 0x46,
+    0x13, 0x07, 0x17, 0x16, 0x0B, 0x1C, 0x86, 0x64, 0x74, 0x70, 0x68, 0x6B, 0x68, 0x6B, 0x00, 0x42,
+    0x16, 0x1D, 0x82, 0x68, 0x6B, 0x6B, 0x00, 0x02, 0x0E, 0x19, 0x9E, 0x31, 0xAA, 0x31, 0x45, 0x18,
+    0x11, 0x0B, 0x14, 0x10, 0x83, 0x6D, 0x6B, 0x68, 0x6B, 0x00, 0x46, 0x1C, 0x1C, 0x0B, 0x09, 0x10,
+    0x1C, 0x86, 0x79, 0x68, 0x79, 0x76, 0x6D, 0x68, 0x6B, 0x00, 0x04, 0x0A, 0x0F, 0x12, 0x1A, 0xC7,
+    0x31, 0xD6, 0x31, 0xE1, 0x31, 0xEC, 0x31, 0x47, 0x1C, 0x15, 0x1A, 0x0B, 0x09, 0x1D, 0x2C, 0x84,
+    0x79, 0x72, 0x67, 0x69, 0x6B, 0x00, 0x45, 0x11, 0x14, 0x07, 0x0E, 0x18, 0x82, 0x69, 0x6C, 0x6B,
+    0x00, 0x43, 0x0A, 0x13, 0x05, 0x84, 0x67, 0x70, 0x6F, 0x69, 0x6B, 0x00, 0x47, 0x19, 0x05, 0x19,
+    0x1B, 0x1C, 0x18, 0x1A, 0x81, 0x6B, 0x69, 0x00, 0x45, 0x04, 0x0C, 0x11, 0x1D, 0x19, 0x85, 0x6E,
+    0x7A, 0x69, 0x61, 0x6B, 0x6B, 0x00, 0x02, 0x04, 0x17, 0x0D, 0x32, 0x1E, 0x32, 0x47, 0x1C, 0x05,
+    0x0C, 0x10, 0x06, 0x0C, 0x2C, 0x86, 0x69, 0x6D, 0x62, 0x79, 0x61, 0x6C, 0x6B, 0x00, 0x44, 0x1D,
+    0x06, 0x17, 0x06, 0x83, 0x74, 0x7A, 0x6C, 0x6B, 0x00, 0x04, 0x05, 0x0A, 0x17, 0x18, 0x36, 0x32,
+    0x43, 0x32, 0x54, 0x32, 0x60, 0x32, 0x47, 0x14, 0x1C, 0x12, 0x13, 0x11, 0x05, 0x15, 0x82, 0x6D,
+    0x62, 0x6B, 0x00, 0x46, 0x06, 0x17, 0x10, 0x0F, 0x09, 0x2C, 0x87, 0x6C, 0x66, 0x6D, 0x74, 0x63,
+    0x67, 0x6D, 0x6B, 0x00, 0x43, 0x11, 0x05, 0x1C, 0x85, 0x62, 0x79, 0x6E, 0x74, 0x6D, 0x6B, 0x00,
+    0x45, 0x16, 0x13, 0x05, 0x08, 0x16, 0x85, 0x70, 0x62, 0x73, 0x75, 0x6D, 0x6B, 0x00, 0x04, 0x0E,
+    0x10, 0x15, 0x18, 0x7B, 0x32, 0x88, 0x32, 0x93, 0x32, 0x9E, 0x32, 0x45, 0x04, 0x0F, 0x0F, 0x17,
+    0x06, 0x84, 0x61, 0x6C, 0x6B, 0x6E, 0x6B, 0x00, 0x46, 0x0A, 0x08, 0x14, 0x17, 0x0D, 0x19, 0x81,
+    0x6B, 0x6E, 0x00, 0x46, 0x10, 0x0D, 0x07, 0x0D, 0x17, 0x10, 0x81, 0x6B, 0x6E, 0x00, 0x45, 0x13,
+    0x10, 0x0D, 0x07, 0x0B, 0x82, 0x6E, 0x75, 0x6B, 0x00, 0x04, 0x05, 0x07, 0x0C, 0x11, 0xB6, 0x32,
+    0xC3, 0x32, 0xCF, 0x32, 0xDC, 0x32, 0x44, 0x05, 0x11, 0x1B, 0x0B, 0x85, 0x6E, 0x78, 0x62, 0x62,
+    0x6F, 0x6B, 0x00, 0x47, 0x10, 0x10, 0x16, 0x0C, 0x12, 0x16, 0x1A, 0x81, 0x6B, 0x6F, 0x00, 0x45,
+    0x0A, 0x12, 0x04, 0x0B, 0x2C, 0x84, 0x67, 0x6F, 0x69, 0x6F, 0x6B, 0x00, 0x46, 0x12, 0x04, 0x1B,
+    0x12, 0x1A, 0x06, 0x85, 0x61, 0x78, 0x6F, 0x6E, 0x6F, 0x6B, 0x00, 0x45, 0x08, 0x08, 0x0F, 0x16,
+    0x2C, 0x82, 0x70, 0x65, 0x6B, 0x00, 0x03, 0x05, 0x12, 0x1A, 0x00, 0x33, 0x09, 0x33, 0x12, 0x33,
+    0x43, 0x0D, 0x18, 0x11, 0x82, 0x71, 0x62, 0x6B, 0x00, 0x44, 0x07, 0x06, 0x1A, 0x04, 0x81, 0x6B,
+    0x71, 0x00, 0x46, 0x19, 0x14, 0x0B, 0x05, 0x10, 0x07, 0x85, 0x71, 0x68, 0x76, 0x77, 0x71, 0x6B,
+    0x00, 0x03, 0x0A, 0x14, 0x1B, 0x2B, 0x33, 0x3B, 0x33, 0x45, 0x33, 0x45, 0x06, 0x1A, 0x06, 0x11,
+    0x0A, 0x87, 0x6E, 0x67, 0x63, 0x77, 0x63, 0x67, 0x72, 0x6B, 0x00, 0x45, 0x14, 0x12, 0x07, 0x0D,
+    0x14, 0x81, 0x6B, 0x72, 0x00, 0x43, 0x19, 0x05, 0x06, 0x81, 0x6B, 0x72, 0x00, 0x06, 0x08, 0x0B,
+    0x11, 0x12, 0x15, 0x1A, 0x60, 0x33, 0x73, 0x33, 0x84, 0x33, 0x90, 0x33, 0xA2, 0x33, 0xB0, 0x33,
+    0x48, 0x14, 0x1D, 0x1B, 0x08, 0x0D, 0x15, 0x0C, 0x2C, 0x87, 0x65, 0x6A, 0x78, 0x7A, 0x71, 0x65,
+    0x73, 0x6B, 0x00, 0x46, 0x15, 0x0A, 0x0C, 0x0C, 0x17, 0x1A, 0x87, 0x69, 0x74, 0x69, 0x67, 0x72,
+    0x68, 0x73, 0x6B, 0x00, 0x44, 0x16, 0x12, 0x12, 0x2C, 0x84, 0x73, 0x6F, 0x6E, 0x73, 0x6B, 0x00,
+    0x46, 0x17, 0x17, 0x0A, 0x19, 0x0F, 0x17, 0x88, 0x6C, 0x74, 0x76, 0x67, 0x74, 0x74, 0x6F, 0x73,
+    0x6B, 0x00, 0x46, 0x18, 0x0F, 0x0A, 0x1A, 0x17, 0x0E, 0x84, 0x75, 0x6C, 0x72, 0x73, 0x6B, 0x00,
+    0x45, 0x0F, 0x11, 0x0F, 0x1B, 0x05, 0x85, 0x6E, 0x6C, 0x6C, 0x77, 0x73, 0x6B, 0x00, 0x02, 0x0C,
+    0x12, 0xC5, 0x33, 0xD1, 0x33, 0x45, 0x0A, 0x15, 0x04, 0x1C, 0x08, 0x83, 0x69, 0x67, 0x74, 0x6B,
+    0x00, 0x02, 0x15, 0x1B, 0xD8, 0x33, 0xE5, 0x33, 0x46, 0x16, 0x0F, 0x1D, 0x0D, 0x14, 0x2C, 0x83,
+    0x6F, 0x72, 0x74, 0x6B, 0x00, 0x42, 0x0B, 0x1B, 0x85, 0x68, 0x78, 0x78, 0x6F, 0x74, 0x6B, 0x00,
+    0x04, 0x05, 0x07, 0x14, 0x17, 0xFD, 0x33, 0x08, 0x34, 0x13, 0x34, 0x1D, 0x34, 0x44, 0x04, 0x12,
+    0x0B, 0x13, 0x83, 0x62, 0x61, 0x75, 0x6B, 0x00, 0x45, 0x0F, 0x08, 0x10, 0x13, 0x06, 0x82, 0x75,
+    0x64, 0x6B, 0x00, 0x43, 0x0D, 0x0C, 0x0B, 0x83, 0x71, 0x6A, 0x75, 0x6B, 0x00, 0x46, 0x05, 0x1C,
+    0x0F, 0x1D, 0x0C, 0x0D, 0x83, 0x74, 0x62, 0x75, 0x6B, 0x00, 0x02, 0x04, 0x18, 0x31, 0x34, 0x53,
+    0x34, 0x02, 0x05, 0x18, 0x38, 0x34, 0x43, 0x34, 0x44, 0x12, 0x1D, 0x12, 0x2C, 0x83, 0x61, 0x62,
+    0x76, 0x6B, 0x00, 0x47, 0x04, 0x10, 0x19, 0x1D, 0x17, 0x10, 0x2C, 0x85, 0x61, 0x6D, 0x75, 0x61,
+    0x76, 0x6B, 0x00, 0x45, 0x0B, 0x08, 0x19, 0x13, 0x15, 0x83, 0x75, 0x68, 0x76, 0x6B, 0x00, 0x47,
+    0x04, 0x0C, 0x06, 0x1B, 0x0E, 0x1C, 0x15, 0x88, 0x79, 0x72, 0x6B, 0x78, 0x63, 0x69, 0x61, 0x77,
+    0x6B, 0x00, 0x05, 0x07, 0x0C, 0x12, 0x18, 0x19, 0x82, 0x34, 0x8C, 0x34, 0x96, 0x34, 0xA2, 0x34,
+    0xB2, 0x34, 0x44, 0x12, 0x0C, 0x14, 0x14, 0x82, 0x78, 0x64, 0x6B, 0x00, 0x43, 0x10, 0x16, 0x08,
+    0x83, 0x69, 0x6D, 0x78, 0x6B, 0x00, 0x46, 0x15, 0x15, 0x06, 0x14, 0x0C, 0x12, 0x82, 0x78, 0x6F,
+    0x6B, 0x00, 0x46, 0x0D, 0x1C, 0x1D, 0x07, 0x1B, 0x2C, 0x86, 0x7A, 0x64, 0x79, 0x6A, 0x75, 0x78,
+    0x6B, 0x00, 0x45, 0x18, 0x07, 0x12, 0x08, 0x0E, 0x81, 0x6B, 0x78, 0x00, 0x02, 0x06, 0x11, 0xC3,
+    0x34, 0xCF, 0x34, 0x44, 0x0D, 0x0E, 0x07, 0x1D, 0x84, 0x6A, 0x6B, 0x63, 0x79, 0x6B, 0x00, 0x47,
+    0x10, 0x08, 0x11, 0x19, 0x0D, 0x0C, 0x18, 0x86, 0x6E, 0x76, 0x65, 0x6D, 0x6E, 0x79, 0x6B, 0x00,
+    0x03, 0x0F, 0x18, 0x1D, 0xEA, 0x34, 0xF6, 0x34, 0x04, 0x35, 0x44, 0x07, 0x0A, 0x12, 0x08, 0x84,
+    0x64, 0x67, 0x6C, 0x7A, 0x6B, 0x00, 0x48, 0x06, 0x06, 0x0C, 0x16, 0x17, 0x0D, 0x0C, 0x2C, 0x82,
+    0x7A, 0x75, 0x6B, 0x00, 0x43, 0x12, 0x13, 0x13, 0x81, 0x6B, 0x7A, 0x00, 0x16, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0B, 0x0C, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1A, 0x1B, 0x1C, 0x4F, 0x35, 0x80, 0x35, 0xB1, 0x35, 0xF6, 0x35, 0x4D, 0x36, 0x98, 0x36, 0xB7,
+    0x36, 0xEA, 0x36, 0x10, 0x37, 0x7D, 0x37, 0xA5, 0x37, 0xD6, 0x37, 0x3B, 0x38, 0x7B, 0x38, 0xE8,
+    0x38, 0x53, 0x39, 0x7B, 0x39, 0x90, 0x39, 0xB0, 0x39, 0x0E, 0x3A, 0x22, 0x3A, 0x30, 0x3A, 0x03,
+    0x06, 0x12, 0x17, 0x59, 0x35, 0x62, 0x35, 0x6C, 0x35, 0x44, 0x0C, 0x08, 0x14, 0x2C, 0x81, 0x6C,
+    0x62, 0x00, 0x45, 0x0A, 0x1D, 0x12, 0x1B, 0x19, 0x81, 0x6C, 0x62, 0x00, 0x47, 0x07, 0x05, 0x05,
+    0x06, 0x0C, 0x08, 0x10, 0x89, 0x65, 0x6D, 0x69, 0x63, 0x62, 0x62, 0x64, 0x74, 0x62, 0x6C, 0x00,
+    0x03, 0x0F, 0x13, 0x17, 0x8A, 0x35, 0x97, 0x35, 0xA4, 0x35, 0x46, 0x12, 0x08, 0x09, 0x17, 0x07,
+    0x19, 0x83, 0x6C, 0x6F, 0x63, 0x6C, 0x00, 0x46, 0x10, 0x0A, 0x04, 0x0D, 0x11, 0x12, 0x83, 0x70,
+    0x6D, 0x63, 0x6C, 0x00, 0x45, 0x1A, 0x19, 0x0E, 0x0C, 0x05, 0x84, 0x77, 0x76, 0x74, 0x63, 0x6C,
+    0x00, 0x04, 0x0B, 0x14, 0x15, 0x17, 0xBE, 0x35, 0xCA, 0x35, 0xD9, 0x35, 0xE9, 0x35, 0x43, 0x10,
+    0x13, 0x0C, 0x85, 0x70, 0x69, 0x6D, 0x68, 0x64, 0x6C, 0x00, 0x45, 0x04, 0x1C, 0x07, 0x0B, 0x2C,
+    0x86, 0x64, 0x68, 0x79, 0x61, 0x71, 0x64, 0x6C, 0x00, 0x47, 0x07, 0x1A, 0x07, 0x08, 0x0F, 0x14,
+    0x0A, 0x85, 0x77, 0x64, 0x64, 0x72, 0x64, 0x6C, 0x00, 0x47, 0x1A, 0x1C, 0x07, 0x1D, 0x0C, 0x07,
+    0x1C, 0x82, 0x64, 0x74, 0x6C, 0x00, 0x05, 0x04, 0x06, 0x07, 0x11, 0x1A, 0x06, 0x36, 0x18, 0x36,
+    0x24, 0x36, 0x2F, 0x36, 0x3F, 0x36, 0x47, 0x1D, 0x08, 0x1C, 0x0D, 0x0E, 0x06, 0x1B, 0x87, 0x6A,
+    0x6B, 0x79, 0x65, 0x7A, 0x61, 0x65, 0x6C, 0x00, 0x45, 0x07, 0x13, 0x0B, 0x06, 0x10, 0x83, 0x63,
+    0x64, 0x65, 0x6C, 0x00, 0x46, 0x0D, 0x04, 0x06, 0x14, 0x0A, 0x09, 0x81, 0x6C, 0x65, 0x00, 0x45,
+    0x06, 0x0F, 0x13, 0x06, 0x0F, 0x87, 0x63, 0x6C, 0x70, 0x6C, 0x63, 0x6E, 0x65, 0x6C, 0x00, 0x44,
+    0x05, 0x11, 0x11, 0x0F, 0x86, 0x6E, 0x6C, 0x6E, 0x62, 0x77, 0x65, 0x6C, 0x00, 0x04, 0x07, 0x0F,
+    0x17, 0x1A, 0x5A, 0x36, 0x67, 0x36, 0x74, 0x36, 0x7D, 0x36, 0x44, 0x07, 0x0A, 0x1C, 0x18, 0x85,
+    0x67, 0x79, 0x64, 0x64, 0x66, 0x6C, 0x00, 0x44, 0x17, 0x07, 0x10, 0x1A, 0x85, 0x64, 0x6D, 0x74,
+    0x6C, 0x66, 0x6C, 0x00, 0x44, 0x08, 0x0C, 0x05, 0x0F, 0x81, 0x6C, 0x66, 0x00, 0x02, 0x08, 0x1A,
+    0x84, 0x36, 0x8F, 0x36, 0x42, 0x14, 0x1A, 0x85, 0x71, 0x77, 0x65, 0x77, 0x66, 0x6C, 0x00, 0x43,
+    0x04, 0x06, 0x16, 0x82, 0x66, 0x77, 0x6C, 0x00, 0x02, 0x0D, 0x13, 0x9F, 0x36, 0xAD, 0x36, 0x46,
+    0x0F, 0x1D, 0x1B, 0x15, 0x1C, 0x1C, 0x84, 0x6C, 0x7A, 0x6A, 0x68, 0x6C, 0x00, 0x45, 0x10, 0x07,
+    0x08, 0x08, 0x2C, 0x81, 0x6C, 0x68, 0x00, 0x03, 0x15, 0x1B, 0x1D, 0xC1, 0x36, 0xCE, 0x36, 0xE1,
+    0x36, 0x44, 0x12, 0x1B, 0x0C, 0x13, 0x85, 0x78, 0x69, 0x6F, 0x72, 0x69, 0x6C, 0x00, 0x47, 0x13,
+    0x08, 0x0E, 0x0D, 0x10, 0x0D, 0x09, 0x88, 0x6D, 0x6A, 0x6A, 0x6B, 0x65, 0x70, 0x78, 0x69, 0x6C,
+    0x00, 0x43, 0x0E, 0x10, 0x13, 0x82, 0x69, 0x7A, 0x6C, 0x00, 0x02, 0x09, 0x15, 0xF1, 0x36, 0x05,
+    0x37, 0x48, 0x07, 0x0D, 0x09, 0x0C, 0x1D, 0x16, 0x0C, 0x2C, 0x88, 0x7A, 0x73, 0x69, 0x66, 0x6A,
+    0x64, 0x66, 0x6B, 0x6C, 0x00, 0x45, 0x0C, 0x0F, 0x15, 0x04, 0x16, 0x82, 0x6B, 0x72, 0x6C, 0x00,
+    0x06, 0x05, 0x0D, 0x15, 0x16, 0x17, 0x19, 0x23, 0x37, 0x2F, 0x37, 0x3F, 0x37, 0x4E, 0x37, 0x5B,
+    0x37, 0x6D, 0x37, 0x43, 0x1C, 0x08, 0x0C, 0x85, 0x65, 0x69, 0x79, 0x62, 0x6C, 0x6C, 0x00, 0x45,
+    0x10, 0x0B, 0x1C, 0x0D, 0x06, 0x87, 0x6A, 0x63, 0x79, 0x68, 0x6D, 0x6A, 0x6C, 0x6C, 0x00, 0x45,
+    0x13, 0x1C, 0x1A, 0x13, 0x0E, 0x86, 0x77, 0x70, 0x79, 0x70, 0x72, 0x6C, 0x6C, 0x00, 0x47, 0x10,
+    0x18, 0x04, 0x1A, 0x15, 0x11, 0x0E, 0x82, 0x6C, 0x73, 0x6C, 0x00, 0x48, 0x0B, 0x09, 0x0C, 0x1B,
+    0x1C, 0x0F, 0x0C, 0x2C, 0x86, 0x69, 0x78, 0x66, 0x68, 0x74, 0x6C, 0x6C, 0x00, 0x46, 0x0D, 0x04,
+    0x18, 0x14, 0x07, 0x19, 0x86, 0x75, 0x71, 0x61, 0x6A, 0x76, 0x6C, 0x6C, 0x00, 0x02, 0x17, 0x1C,
+    0x84, 0x37, 0x94, 0x37, 0x45, 0x09, 0x0B, 0x14, 0x0A, 0x15, 0x87, 0x67, 0x72, 0x71, 0x68, 0x66,
+    0x74, 0x6D, 0x6C, 0x00, 0x46, 0x05, 0x10, 0x11, 0x17, 0x12, 0x19, 0x87, 0x74, 0x6F, 0x6E, 0x6D,
+    0x62, 0x79, 0x6D, 0x6C, 0x00, 0x03, 0x06, 0x0F, 0x11, 0xAF, 0x37, 0xBB, 0x37, 0xC7, 0x37, 0x43,
+    0x1A, 0x19, 0x12, 0x85, 0x76, 0x6F, 0x77, 0x63, 0x6E, 0x6C, 0x00, 0x46, 0x1A, 0x0B, 0x0C, 0x05,
+    0x07, 0x19, 0x82, 0x6E, 0x6C, 0x6C, 0x00, 0x45, 0x15, 0x05, 0x06, 0x05, 0x2C, 0x86, 0x63, 0x62,
+    0x62, 0x72, 0x6E, 0x6E, 0x6C, 0x00, 0x05, 0x04, 0x07, 0x0B, 0x16, 0x19, 0xE6, 0x37, 0xF0, 0x37,
+    0xFB, 0x37, 0x0A, 0x38, 0x16, 0x38, 0x43, 0x0A, 0x12, 0x08, 0x83, 0x61, 0x67, 0x6F, 0x6C, 0x00,
+    0x44, 0x11, 0x14, 0x06, 0x0E, 0x83, 0x64, 0x6E, 0x6F, 0x6C, 0x00, 0x47, 0x04, 0x18, 0x11, 0x07,
+    0x13, 0x16, 0x09, 0x84, 0x61, 0x75, 0x68, 0x6F, 0x6C, 0x00, 0x46, 0x05, 0x08, 0x1C, 0x09, 0x10,
+    0x2C, 0x82, 0x6F, 0x73, 0x6C, 0x00, 0x02, 0x0C, 0x14, 0x1D, 0x38, 0x2F, 0x38, 0x46, 0x06, 0x0B,
+    0x19, 0x11, 0x13, 0x13, 0x88, 0x6E, 0x70, 0x76, 0x68, 0x63, 0x69, 0x76, 0x6F, 0x6C, 0x00, 0x43,
+    0x07, 0x10, 0x15, 0x85, 0x64, 0x6D, 0x71, 0x76, 0x6F, 0x6C, 0x00, 0x04, 0x10, 0x11, 0x14, 0x17,
+    0x48, 0x38, 0x57, 0x38, 0x62, 0x38, 0x6E, 0x38, 0x46, 0x07, 0x1B, 0x15, 0x0F, 0x0C, 0x2C, 0x85,
+    0x78, 0x72, 0x64, 0x6D, 0x70, 0x6C, 0x00, 0x45, 0x05, 0x17, 0x10, 0x10, 0x10, 0x82, 0x70, 0x6E,
+    0x6C, 0x00, 0x43, 0x0F, 0x11, 0x1A, 0x85, 0x6E, 0x77, 0x6C, 0x71, 0x70, 0x6C, 0x00, 0x47, 0x1D,
+    0x12, 0x10, 0x1B, 0x1B, 0x13, 0x13, 0x82, 0x70, 0x74, 0x6C, 0x00, 0x05, 0x04, 0x07, 0x12, 0x17,
+    0x1B, 0x8B, 0x38, 0xAD, 0x38, 0xBB, 0x38, 0xCD, 0x38, 0xDD, 0x38, 0x02, 0x11, 0x13, 0x92, 0x38,
+    0x9C, 0x38, 0x45, 0x15, 0x1D, 0x05, 0x14, 0x15, 0x81, 0x6C, 0x71, 0x00, 0x46, 0x0F, 0x16, 0x12,
+    0x11, 0x18, 0x0E, 0x87, 0x6F, 0x6E, 0x73, 0x6C, 0x70, 0x61, 0x71, 0x6C, 0x00, 0x45, 0x08, 0x1A,
+    0x11, 0x06, 0x2C, 0x85, 0x77, 0x6E, 0x65, 0x64, 0x71, 0x6C, 0x00, 0x47, 0x0A, 0x11, 0x16, 0x11,
+    0x0C, 0x1D, 0x2C, 0x87, 0x6E, 0x69, 0x73, 0x6E, 0x67, 0x6F, 0x71, 0x6C, 0x00, 0x45, 0x19, 0x0F,
+    0x09, 0x08, 0x0F, 0x87, 0x65, 0x6C, 0x66, 0x6C, 0x76, 0x74, 0x71, 0x6C, 0x00, 0x44, 0x11, 0x12,
+    0x05, 0x0B, 0x83, 0x78, 0x6E, 0x71, 0x6C, 0x00, 0x06, 0x0C, 0x0E, 0x0F, 0x11, 0x12, 0x16, 0xFB,
+    0x38, 0x04, 0x39, 0x0D, 0x39, 0x1A, 0x39, 0x2A, 0x39, 0x49, 0x39, 0x44, 0x17, 0x15, 0x1D, 0x2C,
+    0x81, 0x6C, 0x72, 0x00, 0x43, 0x1B, 0x11, 0x0E, 0x82, 0x72, 0x6B, 0x6C, 0x00, 0x47, 0x0A, 0x0D,
+    0x15, 0x1C, 0x0F, 0x15, 0x16, 0x82, 0x72, 0x6C, 0x6C, 0x00, 0x47, 0x07, 0x1D, 0x16, 0x1C, 0x0D,
+    0x09, 0x12, 0x85, 0x7A, 0x73, 0x64, 0x6E, 0x72, 0x6C, 0x00, 0x02, 0x0E, 0x19, 0x31, 0x39, 0x40,
+    0x39, 0x46, 0x05, 0x16, 0x11, 0x0F, 0x0E, 0x06, 0x85, 0x62, 0x73, 0x6B, 0x6F, 0x72, 0x6C, 0x00,
+    0x42, 0x0B, 0x13, 0x83, 0x6F, 0x76, 0x72, 0x6C, 0x00, 0x44, 0x1B, 0x19, 0x17, 0x06, 0x82, 0x72,
+    0x73, 0x6C, 0x00, 0x02, 0x0F, 0x11, 0x5A, 0x39, 0x68, 0x39, 0x45, 0x08, 0x09, 0x06, 0x1C, 0x08,
+    0x85, 0x66, 0x63, 0x65, 0x6C, 0x73, 0x6C, 0x00, 0x47, 0x05, 0x14, 0x1A, 0x1D, 0x0E, 0x1A, 0x2C,
+    0x88, 0x6B, 0x77, 0x7A, 0x77, 0x71, 0x62, 0x6E, 0x73, 0x6C, 0x00, 0x49, 0x07, 0x0D, 0x0C, 0x0B,
+    0x13, 0x1D, 0x17, 0x18, 0x2C, 0x88, 0x7A, 0x74, 0x70, 0x68, 0x69, 0x6A, 0x64, 0x74, 0x6C, 0x00,
+    0x02, 0x0F, 0x16, 0x97, 0x39, 0xA2, 0x39, 0x45, 0x0F, 0x0E, 0x14, 0x0B, 0x2C, 0x82, 0x75, 0x6C,
+    0x6C, 0x00, 0x47, 0x15, 0x12, 0x15, 0x09, 0x0C, 0x1C, 0x0B, 0x83, 0x73, 0x72, 0x75, 0x6C, 0x00,
+    0x06, 0x08, 0x09, 0x12, 0x16, 0x19, 0x1D, 0xC3, 0x39, 0xD0, 0x39, 0xDC, 0x39, 0xE5, 0x39, 0xF3,
+    0x39, 0xFE, 0x39, 0x46, 0x0B, 0x10, 0x16, 0x0F, 0x19, 0x16, 0x83, 0x65, 0x68, 0x76, 0x6C, 0x00,
+    0x47, 0x04, 0x0A, 0x0A, 0x19, 0x1A, 0x08, 0x05, 0x81, 0x6C, 0x76, 0x00, 0x44, 0x11, 0x17, 0x1B,
+    0x17, 0x81, 0x6C, 0x76, 0x00, 0x45, 0x1D, 0x18, 0x07, 0x1B, 0x0C, 0x85, 0x75, 0x64, 0x7A, 0x73,
+    0x76, 0x6C, 0x00, 0x44, 0x13, 0x1D, 0x14, 0x14, 0x83, 0x76, 0x70, 0x76, 0x6C, 0x00, 0x47, 0x17,
+    0x08, 0x15, 0x08, 0x0F, 0x0B, 0x0C, 0x85, 0x65, 0x72, 0x74, 0x7A, 0x76, 0x6C, 0x00, 0x48, 0x0A,
+    0x1A, 0x14, 0x11, 0x1B, 0x08, 0x1B, 0x2C, 0x88, 0x65, 0x78, 0x78, 0x6E, 0x71, 0x77, 0x67, 0x77,
+    0x6C, 0x00, 0x48, 0x0B, 0x17, 0x06, 0x14, 0x12, 0x04, 0x07, 0x13, 0x82, 0x78, 0x68, 0x6C, 0x00,
+    0x02, 0x16, 0x1B, 0x37, 0x3A, 0x43, 0x3A, 0x47, 0x05, 0x13, 0x14, 0x08, 0x0D, 0x11, 0x0F, 0x81,
+    0x6C, 0x79, 0x00, 0x43, 0x1D, 0x05, 0x17, 0x83, 0x78, 0x7A, 0x79, 0x6C, 0x00, 0x17, 0x04, 0x05,
+    0x06, 0x07, 0x08, 0x09, 0x0C, 0x0D, 0x0E, 0x0F, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+    0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x93, 0x3A, 0xB2, 0x3A, 0xFB, 0x3A, 0x23, 0x3B, 0x71, 0x3B, 0x91,
+    0x3B, 0xD0, 0x3B, 0x14, 0x3C, 0x47, 0x3C, 0x8B, 0x3C, 0xAF, 0x3C, 0x12, 0x3D, 0x40, 0x3D, 0x66,
+    0x3D, 0x83, 0x3D, 0xAE, 0x3D, 0xCB, 0x3D, 0x15, 0x3E, 0x4B, 0x3E, 0x5B, 0x3E, 0x6E, 0x3E, 0x92,
+    0x3E, 0xD9, 0x3E, 0x02, 0x05, 0x17, 0x9A, 0x3A, 0xA8, 0x3A, 0x45, 0x08, 0x16, 0x13, 0x12, 0x0A,
+    0x85, 0x73, 0x70, 0x65, 0x62, 0x61, 0x6D, 0x00, 0x44, 0x18, 0x04, 0x05, 0x2C, 0x82, 0x61, 0x74,
+    0x6D, 0x00, 0x04, 0x0F, 0x12, 0x13, 0x1C, 0xBF, 0x3A, 0xD2, 0x3A, 0xDC, 0x3A, 0xEB, 0x3A, 0x47,
+    0x10, 0x05, 0x1B, 0x19, 0x0D, 0x09, 0x10, 0x88, 0x6A, 0x66, 0x76, 0x78, 0x62, 0x6D, 0x6C, 0x62,
+    0x6D, 0x00, 0x44, 0x06, 0x11, 0x07, 0x13, 0x82, 0x62, 0x6F, 0x6D, 0x00, 0x46, 0x0B, 0x1C, 0x0C,
+    0x17, 0x19, 0x1C, 0x85, 0x79, 0x69, 0x68, 0x70, 0x62, 0x6D, 0x00, 0x45, 0x10, 0x0F, 0x16, 0x0D,
+    0x1A, 0x87, 0x6A, 0x77, 0x73, 0x6C, 0x6D, 0x79, 0x62, 0x6D, 0x00, 0x02, 0x06, 0x1C, 0x02, 0x3B,
+    0x14, 0x3B, 0x47, 0x11, 0x12, 0x04, 0x15, 0x1C, 0x0F, 0x13, 0x87, 0x72, 0x79, 0x61, 0x6F, 0x6E,
+    0x63, 0x63, 0x6D, 0x00, 0x47, 0x05, 0x13, 0x0C, 0x16, 0x07, 0x1D, 0x14, 0x84, 0x62, 0x70, 0x79,
+    0x63, 0x6D, 0x00, 0x04, 0x06, 0x08, 0x13, 0x17, 0x30, 0x3B, 0x3C, 0x3B, 0x4B, 0x3B, 0x54, 0x3B,
+    0x46, 0x06, 0x18, 0x18, 0x0B, 0x0D, 0x2C, 0x82, 0x64, 0x63, 0x6D, 0x00, 0x46, 0x08, 0x1A, 0x09,
+    0x10, 0x0C, 0x11, 0x85, 0x77, 0x66, 0x65, 0x65, 0x64, 0x6D, 0x00, 0x43, 0x16, 0x17, 0x14, 0x82,
+    0x64, 0x70, 0x6D, 0x00, 0x02, 0x13, 0x1B, 0x5B, 0x3B, 0x66, 0x3B, 0x46, 0x0F, 0x0D, 0x06, 0x19,
+    0x09, 0x13, 0x81, 0x6D, 0x64, 0x00, 0x44, 0x12, 0x07, 0x1D, 0x04, 0x83, 0x74, 0x78, 0x64, 0x6D,
+    0x00, 0x02, 0x0D, 0x1C, 0x78, 0x3B, 0x84, 0x3B, 0x43, 0x15, 0x13, 0x1D, 0x85, 0x70, 0x7A, 0x72,
+    0x6A, 0x65, 0x6D, 0x00, 0x45, 0x11, 0x10, 0x04, 0x05, 0x0B, 0x84, 0x6E, 0x6D, 0x79, 0x65, 0x6D,
+    0x00, 0x04, 0x08, 0x09, 0x15, 0x1C, 0x9E, 0x3B, 0xA7, 0x3B, 0xB3, 0x3B, 0xC0, 0x3B, 0x43, 0x0E,
+    0x1C, 0x13, 0x82, 0x66, 0x65, 0x6D, 0x00, 0x44, 0x16, 0x12, 0x06, 0x1C, 0x84, 0x73, 0x6F, 0x66,
+    0x66, 0x6D, 0x00, 0x45, 0x06, 0x0D, 0x1C, 0x06, 0x10, 0x84, 0x63, 0x6A, 0x72, 0x66, 0x6D, 0x00,
+    0x46, 0x08, 0x13, 0x05, 0x1B, 0x0E, 0x1C, 0x86, 0x62, 0x78, 0x70, 0x65, 0x79, 0x66, 0x6D, 0x00,
+    0x05, 0x07, 0x0B, 0x10, 0x19, 0x1C, 0xE0, 0x3B, 0xED, 0x3B, 0xF5, 0x3B, 0xFE, 0x3B, 0x0B, 0x3C,
+    0x44, 0x07, 0x10, 0x0A, 0x0C, 0x85, 0x6D, 0x67, 0x64, 0x64, 0x69, 0x6D, 0x00, 0x43, 0x18, 0x1C,
+    0x1C, 0x81, 0x6D, 0x69, 0x00, 0x43, 0x0A, 0x05, 0x12, 0x82, 0x69, 0x6D, 0x6D, 0x00, 0x45, 0x10,
+    0x19, 0x07, 0x11, 0x0A, 0x84, 0x6D, 0x76, 0x76, 0x69, 0x6D, 0x00, 0x44, 0x0F, 0x0A, 0x13, 0x0D,
+    0x81, 0x6D, 0x69, 0x00, 0x03, 0x07, 0x0F, 0x16, 0x1E, 0x3C, 0x2B, 0x3C, 0x3A, 0x3C, 0x45, 0x0A,
+    0x1D, 0x05, 0x0C, 0x16, 0x84, 0x67, 0x7A, 0x64, 0x6A, 0x6D, 0x00, 0x45, 0x0E, 0x07, 0x10, 0x0B,
+    0x06, 0x86, 0x6D, 0x68, 0x64, 0x6B, 0x6C, 0x6A, 0x6D, 0x00, 0x44, 0x18, 0x12, 0x05, 0x18, 0x85,
+    0x6F, 0x62, 0x75, 0x73, 0x6A, 0x6D, 0x00, 0x04, 0x06, 0x07, 0x09, 0x0D, 0x54, 0x3C, 0x67, 0x3C,
+    0x71, 0x3C, 0x7C, 0x3C, 0x47, 0x11, 0x06, 0x13, 0x09, 0x11, 0x13, 0x0F, 0x88, 0x6E, 0x70, 0x66,
+    0x70, 0x63, 0x6E, 0x63, 0x6B, 0x6D, 0x00, 0x44, 0x16, 0x1C, 0x05, 0x06, 0x82, 0x6B, 0x64, 0x6D,
+    0x00, 0x44, 0x17, 0x13, 0x13, 0x11, 0x83, 0x66, 0x74, 0x6B, 0x6D, 0x00, 0x46, 0x1C, 0x0B, 0x08,
+    0x0E, 0x08, 0x07, 0x85, 0x68, 0x65, 0x79, 0x6A, 0x6B, 0x6D, 0x00, 0x02, 0x0E, 0x10, 0x92, 0x3C,
+    0xA0, 0x3C, 0x46, 0x04, 0x09, 0x08, 0x19, 0x15, 0x15, 0x84, 0x61, 0x66, 0x6B, 0x6C, 0x6D, 0x00,
+    0x46, 0x1D, 0x08, 0x1B, 0x18, 0x09, 0x2C, 0x85, 0x65, 0x78, 0x7A, 0x6D, 0x6C, 0x6D, 0x00, 0x06,
+    0x06, 0x0A, 0x0E, 0x10, 0x11, 0x18, 0xC2, 0x3C, 0xCD, 0x3C, 0xDB, 0x3C, 0xE5, 0x3C, 0xF4, 0x3C,
+    0x06, 0x3D, 0x43, 0x13, 0x15, 0x15, 0x84, 0x70, 0x72, 0x63, 0x6E, 0x6D, 0x00, 0x47, 0x0C, 0x05,
+    0x0E, 0x1D, 0x1B, 0x1C, 0x1B, 0x83, 0x67, 0x69, 0x6E, 0x6D, 0x00, 0x44, 0x0E, 0x08, 0x0B, 0x11,
+    0x82, 0x6E, 0x6B, 0x6D, 0x00, 0x45, 0x0C, 0x0A, 0x0D, 0x05, 0x1D, 0x86, 0x6A, 0x62, 0x67, 0x69,
+    0x6D, 0x6E, 0x6D, 0x00, 0x46, 0x09, 0x05, 0x16, 0x0D, 0x1A, 0x17, 0x88, 0x77, 0x74, 0x6A, 0x73,
+    0x62, 0x66, 0x6E, 0x6E, 0x6D, 0x00, 0x44, 0x18, 0x07, 0x12, 0x1C, 0x84, 0x75, 0x64, 0x75, 0x6E,
+    0x6D, 0x00, 0x02, 0x0B, 0x0E, 0x19, 0x3D, 0x23, 0x3D, 0x43, 0x1C, 0x13, 0x18, 0x83, 0x68, 0x79,
+    0x6F, 0x6D, 0x00, 0x02, 0x09, 0x0A, 0x2A, 0x3D, 0x37, 0x3D, 0x44, 0x14, 0x15, 0x0F, 0x10, 0x85,
+    0x71, 0x72, 0x66, 0x6B, 0x6F, 0x6D, 0x00, 0x43, 0x08, 0x16, 0x0B, 0x82, 0x6F, 0x6B, 0x6D, 0x00,
+    0x02, 0x11, 0x13, 0x47, 0x3D, 0x59, 0x3D, 0x47, 0x08, 0x14, 0x10, 0x18, 0x08, 0x1B, 0x2C, 0x87,
+    0x75, 0x65, 0x6D, 0x71, 0x65, 0x6E, 0x70, 0x6D, 0x00, 0x46, 0x17, 0x19, 0x0F, 0x13, 0x15, 0x1A,
+    0x83, 0x70, 0x74, 0x70, 0x6D, 0x00, 0x02, 0x0E, 0x13, 0x6D, 0x3D, 0x75, 0x3D, 0x43, 0x14, 0x04,
+    0x09, 0x81, 0x6D, 0x71, 0x00, 0x45, 0x1A, 0x1D, 0x0D, 0x09, 0x1B, 0x85, 0x7A, 0x6A, 0x77, 0x70,
+    0x71, 0x6D, 0x00, 0x03, 0x05, 0x0F, 0x1C, 0x8D, 0x3D, 0x98, 0x3D, 0xA3, 0x3D, 0x46, 0x11, 0x0C,
+    0x1C, 0x06, 0x14, 0x15, 0x81, 0x6D, 0x72, 0x00, 0x44, 0x1C, 0x12, 0x07, 0x05, 0x83, 0x6C, 0x79,
+    0x72, 0x6D, 0x00, 0x43, 0x10, 0x12, 0x0D, 0x84, 0x6D, 0x6F, 0x79, 0x72, 0x6D, 0x00, 0x02, 0x05,
+    0x0A, 0xB5, 0x3D, 0xBF, 0x3D, 0x45, 0x15, 0x12, 0x15, 0x1B, 0x17, 0x81, 0x6D, 0x73, 0x00, 0x45,
+    0x09, 0x1B, 0x06, 0x06, 0x16, 0x83, 0x67, 0x66, 0x73, 0x6D, 0x00, 0x03, 0x08, 0x16, 0x17, 0xD5,
+    0x3D, 0xE5, 0x3D, 0xF2, 0x3D, 0x45, 0x0C, 0x0C, 0x14, 0x04, 0x12, 0x87, 0x61, 0x6F, 0x71, 0x69,
+    0x69, 0x65, 0x74, 0x6D, 0x00, 0x46, 0x04, 0x16, 0x14, 0x14, 0x0C, 0x17, 0x83, 0x73, 0x61, 0x74,
+    0x6D, 0x00, 0x02, 0x09, 0x0D, 0xF9, 0x3D, 0x08, 0x3E, 0x46, 0x0A, 0x05, 0x05, 0x05, 0x1B, 0x13,
+    0x85, 0x67, 0x62, 0x66, 0x74, 0x74, 0x6D, 0x00, 0x43, 0x11, 0x0C, 0x1D, 0x86, 0x69, 0x7A, 0x6E,
+    0x6A, 0x74, 0x74, 0x6D, 0x00, 0x03, 0x04, 0x1B, 0x1D, 0x1F, 0x3E, 0x2D, 0x3E, 0x3C, 0x3E, 0x44,
+    0x0F, 0x0B, 0x07, 0x19, 0x86, 0x64, 0x76, 0x68, 0x6C, 0x61, 0x75, 0x6D, 0x00, 0x46, 0x19, 0x19,
+    0x12, 0x1A, 0x19, 0x0B, 0x85, 0x76, 0x6F, 0x76, 0x78, 0x75, 0x6D, 0x00, 0x45, 0x1D, 0x1A, 0x12,
+    0x09, 0x1D, 0x86, 0x6F, 0x66, 0x77, 0x7A, 0x7A, 0x75, 0x6D, 0x00, 0x46, 0x1C, 0x18, 0x1C, 0x05,
+    0x0D, 0x2C, 0x86, 0x62, 0x6A, 0x79, 0x75, 0x79, 0x76, 0x6D, 0x00, 0x48, 0x0F, 0x04, 0x10, 0x13,
+    0x14, 0x04, 0x15, 0x2C, 0x87, 0x71, 0x61, 0x70, 0x6D, 0x61, 0x6C, 0x77, 0x6D, 0x00, 0x02, 0x04,
+    0x18, 0x75, 0x3E, 0x84, 0x3E, 0x47, 0x15, 0x09, 0x10, 0x08, 0x0E, 0x1D, 0x2C, 0x84, 0x72, 0x66,
+    0x61, 0x78, 0x6D, 0x00, 0x45, 0x1A, 0x08, 0x09, 0x11, 0x0E, 0x85, 0x65, 0x66, 0x77, 0x75, 0x78,
+    0x6D, 0x00, 0x03, 0x0A, 0x18, 0x19, 0x9C, 0x3E, 0xA9, 0x3E, 0xCE, 0x3E, 0x46, 0x12, 0x1A, 0x1D,
+    0x0D, 0x07, 0x13, 0x83, 0x67, 0x6F, 0x79, 0x6D, 0x00, 0x03, 0x06, 0x0A, 0x1D, 0xB3, 0x3E, 0xBB,
+    0x3E, 0xC3, 0x3E, 0x43, 0x1A, 0x0E, 0x12, 0x81, 0x6D, 0x79, 0x00, 0x42, 0x0D, 0x15, 0x82, 0x79,
+    0x75, 0x6D, 0x00, 0x45, 0x10, 0x0C, 0x1D, 0x11, 0x2C, 0x82, 0x79, 0x75, 0x6D, 0x00, 0x43, 0x1B,
+    0x07, 0x09, 0x84, 0x78, 0x64, 0x76, 0x79, 0x6D, 0x00, 0x04, 0x09, 0x11, 0x18, 0x1C, 0xE6, 0x3E,
+    0xF3, 0x3E, 0xFE, 0x3E, 0x0D, 0x3F, 0x45, 0x0A, 0x0B, 0x13, 0x13, 0x05, 0x84, 0x67, 0x68, 0x66,
+    0x7A, 0x6D, 0x00, 0x46, 0x19, 0x1A, 0x1B, 0x17, 0x11, 0x14, 0x81, 0x6D, 0x7A, 0x00, 0x45, 0x17,
+    0x05, 0x13, 0x15, 0x16, 0x86, 0x70, 0x72, 0x62, 0x74, 0x75, 0x7A, 0x6D, 0x00, 0x44, 0x06, 0x12,
+    0x0F, 0x13, 0x81, 0x6D, 0x7A, 0x00, 0x18, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x5F,
+    0x3F, 0x7D, 0x3F, 0xAB, 0x3F, 0xE2, 0x3F, 0x04, 0x40, 0x10, 0x40, 0x48, 0x40, 0x9A, 0x40, 0xD1,
+    0x40, 0xDD, 0x40, 0x22, 0x41, 0x2B, 0x41, 0x7E, 0x41, 0x9D, 0x41, 0xAE, 0x41, 0x03, 0x42, 0x2D,
+    0x42, 0x48, 0x42, 0x65, 0x42, 0x84, 0x42, 0x8D, 0x42, 0xDD, 0x42, 0x15, 0x43, 0x47, 0x43, 0x02,
+    0x08, 0x13, 0x66, 0x3F, 0x70, 0x3F, 0x45, 0x17, 0x06, 0x06, 0x0C, 0x2C, 0x81, 0x6E, 0x61, 0x00,
+    0x44, 0x16, 0x05, 0x19, 0x06, 0x85, 0x62, 0x76, 0x73, 0x70, 0x61, 0x6E, 0x00, 0x03, 0x0D, 0x15,
+    0x1C, 0x87, 0x3F, 0x96, 0x3F, 0xA2, 0x3F, 0x46, 0x04, 0x0B, 0x10, 0x06, 0x0B, 0x0C, 0x85, 0x68,
+    0x6D, 0x61, 0x6A, 0x62, 0x6E, 0x00, 0x44, 0x19, 0x1B, 0x12, 0x07, 0x84, 0x76, 0x78, 0x72, 0x62,
+    0x6E, 0x00, 0x43, 0x14, 0x17, 0x0E, 0x82, 0x62, 0x79, 0x6E, 0x00, 0x03, 0x15, 0x18, 0x19, 0xB5,
+    0x3F, 0xC2, 0x3F, 0xCF, 0x3F, 0x44, 0x06, 0x1B, 0x1C, 0x1A, 0x85, 0x78, 0x79, 0x63, 0x72, 0x63,
+    0x6E, 0x00, 0x48, 0x14, 0x17, 0x08, 0x16, 0x09, 0x15, 0x10, 0x2C, 0x81, 0x6E, 0x63, 0x00, 0x47,
+    0x08, 0x1C, 0x0B, 0x0D, 0x12, 0x1A, 0x2C, 0x88, 0x6F, 0x77, 0x6A, 0x68, 0x79, 0x65, 0x76, 0x63,
+    0x6E, 0x00, 0x02, 0x08, 0x1C, 0xE9, 0x3F, 0xF9, 0x3F, 0x47, 0x14, 0x12, 0x1D, 0x10, 0x0F, 0x16,
+    0x10, 0x85, 0x6F, 0x7A, 0x71, 0x65, 0x64, 0x6E, 0x00, 0x44, 0x0D, 0x06, 0x0F, 0x19, 0x83, 0x79,
+    0x6A, 0x64, 0x6E, 0x00, 0x45, 0x05, 0x19, 0x08, 0x08, 0x06, 0x83, 0x62, 0x76, 0x65, 0x6E, 0x00,
+    0x04, 0x04, 0x06, 0x11, 0x14, 0x1D, 0x40, 0x29, 0x40, 0x36, 0x40, 0x40, 0x40, 0x44, 0x12, 0x0B,
+    0x13, 0x08, 0x84, 0x6F, 0x68, 0x61, 0x66, 0x6E, 0x00, 0x44, 0x1D, 0x0E, 0x13, 0x0A, 0x85, 0x6B,
+    0x70, 0x7A, 0x63, 0x66, 0x6E, 0x00, 0x44, 0x08, 0x11, 0x06, 0x08, 0x82, 0x66, 0x6E, 0x6E, 0x00,
+    0x43, 0x16, 0x10, 0x0E, 0x81, 0x6E, 0x66, 0x00, 0x05, 0x0B, 0x0C, 0x10, 0x12, 0x1C, 0x58, 0x40,
+    0x68, 0x40, 0x78, 0x40, 0x80, 0x40, 0x8B, 0x40, 0x47, 0x12, 0x1D, 0x1C, 0x15, 0x16, 0x15, 0x0D,
+    0x85, 0x7A, 0x79, 0x6F, 0x68, 0x67, 0x6E, 0x00, 0x46, 0x11, 0x1B, 0x17, 0x14, 0x1C, 0x18, 0x86,
+    0x74, 0x71, 0x78, 0x6E, 0x69, 0x67, 0x6E, 0x00, 0x43, 0x1A, 0x1C, 0x15, 0x81, 0x6E, 0x67, 0x00,
+    0x45, 0x18, 0x11, 0x08, 0x05, 0x15, 0x82, 0x67, 0x6F, 0x6E, 0x00, 0x46, 0x15, 0x09, 0x1B, 0x08,
+    0x0E, 0x09, 0x85, 0x66, 0x78, 0x72, 0x79, 0x67, 0x6E, 0x00, 0x03, 0x0A, 0x15, 0x18, 0xA4, 0x40,
+    0xB4, 0x40, 0xC1, 0x40, 0x45, 0x06, 0x0F, 0x1C, 0x14, 0x18, 0x87, 0x71, 0x75, 0x79, 0x6C, 0x63,
+    0x67, 0x68, 0x6E, 0x00, 0x47, 0x0F, 0x18, 0x19, 0x04, 0x08, 0x1D, 0x14, 0x82, 0x68, 0x72, 0x6E,
+    0x00, 0x46, 0x0A, 0x13, 0x0C, 0x1A, 0x16, 0x08, 0x86, 0x69, 0x77, 0x70, 0x67, 0x75, 0x68, 0x6E,
+    0x00, 0x46, 0x0D, 0x0A, 0x1D, 0x05, 0x13, 0x14, 0x82, 0x69, 0x6A, 0x6E, 0x00, 0x04, 0x05, 0x07,
+    0x09, 0x1B, 0xEA, 0x40, 0xF7, 0x40, 0x0B, 0x41, 0x16, 0x41, 0x46, 0x0C, 0x1A, 0x19, 0x07, 0x09,
+    0x07, 0x83, 0x62, 0x69, 0x6B, 0x6E, 0x00, 0x47, 0x0F, 0x1C, 0x08, 0x05, 0x09, 0x13, 0x0B, 0x89,
+    0x70, 0x68, 0x66, 0x62, 0x65, 0x79, 0x6C, 0x64, 0x6B, 0x6E, 0x00, 0x45, 0x17, 0x09, 0x09, 0x07,
+    0x2C, 0x82, 0x6B, 0x66, 0x6E, 0x00, 0x45, 0x19, 0x0D, 0x06, 0x12, 0x2C, 0x83, 0x78, 0x76, 0x6B,
+    0x6E, 0x00, 0x44, 0x0C, 0x12, 0x1B, 0x1C, 0x81, 0x6E, 0x6C, 0x00, 0x05, 0x06, 0x09, 0x0E, 0x12,
+    0x16, 0x3B, 0x41, 0x48, 0x41, 0x51, 0x41, 0x63, 0x41, 0x73, 0x41, 0x44, 0x09, 0x19, 0x0A, 0x0C,
+    0x85, 0x76, 0x67, 0x66, 0x63, 0x6D, 0x6E, 0x00, 0x44, 0x18, 0x0E, 0x17, 0x11, 0x81, 0x6E, 0x6D,
+    0x00, 0x46, 0x17, 0x0B, 0x0C, 0x1C, 0x0A, 0x08, 0x88, 0x67, 0x65, 0x79, 0x69, 0x68, 0x74, 0x6B,
+    0x6D, 0x6E, 0x00, 0x46, 0x0B, 0x04, 0x12, 0x04, 0x07, 0x2C, 0x86, 0x6F, 0x61, 0x61, 0x68, 0x6F,
+    0x6D, 0x6E, 0x00, 0x46, 0x04, 0x11, 0x06, 0x17, 0x05, 0x05, 0x81, 0x6E, 0x6D, 0x00, 0x02, 0x07,
+    0x0A, 0x85, 0x41, 0x93, 0x41, 0x46, 0x0E, 0x0C, 0x12, 0x05, 0x13, 0x10, 0x84, 0x6B, 0x69, 0x64,
+    0x6E, 0x6E, 0x00, 0x44, 0x13, 0x04, 0x08, 0x0B, 0x82, 0x6E, 0x67, 0x6E, 0x00, 0x47, 0x16, 0x0F,
+    0x0E, 0x1D, 0x1B, 0x04, 0x1A, 0x86, 0x7A, 0x78, 0x6B, 0x6C, 0x73, 0x6F, 0x6E, 0x00, 0x05, 0x09,
+    0x0D, 0x0E, 0x10, 0x1B, 0xBE, 0x41, 0xCA, 0x41, 0xD8, 0x41, 0xE4, 0x41, 0xF5, 0x41, 0x44, 0x16,
+    0x15, 0x0F, 0x2C, 0x84, 0x73, 0x72, 0x66, 0x70, 0x6E, 0x00, 0x44, 0x1C, 0x09, 0x15, 0x0D, 0x86,
+    0x72, 0x6A, 0x66, 0x79, 0x6A, 0x70, 0x6E, 0x00, 0x45, 0x0F, 0x0D, 0x09, 0x07, 0x2C, 0x83, 0x6B,
+    0x6C, 0x70, 0x6E, 0x00, 0x47, 0x12, 0x11, 0x11, 0x04, 0x08, 0x11, 0x0C, 0x86, 0x6E, 0x61, 0x6E,
+    0x6F, 0x6D, 0x70, 0x6E, 0x00, 0x48, 0x1C, 0x18, 0x04, 0x17, 0x11, 0x15, 0x0D, 0x2C, 0x82, 0x70,
+    0x78, 0x6E, 0x00, 0x03, 0x13, 0x14, 0x19, 0x0D, 0x42, 0x16, 0x42, 0x20, 0x42, 0x43, 0x1B, 0x0A,
+    0x09, 0x82, 0x71, 0x70, 0x6E, 0x00, 0x45, 0x0A, 0x0E, 0x06, 0x06, 0x0C, 0x81, 0x6E, 0x71, 0x00,
+    0x46, 0x05, 0x15, 0x1C, 0x1C, 0x1C, 0x0F, 0x83, 0x76, 0x62, 0x71, 0x6E, 0x00, 0x02, 0x11, 0x1C,
+    0x34, 0x42, 0x3D, 0x42, 0x44, 0x1A, 0x16, 0x17, 0x2C, 0x81, 0x6E, 0x72, 0x00, 0x46, 0x0F, 0x17,
+    0x05, 0x0E, 0x0F, 0x0F, 0x81, 0x6E, 0x72, 0x00, 0x02, 0x08, 0x16, 0x4F, 0x42, 0x5C, 0x42, 0x44,
+    0x10, 0x05, 0x10, 0x2C, 0x85, 0x62, 0x6D, 0x6D, 0x65, 0x73, 0x6E, 0x00, 0x44, 0x13, 0x15, 0x1C,
+    0x0C, 0x81, 0x6E, 0x73, 0x00, 0x41, 0x08, 0x02, 0x05, 0x0F, 0x6E, 0x42, 0x78, 0x42, 0x42, 0x06,
+    0x14, 0x84, 0x62, 0x63, 0x65, 0x74, 0x6E, 0x00, 0x45, 0x15, 0x10, 0x16, 0x05, 0x2C, 0x83, 0x65,
+    0x6C, 0x74, 0x6E, 0x00, 0x44, 0x0D, 0x0B, 0x0C, 0x12, 0x81, 0x6E, 0x76, 0x00, 0x05, 0x04, 0x08,
+    0x09, 0x0E, 0x13, 0x9D, 0x42, 0xAE, 0x42, 0xB7, 0x42, 0xC2, 0x42, 0xCE, 0x42, 0x47, 0x0A, 0x07,
+    0x0D, 0x0F, 0x08, 0x1B, 0x14, 0x86, 0x6A, 0x6C, 0x64, 0x67, 0x61, 0x77, 0x6E, 0x00, 0x44, 0x05,
+    0x19, 0x16, 0x07, 0x81, 0x6E, 0x77, 0x00, 0x46, 0x04, 0x14, 0x14, 0x09, 0x06, 0x2C, 0x81, 0x6E,
+    0x77, 0x00, 0x45, 0x0F, 0x10, 0x15, 0x0C, 0x1C, 0x83, 0x6B, 0x6C, 0x77, 0x6E, 0x00, 0x45, 0x1D,
+    0x0D, 0x0D, 0x04, 0x11, 0x86, 0x6A, 0x61, 0x6A, 0x7A, 0x70, 0x77, 0x6E, 0x00, 0x03, 0x07, 0x0C,
+    0x12, 0xE7, 0x42, 0xF8, 0x42, 0x04, 0x43, 0x47, 0x13, 0x11, 0x09, 0x0B, 0x05, 0x0B, 0x2C, 0x86,
+    0x66, 0x68, 0x6E, 0x70, 0x64, 0x78, 0x6E, 0x00, 0x46, 0x17, 0x10, 0x1A, 0x15, 0x0E, 0x1D, 0x82,
+    0x78, 0x69, 0x6E, 0x00, 0x47, 0x07, 0x0E, 0x18, 0x0A, 0x0F, 0x0C, 0x0B, 0x86, 0x75, 0x67, 0x6B,
+    0x64, 0x6F, 0x78, 0x6E, 0x00, 0x03, 0x04, 0x17, 0x19, 0x1F, 0x43, 0x33, 0x43, 0x3C, 0x43, 0x47,
+    0x08, 0x08, 0x16, 0x0A, 0x0D, 0x0D, 0x0A, 0x89, 0x6A, 0x67, 0x6A, 0x67, 0x73, 0x65, 0x65, 0x61,
+    0x79, 0x6E, 0x00, 0x44, 0x13, 0x0F, 0x12, 0x1A, 0x81, 0x6E, 0x79, 0x00, 0x45, 0x16, 0x0C, 0x14,
+    0x08, 0x13, 0x82, 0x79, 0x76, 0x6E, 0x00, 0x02, 0x0B, 0x0D, 0x4E, 0x43, 0x59, 0x43, 0x43, 0x09,
+    0x10, 0x14, 0x84, 0x66, 0x6D, 0x68, 0x7A, 0x6E, 0x00, 0x46, 0x17, 0x19, 0x19, 0x07, 0x08, 0x14,
+    0x83, 0x6A, 0x74, 0x7A, 0x6E, 0x00, 0x17, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0xAC, 0x43,
+    0xEE, 0x43, 0x39, 0x44, 0x48, 0x44, 0x60, 0x44, 0x90, 0x44, 0xBA, 0x44, 0x04, 0x45, 0x12, 0x45,
+    0x2E, 0x45, 0x4E, 0x45, 0x6C, 0x45, 0x9F, 0x45, 0xBB, 0x45, 0xF9, 0x45, 0x1C, 0x46, 0x86, 0x46,
+    0xB3, 0x46, 0xEC, 0x46, 0x38, 0x47, 0x6B, 0x47, 0xD0, 0x47, 0xEE, 0x47, 0x04, 0x04, 0x0A, 0x15,
+    0x1A, 0xB9, 0x43, 0xC3, 0x43, 0xD3, 0x43, 0xE3, 0x43, 0x45, 0x1C, 0x13, 0x0C, 0x0B, 0x15, 0x81,
+    0x6F, 0x61, 0x00, 0x46, 0x13, 0x12, 0x0A, 0x1A, 0x0A, 0x05, 0x86, 0x67, 0x77, 0x6F, 0x70, 0x67,
+    0x61, 0x6F, 0x00, 0x45, 0x0E, 0x13, 0x16, 0x0D, 0x1C, 0x87, 0x6A, 0x79, 0x73, 0x70, 0x6B, 0x72,
+    0x61, 0x6F, 0x00, 0x45, 0x11, 0x06, 0x08, 0x07, 0x1D, 0x82, 0x61, 0x77, 0x6F, 0x00, 0x04, 0x05,
+    0x0D, 0x11, 0x14, 0xFB, 0x43, 0x0D, 0x44, 0x1D, 0x44, 0x2D, 0x44, 0x47, 0x0A, 0x08, 0x16, 0x15,
+    0x0B, 0x11, 0x1A, 0x87, 0x72, 0x68, 0x73, 0x65, 0x67, 0x62, 0x62, 0x6F, 0x00, 0x47, 0x09, 0x1D,
+    0x04, 0x10, 0x09, 0x0F, 0x12, 0x85, 0x7A, 0x61, 0x66, 0x6A, 0x62, 0x6F, 0x00, 0x46, 0x0E, 0x0E,
+    0x12, 0x18, 0x11, 0x08, 0x86, 0x6F, 0x75, 0x6B, 0x6B, 0x6E, 0x62, 0x6F, 0x00, 0x43, 0x1C, 0x1C,
+    0x15, 0x85, 0x79, 0x72, 0x79, 0x71, 0x62, 0x6F, 0x00, 0x45, 0x0B, 0x04, 0x13, 0x10, 0x18, 0x86,
+    0x6D, 0x75, 0x70, 0x61, 0x68, 0x63, 0x6F, 0x00, 0x02, 0x12, 0x1B, 0x4F, 0x44, 0x57, 0x44, 0x43,
+    0x14, 0x18, 0x1A, 0x81, 0x6F, 0x64, 0x00, 0x44, 0x1A, 0x15, 0x08, 0x0C, 0x81, 0x6F, 0x64, 0x00,
+    0x03, 0x04, 0x0E, 0x0F, 0x6A, 0x44, 0x74, 0x44, 0x84, 0x44, 0x44, 0x0A, 0x05, 0x12, 0x18, 0x82,
+    0x65, 0x61, 0x6F, 0x00, 0x46, 0x12, 0x11, 0x04, 0x11, 0x1A, 0x2C, 0x86, 0x61, 0x6E, 0x6E, 0x6F,
+    0x6B, 0x65, 0x6F, 0x00, 0x43, 0x07, 0x1C, 0x0F, 0x85, 0x79, 0x6C, 0x64, 0x6C, 0x65, 0x6F, 0x00,
+    0x03, 0x04, 0x0A, 0x17, 0x9A, 0x44, 0xA4, 0x44, 0xAF, 0x44, 0x43, 0x14, 0x08, 0x0E, 0x83, 0x61,
+    0x71, 0x66, 0x6F, 0x00, 0x44, 0x14, 0x09, 0x14, 0x2C, 0x83, 0x67, 0x71, 0x66, 0x6F, 0x00, 0x43,
+    0x0F, 0x06, 0x09, 0x84, 0x6C, 0x63, 0x74, 0x66, 0x6F, 0x00, 0x05, 0x0E, 0x12, 0x1A, 0x1B, 0x1D,
+    0xCA, 0x44, 0xD5, 0x44, 0xDF, 0x44, 0xE8, 0x44, 0xF6, 0x44, 0x46, 0x0C, 0x15, 0x06, 0x04, 0x13,
+    0x2C, 0x81, 0x6F, 0x67, 0x00, 0x43, 0x0A, 0x1B, 0x13, 0x83, 0x6F, 0x67, 0x67, 0x6F, 0x00, 0x43,
+    0x16, 0x19, 0x1B, 0x82, 0x67, 0x77, 0x6F, 0x00, 0x44, 0x13, 0x0E, 0x1A, 0x04, 0x86, 0x77, 0x61,
+    0x6B, 0x70, 0x78, 0x67, 0x6F, 0x00, 0x45, 0x16, 0x12, 0x04, 0x18, 0x07, 0x85, 0x6F, 0x61, 0x73,
+    0x7A, 0x67, 0x6F, 0x00, 0x47, 0x09, 0x1D, 0x14, 0x11, 0x08, 0x0D, 0x11, 0x83, 0x66, 0x7A, 0x68,
+    0x6F, 0x00, 0x02, 0x08, 0x0F, 0x19, 0x45, 0x21, 0x45, 0x43, 0x08, 0x1A, 0x0C, 0x81, 0x6F, 0x69,
+    0x00, 0x46, 0x10, 0x16, 0x1D, 0x14, 0x0B, 0x05, 0x83, 0x6C, 0x6D, 0x69, 0x6F, 0x00, 0x02, 0x0B,
+    0x0C, 0x35, 0x45, 0x43, 0x45, 0x45, 0x1B, 0x0B, 0x19, 0x1B, 0x0F, 0x85, 0x68, 0x76, 0x78, 0x68,
+    0x6A, 0x6F, 0x00, 0x44, 0x17, 0x14, 0x15, 0x0B, 0x83, 0x69, 0x74, 0x6A, 0x6F, 0x00, 0x02, 0x17,
+    0x18, 0x55, 0x45, 0x61, 0x45, 0x43, 0x05, 0x14, 0x12, 0x85, 0x71, 0x6F, 0x62, 0x74, 0x6C, 0x6F,
+    0x00, 0x45, 0x0D, 0x13, 0x05, 0x1A, 0x2C, 0x82, 0x6C, 0x75, 0x6F, 0x00, 0x03, 0x09, 0x0F, 0x17,
+    0x76, 0x45, 0x82, 0x45, 0x93, 0x45, 0x45, 0x0D, 0x07, 0x0A, 0x15, 0x0F, 0x83, 0x66, 0x6A, 0x6D,
+    0x6F, 0x00, 0x47, 0x12, 0x14, 0x0A, 0x19, 0x0A, 0x07, 0x2C, 0x86, 0x67, 0x76, 0x71, 0x6F, 0x6C,
+    0x6D, 0x6F, 0x00, 0x44, 0x11, 0x05, 0x0B, 0x1D, 0x84, 0x6E, 0x62, 0x74, 0x6D, 0x6F, 0x00, 0x02,
+    0x0A, 0x12, 0xA6, 0x45, 0xB1, 0x45, 0x45, 0x16, 0x18, 0x17, 0x15, 0x06, 0x82, 0x6F, 0x67, 0x6F,
+    0x00, 0x43, 0x09, 0x0E, 0x15, 0x83, 0x6F, 0x66, 0x6F, 0x6F, 0x00, 0x04, 0x05, 0x0A, 0x0B, 0x0F,
+    0xC8, 0x45, 0xD9, 0x45, 0xE2, 0x45, 0xF0, 0x45, 0x47, 0x14, 0x12, 0x17, 0x09, 0x06, 0x10, 0x06,
+    0x86, 0x74, 0x66, 0x6F, 0x71, 0x62, 0x70, 0x6F, 0x00, 0x44, 0x0C, 0x16, 0x0B, 0x0B, 0x81, 0x6F,
+    0x70, 0x00, 0x44, 0x0C, 0x16, 0x0D, 0x11, 0x86, 0x6A, 0x6E, 0x73, 0x69, 0x68, 0x70, 0x6F, 0x00,
+    0x44, 0x05, 0x0F, 0x10, 0x0B, 0x81, 0x6F, 0x70, 0x00, 0x02, 0x11, 0x18, 0x00, 0x46, 0x0E, 0x46,
+    0x46, 0x18, 0x0F, 0x1C, 0x18, 0x13, 0x0B, 0x84, 0x75, 0x6C, 0x6E, 0x71, 0x6F, 0x00, 0x44, 0x08,
+    0x0B, 0x0B, 0x16, 0x86, 0x68, 0x73, 0x68, 0x65, 0x75, 0x71, 0x6F, 0x00, 0x06, 0x0A, 0x0C, 0x0F,
+    0x10, 0x12, 0x13, 0x2F, 0x46, 0x43, 0x46, 0x55, 0x46, 0x62, 0x46, 0x6A, 0x46, 0x77, 0x46, 0x47,
+    0x07, 0x1A, 0x1A, 0x14, 0x16, 0x07, 0x15, 0x89, 0x64, 0x72, 0x73, 0x71, 0x77, 0x77, 0x64, 0x67,
+    0x73, 0x6F, 0x00, 0x48, 0x0E, 0x0F, 0x14, 0x12, 0x07, 0x04, 0x04, 0x2C, 0x86, 0x71, 0x6F, 0x6C,
+    0x6B, 0x69, 0x73, 0x6F, 0x00, 0x44, 0x1B, 0x15, 0x06, 0x14, 0x85, 0x72, 0x63, 0x78, 0x6C, 0x73,
+    0x6F, 0x00, 0x43, 0x07, 0x0F, 0x19, 0x81, 0x6F, 0x73, 0x00, 0x46, 0x11, 0x15, 0x13, 0x0F, 0x14,
+    0x09, 0x83, 0x6F, 0x6E, 0x73, 0x6F, 0x00, 0x46, 0x1A, 0x0D, 0x12, 0x10, 0x1C, 0x13, 0x85, 0x6A,
+    0x6F, 0x77, 0x70, 0x73, 0x6F, 0x00, 0x03, 0x04, 0x0A, 0x0E, 0x90, 0x46, 0x98, 0x46, 0xAA, 0x46,
+    0x43, 0x1A, 0x15, 0x1B, 0x81, 0x6F, 0x74, 0x00, 0x47, 0x0B, 0x19, 0x0B, 0x1D, 0x16, 0x13, 0x2C,
+    0x87, 0x7A, 0x73, 0x68, 0x76, 0x68, 0x67, 0x74, 0x6F, 0x00, 0x44, 0x0E, 0x10, 0x11, 0x06, 0x81,
+    0x6F, 0x74, 0x00, 0x04, 0x05, 0x06, 0x0C, 0x0F, 0xC0, 0x46, 0xCC, 0x46, 0xD6, 0x46, 0xE2, 0x46,
+    0x46, 0x05, 0x0D, 0x06, 0x08, 0x0A, 0x1A, 0x82, 0x75, 0x62, 0x6F, 0x00, 0x45, 0x12, 0x1B, 0x07,
+    0x0D, 0x2C, 0x81, 0x6F, 0x75, 0x00, 0x43, 0x19, 0x12, 0x0D, 0x85, 0x6F, 0x6A, 0x76, 0x69, 0x75,
+    0x6F, 0x00, 0x43, 0x0B, 0x1A, 0x08, 0x83, 0x6C, 0x68, 0x75, 0x6F, 0x00, 0x03, 0x05, 0x14, 0x1D,
+    0xF6, 0x46, 0x21, 0x47, 0x2F, 0x47, 0x03, 0x18, 0x19, 0x1B, 0x00, 0x47, 0x0C, 0x47, 0x19, 0x47,
+    0x45, 0x1C, 0x19, 0x05, 0x16, 0x19, 0x83, 0x62, 0x75, 0x76, 0x6F, 0x00, 0x45, 0x06, 0x0A, 0x1C,
+    0x0D, 0x0F, 0x84, 0x76, 0x63, 0x62, 0x76, 0x6F, 0x00, 0x42, 0x1D, 0x16, 0x82, 0x76, 0x62, 0x6F,
+    0x00, 0x44, 0x16, 0x04, 0x1D, 0x0D, 0x86, 0x7A, 0x6A, 0x61, 0x73, 0x71, 0x76, 0x6F, 0x00, 0x44,
+    0x1C, 0x11, 0x15, 0x1C, 0x81, 0x6F, 0x76, 0x00, 0x03, 0x08, 0x0C, 0x17, 0x42, 0x47, 0x4B, 0x47,
+    0x5F, 0x47, 0x44, 0x0B, 0x0C, 0x0F, 0x2C, 0x81, 0x6F, 0x77, 0x00, 0x47, 0x06, 0x0E, 0x0A, 0x11,
+    0x14, 0x07, 0x04, 0x89, 0x64, 0x61, 0x71, 0x6E, 0x67, 0x6B, 0x63, 0x69, 0x77, 0x6F, 0x00, 0x44,
+    0x0A, 0x1A, 0x0E, 0x0C, 0x84, 0x67, 0x77, 0x74, 0x77, 0x6F, 0x00, 0x06, 0x06, 0x0C, 0x0D, 0x11,
+    0x14, 0x19, 0x7E, 0x47, 0x89, 0x47, 0x99, 0x47, 0xAA, 0x47, 0xB7, 0x47, 0xC3, 0x47, 0x43, 0x0B,
+    0x16, 0x0F, 0x84, 0x68, 0x73, 0x63, 0x78, 0x6F, 0x00, 0x46, 0x09, 0x0B, 0x14, 0x1D, 0x1C, 0x19,
+    0x86, 0x71, 0x7A, 0x68, 0x66, 0x69, 0x78, 0x6F, 0x00, 0x46, 0x09, 0x1B, 0x0F, 0x17, 0x06, 0x14,
+    0x87, 0x74, 0x63, 0x6C, 0x78, 0x66, 0x6A, 0x78, 0x6F, 0x00, 0x45, 0x0C, 0x13, 0x11, 0x1D, 0x2C,
+    0x84, 0x69, 0x70, 0x6E, 0x78, 0x6F, 0x00, 0x46, 0x1B, 0x09, 0x12, 0x19, 0x17, 0x1D, 0x82, 0x78,
+    0x71, 0x6F, 0x00, 0x46, 0x18, 0x13, 0x0E, 0x08, 0x0E, 0x2C, 0x83, 0x76, 0x75, 0x78, 0x6F, 0x00,
+    0x02, 0x12, 0x19, 0xD7, 0x47, 0xE4, 0x47, 0x46, 0x1C, 0x12, 0x0C, 0x0F, 0x10, 0x2C, 0x83, 0x6F,
+    0x79, 0x79, 0x6F, 0x00, 0x43, 0x08, 0x05, 0x17, 0x83, 0x76, 0x65, 0x79, 0x6F, 0x00, 0x05, 0x07,
+    0x0F, 0x12, 0x14, 0x16, 0xFE, 0x47, 0x0C, 0x48, 0x18, 0x48, 0x29, 0x48, 0x37, 0x48, 0x45, 0x0C,
+    0x07, 0x08, 0x1B, 0x0A, 0x85, 0x64, 0x65, 0x69, 0x64, 0x7A, 0x6F, 0x00, 0x47, 0x14, 0x1D, 0x0E,
+    0x0A, 0x09, 0x05, 0x07, 0x81, 0x6F, 0x7A, 0x00, 0x46, 0x18, 0x18, 0x1C, 0x17, 0x0E, 0x2C, 0x87,
+    0x74, 0x6B, 0x79, 0x75, 0x75, 0x6F, 0x7A, 0x6F, 0x00, 0x48, 0x04, 0x16, 0x1D, 0x0E, 0x04, 0x04,
+    0x18, 0x2C, 0x82, 0x7A, 0x71, 0x6F, 0x00, 0x44, 0x18, 0x13, 0x0D, 0x19, 0x81, 0x6F, 0x7A, 0x00,
+    0x1A, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+    0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x8F, 0x48, 0xE3, 0x48, 0x45,
+    0x49, 0x53, 0x49, 0x7A, 0x49, 0x98, 0x49, 0xB9, 0x49, 0xD9, 0x49, 0x2E, 0x4A, 0x5F, 0x4A, 0x81,
+    0x4A, 0xB7, 0x4A, 0x25, 0x4B, 0x69, 0x4B, 0xBA, 0x4B, 0xF2, 0x4B, 0x28, 0x4C, 0x57, 0x4C, 0x92,
+    0x4C, 0xA0, 0x4C, 0xAD, 0x4C, 0xB9, 0x4C, 0xE7, 0x4C, 0x1A, 0x4D, 0x29, 0x4D, 0x85, 0x4D, 0x05,
+    0x0D, 0x10, 0x11, 0x18, 0x1C, 0x9F, 0x48, 0xAA, 0x48, 0xB4, 0x48, 0xC8, 0x48, 0xD6, 0x48, 0x44,
+    0x19, 0x10, 0x0E, 0x05, 0x83, 0x6A, 0x76, 0x61, 0x70, 0x00, 0x43, 0x05, 0x05, 0x0B, 0x83, 0x6D,
+    0x62, 0x61, 0x70, 0x00, 0x47, 0x0D, 0x19, 0x0B, 0x19, 0x04, 0x08, 0x17, 0x89, 0x65, 0x74, 0x61,
+    0x76, 0x68, 0x76, 0x6A, 0x6E, 0x61, 0x70, 0x00, 0x46, 0x12, 0x11, 0x12, 0x1A, 0x1A, 0x12, 0x84,
+    0x6F, 0x6E, 0x75, 0x61, 0x70, 0x00, 0x46, 0x16, 0x07, 0x17, 0x1B, 0x1B, 0x05, 0x83, 0x79, 0x73,
+    0x61, 0x70, 0x00, 0x06, 0x05, 0x06, 0x09, 0x0C, 0x10, 0x1B, 0xF6, 0x48, 0x05, 0x49, 0x11, 0x49,
+    0x21, 0x49, 0x2C, 0x49, 0x38, 0x49, 0x48, 0x15, 0x0C, 0x08, 0x04, 0x16, 0x18, 0x08, 0x2C, 0x83,
+    0x62, 0x72, 0x62, 0x70, 0x00, 0x44, 0x1A, 0x05, 0x0D, 0x14, 0x84, 0x77, 0x62, 0x63, 0x62, 0x70,
+    0x00, 0x47, 0x1D, 0x12, 0x14, 0x0F, 0x09, 0x08, 0x2C, 0x85, 0x6F, 0x71, 0x7A, 0x66, 0x62, 0x70,
+    0x00, 0x46, 0x1A, 0x07, 0x06, 0x04, 0x0B, 0x11, 0x81, 0x70, 0x62, 0x00, 0x47, 0x1D, 0x17, 0x1D,
+    0x0D, 0x08, 0x1B, 0x0F, 0x81, 0x70, 0x62, 0x00, 0x45, 0x0C, 0x19, 0x04, 0x17, 0x0A, 0x84, 0x69,
+    0x76, 0x78, 0x62, 0x70, 0x00, 0x46, 0x10, 0x05, 0x06, 0x13, 0x10, 0x2C, 0x84, 0x62, 0x63, 0x6D,
+    0x63, 0x70, 0x00, 0x03, 0x10, 0x16, 0x1B, 0x5D, 0x49, 0x66, 0x49, 0x71, 0x49, 0x43, 0x1C, 0x10,
+    0x19, 0x82, 0x64, 0x6D, 0x70, 0x00, 0x45, 0x0A, 0x1B, 0x0A, 0x15, 0x2C, 0x82, 0x64, 0x73, 0x70,
+    0x00, 0x44, 0x16, 0x0D, 0x0A, 0x14, 0x81, 0x70, 0x64, 0x00, 0x02, 0x09, 0x14, 0x81, 0x49, 0x8D,
+    0x49, 0x46, 0x17, 0x05, 0x04, 0x1A, 0x12, 0x04, 0x82, 0x65, 0x66, 0x70, 0x00, 0x44, 0x1D, 0x1D,
+    0x06, 0x0E, 0x83, 0x71, 0x7A, 0x65, 0x70, 0x00, 0x02, 0x0B, 0x1C, 0x9F, 0x49, 0xAA, 0x49, 0x43,
+    0x1A, 0x1C, 0x15, 0x84, 0x77, 0x79, 0x68, 0x66, 0x70, 0x00, 0x46, 0x0D, 0x0A, 0x08, 0x0B, 0x06,
+    0x19, 0x85, 0x67, 0x65, 0x6A, 0x79, 0x66, 0x70, 0x00, 0x02, 0x05, 0x11, 0xC0, 0x49, 0xD0, 0x49,
+    0x47, 0x06, 0x14, 0x1A, 0x09, 0x17, 0x1A, 0x10, 0x85, 0x71, 0x77, 0x63, 0x62, 0x67, 0x70, 0x00,
+    0x43, 0x06, 0x0C, 0x14, 0x82, 0x67, 0x6E, 0x70, 0x00, 0x05, 0x09, 0x15, 0x16, 0x18, 0x1D, 0xE9,
+    0x49, 0xF3, 0x49, 0x03, 0x4A, 0x12, 0x4A, 0x20, 0x4A, 0x43, 0x0A, 0x12, 0x11, 0x83, 0x66, 0x67,
+    0x68, 0x70, 0x00, 0x47, 0x0D, 0x1D, 0x0D, 0x10, 0x0B, 0x18, 0x09, 0x85, 0x7A, 0x6A, 0x6A, 0x72,
+    0x68, 0x70, 0x00, 0x47, 0x12, 0x11, 0x0F, 0x08, 0x05, 0x06, 0x2C, 0x84, 0x6F, 0x6E, 0x73, 0x68,
+    0x70, 0x00, 0x47, 0x1D, 0x18, 0x05, 0x14, 0x16, 0x11, 0x2C, 0x83, 0x75, 0x7A, 0x68, 0x70, 0x00,
+    0x47, 0x05, 0x09, 0x06, 0x0B, 0x16, 0x1C, 0x0B, 0x83, 0x7A, 0x62, 0x68, 0x70, 0x00, 0x03, 0x05,
+    0x06, 0x1D, 0x38, 0x4A, 0x44, 0x4A, 0x53, 0x4A, 0x46, 0x0E, 0x1B, 0x10, 0x11, 0x1B, 0x0F, 0x82,
+    0x69, 0x62, 0x70, 0x00, 0x45, 0x1A, 0x1B, 0x0D, 0x1D, 0x2C, 0x86, 0x6A, 0x7A, 0x78, 0x77, 0x63,
+    0x69, 0x70, 0x00, 0x45, 0x13, 0x17, 0x17, 0x18, 0x0C, 0x83, 0x7A, 0x70, 0x69, 0x70, 0x00, 0x02,
+    0x0C, 0x15, 0x66, 0x4A, 0x70, 0x4A, 0x45, 0x13, 0x1B, 0x10, 0x10, 0x0F, 0x81, 0x70, 0x6A, 0x00,
+    0x47, 0x0B, 0x1D, 0x0E, 0x1A, 0x0E, 0x17, 0x09, 0x86, 0x6B, 0x77, 0x7A, 0x68, 0x72, 0x6A, 0x70,
+    0x00, 0x03, 0x04, 0x12, 0x17, 0x8B, 0x4A, 0x9C, 0x4A, 0xA8, 0x4A, 0x46, 0x12, 0x09, 0x17, 0x11,
+    0x0E, 0x2C, 0x87, 0x6E, 0x6B, 0x74, 0x66, 0x6F, 0x61, 0x6B, 0x70, 0x00, 0x47, 0x19, 0x09, 0x0B,
+    0x1C, 0x05, 0x16, 0x0E, 0x81, 0x70, 0x6B, 0x00, 0x46, 0x11, 0x16, 0x0D, 0x08, 0x0E, 0x2C, 0x85,
+    0x73, 0x6A, 0x6E, 0x74, 0x6B, 0x70, 0x00, 0x07, 0x09, 0x0C, 0x0E, 0x0F, 0x10, 0x15, 0x1D, 0xCD,
+    0x4A, 0xD7, 0x4A, 0xE8, 0x4A, 0xF8, 0x4A, 0x04, 0x4B, 0x0F, 0x4B, 0x1B, 0x4B, 0x44, 0x15, 0x13,
+    0x1A, 0x2C, 0x82, 0x6C, 0x66, 0x70, 0x00, 0x47, 0x1B, 0x06, 0x1D, 0x0F, 0x09, 0x04, 0x04, 0x86,
+    0x7A, 0x6C, 0x63, 0x78, 0x69, 0x6C, 0x70, 0x00, 0x47, 0x07, 0x1C, 0x15, 0x05, 0x13, 0x09, 0x14,
+    0x85, 0x79, 0x72, 0x64, 0x6B, 0x6C, 0x70, 0x00, 0x44, 0x04, 0x18, 0x18, 0x0F, 0x84, 0x61, 0x75,
+    0x6C, 0x6C, 0x70, 0x00, 0x43, 0x10, 0x09, 0x0D, 0x84, 0x6D, 0x66, 0x6D, 0x6C, 0x70, 0x00, 0x45,
+    0x1D, 0x17, 0x07, 0x1B, 0x1B, 0x83, 0x72, 0x7A, 0x6C, 0x70, 0x00, 0x43, 0x04, 0x05, 0x0A, 0x83,
+    0x7A, 0x61, 0x6C, 0x70, 0x00, 0x04, 0x10, 0x11, 0x12, 0x15, 0x32, 0x4B, 0x41, 0x4B, 0x4E, 0x4B,
+    0x5D, 0x4B, 0x46, 0x12, 0x16, 0x12, 0x0E, 0x14, 0x0B, 0x85, 0x73, 0x6F, 0x6F, 0x6D, 0x6D, 0x70,
+    0x00, 0x44, 0x1D, 0x14, 0x0E, 0x1D, 0x85, 0x71, 0x6B, 0x7A, 0x6E, 0x6D, 0x70, 0x00, 0x46, 0x09,
+    0x0B, 0x0C, 0x1A, 0x1A, 0x0B, 0x85, 0x68, 0x69, 0x66, 0x6F, 0x6D, 0x70, 0x00, 0x46, 0x10, 0x0A,
+    0x17, 0x18, 0x19, 0x12, 0x82, 0x6D, 0x72, 0x70, 0x00, 0x04, 0x10, 0x13, 0x14, 0x1A, 0x76, 0x4B,
+    0x80, 0x4B, 0xA1, 0x4B, 0xB1, 0x4B, 0x44, 0x13, 0x0C, 0x0A, 0x16, 0x82, 0x6E, 0x6D, 0x70, 0x00,
+    0x02, 0x07, 0x0A, 0x87, 0x4B, 0x96, 0x4B, 0x46, 0x13, 0x12, 0x19, 0x09, 0x1C, 0x0E, 0x85, 0x70,
+    0x6F, 0x64, 0x70, 0x6E, 0x70, 0x00, 0x46, 0x1B, 0x09, 0x0D, 0x06, 0x0C, 0x2C, 0x81, 0x70, 0x6E,
+    0x00, 0x45, 0x0F, 0x0D, 0x15, 0x15, 0x05, 0x87, 0x72, 0x62, 0x72, 0x6A, 0x6C, 0x71, 0x6E, 0x70,
+    0x00, 0x44, 0x16, 0x0C, 0x16, 0x0F, 0x81, 0x70, 0x6E, 0x00, 0x04, 0x04, 0x0F, 0x12, 0x1B, 0xC7,
+    0x4B, 0xD2, 0x4B, 0xE1, 0x4B, 0xEA, 0x4B, 0x44, 0x0F, 0x14, 0x06, 0x0E, 0x83, 0x61, 0x6C, 0x6F,
+    0x70, 0x00, 0x46, 0x0F, 0x10, 0x0E, 0x17, 0x15, 0x1B, 0x85, 0x6D, 0x6B, 0x6C, 0x6C, 0x6F, 0x70,
+    0x00, 0x44, 0x0D, 0x0B, 0x06, 0x19, 0x81, 0x70, 0x6F, 0x00, 0x43, 0x05, 0x0D, 0x0B, 0x81, 0x70,
+    0x6F, 0x00, 0x03, 0x04, 0x05, 0x19, 0xFC, 0x4B, 0x0C, 0x4C, 0x1E, 0x4C, 0x47, 0x16, 0x1A, 0x07,
+    0x14, 0x19, 0x10, 0x09, 0x85, 0x77, 0x64, 0x73, 0x61, 0x70, 0x70, 0x00, 0x48, 0x13, 0x0A, 0x10,
+    0x05, 0x0E, 0x17, 0x1C, 0x2C, 0x86, 0x6D, 0x62, 0x67, 0x70, 0x62, 0x70, 0x70, 0x00, 0x44, 0x0F,
+    0x0B, 0x19, 0x2C, 0x82, 0x70, 0x76, 0x70, 0x00, 0x03, 0x05, 0x09, 0x1B, 0x32, 0x4C, 0x3E, 0x4C,
+    0x4A, 0x4C, 0x47, 0x1C, 0x17, 0x16, 0x08, 0x1A, 0x1C, 0x14, 0x81, 0x70, 0x71, 0x00, 0x44, 0x1C,
+    0x11, 0x1D, 0x0A, 0x84, 0x79, 0x6E, 0x66, 0x71, 0x70, 0x00, 0x46, 0x15, 0x08, 0x1A, 0x15, 0x1C,
+    0x04, 0x83, 0x78, 0x72, 0x71, 0x70, 0x00, 0x03, 0x06, 0x0F, 0x17, 0x61, 0x4C, 0x7C, 0x4C, 0x88,
+    0x4C, 0x02, 0x10, 0x16, 0x68, 0x4C, 0x70, 0x4C, 0x43, 0x12, 0x1D, 0x2C, 0x81, 0x70, 0x72, 0x00,
+    0x45, 0x17, 0x1D, 0x0F, 0x12, 0x10, 0x83, 0x63, 0x73, 0x72, 0x70, 0x00, 0x46, 0x1D, 0x13, 0x04,
+    0x05, 0x13, 0x15, 0x82, 0x72, 0x6C, 0x70, 0x00, 0x43, 0x10, 0x10, 0x1A, 0x83, 0x74, 0x6D, 0x72,
+    0x70, 0x00, 0x48, 0x1C, 0x0F, 0x0E, 0x06, 0x04, 0x05, 0x15, 0x13, 0x82, 0x73, 0x79, 0x70, 0x00,
+    0x45, 0x0F, 0x08, 0x18, 0x05, 0x04, 0x84, 0x65, 0x75, 0x6C, 0x74, 0x70, 0x00, 0x44, 0x04, 0x19,
+    0x14, 0x14, 0x84, 0x76, 0x71, 0x61, 0x75, 0x70, 0x00, 0x03, 0x07, 0x0E, 0x16, 0xC3, 0x4C, 0xCF,
+    0x4C, 0xDA, 0x4C, 0x47, 0x10, 0x05, 0x17, 0x19, 0x15, 0x14, 0x14, 0x81, 0x70, 0x76, 0x00, 0x45,
+    0x1D, 0x04, 0x1D, 0x18, 0x0B, 0x82, 0x76, 0x6B, 0x70, 0x00, 0x48, 0x13, 0x1D, 0x04, 0x07, 0x04,
+    0x0A, 0x14, 0x2C, 0x81, 0x70, 0x76, 0x00, 0x03, 0x05, 0x0E, 0x18, 0xF1, 0x4C, 0xFE, 0x4C, 0x08,
+    0x4D, 0x47, 0x06, 0x07, 0x14, 0x1B, 0x19, 0x07, 0x0B, 0x82, 0x77, 0x62, 0x70, 0x00, 0x43, 0x17,
+    0x14, 0x09, 0x83, 0x6B, 0x74, 0x77, 0x70, 0x00, 0x47, 0x04, 0x13, 0x15, 0x0A, 0x1A, 0x0A, 0x2C,
+    0x87, 0x67, 0x77, 0x72, 0x70, 0x61, 0x75, 0x77, 0x70, 0x00, 0x46, 0x1D, 0x1D, 0x0A, 0x15, 0x0B,
+    0x1B, 0x85, 0x67, 0x72, 0x7A, 0x7A, 0x78, 0x70, 0x00, 0x04, 0x09, 0x0A, 0x0E, 0x14, 0x36, 0x4D,
+    0x3E, 0x4D, 0x68, 0x4D, 0x76, 0x4D, 0x43, 0x14, 0x13, 0x1A, 0x81, 0x70, 0x79, 0x00, 0x02, 0x11,
+    0x12, 0x45, 0x4D, 0x57, 0x4D, 0x46, 0x1B, 0x12, 0x10, 0x07, 0x14, 0x0B, 0x88, 0x64, 0x71, 0x6D,
+    0x6F, 0x78, 0x6E, 0x67, 0x79, 0x70, 0x00, 0x46, 0x0E, 0x10, 0x0E, 0x1A, 0x0A, 0x13, 0x87, 0x6B,
+    0x77, 0x6D, 0x6B, 0x6F, 0x67, 0x79, 0x70, 0x00, 0x46, 0x1C, 0x10, 0x04, 0x0A, 0x14, 0x2C, 0x84,
+    0x79, 0x6D, 0x6B, 0x79, 0x70, 0x00, 0x46, 0x07, 0x05, 0x0B, 0x1B, 0x1B, 0x08, 0x85, 0x62, 0x68,
+    0x64, 0x71, 0x79, 0x70, 0x00, 0x03, 0x07, 0x09, 0x16, 0x8F, 0x4D, 0x97, 0x4D, 0xA2, 0x4D, 0x43,
+    0x1C, 0x18, 0x11, 0x81, 0x70, 0x7A, 0x00, 0x44, 0x1C, 0x1D, 0x13, 0x1A, 0x83, 0x66, 0x79, 0x7A,
+    0x70, 0x00, 0x47, 0x14, 0x11, 0x16, 0x17, 0x13, 0x0C, 0x2C, 0x87, 0x74, 0x70, 0x73, 0x6E, 0x71,
+    0x73, 0x7A, 0x70, 0x00, 0x16, 0x04, 0x05, 0x06, 0x07, 0x08, 0x0A, 0x0B, 0x0C, 0x0F, 0x10, 0x11,
+    0x12, 0x13, 0x14, 0x15, 0x16, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0xF7, 0x4D, 0x03, 0x4E, 0x23,
+    0x4E, 0x32, 0x4E, 0x55, 0x4E, 0x92, 0x4E, 0xC7, 0x4E, 0x04, 0x4F, 0x3C, 0x4F, 0x60, 0x4F, 0xB3,
+    0x4F, 0xF6, 0x4F, 0x32, 0x50, 0x71, 0x50, 0x8F, 0x50, 0xA9, 0x50, 0xB5, 0x50, 0xC7, 0x50, 0x08,
+    0x51, 0x46, 0x51, 0x66, 0x51, 0xB3, 0x51, 0x44, 0x19, 0x13, 0x1C, 0x19, 0x84, 0x70, 0x79, 0x76,
+    0x61, 0x71, 0x00, 0x02, 0x07, 0x15, 0x0A, 0x4E, 0x18, 0x4E, 0x45, 0x1A, 0x11, 0x0A, 0x04, 0x05,
+    0x85, 0x6E, 0x67, 0x77, 0x64, 0x62, 0x71, 0x00, 0x44, 0x0A, 0x18, 0x1D, 0x2C, 0x83, 0x72, 0x67,
+    0x62, 0x71, 0x00, 0x45, 0x06, 0x0B, 0x12, 0x12, 0x08, 0x86, 0x6F, 0x65, 0x6F, 0x68, 0x63, 0x63,
+    0x71, 0x00, 0x02, 0x07, 0x14, 0x39, 0x4E, 0x47, 0x4E, 0x47, 0x04, 0x0B, 0x15, 0x13, 0x04, 0x11,
+    0x08, 0x83, 0x64, 0x61, 0x64, 0x71, 0x00, 0x46, 0x0C, 0x08, 0x1B, 0x13, 0x1B, 0x2C, 0x84, 0x69,
+    0x65, 0x71, 0x64, 0x71, 0x00, 0x03, 0x06, 0x11, 0x12, 0x5F, 0x4E, 0x80, 0x4E, 0x89, 0x4E, 0x02,
+    0x0C, 0x14, 0x66, 0x4E, 0x79, 0x4E, 0x46, 0x05, 0x0B, 0x0E, 0x0A, 0x08, 0x17, 0x89, 0x65, 0x74,
+    0x67, 0x6B, 0x68, 0x62, 0x69, 0x63, 0x65, 0x71, 0x00, 0x42, 0x17, 0x1B, 0x81, 0x71, 0x65, 0x00,
+    0x44, 0x10, 0x08, 0x14, 0x2C, 0x81, 0x71, 0x65, 0x00, 0x44, 0x0A, 0x0A, 0x07, 0x0D, 0x81, 0x71,
+    0x65, 0x00, 0x02, 0x1B, 0x1C, 0x99, 0x4E, 0xA5, 0x4E, 0x46, 0x0A, 0x12, 0x17, 0x0E, 0x0A, 0x1D,
+    0x82, 0x67, 0x78, 0x71, 0x00, 0x02, 0x0F, 0x17, 0xAC, 0x4E, 0xB7, 0x4E, 0x43, 0x05, 0x05, 0x2C,
+    0x84, 0x6C, 0x62, 0x79, 0x67, 0x71, 0x00, 0x46, 0x11, 0x04, 0x10, 0x0D, 0x14, 0x1C, 0x86, 0x61,
+    0x6D, 0x6E, 0x74, 0x79, 0x67, 0x71, 0x00, 0x04, 0x08, 0x0C, 0x12, 0x1A, 0xD4, 0x4E, 0xE4, 0x4E,
+    0xF2, 0x4E, 0xFB, 0x4E, 0x46, 0x0F, 0x1D, 0x05, 0x1A, 0x0C, 0x1D, 0x86, 0x62, 0x77, 0x7A, 0x6C,
+    0x65, 0x68, 0x71, 0x00, 0x47, 0x1C, 0x09, 0x09, 0x12, 0x09, 0x0A, 0x09, 0x83, 0x69, 0x79, 0x68,
+    0x71, 0x00, 0x43, 0x05, 0x09, 0x0C, 0x82, 0x68, 0x6F, 0x71, 0x00, 0x43, 0x0B, 0x0B, 0x1C, 0x82,
+    0x68, 0x77, 0x71, 0x00, 0x03, 0x0F, 0x11, 0x1A, 0x0E, 0x4F, 0x1D, 0x4F, 0x2E, 0x4F, 0x47, 0x0C,
+    0x15, 0x05, 0x05, 0x05, 0x11, 0x2C, 0x84, 0x69, 0x72, 0x6C, 0x69, 0x71, 0x00, 0x47, 0x1C, 0x05,
+    0x10, 0x05, 0x16, 0x19, 0x2C, 0x86, 0x6D, 0x62, 0x62, 0x79, 0x6E, 0x69, 0x71, 0x00, 0x46, 0x08,
+    0x07, 0x14, 0x18, 0x0C, 0x2C, 0x84, 0x65, 0x64, 0x77, 0x69, 0x71, 0x00, 0x02, 0x11, 0x18, 0x43,
+    0x4F, 0x55, 0x4F, 0x47, 0x14, 0x18, 0x18, 0x0F, 0x06, 0x0F, 0x0B, 0x87, 0x6C, 0x63, 0x75, 0x75,
+    0x71, 0x6E, 0x6C, 0x71, 0x00, 0x44, 0x1C, 0x09, 0x19, 0x2C, 0x83, 0x75, 0x79, 0x6C, 0x71, 0x00,
+    0x04, 0x04, 0x0D, 0x16, 0x19, 0x6D, 0x4F, 0x8A, 0x4F, 0x99, 0x4F, 0xA9, 0x4F, 0x02, 0x06, 0x0B,
+    0x74, 0x4F, 0x7E, 0x4F, 0x42, 0x1B, 0x1B, 0x84, 0x63, 0x78, 0x61, 0x6D, 0x71, 0x00, 0x43, 0x06,
+    0x17, 0x1D, 0x85, 0x63, 0x74, 0x68, 0x61, 0x6D, 0x71, 0x00, 0x45, 0x12, 0x0E, 0x15, 0x13, 0x12,
+    0x86, 0x72, 0x70, 0x6B, 0x6F, 0x6A, 0x6D, 0x71, 0x00, 0x47, 0x18, 0x14, 0x09, 0x1C, 0x0F, 0x0B,
+    0x0C, 0x85, 0x71, 0x66, 0x75, 0x73, 0x6D, 0x71, 0x00, 0x44, 0x15, 0x14, 0x0E, 0x2C, 0x82, 0x6D,
+    0x76, 0x71, 0x00, 0x03, 0x08, 0x19, 0x1B, 0xBD, 0x4F, 0xCB, 0x4F, 0xE7, 0x4F, 0x45, 0x05, 0x10,
+    0x18, 0x12, 0x2C, 0x85, 0x6D, 0x75, 0x62, 0x65, 0x6E, 0x71, 0x00, 0x02, 0x0D, 0x1C, 0xD2, 0x4F,
+    0xDE, 0x4F, 0x44, 0x1B, 0x18, 0x15, 0x07, 0x84, 0x6A, 0x78, 0x76, 0x6E, 0x71, 0x00, 0x44, 0x11,
+    0x12, 0x06, 0x1B, 0x81, 0x71, 0x6E, 0x00, 0x47, 0x08, 0x19, 0x0F, 0x18, 0x1A, 0x05, 0x17, 0x84,
+    0x65, 0x76, 0x78, 0x6E, 0x71, 0x00, 0x04, 0x0B, 0x15, 0x16, 0x1C, 0x03, 0x50, 0x11, 0x50, 0x19,
+    0x50, 0x27, 0x50, 0x45, 0x08, 0x17, 0x1D, 0x1B, 0x14, 0x85, 0x74, 0x7A, 0x65, 0x68, 0x6F, 0x71,
+    0x00, 0x43, 0x0A, 0x14, 0x19, 0x81, 0x71, 0x6F, 0x00, 0x47, 0x12, 0x0B, 0x08, 0x0C, 0x1B, 0x1A,
+    0x10, 0x83, 0x73, 0x6F, 0x6F, 0x71, 0x00, 0x46, 0x08, 0x15, 0x0C, 0x09, 0x14, 0x05, 0x81, 0x71,
+    0x6F, 0x00, 0x04, 0x07, 0x0B, 0x0C, 0x1C, 0x3F, 0x50, 0x4B, 0x50, 0x59, 0x50, 0x65, 0x50, 0x43,
+    0x0B, 0x11, 0x12, 0x85, 0x6E, 0x6F, 0x68, 0x64, 0x70, 0x71, 0x00, 0x44, 0x0D, 0x0D, 0x12, 0x04,
+    0x86, 0x6F, 0x61, 0x6A, 0x6A, 0x68, 0x70, 0x71, 0x00, 0x43, 0x0D, 0x0C, 0x15, 0x85, 0x69, 0x72,
+    0x6A, 0x69, 0x70, 0x71, 0x00, 0x43, 0x0E, 0x19, 0x09, 0x85, 0x76, 0x66, 0x6B, 0x79, 0x70, 0x71,
+    0x00, 0x02, 0x13, 0x15, 0x78, 0x50, 0x82, 0x50, 0x43, 0x12, 0x13, 0x04, 0x83, 0x70, 0x6F, 0x71,
+    0x71, 0x00, 0x46, 0x0D, 0x0C, 0x10, 0x06, 0x09, 0x2C, 0x83, 0x72, 0x6A, 0x71, 0x71, 0x00, 0x02,
+    0x06, 0x09, 0x96, 0x50, 0x9F, 0x50, 0x43, 0x10, 0x05, 0x17, 0x82, 0x72, 0x63, 0x71, 0x00, 0x44,
+    0x07, 0x12, 0x11, 0x2C, 0x82, 0x72, 0x66, 0x71, 0x00, 0x45, 0x04, 0x12, 0x0B, 0x06, 0x14, 0x83,
+    0x61, 0x6F, 0x73, 0x71, 0x00, 0x48, 0x07, 0x0A, 0x08, 0x1A, 0x0E, 0x09, 0x0C, 0x0E, 0x86, 0x77,
+    0x6B, 0x65, 0x67, 0x64, 0x75, 0x71, 0x00, 0x02, 0x0A, 0x1A, 0xCE, 0x50, 0xFF, 0x50, 0x03, 0x11,
+    0x17, 0x1D, 0xD8, 0x50, 0xE8, 0x50, 0xF4, 0x50, 0x46, 0x07, 0x0D, 0x0C, 0x09, 0x0D, 0x0C, 0x86,
+    0x6A, 0x69, 0x64, 0x6E, 0x67, 0x76, 0x71, 0x00, 0x44, 0x19, 0x19, 0x1B, 0x1A, 0x84, 0x74, 0x76,
+    0x67, 0x76, 0x71, 0x00, 0x45, 0x04, 0x17, 0x12, 0x0F, 0x1C, 0x82, 0x76, 0x67, 0x71, 0x00, 0x44,
+    0x0A, 0x11, 0x16, 0x0C, 0x81, 0x71, 0x76, 0x00, 0x04, 0x0F, 0x15, 0x18, 0x19, 0x15, 0x51, 0x22,
+    0x51, 0x2F, 0x51, 0x39, 0x51, 0x46, 0x17, 0x1B, 0x18, 0x0D, 0x1B, 0x08, 0x83, 0x6C, 0x74, 0x77,
+    0x71, 0x00, 0x46, 0x18, 0x05, 0x08, 0x16, 0x0D, 0x13, 0x83, 0x72, 0x75, 0x77, 0x71, 0x00, 0x44,
+    0x0D, 0x07, 0x04, 0x0D, 0x82, 0x77, 0x75, 0x71, 0x00, 0x44, 0x04, 0x1A, 0x16, 0x18, 0x85, 0x77,
+    0x73, 0x61, 0x76, 0x77, 0x71, 0x00, 0x02, 0x07, 0x12, 0x4D, 0x51, 0x59, 0x51, 0x44, 0x0E, 0x0A,
+    0x18, 0x1C, 0x84, 0x6B, 0x67, 0x64, 0x78, 0x71, 0x00, 0x44, 0x07, 0x13, 0x0A, 0x13, 0x85, 0x70,
+    0x67, 0x64, 0x6F, 0x78, 0x71, 0x00, 0x05, 0x07, 0x0C, 0x10, 0x13, 0x18, 0x76, 0x51, 0x80, 0x51,
+    0x93, 0x51, 0x9F, 0x51, 0xAA, 0x51, 0x43, 0x09, 0x19, 0x04, 0x83, 0x64, 0x66, 0x79, 0x71, 0x00,
+    0x47, 0x15, 0x1C, 0x13, 0x1A, 0x19, 0x14, 0x0B, 0x88, 0x76, 0x71, 0x77, 0x70, 0x79, 0x72, 0x69,
+    0x79, 0x71, 0x00, 0x45, 0x1D, 0x1A, 0x0A, 0x1D, 0x2C, 0x83, 0x6D, 0x7A, 0x79, 0x71, 0x00, 0x45,
+    0x10, 0x18, 0x1C, 0x10, 0x16, 0x82, 0x79, 0x70, 0x71, 0x00, 0x44, 0x0C, 0x1D, 0x09, 0x17, 0x81,
+    0x71, 0x79, 0x00, 0x04, 0x10, 0x14, 0x16, 0x1C, 0xC0, 0x51, 0xCE, 0x51, 0xE0, 0x51, 0xEF, 0x51,
+    0x44, 0x0E, 0x19, 0x04, 0x14, 0x86, 0x61, 0x71, 0x76, 0x6B, 0x6D, 0x7A, 0x71, 0x00, 0x47, 0x12,
+    0x08, 0x13, 0x16, 0x13, 0x08, 0x1B, 0x87, 0x73, 0x70, 0x70, 0x65, 0x6F, 0x71, 0x7A, 0x71, 0x00,
+    0x46, 0x04, 0x1D, 0x12, 0x0A, 0x1D, 0x2C, 0x85, 0x7A, 0x6F, 0x61, 0x73, 0x7A, 0x71, 0x00, 0x43,
+    0x13, 0x1C, 0x0A, 0x81, 0x71, 0x7A, 0x00, 0x17, 0x04, 0x05, 0x06, 0x07, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x3D,
+    0x52, 0x80, 0x52, 0xB0, 0x52, 0xF2, 0x52, 0x43, 0x53, 0x7F, 0x53, 0xC0, 0x53, 0x0E, 0x54, 0x42,
+    0x54, 0x74, 0x54, 0x96, 0x54, 0xD4, 0x54, 0x1A, 0x55, 0x4D, 0x55, 0x84, 0x55, 0x93, 0x55, 0xD1,
+    0x55, 0xFF, 0x55, 0x10, 0x56, 0x5A, 0x56, 0x90, 0x56, 0xBC, 0x56, 0xDF, 0x56, 0x05, 0x0C, 0x0F,
+    0x12, 0x14, 0x16, 0x4D, 0x52, 0x56, 0x52, 0x60, 0x52, 0x69, 0x52, 0x77, 0x52, 0x43, 0x1A, 0x07,
+    0x07, 0x82, 0x61, 0x69, 0x72, 0x00, 0x43, 0x0D, 0x0A, 0x1B, 0x83, 0x6C, 0x6A, 0x61, 0x72, 0x00,
+    0x43, 0x0C, 0x14, 0x18, 0x82, 0x61, 0x6F, 0x72, 0x00, 0x45, 0x10, 0x08, 0x0D, 0x0C, 0x14, 0x85,
+    0x65, 0x6A, 0x6D, 0x71, 0x61, 0x72, 0x00, 0x44, 0x17, 0x13, 0x12, 0x16, 0x81, 0x72, 0x61, 0x00,
+    0x03, 0x08, 0x16, 0x1A, 0x8A, 0x52, 0x93, 0x52, 0xA2, 0x52, 0x44, 0x16, 0x07, 0x0D, 0x06, 0x81,
+    0x72, 0x62, 0x00, 0x46, 0x14, 0x15, 0x05, 0x10, 0x0F, 0x08, 0x85, 0x72, 0x62, 0x71, 0x73, 0x62,
+    0x72, 0x00, 0x46, 0x1A, 0x1C, 0x09, 0x1C, 0x13, 0x05, 0x84, 0x77, 0x79, 0x77, 0x62, 0x72, 0x00,
+    0x04, 0x0B, 0x0C, 0x13, 0x19, 0xBD, 0x52, 0xC8, 0x52, 0xD3, 0x52, 0xE1, 0x52, 0x43, 0x18, 0x06,
+    0x0D, 0x84, 0x75, 0x63, 0x68, 0x63, 0x72, 0x00, 0x43, 0x0E, 0x0F, 0x08, 0x84, 0x6B, 0x6C, 0x69,
+    0x63, 0x72, 0x00, 0x46, 0x16, 0x04, 0x14, 0x0D, 0x0A, 0x2C, 0x84, 0x73, 0x61, 0x70, 0x63, 0x72,
+    0x00, 0x47, 0x1C, 0x17, 0x04, 0x19, 0x13, 0x1D, 0x10, 0x86, 0x61, 0x76, 0x74, 0x79, 0x76, 0x63,
+    0x72, 0x00, 0x05, 0x09, 0x0B, 0x18, 0x1B, 0x1C, 0x02, 0x53, 0x0A, 0x53, 0x18, 0x53, 0x28, 0x53,
+    0x38, 0x53, 0x43, 0x09, 0x15, 0x0C, 0x81, 0x72, 0x64, 0x00, 0x45, 0x1B, 0x18, 0x11, 0x04, 0x11,
+    0x85, 0x75, 0x6E, 0x78, 0x68, 0x64, 0x72, 0x00, 0x46, 0x08, 0x0E, 0x06, 0x14, 0x1C, 0x2C, 0x86,
+    0x63, 0x71, 0x6B, 0x65, 0x75, 0x64, 0x72, 0x00, 0x45, 0x17, 0x06, 0x1D, 0x19, 0x15, 0x87, 0x76,
+    0x72, 0x7A, 0x63, 0x74, 0x78, 0x64, 0x72, 0x00, 0x44, 0x0C, 0x16, 0x0F, 0x18, 0x83, 0x79, 0x69,
+    0x64, 0x72, 0x00, 0x03, 0x08, 0x0B, 0x16, 0x4D, 0x53, 0x62, 0x53, 0x70, 0x53, 0x48, 0x19, 0x06,
+    0x17, 0x06, 0x04, 0x15, 0x07, 0x2C, 0x89, 0x72, 0x64, 0x61, 0x63, 0x74, 0x63, 0x76, 0x65, 0x66,
+    0x72, 0x00, 0x47, 0x1C, 0x13, 0x0C, 0x09, 0x1B, 0x1C, 0x1B, 0x83, 0x68, 0x79, 0x66, 0x72, 0x00,
+    0x45, 0x1C, 0x0D, 0x11, 0x1C, 0x04, 0x86, 0x6E, 0x79, 0x6A, 0x79, 0x73, 0x66, 0x72, 0x00, 0x04,
+    0x07, 0x0D, 0x10, 0x1D, 0x8C, 0x53, 0x97, 0x53, 0xA5, 0x53, 0xB3, 0x53, 0x46, 0x0B, 0x11, 0x0A,
+    0x1C, 0x0F, 0x2C, 0x81, 0x72, 0x67, 0x00, 0x47, 0x1D, 0x11, 0x11, 0x1B, 0x0A, 0x0C, 0x06, 0x83,
+    0x6A, 0x7A, 0x67, 0x72, 0x00, 0x45, 0x05, 0x15, 0x04, 0x16, 0x07, 0x85, 0x72, 0x61, 0x62, 0x6D,
+    0x67, 0x72, 0x00, 0x45, 0x0D, 0x06, 0x12, 0x17, 0x05, 0x84, 0x6A, 0x63, 0x7A, 0x67, 0x72, 0x00,
+    0x04, 0x08, 0x12, 0x14, 0x16, 0xCD, 0x53, 0xD8, 0x53, 0xE3, 0x53, 0xEE, 0x53, 0x44, 0x11, 0x08,
+    0x0F, 0x0F, 0x83, 0x65, 0x6E, 0x68, 0x72, 0x00, 0x43, 0x07, 0x16, 0x10, 0x84, 0x64, 0x73, 0x6F,
+    0x68, 0x72, 0x00, 0x44, 0x07, 0x0C, 0x11, 0x2C, 0x83, 0x71, 0x64, 0x68, 0x72, 0x00, 0x02, 0x0E,
+    0x13, 0xF5, 0x53, 0x02, 0x54, 0x46, 0x0F, 0x08, 0x0C, 0x10, 0x06, 0x0A, 0x83, 0x73, 0x6B, 0x68,
+    0x72, 0x00, 0x46, 0x1B, 0x1D, 0x1B, 0x04, 0x16, 0x1C, 0x82, 0x68, 0x73, 0x72, 0x00, 0x02, 0x08,
+    0x17, 0x15, 0x54, 0x35, 0x54, 0x02, 0x09, 0x12, 0x1C, 0x54, 0x27, 0x54, 0x44, 0x0A, 0x16, 0x04,
+    0x07, 0x83, 0x65, 0x66, 0x69, 0x72, 0x00, 0x44, 0x08, 0x16, 0x0B, 0x2C, 0x86, 0x73, 0x68, 0x65,
+    0x6F, 0x65, 0x69, 0x72, 0x00, 0x44, 0x10, 0x09, 0x10, 0x15, 0x85, 0x66, 0x6D, 0x6D, 0x74, 0x69,
+    0x72, 0x00, 0x03, 0x08, 0x10, 0x13, 0x4C, 0x54, 0x59, 0x54, 0x66, 0x54, 0x47, 0x0C, 0x16, 0x08,
+    0x09, 0x08, 0x1B, 0x1D, 0x82, 0x6A, 0x65, 0x72, 0x00, 0x45, 0x07, 0x09, 0x05, 0x11, 0x09, 0x84,
+    0x64, 0x66, 0x6D, 0x6A, 0x72, 0x00, 0x47, 0x15, 0x15, 0x12, 0x14, 0x04, 0x10, 0x14, 0x83, 0x70,
+    0x72, 0x6A, 0x72, 0x00, 0x02, 0x08, 0x10, 0x7B, 0x54, 0x89, 0x54, 0x45, 0x19, 0x09, 0x0B, 0x17,
+    0x0E, 0x85, 0x66, 0x68, 0x76, 0x65, 0x6C, 0x72, 0x00, 0x48, 0x1B, 0x10, 0x07, 0x0D, 0x11, 0x16,
+    0x1C, 0x2C, 0x81, 0x72, 0x6C, 0x00, 0x04, 0x04, 0x0F, 0x11, 0x1A, 0xA3, 0x54, 0xAF, 0x54, 0xBB,
+    0x54, 0xC6, 0x54, 0x46, 0x17, 0x11, 0x09, 0x08, 0x08, 0x0A, 0x82, 0x6D, 0x61, 0x72, 0x00, 0x44,
+    0x05, 0x14, 0x04, 0x0A, 0x84, 0x62, 0x71, 0x6C, 0x6D, 0x72, 0x00, 0x45, 0x0A, 0x13, 0x15, 0x06,
+    0x04, 0x82, 0x6D, 0x6E, 0x72, 0x00, 0x47, 0x08, 0x07, 0x18, 0x0E, 0x18, 0x0D, 0x1B, 0x83, 0x77,
+    0x65, 0x6D, 0x72, 0x00, 0x03, 0x06, 0x0D, 0x15, 0xDE, 0x54, 0xFD, 0x54, 0x0D, 0x55, 0x41, 0x18,
+    0x02, 0x13, 0x19, 0xE7, 0x54, 0xF1, 0x54, 0x44, 0x0A, 0x17, 0x0D, 0x19, 0x82, 0x6F, 0x63, 0x72,
+    0x00, 0x44, 0x10, 0x12, 0x13, 0x11, 0x84, 0x75, 0x76, 0x63, 0x6F, 0x72, 0x00, 0x47, 0x15, 0x0B,
+    0x0A, 0x0A, 0x12, 0x0E, 0x2C, 0x85, 0x68, 0x67, 0x72, 0x6A, 0x6F, 0x72, 0x00, 0x45, 0x17, 0x05,
+    0x0B, 0x16, 0x15, 0x84, 0x74, 0x62, 0x72, 0x6F, 0x72, 0x00, 0x03, 0x07, 0x0B, 0x1C, 0x24, 0x55,
+    0x35, 0x55, 0x42, 0x55, 0x48, 0x06, 0x1C, 0x0A, 0x07, 0x05, 0x10, 0x1B, 0x2C, 0x85, 0x79, 0x67,
+    0x63, 0x64, 0x70, 0x72, 0x00, 0x47, 0x1A, 0x10, 0x12, 0x05, 0x11, 0x0A, 0x1C, 0x82, 0x70, 0x68,
+    0x72, 0x00, 0x44, 0x0A, 0x12, 0x13, 0x1C, 0x83, 0x79, 0x67, 0x70, 0x72, 0x00, 0x03, 0x04, 0x05,
+    0x09, 0x57, 0x55, 0x66, 0x55, 0x7B, 0x55, 0x47, 0x08, 0x16, 0x11, 0x09, 0x1C, 0x0E, 0x13, 0x84,
+    0x65, 0x73, 0x61, 0x71, 0x72, 0x00, 0x48, 0x12, 0x17, 0x0C, 0x06, 0x08, 0x06, 0x15, 0x2C, 0x89,
+    0x63, 0x72, 0x65, 0x63, 0x69, 0x74, 0x6F, 0x62, 0x71, 0x72, 0x00, 0x43, 0x19, 0x09, 0x0B, 0x82,
+    0x71, 0x66, 0x72, 0x00, 0x47, 0x0F, 0x0F, 0x1C, 0x15, 0x1A, 0x10, 0x2C, 0x84, 0x6C, 0x79, 0x6C,
+    0x72, 0x72, 0x00, 0x04, 0x09, 0x0F, 0x16, 0x1C, 0xA0, 0x55, 0xAC, 0x55, 0xB7, 0x55, 0xC2, 0x55,
+    0x44, 0x0C, 0x05, 0x16, 0x1A, 0x84, 0x69, 0x62, 0x66, 0x73, 0x72, 0x00, 0x44, 0x19, 0x1A, 0x13,
+    0x14, 0x83, 0x6C, 0x76, 0x73, 0x72, 0x00, 0x46, 0x0D, 0x04, 0x10, 0x05, 0x1A, 0x07, 0x81, 0x72,
+    0x73, 0x00, 0x45, 0x19, 0x17, 0x18, 0x0C, 0x0C, 0x86, 0x75, 0x69, 0x74, 0x76, 0x79, 0x73, 0x72,
+    0x00, 0x03, 0x04, 0x11, 0x13, 0xDB, 0x55, 0xE7, 0x55, 0xF1, 0x55, 0x47, 0x1D, 0x0B, 0x09, 0x0C,
+    0x1C, 0x1B, 0x0C, 0x81, 0x72, 0x74, 0x00, 0x45, 0x0A, 0x05, 0x0D, 0x04, 0x07, 0x81, 0x72, 0x74,
+    0x00, 0x47, 0x1C, 0x06, 0x0A, 0x12, 0x17, 0x08, 0x18, 0x83, 0x70, 0x79, 0x74, 0x72, 0x00, 0x47,
+    0x09, 0x0B, 0x14, 0x11, 0x0C, 0x08, 0x12, 0x86, 0x6E, 0x69, 0x71, 0x68, 0x66, 0x75, 0x72, 0x00,
+    0x05, 0x05, 0x0A, 0x0D, 0x12, 0x19, 0x20, 0x56, 0x2C, 0x56, 0x39, 0x56, 0x46, 0x56, 0x51, 0x56,
+    0x45, 0x0D, 0x13, 0x1B, 0x09, 0x13, 0x83, 0x62, 0x6A, 0x76, 0x72, 0x00, 0x47, 0x04, 0x0A, 0x14,
+    0x09, 0x1C, 0x0D, 0x12, 0x82, 0x76, 0x67, 0x72, 0x00, 0x47, 0x19, 0x07, 0x10, 0x0F, 0x1C, 0x07,
+    0x10, 0x82, 0x76, 0x6A, 0x72, 0x00, 0x45, 0x17, 0x12, 0x13, 0x1A, 0x11, 0x82, 0x76, 0x6F, 0x72,
+    0x00, 0x44, 0x04, 0x1A, 0x0D, 0x2C, 0x81, 0x72, 0x76, 0x00, 0x02, 0x06, 0x0B, 0x61, 0x56, 0x82,
+    0x56, 0x02, 0x04, 0x19, 0x68, 0x56, 0x76, 0x56, 0x46, 0x13, 0x17, 0x14, 0x16, 0x10, 0x15, 0x84,
+    0x61, 0x70, 0x63, 0x77, 0x72, 0x00, 0x46, 0x09, 0x1D, 0x0D, 0x18, 0x06, 0x16, 0x82, 0x77, 0x63,
+    0x72, 0x00, 0x47, 0x0E, 0x0B, 0x10, 0x18, 0x15, 0x08, 0x2C, 0x83, 0x68, 0x6B, 0x77, 0x72, 0x00,
+    0x03, 0x05, 0x17, 0x18, 0x9A, 0x56, 0xA5, 0x56, 0xB4, 0x56, 0x46, 0x05, 0x12, 0x1B, 0x0A, 0x15,
+    0x14, 0x81, 0x72, 0x78, 0x00, 0x45, 0x0F, 0x04, 0x09, 0x17, 0x19, 0x86, 0x66, 0x74, 0x61, 0x6C,
+    0x74, 0x78, 0x72, 0x00, 0x43, 0x15, 0x0F, 0x1C, 0x81, 0x72, 0x78, 0x00, 0x02, 0x05, 0x10, 0xC3,
+    0x56, 0xD1, 0x56, 0x47, 0x13, 0x10, 0x0C, 0x08, 0x1B, 0x0E, 0x15, 0x83, 0x62, 0x70, 0x79, 0x72,
+    0x00, 0x47, 0x0E, 0x0C, 0x10, 0x17, 0x0C, 0x17, 0x1B, 0x83, 0x6D, 0x6B, 0x79, 0x72, 0x00, 0x44,
+    0x1B, 0x14, 0x10, 0x1A, 0x82, 0x7A, 0x78, 0x72, 0x00, 0x17, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B,
+    0x1C, 0x2F, 0x57, 0x4C, 0x57, 0x8F, 0x57, 0x9D, 0x57, 0xB3, 0x57, 0xEA, 0x57, 0x2F, 0x58, 0x3F,
+    0x58, 0x89, 0x58, 0xD3, 0x58, 0xE0, 0x58, 0x0E, 0x59, 0x2A, 0x59, 0x4E, 0x59, 0x5B, 0x59, 0x80,
+    0x59, 0x9E, 0x59, 0xC0, 0x59, 0xD4, 0x59, 0xE2, 0x59, 0x2D, 0x5A, 0x4D, 0x5A, 0x7D, 0x5A, 0x02,
+    0x0D, 0x16, 0x36, 0x57, 0x3E, 0x57, 0x43, 0x1C, 0x0F, 0x13, 0x81, 0x73, 0x61, 0x00, 0x45, 0x08,
+    0x0D, 0x12, 0x0D, 0x0E, 0x85, 0x6A, 0x6F, 0x65, 0x73, 0x61, 0x73, 0x00, 0x04, 0x05, 0x06, 0x0F,
+    0x11, 0x59, 0x57, 0x6D, 0x57, 0x7A, 0x57, 0x85, 0x57, 0x48, 0x19, 0x17, 0x14, 0x1B, 0x0B, 0x08,
+    0x04, 0x2C, 0x88, 0x68, 0x65, 0x78, 0x71, 0x74, 0x76, 0x62, 0x62, 0x73, 0x00, 0x46, 0x05, 0x0E,
+    0x10, 0x1C, 0x04, 0x1A, 0x83, 0x63, 0x62, 0x62, 0x73, 0x00, 0x44, 0x06, 0x1C, 0x05, 0x09, 0x83,
+    0x6C, 0x63, 0x62, 0x73, 0x00, 0x45, 0x0C, 0x07, 0x19, 0x07, 0x17, 0x81, 0x73, 0x62, 0x00, 0x45,
+    0x0A, 0x06, 0x0A, 0x18, 0x2C, 0x85, 0x67, 0x75, 0x63, 0x67, 0x63, 0x73, 0x00, 0x49, 0x0D, 0x07,
+    0x1A, 0x15, 0x0E, 0x05, 0x05, 0x16, 0x2C, 0x89, 0x62, 0x73, 0x62, 0x6B, 0x72, 0x77, 0x64, 0x6A,
+    0x64, 0x73, 0x00, 0x03, 0x0B, 0x0D, 0x19, 0xBD, 0x57, 0xD1, 0x57, 0xDE, 0x57, 0x47, 0x1C, 0x1C,
+    0x17, 0x0E, 0x1C, 0x13, 0x16, 0x89, 0x70, 0x73, 0x79, 0x6B, 0x74, 0x79, 0x79, 0x68, 0x65, 0x73,
+    0x00, 0x48, 0x06, 0x0A, 0x0F, 0x0A, 0x1B, 0x0B, 0x0D, 0x2C, 0x81, 0x73, 0x65, 0x00, 0x43, 0x19,
+    0x14, 0x0F, 0x85, 0x71, 0x6C, 0x76, 0x76, 0x65, 0x73, 0x00, 0x03, 0x0A, 0x0F, 0x16, 0xF4, 0x57,
+    0x19, 0x58, 0x25, 0x58, 0x02, 0x07, 0x11, 0xFB, 0x57, 0x06, 0x58, 0x44, 0x0D, 0x19, 0x0D, 0x15,
+    0x83, 0x67, 0x64, 0x66, 0x73, 0x00, 0x46, 0x09, 0x17, 0x0E, 0x1A, 0x07, 0x0B, 0x89, 0x64, 0x68,
+    0x77, 0x6B, 0x74, 0x66, 0x6E, 0x67, 0x66, 0x73, 0x00, 0x45, 0x16, 0x17, 0x0B, 0x1B, 0x17, 0x83,
+    0x6C, 0x73, 0x66, 0x73, 0x00, 0x43, 0x1A, 0x04, 0x16, 0x83, 0x73, 0x77, 0x66, 0x73, 0x00, 0x46,
+    0x0A, 0x18, 0x1D, 0x0E, 0x1A, 0x1D, 0x86, 0x6B, 0x77, 0x7A, 0x75, 0x67, 0x67, 0x73, 0x00, 0x04,
+    0x0A, 0x11, 0x16, 0x17, 0x4C, 0x58, 0x57, 0x58, 0x62, 0x58, 0x7E, 0x58, 0x43, 0x15, 0x11, 0x17,
+    0x84, 0x72, 0x6E, 0x67, 0x69, 0x73, 0x00, 0x45, 0x11, 0x0E, 0x0D, 0x0A, 0x2C, 0x82, 0x69, 0x6E,
+    0x73, 0x00, 0x02, 0x06, 0x0C, 0x69, 0x58, 0x72, 0x58, 0x42, 0x11, 0x0A, 0x83, 0x73, 0x63, 0x69,
+    0x73, 0x00, 0x45, 0x07, 0x18, 0x19, 0x0A, 0x19, 0x83, 0x73, 0x69, 0x69, 0x73, 0x00, 0x44, 0x14,
+    0x11, 0x04, 0x1B, 0x83, 0x74, 0x71, 0x69, 0x73, 0x00, 0x05, 0x08, 0x0E, 0x10, 0x11, 0x1B, 0x99,
+    0x58, 0xA6, 0x58, 0xB2, 0x58, 0xBB, 0x58, 0xC8, 0x58, 0x48, 0x11, 0x1D, 0x05, 0x16, 0x13, 0x13,
+    0x0B, 0x2C, 0x81, 0x73, 0x6A, 0x00, 0x46, 0x1D, 0x0A, 0x11, 0x15, 0x16, 0x19, 0x82, 0x6A, 0x6B,
+    0x73, 0x00, 0x44, 0x1A, 0x11, 0x04, 0x04, 0x81, 0x73, 0x6A, 0x00, 0x44, 0x12, 0x04, 0x18, 0x07,
+    0x85, 0x61, 0x75, 0x6F, 0x6E, 0x6A, 0x73, 0x00, 0x44, 0x10, 0x14, 0x05, 0x09, 0x83, 0x78, 0x6D,
+    0x6A, 0x73, 0x00, 0x45, 0x0F, 0x17, 0x0A, 0x15, 0x1C, 0x84, 0x74, 0x67, 0x6C, 0x6B, 0x73, 0x00,
+    0x03, 0x0C, 0x15, 0x19, 0xEA, 0x58, 0xF5, 0x58, 0xFF, 0x58, 0x43, 0x10, 0x05, 0x0C, 0x84, 0x6D,
+    0x62, 0x69, 0x6C, 0x73, 0x00, 0x44, 0x0E, 0x15, 0x12, 0x0A, 0x82, 0x6C, 0x72, 0x73, 0x00, 0x46,
+    0x09, 0x06, 0x14, 0x0F, 0x0F, 0x1A, 0x85, 0x63, 0x71, 0x66, 0x76, 0x6C, 0x73, 0x00, 0x02, 0x15,
+    0x1B, 0x15, 0x59, 0x1D, 0x59, 0x43, 0x0D, 0x06, 0x16, 0x81, 0x73, 0x6D, 0x00, 0x44, 0x0C, 0x0E,
+    0x1B, 0x2C, 0x85, 0x6B, 0x78, 0x69, 0x78, 0x6D, 0x73, 0x00, 0x02, 0x0C, 0x1C, 0x31, 0x59, 0x44,
+    0x59, 0x47, 0x13, 0x07, 0x13, 0x04, 0x11, 0x0B, 0x13, 0x88, 0x6E, 0x68, 0x61, 0x70, 0x64, 0x70,
+    0x69, 0x6F, 0x73, 0x00, 0x45, 0x0E, 0x0F, 0x08, 0x05, 0x08, 0x81, 0x73, 0x6F, 0x00, 0x44, 0x16,
+    0x18, 0x0B, 0x0A, 0x85, 0x68, 0x67, 0x75, 0x73, 0x70, 0x73, 0x00, 0x02, 0x0B, 0x14, 0x62, 0x59,
+    0x71, 0x59, 0x46, 0x11, 0x09, 0x11, 0x04, 0x06, 0x09, 0x85, 0x66, 0x6E, 0x6E, 0x68, 0x71, 0x73,
+    0x00, 0x47, 0x0D, 0x19, 0x07, 0x07, 0x08, 0x17, 0x06, 0x84, 0x6A, 0x76, 0x71, 0x71, 0x73, 0x00,
+    0x02, 0x12, 0x1A, 0x87, 0x59, 0x92, 0x59, 0x46, 0x05, 0x0A, 0x09, 0x15, 0x1B, 0x2C, 0x81, 0x73,
+    0x72, 0x00, 0x43, 0x17, 0x0E, 0x0F, 0x85, 0x6B, 0x6C, 0x74, 0x77, 0x72, 0x73, 0x00, 0x02, 0x05,
+    0x0F, 0xA5, 0x59, 0xB2, 0x59, 0x45, 0x14, 0x11, 0x19, 0x16, 0x11, 0x84, 0x71, 0x6E, 0x62, 0x73,
+    0x73, 0x00, 0x46, 0x0E, 0x04, 0x0E, 0x1B, 0x04, 0x1A, 0x84, 0x6B, 0x61, 0x6C, 0x73, 0x73, 0x00,
+    0x48, 0x11, 0x0A, 0x13, 0x10, 0x16, 0x0D, 0x1B, 0x0E, 0x88, 0x6A, 0x78, 0x73, 0x6D, 0x70, 0x67,
+    0x6E, 0x74, 0x73, 0x00, 0x46, 0x1B, 0x04, 0x06, 0x1B, 0x0B, 0x0E, 0x84, 0x61, 0x63, 0x78, 0x75,
+    0x73, 0x00, 0x04, 0x06, 0x07, 0x0C, 0x11, 0xEF, 0x59, 0x04, 0x5A, 0x14, 0x5A, 0x22, 0x5A, 0x48,
+    0x09, 0x0C, 0x18, 0x13, 0x11, 0x13, 0x17, 0x2C, 0x89, 0x70, 0x74, 0x6E, 0x70, 0x75, 0x69, 0x66,
+    0x63, 0x76, 0x73, 0x00, 0x47, 0x0A, 0x0E, 0x0C, 0x0E, 0x08, 0x12, 0x2C, 0x85, 0x6B, 0x69, 0x67,
+    0x64, 0x76, 0x73, 0x00, 0x44, 0x0A, 0x04, 0x1C, 0x0B, 0x86, 0x79, 0x68, 0x61, 0x67, 0x69, 0x76,
+    0x73, 0x00, 0x46, 0x19, 0x18, 0x0E, 0x06, 0x13, 0x11, 0x81, 0x73, 0x76, 0x00, 0x02, 0x18, 0x1D,
+    0x34, 0x5A, 0x40, 0x5A, 0x44, 0x0B, 0x1A, 0x08, 0x0A, 0x84, 0x68, 0x77, 0x75, 0x77, 0x73, 0x00,
+    0x47, 0x1D, 0x0F, 0x16, 0x1C, 0x0B, 0x16, 0x18, 0x82, 0x77, 0x7A, 0x73, 0x00, 0x03, 0x05, 0x0C,
+    0x1B, 0x57, 0x5A, 0x64, 0x5A, 0x70, 0x5A, 0x46, 0x07, 0x0A, 0x0A, 0x13, 0x10, 0x2C, 0x83, 0x62,
+    0x64, 0x78, 0x73, 0x00, 0x44, 0x10, 0x0A, 0x1A, 0x06, 0x84, 0x6D, 0x67, 0x69, 0x78, 0x73, 0x00,
+    0x45, 0x07, 0x1B, 0x18, 0x1A, 0x12, 0x84, 0x64, 0x78, 0x78, 0x78, 0x73, 0x00, 0x03, 0x04, 0x09,
+    0x16, 0x87, 0x5A, 0x92, 0x5A, 0x9B, 0x5A, 0x45, 0x08, 0x12, 0x1D, 0x06, 0x0E, 0x82, 0x79, 0x61,
+    0x73, 0x00, 0x44, 0x1D, 0x0E, 0x07, 0x15, 0x81, 0x73, 0x79, 0x00, 0x43, 0x10, 0x0B, 0x0D, 0x82,
+    0x79, 0x73, 0x73, 0x00, 0x16, 0x04, 0x05, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0D, 0x0E, 0x0F, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1C, 0xE7, 0x5A, 0x33, 0x5B, 0x66,
+    0x5B, 0xA2, 0x5B, 0xC1, 0x5B, 0xCF, 0x5B, 0x0C, 0x5C, 0x5E, 0x5C, 0x6D, 0x5C, 0xAE, 0x5C, 0xCC,
+    0x5C, 0x22, 0x5D, 0x48, 0x5D, 0x6B, 0x5D, 0x7D, 0x5D, 0xA9, 0x5D, 0xFB, 0x5D, 0x36, 0x5E, 0x58,
+    0x5E, 0x62, 0x5E, 0xAD, 0x5E, 0x0E, 0x5F, 0x04, 0x0A, 0x0B, 0x0F, 0x11, 0xF4, 0x5A, 0xFE, 0x5A,
+    0x0A, 0x5B, 0x13, 0x5B, 0x45, 0x15, 0x1C, 0x12, 0x16, 0x1B, 0x81, 0x74, 0x61, 0x00, 0x46, 0x1D,
+    0x14, 0x18, 0x17, 0x17, 0x2C, 0x82, 0x61, 0x68, 0x74, 0x00, 0x43, 0x09, 0x05, 0x08, 0x82, 0x61,
+    0x6C, 0x74, 0x00, 0x02, 0x0A, 0x12, 0x1A, 0x5B, 0x28, 0x5B, 0x45, 0x0A, 0x10, 0x0C, 0x15, 0x07,
+    0x85, 0x67, 0x6D, 0x67, 0x6E, 0x61, 0x74, 0x00, 0x44, 0x0A, 0x17, 0x15, 0x1D, 0x83, 0x6E, 0x6F,
+    0x61, 0x74, 0x00, 0x04, 0x0A, 0x0D, 0x12, 0x17, 0x40, 0x5B, 0x4C, 0x5B, 0x55, 0x5B, 0x5E, 0x5B,
+    0x43, 0x1B, 0x16, 0x08, 0x85, 0x73, 0x65, 0x78, 0x67, 0x62, 0x74, 0x00, 0x44, 0x04, 0x18, 0x13,
+    0x18, 0x81, 0x74, 0x62, 0x00, 0x43, 0x13, 0x1C, 0x0D, 0x82, 0x62, 0x6F, 0x74, 0x00, 0x43, 0x18,
+    0x05, 0x0B, 0x81, 0x74, 0x62, 0x00, 0x04, 0x04, 0x07, 0x14, 0x1A, 0x73, 0x5B, 0x7D, 0x5B, 0x88,
+    0x5B, 0x95, 0x5B, 0x44, 0x0E, 0x1D, 0x13, 0x1D, 0x82, 0x64, 0x61, 0x74, 0x00, 0x46, 0x1C, 0x1D,
+    0x12, 0x10, 0x0E, 0x11, 0x81, 0x74, 0x64, 0x00, 0x45, 0x10, 0x19, 0x1D, 0x19, 0x07, 0x84, 0x6D,
+    0x76, 0x71, 0x64, 0x74, 0x00, 0x45, 0x19, 0x0D, 0x18, 0x08, 0x0D, 0x84, 0x76, 0x6A, 0x77, 0x64,
+    0x74, 0x00, 0x02, 0x0E, 0x11, 0xA9, 0x5B, 0xB7, 0x5B, 0x45, 0x17, 0x14, 0x1D, 0x0A, 0x0B, 0x85,
+    0x71, 0x7A, 0x74, 0x6B, 0x65, 0x74, 0x00, 0x44, 0x17, 0x0B, 0x08, 0x1C, 0x82, 0x65, 0x6E, 0x74,
+    0x00, 0x46, 0x10, 0x11, 0x14, 0x0A, 0x19, 0x16, 0x84, 0x6E, 0x71, 0x6D, 0x66, 0x74, 0x00, 0x04,
+    0x05, 0x0E, 0x17, 0x19, 0xDC, 0x5B, 0xE6, 0x5B, 0xF3, 0x5B, 0xFD, 0x5B, 0x45, 0x06, 0x0E, 0x04,
+    0x08, 0x06, 0x81, 0x74, 0x67, 0x00, 0x47, 0x08, 0x17, 0x1B, 0x05, 0x06, 0x19, 0x17, 0x82, 0x67,
+    0x6B, 0x74, 0x00, 0x45, 0x06, 0x07, 0x06, 0x10, 0x07, 0x81, 0x74, 0x67, 0x00, 0x45, 0x17, 0x0C,
+    0x1D, 0x15, 0x0F, 0x86, 0x7A, 0x72, 0x69, 0x74, 0x76, 0x67, 0x74, 0x00, 0x04, 0x0C, 0x0F, 0x1B,
+    0x1D, 0x19, 0x5C, 0x29, 0x5C, 0x38, 0x5C, 0x40, 0x5C, 0x45, 0x1C, 0x1A, 0x1D, 0x14, 0x04, 0x87,
+    0x71, 0x61, 0x7A, 0x77, 0x79, 0x69, 0x68, 0x74, 0x00, 0x45, 0x1A, 0x16, 0x19, 0x0B, 0x16, 0x86,
+    0x76, 0x68, 0x73, 0x77, 0x6C, 0x68, 0x74, 0x00, 0x43, 0x15, 0x09, 0x0B, 0x81, 0x74, 0x68, 0x00,
+    0x02, 0x12, 0x16, 0x47, 0x5C, 0x52, 0x5C, 0x44, 0x16, 0x11, 0x0D, 0x2C, 0x83, 0x7A, 0x6F, 0x68,
+    0x74, 0x00, 0x43, 0x07, 0x06, 0x18, 0x85, 0x64, 0x63, 0x73, 0x7A, 0x68, 0x74, 0x00, 0x46, 0x15,
+    0x1B, 0x0E, 0x08, 0x0E, 0x04, 0x85, 0x6B, 0x65, 0x78, 0x72, 0x6A, 0x74, 0x00, 0x04, 0x04, 0x06,
+    0x14, 0x19, 0x7A, 0x5C, 0x8B, 0x5C, 0x95, 0x5C, 0xA6, 0x5C, 0x47, 0x05, 0x0E, 0x12, 0x13, 0x0B,
+    0x10, 0x2C, 0x86, 0x6F, 0x70, 0x6B, 0x62, 0x61, 0x6B, 0x74, 0x00, 0x44, 0x0A, 0x0C, 0x18, 0x2C,
+    0x82, 0x6B, 0x63, 0x74, 0x00, 0x46, 0x09, 0x1D, 0x08, 0x15, 0x0E, 0x13, 0x87, 0x72, 0x6B, 0x65,
+    0x7A, 0x66, 0x71, 0x6B, 0x74, 0x00, 0x43, 0x16, 0x09, 0x16, 0x81, 0x74, 0x6B, 0x00, 0x02, 0x0B,
+    0x0F, 0xB5, 0x5C, 0xC1, 0x5C, 0x47, 0x07, 0x1B, 0x06, 0x07, 0x0B, 0x17, 0x11, 0x81, 0x74, 0x6C,
+    0x00, 0x44, 0x07, 0x16, 0x0F, 0x1D, 0x83, 0x6C, 0x64, 0x6C, 0x74, 0x00, 0x05, 0x08, 0x0E, 0x16,
+    0x19, 0x1B, 0xDC, 0x5C, 0xEA, 0x5C, 0xFD, 0x5C, 0x0C, 0x5D, 0x17, 0x5D, 0x47, 0x07, 0x0C, 0x1B,
+    0x0C, 0x1C, 0x1B, 0x14, 0x83, 0x65, 0x64, 0x6D, 0x74, 0x00, 0x47, 0x0D, 0x0F, 0x0B, 0x10, 0x07,
+    0x14, 0x1C, 0x88, 0x64, 0x71, 0x6D, 0x68, 0x6C, 0x6A, 0x6B, 0x6D, 0x74, 0x00, 0x46, 0x07, 0x09,
+    0x0B, 0x0E, 0x18, 0x0E, 0x85, 0x66, 0x68, 0x64, 0x73, 0x6D, 0x74, 0x00, 0x44, 0x13, 0x06, 0x0B,
+    0x0A, 0x83, 0x76, 0x70, 0x6D, 0x74, 0x00, 0x44, 0x1C, 0x05, 0x15, 0x05, 0x83, 0x78, 0x79, 0x6D,
+    0x74, 0x00, 0x02, 0x09, 0x12, 0x29, 0x5D, 0x3A, 0x5D, 0x46, 0x16, 0x0C, 0x04, 0x06, 0x16, 0x11,
+    0x87, 0x63, 0x73, 0x61, 0x69, 0x73, 0x66, 0x6E, 0x74, 0x00, 0x47, 0x0C, 0x1D, 0x15, 0x0D, 0x0D,
+    0x1B, 0x09, 0x83, 0x6F, 0x69, 0x6E, 0x74, 0x00, 0x02, 0x14, 0x15, 0x4F, 0x5D, 0x5B, 0x5D, 0x45,
+    0x13, 0x13, 0x15, 0x15, 0x16, 0x83, 0x71, 0x70, 0x6F, 0x74, 0x00, 0x45, 0x12, 0x11, 0x06, 0x05,
+    0x1B, 0x87, 0x62, 0x78, 0x63, 0x6E, 0x6F, 0x72, 0x6F, 0x74, 0x00, 0x47, 0x10, 0x17, 0x15, 0x16,
+    0x0F, 0x14, 0x1D, 0x87, 0x6C, 0x71, 0x73, 0x72, 0x74, 0x6D, 0x70, 0x74, 0x00, 0x03, 0x09, 0x0A,
+    0x1D, 0x87, 0x5D, 0x94, 0x5D, 0xA0, 0x5D, 0x47, 0x1B, 0x05, 0x12, 0x05, 0x09, 0x1B, 0x2C, 0x82,
+    0x71, 0x66, 0x74, 0x00, 0x43, 0x08, 0x17, 0x0B, 0x85, 0x74, 0x68, 0x65, 0x67, 0x71, 0x74, 0x00,
+    0x43, 0x0B, 0x0B, 0x06, 0x82, 0x71, 0x7A, 0x74, 0x00, 0x04, 0x06, 0x11, 0x13, 0x1D, 0xB6, 0x5D,
+    0xC8, 0x5D, 0xD6, 0x5D, 0xF2, 0x5D, 0x46, 0x08, 0x12, 0x1C, 0x08, 0x1C, 0x05, 0x88, 0x79, 0x62,
+    0x65, 0x79, 0x6F, 0x65, 0x63, 0x72, 0x74, 0x00, 0x45, 0x18, 0x09, 0x1A, 0x18, 0x2C, 0x85, 0x66,
+    0x77, 0x75, 0x6E, 0x72, 0x74, 0x00, 0x02, 0x07, 0x10, 0xDD, 0x5D, 0xEA, 0x5D, 0x46, 0x17, 0x15,
+    0x18, 0x1B, 0x08, 0x2C, 0x83, 0x70, 0x64, 0x72, 0x74, 0x00, 0x43, 0x0B, 0x09, 0x2C, 0x81, 0x74,
+    0x72, 0x00, 0x43, 0x10, 0x1A, 0x0C, 0x82, 0x72, 0x7A, 0x74, 0x00, 0x04, 0x05, 0x0A, 0x18, 0x19,
+    0x08, 0x5E, 0x15, 0x5E, 0x21, 0x5E, 0x2D, 0x5E, 0x47, 0x05, 0x17, 0x1D, 0x09, 0x08, 0x0A, 0x2C,
+    0x82, 0x73, 0x62, 0x74, 0x00, 0x46, 0x0A, 0x19, 0x07, 0x07, 0x14, 0x0E, 0x82, 0x73, 0x67, 0x74,
+    0x00, 0x45, 0x0C, 0x09, 0x06, 0x07, 0x2C, 0x83, 0x75, 0x69, 0x73, 0x74, 0x00, 0x44, 0x0E, 0x12,
+    0x06, 0x16, 0x81, 0x74, 0x73, 0x00, 0x02, 0x0F, 0x17, 0x3D, 0x5E, 0x48, 0x5E, 0x43, 0x1B, 0x04,
+    0x0C, 0x84, 0x78, 0x61, 0x6C, 0x74, 0x74, 0x00, 0x45, 0x14, 0x0E, 0x0F, 0x0F, 0x1A, 0x87, 0x6C,
+    0x77, 0x6C, 0x6B, 0x71, 0x74, 0x74, 0x74, 0x00, 0x44, 0x11, 0x06, 0x12, 0x10, 0x82, 0x75, 0x6E,
+    0x74, 0x00, 0x04, 0x09, 0x0B, 0x0D, 0x11, 0x6F, 0x5E, 0x81, 0x5E, 0x92, 0x5E, 0x9F, 0x5E, 0x47,
+    0x07, 0x15, 0x13, 0x1D, 0x1C, 0x04, 0x09, 0x87, 0x7A, 0x79, 0x70, 0x72, 0x64, 0x66, 0x76, 0x74,
+    0x00, 0x48, 0x12, 0x1C, 0x0E, 0x17, 0x15, 0x06, 0x07, 0x2C, 0x85, 0x79, 0x6B, 0x6F, 0x68, 0x76,
+    0x74, 0x00, 0x44, 0x1A, 0x05, 0x1B, 0x2C, 0x85, 0x62, 0x78, 0x77, 0x6A, 0x76, 0x74, 0x00, 0x48,
+    0x04, 0x16, 0x19, 0x18, 0x0C, 0x08, 0x09, 0x2C, 0x82, 0x76, 0x6E, 0x74, 0x00, 0x06, 0x0E, 0x10,
+    0x15, 0x16, 0x18, 0x1D, 0xC0, 0x5E, 0xD1, 0x5E, 0xDA, 0x5E, 0xE8, 0x5E, 0xF3, 0x5E, 0xFF, 0x5E,
+    0x47, 0x04, 0x15, 0x15, 0x1A, 0x17, 0x1A, 0x2C, 0x86, 0x72, 0x77, 0x72, 0x61, 0x6B, 0x77, 0x74,
+    0x00, 0x44, 0x1D, 0x07, 0x04, 0x09, 0x81, 0x74, 0x77, 0x00, 0x44, 0x09, 0x0B, 0x04, 0x18, 0x86,
+    0x61, 0x75, 0x68, 0x66, 0x72, 0x77, 0x74, 0x00, 0x44, 0x04, 0x08, 0x06, 0x07, 0x83, 0x73, 0x61,
+    0x77, 0x74, 0x00, 0x47, 0x1D, 0x19, 0x17, 0x1D, 0x0F, 0x13, 0x2C, 0x81, 0x74, 0x77, 0x00, 0x46,
+    0x15, 0x1C, 0x07, 0x16, 0x12, 0x2C, 0x85, 0x79, 0x64, 0x72, 0x7A, 0x77, 0x74, 0x00, 0x05, 0x04,
+    0x0E, 0x19, 0x1B, 0x1D, 0x1E, 0x5F, 0x32, 0x5F, 0x3F, 0x5F, 0x50, 0x5F, 0x5E, 0x5F, 0x48, 0x07,
+    0x11, 0x0F, 0x11, 0x13, 0x05, 0x05, 0x2C, 0x88, 0x70, 0x62, 0x6E, 0x6C, 0x6E, 0x64, 0x61, 0x79,
+    0x74, 0x00, 0x45, 0x16, 0x09, 0x05, 0x11, 0x07, 0x84, 0x73, 0x66, 0x6B, 0x79, 0x74, 0x00, 0x46,
+    0x0D, 0x0B, 0x12, 0x0F, 0x0B, 0x2C, 0x87, 0x6C, 0x68, 0x6F, 0x68, 0x6A, 0x76, 0x79, 0x74, 0x00,
+    0x45, 0x04, 0x19, 0x06, 0x18, 0x2C, 0x85, 0x76, 0x63, 0x61, 0x78, 0x79, 0x74, 0x00, 0x47, 0x04,
+    0x04, 0x16, 0x13, 0x10, 0x15, 0x15, 0x85, 0x61, 0x73, 0x61, 0x7A, 0x79, 0x74, 0x00, 0x16, 0x04,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+    0x16, 0x18, 0x19, 0x1C, 0x1D, 0xB1, 0x5F, 0xD4, 0x5F, 0x0C, 0x60, 0x1C, 0x60, 0x44, 0x60, 0x76,
+    0x60, 0xC6, 0x60, 0xF0, 0x60, 0x3D, 0x61, 0x51, 0x61, 0x5F, 0x61, 0x9E, 0x61, 0x06, 0x62, 0x3F,
+    0x62, 0x7A, 0x62, 0xAD, 0x62, 0x04, 0x63, 0x23, 0x63, 0x63, 0x63, 0x88, 0x63, 0xBE, 0x63, 0xE5,
+    0x63, 0x02, 0x0C, 0x1A, 0xB8, 0x5F, 0xC6, 0x5F, 0x46, 0x1A, 0x09, 0x0B, 0x11, 0x08, 0x08, 0x84,
+    0x77, 0x66, 0x69, 0x61, 0x75, 0x00, 0x47, 0x0F, 0x18, 0x06, 0x1B, 0x0D, 0x05, 0x07, 0x83, 0x77,
+    0x6C, 0x61, 0x75, 0x00, 0x04, 0x08, 0x11, 0x14, 0x18, 0xE1, 0x5F, 0xEE, 0x5F, 0xFB, 0x5F, 0x03,
+    0x60, 0x45, 0x1A, 0x07, 0x12, 0x05, 0x0B, 0x84, 0x77, 0x64, 0x65, 0x63, 0x75, 0x00, 0x47, 0x16,
+    0x09, 0x15, 0x18, 0x07, 0x0D, 0x2C, 0x82, 0x63, 0x6E, 0x75, 0x00, 0x43, 0x05, 0x18, 0x0F, 0x81,
+    0x75, 0x63, 0x00, 0x44, 0x09, 0x08, 0x04, 0x1D, 0x81, 0x75, 0x63, 0x00, 0x46, 0x15, 0x15, 0x17,
+    0x0A, 0x13, 0x17, 0x86, 0x67, 0x70, 0x74, 0x72, 0x72, 0x64, 0x75, 0x00, 0x03, 0x09, 0x15, 0x19,
+    0x26, 0x60, 0x30, 0x60, 0x3A, 0x60, 0x44, 0x19, 0x13, 0x0C, 0x0A, 0x82, 0x65, 0x66, 0x75, 0x00,
+    0x44, 0x04, 0x0C, 0x1B, 0x18, 0x82, 0x65, 0x72, 0x75, 0x00, 0x43, 0x1A, 0x14, 0x0F, 0x83, 0x76,
+    0x77, 0x65, 0x75, 0x00, 0x03, 0x0B, 0x10, 0x1A, 0x4E, 0x60, 0x5B, 0x60, 0x69, 0x60, 0x45, 0x09,
+    0x0B, 0x0E, 0x07, 0x04, 0x84, 0x66, 0x68, 0x68, 0x66, 0x75, 0x00, 0x47, 0x1A, 0x12, 0x1A, 0x18,
+    0x14, 0x1D, 0x0A, 0x83, 0x6D, 0x77, 0x66, 0x75, 0x00, 0x44, 0x15, 0x0F, 0x1C, 0x2C, 0x85, 0x6C,
+    0x79, 0x72, 0x77, 0x66, 0x75, 0x00, 0x05, 0x0B, 0x10, 0x13, 0x18, 0x19, 0x86, 0x60, 0x8E, 0x60,
+    0x9A, 0x60, 0xA7, 0x60, 0xB8, 0x60, 0x43, 0x05, 0x0E, 0x05, 0x81, 0x75, 0x67, 0x00, 0x45, 0x1D,
+    0x07, 0x0B, 0x05, 0x2C, 0x83, 0x6D, 0x7A, 0x67, 0x75, 0x00, 0x45, 0x08, 0x07, 0x05, 0x1D, 0x1B,
+    0x84, 0x65, 0x64, 0x70, 0x67, 0x75, 0x00, 0x46, 0x05, 0x10, 0x0C, 0x0E, 0x1D, 0x2C, 0x87, 0x6B,
+    0x7A, 0x69, 0x6D, 0x62, 0x75, 0x67, 0x75, 0x00, 0x48, 0x10, 0x05, 0x0B, 0x08, 0x08, 0x0C, 0x14,
+    0x2C, 0x82, 0x67, 0x76, 0x75, 0x00, 0x03, 0x06, 0x0F, 0x19, 0xD0, 0x60, 0xD9, 0x60, 0xE5, 0x60,
+    0x44, 0x14, 0x09, 0x1B, 0x1A, 0x81, 0x75, 0x68, 0x00, 0x46, 0x18, 0x1B, 0x0A, 0x07, 0x14, 0x0A,
+    0x82, 0x68, 0x6C, 0x75, 0x00, 0x43, 0x0C, 0x14, 0x12, 0x84, 0x69, 0x71, 0x76, 0x68, 0x75, 0x00,
+    0x04, 0x05, 0x0D, 0x12, 0x16, 0xFD, 0x60, 0x11, 0x61, 0x22, 0x61, 0x2E, 0x61, 0x48, 0x0D, 0x15,
+    0x04, 0x0B, 0x1D, 0x1B, 0x0E, 0x2C, 0x88, 0x7A, 0x78, 0x68, 0x61, 0x72, 0x6A, 0x62, 0x69, 0x75,
+    0x00, 0x48, 0x0A, 0x17, 0x1B, 0x0F, 0x09, 0x14, 0x14, 0x2C, 0x85, 0x74, 0x78, 0x67, 0x6A, 0x69,
+    0x75, 0x00, 0x44, 0x07, 0x11, 0x11, 0x0C, 0x84, 0x64, 0x6E, 0x6F, 0x69, 0x75, 0x00, 0x47, 0x18,
+    0x07, 0x10, 0x19, 0x19, 0x1B, 0x05, 0x84, 0x75, 0x64, 0x73, 0x69, 0x75, 0x00, 0x48, 0x0A, 0x16,
+    0x13, 0x06, 0x0C, 0x0A, 0x1C, 0x1A, 0x88, 0x67, 0x79, 0x69, 0x63, 0x70, 0x73, 0x67, 0x6A, 0x75,
+    0x00, 0x45, 0x11, 0x1B, 0x16, 0x15, 0x1C, 0x85, 0x73, 0x72, 0x78, 0x6E, 0x6B, 0x75, 0x00, 0x04,
+    0x07, 0x09, 0x0F, 0x17, 0x6C, 0x61, 0x7A, 0x61, 0x87, 0x61, 0x95, 0x61, 0x46, 0x05, 0x11, 0x15,
+    0x18, 0x0E, 0x2C, 0x84, 0x62, 0x6E, 0x64, 0x6C, 0x75, 0x00, 0x46, 0x0F, 0x1D, 0x1D, 0x1A, 0x09,
+    0x2C, 0x83, 0x66, 0x6C, 0x6C, 0x75, 0x00, 0x46, 0x10, 0x0C, 0x13, 0x11, 0x04, 0x2C, 0x84, 0x6D,
+    0x69, 0x6C, 0x6C, 0x75, 0x00, 0x43, 0x11, 0x1C, 0x0B, 0x82, 0x6C, 0x74, 0x75, 0x00, 0x06, 0x06,
+    0x07, 0x0F, 0x10, 0x13, 0x19, 0xB1, 0x61, 0xBF, 0x61, 0xC8, 0x61, 0xD8, 0x61, 0xE3, 0x61, 0xF3,
+    0x61, 0x44, 0x0B, 0x05, 0x0C, 0x05, 0x86, 0x69, 0x62, 0x62, 0x68, 0x63, 0x6D, 0x75, 0x00, 0x43,
+    0x0B, 0x1D, 0x15, 0x82, 0x6D, 0x64, 0x75, 0x00, 0x45, 0x1C, 0x18, 0x0C, 0x10, 0x06, 0x87, 0x6D,
+    0x63, 0x69, 0x75, 0x79, 0x6C, 0x6D, 0x75, 0x00, 0x43, 0x04, 0x09, 0x12, 0x84, 0x61, 0x66, 0x6D,
+    0x6D, 0x75, 0x00, 0x46, 0x0C, 0x16, 0x08, 0x05, 0x0D, 0x16, 0x86, 0x65, 0x62, 0x73, 0x69, 0x70,
+    0x6D, 0x75, 0x00, 0x47, 0x04, 0x0B, 0x13, 0x18, 0x1B, 0x14, 0x15, 0x88, 0x78, 0x71, 0x75, 0x70,
+    0x68, 0x61, 0x76, 0x6D, 0x75, 0x00, 0x03, 0x0B, 0x15, 0x16, 0x10, 0x62, 0x1F, 0x62, 0x31, 0x62,
+    0x47, 0x09, 0x19, 0x1C, 0x0F, 0x1C, 0x17, 0x0B, 0x84, 0x66, 0x76, 0x68, 0x6E, 0x75, 0x00, 0x48,
+    0x1B, 0x0B, 0x14, 0x06, 0x0D, 0x13, 0x19, 0x2C, 0x86, 0x71, 0x63, 0x68, 0x78, 0x72, 0x6E, 0x75,
+    0x00, 0x44, 0x1D, 0x08, 0x1B, 0x0D, 0x86, 0x78, 0x6A, 0x65, 0x7A, 0x73, 0x6E, 0x75, 0x00, 0x03,
+    0x0A, 0x13, 0x19, 0x49, 0x62, 0x52, 0x62, 0x5A, 0x62, 0x43, 0x17, 0x12, 0x10, 0x82, 0x6F, 0x67,
+    0x75, 0x00, 0x43, 0x06, 0x06, 0x19, 0x81, 0x75, 0x6F, 0x00, 0x02, 0x0C, 0x0F, 0x61, 0x62, 0x71,
+    0x62, 0x46, 0x07, 0x0E, 0x05, 0x0E, 0x16, 0x2C, 0x86, 0x6B, 0x62, 0x64, 0x69, 0x76, 0x6F, 0x75,
+    0x00, 0x43, 0x05, 0x1B, 0x10, 0x82, 0x6F, 0x76, 0x75, 0x00, 0x03, 0x08, 0x0D, 0x0F, 0x84, 0x62,
+    0x94, 0x62, 0x9F, 0x62, 0x48, 0x16, 0x1C, 0x13, 0x1B, 0x14, 0x0C, 0x05, 0x2C, 0x84, 0x73, 0x79,
+    0x65, 0x70, 0x75, 0x00, 0x45, 0x0C, 0x0E, 0x18, 0x17, 0x2C, 0x82, 0x70, 0x6A, 0x75, 0x00, 0x46,
+    0x0D, 0x1A, 0x07, 0x13, 0x14, 0x0E, 0x84, 0x6A, 0x77, 0x6C, 0x70, 0x75, 0x00, 0x04, 0x07, 0x09,
+    0x12, 0x17, 0xBA, 0x62, 0xDF, 0x62, 0xEB, 0x62, 0xF8, 0x62, 0x02, 0x10, 0x12, 0xC1, 0x62, 0xCF,
+    0x62, 0x46, 0x19, 0x04, 0x12, 0x0E, 0x0E, 0x0A, 0x84, 0x6D, 0x76, 0x64, 0x71, 0x75, 0x00, 0x45,
+    0x16, 0x09, 0x04, 0x09, 0x18, 0x87, 0x61, 0x66, 0x66, 0x73, 0x6F, 0x64, 0x71, 0x75, 0x00, 0x46,
+    0x08, 0x06, 0x0B, 0x04, 0x1A, 0x2C, 0x82, 0x71, 0x66, 0x75, 0x00, 0x44, 0x1C, 0x05, 0x11, 0x18,
+    0x85, 0x62, 0x6E, 0x79, 0x6F, 0x71, 0x75, 0x00, 0x43, 0x1B, 0x0E, 0x15, 0x85, 0x6B, 0x72, 0x78,
+    0x74, 0x71, 0x75, 0x00, 0x02, 0x08, 0x0C, 0x0B, 0x63, 0x18, 0x63, 0x44, 0x0F, 0x18, 0x19, 0x15,
+    0x85, 0x75, 0x76, 0x6C, 0x65, 0x72, 0x75, 0x00, 0x44, 0x15, 0x0C, 0x0C, 0x04, 0x83, 0x69, 0x72,
+    0x72, 0x75, 0x00, 0x04, 0x06, 0x07, 0x0F, 0x13, 0x30, 0x63, 0x3B, 0x63, 0x48, 0x63, 0x58, 0x63,
+    0x46, 0x08, 0x04, 0x04, 0x13, 0x1A, 0x1C, 0x81, 0x75, 0x73, 0x00, 0x44, 0x07, 0x0F, 0x07, 0x14,
+    0x85, 0x6C, 0x64, 0x64, 0x64, 0x73, 0x75, 0x00, 0x48, 0x04, 0x1C, 0x0D, 0x0A, 0x0E, 0x14, 0x16,
+    0x2C, 0x84, 0x61, 0x79, 0x6C, 0x73, 0x75, 0x00, 0x46, 0x08, 0x0E, 0x06, 0x0A, 0x0F, 0x06, 0x81,
+    0x75, 0x73, 0x00, 0x02, 0x18, 0x1A, 0x6A, 0x63, 0x79, 0x63, 0x46, 0x06, 0x05, 0x16, 0x16, 0x08,
+    0x05, 0x85, 0x62, 0x73, 0x63, 0x75, 0x75, 0x75, 0x00, 0x47, 0x04, 0x09, 0x18, 0x0F, 0x08, 0x19,
+    0x2C, 0x84, 0x61, 0x66, 0x77, 0x75, 0x75, 0x00, 0x03, 0x05, 0x0D, 0x0F, 0x92, 0x63, 0x9F, 0x63,
+    0xB2, 0x63, 0x45, 0x1B, 0x0E, 0x06, 0x14, 0x0D, 0x84, 0x78, 0x6B, 0x62, 0x76, 0x75, 0x00, 0x47,
+    0x18, 0x11, 0x18, 0x0E, 0x09, 0x13, 0x0E, 0x88, 0x66, 0x70, 0x6B, 0x75, 0x6E, 0x75, 0x6A, 0x76,
+    0x75, 0x00, 0x43, 0x13, 0x04, 0x0C, 0x85, 0x61, 0x69, 0x70, 0x6C, 0x76, 0x75, 0x00, 0x02, 0x09,
+    0x11, 0xC5, 0x63, 0xD8, 0x63, 0x48, 0x0C, 0x1C, 0x17, 0x1A, 0x0D, 0x16, 0x0C, 0x2C, 0x87, 0x77,
+    0x6A, 0x74, 0x79, 0x69, 0x66, 0x79, 0x75, 0x00, 0x44, 0x16, 0x04, 0x10, 0x16, 0x85, 0x61, 0x6D,
+    0x73, 0x6E, 0x79, 0x75, 0x00, 0x05, 0x0A, 0x0C, 0x16, 0x18, 0x19, 0xF5, 0x63, 0x01, 0x64, 0x0C,
+    0x64, 0x1B, 0x64, 0x26, 0x64, 0x44, 0x08, 0x0C, 0x05, 0x1D, 0x84, 0x65, 0x69, 0x67, 0x7A, 0x75,
+    0x00, 0x45, 0x09, 0x0D, 0x19, 0x07, 0x06, 0x82, 0x7A, 0x69, 0x75, 0x00, 0x47, 0x16, 0x13, 0x0C,
+    0x12, 0x1B, 0x1A, 0x19, 0x84, 0x73, 0x70, 0x73, 0x7A, 0x75, 0x00, 0x44, 0x0C, 0x0A, 0x04, 0x2C,
+    0x83, 0x75, 0x69, 0x7A, 0x75, 0x00, 0x45, 0x15, 0x15, 0x17, 0x11, 0x2C, 0x81, 0x75, 0x7A, 0x00,
+    0x19, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x12, 0x13,
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x7C, 0x64, 0xA0, 0x64, 0x22, 0x65,
+    0x32, 0x65, 0x3B, 0x65, 0x4B, 0x65, 0xA1, 0x65, 0xEB, 0x65, 0x24, 0x66, 0x47, 0x66, 0x72, 0x66,
+    0x90, 0x66, 0xC8, 0x66, 0x15, 0x67, 0x47, 0x67, 0x73, 0x67, 0x93, 0x67, 0xBE, 0x67, 0x45, 0x68,
+    0x8D, 0x68, 0xC5, 0x68, 0xF4, 0x68, 0x00, 0x69, 0x0B, 0x69, 0x7B, 0x69, 0x02, 0x0F, 0x1A, 0x83,
+    0x64, 0x8F, 0x64, 0x46, 0x0D, 0x11, 0x04, 0x0D, 0x1B, 0x0F, 0x82, 0x61, 0x6C, 0x76, 0x00, 0x46,
+    0x0E, 0x04, 0x16, 0x05, 0x19, 0x0A, 0x87, 0x62, 0x76, 0x73, 0x61, 0x6B, 0x77, 0x61, 0x76, 0x00,
+    0x05, 0x05, 0x07, 0x08, 0x0D, 0x15, 0xB0, 0x64, 0xCD, 0x64, 0xE6, 0x64, 0xF2, 0x64, 0x14, 0x65,
+    0x02, 0x0C, 0x15, 0xB7, 0x64, 0xC0, 0x64, 0x42, 0x05, 0x1B, 0x83, 0x62, 0x69, 0x62, 0x76, 0x00,
+    0x43, 0x10, 0x13, 0x0B, 0x86, 0x70, 0x68, 0x6D, 0x72, 0x62, 0x62, 0x76, 0x00, 0x02, 0x06, 0x15,
+    0xD4, 0x64, 0xDC, 0x64, 0x42, 0x1D, 0x16, 0x82, 0x62, 0x64, 0x76, 0x00, 0x44, 0x13, 0x0E, 0x18,
+    0x0A, 0x82, 0x62, 0x64, 0x76, 0x00, 0x43, 0x04, 0x1D, 0x12, 0x85, 0x7A, 0x6F, 0x61, 0x65, 0x62,
+    0x76, 0x00, 0x02, 0x0D, 0x12, 0xF9, 0x64, 0x05, 0x65, 0x43, 0x0F, 0x0A, 0x12, 0x85, 0x6C, 0x67,
+    0x6A, 0x6A, 0x62, 0x76, 0x00, 0x46, 0x1D, 0x0F, 0x1A, 0x1D, 0x1D, 0x18, 0x85, 0x7A, 0x6C, 0x6F,
+    0x6A, 0x62, 0x76, 0x00, 0x47, 0x0B, 0x0A, 0x0A, 0x06, 0x0B, 0x1D, 0x04, 0x83, 0x72, 0x68, 0x62,
+    0x76, 0x00, 0x46, 0x16, 0x1C, 0x18, 0x18, 0x04, 0x0A, 0x86, 0x75, 0x61, 0x75, 0x79, 0x73, 0x63,
+    0x76, 0x00, 0x44, 0x1B, 0x14, 0x1C, 0x1C, 0x81, 0x76, 0x64, 0x00, 0x46, 0x16, 0x19, 0x17, 0x09,
+    0x1C, 0x10, 0x86, 0x66, 0x79, 0x74, 0x76, 0x73, 0x65, 0x76, 0x00, 0x06, 0x07, 0x11, 0x14, 0x15,
+    0x1A, 0x1D, 0x5E, 0x65, 0x6B, 0x65, 0x74, 0x65, 0x7D, 0x65, 0x88, 0x65, 0x95, 0x65, 0x44, 0x13,
+    0x12, 0x0A, 0x04, 0x85, 0x6F, 0x67, 0x70, 0x64, 0x66, 0x76, 0x00, 0x44, 0x08, 0x09, 0x0E, 0x2C,
+    0x81, 0x76, 0x66, 0x00, 0x43, 0x0B, 0x11, 0x15, 0x82, 0x66, 0x71, 0x76, 0x00, 0x46, 0x07, 0x1C,
+    0x14, 0x15, 0x1D, 0x1C, 0x81, 0x76, 0x66, 0x00, 0x47, 0x1A, 0x14, 0x0D, 0x06, 0x11, 0x11, 0x06,
+    0x82, 0x66, 0x77, 0x76, 0x00, 0x45, 0x18, 0x0C, 0x05, 0x1C, 0x19, 0x83, 0x7A, 0x75, 0x66, 0x76,
+    0x00, 0x04, 0x04, 0x07, 0x08, 0x14, 0xAE, 0x65, 0xC0, 0x65, 0xCD, 0x65, 0xD8, 0x65, 0x47, 0x10,
+    0x07, 0x07, 0x08, 0x10, 0x1C, 0x11, 0x87, 0x65, 0x6D, 0x64, 0x64, 0x6D, 0x61, 0x67, 0x76, 0x00,
+    0x47, 0x0C, 0x1C, 0x0E, 0x05, 0x08, 0x11, 0x08, 0x82, 0x67, 0x64, 0x76, 0x00, 0x44, 0x0E, 0x09,
+    0x1B, 0x0C, 0x83, 0x65, 0x6B, 0x67, 0x76, 0x00, 0x47, 0x1B, 0x1B, 0x0D, 0x11, 0x0F, 0x0C, 0x10,
+    0x88, 0x6C, 0x69, 0x6E, 0x6A, 0x78, 0x78, 0x71, 0x67, 0x76, 0x00, 0x04, 0x06, 0x07, 0x08, 0x0A,
+    0xF8, 0x65, 0x02, 0x66, 0x0C, 0x66, 0x18, 0x66, 0x45, 0x17, 0x1D, 0x13, 0x19, 0x05, 0x81, 0x76,
+    0x68, 0x00, 0x43, 0x1B, 0x05, 0x16, 0x83, 0x64, 0x78, 0x68, 0x76, 0x00, 0x44, 0x15, 0x1C, 0x0A,
+    0x2C, 0x84, 0x72, 0x79, 0x65, 0x68, 0x76, 0x00, 0x45, 0x14, 0x1D, 0x10, 0x1A, 0x18, 0x83, 0x67,
+    0x71, 0x68, 0x76, 0x00, 0x02, 0x13, 0x19, 0x2B, 0x66, 0x3D, 0x66, 0x48, 0x12, 0x09, 0x1C, 0x13,
+    0x16, 0x15, 0x16, 0x2C, 0x86, 0x79, 0x70, 0x66, 0x6F, 0x70, 0x69, 0x76, 0x00, 0x45, 0x08, 0x1D,
+    0x09, 0x0B, 0x12, 0x81, 0x76, 0x69, 0x00, 0x03, 0x09, 0x0E, 0x15, 0x51, 0x66, 0x5C, 0x66, 0x66,
+    0x66, 0x43, 0x17, 0x04, 0x06, 0x84, 0x74, 0x61, 0x66, 0x6A, 0x76, 0x00, 0x44, 0x08, 0x17, 0x07,
+    0x0C, 0x82, 0x6A, 0x6B, 0x76, 0x00, 0x47, 0x1B, 0x15, 0x04, 0x04, 0x0E, 0x12, 0x17, 0x81, 0x76,
+    0x6A, 0x00, 0x02, 0x06, 0x19, 0x79, 0x66, 0x85, 0x66, 0x44, 0x13, 0x07, 0x15, 0x0B, 0x84, 0x70,
+    0x64, 0x63, 0x6B, 0x76, 0x00, 0x43, 0x09, 0x17, 0x0C, 0x84, 0x66, 0x74, 0x76, 0x6B, 0x76, 0x00,
+    0x03, 0x0E, 0x14, 0x1C, 0x9A, 0x66, 0xA9, 0x66, 0xB9, 0x66, 0x47, 0x15, 0x07, 0x0F, 0x05, 0x09,
+    0x11, 0x2C, 0x84, 0x72, 0x64, 0x6B, 0x6C, 0x76, 0x00, 0x47, 0x18, 0x16, 0x18, 0x06, 0x10, 0x04,
+    0x19, 0x85, 0x73, 0x75, 0x75, 0x71, 0x6C, 0x76, 0x00, 0x46, 0x0B, 0x15, 0x0D, 0x09, 0x11, 0x10,
+    0x85, 0x72, 0x6A, 0x68, 0x79, 0x6C, 0x76, 0x00, 0x05, 0x04, 0x0A, 0x10, 0x16, 0x1C, 0xD8, 0x66,
+    0xE6, 0x66, 0xF4, 0x66, 0xFC, 0x66, 0x0C, 0x67, 0x44, 0x13, 0x06, 0x11, 0x16, 0x86, 0x6E, 0x73,
+    0x63, 0x70, 0x61, 0x6D, 0x76, 0x00, 0x45, 0x07, 0x0A, 0x0C, 0x08, 0x2C, 0x85, 0x67, 0x69, 0x64,
+    0x67, 0x6D, 0x76, 0x00, 0x43, 0x0E, 0x17, 0x0B, 0x81, 0x76, 0x6D, 0x00, 0x47, 0x07, 0x11, 0x15,
+    0x0B, 0x08, 0x06, 0x0C, 0x85, 0x6E, 0x72, 0x64, 0x73, 0x6D, 0x76, 0x00, 0x43, 0x0B, 0x04, 0x15,
+    0x82, 0x6D, 0x79, 0x76, 0x00, 0x03, 0x07, 0x16, 0x18, 0x1F, 0x67, 0x2E, 0x67, 0x3B, 0x67, 0x47,
+    0x1B, 0x19, 0x09, 0x1A, 0x0A, 0x17, 0x2C, 0x84, 0x78, 0x76, 0x64, 0x6F, 0x76, 0x00, 0x44, 0x04,
+    0x0D, 0x12, 0x2C, 0x85, 0x6A, 0x6F, 0x61, 0x73, 0x6F, 0x76, 0x00, 0x43, 0x0F, 0x1A, 0x08, 0x85,
+    0x77, 0x65, 0x6C, 0x75, 0x6F, 0x76, 0x00, 0x02, 0x0D, 0x15, 0x4E, 0x67, 0x61, 0x67, 0x47, 0x0A,
+    0x18, 0x19, 0x05, 0x19, 0x07, 0x12, 0x88, 0x76, 0x64, 0x62, 0x76, 0x75, 0x67, 0x6A, 0x70, 0x76,
+    0x00, 0x48, 0x0E, 0x13, 0x17, 0x0A, 0x14, 0x19, 0x1A, 0x2C, 0x86, 0x74, 0x67, 0x70, 0x6B, 0x72,
+    0x70, 0x76, 0x00, 0x02, 0x0A, 0x1B, 0x7A, 0x67, 0x88, 0x67, 0x46, 0x0F, 0x15, 0x19, 0x04, 0x1A,
+    0x0C, 0x84, 0x6C, 0x72, 0x67, 0x71, 0x76, 0x00, 0x46, 0x0E, 0x0C, 0x0A, 0x1C, 0x0A, 0x12, 0x81,
+    0x76, 0x71, 0x00, 0x03, 0x0F, 0x11, 0x1D, 0x9D, 0x67, 0xA8, 0x67, 0xB2, 0x67, 0x43, 0x0B, 0x10,
+    0x0C, 0x84, 0x68, 0x6D, 0x6C, 0x72, 0x76, 0x00, 0x43, 0x16, 0x15, 0x1B, 0x83, 0x6E, 0x73, 0x72,
+    0x76, 0x00, 0x44, 0x17, 0x07, 0x04, 0x06, 0x84, 0x74, 0x64, 0x7A, 0x72, 0x76, 0x00, 0x07, 0x06,
+    0x0A, 0x0C, 0x0E, 0x10, 0x15, 0x1B, 0xD4, 0x67, 0xDF, 0x67, 0xFC, 0x67, 0x0A, 0x68, 0x16, 0x68,
+    0x25, 0x68, 0x34, 0x68, 0x43, 0x18, 0x05, 0x06, 0x84, 0x75, 0x62, 0x63, 0x73, 0x76, 0x00, 0x02,
+    0x14, 0x18, 0xE6, 0x67, 0xF2, 0x67, 0x44, 0x06, 0x17, 0x17, 0x0C, 0x84, 0x71, 0x63, 0x67, 0x73,
+    0x76, 0x00, 0x44, 0x1C, 0x0A, 0x05, 0x05, 0x82, 0x73, 0x67, 0x76, 0x00, 0x46, 0x19, 0x14, 0x0C,
+    0x05, 0x16, 0x18, 0x84, 0x76, 0x71, 0x69, 0x73, 0x76, 0x00, 0x46, 0x1C, 0x10, 0x18, 0x08, 0x06,
+    0x2C, 0x82, 0x73, 0x6B, 0x76, 0x00, 0x46, 0x16, 0x0D, 0x19, 0x15, 0x0F, 0x11, 0x85, 0x6A, 0x76,
+    0x73, 0x6D, 0x73, 0x76, 0x00, 0x46, 0x11, 0x07, 0x0B, 0x07, 0x12, 0x0F, 0x85, 0x64, 0x68, 0x6E,
+    0x72, 0x73, 0x76, 0x00, 0x47, 0x13, 0x04, 0x12, 0x11, 0x18, 0x07, 0x0F, 0x86, 0x6F, 0x6E, 0x61,
+    0x70, 0x78, 0x73, 0x76, 0x00, 0x04, 0x09, 0x10, 0x13, 0x1A, 0x52, 0x68, 0x62, 0x68, 0x71, 0x68,
+    0x80, 0x68, 0x47, 0x1B, 0x18, 0x15, 0x0E, 0x18, 0x0C, 0x12, 0x85, 0x75, 0x72, 0x78, 0x66, 0x74,
+    0x76, 0x00, 0x47, 0x14, 0x0D, 0x17, 0x18, 0x08, 0x1D, 0x04, 0x84, 0x71, 0x6A, 0x6D, 0x74, 0x76,
+    0x00, 0x45, 0x15, 0x1A, 0x16, 0x0F, 0x0C, 0x86, 0x73, 0x6C, 0x77, 0x72, 0x70, 0x74, 0x76, 0x00,
+    0x44, 0x1D, 0x0A, 0x18, 0x0F, 0x85, 0x67, 0x75, 0x7A, 0x77, 0x74, 0x76, 0x00, 0x03, 0x10, 0x15,
+    0x17, 0x97, 0x68, 0xA3, 0x68, 0xB3, 0x68, 0x43, 0x1C, 0x14, 0x09, 0x85, 0x71, 0x66, 0x79, 0x6D,
+    0x75, 0x76, 0x00, 0x46, 0x0E, 0x0C, 0x15, 0x16, 0x0F, 0x2C, 0x86, 0x72, 0x73, 0x69, 0x6B, 0x72,
+    0x75, 0x76, 0x00, 0x48, 0x19, 0x08, 0x04, 0x09, 0x1D, 0x16, 0x0A, 0x2C, 0x86, 0x61, 0x66, 0x65,
+    0x76, 0x74, 0x75, 0x76, 0x00, 0x03, 0x05, 0x0A, 0x10, 0xCF, 0x68, 0xD9, 0x68, 0xE5, 0x68, 0x43,
+    0x0D, 0x17, 0x17, 0x83, 0x62, 0x6A, 0x76, 0x76, 0x00, 0x46, 0x1C, 0x07, 0x0D, 0x07, 0x16, 0x06,
+    0x82, 0x76, 0x67, 0x76, 0x00, 0x45, 0x18, 0x12, 0x0A, 0x07, 0x09, 0x86, 0x67, 0x64, 0x6F, 0x75,
+    0x6D, 0x76, 0x76, 0x00, 0x47, 0x18, 0x14, 0x11, 0x05, 0x16, 0x09, 0x2C, 0x81, 0x76, 0x77, 0x00,
+    0x45, 0x11, 0x08, 0x0E, 0x08, 0x09, 0x82, 0x78, 0x6E, 0x76, 0x00, 0x07, 0x04, 0x0D, 0x0F, 0x11,
+    0x14, 0x18, 0x1D, 0x21, 0x69, 0x2E, 0x69, 0x3A, 0x69, 0x43, 0x69, 0x50, 0x69, 0x5C, 0x69, 0x6A,
+    0x69, 0x46, 0x0F, 0x07, 0x0F, 0x11, 0x10, 0x17, 0x83, 0x61, 0x6C, 0x79, 0x76, 0x00, 0x43, 0x0C,
+    0x10, 0x0C, 0x85, 0x6D, 0x69, 0x69, 0x6A, 0x79, 0x76, 0x00, 0x44, 0x1B, 0x05, 0x0C, 0x2C, 0x81,
+    0x76, 0x79, 0x00, 0x45, 0x07, 0x06, 0x09, 0x11, 0x11, 0x84, 0x64, 0x63, 0x6E, 0x79, 0x76, 0x00,
+    0x43, 0x1C, 0x1D, 0x0D, 0x85, 0x7A, 0x6A, 0x79, 0x71, 0x79, 0x76, 0x00, 0x45, 0x06, 0x12, 0x19,
+    0x15, 0x08, 0x85, 0x6F, 0x76, 0x63, 0x75, 0x79, 0x76, 0x00, 0x47, 0x1D, 0x13, 0x1A, 0x1D, 0x16,
+    0x17, 0x19, 0x86, 0x77, 0x7A, 0x70, 0x7A, 0x7A, 0x79, 0x76, 0x00, 0x44, 0x12, 0x10, 0x0C, 0x1D,
+    0x85, 0x69, 0x7A, 0x6D, 0x6F, 0x7A, 0x76, 0x00, 0x17, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A,
+    0x0B, 0x0C, 0x0E, 0x10, 0x11, 0x12, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D,
+    0xCE, 0x69, 0xED, 0x69, 0x38, 0x6A, 0x5B, 0x6A, 0x89, 0x6A, 0xAD, 0x6A, 0xD7, 0x6A, 0x3D, 0x6B,
+    0xA0, 0x6B, 0xFF, 0x6B, 0x0F, 0x6C, 0x1B, 0x6C, 0x3A, 0x6C, 0x44, 0x6C, 0xB9, 0x6C, 0xCC, 0x6C,
+    0xF0, 0x6C, 0xFF, 0x6C, 0x62, 0x6D, 0x91, 0x6D, 0xC4, 0x6D, 0xEA, 0x6D, 0x1E, 0x6E, 0x02, 0x12,
+    0x1B, 0xD5, 0x69, 0xE0, 0x69, 0x43, 0x06, 0x0C, 0x08, 0x84, 0x63, 0x69, 0x6F, 0x61, 0x77, 0x00,
+    0x47, 0x15, 0x11, 0x09, 0x14, 0x0C, 0x14, 0x2C, 0x82, 0x61, 0x78, 0x77, 0x00, 0x05, 0x04, 0x07,
+    0x13, 0x19, 0x1D, 0xFD, 0x69, 0x0A, 0x6A, 0x15, 0x6A, 0x22, 0x6A, 0x2C, 0x6A, 0x46, 0x0C, 0x04,
+    0x10, 0x09, 0x1B, 0x0F, 0x83, 0x61, 0x69, 0x62, 0x77, 0x00, 0x46, 0x0E, 0x1A, 0x0C, 0x14, 0x09,
+    0x14, 0x81, 0x77, 0x62, 0x00, 0x47, 0x16, 0x1D, 0x15, 0x10, 0x16, 0x06, 0x17, 0x82, 0x62, 0x70,
+    0x77, 0x00, 0x44, 0x12, 0x16, 0x17, 0x06, 0x82, 0x62, 0x76, 0x77, 0x00, 0x44, 0x07, 0x1D, 0x13,
+    0x1C, 0x84, 0x64, 0x7A, 0x7A, 0x62, 0x77, 0x00, 0x02, 0x0E, 0x0F, 0x3F, 0x6A, 0x4E, 0x6A, 0x47,
+    0x0D, 0x0B, 0x0D, 0x0F, 0x0A, 0x0D, 0x09, 0x84, 0x6A, 0x68, 0x6B, 0x63, 0x77, 0x00, 0x44, 0x0B,
+    0x18, 0x0D, 0x14, 0x85, 0x75, 0x6A, 0x68, 0x6C, 0x63, 0x77, 0x00, 0x03, 0x04, 0x0F, 0x1D, 0x65,
+    0x6A, 0x76, 0x6A, 0x7E, 0x6A, 0x47, 0x0E, 0x1C, 0x19, 0x0A, 0x04, 0x06, 0x0A, 0x86, 0x76, 0x67,
+    0x79, 0x6B, 0x61, 0x64, 0x77, 0x00, 0x43, 0x07, 0x13, 0x0B, 0x81, 0x77, 0x64, 0x00, 0x44, 0x0D,
+    0x1D, 0x1A, 0x13, 0x83, 0x7A, 0x6A, 0x64, 0x77, 0x00, 0x02, 0x07, 0x1A, 0x90, 0x6A, 0x9F, 0x6A,
+    0x46, 0x10, 0x0A, 0x05, 0x17, 0x0B, 0x10, 0x85, 0x67, 0x62, 0x6D, 0x64, 0x65, 0x77, 0x00, 0x45,
+    0x08, 0x13, 0x0F, 0x0B, 0x18, 0x85, 0x70, 0x6C, 0x65, 0x77, 0x65, 0x77, 0x00, 0x02, 0x0A, 0x19,
+    0xB4, 0x6A, 0xC3, 0x6A, 0x46, 0x1C, 0x0C, 0x1A, 0x04, 0x05, 0x2C, 0x85, 0x69, 0x77, 0x79, 0x67,
+    0x66, 0x77, 0x00, 0x47, 0x11, 0x1A, 0x08, 0x07, 0x12, 0x16, 0x18, 0x89, 0x73, 0x75, 0x6F, 0x64,
+    0x65, 0x77, 0x6E, 0x76, 0x66, 0x77, 0x00, 0x05, 0x09, 0x0D, 0x12, 0x13, 0x17, 0xE7, 0x6A, 0xF9,
+    0x6A, 0x07, 0x6B, 0x19, 0x6B, 0x2B, 0x6B, 0x47, 0x09, 0x17, 0x19, 0x17, 0x1B, 0x04, 0x06, 0x87,
+    0x74, 0x78, 0x76, 0x74, 0x66, 0x66, 0x67, 0x77, 0x00, 0x45, 0x1A, 0x0C, 0x13, 0x10, 0x0A, 0x85,
+    0x69, 0x70, 0x77, 0x6A, 0x67, 0x77, 0x00, 0x47, 0x1B, 0x0C, 0x0F, 0x06, 0x14, 0x0D, 0x1A, 0x87,
+    0x63, 0x71, 0x6C, 0x69, 0x78, 0x6F, 0x67, 0x77, 0x00, 0x46, 0x09, 0x05, 0x18, 0x1B, 0x05, 0x11,
+    0x88, 0x62, 0x6E, 0x78, 0x75, 0x62, 0x66, 0x70, 0x67, 0x77, 0x00, 0x47, 0x18, 0x0D, 0x1C, 0x0F,
+    0x10, 0x09, 0x08, 0x87, 0x6C, 0x6D, 0x79, 0x6A, 0x75, 0x74, 0x67, 0x77, 0x00, 0x05, 0x05, 0x09,
+    0x17, 0x18, 0x1B, 0x4D, 0x6B, 0x62, 0x6B, 0x6D, 0x6B, 0x80, 0x6B, 0x93, 0x6B, 0x48, 0x0D, 0x11,
+    0x04, 0x0B, 0x0D, 0x10, 0x0B, 0x2C, 0x89, 0x6D, 0x68, 0x6A, 0x68, 0x61, 0x6E, 0x6A, 0x62, 0x68,
+    0x77, 0x00, 0x43, 0x16, 0x07, 0x16, 0x84, 0x73, 0x64, 0x66, 0x68, 0x77, 0x00, 0x48, 0x05, 0x0F,
+    0x0C, 0x16, 0x18, 0x08, 0x10, 0x2C, 0x87, 0x73, 0x75, 0x69, 0x6C, 0x62, 0x74, 0x68, 0x77, 0x00,
+    0x47, 0x0E, 0x0A, 0x11, 0x0D, 0x19, 0x13, 0x2C, 0x88, 0x76, 0x70, 0x6A, 0x6E, 0x67, 0x6B, 0x75,
+    0x68, 0x77, 0x00, 0x44, 0x12, 0x0E, 0x0A, 0x2C, 0x85, 0x6B, 0x67, 0x6F, 0x78, 0x68, 0x77, 0x00,
+    0x05, 0x05, 0x08, 0x0C, 0x14, 0x18, 0xB0, 0x6B, 0xBA, 0x6B, 0xD5, 0x6B, 0xE4, 0x6B, 0xF3, 0x6B,
+    0x43, 0x0C, 0x0F, 0x0E, 0x83, 0x62, 0x69, 0x69, 0x77, 0x00, 0x02, 0x0C, 0x18, 0xC1, 0x6B, 0xCD,
+    0x6B, 0x45, 0x12, 0x0C, 0x0F, 0x11, 0x0B, 0x83, 0x65, 0x69, 0x69, 0x77, 0x00, 0x42, 0x0D, 0x1A,
+    0x82, 0x69, 0x65, 0x77, 0x00, 0x46, 0x0E, 0x0F, 0x18, 0x0C, 0x08, 0x0F, 0x85, 0x6C, 0x75, 0x6B,
+    0x69, 0x69, 0x77, 0x00, 0x45, 0x05, 0x1C, 0x14, 0x07, 0x04, 0x86, 0x71, 0x64, 0x79, 0x62, 0x71,
+    0x69, 0x77, 0x00, 0x47, 0x07, 0x04, 0x12, 0x1B, 0x07, 0x1D, 0x1B, 0x81, 0x77, 0x69, 0x00, 0x48,
+    0x0B, 0x14, 0x18, 0x06, 0x14, 0x15, 0x0A, 0x2C, 0x84, 0x71, 0x75, 0x68, 0x6B, 0x77, 0x00, 0x45,
+    0x1B, 0x16, 0x0F, 0x19, 0x14, 0x83, 0x78, 0x73, 0x6D, 0x77, 0x00, 0x02, 0x07, 0x19, 0x22, 0x6C,
+    0x2E, 0x6C, 0x43, 0x0B, 0x10, 0x1B, 0x85, 0x6D, 0x78, 0x68, 0x64, 0x6E, 0x77, 0x00, 0x45, 0x16,
+    0x1C, 0x04, 0x0D, 0x0F, 0x83, 0x76, 0x73, 0x6E, 0x77, 0x00, 0x44, 0x16, 0x16, 0x1D, 0x1B, 0x82,
+    0x6F, 0x73, 0x77, 0x00, 0x06, 0x05, 0x0C, 0x0F, 0x10, 0x18, 0x1B, 0x57, 0x6C, 0x62, 0x6C, 0x84,
+    0x6C, 0x8F, 0x6C, 0xA0, 0x6C, 0xAC, 0x6C, 0x45, 0x06, 0x07, 0x19, 0x10, 0x13, 0x82, 0x71, 0x62,
+    0x77, 0x00, 0x02, 0x0E, 0x11, 0x69, 0x6C, 0x72, 0x6C, 0x44, 0x15, 0x1D, 0x0B, 0x18, 0x81, 0x77,
+    0x71, 0x00, 0x46, 0x0F, 0x12, 0x18, 0x0B, 0x12, 0x0A, 0x88, 0x68, 0x6F, 0x75, 0x6F, 0x6C, 0x6E,
+    0x69, 0x71, 0x77, 0x00, 0x46, 0x12, 0x1D, 0x09, 0x07, 0x05, 0x05, 0x81, 0x77, 0x71, 0x00, 0x46,
+    0x0D, 0x11, 0x0C, 0x0C, 0x10, 0x06, 0x87, 0x69, 0x6D, 0x69, 0x6E, 0x6A, 0x6D, 0x71, 0x77, 0x00,
+    0x43, 0x06, 0x1A, 0x1D, 0x85, 0x77, 0x7A, 0x63, 0x75, 0x71, 0x77, 0x00, 0x44, 0x13, 0x13, 0x0E,
+    0x17, 0x85, 0x70, 0x6B, 0x70, 0x78, 0x71, 0x77, 0x00, 0x47, 0x1D, 0x17, 0x11, 0x0B, 0x17, 0x0F,
+    0x18, 0x88, 0x6C, 0x75, 0x74, 0x68, 0x6E, 0x74, 0x7A, 0x72, 0x77, 0x00, 0x02, 0x05, 0x1D, 0xD3,
+    0x6C, 0xE1, 0x6C, 0x45, 0x0E, 0x0E, 0x15, 0x0C, 0x04, 0x85, 0x6B, 0x72, 0x6B, 0x62, 0x73, 0x77,
+    0x00, 0x45, 0x16, 0x10, 0x1C, 0x09, 0x05, 0x86, 0x79, 0x66, 0x6D, 0x73, 0x7A, 0x73, 0x77, 0x00,
+    0x48, 0x1C, 0x10, 0x04, 0x04, 0x1B, 0x14, 0x06, 0x0A, 0x83, 0x79, 0x6D, 0x74, 0x77, 0x00, 0x06,
+    0x06, 0x08, 0x0B, 0x11, 0x14, 0x1B, 0x12, 0x6D, 0x25, 0x6D, 0x2F, 0x6D, 0x39, 0x6D, 0x46, 0x6D,
+    0x52, 0x6D, 0x47, 0x1D, 0x12, 0x17, 0x05, 0x0D, 0x12, 0x16, 0x88, 0x6A, 0x6F, 0x62, 0x74, 0x6F,
+    0x7A, 0x63, 0x75, 0x77, 0x00, 0x43, 0x1D, 0x1B, 0x13, 0x83, 0x65, 0x7A, 0x75, 0x77, 0x00, 0x44,
+    0x07, 0x18, 0x13, 0x16, 0x82, 0x75, 0x68, 0x77, 0x00, 0x44, 0x10, 0x15, 0x1D, 0x0A, 0x85, 0x72,
+    0x7A, 0x6D, 0x6E, 0x75, 0x77, 0x00, 0x46, 0x0A, 0x05, 0x1C, 0x07, 0x1D, 0x1B, 0x82, 0x75, 0x71,
+    0x77, 0x00, 0x46, 0x1C, 0x14, 0x0D, 0x0A, 0x14, 0x0E, 0x86, 0x6A, 0x67, 0x71, 0x79, 0x78, 0x75,
+    0x77, 0x00, 0x03, 0x0C, 0x10, 0x1A, 0x6C, 0x6D, 0x78, 0x6D, 0x86, 0x6D, 0x43, 0x15, 0x12, 0x05,
+    0x85, 0x6F, 0x62, 0x72, 0x69, 0x76, 0x77, 0x00, 0x45, 0x06, 0x1C, 0x14, 0x0A, 0x08, 0x85, 0x79,
+    0x71, 0x63, 0x6D, 0x76, 0x77, 0x00, 0x43, 0x1B, 0x13, 0x09, 0x84, 0x78, 0x70, 0x77, 0x76, 0x77,
+    0x00, 0x03, 0x0F, 0x16, 0x18, 0x9B, 0x6D, 0xAD, 0x6D, 0xB8, 0x6D, 0x47, 0x10, 0x19, 0x10, 0x09,
+    0x0C, 0x1A, 0x07, 0x87, 0x66, 0x69, 0x6D, 0x76, 0x6D, 0x6C, 0x77, 0x77, 0x00, 0x44, 0x1B, 0x18,
+    0x11, 0x16, 0x83, 0x73, 0x78, 0x77, 0x77, 0x00, 0x43, 0x08, 0x11, 0x07, 0x85, 0x6E, 0x64, 0x65,
+    0x75, 0x77, 0x77, 0x00, 0x02, 0x09, 0x13, 0xCB, 0x6D, 0xDB, 0x6D, 0x47, 0x1B, 0x0F, 0x1D, 0x15,
+    0x19, 0x13, 0x2C, 0x85, 0x6C, 0x7A, 0x78, 0x66, 0x78, 0x77, 0x00, 0x48, 0x16, 0x13, 0x10, 0x0F,
+    0x15, 0x09, 0x19, 0x2C, 0x83, 0x70, 0x73, 0x78, 0x77, 0x00, 0x03, 0x06, 0x17, 0x1D, 0xF4, 0x6D,
+    0x02, 0x6E, 0x0D, 0x6E, 0x45, 0x1D, 0x1A, 0x10, 0x1D, 0x2C, 0x85, 0x77, 0x6D, 0x7A, 0x63, 0x79,
+    0x77, 0x00, 0x46, 0x0E, 0x18, 0x0E, 0x12, 0x14, 0x2C, 0x81, 0x77, 0x79, 0x00, 0x47, 0x10, 0x06,
+    0x07, 0x05, 0x17, 0x1B, 0x2C, 0x86, 0x64, 0x62, 0x63, 0x6D, 0x7A, 0x79, 0x77, 0x00, 0x03, 0x08,
+    0x0D, 0x18, 0x28, 0x6E, 0x37, 0x6E, 0x41, 0x6E, 0x45, 0x0B, 0x12, 0x10, 0x1D, 0x1A, 0x86, 0x6D,
+    0x7A, 0x6F, 0x68, 0x65, 0x7A, 0x77, 0x00, 0x44, 0x08, 0x0C, 0x1D, 0x04, 0x82, 0x7A, 0x6A, 0x77,
+    0x00, 0x47, 0x14, 0x16, 0x14, 0x0C, 0x05, 0x17, 0x0C, 0x88, 0x62, 0x74, 0x69, 0x71, 0x73, 0x71,
+    0x75, 0x7A, 0x77, 0x00, 0x16, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x16, 0x18, 0x1A, 0x1B, 0x1C, 0x1D, 0x97, 0x6E, 0xC7, 0x6E, 0x0D,
+    0x6F, 0x4B, 0x6F, 0x58, 0x6F, 0x94, 0x6F, 0xC5, 0x6F, 0xD0, 0x6F, 0xFD, 0x6F, 0x4F, 0x70, 0x86,
+    0x70, 0xAB, 0x70, 0x13, 0x71, 0x5D, 0x71, 0x66, 0x71, 0x85, 0x71, 0xCF, 0x71, 0xF0, 0x71, 0x11,
+    0x72, 0xA1, 0x72, 0xE8, 0x72, 0x28, 0x73, 0x03, 0x0C, 0x17, 0x1A, 0xA1, 0x6E, 0xAD, 0x6E, 0xBB,
+    0x6E, 0x46, 0x05, 0x12, 0x0B, 0x18, 0x0E, 0x1A, 0x82, 0x61, 0x69, 0x78, 0x00, 0x46, 0x0C, 0x13,
+    0x0D, 0x11, 0x06, 0x0D, 0x84, 0x69, 0x70, 0x74, 0x61, 0x78, 0x00, 0x43, 0x10, 0x0C, 0x14, 0x85,
+    0x69, 0x71, 0x6D, 0x77, 0x61, 0x78, 0x00, 0x04, 0x06, 0x08, 0x0E, 0x1B, 0xD4, 0x6E, 0xE3, 0x6E,
+    0xF5, 0x6E, 0x01, 0x6F, 0x47, 0x08, 0x18, 0x19, 0x1C, 0x12, 0x11, 0x14, 0x84, 0x65, 0x75, 0x63,
+    0x62, 0x78, 0x00, 0x46, 0x1B, 0x1B, 0x12, 0x04, 0x07, 0x0B, 0x88, 0x64, 0x68, 0x61, 0x6F, 0x78,
+    0x78, 0x65, 0x62, 0x78, 0x00, 0x47, 0x0C, 0x1B, 0x0E, 0x05, 0x1A, 0x08, 0x0C, 0x81, 0x78, 0x62,
+    0x00, 0x44, 0x12, 0x17, 0x18, 0x04, 0x84, 0x6F, 0x74, 0x78, 0x62, 0x78, 0x00, 0x03, 0x0A, 0x13,
+    0x14, 0x17, 0x6F, 0x2E, 0x6F, 0x41, 0x6F, 0x02, 0x15, 0x17, 0x1E, 0x6F, 0x26, 0x6F, 0x43, 0x08,
+    0x04, 0x0C, 0x81, 0x78, 0x63, 0x00, 0x42, 0x12, 0x0E, 0x82, 0x63, 0x67, 0x78, 0x00, 0x47, 0x14,
+    0x06, 0x15, 0x0F, 0x15, 0x13, 0x16, 0x88, 0x72, 0x70, 0x6C, 0x72, 0x63, 0x71, 0x70, 0x63, 0x78,
+    0x00, 0x45, 0x0E, 0x12, 0x0E, 0x0C, 0x08, 0x81, 0x78, 0x63, 0x00, 0x47, 0x06, 0x0E, 0x14, 0x1D,
+    0x04, 0x04, 0x0C, 0x82, 0x64, 0x63, 0x78, 0x00, 0x04, 0x0C, 0x0E, 0x11, 0x1C, 0x65, 0x6F, 0x6D,
+    0x6F, 0x7B, 0x6F, 0x88, 0x6F, 0x43, 0x0E, 0x0B, 0x1B, 0x81, 0x78, 0x65, 0x00, 0x45, 0x11, 0x1D,
+    0x14, 0x10, 0x15, 0x85, 0x7A, 0x71, 0x6E, 0x6B, 0x65, 0x78, 0x00, 0x44, 0x0A, 0x1C, 0x13, 0x2C,
+    0x85, 0x79, 0x70, 0x67, 0x6E, 0x65, 0x78, 0x00, 0x43, 0x13, 0x0E, 0x0D, 0x85, 0x6B, 0x6A, 0x70,
+    0x79, 0x65, 0x78, 0x00, 0x03, 0x06, 0x0D, 0x0F, 0x9E, 0x6F, 0xAA, 0x6F, 0xB6, 0x6F, 0x47, 0x12,
+    0x1A, 0x0B, 0x0A, 0x15, 0x1B, 0x14, 0x81, 0x78, 0x66, 0x00, 0x44, 0x04, 0x1C, 0x08, 0x2C, 0x84,
+    0x61, 0x79, 0x6A, 0x66, 0x78, 0x00, 0x47, 0x18, 0x14, 0x0B, 0x17, 0x14, 0x0D, 0x04, 0x84, 0x75,
+    0x71, 0x6C, 0x66, 0x78, 0x00, 0x45, 0x12, 0x1C, 0x04, 0x0B, 0x1D, 0x82, 0x67, 0x6F, 0x78, 0x00,
+    0x02, 0x04, 0x07, 0xD7, 0x6F, 0xE9, 0x6F, 0x46, 0x15, 0x0A, 0x18, 0x19, 0x1A, 0x13, 0x88, 0x77,
+    0x70, 0x76, 0x75, 0x67, 0x72, 0x61, 0x68, 0x78, 0x00, 0x48, 0x1B, 0x09, 0x17, 0x04, 0x1D, 0x0E,
+    0x1A, 0x2C, 0x88, 0x7A, 0x6B, 0x61, 0x74, 0x66, 0x78, 0x64, 0x68, 0x78, 0x00, 0x05, 0x08, 0x0B,
+    0x0E, 0x10, 0x12, 0x0D, 0x70, 0x1D, 0x70, 0x29, 0x70, 0x35, 0x70, 0x44, 0x70, 0x46, 0x07, 0x0A,
+    0x14, 0x05, 0x13, 0x11, 0x86, 0x71, 0x62, 0x67, 0x64, 0x65, 0x69, 0x78, 0x00, 0x44, 0x1B, 0x0B,
+    0x15, 0x1D, 0x84, 0x78, 0x68, 0x68, 0x69, 0x78, 0x00, 0x45, 0x18, 0x19, 0x1C, 0x09, 0x2C, 0x83,
+    0x6B, 0x75, 0x69, 0x78, 0x00, 0x47, 0x04, 0x18, 0x0C, 0x11, 0x07, 0x08, 0x1B, 0x84, 0x61, 0x75,
+    0x6D, 0x69, 0x78, 0x00, 0x45, 0x08, 0x14, 0x1A, 0x0E, 0x2C, 0x82, 0x69, 0x6F, 0x78, 0x00, 0x03,
+    0x12, 0x14, 0x17, 0x59, 0x70, 0x66, 0x70, 0x76, 0x70, 0x44, 0x0E, 0x09, 0x0F, 0x12, 0x85, 0x66,
+    0x6C, 0x6B, 0x6F, 0x6A, 0x78, 0x00, 0x45, 0x07, 0x0D, 0x14, 0x1A, 0x09, 0x87, 0x77, 0x66, 0x71,
+    0x6A, 0x64, 0x71, 0x6A, 0x78, 0x00, 0x47, 0x14, 0x19, 0x1A, 0x05, 0x07, 0x0C, 0x09, 0x85, 0x76,
+    0x77, 0x71, 0x74, 0x6A, 0x78, 0x00, 0x02, 0x0B, 0x12, 0x8D, 0x70, 0x9F, 0x70, 0x47, 0x13, 0x07,
+    0x0A, 0x04, 0x0B, 0x11, 0x2C, 0x87, 0x61, 0x68, 0x67, 0x64, 0x70, 0x68, 0x6B, 0x78, 0x00, 0x45,
+    0x18, 0x18, 0x19, 0x19, 0x2C, 0x83, 0x6F, 0x75, 0x6B, 0x78, 0x00, 0x04, 0x12, 0x15, 0x16, 0x1A,
+    0xB8, 0x70, 0xE4, 0x70, 0xF1, 0x70, 0x03, 0x71, 0x03, 0x04, 0x0F, 0x10, 0xC2, 0x70, 0xD0, 0x70,
+    0xDC, 0x70, 0x46, 0x1B, 0x14, 0x0A, 0x07, 0x07, 0x17, 0x84, 0x61, 0x78, 0x6F, 0x6D, 0x78, 0x00,
+    0x45, 0x11, 0x0B, 0x0D, 0x16, 0x2C, 0x83, 0x6F, 0x6C, 0x6D, 0x78, 0x00, 0x42, 0x0C, 0x15, 0x82,
+    0x6D, 0x6F, 0x78, 0x00, 0x44, 0x0A, 0x19, 0x08, 0x1B, 0x85, 0x76, 0x65, 0x67, 0x72, 0x6D, 0x78,
+    0x00, 0x46, 0x0C, 0x0D, 0x12, 0x10, 0x04, 0x14, 0x88, 0x61, 0x71, 0x6D, 0x6F, 0x6A, 0x69, 0x73,
+    0x6D, 0x78, 0x00, 0x45, 0x0A, 0x1D, 0x17, 0x16, 0x1D, 0x87, 0x73, 0x7A, 0x74, 0x7A, 0x67, 0x77,
+    0x6D, 0x78, 0x00, 0x03, 0x0F, 0x10, 0x1D, 0x1D, 0x71, 0x31, 0x71, 0x3C, 0x71, 0x47, 0x0C, 0x0D,
+    0x0B, 0x1B, 0x1B, 0x05, 0x17, 0x89, 0x62, 0x74, 0x78, 0x78, 0x68, 0x6A, 0x69, 0x6C, 0x6E, 0x78,
+    0x00, 0x45, 0x19, 0x0C, 0x16, 0x16, 0x2C, 0x82, 0x6E, 0x6D, 0x78, 0x00, 0x02, 0x06, 0x0E, 0x43,
+    0x71, 0x50, 0x71, 0x45, 0x07, 0x0E, 0x1C, 0x05, 0x08, 0x84, 0x63, 0x64, 0x7A, 0x6E, 0x78, 0x00,
+    0x45, 0x13, 0x1B, 0x18, 0x05, 0x11, 0x84, 0x6B, 0x70, 0x7A, 0x6E, 0x78, 0x00, 0x44, 0x04, 0x19,
+    0x07, 0x05, 0x81, 0x78, 0x6F, 0x00, 0x41, 0x15, 0x02, 0x05, 0x13, 0x6F, 0x71, 0x7C, 0x71, 0x43,
+    0x10, 0x1D, 0x0E, 0x86, 0x7A, 0x6B, 0x6D, 0x62, 0x72, 0x70, 0x78, 0x00, 0x42, 0x0D, 0x0F, 0x83,
+    0x72, 0x70, 0x70, 0x78, 0x00, 0x04, 0x11, 0x13, 0x16, 0x19, 0x92, 0x71, 0x9F, 0x71, 0xAD, 0x71,
+    0xBF, 0x71, 0x46, 0x07, 0x1C, 0x10, 0x17, 0x14, 0x13, 0x83, 0x6E, 0x64, 0x71, 0x78, 0x00, 0x46,
+    0x04, 0x06, 0x04, 0x19, 0x18, 0x06, 0x84, 0x61, 0x63, 0x70, 0x71, 0x78, 0x00, 0x47, 0x1C, 0x09,
+    0x0C, 0x1B, 0x19, 0x06, 0x07, 0x87, 0x78, 0x76, 0x69, 0x66, 0x79, 0x73, 0x71, 0x78, 0x00, 0x46,
+    0x06, 0x1D, 0x14, 0x0D, 0x07, 0x2C, 0x86, 0x71, 0x6A, 0x7A, 0x63, 0x76, 0x71, 0x78, 0x00, 0x02,
+    0x12, 0x1B, 0xD6, 0x71, 0xE3, 0x71, 0x48, 0x05, 0x08, 0x0E, 0x0E, 0x08, 0x1C, 0x05, 0x2C, 0x81,
+    0x78, 0x73, 0x00, 0x45, 0x14, 0x13, 0x11, 0x06, 0x11, 0x84, 0x71, 0x70, 0x78, 0x73, 0x78, 0x00,
+    0x42, 0x17, 0x10, 0x02, 0x0A, 0x16, 0xFA, 0x71, 0x02, 0x72, 0x41, 0x0E, 0x83, 0x74, 0x6D, 0x75,
+    0x78, 0x00, 0x45, 0x0A, 0x13, 0x06, 0x14, 0x2C, 0x86, 0x67, 0x70, 0x73, 0x6D, 0x74, 0x75, 0x78,
+    0x00, 0x08, 0x0E, 0x10, 0x12, 0x17, 0x18, 0x1A, 0x1C, 0x1D, 0x2A, 0x72, 0x38, 0x72, 0x40, 0x72,
+    0x62, 0x72, 0x70, 0x72, 0x7C, 0x72, 0x88, 0x72, 0x92, 0x72, 0x47, 0x07, 0x05, 0x07, 0x0F, 0x18,
+    0x0C, 0x19, 0x83, 0x6B, 0x64, 0x77, 0x78, 0x00, 0x43, 0x14, 0x0B, 0x12, 0x81, 0x78, 0x77, 0x00,
+    0x02, 0x11, 0x1A, 0x47, 0x72, 0x58, 0x72, 0x45, 0x15, 0x12, 0x19, 0x04, 0x0D, 0x88, 0x61, 0x6A,
+    0x76, 0x6F, 0x72, 0x6E, 0x6F, 0x77, 0x78, 0x00, 0x43, 0x17, 0x09, 0x0B, 0x83, 0x6F, 0x77, 0x77,
+    0x78, 0x00, 0x46, 0x0A, 0x10, 0x11, 0x14, 0x05, 0x2C, 0x84, 0x67, 0x6D, 0x74, 0x77, 0x78, 0x00,
+    0x44, 0x0B, 0x1C, 0x1C, 0x1D, 0x84, 0x68, 0x79, 0x75, 0x77, 0x78, 0x00, 0x44, 0x0D, 0x17, 0x0E,
+    0x2C, 0x84, 0x6A, 0x74, 0x77, 0x77, 0x78, 0x00, 0x44, 0x0D, 0x0E, 0x04, 0x2C, 0x82, 0x77, 0x79,
+    0x78, 0x00, 0x45, 0x05, 0x15, 0x07, 0x06, 0x2C, 0x86, 0x64, 0x63, 0x72, 0x62, 0x7A, 0x77, 0x78,
+    0x00, 0x04, 0x05, 0x0C, 0x10, 0x15, 0xAE, 0x72, 0xB8, 0x72, 0xCB, 0x72, 0xDA, 0x72, 0x44, 0x0E,
+    0x07, 0x15, 0x16, 0x82, 0x78, 0x62, 0x78, 0x00, 0x47, 0x0D, 0x1D, 0x18, 0x11, 0x18, 0x1D, 0x2C,
+    0x88, 0x75, 0x7A, 0x6E, 0x75, 0x7A, 0x6A, 0x69, 0x78, 0x78, 0x00, 0x47, 0x17, 0x0C, 0x04, 0x16,
+    0x13, 0x09, 0x12, 0x84, 0x74, 0x69, 0x6D, 0x78, 0x78, 0x00, 0x44, 0x07, 0x0F, 0x07, 0x19, 0x86,
+    0x64, 0x76, 0x6C, 0x64, 0x72, 0x78, 0x78, 0x00, 0x04, 0x04, 0x08, 0x15, 0x1D, 0xF5, 0x72, 0x06,
+    0x73, 0x10, 0x73, 0x1C, 0x73, 0x47, 0x04, 0x08, 0x06, 0x05, 0x12, 0x04, 0x08, 0x86, 0x63, 0x62,
+    0x65, 0x61, 0x61, 0x79, 0x78, 0x00, 0x44, 0x16, 0x1D, 0x08, 0x2C, 0x82, 0x79, 0x65, 0x78, 0x00,
+    0x47, 0x0E, 0x1D, 0x07, 0x10, 0x1D, 0x1A, 0x2C, 0x81, 0x78, 0x79, 0x00, 0x46, 0x1B, 0x18, 0x1B,
+    0x07, 0x15, 0x2C, 0x82, 0x79, 0x7A, 0x78, 0x00, 0x47, 0x1D, 0x0A, 0x19, 0x18, 0x12, 0x18, 0x0A,
+    0x87, 0x6F, 0x75, 0x75, 0x76, 0x67, 0x7A, 0x7A, 0x78, 0x00, 0x19, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1A, 0x1B, 0x1C, 0x1D, 0x86, 0x73, 0x91, 0x73, 0xB1, 0x73, 0xF7, 0x73, 0x4F, 0x74, 0x62, 0x74,
+    0x8C, 0x74, 0xB9, 0x74, 0xC9, 0x74, 0xF6, 0x74, 0x37, 0x75, 0x57, 0x75, 0x78, 0x75, 0xDB, 0x75,
+    0x28, 0x76, 0x33, 0x76, 0x64, 0x76, 0xCE, 0x76, 0xFC, 0x76, 0x56, 0x77, 0x75, 0x77, 0xCB, 0x77,
+    0x18, 0x78, 0x3B, 0x78, 0x59, 0x78, 0x45, 0x11, 0x19, 0x0F, 0x17, 0x15, 0x82, 0x61, 0x6E, 0x79,
+    0x00, 0x02, 0x15, 0x1B, 0x98, 0x73, 0xA1, 0x73, 0x44, 0x1D, 0x0C, 0x15, 0x08, 0x81, 0x79, 0x62,
+    0x00, 0x46, 0x1D, 0x05, 0x10, 0x05, 0x19, 0x14, 0x86, 0x6D, 0x62, 0x62, 0x7A, 0x78, 0x62, 0x79,
+    0x00, 0x04, 0x05, 0x06, 0x12, 0x1D, 0xBE, 0x73, 0xCE, 0x73, 0xDF, 0x73, 0xE8, 0x73, 0x46, 0x16,
+    0x07, 0x1A, 0x18, 0x0F, 0x07, 0x86, 0x77, 0x75, 0x64, 0x73, 0x62, 0x63, 0x79, 0x00, 0x46, 0x19,
+    0x18, 0x12, 0x12, 0x08, 0x2C, 0x87, 0x6F, 0x65, 0x6F, 0x75, 0x76, 0x63, 0x63, 0x79, 0x00, 0x44,
+    0x10, 0x12, 0x18, 0x07, 0x81, 0x79, 0x63, 0x00, 0x46, 0x14, 0x11, 0x0B, 0x10, 0x1B, 0x06, 0x85,
+    0x6E, 0x68, 0x71, 0x7A, 0x63, 0x79, 0x00, 0x05, 0x09, 0x10, 0x15, 0x16, 0x1A, 0x07, 0x74, 0x13,
+    0x74, 0x1D, 0x74, 0x28, 0x74, 0x45, 0x74, 0x46, 0x18, 0x18, 0x0A, 0x12, 0x07, 0x0C, 0x82, 0x64,
+    0x66, 0x79, 0x00, 0x43, 0x04, 0x04, 0x17, 0x83, 0x6D, 0x61, 0x64, 0x79, 0x00, 0x46, 0x0A, 0x19,
+    0x0D, 0x09, 0x0F, 0x10, 0x81, 0x79, 0x64, 0x00, 0x02, 0x0E, 0x1B, 0x2F, 0x74, 0x3B, 0x74, 0x46,
+    0x19, 0x16, 0x0F, 0x16, 0x1A, 0x18, 0x82, 0x64, 0x73, 0x79, 0x00, 0x44, 0x15, 0x15, 0x0C, 0x0E,
+    0x82, 0x64, 0x73, 0x79, 0x00, 0x44, 0x05, 0x1D, 0x0F, 0x14, 0x82, 0x64, 0x77, 0x79, 0x00, 0x48,
+    0x18, 0x06, 0x0E, 0x11, 0x0F, 0x06, 0x13, 0x17, 0x87, 0x6C, 0x63, 0x6E, 0x6B, 0x63, 0x75, 0x65,
+    0x79, 0x00, 0x03, 0x06, 0x0C, 0x0D, 0x6C, 0x74, 0x76, 0x74, 0x82, 0x74, 0x45, 0x16, 0x08, 0x0A,
+    0x08, 0x15, 0x81, 0x79, 0x66, 0x00, 0x44, 0x0E, 0x07, 0x1B, 0x0E, 0x84, 0x6B, 0x64, 0x69, 0x66,
+    0x79, 0x00, 0x44, 0x0A, 0x07, 0x19, 0x07, 0x82, 0x66, 0x6A, 0x79, 0x00, 0x03, 0x07, 0x1B, 0x1C,
+    0x96, 0x74, 0x9F, 0x74, 0xAD, 0x74, 0x43, 0x1D, 0x07, 0x0C, 0x82, 0x67, 0x64, 0x79, 0x00, 0x46,
+    0x18, 0x0C, 0x10, 0x10, 0x16, 0x04, 0x84, 0x75, 0x69, 0x78, 0x67, 0x79, 0x00, 0x43, 0x16, 0x10,
+    0x14, 0x85, 0x6D, 0x71, 0x73, 0x79, 0x67, 0x79, 0x00, 0x47, 0x13, 0x1B, 0x12, 0x11, 0x0B, 0x0C,
+    0x1D, 0x85, 0x6F, 0x6E, 0x78, 0x70, 0x68, 0x79, 0x00, 0x03, 0x12, 0x16, 0x1D, 0xD3, 0x74, 0xDC,
+    0x74, 0xED, 0x74, 0x43, 0x15, 0x0D, 0x17, 0x82, 0x69, 0x6F, 0x79, 0x00, 0x46, 0x04, 0x0D, 0x11,
+    0x1D, 0x09, 0x1B, 0x87, 0x7A, 0x66, 0x6E, 0x6A, 0x61, 0x73, 0x69, 0x79, 0x00, 0x43, 0x15, 0x08,
+    0x14, 0x82, 0x69, 0x7A, 0x79, 0x00, 0x04, 0x17, 0x19, 0x1A, 0x1C, 0x03, 0x75, 0x12, 0x75, 0x1B,
+    0x75, 0x27, 0x75, 0x48, 0x08, 0x13, 0x13, 0x16, 0x10, 0x0E, 0x06, 0x2C, 0x83, 0x74, 0x65, 0x6A,
+    0x79, 0x00, 0x43, 0x08, 0x11, 0x09, 0x82, 0x6A, 0x76, 0x79, 0x00, 0x43, 0x09, 0x0C, 0x1A, 0x85,
+    0x69, 0x77, 0x66, 0x77, 0x6A, 0x79, 0x00, 0x47, 0x16, 0x0E, 0x10, 0x11, 0x1C, 0x14, 0x11, 0x85,
+    0x6B, 0x6D, 0x73, 0x79, 0x6A, 0x79, 0x00, 0x02, 0x18, 0x1B, 0x3E, 0x75, 0x48, 0x75, 0x43, 0x08,
+    0x09, 0x06, 0x83, 0x75, 0x65, 0x6B, 0x79, 0x00, 0x47, 0x08, 0x15, 0x12, 0x0D, 0x07, 0x13, 0x10,
+    0x84, 0x65, 0x72, 0x78, 0x6B, 0x79, 0x00, 0x02, 0x0B, 0x11, 0x5E, 0x75, 0x6B, 0x75, 0x44, 0x1C,
+    0x08, 0x0E, 0x05, 0x85, 0x65, 0x6B, 0x79, 0x68, 0x6C, 0x79, 0x00, 0x44, 0x09, 0x16, 0x10, 0x2C,
+    0x85, 0x73, 0x6D, 0x66, 0x6E, 0x6C, 0x79, 0x00, 0x05, 0x07, 0x0F, 0x10, 0x12, 0x15, 0x88, 0x75,
+    0xA4, 0x75, 0xB4, 0x75, 0xC3, 0x75, 0xCE, 0x75, 0x02, 0x0F, 0x12, 0x8F, 0x75, 0x99, 0x75, 0x42,
+    0x0A, 0x1B, 0x84, 0x6C, 0x67, 0x64, 0x6D, 0x79, 0x00, 0x42, 0x16, 0x0F, 0x85, 0x73, 0x6C, 0x6F,
+    0x64, 0x6D, 0x79, 0x00, 0x47, 0x0F, 0x0E, 0x06, 0x06, 0x18, 0x16, 0x09, 0x85, 0x6B, 0x63, 0x6C,
+    0x6C, 0x6D, 0x79, 0x00, 0x45, 0x0E, 0x14, 0x0D, 0x1C, 0x1D, 0x86, 0x6A, 0x79, 0x71, 0x6B, 0x6D,
+    0x6D, 0x79, 0x00, 0x44, 0x07, 0x12, 0x1D, 0x0A, 0x83, 0x6F, 0x64, 0x6D, 0x79, 0x00, 0x46, 0x06,
+    0x12, 0x1B, 0x1C, 0x15, 0x06, 0x83, 0x72, 0x63, 0x6D, 0x79, 0x00, 0x05, 0x06, 0x08, 0x0B, 0x0F,
+    0x1D, 0xEB, 0x75, 0xF8, 0x75, 0x03, 0x76, 0x13, 0x76, 0x1E, 0x76, 0x47, 0x11, 0x18, 0x13, 0x1A,
+    0x16, 0x0A, 0x0C, 0x82, 0x6E, 0x63, 0x79, 0x00, 0x43, 0x11, 0x1D, 0x0C, 0x84, 0x6E, 0x7A, 0x65,
+    0x6E, 0x79, 0x00, 0x46, 0x19, 0x18, 0x1C, 0x0E, 0x11, 0x19, 0x86, 0x79, 0x6B, 0x75, 0x76, 0x68,
+    0x6E, 0x79, 0x00, 0x44, 0x14, 0x0F, 0x07, 0x2C, 0x83, 0x6C, 0x71, 0x6E, 0x79, 0x00, 0x44, 0x0A,
+    0x07, 0x18, 0x18, 0x82, 0x6E, 0x7A, 0x79, 0x00, 0x46, 0x0A, 0x0B, 0x10, 0x1B, 0x1C, 0x2C, 0x81,
+    0x79, 0x70, 0x00, 0x03, 0x05, 0x11, 0x12, 0x3D, 0x76, 0x49, 0x76, 0x5A, 0x76, 0x45, 0x15, 0x19,
+    0x11, 0x1A, 0x0A, 0x83, 0x62, 0x72, 0x71, 0x79, 0x00, 0x46, 0x1A, 0x1B, 0x06, 0x1D, 0x0E, 0x1C,
+    0x87, 0x7A, 0x6B, 0x63, 0x78, 0x77, 0x6E, 0x71, 0x79, 0x00, 0x45, 0x1D, 0x1A, 0x14, 0x15, 0x0B,
+    0x81, 0x79, 0x71, 0x00, 0x06, 0x06, 0x0A, 0x0D, 0x12, 0x15, 0x16, 0x77, 0x76, 0x8F, 0x76, 0x98,
+    0x76, 0xAA, 0x76, 0xB6, 0x76, 0xC2, 0x76, 0x02, 0x0B, 0x0E, 0x7E, 0x76, 0x86, 0x76, 0x43, 0x1A,
+    0x04, 0x12, 0x81, 0x79, 0x72, 0x00, 0x43, 0x1D, 0x1B, 0x13, 0x82, 0x72, 0x63, 0x79, 0x00, 0x43,
+    0x06, 0x05, 0x1B, 0x82, 0x72, 0x67, 0x79, 0x00, 0x47, 0x0C, 0x08, 0x19, 0x16, 0x17, 0x13, 0x0A,
+    0x87, 0x73, 0x74, 0x76, 0x65, 0x69, 0x6A, 0x72, 0x79, 0x00, 0x44, 0x0F, 0x1A, 0x15, 0x0B, 0x84,
+    0x6C, 0x77, 0x6F, 0x72, 0x79, 0x00, 0x43, 0x0D, 0x0A, 0x08, 0x85, 0x67, 0x65, 0x6A, 0x72, 0x72,
+    0x79, 0x00, 0x45, 0x0C, 0x13, 0x07, 0x06, 0x1B, 0x83, 0x73, 0x69, 0x72, 0x79, 0x00, 0x03, 0x05,
+    0x0E, 0x15, 0xD8, 0x76, 0xE4, 0x76, 0xEE, 0x76, 0x44, 0x13, 0x0B, 0x07, 0x2C, 0x84, 0x70, 0x68,
+    0x62, 0x73, 0x79, 0x00, 0x44, 0x14, 0x1A, 0x14, 0x12, 0x82, 0x73, 0x6B, 0x79, 0x00, 0x45, 0x08,
+    0x18, 0x0B, 0x07, 0x04, 0x85, 0x75, 0x68, 0x65, 0x72, 0x73, 0x79, 0x00, 0x04, 0x0B, 0x0C, 0x16,
+    0x18, 0x09, 0x77, 0x1A, 0x77, 0x25, 0x77, 0x46, 0x77, 0x48, 0x05, 0x1B, 0x19, 0x08, 0x13, 0x09,
+    0x19, 0x2C, 0x85, 0x78, 0x76, 0x62, 0x68, 0x74, 0x79, 0x00, 0x46, 0x1B, 0x17, 0x19, 0x04, 0x0E,
+    0x0B, 0x81, 0x79, 0x74, 0x00, 0x02, 0x0E, 0x0F, 0x2C, 0x77, 0x36, 0x77, 0x43, 0x0A, 0x17, 0x2C,
+    0x83, 0x73, 0x6B, 0x74, 0x79, 0x00, 0x45, 0x0E, 0x0D, 0x16, 0x0F, 0x2C, 0x87, 0x73, 0x6C, 0x6A,
+    0x6B, 0x6C, 0x73, 0x74, 0x79, 0x00, 0x47, 0x1B, 0x08, 0x16, 0x0D, 0x07, 0x04, 0x08, 0x85, 0x65,
+    0x73, 0x78, 0x75, 0x74, 0x79, 0x00, 0x41, 0x04, 0x02, 0x0E, 0x13, 0x5F, 0x77, 0x6A, 0x77, 0x43,
+    0x13, 0x0A, 0x09, 0x84, 0x6B, 0x70, 0x61, 0x75, 0x79, 0x00, 0x43, 0x12, 0x15, 0x07, 0x84, 0x70,
+    0x6F, 0x61, 0x75, 0x79, 0x00, 0x04, 0x09, 0x0D, 0x16, 0x1A, 0x82, 0x77, 0x94, 0x77, 0x9F, 0x77,
+    0xBE, 0x77, 0x47, 0x0F, 0x12, 0x1C, 0x11, 0x08, 0x06, 0x2C, 0x87, 0x6E, 0x65, 0x79, 0x6F, 0x6C,
+    0x66, 0x76, 0x79, 0x00, 0x46, 0x15, 0x10, 0x12, 0x08, 0x1D, 0x0A, 0x81, 0x79, 0x76, 0x00, 0x02,
+    0x12, 0x19, 0xA6, 0x77, 0xB0, 0x77, 0x44, 0x0B, 0x10, 0x15, 0x2C, 0x82, 0x76, 0x73, 0x79, 0x00,
+    0x46, 0x17, 0x0E, 0x05, 0x0A, 0x17, 0x16, 0x84, 0x76, 0x74, 0x73, 0x76, 0x79, 0x00, 0x48, 0x04,
+    0x12, 0x15, 0x12, 0x17, 0x19, 0x06, 0x2C, 0x81, 0x79, 0x76, 0x00, 0x03, 0x0B, 0x14, 0x1C, 0xD5,
+    0x77, 0xDF, 0x77, 0xF0, 0x77, 0x45, 0x0D, 0x13, 0x07, 0x13, 0x2C, 0x81, 0x79, 0x77, 0x00, 0x47,
+    0x06, 0x19, 0x10, 0x11, 0x08, 0x14, 0x17, 0x86, 0x6D, 0x6E, 0x76, 0x63, 0x71, 0x77, 0x79, 0x00,
+    0x03, 0x12, 0x1B, 0x1C, 0xFA, 0x77, 0x01, 0x78, 0x0D, 0x78, 0x42, 0x17, 0x1A, 0x81, 0x79, 0x77,
+    0x00, 0x44, 0x17, 0x0B, 0x0C, 0x2C, 0x84, 0x78, 0x74, 0x79, 0x77, 0x79, 0x00, 0x45, 0x0C, 0x0E,
+    0x16, 0x10, 0x0A, 0x82, 0x77, 0x79, 0x79, 0x00, 0x02, 0x13, 0x1A, 0x1F, 0x78, 0x29, 0x78, 0x45,
+    0x10, 0x15, 0x0D, 0x0D, 0x2C, 0x81, 0x79, 0x78, 0x00, 0x47, 0x1C, 0x16, 0x04, 0x15, 0x1D, 0x15,
+    0x2C, 0x87, 0x72, 0x7A, 0x61, 0x73, 0x79, 0x77, 0x78, 0x79, 0x00, 0x02, 0x0B, 0x0C, 0x42, 0x78,
+    0x4D, 0x78, 0x43, 0x1C, 0x17, 0x08, 0x84, 0x79, 0x74, 0x68, 0x79, 0x79, 0x00, 0x43, 0x1A, 0x16,
+    0x14, 0x85, 0x73, 0x71, 0x77, 0x69, 0x79, 0x79, 0x00, 0x03, 0x05, 0x0B, 0x0F, 0x63, 0x78, 0x71,
+    0x78, 0x82, 0x78, 0x45, 0x07, 0x07, 0x09, 0x05, 0x18, 0x85, 0x64, 0x66, 0x64, 0x62, 0x7A, 0x79,
+    0x00, 0x48, 0x0A, 0x10, 0x11, 0x1A, 0x0A, 0x1A, 0x19, 0x2C, 0x85, 0x6D, 0x6E, 0x67, 0x68, 0x7A,
+    0x79, 0x00, 0x46, 0x0C, 0x09, 0x07, 0x1D, 0x14, 0x1C, 0x88, 0x71, 0x79, 0x7A, 0x64, 0x66, 0x69,
+    0x6C, 0x7A, 0x79, 0x00, 0x19, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1C, 0x1D, 0xE0, 0x78,
+    0x12, 0x79, 0x32, 0x79, 0x51, 0x79, 0x80, 0x79, 0xA4, 0x79, 0xD4, 0x79, 0x2F, 0x7A, 0x64, 0x7A,
+    0x96, 0x7A, 0xB9, 0x7A, 0x04, 0x7B, 0x1F, 0x7B, 0x5F, 0x7B, 0x92, 0x7B, 0xB8, 0x7B, 0xD6, 0x7B,
+    0x1D, 0x7C, 0x73, 0x7C, 0xB8, 0x7C, 0xC6, 0x7C, 0xE4, 0x7C, 0x34, 0x7D, 0x67, 0x7D, 0xAF, 0x7D,
+    0x03, 0x0A, 0x0F, 0x12, 0xEA, 0x78, 0xF6, 0x78, 0x06, 0x79, 0x45, 0x0E, 0x0E, 0x10, 0x15, 0x08,
+    0x83, 0x67, 0x6B, 0x61, 0x7A, 0x00, 0x45, 0x07, 0x1B, 0x07, 0x14, 0x0F, 0x87, 0x71, 0x6C, 0x64,
+    0x78, 0x64, 0x6C, 0x61, 0x7A, 0x00, 0x46, 0x0D, 0x09, 0x12, 0x0B, 0x1C, 0x0D, 0x82, 0x61, 0x6F,
+    0x7A, 0x00, 0x02, 0x14, 0x18, 0x19, 0x79, 0x25, 0x79, 0x43, 0x13, 0x13, 0x1A, 0x85, 0x70, 0x77,
+    0x70, 0x71, 0x62, 0x7A, 0x00, 0x45, 0x13, 0x0A, 0x0A, 0x15, 0x0D, 0x84, 0x70, 0x67, 0x75, 0x62,
+    0x7A, 0x00, 0x02, 0x0D, 0x1B, 0x39, 0x79, 0x44, 0x79, 0x43, 0x0A, 0x13, 0x05, 0x84, 0x67, 0x70,
+    0x6A, 0x63, 0x7A, 0x00, 0x45, 0x12, 0x15, 0x0C, 0x15, 0x10, 0x84, 0x6F, 0x72, 0x78, 0x63, 0x7A,
+    0x00, 0x03, 0x08, 0x0B, 0x0E, 0x5B, 0x79, 0x67, 0x79, 0x74, 0x79, 0x46, 0x07, 0x1B, 0x12, 0x16,
+    0x0E, 0x2C, 0x82, 0x64, 0x65, 0x7A, 0x00, 0x47, 0x09, 0x09, 0x0A, 0x06, 0x06, 0x0E, 0x09, 0x82,
+    0x64, 0x68, 0x7A, 0x00, 0x46, 0x0B, 0x0B, 0x10, 0x08, 0x06, 0x2C, 0x82, 0x64, 0x6B, 0x7A, 0x00,
+    0x02, 0x0D, 0x18, 0x87, 0x79, 0x95, 0x79, 0x44, 0x1D, 0x04, 0x04, 0x06, 0x86, 0x61, 0x63, 0x61,
+    0x7A, 0x6A, 0x65, 0x7A, 0x00, 0x46, 0x0B, 0x08, 0x1A, 0x14, 0x06, 0x16, 0x85, 0x65, 0x77, 0x68,
+    0x75, 0x65, 0x7A, 0x00, 0x03, 0x06, 0x0D, 0x1B, 0xAE, 0x79, 0xBE, 0x79, 0xC9, 0x79, 0x47, 0x18,
+    0x08, 0x07, 0x0D, 0x11, 0x05, 0x09, 0x85, 0x65, 0x64, 0x75, 0x63, 0x66, 0x7A, 0x00, 0x44, 0x17,
+    0x18, 0x1C, 0x0C, 0x83, 0x6A, 0x74, 0x66, 0x7A, 0x00, 0x45, 0x1D, 0x19, 0x0C, 0x0F, 0x19, 0x82,
+    0x66, 0x78, 0x7A, 0x00, 0x05, 0x04, 0x0D, 0x11, 0x18, 0x1D, 0xE4, 0x79, 0xF6, 0x79, 0x04, 0x7A,
+    0x11, 0x7A, 0x1D, 0x7A, 0x47, 0x08, 0x15, 0x1D, 0x06, 0x05, 0x1B, 0x18, 0x87, 0x63, 0x62, 0x7A,
+    0x72, 0x65, 0x61, 0x67, 0x7A, 0x00, 0x48, 0x14, 0x09, 0x0F, 0x07, 0x14, 0x18, 0x0D, 0x2C, 0x82,
+    0x67, 0x6A, 0x7A, 0x00, 0x45, 0x06, 0x07, 0x06, 0x14, 0x08, 0x84, 0x63, 0x64, 0x6E, 0x67, 0x7A,
+    0x00, 0x45, 0x1C, 0x07, 0x18, 0x15, 0x17, 0x83, 0x75, 0x79, 0x67, 0x7A, 0x00, 0x46, 0x1B, 0x1A,
+    0x18, 0x06, 0x10, 0x19, 0x88, 0x6D, 0x76, 0x63, 0x75, 0x77, 0x78, 0x7A, 0x67, 0x7A, 0x00, 0x02,
+    0x0C, 0x19, 0x36, 0x7A, 0x44, 0x7A, 0x45, 0x16, 0x04, 0x0A, 0x0D, 0x2C, 0x85, 0x61, 0x67, 0x73,
+    0x69, 0x68, 0x7A, 0x00, 0x02, 0x12, 0x1C, 0x4B, 0x7A, 0x5B, 0x7A, 0x46, 0x0E, 0x16, 0x04, 0x07,
+    0x0E, 0x14, 0x86, 0x73, 0x61, 0x6B, 0x6F, 0x76, 0x68, 0x7A, 0x00, 0x43, 0x0F, 0x09, 0x2C, 0x82,
+    0x68, 0x76, 0x7A, 0x00, 0x03, 0x05, 0x07, 0x0B, 0x6E, 0x7A, 0x7A, 0x7A, 0x8A, 0x7A, 0x45, 0x0E,
+    0x1B, 0x04, 0x0A, 0x0E, 0x83, 0x62, 0x6B, 0x69, 0x7A, 0x00, 0x45, 0x14, 0x1D, 0x1D, 0x14, 0x19,
+    0x87, 0x71, 0x76, 0x7A, 0x7A, 0x71, 0x64, 0x69, 0x7A, 0x00, 0x43, 0x0A, 0x19, 0x0E, 0x85, 0x76,
+    0x6B, 0x67, 0x68, 0x69, 0x7A, 0x00, 0x02, 0x0F, 0x1D, 0x9D, 0x7A, 0xAA, 0x7A, 0x47, 0x12, 0x14,
+    0x0B, 0x08, 0x13, 0x15, 0x0C, 0x82, 0x6A, 0x6C, 0x7A, 0x00, 0x47, 0x0B, 0x17, 0x0D, 0x13, 0x15,
+    0x1B, 0x2C, 0x84, 0x68, 0x74, 0x7A, 0x6A, 0x7A, 0x00, 0x04, 0x0C, 0x0D, 0x13, 0x15, 0xC6, 0x7A,
+    0xD5, 0x7A, 0xE6, 0x7A, 0xF5, 0x7A, 0x46, 0x0F, 0x17, 0x06, 0x14, 0x0F, 0x0C, 0x85, 0x74, 0x63,
+    0x6C, 0x69, 0x6B, 0x7A, 0x00, 0x46, 0x17, 0x0E, 0x10, 0x13, 0x1A, 0x19, 0x87, 0x70, 0x77, 0x6D,
+    0x6B, 0x74, 0x6A, 0x6B, 0x7A, 0x00, 0x47, 0x0C, 0x0B, 0x09, 0x16, 0x06, 0x1C, 0x08, 0x84, 0x69,
+    0x68, 0x70, 0x6B, 0x7A, 0x00, 0x45, 0x0B, 0x0E, 0x11, 0x1C, 0x17, 0x86, 0x6E, 0x79, 0x6B, 0x68,
+    0x72, 0x6B, 0x7A, 0x00, 0x02, 0x0C, 0x1C, 0x0B, 0x7B, 0x15, 0x7B, 0x43, 0x0A, 0x12, 0x19, 0x83,
+    0x69, 0x67, 0x6C, 0x7A, 0x00, 0x44, 0x0D, 0x1A, 0x0B, 0x2C, 0x82, 0x6C, 0x79, 0x7A, 0x00, 0x04,
+    0x0C, 0x10, 0x14, 0x18, 0x2C, 0x7B, 0x37, 0x7B, 0x43, 0x7B, 0x53, 0x7B, 0x44, 0x10, 0x0A, 0x1C,
+    0x2C, 0x83, 0x69, 0x6D, 0x6D, 0x7A, 0x00, 0x45, 0x12, 0x06, 0x04, 0x1B, 0x09, 0x83, 0x6D, 0x6F,
+    0x6D, 0x7A, 0x00, 0x46, 0x0C, 0x14, 0x1D, 0x0E, 0x07, 0x2C, 0x86, 0x7A, 0x6B, 0x71, 0x69, 0x71,
+    0x6D, 0x7A, 0x00, 0x46, 0x06, 0x1A, 0x18, 0x08, 0x19, 0x17, 0x82, 0x6D, 0x75, 0x7A, 0x00, 0x03,
+    0x11, 0x15, 0x16, 0x69, 0x7B, 0x75, 0x7B, 0x86, 0x7B, 0x43, 0x1B, 0x11, 0x09, 0x85, 0x6E, 0x66,
+    0x78, 0x6E, 0x6E, 0x7A, 0x00, 0x48, 0x0E, 0x13, 0x0F, 0x0E, 0x0A, 0x0C, 0x15, 0x2C, 0x85, 0x70,
+    0x6C, 0x6B, 0x72, 0x6E, 0x7A, 0x00, 0x43, 0x0B, 0x06, 0x16, 0x85, 0x63, 0x73, 0x68, 0x73, 0x6E,
+    0x7A, 0x00, 0x02, 0x04, 0x0F, 0x99, 0x7B, 0xAC, 0x7B, 0x47, 0x0E, 0x0A, 0x06, 0x17, 0x0F, 0x0D,
+    0x15, 0x88, 0x6C, 0x6A, 0x74, 0x63, 0x67, 0x6B, 0x61, 0x6F, 0x7A, 0x00, 0x46, 0x0E, 0x08, 0x18,
+    0x1A, 0x0B, 0x2C, 0x82, 0x6F, 0x6C, 0x7A, 0x00, 0x02, 0x05, 0x0E, 0xBF, 0x7B, 0xCA, 0x7B, 0x44,
+    0x18, 0x1B, 0x0A, 0x13, 0x83, 0x62, 0x75, 0x70, 0x7A, 0x00, 0x47, 0x1D, 0x14, 0x11, 0x1A, 0x0B,
+    0x12, 0x07, 0x81, 0x7A, 0x70, 0x00, 0x04, 0x06, 0x0F, 0x13, 0x17, 0xE3, 0x7B, 0xF4, 0x7B, 0x01,
+    0x7C, 0x0F, 0x7C, 0x47, 0x08, 0x1B, 0x12, 0x09, 0x13, 0x15, 0x0C, 0x86, 0x6F, 0x66, 0x78, 0x65,
+    0x63, 0x71, 0x7A, 0x00, 0x45, 0x14, 0x04, 0x12, 0x15, 0x1D, 0x84, 0x71, 0x61, 0x6C, 0x71, 0x7A,
+    0x00, 0x44, 0x09, 0x09, 0x1B, 0x17, 0x86, 0x78, 0x74, 0x66, 0x66, 0x70, 0x71, 0x7A, 0x00, 0x47,
+    0x04, 0x17, 0x1A, 0x0F, 0x18, 0x1A, 0x08, 0x83, 0x74, 0x61, 0x71, 0x7A, 0x00, 0x05, 0x04, 0x08,
+    0x0E, 0x14, 0x1C, 0x2D, 0x7C, 0x39, 0x7C, 0x4A, 0x7C, 0x56, 0x7C, 0x64, 0x7C, 0x43, 0x14, 0x0F,
+    0x0B, 0x85, 0x6C, 0x68, 0x71, 0x61, 0x72, 0x7A, 0x00, 0x46, 0x19, 0x09, 0x08, 0x06, 0x16, 0x07,
+    0x87, 0x63, 0x73, 0x65, 0x66, 0x76, 0x65, 0x72, 0x7A, 0x00, 0x44, 0x15, 0x1B, 0x12, 0x0F, 0x84,
+    0x72, 0x78, 0x6B, 0x72, 0x7A, 0x00, 0x44, 0x12, 0x06, 0x0E, 0x1C, 0x86, 0x6B, 0x79, 0x63, 0x6F,
+    0x71, 0x72, 0x7A, 0x00, 0x45, 0x06, 0x04, 0x0A, 0x1C, 0x18, 0x86, 0x67, 0x79, 0x61, 0x63, 0x79,
+    0x72, 0x7A, 0x00, 0x04, 0x06, 0x0D, 0x11, 0x1A, 0x80, 0x7C, 0x91, 0x7C, 0x9A, 0x7C, 0xAD, 0x7C,
+    0x47, 0x18, 0x14, 0x06, 0x16, 0x16, 0x06, 0x0F, 0x86, 0x63, 0x73, 0x71, 0x75, 0x63, 0x73, 0x7A,
+    0x00, 0x44, 0x0A, 0x09, 0x0C, 0x1C, 0x81, 0x7A, 0x73, 0x00, 0x47, 0x19, 0x14, 0x0F, 0x13, 0x12,
+    0x1D, 0x19, 0x88, 0x6F, 0x7A, 0x70, 0x6C, 0x71, 0x76, 0x6E, 0x73, 0x7A, 0x00, 0x44, 0x19, 0x1C,
+    0x1C, 0x10, 0x83, 0x77, 0x76, 0x73, 0x7A, 0x00, 0x48, 0x13, 0x07, 0x13, 0x0A, 0x19, 0x11, 0x1B,
+    0x19, 0x82, 0x74, 0x70, 0x7A, 0x00, 0x02, 0x09, 0x0D, 0xCD, 0x7C, 0xDB, 0x7C, 0x44, 0x10, 0x05,
+    0x09, 0x07, 0x86, 0x66, 0x64, 0x62, 0x6D, 0x66, 0x75, 0x7A, 0x00, 0x43, 0x1C, 0x0F, 0x1A, 0x82,
+    0x75, 0x6A, 0x7A, 0x00, 0x05, 0x08, 0x09, 0x0A, 0x18, 0x1B, 0xF4, 0x7C, 0x05, 0x7D, 0x11, 0x7D,
+    0x1C, 0x7D, 0x2B, 0x7D, 0x47, 0x06, 0x07, 0x0C, 0x15, 0x0D, 0x19, 0x2C, 0x86, 0x69, 0x72, 0x64,
+    0x63, 0x65, 0x76, 0x7A, 0x00, 0x43, 0x05, 0x1D, 0x18, 0x85, 0x7A, 0x75, 0x62, 0x66, 0x76, 0x7A,
+    0x00, 0x46, 0x1D, 0x0F, 0x13, 0x0C, 0x0D, 0x0D, 0x81, 0x7A, 0x76, 0x00, 0x45, 0x07, 0x09, 0x1D,
+    0x0E, 0x15, 0x86, 0x7A, 0x6B, 0x66, 0x64, 0x75, 0x76, 0x7A, 0x00, 0x44, 0x10, 0x09, 0x15, 0x2C,
+    0x81, 0x7A, 0x76, 0x00, 0x03, 0x0E, 0x14, 0x15, 0x3E, 0x7D, 0x4A, 0x7D, 0x5A, 0x7D, 0x45, 0x13,
+    0x0E, 0x1B, 0x04, 0x1C, 0x83, 0x6B, 0x70, 0x77, 0x7A, 0x00, 0x45, 0x07, 0x06, 0x1D, 0x0E, 0x0F,
+    0x87, 0x6B, 0x6C, 0x7A, 0x63, 0x64, 0x71, 0x77, 0x7A, 0x00, 0x44, 0x0C, 0x16, 0x10, 0x1D, 0x85,
+    0x73, 0x6D, 0x69, 0x72, 0x77, 0x7A, 0x00, 0x04, 0x0F, 0x14, 0x19, 0x1C, 0x74, 0x7D, 0x80, 0x7D,
+    0x8F, 0x7D, 0x9C, 0x7D, 0x43, 0x1A, 0x19, 0x08, 0x85, 0x76, 0x65, 0x77, 0x6C, 0x79, 0x7A, 0x00,
+    0x45, 0x1C, 0x0F, 0x12, 0x19, 0x2C, 0x86, 0x6F, 0x76, 0x6C, 0x79, 0x71, 0x79, 0x7A, 0x00, 0x47,
+    0x0E, 0x1A, 0x1A, 0x18, 0x04, 0x12, 0x2C, 0x82, 0x79, 0x76, 0x7A, 0x00, 0x47, 0x10, 0x1C, 0x14,
+    0x0C, 0x1D, 0x0E, 0x14, 0x88, 0x7A, 0x6B, 0x69, 0x71, 0x79, 0x6D, 0x79, 0x79, 0x7A, 0x00, 0x03,
+    0x0F, 0x11, 0x16, 0xB9, 0x7D, 0xC7, 0x7D, 0xD6, 0x7D, 0x45, 0x14, 0x07, 0x04, 0x10, 0x2C, 0x85,
+    0x64, 0x61, 0x71, 0x6C, 0x7A, 0x7A, 0x00, 0x45, 0x12, 0x16, 0x11, 0x0D, 0x2C, 0x86, 0x6E, 0x6A,
+    0x73, 0x6F, 0x6E, 0x7A, 0x7A, 0x00, 0x47, 0x17, 0x09, 0x06, 0x15, 0x10, 0x13, 0x15, 0x88, 0x6D,
+    0x70, 0x72, 0x63, 0x66, 0x74, 0x73, 0x7A, 0x7A, 0x00, 0x1A, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    0x1A, 0x1B, 0x1C, 0x1D, 0x38, 0x7E, 0xB1, 0x7E, 0x47, 0x7F, 0x13, 0x80, 0x68, 0x80, 0xC2, 0x80,
+    0x23, 0x81, 0x74, 0x81, 0x07, 0x82, 0xB6, 0x82, 0x7A, 0x83, 0xE1, 0x83, 0x14, 0x84, 0x6D, 0x84,
+    0xCE, 0x84, 0x80, 0x85, 0xF5, 0x85, 0x85, 0x86, 0xE6, 0x86, 0x46, 0x87, 0xCC, 0x87, 0x50, 0x88,
+    0xC4, 0x88, 0x3B, 0x89, 0xE8, 0x89, 0xBA, 0x8A, 0x07, 0x06, 0x08, 0x0C, 0x0F, 0x17, 0x1B, 0x1C,
+    0x4E, 0x7E, 0x59, 0x7E, 0x6C, 0x7E, 0x7B, 0x7E, 0x89, 0x7E, 0x96, 0x7E, 0xA0, 0x7E, 0x44, 0x04,
+    0x0E, 0x06, 0x10, 0x84, 0x61, 0x6B, 0x63, 0x61, 0x00, 0x48, 0x1D, 0x0E, 0x0A, 0x04, 0x04, 0x08,
+    0x0F, 0x05, 0x88, 0x61, 0x65, 0x61, 0x67, 0x6B, 0x7A, 0x65, 0x61, 0x00, 0x47, 0x14, 0x0D, 0x12,
+    0x18, 0x18, 0x13, 0x16, 0x85, 0x6A, 0x6F, 0x71, 0x69, 0x61, 0x00, 0x45, 0x07, 0x09, 0x19, 0x17,
+    0x12, 0x86, 0x76, 0x74, 0x66, 0x64, 0x6C, 0x61, 0x00, 0x46, 0x19, 0x06, 0x13, 0x06, 0x04, 0x0C,
+    0x84, 0x76, 0x63, 0x74, 0x61, 0x00, 0x44, 0x0D, 0x19, 0x08, 0x18, 0x83, 0x78, 0x6A, 0x61, 0x00,
+    0x46, 0x04, 0x04, 0x10, 0x0B, 0x15, 0x0E, 0x88, 0x72, 0x6B, 0x68, 0x6D, 0x61, 0x61, 0x79, 0x61,
+    0x00, 0x07, 0x04, 0x07, 0x0D, 0x11, 0x17, 0x1A, 0x1C, 0xC7, 0x7E, 0xD8, 0x7E, 0xF3, 0x7E, 0x01,
+    0x7F, 0x12, 0x7F, 0x2D, 0x7F, 0x38, 0x7F, 0x46, 0x16, 0x0E, 0x0D, 0x19, 0x0B, 0x07, 0x88, 0x68,
+    0x64, 0x76, 0x6A, 0x6B, 0x73, 0x61, 0x62, 0x00, 0x02, 0x16, 0x1A, 0xDF, 0x7E, 0xE9, 0x7E, 0x43,
+    0x1A, 0x1A, 0x04, 0x84, 0x73, 0x77, 0x64, 0x62, 0x00, 0x45, 0x19, 0x16, 0x0B, 0x11, 0x14, 0x82,
+    0x62, 0x64, 0x00, 0x48, 0x1D, 0x08, 0x1D, 0x14, 0x05, 0x14, 0x10, 0x10, 0x83, 0x6A, 0x7A, 0x62,
+    0x00, 0x47, 0x11, 0x1D, 0x17, 0x17, 0x1C, 0x0B, 0x12, 0x87, 0x74, 0x79, 0x74, 0x7A, 0x6E, 0x6E,
+    0x62, 0x00, 0x02, 0x11, 0x16, 0x19, 0x7F, 0x21, 0x7F, 0x43, 0x07, 0x0A, 0x0F, 0x82, 0x62, 0x74,
+    0x00, 0x43, 0x0E, 0x0C, 0x11, 0x86, 0x69, 0x6E, 0x6B, 0x73, 0x74, 0x62, 0x00, 0x46, 0x0F, 0x0F,
+    0x07, 0x0C, 0x06, 0x0E, 0x82, 0x62, 0x77, 0x00, 0x45, 0x18, 0x1D, 0x05, 0x0E, 0x0A, 0x87, 0x6B,
+    0x67, 0x62, 0x7A, 0x75, 0x79, 0x62, 0x00, 0x09, 0x04, 0x05, 0x09, 0x0C, 0x11, 0x12, 0x13, 0x15,
+    0x18, 0x63, 0x7F, 0x6F, 0x7F, 0x7A, 0x7F, 0x86, 0x7F, 0xAC, 0x7F, 0xC9, 0x7F, 0xDA, 0x7F, 0xE5,
+    0x7F, 0x09, 0x80, 0x47, 0x04, 0x19, 0x1A, 0x1C, 0x1B, 0x0B, 0x14, 0x82, 0x63, 0x61, 0x00, 0x46,
+    0x06, 0x13, 0x0D, 0x0B, 0x09, 0x17, 0x82, 0x63, 0x62, 0x00, 0x44, 0x18, 0x0A, 0x0C, 0x0B, 0x85,
+    0x67, 0x69, 0x75, 0x66, 0x63, 0x00, 0x02, 0x13, 0x1D, 0x8D, 0x7F, 0x9D, 0x7F, 0x46, 0x14, 0x07,
+    0x0F, 0x0E, 0x0C, 0x19, 0x87, 0x6C, 0x6B, 0x64, 0x71, 0x70, 0x69, 0x63, 0x00, 0x47, 0x16, 0x1D,
+    0x1A, 0x09, 0x0D, 0x1C, 0x08, 0x85, 0x73, 0x7A, 0x7A, 0x69, 0x63, 0x00, 0x02, 0x14, 0x19, 0xB3,
+    0x7F, 0xC0, 0x7F, 0x44, 0x12, 0x15, 0x1D, 0x09, 0x86, 0x72, 0x7A, 0x6F, 0x71, 0x6E, 0x63, 0x00,
+    0x44, 0x0C, 0x15, 0x0E, 0x0B, 0x82, 0x63, 0x6E, 0x00, 0x48, 0x1B, 0x17, 0x1A, 0x07, 0x0D, 0x05,
+    0x18, 0x0C, 0x86, 0x77, 0x64, 0x74, 0x78, 0x6F, 0x63, 0x00, 0x46, 0x17, 0x13, 0x1C, 0x16, 0x1B,
+    0x0B, 0x82, 0x63, 0x70, 0x00, 0x02, 0x04, 0x14, 0xEC, 0x7F, 0xF9, 0x7F, 0x46, 0x08, 0x1D, 0x13,
+    0x1A, 0x13, 0x16, 0x84, 0x61, 0x65, 0x72, 0x63, 0x00, 0x47, 0x16, 0x15, 0x05, 0x06, 0x11, 0x07,
+    0x17, 0x86, 0x72, 0x62, 0x73, 0x71, 0x72, 0x63, 0x00, 0x45, 0x16, 0x14, 0x17, 0x05, 0x05, 0x82,
+    0x63, 0x75, 0x00, 0x05, 0x06, 0x07, 0x13, 0x17, 0x19, 0x23, 0x80, 0x30, 0x80, 0x3C, 0x80, 0x4F,
+    0x80, 0x5C, 0x80, 0x48, 0x1C, 0x18, 0x15, 0x09, 0x15, 0x06, 0x15, 0x18, 0x82, 0x64, 0x63, 0x00,
+    0x46, 0x1C, 0x17, 0x12, 0x19, 0x0F, 0x10, 0x83, 0x64, 0x79, 0x64, 0x00, 0x47, 0x16, 0x0F, 0x10,
+    0x0D, 0x0E, 0x1D, 0x0D, 0x89, 0x7A, 0x6A, 0x6B, 0x6A, 0x6D, 0x6C, 0x73, 0x70, 0x64, 0x00, 0x44,
+    0x1C, 0x06, 0x0E, 0x14, 0x86, 0x6B, 0x71, 0x63, 0x79, 0x74, 0x64, 0x00, 0x46, 0x1C, 0x0F, 0x15,
+    0x17, 0x1A, 0x0A, 0x83, 0x76, 0x79, 0x64, 0x00, 0x04, 0x05, 0x0A, 0x0F, 0x12, 0x75, 0x80, 0x84,
+    0x80, 0xAC, 0x80, 0xB8, 0x80, 0x45, 0x0D, 0x09, 0x05, 0x13, 0x0D, 0x87, 0x70, 0x6A, 0x62, 0x66,
+    0x6A, 0x62, 0x65, 0x00, 0x02, 0x09, 0x0A, 0x8B, 0x80, 0x9E, 0x80, 0x47, 0x07, 0x17, 0x0F, 0x13,
+    0x17, 0x1D, 0x1D, 0x89, 0x74, 0x7A, 0x70, 0x6C, 0x74, 0x64, 0x66, 0x67, 0x65, 0x00, 0x45, 0x13,
+    0x14, 0x04, 0x14, 0x0F, 0x86, 0x71, 0x61, 0x70, 0x67, 0x67, 0x65, 0x00, 0x46, 0x07, 0x0D, 0x10,
+    0x10, 0x14, 0x10, 0x83, 0x6C, 0x64, 0x65, 0x00, 0x44, 0x13, 0x1C, 0x07, 0x09, 0x83, 0x6F, 0x70,
+    0x65, 0x00, 0x04, 0x0A, 0x10, 0x12, 0x15, 0xCF, 0x80, 0xF0, 0x80, 0xFE, 0x80, 0x12, 0x81, 0x02,
+    0x06, 0x0A, 0xD6, 0x80, 0xE2, 0x80, 0x47, 0x10, 0x15, 0x1A, 0x11, 0x18, 0x19, 0x05, 0x82, 0x66,
+    0x67, 0x00, 0x45, 0x0E, 0x0B, 0x0F, 0x0A, 0x0F, 0x86, 0x68, 0x6C, 0x6B, 0x67, 0x67, 0x66, 0x00,
+    0x47, 0x0C, 0x0F, 0x0B, 0x0B, 0x09, 0x17, 0x18, 0x84, 0x69, 0x6C, 0x6D, 0x66, 0x00, 0x48, 0x0A,
+    0x05, 0x0A, 0x07, 0x0F, 0x19, 0x16, 0x0C, 0x89, 0x76, 0x73, 0x6C, 0x64, 0x67, 0x62, 0x67, 0x6F,
+    0x66, 0x00, 0x46, 0x0D, 0x0E, 0x1A, 0x18, 0x05, 0x14, 0x88, 0x62, 0x71, 0x75, 0x77, 0x6B, 0x6A,
+    0x72, 0x66, 0x00, 0x05, 0x04, 0x0A, 0x0F, 0x1C, 0x1D, 0x33, 0x81, 0x44, 0x81, 0x4F, 0x81, 0x5D,
+    0x81, 0x68, 0x81, 0x46, 0x12, 0x0B, 0x0D, 0x1C, 0x12, 0x0C, 0x88, 0x6F, 0x69, 0x79, 0x6A, 0x68,
+    0x6F, 0x61, 0x67, 0x00, 0x44, 0x17, 0x12, 0x05, 0x13, 0x84, 0x74, 0x6F, 0x67, 0x67, 0x00, 0x48,
+    0x0C, 0x0D, 0x1D, 0x15, 0x0C, 0x14, 0x1A, 0x05, 0x83, 0x6C, 0x69, 0x67, 0x00, 0x46, 0x04, 0x19,
+    0x0A, 0x1C, 0x12, 0x0B, 0x82, 0x67, 0x79, 0x00, 0x46, 0x0E, 0x14, 0x0D, 0x12, 0x13, 0x08, 0x83,
+    0x7A, 0x6B, 0x67, 0x00, 0x07, 0x04, 0x0C, 0x11, 0x17, 0x18, 0x1A, 0x1B, 0x8A, 0x81, 0x96, 0x81,
+    0xA5, 0x81, 0xB4, 0x81, 0xC4, 0x81, 0xCE, 0x81, 0xE1, 0x81, 0x47, 0x1B, 0x12, 0x1B, 0x0E, 0x0C,
+    0x0D, 0x1B, 0x82, 0x68, 0x61, 0x00, 0x45, 0x15, 0x07, 0x0F, 0x06, 0x0A, 0x87, 0x63, 0x67, 0x6C,
+    0x64, 0x72, 0x69, 0x68, 0x00, 0x46, 0x1B, 0x0C, 0x15, 0x1B, 0x04, 0x05, 0x86, 0x72, 0x78, 0x69,
+    0x78, 0x6E, 0x68, 0x00, 0x48, 0x18, 0x18, 0x0D, 0x10, 0x15, 0x0B, 0x11, 0x0C, 0x85, 0x75, 0x6A,
+    0x75, 0x74, 0x68, 0x00, 0x44, 0x14, 0x16, 0x17, 0x10, 0x83, 0x75, 0x71, 0x68, 0x00, 0x48, 0x05,
+    0x09, 0x18, 0x1C, 0x07, 0x09, 0x0A, 0x17, 0x88, 0x64, 0x66, 0x79, 0x75, 0x66, 0x62, 0x77, 0x68,
+    0x00, 0x02, 0x0D, 0x19, 0xE8, 0x81, 0xF6, 0x81, 0x46, 0x0E, 0x0C, 0x0F, 0x16, 0x04, 0x07, 0x85,
+    0x6B, 0x69, 0x6A, 0x78, 0x68, 0x00, 0x46, 0x0A, 0x05, 0x17, 0x13, 0x1A, 0x07, 0x88, 0x70, 0x77,
+    0x74, 0x62, 0x67, 0x76, 0x78, 0x68, 0x00, 0x09, 0x07, 0x0C, 0x0D, 0x10, 0x11, 0x12, 0x16, 0x17,
+    0x19, 0x23, 0x82, 0x49, 0x82, 0x5C, 0x82, 0x6B, 0x82, 0x76, 0x82, 0x84, 0x82, 0x93, 0x82, 0x9E,
+    0x82, 0xAB, 0x82, 0x02, 0x05, 0x1A, 0x2A, 0x82, 0x35, 0x82, 0x45, 0x1B, 0x04, 0x1B, 0x13, 0x1D,
+    0x83, 0x64, 0x62, 0x69, 0x00, 0x47, 0x1D, 0x09, 0x12, 0x09, 0x09, 0x16, 0x14, 0x8A, 0x73, 0x71,
+    0x66, 0x66, 0x6F, 0x66, 0x7A, 0x77, 0x64, 0x69, 0x00, 0x48, 0x1A, 0x1A, 0x13, 0x08, 0x0E, 0x05,
+    0x13, 0x05, 0x88, 0x6B, 0x62, 0x65, 0x70, 0x77, 0x77, 0x69, 0x69, 0x00, 0x47, 0x18, 0x1B, 0x13,
+    0x09, 0x16, 0x07, 0x18, 0x85, 0x78, 0x70, 0x75, 0x6A, 0x69, 0x00, 0x44, 0x15, 0x05, 0x15, 0x1B,
+    0x84, 0x72, 0x62, 0x6D, 0x69, 0x00, 0x46, 0x09, 0x19, 0x07, 0x15, 0x1C, 0x09, 0x85, 0x76, 0x64,
+    0x66, 0x6E, 0x69, 0x00, 0x47, 0x1C, 0x10, 0x17, 0x18, 0x07, 0x19, 0x1B, 0x85, 0x6D, 0x74, 0x79,
+    0x6F, 0x69, 0x00, 0x44, 0x10, 0x13, 0x12, 0x15, 0x84, 0x6D, 0x70, 0x73, 0x69, 0x00, 0x47, 0x12,
+    0x0C, 0x0C, 0x1B, 0x09, 0x1B, 0x16, 0x83, 0x74, 0x6F, 0x69, 0x00, 0x44, 0x05, 0x09, 0x05, 0x16,
+    0x84, 0x62, 0x66, 0x76, 0x69, 0x00, 0x09, 0x07, 0x09, 0x0E, 0x15, 0x17, 0x19, 0x1B, 0x1C, 0x1D,
+    0xD2, 0x82, 0xE4, 0x82, 0x07, 0x83, 0x21, 0x83, 0x2C, 0x83, 0x3E, 0x83, 0x48, 0x83, 0x57, 0x83,
+    0x68, 0x83, 0x47, 0x06, 0x0E, 0x13, 0x15, 0x11, 0x05, 0x12, 0x88, 0x6E, 0x62, 0x72, 0x70, 0x6B,
+    0x63, 0x64, 0x6A, 0x00, 0x02, 0x08, 0x0C, 0xEB, 0x82, 0xF8, 0x82, 0x45, 0x12, 0x1C, 0x04, 0x1A,
+    0x0A, 0x85, 0x6F, 0x79, 0x65, 0x66, 0x6A, 0x00, 0x46, 0x06, 0x17, 0x12, 0x1A, 0x0E, 0x0B, 0x86,
+    0x74, 0x6F, 0x63, 0x69, 0x66, 0x6A, 0x00, 0x02, 0x06, 0x09, 0x0E, 0x83, 0x18, 0x83, 0x43, 0x08,
+    0x11, 0x17, 0x84, 0x63, 0x65, 0x6B, 0x6A, 0x00, 0x44, 0x07, 0x17, 0x14, 0x0C, 0x82, 0x6A, 0x6B,
+    0x00, 0x45, 0x1C, 0x07, 0x17, 0x07, 0x07, 0x83, 0x72, 0x79, 0x6A, 0x00, 0x47, 0x11, 0x0A, 0x0A,
+    0x18, 0x06, 0x0B, 0x0C, 0x88, 0x63, 0x68, 0x75, 0x67, 0x67, 0x6E, 0x74, 0x6A, 0x00, 0x44, 0x0C,
+    0x06, 0x08, 0x08, 0x83, 0x76, 0x69, 0x6A, 0x00, 0x47, 0x11, 0x17, 0x18, 0x0C, 0x07, 0x0C, 0x1A,
+    0x85, 0x74, 0x75, 0x6E, 0x78, 0x6A, 0x00, 0x47, 0x12, 0x05, 0x19, 0x12, 0x06, 0x0C, 0x15, 0x87,
+    0x6F, 0x63, 0x76, 0x62, 0x6F, 0x79, 0x6A, 0x00, 0x48, 0x0C, 0x05, 0x11, 0x18, 0x0A, 0x0E, 0x19,
+    0x04, 0x87, 0x75, 0x67, 0x6E, 0x62, 0x69, 0x7A, 0x6A, 0x00, 0x05, 0x09, 0x0D, 0x11, 0x15, 0x1A,
+    0x8A, 0x83, 0x95, 0x83, 0xA5, 0x83, 0xB1, 0x83, 0xBF, 0x83, 0x44, 0x12, 0x14, 0x1A, 0x1D, 0x84,
+    0x6F, 0x71, 0x66, 0x6B, 0x00, 0x46, 0x0F, 0x07, 0x17, 0x1A, 0x0E, 0x1C, 0x87, 0x77, 0x6B, 0x74,
+    0x64, 0x6C, 0x6A, 0x6B, 0x00, 0x44, 0x12, 0x17, 0x0B, 0x14, 0x85, 0x74, 0x68, 0x6F, 0x6E, 0x6B,
+    0x00, 0x47, 0x1C, 0x15, 0x0A, 0x0B, 0x07, 0x17, 0x1C, 0x84, 0x79, 0x72, 0x72, 0x6B, 0x00, 0x02,
+    0x08, 0x0B, 0xC6, 0x83, 0xD1, 0x83, 0x45, 0x1B, 0x13, 0x17, 0x07, 0x06, 0x83, 0x77, 0x65, 0x6B,
+    0x00, 0x47, 0x1C, 0x0F, 0x1B, 0x06, 0x17, 0x1D, 0x06, 0x86, 0x6C, 0x78, 0x79, 0x68, 0x77, 0x6B,
+    0x00, 0x03, 0x0E, 0x10, 0x17, 0xEB, 0x83, 0xFA, 0x83, 0x04, 0x84, 0x46, 0x11, 0x0B, 0x14, 0x0E,
+    0x11, 0x13, 0x86, 0x71, 0x6B, 0x68, 0x6E, 0x6B, 0x6C, 0x00, 0x44, 0x04, 0x16, 0x07, 0x11, 0x83,
+    0x6D, 0x61, 0x6C, 0x00, 0x46, 0x07, 0x0F, 0x13, 0x07, 0x15, 0x1C, 0x87, 0x64, 0x72, 0x70, 0x6C,
+    0x64, 0x74, 0x6C, 0x00, 0x05, 0x06, 0x07, 0x10, 0x1B, 0x1D, 0x24, 0x84, 0x35, 0x84, 0x46, 0x84,
+    0x56, 0x84, 0x60, 0x84, 0x46, 0x12, 0x08, 0x08, 0x1C, 0x1D, 0x19, 0x88, 0x7A, 0x76, 0x79, 0x65,
+    0x65, 0x6F, 0x63, 0x6D, 0x00, 0x46, 0x1A, 0x16, 0x09, 0x13, 0x08, 0x19, 0x88, 0x65, 0x76, 0x70,
+    0x66, 0x73, 0x77, 0x64, 0x6D, 0x00, 0x46, 0x0C, 0x09, 0x13, 0x0E, 0x1A, 0x10, 0x87, 0x6B, 0x77,
+    0x70, 0x66, 0x69, 0x6D, 0x6D, 0x00, 0x44, 0x0B, 0x0D, 0x18, 0x14, 0x83, 0x78, 0x68, 0x6D, 0x00,
+    0x45, 0x12, 0x16, 0x0F, 0x13, 0x05, 0x85, 0x73, 0x6C, 0x6F, 0x7A, 0x6D, 0x00, 0x06, 0x04, 0x0E,
+    0x10, 0x15, 0x16, 0x19, 0x80, 0x84, 0x8B, 0x84, 0x9A, 0x84, 0xA4, 0x84, 0xB0, 0x84, 0xBD, 0x84,
+    0x44, 0x07, 0x0F, 0x12, 0x1B, 0x84, 0x64, 0x6C, 0x61, 0x6E, 0x00, 0x45, 0x17, 0x05, 0x07, 0x1C,
+    0x17, 0x87, 0x79, 0x74, 0x64, 0x62, 0x74, 0x6B, 0x6E, 0x00, 0x45, 0x07, 0x19, 0x12, 0x1C, 0x11,
+    0x82, 0x6E, 0x6D, 0x00, 0x44, 0x14, 0x07, 0x18, 0x1A, 0x85, 0x64, 0x75, 0x71, 0x72, 0x6E, 0x00,
+    0x44, 0x1D, 0x1B, 0x05, 0x14, 0x86, 0x62, 0x71, 0x78, 0x7A, 0x73, 0x6E, 0x00, 0x47, 0x18, 0x0C,
+    0x0D, 0x1D, 0x09, 0x07, 0x16, 0x87, 0x7A, 0x66, 0x6A, 0x69, 0x75, 0x76, 0x6E, 0x00, 0x08, 0x04,
+    0x07, 0x08, 0x0A, 0x0D, 0x0F, 0x17, 0x1D, 0xE7, 0x84, 0x0A, 0x85, 0x17, 0x85, 0x27, 0x85, 0x33,
+    0x85, 0x40, 0x85, 0x4C, 0x85, 0x74, 0x85, 0x02, 0x0D, 0x15, 0xEE, 0x84, 0xFD, 0x84, 0x45, 0x1D,
+    0x11, 0x07, 0x16, 0x06, 0x87, 0x64, 0x73, 0x6E, 0x7A, 0x6A, 0x61, 0x6F, 0x00, 0x45, 0x0D, 0x0A,
+    0x10, 0x0D, 0x05, 0x85, 0x6A, 0x67, 0x72, 0x61, 0x6F, 0x00, 0x48, 0x07, 0x10, 0x12, 0x06, 0x1B,
+    0x18, 0x0F, 0x09, 0x82, 0x6F, 0x64, 0x00, 0x48, 0x14, 0x0F, 0x0C, 0x0A, 0x19, 0x0A, 0x09, 0x16,
+    0x85, 0x6C, 0x69, 0x71, 0x65, 0x6F, 0x00, 0x46, 0x0C, 0x09, 0x17, 0x0A, 0x04, 0x18, 0x83, 0x67,
+    0x69, 0x6F, 0x00, 0x44, 0x0E, 0x0C, 0x08, 0x0C, 0x86, 0x65, 0x69, 0x69, 0x6B, 0x6A, 0x6F, 0x00,
+    0x47, 0x05, 0x0F, 0x17, 0x18, 0x1B, 0x07, 0x15, 0x82, 0x6F, 0x6C, 0x00, 0x02, 0x0E, 0x19, 0x53,
+    0x85, 0x62, 0x85, 0x46, 0x1D, 0x13, 0x15, 0x0A, 0x0C, 0x12, 0x86, 0x70, 0x72, 0x7A, 0x6B, 0x74,
+    0x6F, 0x00, 0x47, 0x14, 0x08, 0x0B, 0x18, 0x10, 0x04, 0x0A, 0x88, 0x75, 0x6D, 0x68, 0x65, 0x71,
+    0x76, 0x74, 0x6F, 0x00, 0x45, 0x1C, 0x16, 0x1C, 0x05, 0x16, 0x84, 0x79, 0x73, 0x7A, 0x6F, 0x00,
+    0x06, 0x07, 0x11, 0x12, 0x14, 0x1A, 0x1C, 0x93, 0x85, 0x9E, 0x85, 0xB9, 0x85, 0xCA, 0x85, 0xD4,
+    0x85, 0xE1, 0x85, 0x46, 0x10, 0x14, 0x18, 0x0E, 0x1B, 0x0E, 0x82, 0x70, 0x64, 0x00, 0x02, 0x13,
+    0x15, 0xA5, 0x85, 0xAE, 0x85, 0x44, 0x0D, 0x13, 0x19, 0x12, 0x82, 0x70, 0x6E, 0x00, 0x45, 0x1D,
+    0x12, 0x1C, 0x0D, 0x0B, 0x83, 0x6E, 0x72, 0x70, 0x00, 0x47, 0x0F, 0x11, 0x17, 0x07, 0x08, 0x07,
+    0x1C, 0x87, 0x64, 0x65, 0x74, 0x6E, 0x6C, 0x6F, 0x70, 0x00, 0x44, 0x05, 0x11, 0x18, 0x0B, 0x83,
+    0x71, 0x62, 0x70, 0x00, 0x45, 0x06, 0x1B, 0x14, 0x06, 0x1B, 0x85, 0x78, 0x71, 0x63, 0x77, 0x70,
+    0x00, 0x48, 0x15, 0x12, 0x0D, 0x1B, 0x1D, 0x0D, 0x1D, 0x07, 0x89, 0x6A, 0x7A, 0x7A, 0x78, 0x6A,
+    0x6F, 0x72, 0x79, 0x70, 0x00, 0x08, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x1A, 0x1D, 0x0E, 0x86,
+    0x1C, 0x86, 0x3B, 0x86, 0x44, 0x86, 0x4E, 0x86, 0x5C, 0x86, 0x65, 0x86, 0x75, 0x86, 0x46, 0x17,
+    0x04, 0x0A, 0x05, 0x18, 0x06, 0x85, 0x61, 0x67, 0x74, 0x64, 0x71, 0x00, 0x02, 0x13, 0x17, 0x23,
+    0x86, 0x2E, 0x86, 0x44, 0x0C, 0x17, 0x1C, 0x18, 0x84, 0x70, 0x69, 0x65, 0x71, 0x00, 0x44, 0x16,
+    0x14, 0x0E, 0x08, 0x86, 0x71, 0x6B, 0x73, 0x74, 0x65, 0x71, 0x00, 0x44, 0x0E, 0x18, 0x08, 0x17,
+    0x82, 0x71, 0x66, 0x00, 0x44, 0x1C, 0x16, 0x0B, 0x07, 0x83, 0x6D, 0x79, 0x71, 0x00, 0x46, 0x11,
+    0x10, 0x12, 0x0A, 0x06, 0x15, 0x85, 0x6D, 0x6F, 0x6E, 0x6E, 0x71, 0x00, 0x44, 0x12, 0x04, 0x13,
+    0x15, 0x82, 0x71, 0x6F, 0x00, 0x46, 0x18, 0x0F, 0x10, 0x19, 0x18, 0x08, 0x87, 0x76, 0x75, 0x6D,
+    0x6C, 0x75, 0x77, 0x71, 0x00, 0x46, 0x1B, 0x19, 0x19, 0x0E, 0x0B, 0x0D, 0x87, 0x6B, 0x68, 0x76,
+    0x76, 0x78, 0x7A, 0x71, 0x00, 0x07, 0x07, 0x08, 0x0C, 0x0D, 0x13, 0x1B, 0x1C, 0x9B, 0x86, 0xA7,
+    0x86, 0xB1, 0x86, 0xBA, 0x86, 0xC7, 0x86, 0xD1, 0x86, 0xDC, 0x86, 0x44, 0x0C, 0x0F, 0x0A, 0x08,
+    0x85, 0x6C, 0x67, 0x69, 0x64, 0x72, 0x00, 0x45, 0x0C, 0x1A, 0x0D, 0x10, 0x1B, 0x82, 0x72, 0x65,
+    0x00, 0x44, 0x09, 0x05, 0x0D, 0x0D, 0x82, 0x72, 0x69, 0x00, 0x46, 0x1B, 0x10, 0x19, 0x0F, 0x04,
+    0x0E, 0x84, 0x78, 0x6D, 0x6A, 0x72, 0x00, 0x45, 0x0F, 0x07, 0x1D, 0x10, 0x1B, 0x82, 0x72, 0x70,
+    0x00, 0x46, 0x19, 0x11, 0x1C, 0x08, 0x17, 0x1A, 0x82, 0x72, 0x78, 0x00, 0x45, 0x0B, 0x08, 0x13,
+    0x05, 0x06, 0x82, 0x72, 0x79, 0x00, 0x06, 0x04, 0x07, 0x0D, 0x0E, 0x10, 0x1C, 0xF9, 0x86, 0x04,
+    0x87, 0x10, 0x87, 0x20, 0x87, 0x2C, 0x87, 0x38, 0x87, 0x46, 0x09, 0x16, 0x07, 0x10, 0x09, 0x1B,
+    0x82, 0x73, 0x61, 0x00, 0x46, 0x16, 0x04, 0x0E, 0x04, 0x08, 0x0D, 0x83, 0x64, 0x73, 0x73, 0x00,
+    0x47, 0x0C, 0x1A, 0x12, 0x13, 0x1C, 0x09, 0x07, 0x86, 0x6F, 0x70, 0x77, 0x69, 0x6A, 0x73, 0x00,
+    0x45, 0x1C, 0x09, 0x05, 0x15, 0x17, 0x84, 0x79, 0x66, 0x6B, 0x73, 0x00, 0x45, 0x17, 0x14, 0x13,
+    0x0C, 0x1B, 0x84, 0x74, 0x71, 0x6D, 0x73, 0x00, 0x48, 0x1A, 0x0E, 0x1A, 0x0A, 0x1C, 0x15, 0x0B,
+    0x12, 0x83, 0x79, 0x77, 0x73, 0x00, 0x07, 0x09, 0x0A, 0x0F, 0x10, 0x13, 0x14, 0x1C, 0x5C, 0x87,
+    0x6E, 0x87, 0x7F, 0x87, 0x89, 0x87, 0xA6, 0x87, 0xB1, 0x87, 0xC0, 0x87, 0x48, 0x19, 0x1A, 0x0A,
+    0x04, 0x06, 0x0A, 0x08, 0x0C, 0x87, 0x61, 0x63, 0x67, 0x77, 0x76, 0x66, 0x74, 0x00, 0x48, 0x1D,
+    0x16, 0x12, 0x16, 0x05, 0x0B, 0x1A, 0x1D, 0x86, 0x6F, 0x73, 0x73, 0x7A, 0x67, 0x74, 0x00, 0x45,
+    0x1A, 0x14, 0x13, 0x13, 0x18, 0x82, 0x74, 0x6C, 0x00, 0x02, 0x1C, 0x1D, 0x90, 0x87, 0x98, 0x87,
+    0x43, 0x04, 0x12, 0x08, 0x82, 0x74, 0x6D, 0x00, 0x44, 0x0F, 0x04, 0x10, 0x14, 0x87, 0x6D, 0x71,
+    0x61, 0x6C, 0x7A, 0x6D, 0x74, 0x00, 0x46, 0x04, 0x06, 0x15, 0x09, 0x0A, 0x12, 0x82, 0x74, 0x70,
+    0x00, 0x48, 0x0D, 0x12, 0x05, 0x0B, 0x10, 0x0F, 0x0D, 0x0C, 0x84, 0x6A, 0x6F, 0x71, 0x74, 0x00,
+    0x46, 0x15, 0x1A, 0x13, 0x0A, 0x1C, 0x14, 0x83, 0x79, 0x72, 0x74, 0x00, 0x07, 0x04, 0x06, 0x07,
+    0x0D, 0x17, 0x19, 0x1D, 0xE2, 0x87, 0xEE, 0x87, 0xFD, 0x87, 0x1A, 0x88, 0x2A, 0x88, 0x36, 0x88,
+    0x44, 0x88, 0x46, 0x10, 0x0B, 0x11, 0x05, 0x08, 0x14, 0x83, 0x61, 0x6D, 0x75, 0x00, 0x48, 0x15,
+    0x19, 0x14, 0x13, 0x04, 0x04, 0x1C, 0x16, 0x84, 0x72, 0x76, 0x63, 0x75, 0x00, 0x02, 0x1A, 0x1D,
+    0x04, 0x88, 0x0E, 0x88, 0x44, 0x0D, 0x12, 0x1C, 0x1D, 0x83, 0x64, 0x77, 0x75, 0x00, 0x46, 0x0C,
+    0x1C, 0x05, 0x0D, 0x04, 0x09, 0x83, 0x64, 0x7A, 0x75, 0x00, 0x47, 0x08, 0x07, 0x16, 0x06, 0x16,
+    0x0E, 0x18, 0x86, 0x73, 0x63, 0x64, 0x65, 0x6A, 0x75, 0x00, 0x45, 0x0A, 0x0F, 0x1A, 0x14, 0x11,
+    0x84, 0x67, 0x6C, 0x74, 0x75, 0x00, 0x45, 0x10, 0x19, 0x08, 0x17, 0x15, 0x86, 0x65, 0x74, 0x76,
+    0x6D, 0x76, 0x75, 0x00, 0x46, 0x0E, 0x1A, 0x10, 0x1C, 0x10, 0x15, 0x83, 0x7A, 0x6B, 0x75, 0x00,
+    0x04, 0x09, 0x0F, 0x1A, 0x1C, 0x5D, 0x88, 0x6C, 0x88, 0x96, 0x88, 0xB3, 0x88, 0x46, 0x17, 0x04,
+    0x15, 0x04, 0x1B, 0x07, 0x86, 0x72, 0x61, 0x61, 0x74, 0x66, 0x76, 0x00, 0x02, 0x10, 0x17, 0x73,
+    0x88, 0x87, 0x88, 0x47, 0x0F, 0x08, 0x0B, 0x17, 0x07, 0x0C, 0x05, 0x8A, 0x69, 0x62, 0x64, 0x74,
+    0x68, 0x65, 0x6C, 0x6D, 0x6C, 0x76, 0x00, 0x46, 0x12, 0x19, 0x08, 0x1C, 0x07, 0x15, 0x86, 0x76,
+    0x65, 0x6F, 0x74, 0x6C, 0x76, 0x00, 0x02, 0x0E, 0x14, 0x9D, 0x88, 0xAA, 0x88, 0x46, 0x10, 0x06,
+    0x15, 0x16, 0x09, 0x12, 0x84, 0x6B, 0x6D, 0x77, 0x76, 0x00, 0x43, 0x14, 0x0B, 0x15, 0x83, 0x77,
+    0x71, 0x76, 0x00, 0x47, 0x15, 0x0E, 0x0F, 0x06, 0x1D, 0x0C, 0x06, 0x87, 0x63, 0x7A, 0x6C, 0x6B,
+    0x72, 0x79, 0x76, 0x00, 0x06, 0x04, 0x09, 0x0A, 0x19, 0x1A, 0x1D, 0xD7, 0x88, 0xE6, 0x88, 0xF3,
+    0x88, 0x00, 0x89, 0x0D, 0x89, 0x1E, 0x89, 0x45, 0x0A, 0x07, 0x1C, 0x08, 0x12, 0x87, 0x65, 0x6F,
+    0x79, 0x64, 0x67, 0x61, 0x77, 0x00, 0x48, 0x14, 0x1A, 0x19, 0x06, 0x04, 0x10, 0x12, 0x0F, 0x82,
+    0x77, 0x66, 0x00, 0x44, 0x17, 0x05, 0x15, 0x0D, 0x86, 0x72, 0x6A, 0x62, 0x74, 0x67, 0x77, 0x00,
+    0x45, 0x05, 0x0C, 0x1B, 0x0A, 0x04, 0x85, 0x69, 0x78, 0x62, 0x76, 0x77, 0x00, 0x46, 0x15, 0x0D,
+    0x15, 0x1C, 0x19, 0x07, 0x88, 0x76, 0x64, 0x79, 0x72, 0x6A, 0x72, 0x77, 0x77, 0x00, 0x02, 0x04,
+    0x16, 0x25, 0x89, 0x30, 0x89, 0x43, 0x0D, 0x04, 0x1D, 0x85, 0x6A, 0x61, 0x61, 0x7A, 0x77, 0x00,
+    0x43, 0x1A, 0x09, 0x1C, 0x85, 0x77, 0x66, 0x73, 0x7A, 0x77, 0x00, 0x0A, 0x09, 0x0B, 0x0D, 0x0E,
+    0x12, 0x13, 0x14, 0x16, 0x17, 0x1C, 0x5A, 0x89, 0x78, 0x89, 0x81, 0x89, 0x8C, 0x89, 0x96, 0x89,
+    0xA2, 0x89, 0xAF, 0x89, 0xBB, 0x89, 0xC8, 0x89, 0xD7, 0x89, 0x02, 0x09, 0x16, 0x61, 0x89, 0x6C,
+    0x89, 0x43, 0x09, 0x0D, 0x10, 0x85, 0x66, 0x6A, 0x66, 0x66, 0x78, 0x00, 0x43, 0x0C, 0x17, 0x0C,
+    0x86, 0x74, 0x69, 0x69, 0x73, 0x66, 0x78, 0x00, 0x44, 0x07, 0x0E, 0x0E, 0x19, 0x82, 0x78, 0x68,
+    0x00, 0x44, 0x11, 0x0F, 0x1B, 0x0B, 0x84, 0x6E, 0x6C, 0x6A, 0x78, 0x00, 0x44, 0x15, 0x1A, 0x0F,
+    0x17, 0x83, 0x6B, 0x72, 0x78, 0x00, 0x44, 0x0C, 0x07, 0x1A, 0x11, 0x85, 0x64, 0x77, 0x69, 0x6F,
+    0x78, 0x00, 0x45, 0x0D, 0x19, 0x12, 0x1A, 0x07, 0x85, 0x76, 0x6F, 0x6A, 0x70, 0x78, 0x00, 0x45,
+    0x1D, 0x0E, 0x19, 0x14, 0x0A, 0x84, 0x7A, 0x6B, 0x71, 0x78, 0x00, 0x44, 0x1B, 0x10, 0x17, 0x0F,
+    0x86, 0x74, 0x6C, 0x6D, 0x78, 0x73, 0x78, 0x00, 0x47, 0x19, 0x0B, 0x17, 0x11, 0x11, 0x0B, 0x05,
+    0x85, 0x68, 0x74, 0x76, 0x74, 0x78, 0x00, 0x47, 0x11, 0x09, 0x14, 0x17, 0x1C, 0x04, 0x12, 0x87,
+    0x74, 0x79, 0x71, 0x66, 0x6E, 0x79, 0x78, 0x00, 0x0A, 0x05, 0x09, 0x0C, 0x0F, 0x10, 0x12, 0x14,
+    0x17, 0x1B, 0x1D, 0x07, 0x8A, 0x13, 0x8A, 0x23, 0x8A, 0x2F, 0x8A, 0x53, 0x8A, 0x5E, 0x8A, 0x68,
+    0x8A, 0x8A, 0x8A, 0x98, 0x8A, 0xAD, 0x8A, 0x47, 0x0A, 0x1A, 0x0B, 0x0B, 0x08, 0x08, 0x14, 0x82,
+    0x79, 0x62, 0x00, 0x47, 0x14, 0x13, 0x09, 0x1C, 0x0C, 0x1C, 0x13, 0x86, 0x66, 0x79, 0x70, 0x71,
+    0x66, 0x79, 0x00, 0x45, 0x16, 0x13, 0x08, 0x10, 0x11, 0x84, 0x73, 0x70, 0x69, 0x79, 0x00, 0x02,
+    0x0F, 0x1D, 0x36, 0x8A, 0x44, 0x8A, 0x45, 0x0D, 0x13, 0x18, 0x04, 0x0F, 0x86, 0x70, 0x75, 0x6A,
+    0x6C, 0x6C, 0x79, 0x00, 0x46, 0x07, 0x12, 0x09, 0x17, 0x0C, 0x19, 0x86, 0x6F, 0x66, 0x64, 0x7A,
+    0x6C, 0x79, 0x00, 0x44, 0x12, 0x1C, 0x1B, 0x0D, 0x84, 0x6F, 0x79, 0x6D, 0x79, 0x00, 0x44, 0x11,
+    0x0C, 0x16, 0x06, 0x83, 0x6F, 0x6E, 0x79, 0x00, 0x02, 0x04, 0x10, 0x6F, 0x8A, 0x7C, 0x8A, 0x45,
+    0x13, 0x05, 0x14, 0x1A, 0x11, 0x85, 0x70, 0x62, 0x61, 0x71, 0x79, 0x00, 0x46, 0x11, 0x19, 0x06,
+    0x10, 0x1B, 0x07, 0x85, 0x6E, 0x76, 0x6D, 0x71, 0x79, 0x00, 0x46, 0x07, 0x1D, 0x0B, 0x18, 0x16,
+    0x09, 0x85, 0x7A, 0x68, 0x64, 0x74, 0x79, 0x00, 0x48, 0x1A, 0x1B, 0x16, 0x04, 0x0D, 0x0F, 0x0C,
+    0x12, 0x8A, 0x69, 0x6F, 0x6C, 0x6A, 0x61, 0x73, 0x78, 0x77, 0x78, 0x79, 0x00, 0x48, 0x04, 0x18,
+    0x18, 0x18, 0x13, 0x0E, 0x0B, 0x0D, 0x82, 0x79, 0x7A, 0x00, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x15,
+    0x19, 0x1B, 0xD0, 0x8A, 0xED, 0x8A, 0xFC, 0x8A, 0x11, 0x8B, 0x1E, 0x8B, 0x2B, 0x8B, 0x3A, 0x8B,
+    0x02, 0x0E, 0x17, 0xD7, 0x8A, 0xE3, 0x8A, 0x47, 0x07, 0x0F, 0x10, 0x0C, 0x0F, 0x17, 0x06, 0x82,
+    0x7A, 0x65, 0x00, 0x43, 0x0E, 0x06, 0x10, 0x84, 0x74, 0x6B, 0x65, 0x7A, 0x00, 0x48, 0x0E, 0x12,
+    0x04, 0x18, 0x0B, 0x09, 0x04, 0x0B, 0x84, 0x6B, 0x6F, 0x66, 0x7A, 0x00, 0x48, 0x12, 0x04, 0x0F,
+    0x1C, 0x0A, 0x08, 0x0E, 0x13, 0x8A, 0x6B, 0x70, 0x65, 0x67, 0x79, 0x6C, 0x61, 0x6F, 0x67, 0x7A,
+    0x00, 0x48, 0x07, 0x0E, 0x1A, 0x15, 0x09, 0x09, 0x11, 0x14, 0x82, 0x7A, 0x69, 0x00, 0x46, 0x0E,
+    0x11, 0x0E, 0x08, 0x16, 0x0D, 0x84, 0x6B, 0x6E, 0x72, 0x7A, 0x00, 0x48, 0x0F, 0x0D, 0x16, 0x0D,
+    0x0E, 0x04, 0x08, 0x1D, 0x84, 0x6C, 0x6A, 0x76, 0x7A, 0x00, 0x48, 0x16, 0x12, 0x04, 0x12, 0x0E,
+    0x12, 0x0B, 0x19, 0x83, 0x78, 0x73, 0x7A, 0x00
+};
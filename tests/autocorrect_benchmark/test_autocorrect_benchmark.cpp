@@ -0,0 +1,196 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Feeds a long pseudo-random corpus through process_autocorrect() and checks every correction against a brute force
+// model of the typo buffer. autocorrect_dict.txt is in the flat format, generated with
+// `qmk generate-autocorrect-data --flat`; the default format is covered by the autocorrect tests.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "keycode.h"
+#include "test_common.hpp"
+#include "autocorrect_data.h"
+#include "autocorrect_benchmark_entries.h"
+
+namespace {
+
+struct Correction {
+    size_t      key;
+    uint8_t     backspaces;
+    std::string changes;
+
+    bool operator==(const Correction &other) const {
+        return key == other.key && backspaces == other.backspaces && changes == other.changes;
+    }
+};
+
+std::vector<Correction> corrections;
+size_t                  current_key;
+
+constexpr size_t CORPUS_KEYS = 200000;
+
+uint8_t typo_keycode(char c) {
+    switch (c) {
+        case ':':
+            return KC_SPC;
+        case '\'':
+            return KC_QUOT;
+        default:
+            return KC_A + (c - 'a');
+    }
+}
+
+// Deterministic so that failures are reproducible
+struct Xorshift {
+    uint32_t state = 0x2545F491;
+
+    uint32_t next(uint32_t bound) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state % bound;
+    }
+};
+
+std::vector<uint16_t> make_corpus(void) {
+    static const uint16_t separators[] = {KC_SPC, KC_SPC, KC_SPC, KC_DOT, KC_COMM, KC_1};
+    static const uint16_t others[]     = {KC_BSPC, KC_BSPC, KC_ENTER, KC_LEFT, KC_QUOT};
+
+    Xorshift              rng;
+    std::vector<uint16_t> corpus;
+    while (corpus.size() < CORPUS_KEYS) {
+        uint32_t roll = rng.next(100);
+        if (roll < 70) {
+            // A random word, rarely a typo but often sharing a suffix with one
+            for (uint32_t n = 2 + rng.next(8); n > 0; --n) {
+                corpus.push_back(KC_A + rng.next(26));
+            }
+            corpus.push_back(separators[rng.next(sizeof(separators) / sizeof(separators[0]))]);
+        } else if (roll < 95) {
+            // A dictionary typo, sometimes glued onto the end of a random word
+            const char *typo = autocorrect_benchmark_entries[rng.next(sizeof(autocorrect_benchmark_entries) / sizeof(autocorrect_benchmark_entries[0]))].typo;
+            if (typo[0] != ':' && rng.next(2)) {
+                corpus.push_back(KC_A + rng.next(26));
+            }
+            for (const char *c = typo; *c; ++c) {
+                corpus.push_back(typo_keycode(*c));
+            }
+        } else {
+            corpus.push_back(others[rng.next(sizeof(others) / sizeof(others[0]))]);
+        }
+    }
+    return corpus;
+}
+
+// Mirrors the typo buffer of process_autocorrect(), then looks every suffix of it up in the dictionary
+std::vector<Correction> reference_corrections(const std::vector<uint16_t> &corpus) {
+    std::unordered_map<std::string, size_t> typos;
+    for (size_t i = 0; i < sizeof(autocorrect_benchmark_entries) / sizeof(autocorrect_benchmark_entries[0]); ++i) {
+        std::string keys;
+        for (const char *c = autocorrect_benchmark_entries[i].typo; *c; ++c) {
+            keys.push_back(typo_keycode(*c));
+        }
+        typos[keys] = i;
+    }
+
+    std::vector<Correction> expected;
+    std::string             buffer;
+    for (size_t key = 0; key < corpus.size(); ++key) {
+        uint16_t keycode = corpus[key];
+        switch (keycode) {
+            case KC_A ... KC_Z:
+            case KC_QUOT:
+                break;
+            case KC_SPC:
+            case KC_DOT:
+            case KC_COMM:
+            case KC_1:
+                keycode = KC_SPC;
+                break;
+            case KC_ENTER:
+                buffer.clear();
+                keycode = KC_SPC;
+                break;
+            case KC_BSPC:
+                if (!buffer.empty()) {
+                    buffer.pop_back();
+                }
+                continue;
+            default:
+                buffer.clear();
+                continue;
+        }
+
+        if (buffer.size() >= AUTOCORRECT_MAX_LENGTH) {
+            buffer.erase(0, buffer.size() - AUTOCORRECT_MAX_LENGTH + 1);
+        }
+        buffer.push_back(keycode);
+        if (buffer.size() < AUTOCORRECT_MIN_LENGTH) {
+            continue;
+        }
+
+        for (size_t length = AUTOCORRECT_MIN_LENGTH; length <= buffer.size(); ++length) {
+            auto match = typos.find(buffer.substr(buffer.size() - length));
+            if (match == typos.end()) {
+                continue;
+            }
+
+            // Same edit as the generator: keep the common prefix, retype the rest
+            std::string typo       = autocorrect_benchmark_entries[match->second].typo;
+            std::string correction = autocorrect_benchmark_entries[match->second].correction;
+            bool        boundary   = typo.back() == ':';
+            typo.erase(0, typo.find_first_not_of(':'));
+            typo.erase(typo.find_last_not_of(':') + 1);
+            size_t common = 0;
+            while (common < typo.size() && common < correction.size() && typo[common] == correction[common]) {
+                ++common;
+            }
+            expected.push_back({key, (uint8_t)(typo.size() - common - 1 + boundary), correction.substr(common)});
+
+            buffer = keycode == KC_SPC ? std::string(1, KC_SPC) : std::string();
+            break;
+        }
+    }
+    return expected;
+}
+
+} // namespace
+
+extern "C" bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    corrections.push_back({current_key, backspaces, str});
+    return false;
+}
+
+class AutoCorrectBenchmark : public TestFixture {
+   public:
+    void SetUp() override {
+        // Start from an empty typo buffer
+        autocorrect_disable();
+        autocorrect_enable();
+        corrections.clear();
+    }
+};
+
+TEST_F(AutoCorrectBenchmark, MatchesReferenceModel) {
+    std::vector<uint16_t> corpus = make_corpus();
+    keyrecord_t           record = {};
+    record.event.pressed         = true;
+
+    auto start = std::chrono::steady_clock::now();
+    for (current_key = 0; current_key < corpus.size(); ++current_key) {
+        process_autocorrect(corpus[current_key], &record);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<Correction> expected = reference_corrections(corpus);
+    EXPECT_GT(expected.size(), CORPUS_KEYS / 100);
+    ASSERT_EQ(corrections.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(corrections[i], expected[i]) << "correction " << i << " at key " << expected[i].key;
+    }
+
+    printf("[ %-8s ] flat trie, %zu bytes: %zu keys, %zu corrections, %.1f ns/key\n", "BENCH", (size_t)DICTIONARY_SIZE, corpus.size(), corrections.size(), (double)elapsed / corpus.size());
+}
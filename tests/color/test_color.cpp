@@ -0,0 +1,46 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "color.h"
+}
+
+class Color : public TestFixture {
+   protected:
+    static HSV hsv_at(uint32_t n) {
+        return HSV{(uint8_t)(n >> 16), (uint8_t)(n >> 8), (uint8_t)n};
+    }
+};
+
+TEST_F(Color, BatchMatchesScalarForEveryInput) {
+    const uint8_t batch_size = 255;
+    HSV           hsv[batch_size];
+    RGB           rgb[batch_size];
+
+    uint32_t mismatches = 0;
+    for (uint32_t n = 0; n < (1UL << 24); n += batch_size) {
+        uint8_t count = (1UL << 24) - n < batch_size ? (1UL << 24) - n : batch_size;
+        for (uint8_t i = 0; i < count; i++) {
+            hsv[i] = hsv_at(n + i);
+        }
+        hsv_to_rgb_batch(hsv, rgb, count);
+        for (uint8_t i = 0; i < count; i++) {
+            RGB expected = hsv_to_rgb(hsv[i]);
+            if (rgb[i].r != expected.r || rgb[i].g != expected.g || rgb[i].b != expected.b) {
+                if (mismatches++ < 10) {
+                    ADD_FAILURE() << "h=" << +hsv[i].h << " s=" << +hsv[i].s << " v=" << +hsv[i].v;
+                }
+            }
+        }
+    }
+    EXPECT_EQ(mismatches, 0);
+}
+
+TEST_F(Color, BatchOfZeroIsNoop) {
+    RGB rgb = {};
+    rgb.r   = 1;
+    hsv_to_rgb_batch(nullptr, &rgb, 0);
+    EXPECT_EQ(rgb.r, 1);
+}
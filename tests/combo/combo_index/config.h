@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TAPPING_TERM 200
+#define COMBO_INDEX_SIZE 32
+#define COMBO_MUST_PRESS_IN_ORDER_PER_COMBO
+#define COMBO_ONLY_FROM_LAYER 0
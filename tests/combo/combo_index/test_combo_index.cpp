@@ -0,0 +1,141 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class ComboIndex : public TestFixture {
+   protected:
+    KeymapKey key_a{0, 0, 0, KC_A};
+    KeymapKey key_b{0, 1, 0, KC_B};
+    KeymapKey key_c{0, 2, 0, KC_C};
+    KeymapKey key_d{0, 3, 0, KC_D};
+    KeymapKey key_e{0, 4, 0, KC_E};
+    KeymapKey key_f{0, 5, 0, KC_F};
+    KeymapKey key_g{0, 6, 0, KC_G};
+    KeymapKey key_h{0, 7, 0, KC_H};
+
+    void SetUp() override {
+        set_keymap({key_a, key_b, key_c, key_d, key_e, key_f, key_g, key_h});
+    }
+};
+
+TEST_F(ComboIndex, two_key_combo_fires) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, overlapping_combo_sharing_a_key_fires) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_2));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_b, key_c});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, longest_overlapping_combo_wins) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b, key_c});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, longest_overlapping_combo_wins_in_any_order) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_c, key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, keys_outside_any_combo_pass_through) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_H));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_h);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, incomplete_combo_times_out_to_plain_keys) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.press();
+    run_one_scan_loop();
+    idle_for(COMBO_TERM + 1);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, must_press_in_order_combo_fires_in_order) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_4));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_d, key_e});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, must_press_in_order_combo_ignores_wrong_order) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_REPORT(driver, (KC_E, KC_D));
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_e, key_d});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, combo_without_order_constraint_fires_in_any_order) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_6));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_e});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, repeated_key_resolves_to_last_position) {
+    TestDriver driver;
+    InSequence s;
+
+    /* The first position of a repeated key can never be satisfied, same as the linear search. */
+    EXPECT_REPORT(driver, (KC_F));
+    EXPECT_REPORT(driver, (KC_F, KC_G));
+    EXPECT_REPORT(driver, (KC_G));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_f, key_g});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndex, combo_keys_are_read_from_combo_only_from_layer) {
+    TestDriver driver;
+    KeymapKey  layer_a{1, 0, 0, KC_X};
+    KeymapKey  layer_b{1, 1, 0, KC_Y};
+    add_key(layer_a);
+    add_key(layer_b);
+    layer_on(1);
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({layer_a, layer_b});
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define TAPPING_TERM 200
+// Holds the keys of the first two combos only, the index runs out of room while adding the third
+#define COMBO_INDEX_SIZE 4
@@ -0,0 +1,59 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+// The partly built index must not be used: combos it never got to would silently stop firing
+class ComboIndexOverflow : public TestFixture {
+   protected:
+    KeymapKey key_a{0, 0, 0, KC_A};
+    KeymapKey key_b{0, 1, 0, KC_B};
+    KeymapKey key_c{0, 2, 0, KC_C};
+    KeymapKey key_e{0, 4, 0, KC_E};
+    KeymapKey key_h{0, 7, 0, KC_H};
+
+    void SetUp() override {
+        set_keymap({key_a, key_b, key_c, key_e, key_h});
+    }
+};
+
+TEST_F(ComboIndexOverflow, combo_in_the_index_fires) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndexOverflow, combo_that_did_not_fit_fires) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_6));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_e});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndexOverflow, longest_combo_wins_although_it_did_not_fit) {
+    TestDriver driver;
+
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_a, key_b, key_c});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboIndexOverflow, keys_outside_any_combo_pass_through) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_H));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_h);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,20 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+enum combos { ab_combo_idx, bc_combo_idx, abc_combo_idx, ae_combo_idx };
+
+uint16_t const ab_combo[]  = {KC_A, KC_B, COMBO_END};
+uint16_t const bc_combo[]  = {KC_B, KC_C, COMBO_END};
+uint16_t const abc_combo[] = {KC_A, KC_B, KC_C, COMBO_END};
+uint16_t const ae_combo[]  = {KC_E, KC_A, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [ab_combo_idx]  = COMBO(ab_combo, KC_1),
+    [bc_combo_idx]  = COMBO(bc_combo, KC_2),
+    [abc_combo_idx] = COMBO(abc_combo, KC_3),
+    [ae_combo_idx]  = COMBO(ae_combo, KC_6),
+};
+// clang-format on
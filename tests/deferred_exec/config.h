@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define MAX_DEFERRED_EXECUTORS 16
+#define KEYBOARD_IDLE_ENABLE
+#define KEYBOARD_IDLE_TIMEOUT 100
+#define KEYBOARD_IDLE_ACTIVITY_PERIOD 0
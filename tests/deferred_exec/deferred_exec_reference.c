@@ -0,0 +1,112 @@
+// Copyright 2021 Nick Brassel (@tzarc)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The previous linear scan deferred executor, kept as a baseline for the benchmark.
+
+#include <stddef.h>
+#include <timer.h>
+#include "deferred_exec_reference.h"
+
+static inline void reference_clear(reference_executor_t *entry) {
+    entry->token        = INVALID_DEFERRED_TOKEN;
+    entry->trigger_time = 0;
+    entry->callback     = NULL;
+    entry->cb_arg       = NULL;
+}
+
+static deferred_token current_token = 0;
+
+static inline bool token_can_be_used(reference_executor_t *table, size_t table_count, deferred_token token) {
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+    for (int i = 0; i < table_count; ++i) {
+        if (table[i].token == token) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static inline deferred_token allocate_token(reference_executor_t *table, size_t table_count) {
+    deferred_token first = ++current_token;
+    while (!token_can_be_used(table, table_count, current_token)) {
+        ++current_token;
+        if (current_token == first) {
+            return INVALID_DEFERRED_TOKEN;
+        }
+    }
+    return current_token;
+}
+
+deferred_token reference_defer_exec(reference_executor_t *table, size_t table_count, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
+    if (!table || table_count == 0 || delay_ms == 0 || !callback) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+    for (int i = 0; i < table_count; ++i) {
+        reference_executor_t *entry = &table[i];
+        if (entry->token == INVALID_DEFERRED_TOKEN) {
+            deferred_token token = allocate_token(table, table_count);
+            if (token == INVALID_DEFERRED_TOKEN) {
+                return INVALID_DEFERRED_TOKEN;
+            }
+            entry->token        = token;
+            entry->trigger_time = timer_read32() + delay_ms;
+            entry->callback     = callback;
+            entry->cb_arg       = cb_arg;
+            return token;
+        }
+    }
+    return INVALID_DEFERRED_TOKEN;
+}
+
+bool reference_extend_deferred_exec(reference_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
+    if (!table || table_count == 0 || delay_ms == 0 || token == INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+    for (int i = 0; i < table_count; ++i) {
+        if (table[i].token == token) {
+            table[i].trigger_time = timer_read32() + delay_ms;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool reference_cancel_deferred_exec(reference_executor_t *table, size_t table_count, deferred_token token) {
+    if (!table || table_count == 0 || token == INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+    for (int i = 0; i < table_count; ++i) {
+        if (table[i].token == token) {
+            reference_clear(&table[i]);
+            return true;
+        }
+    }
+    return false;
+}
+
+void reference_deferred_exec_task(reference_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
+    uint32_t now = timer_read32();
+
+    if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
+        *last_execution_time = now;
+
+        for (int i = 0; i < table_count; ++i) {
+            reference_executor_t *entry      = &table[i];
+            deferred_token        curr_token = entry->token;
+
+            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
+                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+                if (entry->token != curr_token) {
+                    continue;
+                }
+                if (delay_ms > 0) {
+                    entry->trigger_time += delay_ms;
+                } else {
+                    reference_clear(entry);
+                }
+            }
+        }
+    }
+}
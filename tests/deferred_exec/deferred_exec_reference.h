@@ -0,0 +1,18 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "deferred_exec.h"
+
+typedef struct reference_executor_t {
+    deferred_token         token;
+    uint32_t               trigger_time;
+    deferred_exec_callback callback;
+    void *                 cb_arg;
+} reference_executor_t;
+
+deferred_token reference_defer_exec(reference_executor_t *table, size_t table_count, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg);
+bool           reference_extend_deferred_exec(reference_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms);
+bool           reference_cancel_deferred_exec(reference_executor_t *table, size_t table_count, deferred_token token);
+void           reference_deferred_exec_task(reference_executor_t *table, size_t table_count, uint32_t *last_execution_time);
@@ -0,0 +1,359 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <set>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "deferred_exec_reference.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+struct call_t {
+    uintptr_t id;
+    uint32_t  trigger_time;
+    uint32_t  now;
+};
+
+static std::vector<call_t> calls;
+static uint32_t            repeat_delay = 0;
+static uint32_t            resume_time  = 0;
+
+static uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    calls.push_back({(uintptr_t)cb_arg, trigger_time, timer_read32()});
+    return repeat_delay;
+}
+
+static uint32_t noop_callback(uint32_t trigger_time, void *cb_arg) {
+    return 0;
+}
+
+// Key presses would wake the main loop, so it may sleep past the scan interval
+extern "C" bool matrix_idle_wake_arm(void) {
+    return true;
+}
+
+class DeferredExec : public TestFixture {
+   protected:
+    void SetUp() override {
+        // The executor throttle remembers the last task time, so simulated time has to keep going forward across tests
+        set_time(resume_time);
+        calls.clear();
+        repeat_delay = 0;
+    }
+
+    void TearDown() override {
+        for (deferred_token token : tokens) {
+            cancel_deferred_exec(token);
+        }
+        resume_time = timer_read32() + 1;
+    }
+
+    deferred_token defer(uint32_t delay_ms, uintptr_t id) {
+        deferred_token token = defer_exec(delay_ms, record_callback, (void *)id);
+        tokens.push_back(token);
+        return token;
+    }
+
+    /* Runs the deferred executor task once per simulated millisecond. */
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_task();
+        }
+    }
+
+    std::vector<deferred_token> tokens;
+};
+
+TEST_F(DeferredExec, RunsInDeadlineOrderOnTime) {
+    uint32_t start = timer_read32();
+    defer(30, 3);
+    defer(10, 1);
+    defer(20, 2);
+    defer(10, 4);
+
+    uint32_t trigger_time;
+    ASSERT_TRUE(deferred_exec_next_deadline(&trigger_time));
+    EXPECT_EQ(trigger_time, start + 10);
+
+    run_for(40);
+    ASSERT_EQ(calls.size(), 4);
+    std::set<uintptr_t> first_two = {calls[0].id, calls[1].id};
+    EXPECT_EQ(first_two, std::set<uintptr_t>({1, 4}));
+    EXPECT_EQ(calls[2].id, 2);
+    EXPECT_EQ(calls[3].id, 3);
+    for (const call_t &call : calls) {
+        EXPECT_EQ(call.now, call.trigger_time);
+    }
+    EXPECT_FALSE(deferred_exec_next_deadline(&trigger_time));
+}
+
+TEST_F(DeferredExec, CancelAndExtend) {
+    uint32_t       start = timer_read32();
+    deferred_token a     = defer(10, 1);
+    deferred_token b     = defer(20, 2);
+    deferred_token c     = defer(30, 3);
+
+    EXPECT_TRUE(cancel_deferred_exec(a));
+    EXPECT_FALSE(cancel_deferred_exec(a));
+    EXPECT_TRUE(extend_deferred_exec(b, 50));
+    EXPECT_FALSE(extend_deferred_exec(a, 50));
+
+    uint32_t trigger_time;
+    ASSERT_TRUE(deferred_exec_next_deadline(&trigger_time));
+    EXPECT_EQ(trigger_time, start + 30);
+
+    run_for(60);
+    ASSERT_EQ(calls.size(), 2);
+    EXPECT_EQ(calls[0].id, 3);
+    EXPECT_EQ(calls[1].id, 2);
+    EXPECT_EQ(calls[1].now, start + 50);
+    EXPECT_FALSE(cancel_deferred_exec(c));
+}
+
+TEST_F(DeferredExec, StaleTokenDoesNotCancelReusedSlot) {
+    std::set<deferred_token> seen;
+    for (uint8_t i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        seen.insert(defer(100, i));
+    }
+    EXPECT_EQ(seen.size(), MAX_DEFERRED_EXECUTORS);
+    EXPECT_EQ(seen.count(INVALID_DEFERRED_TOKEN), 0);
+    EXPECT_EQ(defer_exec(100, record_callback, NULL), INVALID_DEFERRED_TOKEN);
+
+    // Freeing one slot makes room, but the new token is different
+    deferred_token stale = tokens[5];
+    EXPECT_TRUE(cancel_deferred_exec(stale));
+    deferred_token fresh = defer(100, 99);
+    EXPECT_NE(fresh, INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(seen.count(fresh), 0);
+    EXPECT_FALSE(cancel_deferred_exec(stale));
+    EXPECT_TRUE(cancel_deferred_exec(fresh));
+}
+
+TEST_F(DeferredExec, StaleTokenDoesNotTouchReusedSlotOfLargeTable) {
+    const uint8_t count = 255;
+
+    std::vector<deferred_executor_t> executors(count);
+    std::vector<uint8_t>             heap(count);
+    deferred_executor_table_t        table = {};
+    table.executors                        = executors.data();
+    table.heap                             = heap.data();
+    table.count                            = count;
+    table.last_execution_time              = timer_read32();
+
+    std::vector<deferred_token> live(count);
+    for (uint8_t i = 0; i < count; i++) {
+        live[i] = defer_exec_advanced(&table, 100, noop_callback, NULL);
+        ASSERT_NE(live[i], INVALID_DEFERRED_TOKEN);
+    }
+
+    // The freed slot is the only one left, so every new executor lands in it
+    deferred_token stale = live[count - 1];
+    ASSERT_TRUE(cancel_deferred_exec_advanced(&table, stale));
+    std::set<deferred_token> seen = {stale};
+    for (int reuse = 0; reuse < 255; reuse++) {
+        deferred_token fresh = defer_exec_advanced(&table, 100, noop_callback, NULL);
+        ASSERT_NE(fresh, INVALID_DEFERRED_TOKEN);
+        ASSERT_EQ(seen.count(fresh), 0) << "reuse " << reuse;
+        seen.insert(fresh);
+
+        EXPECT_FALSE(extend_deferred_exec_advanced(&table, stale, 200));
+        EXPECT_FALSE(cancel_deferred_exec_advanced(&table, stale));
+        ASSERT_TRUE(cancel_deferred_exec_advanced(&table, fresh));
+        stale = fresh;
+    }
+
+    // The other executors were not disturbed
+    for (uint8_t i = 0; i < count - 1; i++) {
+        EXPECT_TRUE(extend_deferred_exec_advanced(&table, live[i], 100));
+    }
+}
+
+TEST_F(DeferredExec, LateRepeatingCallbackRunsOncePerTask) {
+    repeat_delay = 1;
+    defer(1, 1);
+    advance_time(50);
+    defer(1, 2);
+    advance_time(1);
+
+    deferred_exec_task();
+    ASSERT_EQ(calls.size(), 2);
+    EXPECT_EQ(calls[0].id, 1);
+    EXPECT_EQ(calls[1].id, 2);
+
+    // Both repeat, the late one catches up one millisecond per task
+    calls.clear();
+    advance_time(1);
+    deferred_exec_task();
+    ASSERT_EQ(calls.size(), 2);
+    EXPECT_EQ(calls[0].id, 1);
+    EXPECT_EQ(calls[0].trigger_time + 50, calls[1].trigger_time);
+}
+
+TEST_F(DeferredExec, MainLoopSleepsUntilNextDeadline) {
+    TestDriver driver;
+    uint32_t   start = timer_read32();
+    defer(250, 1);
+
+    uint32_t invocations = 0;
+    while (calls.empty() && TIMER_DIFF_32(timer_read32(), start) < 1000) {
+        keyboard_task();
+        deferred_exec_task();
+        housekeeping_task();
+        keyboard_idle_task();
+        invocations++;
+    }
+    ASSERT_EQ(calls.size(), 1);
+    EXPECT_EQ(calls[0].now, start + 250);
+    // The first iteration, one wake up per KEYBOARD_IDLE_TIMEOUT and the one that lands on the deadline
+    EXPECT_LE(invocations, 250 / KEYBOARD_IDLE_TIMEOUT + 3);
+}
+
+static std::multiset<std::pair<uintptr_t, uint32_t>> random_calls;
+// Live callbacks by id, with their token in the heap and the linear scan table
+static std::vector<std::pair<deferred_token, deferred_token>> random_live(64);
+
+static uint32_t random_callback(uint32_t trigger_time, void *cb_arg) {
+    uintptr_t id = (uintptr_t)cb_arg;
+    random_calls.insert({id, trigger_time});
+    // Some of them repeat, with a period derived from their id
+    uint32_t delay_ms = (id % 3) ? id % 7 : 0;
+    if (delay_ms == 0) {
+        random_live[id] = {INVALID_DEFERRED_TOKEN, INVALID_DEFERRED_TOKEN};
+    }
+    return delay_ms;
+}
+
+TEST_F(DeferredExec, RandomOperationsMatchLinearScan) {
+    const uint8_t count = 32;
+
+    std::vector<deferred_executor_t> executors(count);
+    std::vector<uint8_t>             heap(count);
+    deferred_executor_table_t        table = {};
+    table.executors                        = executors.data();
+    table.heap                             = heap.data();
+    table.count                            = count;
+    table.last_execution_time              = timer_read32();
+
+    std::vector<reference_executor_t> reference(count);
+    uint32_t                          reference_last_execution = table.last_execution_time;
+
+    auto &live = random_live;
+    std::fill(live.begin(), live.end(), std::make_pair(INVALID_DEFERRED_TOKEN, INVALID_DEFERRED_TOKEN));
+
+    std::mt19937                       rng(1);
+    std::uniform_int_distribution<int> action(0, 99);
+    std::uniform_int_distribution<int> id(0, live.size() - 1);
+    std::uniform_int_distribution<int> delay(1, 40);
+
+    for (int step = 0; step < 20000; step++) {
+        int       a = action(rng);
+        uintptr_t i = id(rng);
+        if (a < 30) {
+            if (live[i].first == INVALID_DEFERRED_TOKEN) {
+                uint32_t d     = delay(rng);
+                live[i].first  = defer_exec_advanced(&table, d, random_callback, (void *)i);
+                live[i].second = reference_defer_exec(reference.data(), count, d, random_callback, (void *)i);
+                ASSERT_EQ(live[i].first == INVALID_DEFERRED_TOKEN, live[i].second == INVALID_DEFERRED_TOKEN) << "step " << step;
+            }
+        } else if (a < 35) {
+            uint32_t d                  = delay(rng);
+            bool     extended           = extend_deferred_exec_advanced(&table, live[i].first, d);
+            bool     reference_extended = reference_extend_deferred_exec(reference.data(), count, live[i].second, d);
+            ASSERT_EQ(extended, reference_extended) << "step " << step;
+        } else if (a < 45) {
+            bool cancelled           = cancel_deferred_exec_advanced(&table, live[i].first);
+            bool reference_cancelled = reference_cancel_deferred_exec(reference.data(), count, live[i].second);
+            ASSERT_EQ(cancelled, reference_cancelled) << "step " << step;
+            live[i] = {INVALID_DEFERRED_TOKEN, INVALID_DEFERRED_TOKEN};
+        } else {
+            advance_time(1);
+            deferred_exec_advanced_task(&table);
+            auto calls = random_calls;
+            random_calls.clear();
+            reference_deferred_exec_task(reference.data(), count, &reference_last_execution);
+            ASSERT_EQ(calls, random_calls) << "step " << step;
+            random_calls.clear();
+        }
+    }
+}
+
+/* Compares the per-loop cost of the task while nothing is due, and the cost of rescheduling a callback, against the
+ * previous linear scan implementation. */
+static void benchmark(uint8_t pending) {
+    const int task_loops  = 20000;
+    const int churn_loops = 2000;
+
+    std::vector<deferred_executor_t> executors(pending);
+    std::vector<uint8_t>             heap(pending);
+    deferred_executor_table_t        table = {};
+    table.executors                        = executors.data();
+    table.heap                             = heap.data();
+    table.count                            = pending;
+
+    std::vector<reference_executor_t> reference(pending);
+    uint32_t                          reference_last_execution = timer_read32();
+    table.last_execution_time                                  = reference_last_execution;
+
+    std::vector<deferred_token> tokens(pending);
+    std::vector<deferred_token> reference_tokens(pending);
+    for (uint8_t i = 0; i < pending; i++) {
+        tokens[i]           = defer_exec_advanced(&table, 60000 + i, noop_callback, NULL);
+        reference_tokens[i] = reference_defer_exec(reference.data(), pending, 60000 + i, noop_callback, NULL);
+    }
+
+    using std::chrono::nanoseconds;
+    using std::chrono::steady_clock;
+
+    auto start = steady_clock::now();
+    for (int i = 0; i < task_loops; i++) {
+        advance_time(1);
+        deferred_exec_advanced_task(&table);
+    }
+    auto task_time = steady_clock::now() - start;
+
+    start = steady_clock::now();
+    for (int i = 0; i < task_loops; i++) {
+        advance_time(1);
+        reference_deferred_exec_task(reference.data(), pending, &reference_last_execution);
+    }
+    auto reference_task_time = steady_clock::now() - start;
+
+    // Cancel one of the pending callbacks and schedule it again, the way a key timeout gets restarted
+    start = steady_clock::now();
+    for (int i = 0; i < churn_loops; i++) {
+        deferred_token &token = tokens[i % pending];
+        cancel_deferred_exec_advanced(&table, token);
+        token = defer_exec_advanced(&table, 60000 + i, noop_callback, NULL);
+    }
+    auto churn_time = steady_clock::now() - start;
+
+    start = steady_clock::now();
+    for (int i = 0; i < churn_loops; i++) {
+        deferred_token &token = reference_tokens[i % pending];
+        reference_cancel_deferred_exec(reference.data(), pending, token);
+        token = reference_defer_exec(reference.data(), pending, 60000 + i, noop_callback, NULL);
+    }
+    auto reference_churn_time = steady_clock::now() - start;
+
+    EXPECT_EQ(table.pending, pending);
+    EXPECT_EQ(std::set<deferred_token>(tokens.begin(), tokens.end()).count(INVALID_DEFERRED_TOKEN), 0);
+    EXPECT_EQ(std::set<deferred_token>(reference_tokens.begin(), reference_tokens.end()).count(INVALID_DEFERRED_TOKEN), 0);
+
+    printf("%3d pending: task %lld ns/loop (linear scan %lld ns/loop), cancel+defer %lld ns (linear scan %lld ns)\n", pending, (long long)std::chrono::duration_cast<nanoseconds>(task_time).count() / task_loops, (long long)std::chrono::duration_cast<nanoseconds>(reference_task_time).count() / task_loops, (long long)std::chrono::duration_cast<nanoseconds>(churn_time).count() / churn_loops, (long long)std::chrono::duration_cast<nanoseconds>(reference_churn_time).count() / churn_loops);
+}
+
+TEST_F(DeferredExec, Benchmark) {
+    benchmark(8);
+    benchmark(64);
+    // Heap positions are eight bits wide, which caps a table at 255 executors
+    benchmark(255);
+}
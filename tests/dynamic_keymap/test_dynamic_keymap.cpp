@@ -0,0 +1,141 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom.h"
+#include "eeconfig.h"
+#include "keymap_introspection.h"
+}
+
+class DynamicKeymap : public TestFixture {
+   protected:
+    DynamicKeymap() {
+        dynamic_keymap_flush();
+    }
+
+    static uint16_t eeprom_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+        const uint8_t *address = (const uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+        return (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+    }
+};
+
+TEST_F(DynamicKeymap, WritesAreServedFromRamBeforeWriteBack) {
+    TestDriver driver;
+    uint16_t   stored = eeprom_keycode(1, 2, 3);
+
+    dynamic_keymap_set_keycode(1, 2, 3, KC_Q);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), KC_Q);
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), stored);
+    EXPECT_TRUE(dynamic_keymap_writeback_pending());
+
+    idle_for(DYNAMIC_KEYMAP_WRITEBACK_DELAY - 1);
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), stored);
+
+    idle_for(2);
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), KC_Q);
+    EXPECT_FALSE(dynamic_keymap_writeback_pending());
+}
+
+TEST_F(DynamicKeymap, BurstOfWritesIsCoalesced) {
+    TestDriver driver;
+    dynamic_keymap_set_keycode(0, 0, 0, KC_A);
+    dynamic_keymap_set_keycode(3, 3, 9, KC_B);
+    dynamic_keymap_flush();
+
+    dynamic_keymap_set_keycode(0, 0, 0, KC_C);
+    idle_for(DYNAMIC_KEYMAP_WRITEBACK_DELAY / 2);
+    dynamic_keymap_set_keycode(3, 3, 9, KC_D);
+    idle_for(DYNAMIC_KEYMAP_WRITEBACK_DELAY / 2 + 1);
+
+    /* The second write restarted the delay, so nothing has been written yet. */
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), KC_A);
+    EXPECT_EQ(eeprom_keycode(3, 3, 9), KC_B);
+
+    idle_for(DYNAMIC_KEYMAP_WRITEBACK_DELAY);
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), KC_C);
+    EXPECT_EQ(eeprom_keycode(3, 3, 9), KC_D);
+    EXPECT_FALSE(dynamic_keymap_writeback_pending());
+}
+
+TEST_F(DynamicKeymap, UnchangedWriteIsNotPending) {
+    TestDriver driver;
+    dynamic_keymap_set_keycode(2, 1, 4, KC_E);
+    dynamic_keymap_flush();
+
+    dynamic_keymap_set_keycode(2, 1, 4, KC_E);
+    EXPECT_FALSE(dynamic_keymap_writeback_pending());
+}
+
+TEST_F(DynamicKeymap, BufferAccessUsesTheMirror) {
+    TestDriver driver;
+    const uint16_t size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+
+    /* Straddles the end of the keymap, the bytes past it are ignored on write and read back as zero. */
+    uint8_t data[6] = {0x00, KC_F, 0x00, KC_G, 0xAA, 0xBB};
+    dynamic_keymap_set_buffer(size - 4, sizeof(data), data);
+    EXPECT_EQ(dynamic_keymap_get_keycode(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 2), KC_F);
+    EXPECT_EQ(dynamic_keymap_get_keycode(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1), KC_G);
+
+    uint8_t readback[6];
+    dynamic_keymap_get_buffer(size - 4, sizeof(readback), readback);
+    EXPECT_EQ(0, memcmp(readback, data, 4));
+    EXPECT_EQ(readback[4], 0);
+    EXPECT_EQ(readback[5], 0);
+
+    idle_for(DYNAMIC_KEYMAP_WRITEBACK_DELAY + 1);
+    EXPECT_EQ(eeprom_keycode(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 2), KC_F);
+    EXPECT_EQ(eeprom_keycode(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1), KC_G);
+}
+
+TEST_F(DynamicKeymap, InitLoadsFromEeprom) {
+    TestDriver driver;
+    uint8_t   *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(1, 0, 5);
+    eeprom_update_byte(address, KC_H >> 8);
+    eeprom_update_byte(address + 1, KC_H & 0xFF);
+    EXPECT_NE(dynamic_keymap_get_keycode(1, 0, 5), KC_H);
+
+    dynamic_keymap_init();
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 0, 5), KC_H);
+}
+
+TEST_F(DynamicKeymap, ResetWritesThrough) {
+    TestDriver driver;
+    dynamic_keymap_set_keycode(0, 1, 1, KC_J);
+    dynamic_keymap_flush();
+
+    dynamic_keymap_reset();
+    EXPECT_FALSE(dynamic_keymap_writeback_pending());
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 1), keycode_at_keymap_location_raw(0, 1, 1));
+    EXPECT_EQ(eeprom_keycode(0, 1, 1), keycode_at_keymap_location_raw(0, 1, 1));
+}
+
+TEST_F(DynamicKeymap, ResetAfterClearingEepromIsKept) {
+    TestDriver driver;
+    // Layers past the ones in keymap.c default to KC_TRNS, which is not what an erased EEPROM reads back as
+    uint16_t keycode = keycode_at_keymap_location_raw(1, 2, 3);
+    ASSERT_NE(keycode, KC_NO);
+    dynamic_keymap_reset();
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), keycode);
+
+    eeconfig_init();
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), KC_NO);
+    dynamic_keymap_reset();
+
+    // The keymap after a reboot is whatever made it to EEPROM
+    dynamic_keymap_init();
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), keycode);
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), keycode);
+}
+
+TEST_F(DynamicKeymap, DisablingEepromDropsTheMirror) {
+    TestDriver driver;
+    dynamic_keymap_set_keycode(1, 2, 3, KC_K);
+
+    eeconfig_disable();
+    EXPECT_FALSE(dynamic_keymap_writeback_pending());
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), eeprom_keycode(1, 2, 3));
+    eeconfig_init();
+}
@@ -0,0 +1,220 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using ::testing::InSequence;
+using ::testing::Truly;
+
+#define SHIFTED_A_MACRO SAFE_RANGE
+#define TAP_A_MACRO (SAFE_RANGE + 1)
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed) {
+        return true;
+    }
+    switch (keycode) {
+        case SHIFTED_A_MACRO:
+            register_code(KC_LSFT);
+            register_code(KC_A);
+            unregister_code(KC_A);
+            unregister_code(KC_LSFT);
+            return false;
+        case TAP_A_MACRO:
+            register_code(KC_A);
+            unregister_code(KC_A);
+            return false;
+    }
+    return true;
+}
+
+class HostCoalesce : public TestFixture {
+   public:
+    void SetUp() override {
+        // Start well past the polling interval of whatever the previous test sent
+        TestDriver driver;
+        idle_for(10);
+        host_reset_report_counters();
+    }
+
+    host_report_counters_t counters(uint8_t type) {
+        host_report_counters_t counters;
+        host_get_report_counters(type, &counters);
+        return counters;
+    }
+};
+
+TEST_F(HostCoalesce, ReportsInSeparateIntervalsAreSentAsIs) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.press();
+    run_one_scan_loop();
+    key_b.press();
+    run_one_scan_loop();
+    key_a.release();
+    run_one_scan_loop();
+    key_b.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(counters(HOST_REPORT_KEYBOARD).sent, 4);
+    EXPECT_EQ(counters(HOST_REPORT_KEYBOARD).suppressed, 0);
+}
+
+TEST_F(HostCoalesce, MacroBurstIsMerged) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_macro = KeymapKey(0, 0, 0, SHIFTED_A_MACRO);
+
+    set_keymap({key_macro});
+
+    // Shift and A are released in the same interval, so the two releases go out as one report
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key_macro.press();
+    run_one_scan_loop();
+    key_macro.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(counters(HOST_REPORT_KEYBOARD).sent, 3);
+    EXPECT_EQ(counters(HOST_REPORT_KEYBOARD).suppressed, 1);
+}
+
+TEST_F(HostCoalesce, TapInsideOneIntervalIsNotLost) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_macro = KeymapKey(0, 0, 0, TAP_A_MACRO);
+
+    set_keymap({key_macro});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key_macro.press();
+    run_one_scan_loop();
+    // The release is held back until the next interval
+    EXPECT_TRUE(host_reports_pending());
+    key_macro.release();
+    run_one_scan_loop();
+    EXPECT_FALSE(host_reports_pending());
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostCoalesce, MouseMovementIsAccumulated) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_CALL(driver, send_mouse_mock(Truly([](const report_mouse_t &report) { return report.x == 3 && report.y == 0; })));
+    EXPECT_CALL(driver, send_mouse_mock(Truly([](const report_mouse_t &report) { return report.x == 9 && report.y == -2; })));
+
+    report_mouse_t report = {};
+    report.x              = 3;
+    host_mouse_send(&report);
+    report.x = 4;
+    host_mouse_send(&report);
+    report.x = 5;
+    report.y = -2;
+    host_mouse_send(&report);
+    // Nothing moved and no buttons changed
+    report = {};
+    host_mouse_send(&report);
+    idle_for(HOST_COALESCE_INTERVAL + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(counters(HOST_REPORT_MOUSE).sent, 2);
+    EXPECT_EQ(counters(HOST_REPORT_MOUSE).suppressed, 2);
+}
+
+TEST_F(HostCoalesce, KeyboardIsFlushedBeforeMouse) {
+    TestDriver driver;
+    InSequence s;
+
+    report_keyboard_t keyboard = {};
+    report_mouse_t    mouse    = {};
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_LCTL, KC_A));
+    EXPECT_CALL(driver, send_mouse_mock(Truly([](const report_mouse_t &report) { return report.buttons == 1; })));
+    keyboard.keys[0] = KC_A;
+    host_keyboard_send(&keyboard);
+    // Ctrl is held back, but has to reach the host before the click it modifies
+    keyboard.mods = MOD_BIT(KC_LCTL);
+    host_keyboard_send(&keyboard);
+    mouse.buttons = 1;
+    host_mouse_send(&mouse);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_CALL(driver, send_mouse_mock(Truly([](const report_mouse_t &report) { return report.buttons == 0; })));
+    EXPECT_EMPTY_REPORT(driver);
+    mouse.buttons = 0;
+    host_mouse_send(&mouse);
+    keyboard = {};
+    host_keyboard_send(&keyboard);
+    idle_for(HOST_COALESCE_INTERVAL + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostCoalesce, UnchangedKeyboardReportIsSkipped) {
+    TestDriver driver;
+    InSequence s;
+
+    report_keyboard_t keyboard = {};
+
+    EXPECT_REPORT(driver, (KC_A));
+    keyboard.keys[0] = KC_A;
+    host_keyboard_send(&keyboard);
+    idle_for(HOST_COALESCE_INTERVAL + 1);
+    // The same report again, outside the interval, so only the duplicate check can drop it
+    host_keyboard_send(&keyboard);
+    idle_for(HOST_COALESCE_INTERVAL + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(counters(HOST_REPORT_KEYBOARD).sent, 1);
+    EXPECT_EQ(counters(HOST_REPORT_KEYBOARD).suppressed, 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    keyboard = {};
+    host_keyboard_send(&keyboard);
+    idle_for(HOST_COALESCE_INTERVAL + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HostCoalesce, HeldReportIsFlushedWhenTheIntervalEnds) {
+    TestDriver driver;
+    InSequence s;
+
+    report_keyboard_t keyboard = {};
+
+    EXPECT_REPORT(driver, (KC_A));
+    keyboard.keys[0] = KC_A;
+    host_keyboard_send(&keyboard);
+    keyboard = {};
+    host_keyboard_send(&keyboard);
+    // Every task of the interval runs less than HOST_COALESCE_INTERVAL after the report went out
+    idle_for(HOST_COALESCE_INTERVAL);
+    EXPECT_TRUE(host_reports_pending());
+    VERIFY_AND_CLEAR(driver);
+
+    // The first task after it sends the held report, without any further input
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_FALSE(host_reports_pending());
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(counters(HOST_REPORT_KEYBOARD).sent, 2);
+    EXPECT_EQ(counters(HOST_REPORT_KEYBOARD).suppressed, 0);
+}
@@ -0,0 +1,107 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "key_event_queue.h"
+}
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::InSequence;
+
+class KeyEventQueueBudget : public TestFixture {};
+
+TEST_F(KeyEventQueueBudget, SimultaneousChangesAreSpreadOverScans) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({key_a, key_b});
+
+    key_a.press();
+    key_b.press();
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(key_event_queue_count(), 1);
+
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(key_event_queue_count(), 0);
+
+    key_a.release();
+    key_b.release();
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyEventQueueBudget, QueuedEventsKeepTheirScanTime) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_a    = KeymapKey(0, 0, 0, KC_A);
+    auto       key_lsft = KeymapKey(0, 1, 0, LSFT_T(KC_B));
+
+    set_keymap({key_a, key_lsft});
+
+    // The mod-tap release is scanned well inside the tapping term, even though it is processed a scan later
+    key_lsft.press();
+    run_one_scan_loop();
+    idle_for(TAPPING_TERM - 2);
+    key_a.press();
+    key_lsft.release();
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_REPORT(driver, (KC_B, KC_A));
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    key_a.release();
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyEventQueueBudget, FullQueueLeavesChangesForALaterScan) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+    std::vector<KeymapKey> keys;
+    for (uint8_t i = 0; i <= KEY_EVENT_QUEUE_SIZE; i++) {
+        keys.push_back(KeymapKey(0, i % MATRIX_COLS, i / MATRIX_COLS, KC_A + i));
+        add_key(keys.back());
+    }
+    uint16_t overflows = key_event_queue_overflows();
+
+    // One change more than the queue holds: the scan only fills the queue, and the consumer takes one event out
+    for (auto &key : keys) {
+        key.press();
+    }
+    run_one_scan_loop();
+    EXPECT_EQ(key_event_queue_count(), KEY_EVENT_QUEUE_SIZE - 1);
+    EXPECT_EQ(key_event_queue_overflows(), overflows);
+
+    // The next scan queues the change that didn't fit
+    run_one_scan_loop();
+    EXPECT_EQ(key_event_queue_count(), KEY_EVENT_QUEUE_SIZE - 1);
+
+    for (auto &key : keys) {
+        key.release();
+    }
+    for (int i = 0; i < 4 * KEY_EVENT_QUEUE_SIZE && key_event_queue_count(); i++) {
+        run_one_scan_loop();
+    }
+    EXPECT_EQ(key_event_queue_count(), 0);
+    EXPECT_EQ(key_event_queue_overflows(), overflows);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Room for all the overrides of the test keymap, more than fit by default
+#define KEY_OVERRIDE_INDEX_SIZE 160
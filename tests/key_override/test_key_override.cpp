@@ -0,0 +1,256 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::SaveArg;
+
+namespace {
+
+// Overrides activated by a modifier register their replacement once the key repeat delay has passed
+constexpr unsigned KEY_REPEAT_DELAY_MS = 600;
+
+key_override_t make_override(uint8_t trigger_mods, uint16_t trigger, uint16_t replacement, layer_state_t layers = ~0, uint8_t negative_mod_mask = 0) {
+    key_override_t override    = {};
+    override.trigger           = trigger;
+    override.trigger_mods      = trigger_mods;
+    override.layers            = layers;
+    override.negative_mod_mask = negative_mod_mask;
+    override.suppressed_mods   = trigger_mods;
+    override.replacement       = replacement;
+    override.options           = ko_options_default;
+    return override;
+}
+
+// Overrides that never activate in these tests, requiring Alt and GUI together, but sharing triggers with the ones that do
+void add_fillers(std::vector<key_override_t> &overrides, size_t count) {
+    static const uint16_t triggers[] = {KC_A, KC_B, KC_C, KC_D, KC_NO, KC_1, KC_2, KC_3};
+    for (size_t i = 0; i < count; i++) {
+        overrides.push_back(make_override(MOD_MASK_ALT | MOD_MASK_GUI, triggers[overrides.size() % 8], KC_F1 + (overrides.size() % 12)));
+    }
+}
+
+struct OverrideTable {
+    std::vector<key_override_t>        overrides;
+    std::vector<const key_override_t *> pointers;
+};
+
+// The overrides of the tests among fillers, with `trailing` more fillers after them
+const key_override_t **build_overrides(OverrideTable &table, size_t trailing) {
+    std::vector<key_override_t> &overrides = table.overrides;
+
+    add_fillers(overrides, 30);
+    // Shift + A is X, the later Shift + A override never activates
+    overrides.push_back(make_override(MOD_MASK_SHIFT, KC_A, KC_X));
+    add_fillers(overrides, 29);
+    overrides.push_back(make_override(MOD_MASK_SHIFT, KC_A, KC_Y));
+    // Ctrl + B is Q, but Ctrl + Alt + B is W
+    overrides.push_back(make_override(MOD_MASK_CTRL, KC_B, KC_Q, ~0, MOD_MASK_ALT));
+    overrides.push_back(make_override(MOD_MASK_CA, KC_B, KC_W));
+    add_fillers(overrides, 27);
+    // Shift + C is Z on layer 1 only
+    overrides.push_back(make_override(MOD_MASK_SHIFT, KC_C, KC_Z, 1 << 1));
+    // Ctrl + GUI alone is M
+    overrides.push_back(make_override(MOD_BIT(KC_LCTL) | MOD_BIT(KC_LGUI), KC_NO, KC_M));
+    add_fillers(overrides, 38);
+    // Shift + D is Shift + E, as shift is not suppressed
+    overrides.push_back(make_override(MOD_MASK_SHIFT, KC_D, KC_E));
+    overrides.back().suppressed_mods = 0;
+    // Shift + H is Ctrl + G
+    overrides.push_back(make_override(MOD_MASK_SHIFT, KC_H, LCTL(KC_G)));
+    add_fillers(overrides, trailing);
+
+    for (const key_override_t &override : overrides) {
+        table.pointers.push_back(&override);
+    }
+    table.pointers.push_back(NULL);
+    return table.pointers.data();
+}
+
+OverrideTable indexed_table;
+OverrideTable oversized_table;
+
+// 152 overrides, which fit the index of config.h
+const key_override_t **indexed_overrides = build_overrides(indexed_table, 20);
+// 192 overrides, too many for the index, so that all of them are checked on every key event
+const key_override_t **oversized_overrides = build_overrides(oversized_table, 60);
+
+} // namespace
+
+// Expects the last report sent to be `report`, which must be surrounded by parentheses as for EXPECT_REPORT
+#define EXPECT_HELD(report) EXPECT_TRUE(KeyboardReport report.Matches(last_report)) << "Held: " << last_report
+
+const key_override_t **key_overrides = indexed_overrides;
+
+// Runs every test with a table that fits the trigger index, and with one that does not
+class KeyOverride : public ::testing::WithParamInterface<bool>, public TestFixture {
+   public:
+    KeymapKey key_a     = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey key_b     = KeymapKey(0, 1, 0, KC_B);
+    KeymapKey key_c     = KeymapKey(0, 2, 0, KC_C);
+    KeymapKey key_d     = KeymapKey(0, 3, 0, KC_D);
+    KeymapKey key_h     = KeymapKey(0, 4, 0, KC_H);
+    KeymapKey key_lsft  = KeymapKey(0, 5, 0, KC_LSFT);
+    KeymapKey key_lctl  = KeymapKey(0, 6, 0, KC_LCTL);
+    KeymapKey key_lalt  = KeymapKey(0, 7, 0, KC_LALT);
+    KeymapKey key_lgui  = KeymapKey(0, 8, 0, KC_LGUI);
+    KeymapKey key_layer = KeymapKey(0, 9, 0, MO(1));
+    KeymapKey key_c_l1  = KeymapKey(1, 2, 0, KC_C);
+
+    report_keyboard_t last_report = {};
+
+    void SetUp() override {
+        key_overrides = GetParam() ? oversized_overrides : indexed_overrides;
+        set_keymap({key_a, key_b, key_c, key_d, key_h, key_lsft, key_lctl, key_lalt, key_lgui, key_layer, key_c_l1});
+    }
+
+    // Keeps the last report sent, which is what the host sees as held
+    void track_reports(TestDriver &driver) {
+        EXPECT_ANY_REPORT(driver).WillRepeatedly(SaveArg<0>(&last_report));
+    }
+
+    void press(KeymapKey &key) {
+        key.press();
+        run_one_scan_loop();
+    }
+
+    void release(KeymapKey &key) {
+        key.release();
+        run_one_scan_loop();
+    }
+};
+
+TEST_P(KeyOverride, FirstMatchingOverrideWins) {
+    TestDriver driver;
+    track_reports(driver);
+
+    press(key_lsft);
+    press(key_a);
+    EXPECT_HELD((KC_X));
+
+    release(key_a);
+    EXPECT_HELD((KC_LSFT));
+    release(key_lsft);
+    EXPECT_HELD(());
+}
+
+TEST_P(KeyOverride, NoOverrideWithoutMods) {
+    TestDriver driver;
+    track_reports(driver);
+
+    press(key_a);
+    EXPECT_HELD((KC_A));
+    release(key_a);
+    EXPECT_HELD(());
+}
+
+TEST_P(KeyOverride, NegativeModBlocksOverride) {
+    TestDriver driver;
+    track_reports(driver);
+
+    press(key_lctl);
+    press(key_b);
+    EXPECT_HELD((KC_Q));
+    release(key_b);
+    release(key_lctl);
+
+    press(key_lctl);
+    press(key_lalt);
+    press(key_b);
+    EXPECT_HELD((KC_W));
+    release(key_b);
+    release(key_lalt);
+    release(key_lctl);
+    EXPECT_HELD(());
+}
+
+TEST_P(KeyOverride, NegativeModDownSwitchesToOverrideOfHeldTrigger) {
+    TestDriver driver;
+    track_reports(driver);
+
+    press(key_lctl);
+    press(key_b);
+    EXPECT_HELD((KC_Q));
+
+    // Alt deactivates Ctrl + B, and activates Ctrl + Alt + B for the trigger that is still held
+    press(key_lalt);
+    idle_for(KEY_REPEAT_DELAY_MS);
+    EXPECT_HELD((KC_W));
+
+    release(key_b);
+    release(key_lalt);
+    release(key_lctl);
+    EXPECT_HELD(());
+}
+
+TEST_P(KeyOverride, LayerMask) {
+    TestDriver driver;
+    track_reports(driver);
+
+    press(key_lsft);
+    press(key_c);
+    EXPECT_HELD((KC_LSFT, KC_C));
+    release(key_c);
+
+    press(key_layer);
+    press(key_c_l1);
+    EXPECT_HELD((KC_Z));
+    release(key_c_l1);
+    release(key_layer);
+    release(key_lsft);
+    EXPECT_HELD(());
+}
+
+TEST_P(KeyOverride, ModsOnlyTrigger) {
+    TestDriver driver;
+    track_reports(driver);
+
+    press(key_lctl);
+    press(key_lgui);
+    idle_for(KEY_REPEAT_DELAY_MS);
+    EXPECT_HELD((KC_M));
+
+    release(key_lgui);
+    EXPECT_HELD((KC_LCTL));
+    release(key_lctl);
+    EXPECT_HELD(());
+}
+
+TEST_P(KeyOverride, SuppressedMods) {
+    TestDriver driver;
+    track_reports(driver);
+
+    // Shift is kept
+    press(key_lsft);
+    press(key_d);
+    EXPECT_HELD((KC_LSFT, KC_E));
+    release(key_d);
+    EXPECT_HELD((KC_LSFT));
+
+    // Shift is suppressed, and Ctrl added by the replacement
+    press(key_h);
+    EXPECT_HELD((KC_LCTL, KC_G));
+    release(key_h);
+    EXPECT_HELD((KC_LSFT));
+    release(key_lsft);
+    EXPECT_HELD(());
+}
+
+TEST_P(KeyOverride, Disabled) {
+    TestDriver driver;
+    track_reports(driver);
+
+    key_override_off();
+    press(key_lsft);
+    press(key_a);
+    EXPECT_HELD((KC_LSFT, KC_A));
+    release(key_a);
+    release(key_lsft);
+    key_override_on();
+}
+
+INSTANTIATE_TEST_CASE_P(Index, KeyOverride, ::testing::Values(false, true), [](const ::testing::TestParamInfo<bool> &info) { return info.param ? "Linear" : "Indexed"; });
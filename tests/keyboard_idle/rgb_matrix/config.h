@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define KEYBOARD_IDLE_ENABLE
+#define KEYBOARD_IDLE_SCAN_INTERVAL 1
+#define KEYBOARD_IDLE_TIMEOUT 100
+#define KEYBOARD_IDLE_ACTIVITY_PERIOD 10
+
+#define RGB_MATRIX_LED_COUNT 1
@@ -0,0 +1,69 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+}
+
+static void noop_init(void) {}
+static void noop_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {}
+static void noop_set_color_all(uint8_t r, uint8_t g, uint8_t b) {}
+static void noop_flush(void) {}
+
+extern "C" const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = noop_init,
+    .set_color     = noop_set_color,
+    .set_color_all = noop_set_color_all,
+    .flush         = noop_flush,
+};
+
+led_config_t g_led_config = {
+    {{0}},
+    {{0, 0}},
+    {LED_FLAG_ALL},
+};
+
+/* A matrix that can wake the main loop, so that only the LEDs decide how long it sleeps. */
+extern "C" bool matrix_idle_wake_arm(void) {
+    return true;
+}
+
+extern "C" void matrix_idle_wake_disarm(void) {}
+
+class KeyboardIdleRgbMatrix : public TestFixture {
+   protected:
+    uint32_t run_main_loop_for(uint32_t ms) {
+        uint32_t start       = timer_read32();
+        uint32_t invocations = 0;
+        while (TIMER_DIFF_32(timer_read32(), start) < ms) {
+            keyboard_task();
+            housekeeping_task();
+            keyboard_idle_task();
+            invocations++;
+        }
+        return invocations;
+    }
+};
+
+TEST_F(KeyboardIdleRgbMatrix, EffectWakesTheMainLoopOncePerFrame) {
+    TestDriver driver;
+    rgb_matrix_enable_noeeprom();
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    run_main_loop_for(KEYBOARD_IDLE_ACTIVITY_PERIOD + RGB_MATRIX_LED_FLUSH_LIMIT);
+
+    // Each frame takes a few iterations to start, render and flush, and is then followed by a sleep until the next one
+    uint32_t invocations = run_main_loop_for(1000);
+    EXPECT_GE(invocations, 1000 / RGB_MATRIX_LED_FLUSH_LIMIT);
+    EXPECT_LE(invocations, 4 * (1000 / RGB_MATRIX_LED_FLUSH_LIMIT + 1));
+}
+
+TEST_F(KeyboardIdleRgbMatrix, DisabledLedsLetTheMainLoopSleep) {
+    TestDriver driver;
+    rgb_matrix_disable_noeeprom();
+    run_main_loop_for(KEYBOARD_IDLE_ACTIVITY_PERIOD + RGB_MATRIX_LED_FLUSH_LIMIT);
+
+    uint32_t invocations = run_main_loop_for(1000);
+    EXPECT_LE(invocations, 4 * (1000 / KEYBOARD_IDLE_TIMEOUT + 1));
+}
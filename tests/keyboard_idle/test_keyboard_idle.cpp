@@ -0,0 +1,203 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+/* Stands in for a matrix that can wake the main loop from a pin interrupt. */
+static bool     matrix_wake_supported = true;
+static bool     matrix_wake_armed     = false;
+static uint32_t matrix_wake_arm_count = 0;
+
+extern "C" bool matrix_idle_wake_arm(void) {
+    EXPECT_FALSE(matrix_wake_armed);
+    matrix_wake_armed = matrix_wake_supported;
+    matrix_wake_arm_count += matrix_wake_armed;
+    return matrix_wake_armed;
+}
+
+extern "C" void matrix_idle_wake_disarm(void) {
+    EXPECT_TRUE(matrix_wake_armed);
+    matrix_wake_armed = false;
+}
+
+class KeyboardIdle : public TestFixture {
+   protected:
+    void SetUp() override {
+        matrix_wake_supported = true;
+    }
+
+    /* Runs the main loop the way quantum/main.c does for the given amount of simulated time, and returns how many
+     * times keyboard_task() was invoked. */
+    uint32_t run_main_loop_for(uint32_t ms) {
+        uint32_t start       = timer_read32();
+        uint32_t invocations = 0;
+        while (TIMER_DIFF_32(timer_read32(), start) < ms) {
+            keyboard_task();
+            housekeeping_task();
+            keyboard_idle_task();
+            invocations++;
+        }
+        return invocations;
+    }
+
+    /* Lets the activity period run out so the next loop iterations are fully idle. */
+    void settle() {
+        run_main_loop_for(KEYBOARD_IDLE_ACTIVITY_PERIOD + KEYBOARD_IDLE_TIMEOUT);
+    }
+};
+
+TEST_F(KeyboardIdle, TaskInvocationsPerSimulatedSecond) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({regular_key});
+
+    /* Polling rate while a key is held, this is what every loop iteration looked like before the idle path. */
+    EXPECT_REPORT(driver, (KC_A));
+    regular_key.press();
+    uint32_t polling = run_main_loop_for(1000);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.release();
+    settle();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    uint32_t idle = run_main_loop_for(1000);
+    VERIFY_AND_CLEAR(driver);
+
+    RecordProperty("polling_invocations_per_second", polling);
+    RecordProperty("idle_invocations_per_second", idle);
+    EXPECT_EQ(polling, 1000 / KEYBOARD_IDLE_SCAN_INTERVAL);
+    EXPECT_EQ(idle, 1000 / KEYBOARD_IDLE_TIMEOUT);
+}
+
+TEST_F(KeyboardIdle, RecentInputKeepsScanInterval) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({regular_key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    EXPECT_EQ(run_main_loop_for(KEYBOARD_IDLE_ACTIVITY_PERIOD / 2), KEYBOARD_IDLE_ACTIVITY_PERIOD / 2 / KEYBOARD_IDLE_SCAN_INTERVAL);
+    settle();
+    EXPECT_EQ(run_main_loop_for(100), 100 / KEYBOARD_IDLE_TIMEOUT);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyboardIdle, KeyPressIsPickedUpAfterIdlePeriod) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({regular_key});
+
+    settle();
+
+    /* The press lands in the middle of an idle period and is reported on the next wakeup. */
+    EXPECT_REPORT(driver, (KC_A));
+    regular_key.press();
+    uint32_t before = timer_read32();
+    keyboard_task();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(timer_read32(), before);
+
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.release();
+    run_main_loop_for(KEYBOARD_IDLE_SCAN_INTERVAL);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyboardIdle, RequestedDeadlineShortensSleep) {
+    TestDriver driver;
+
+    settle();
+
+    uint32_t before = timer_read32();
+    keyboard_idle_request(3);
+    keyboard_idle_request(7);
+    keyboard_idle_task();
+    EXPECT_EQ(TIMER_DIFF_32(timer_read32(), before), 3);
+
+    /* Requests only apply to a single main loop iteration. */
+    before = timer_read32();
+    keyboard_idle_task();
+    EXPECT_EQ(TIMER_DIFF_32(timer_read32(), before), KEYBOARD_IDLE_TIMEOUT);
+
+    before = timer_read32();
+    keyboard_idle_request(0);
+    keyboard_idle_task();
+    EXPECT_EQ(timer_read32(), before);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyboardIdle, WakeEndsIdlePeriod) {
+    TestDriver driver;
+
+    settle();
+
+    uint32_t before = timer_read32();
+    keyboard_idle_wake();
+    keyboard_idle_task();
+    EXPECT_EQ(timer_read32(), before);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyboardIdle, ModTapHoldResolvesOnTime) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  mod_tap_key = KeymapKey(0, 0, 0, SFT_T(KC_P));
+    set_keymap({mod_tap_key});
+
+    settle();
+
+    EXPECT_NO_REPORT(driver);
+    mod_tap_key.press();
+    run_main_loop_for(TAPPING_TERM);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    run_main_loop_for(KEYBOARD_IDLE_SCAN_INTERVAL + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_main_loop_for(KEYBOARD_IDLE_SCAN_INTERVAL);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyboardIdle, WithoutMatrixWakeTheScanIntervalIsKept) {
+    TestDriver driver;
+
+    settle();
+    matrix_wake_supported = false;
+
+    EXPECT_NO_REPORT(driver);
+    EXPECT_EQ(run_main_loop_for(100), 100 / KEYBOARD_IDLE_SCAN_INTERVAL);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyboardIdle, MatrixWakeIsOnlyArmedForLongSleeps) {
+    TestDriver driver;
+
+    settle();
+
+    uint32_t armed = matrix_wake_arm_count;
+    keyboard_idle_request(KEYBOARD_IDLE_SCAN_INTERVAL);
+    keyboard_idle_task();
+    EXPECT_EQ(matrix_wake_arm_count, armed);
+
+    keyboard_idle_task();
+    EXPECT_EQ(matrix_wake_arm_count, armed + 1);
+    EXPECT_FALSE(matrix_wake_armed);
+
+    VERIFY_AND_CLEAR(driver);
+}
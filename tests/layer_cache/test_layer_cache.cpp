@@ -0,0 +1,142 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LayerCache : public TestFixture {
+   protected:
+    /* Reference implementation of the uncached layer lookup. */
+    static uint8_t reference_layer(keypos_t key) {
+        layer_state_t layers = layer_state | default_layer_state;
+        for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
+            if ((layers & ((layer_state_t)1 << i)) && action_for_key(i, key).code != ACTION_TRANSPARENT) {
+                return i;
+            }
+        }
+        return 0;
+    }
+
+    void build_random_keymap(std::mt19937& rng) {
+        std::bernoulli_distribution opaque(0.3);
+        keymap.clear();
+        for (uint8_t layer = 0; layer < MAX_LAYER; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    uint16_t keycode = (layer == 0 || opaque(rng)) ? KC_A + ((layer + row + col) % 26) : KC_TRNS;
+                    add_key(KeymapKey(layer, col, row, keycode));
+                }
+            }
+        }
+    }
+
+    void expect_all_keys_match_reference() {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                keypos_t key = {.col = col, .row = row};
+                EXPECT_EQ(layer_switch_get_layer(key), reference_layer(key)) << "row " << +row << " col " << +col << " layers " << (layer_state | default_layer_state);
+            }
+        }
+    }
+};
+
+TEST_F(LayerCache, MatchesUncachedLookupForRandomLayerStates) {
+    TestDriver   driver;
+    std::mt19937 rng(0x51a7e);
+    build_random_keymap(rng);
+
+    std::uniform_int_distribution<uint32_t> state_dist;
+    for (int i = 0; i < 64; i++) {
+        default_layer_set((layer_state_t)1 << (state_dist(rng) % 4));
+        layer_state_set((layer_state_t)state_dist(rng));
+        /* Second pass is served entirely from the cache. */
+        expect_all_keys_match_reference();
+        expect_all_keys_match_reference();
+    }
+
+    default_layer_set(1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerCache, MatchesUncachedLookupWhenAlternatingBetweenManyStates) {
+    TestDriver   driver;
+    std::mt19937 rng(0xcafe);
+    build_random_keymap(rng);
+
+    /* More distinct layer stacks than there are cache slots, revisited repeatedly. */
+    const layer_state_t states[] = {0, 0b10, 0b110, 0b1000000000, 0xF0F0F0F0, 0x80000000};
+    for (int round = 0; round < 10; round++) {
+        for (auto state : states) {
+            layer_state_set(state);
+            expect_all_keys_match_reference();
+        }
+    }
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerCache, KeymapChangesInvalidateCache) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  other_key   = KeymapKey(0, 1, 0, KC_B);
+
+    set_keymap({regular_key, other_key, KeymapKey(1, 1, 0, KC_TRNS)});
+
+    layer_on(1);
+    add_key(KeymapKey(1, 0, 0, KC_TRNS));
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 0);
+    EXPECT_EQ(layer_switch_get_layer(other_key.position), 0);
+
+    /* Replacing the keymap through the fixture invalidates the whole cache. */
+    set_keymap({regular_key, other_key, KeymapKey(1, 0, 0, KC_C), KeymapKey(1, 1, 0, KC_TRNS)});
+    EXPECT_EQ(layer_switch_get_layer(regular_key.position), 1);
+    EXPECT_EQ(layer_switch_get_layer(other_key.position), 0);
+
+    /* Bypass the fixture so only the single key invalidation is exercised. */
+    keymap.pop_back();
+    keymap.push_back(KeymapKey(1, 1, 0, KC_D));
+    EXPECT_EQ(layer_switch_get_layer(other_key.position), 0);
+    layer_cache_invalidate_key(other_key.position);
+    EXPECT_EQ(layer_switch_get_layer(other_key.position), 1);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerCache, KeyPressOnHigherLayerUsesCachedLayer) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  layer_key   = KeymapKey(0, 1, 0, MO(3));
+    KeymapKey  regular_key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({layer_key, regular_key, KeymapKey(3, 0, 0, KC_B), KeymapKey(3, 1, 0, KC_TRNS)});
+
+    /* Prime the cache for the base layer stack. */
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QUANTUM_PAINTER_SPI_ASYNC_ENABLE
+
+// The tests complete transfers themselves, nothing runs concurrently
+#define IGNORE_ATOMIC_BLOCK
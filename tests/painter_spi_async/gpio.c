@@ -0,0 +1,20 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gpio.h"
+
+static bool pin_states[256];
+
+void gpio_set_pin_output(pin_t pin) {}
+
+void gpio_write_pin_high(pin_t pin) {
+    pin_states[pin] = true;
+}
+
+void gpio_write_pin_low(pin_t pin) {
+    pin_states[pin] = false;
+}
+
+bool gpio_mock_read_pin(pin_t pin) {
+    return pin_states[pin];
+}
@@ -0,0 +1,163 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "spi_master.h"
+
+typedef struct spi_mock_transfer_t {
+    const uint8_t       *data;
+    uint16_t             length;
+    spi_async_callback_t callback;
+    void                *cb_arg;
+} spi_mock_transfer_t;
+
+static spi_mock_log_t      mock_log;
+static spi_mock_transfer_t queue[SPI_ASYNC_QUEUE_SIZE];
+static uint8_t             queue_head   = 0;
+static uint8_t             queue_count  = 0;
+static bool                started      = false;
+static bool                stop_pending = false;
+static pin_t               slave_pin    = NO_PIN;
+static pin_t               dc_pin       = NO_PIN;
+
+static void record(const uint8_t *data, uint16_t length) {
+    for (uint16_t i = 0; i < length && mock_log.length < SPI_MOCK_LOG_SIZE; ++i) {
+        mock_log.data[mock_log.length] = data[i];
+        mock_log.dc[mock_log.length]   = dc_pin != NO_PIN && gpio_mock_read_pin(dc_pin);
+        mock_log.length++;
+    }
+    if (slave_pin == NO_PIN || gpio_mock_read_pin(slave_pin)) {
+        mock_log.deselected_bytes += length;
+    }
+}
+
+static void release(void) {
+    gpio_write_pin_high(slave_pin);
+    started      = false;
+    stop_pending = false;
+    mock_log.stops++;
+}
+
+void spi_mock_complete_one(void) {
+    if (queue_count == 0) {
+        return;
+    }
+
+    // The data is only read once it goes out, so a staging buffer reused too early shows up in the log
+    spi_mock_transfer_t *done = &queue[queue_head];
+    record(done->data, done->length);
+    if (done->callback) {
+        done->callback(done->cb_arg);
+    }
+    queue_head = (queue_head + 1) % SPI_ASYNC_QUEUE_SIZE;
+    queue_count--;
+
+    if (queue_count == 0 && stop_pending) {
+        release();
+    }
+}
+
+static void check_sync(void) {
+    if (queue_count > 0) {
+        mock_log.sync_while_queued++;
+    }
+}
+
+void spi_init(void) {}
+
+bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
+    spi_async_wait(SPI_TIMEOUT_INFINITE);
+    if (started) {
+        return false;
+    }
+    started   = true;
+    slave_pin = slavePin;
+    gpio_write_pin_low(slave_pin);
+    return true;
+}
+
+spi_status_t spi_write(uint8_t data) {
+    spi_async_wait(SPI_TIMEOUT_INFINITE);
+    check_sync();
+    record(&data, 1);
+    return 0;
+}
+
+spi_status_t spi_read(void) {
+    spi_async_wait(SPI_TIMEOUT_INFINITE);
+    return 0;
+}
+
+spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_async_wait(SPI_TIMEOUT_INFINITE);
+    check_sync();
+    record(data, length);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_async_wait(SPI_TIMEOUT_INFINITE);
+    memset(data, 0, length);
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length, spi_async_callback_t callback, void *cb_arg) {
+    if (!started || stop_pending || length == 0) {
+        return SPI_STATUS_ERROR;
+    }
+
+    // A full queue waits for the oldest transfer to go out
+    if (queue_count >= SPI_ASYNC_QUEUE_SIZE) {
+        spi_mock_complete_one();
+    }
+
+    spi_mock_transfer_t *transfer = &queue[(queue_head + queue_count) % SPI_ASYNC_QUEUE_SIZE];
+    transfer->data                = data;
+    transfer->length              = length;
+    transfer->callback            = callback;
+    transfer->cb_arg              = cb_arg;
+    queue_count++;
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_async_busy(void) {
+    // Time passes while someone polls, one transfer goes out per query
+    bool busy = queue_count > 0;
+    spi_mock_complete_one();
+    return busy;
+}
+
+spi_status_t spi_async_wait(uint16_t timeout) {
+    while (queue_count > 0) {
+        spi_mock_complete_one();
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_stop(void) {
+    if (started && !stop_pending) {
+        if (queue_count > 0) {
+            stop_pending = true;
+            return;
+        }
+        release();
+    }
+}
+
+void spi_mock_reset(pin_t dc) {
+    spi_async_wait(SPI_TIMEOUT_INFINITE);
+    memset(&mock_log, 0, sizeof(mock_log));
+    dc_pin = dc;
+}
+
+const spi_mock_log_t *spi_mock_log(void) {
+    return &mock_log;
+}
+
+uint8_t spi_mock_queue_length(void) {
+    return queue_count;
+}
+
+bool spi_mock_started(void) {
+    return started;
+}
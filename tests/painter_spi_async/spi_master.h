@@ -0,0 +1,66 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Mirrors the ChibiOS SPI master API, recording everything that goes out on the bus
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+
+typedef int16_t spi_status_t;
+
+#define SPI_STATUS_SUCCESS (0)
+#define SPI_STATUS_ERROR (-1)
+#define SPI_STATUS_TIMEOUT (-2)
+
+#define SPI_TIMEOUT_IMMEDIATE (0)
+#define SPI_TIMEOUT_INFINITE (0xFFFF)
+
+#ifndef SPI_ASYNC_QUEUE_SIZE
+#    define SPI_ASYNC_QUEUE_SIZE 2
+#endif
+
+typedef void (*spi_async_callback_t)(void *cb_arg);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void         spi_init(void);
+bool         spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor);
+spi_status_t spi_write(uint8_t data);
+spi_status_t spi_read(void);
+spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
+spi_status_t spi_receive(uint8_t *data, uint16_t length);
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length, spi_async_callback_t callback, void *cb_arg);
+bool         spi_async_busy(void);
+spi_status_t spi_async_wait(uint16_t timeout);
+void         spi_stop(void);
+
+// Test hooks
+
+#define SPI_MOCK_LOG_SIZE 16384
+
+// Every byte that went out on the bus, along with the D/C pin level while it did
+typedef struct spi_mock_log_t {
+    uint8_t  data[SPI_MOCK_LOG_SIZE];
+    bool     dc[SPI_MOCK_LOG_SIZE];
+    uint32_t length;
+    uint32_t deselected_bytes; // bytes sent while chip select was high
+    uint32_t sync_while_queued;
+    uint32_t stops; // number of times the bus was actually released
+} spi_mock_log_t;
+
+void                  spi_mock_reset(pin_t dc_pin);
+const spi_mock_log_t *spi_mock_log(void);
+uint8_t               spi_mock_queue_length(void);
+bool                  spi_mock_started(void);
+
+// Finishes the oldest queued asynchronous transfer, invoking its callback
+void spi_mock_complete_one(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,13 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS += ili9341_spi
+
+# SPI_ASYNC_ENABLE is rejected outside ChibiOS, but the stand-in driver below supports it
+OPT_DEFS += -DSPI_ASYNC_ENABLE
+
+# The test platform has no SPI or GPIO drivers, these record what would go out on the bus instead
+SRC += \
+    gpio.c \
+    spi_master.c
@@ -0,0 +1,152 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+extern "C" {
+#include "qp.h"
+#include "qp_comms.h"
+#include "gpio.h"
+#include "spi_master.h"
+}
+
+#define CS_PIN 1
+#define DC_PIN 2
+
+#define PANEL_SIZE 240
+#define BLOCK_SIZE 40
+#define BLOCK_BYTES (BLOCK_SIZE * BLOCK_SIZE * 2)
+
+// More than the staging buffers can hold at once, so sending it has to wait for the bus
+static_assert(BLOCK_BYTES > QUANTUM_PAINTER_SPI_ASYNC_BUFFERS * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE, "block must not fit the staging buffers");
+
+class PainterSpiAsync : public ::testing::Test {
+   protected:
+    static painter_device_t panel;
+
+    uint8_t pixels[BLOCK_BYTES];
+
+    static void SetUpTestSuite() {
+        panel = qp_ili9341_make_spi_device(PANEL_SIZE, PANEL_SIZE, CS_PIN, DC_PIN, NO_PIN, 4, 0);
+        ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+    }
+
+    void SetUp() override {
+        while (qp_busy(panel)) {
+        }
+        spi_mock_reset(DC_PIN);
+        for (uint32_t i = 0; i < BLOCK_BYTES; ++i) {
+            pixels[i] = (uint8_t)(i * 7 + (i >> 8));
+        }
+    }
+
+    // Index of the first pixel data byte after the last command, the log must end with exactly one block of pixels
+    uint32_t expect_block_at_end(const uint8_t *expected) {
+        const spi_mock_log_t *log = spi_mock_log();
+        EXPECT_GE(log->length, (uint32_t)BLOCK_BYTES + 1);
+        uint32_t start = log->length - BLOCK_BYTES;
+        EXPECT_FALSE(log->dc[start - 1]);
+        EXPECT_EQ(log->data[start - 1], 0x2C); // memory write
+        for (uint32_t i = 0; i < BLOCK_BYTES; ++i) {
+            EXPECT_TRUE(log->dc[start + i]) << "byte " << i;
+            EXPECT_EQ(log->data[start + i], expected[i]) << "byte " << i;
+            if (::testing::Test::HasFailure()) {
+                break;
+            }
+        }
+        return start;
+    }
+};
+
+painter_device_t PainterSpiAsync::panel = nullptr;
+
+TEST_F(PainterSpiAsync, PixelDataReturnsBeforeItIsSent) {
+    ASSERT_TRUE(qp_viewport(panel, 0, 0, BLOCK_SIZE - 1, BLOCK_SIZE - 1));
+    uint32_t stops = spi_mock_log()->stops;
+    ASSERT_TRUE(qp_pixdata(panel, pixels, BLOCK_SIZE * BLOCK_SIZE));
+
+    // The tail of the block is still queued, and the panel stays selected until it has gone out
+    EXPECT_GT(spi_mock_queue_length(), 0);
+    EXPECT_FALSE(gpio_mock_read_pin(CS_PIN));
+    EXPECT_EQ(spi_mock_log()->stops, stops);
+
+    // The caller's buffer is free for reuse as soon as qp_pixdata returns
+    uint8_t expected[BLOCK_BYTES];
+    memcpy(expected, pixels, sizeof(expected));
+    memset(pixels, 0, sizeof(pixels));
+
+    uint32_t polls = 0;
+    while (qp_busy(panel)) {
+        ++polls;
+    }
+    EXPECT_GT(polls, 0);
+    EXPECT_EQ(spi_mock_queue_length(), 0);
+    EXPECT_TRUE(gpio_mock_read_pin(CS_PIN));
+    EXPECT_FALSE(spi_mock_started());
+    EXPECT_EQ(spi_mock_log()->stops, stops + 1);
+
+    expect_block_at_end(expected);
+    EXPECT_EQ(spi_mock_log()->deselected_bytes, 0);
+    EXPECT_EQ(spi_mock_log()->sync_while_queued, 0);
+}
+
+TEST_F(PainterSpiAsync, CommandsWaitForQueuedData) {
+    ASSERT_TRUE(qp_comms_start(panel));
+    qp_comms_command(panel, 0x2C);
+    qp_comms_send(panel, pixels, BLOCK_BYTES);
+    EXPECT_GT(spi_mock_queue_length(), 0);
+
+    // D/C must not drop while the queued pixel data is still being sent
+    qp_comms_command(panel, 0x00);
+    EXPECT_EQ(spi_mock_queue_length(), 0);
+    qp_comms_stop(panel);
+
+    const spi_mock_log_t *log = spi_mock_log();
+    ASSERT_EQ(log->length, BLOCK_BYTES + 2);
+    EXPECT_EQ(log->data[log->length - 1], 0x00);
+    EXPECT_FALSE(log->dc[log->length - 1]);
+    for (uint32_t i = 0; i < BLOCK_BYTES; ++i) {
+        ASSERT_TRUE(log->dc[1 + i]) << "byte " << i;
+        ASSERT_EQ(log->data[1 + i], pixels[i]) << "byte " << i;
+    }
+    EXPECT_EQ(log->sync_while_queued, 0);
+    EXPECT_TRUE(gpio_mock_read_pin(CS_PIN));
+}
+
+TEST_F(PainterSpiAsync, NextOperationWaitsForDeferredStop) {
+    ASSERT_TRUE(qp_viewport(panel, 0, 0, BLOCK_SIZE - 1, BLOCK_SIZE - 1));
+    ASSERT_TRUE(qp_pixdata(panel, pixels, BLOCK_SIZE * BLOCK_SIZE));
+    EXPECT_GT(spi_mock_queue_length(), 0);
+
+    // Starting the bus again flushes the queued data first
+    ASSERT_TRUE(qp_viewport(panel, 0, 0, BLOCK_SIZE - 1, BLOCK_SIZE - 1));
+    EXPECT_EQ(spi_mock_queue_length(), 0);
+    EXPECT_EQ(spi_mock_log()->sync_while_queued, 0);
+    EXPECT_EQ(spi_mock_log()->deselected_bytes, 0);
+}
+
+TEST_F(PainterSpiAsync, Stats) {
+    painter_comms_stats_t before;
+    painter_comms_stats_t after;
+    ASSERT_TRUE(qp_get_comms_stats(panel, &before));
+    EXPECT_EQ(before.queue_depth, 0);
+
+    ASSERT_TRUE(qp_viewport(panel, 0, 0, BLOCK_SIZE - 1, BLOCK_SIZE - 1));
+    ASSERT_TRUE(qp_pixdata(panel, pixels, BLOCK_SIZE * BLOCK_SIZE));
+    ASSERT_TRUE(qp_get_comms_stats(panel, &after));
+    EXPECT_GT(after.queue_depth, 0);
+    EXPECT_LE(after.queue_depth, QUANTUM_PAINTER_SPI_ASYNC_BUFFERS);
+    EXPECT_EQ(after.max_queue_depth, QUANTUM_PAINTER_SPI_ASYNC_BUFFERS);
+
+    while (qp_busy(panel)) {
+    }
+    ASSERT_TRUE(qp_get_comms_stats(panel, &after));
+    EXPECT_EQ(after.queue_depth, 0);
+
+    // The viewport sends two 4-byte windows, the pixel data needs one transfer per staging buffer's worth
+    uint32_t pixel_transfers = (BLOCK_BYTES + QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE - 1) / QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE;
+    EXPECT_EQ(after.transfers - before.transfers, 2 + pixel_transfers);
+    EXPECT_EQ(after.stalls - before.stalls, pixel_transfers - QUANTUM_PAINTER_SPI_ASYNC_BUFFERS);
+}
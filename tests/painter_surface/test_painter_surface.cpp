@@ -0,0 +1,246 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstring>
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_surface.h"
+}
+
+#define RGB565_WIDTH 240
+#define RGB565_HEIGHT 80
+#define MONO_WIDTH 128
+#define MONO_HEIGHT 64
+
+static uint8_t rgb565_source_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(RGB565_WIDTH, RGB565_HEIGHT, 16)];
+static uint8_t rgb565_target_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(RGB565_WIDTH, RGB565_HEIGHT, 16)];
+static uint8_t mono_source_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(MONO_WIDTH, MONO_HEIGHT, 1)];
+static uint8_t mono_target_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(MONO_WIDTH, MONO_HEIGHT, 1)];
+
+// The targets are surfaces too, with viewport and pixdata wrapped to count what gets transferred into them
+typedef struct transfer_counts_t {
+    uint32_t viewports;
+    uint32_t pixels;
+} transfer_counts_t;
+
+typedef struct counting_vtable_t {
+    painter_driver_vtable_t        base; // must be first, so it can be cast from the painter_driver_vtable_t* type
+    const painter_driver_vtable_t *surface;
+} counting_vtable_t;
+
+static transfer_counts_t counts;
+static counting_vtable_t rgb565_target_vtable;
+static counting_vtable_t mono_target_vtable;
+
+static const painter_driver_vtable_t *surface_vtable(painter_device_t device) {
+    return ((const counting_vtable_t *)((painter_driver_t *)device)->driver_vtable)->surface;
+}
+
+static bool counting_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    counts.viewports++;
+    return surface_vtable(device)->viewport(device, left, top, right, bottom);
+}
+
+static bool counting_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    counts.pixels += native_pixel_count;
+    return surface_vtable(device)->pixdata(device, pixel_data, native_pixel_count);
+}
+
+static void make_counting_target(painter_device_t surface, counting_vtable_t *vtable) {
+    painter_driver_t *driver = (painter_driver_t *)surface;
+    vtable->base             = *driver->driver_vtable;
+    vtable->base.viewport    = counting_viewport;
+    vtable->base.pixdata     = counting_pixdata;
+    vtable->surface          = driver->driver_vtable;
+    driver->driver_vtable    = &vtable->base;
+}
+
+class PainterSurface : public ::testing::Test {
+   protected:
+    static painter_device_t rgb565_source;
+    static painter_device_t rgb565_target;
+    static painter_device_t mono_source;
+    static painter_device_t mono_target;
+
+    static void SetUpTestSuite() {
+        rgb565_source = qp_make_rgb565_surface(RGB565_WIDTH, RGB565_HEIGHT, rgb565_source_buffer);
+        rgb565_target = qp_make_rgb565_surface(RGB565_WIDTH, RGB565_HEIGHT, rgb565_target_buffer);
+        mono_source   = qp_make_mono1bpp_surface(MONO_WIDTH, MONO_HEIGHT, mono_source_buffer);
+        mono_target   = qp_make_mono1bpp_surface(MONO_WIDTH, MONO_HEIGHT, mono_target_buffer);
+        make_counting_target(rgb565_target, &rgb565_target_vtable);
+        make_counting_target(mono_target, &mono_target_vtable);
+    }
+
+    void SetUp() override {
+        ASSERT_TRUE(qp_init(rgb565_source, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(rgb565_target, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(mono_source, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(mono_target, QP_ROTATION_0));
+
+        // Freshly initialised surfaces are entirely dirty, get that out of the way
+        ASSERT_TRUE(qp_surface_draw(rgb565_source, rgb565_target, 0, 0, false));
+        ASSERT_TRUE(qp_surface_draw(mono_source, mono_target, 0, 0, false));
+    }
+
+    // Draws the source to the target, returning what was transferred
+    static transfer_counts_t draw(painter_device_t source, painter_device_t target, bool entire_surface = false) {
+        counts = {0, 0};
+        EXPECT_TRUE(qp_surface_draw(source, target, 0, 0, entire_surface));
+        return counts;
+    }
+
+    static void expect_rgb565_synced() {
+        EXPECT_EQ(memcmp(rgb565_source_buffer, rgb565_target_buffer, sizeof(rgb565_source_buffer)), 0);
+    }
+
+    static void expect_mono_synced() {
+        EXPECT_EQ(memcmp(mono_source_buffer, mono_target_buffer, sizeof(mono_source_buffer)), 0);
+    }
+
+    static uint32_t area(uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+        return (uint32_t)(r - l + 1) * (b - t + 1);
+    }
+};
+
+painter_device_t PainterSurface::rgb565_source = nullptr;
+painter_device_t PainterSurface::rgb565_target = nullptr;
+painter_device_t PainterSurface::mono_source   = nullptr;
+painter_device_t PainterSurface::mono_target   = nullptr;
+
+TEST_F(PainterSurface, InitialDrawSendsWholeSurface) {
+    ASSERT_TRUE(qp_init(rgb565_source, QP_ROTATION_0));
+    transfer_counts_t c = draw(rgb565_source, rgb565_target);
+    EXPECT_EQ(c.viewports, 1);
+    EXPECT_EQ(c.pixels, RGB565_WIDTH * RGB565_HEIGHT);
+}
+
+TEST_F(PainterSurface, CleanSurfaceSendsNothing) {
+    // Redrawing identical pixels doesn't make anything dirty either
+    ASSERT_TRUE(qp_rect(rgb565_source, 10, 10, 20, 20, 0, 0, 0, true));
+    transfer_counts_t c = draw(rgb565_source, rgb565_target);
+    EXPECT_EQ(c.viewports, 0);
+    EXPECT_EQ(c.pixels, 0);
+}
+
+TEST_F(PainterSurface, EntireSurfaceIgnoresDirtyRegions) {
+    ASSERT_TRUE(qp_rect(rgb565_source, 0, 0, 9, 9, 0, 255, 255, true));
+    transfer_counts_t c = draw(rgb565_source, rgb565_target, true);
+    EXPECT_EQ(c.viewports, 1);
+    EXPECT_EQ(c.pixels, RGB565_WIDTH * RGB565_HEIGHT);
+    expect_rgb565_synced();
+    EXPECT_EQ(draw(rgb565_source, rgb565_target).pixels, 0);
+}
+
+TEST_F(PainterSurface, OppositeCornersAreSentSeparately) {
+    ASSERT_TRUE(qp_rect(rgb565_source, 0, 0, 9, 9, 0, 255, 255, true));
+    ASSERT_TRUE(qp_rect(rgb565_source, RGB565_WIDTH - 10, RGB565_HEIGHT - 10, RGB565_WIDTH - 1, RGB565_HEIGHT - 1, 85, 255, 255, true));
+    transfer_counts_t c = draw(rgb565_source, rgb565_target);
+    EXPECT_EQ(c.viewports, 2);
+    EXPECT_EQ(c.pixels, 2 * 10 * 10);
+    expect_rgb565_synced();
+}
+
+TEST_F(PainterSurface, FilledRectIsOneRegion) {
+    ASSERT_TRUE(qp_rect(rgb565_source, 20, 20, 119, 59, 0, 255, 255, true));
+    transfer_counts_t c = draw(rgb565_source, rgb565_target);
+    EXPECT_EQ(c.viewports, 1);
+    EXPECT_EQ(c.pixels, area(20, 20, 119, 59));
+    expect_rgb565_synced();
+}
+
+TEST_F(PainterSurface, NearbyUpdatesMerge) {
+    // A row of closely spaced glyph-sized boxes, like a line of text
+    for (uint16_t i = 0; i < 8; ++i) {
+        ASSERT_TRUE(qp_rect(rgb565_source, 4 + i * 10, 4, 11 + i * 10, 15, 170, 255, 255, true));
+    }
+    transfer_counts_t c = draw(rgb565_source, rgb565_target);
+    EXPECT_EQ(c.viewports, 1);
+    EXPECT_EQ(c.pixels, area(4, 4, 81, 15));
+    expect_rgb565_synced();
+}
+
+TEST_F(PainterSurface, OutlineIsSentAsEdges) {
+    // A frame around most of the surface, a single bounding box would resend the whole interior
+    ASSERT_TRUE(qp_rect(rgb565_source, 0, 0, RGB565_WIDTH - 1, RGB565_HEIGHT - 1, 0, 255, 255, false));
+    transfer_counts_t c = draw(rgb565_source, rgb565_target);
+    EXPECT_LE(c.viewports, SURFACE_DIRTY_RECTS);
+    EXPECT_LT(c.pixels, area(0, 0, RGB565_WIDTH - 1, RGB565_HEIGHT - 1) / 4);
+    expect_rgb565_synced();
+}
+
+TEST_F(PainterSurface, MoreRegionsThanSlotsStillCoverEverything) {
+    // Scattered updates, more than can be tracked separately
+    for (uint16_t i = 0; i < 12; ++i) {
+        uint16_t x = (i * 67) % (RGB565_WIDTH - 8);
+        uint16_t y = (i * 29) % (RGB565_HEIGHT - 8);
+        ASSERT_TRUE(qp_rect(rgb565_source, x, y, x + 7, y + 7, i * 20, 255, 255, true));
+    }
+    transfer_counts_t c = draw(rgb565_source, rgb565_target);
+    EXPECT_LE(c.viewports, SURFACE_DIRTY_RECTS);
+    EXPECT_LE(c.pixels, area(0, 0, RGB565_WIDTH - 1, RGB565_HEIGHT - 1));
+    expect_rgb565_synced();
+}
+
+TEST_F(PainterSurface, Mono1bppTransfersDirtyRegions) {
+    ASSERT_TRUE(qp_rect(mono_source, 1, 2, 10, 6, 0, 0, 255, true));
+    ASSERT_TRUE(qp_rect(mono_source, MONO_WIDTH - 13, MONO_HEIGHT - 9, MONO_WIDTH - 3, MONO_HEIGHT - 1, 0, 0, 255, true));
+    ASSERT_TRUE(qp_line(mono_source, 40, 30, 80, 33, 0, 0, 255));
+    transfer_counts_t c = draw(mono_source, mono_target);
+    EXPECT_EQ(c.viewports, 3);
+    EXPECT_LT(c.pixels, MONO_WIDTH * MONO_HEIGHT / 8);
+    expect_mono_synced();
+
+    // Clearing pixels makes them dirty too
+    ASSERT_TRUE(qp_rect(mono_source, 1, 2, 10, 6, 0, 0, 0, true));
+    c = draw(mono_source, mono_target);
+    EXPECT_EQ(c.viewports, 1);
+    EXPECT_EQ(c.pixels, area(1, 2, 10, 6));
+    expect_mono_synced();
+}
+
+TEST_F(PainterSurface, Report) {
+    // Pixels sent for typical UI updates, compared against a single bounding box around everything that changed
+    struct pattern_t {
+        const char *name;
+        void (*draw)(painter_device_t surface);
+        uint32_t bbox;
+    };
+    static const pattern_t patterns[] = {
+        {"two corner indicators",
+         [](painter_device_t s) {
+             qp_rect(s, 2, 2, 17, 17, 0, 255, 255, true);
+             qp_rect(s, RGB565_WIDTH - 18, 2, RGB565_WIDTH - 3, 17, 85, 255, 255, true);
+         },
+         area(2, 2, RGB565_WIDTH - 3, 17)},
+        {"layer name + wpm",
+         [](painter_device_t s) {
+             qp_rect(s, 4, 4, 100, 18, 170, 255, 255, true);
+             qp_rect(s, 180, 60, 235, 74, 42, 255, 255, true);
+         },
+         area(4, 4, 235, 74)},
+        {"progress bar + caps lock",
+         [](painter_device_t s) {
+             qp_rect(s, 10, 70, 150, 75, 128, 255, 255, true);
+             qp_circle(s, 225, 12, 6, 0, 255, 255, true);
+         },
+         area(10, 6, 231, 75)},
+    };
+
+    printf("%-28s %10s %10s %10s\n", "pattern", "viewports", "pixels", "bbox");
+    for (const pattern_t &p : patterns) {
+        ASSERT_TRUE(qp_init(rgb565_source, QP_ROTATION_0));
+        ASSERT_TRUE(qp_flush(rgb565_source));
+        p.draw(rgb565_source);
+        ASSERT_TRUE(qp_init(rgb565_target, QP_ROTATION_0));
+        ASSERT_TRUE(qp_flush(rgb565_target));
+        transfer_counts_t c = draw(rgb565_source, rgb565_target);
+        printf("%-28s %10u %10u %10u\n", p.name, (unsigned)c.viewports, (unsigned)c.pixels, (unsigned)p.bbox);
+        EXPECT_LT(c.pixels, p.bbox);
+        expect_rgb565_synced();
+    }
+}
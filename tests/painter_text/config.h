@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// A text-sized RGB565 surface plus a mono one
+#define SURFACE_NUM_DEVICES 2
+
+// Fewer entries than the distinct glyphs of a line so they get evicted, and the wider glyphs don't fit in an entry
+#define QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES 4
+#define QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE 128
@@ -0,0 +1,12 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS += surface
+
+COMMON_VPATH += $(DRIVER_PATH)/painter/tft_panel
+
+SRC += \
+    $(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c \
+    test_panel.c \
+    thintel15.qff.c
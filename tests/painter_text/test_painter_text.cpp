@@ -0,0 +1,196 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+extern "C" {
+#include "qp.h"
+#include "qp_comms_dummy.h"
+#include "qp_surface.h"
+#include "test_panel.h"
+#include "thintel15.qff.h"
+}
+
+#define SURFACE_WIDTH 128
+#define SURFACE_HEIGHT 16
+
+// Images drawn without the glyph cache, which every cached draw has to reproduce
+#define HELLO_WORLD "Hello, world!"
+#define HELLO_WORLD_RGB565_HASH 0x1E84ABAB
+#define HELLO_WORLD_MONO_HASH 0xCFF43656
+#define HELLO_WORLD_RECOLOR_HASH 0xC4D9937A
+
+static uint8_t rgb565_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 16)];
+static uint8_t mono_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(SURFACE_WIDTH, SURFACE_HEIGHT, 1)];
+
+class PainterText : public ::testing::Test {
+   protected:
+    static painter_device_t rgb565_surface;
+    static painter_device_t mono_surface;
+    static painter_device_t panel;
+
+    painter_font_handle_t font;
+
+    static void SetUpTestSuite() {
+        rgb565_surface = qp_make_rgb565_surface(SURFACE_WIDTH, SURFACE_HEIGHT, rgb565_buffer);
+        mono_surface   = qp_make_mono1bpp_surface(SURFACE_WIDTH, SURFACE_HEIGHT, mono_buffer);
+        panel          = test_panel_make_device(240, 320);
+        ASSERT_TRUE(qp_init(rgb565_surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(mono_surface, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(panel, QP_ROTATION_0));
+    }
+
+    void SetUp() override {
+        font = qp_load_font_mem(font_thintel15);
+        ASSERT_NE(font, nullptr);
+        memset(rgb565_buffer, 0, sizeof(rgb565_buffer));
+        memset(mono_buffer, 0, sizeof(mono_buffer));
+        dummy_comms_reset_stats();
+    }
+
+    void TearDown() override {
+        qp_close_font(font);
+    }
+
+    static uint32_t hash(const uint8_t *data, size_t length) {
+        // FNV-1a
+        uint32_t h = 2166136261u;
+        for (size_t i = 0; i < length; ++i) {
+            h = (h ^ data[i]) * 16777619u;
+        }
+        return h;
+    }
+
+    dummy_comms_stats_t stats() {
+        dummy_comms_stats_t s;
+        dummy_comms_get_stats(&s);
+        return s;
+    }
+
+    // One viewport on the test panel, followed by the pixel data in pixdata buffer sized chunks
+    static void expect_block(dummy_comms_stats_t *expected, uint32_t pixels) {
+        uint32_t bytes = pixels * 2;
+        expected->transactions += 5 + (bytes + QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE - 1) / QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE;
+        expected->commands += 3;
+        expected->bytes += 11 + bytes;
+    }
+
+    // What the panel should receive for a single line of ASCII text
+    dummy_comms_stats_t expected_panel_traffic(const char *str) {
+        dummy_comms_stats_t expected = {0};
+        uint8_t             height   = ((const painter_font_desc_t *)font)->line_height;
+        // Cached glyphs are combined, anything too large for an entry is sent on its own
+        uint32_t run_pixels = 0;
+        uint8_t  run_length = 0;
+        for (const char *c = str; *c; ++c) {
+            char     glyph[2] = {*c, 0};
+            uint32_t pixels   = qp_textwidth(font, glyph) * height;
+            if (pixels * 2 > QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE || run_length == QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES) {
+                if (run_length > 0) {
+                    expect_block(&expected, run_pixels);
+                }
+                run_pixels = 0;
+                run_length = 0;
+            }
+            if (pixels * 2 > QUANTUM_PAINTER_GLYPH_CACHE_ENTRY_SIZE) {
+                expect_block(&expected, pixels);
+            } else {
+                run_pixels += pixels;
+                run_length++;
+            }
+        }
+        if (run_length > 0) {
+            expect_block(&expected, run_pixels);
+        }
+        return expected;
+    }
+
+    void expect_panel_traffic(const char *str) {
+        dummy_comms_stats_t expected = expected_panel_traffic(str);
+        dummy_comms_stats_t actual   = stats();
+        EXPECT_EQ(actual.transactions, expected.transactions) << str;
+        EXPECT_EQ(actual.commands, expected.commands) << str;
+        EXPECT_EQ(actual.bytes, expected.bytes) << str;
+    }
+};
+
+painter_device_t PainterText::rgb565_surface;
+painter_device_t PainterText::mono_surface;
+painter_device_t PainterText::panel;
+
+TEST_F(PainterText, DrawnWidthMatchesTextWidth) {
+    EXPECT_EQ(qp_drawtext(rgb565_surface, 0, 0, font, HELLO_WORLD), qp_textwidth(font, HELLO_WORLD));
+    EXPECT_EQ(qp_drawtext(rgb565_surface, 0, 0, font, HELLO_WORLD), qp_textwidth(font, HELLO_WORLD));
+}
+
+TEST_F(PainterText, Rgb565MatchesReference) {
+    ASSERT_GT(qp_drawtext(rgb565_surface, 2, 1, font, HELLO_WORLD), 0);
+    EXPECT_EQ(hash(rgb565_buffer, sizeof(rgb565_buffer)), HELLO_WORLD_RGB565_HASH);
+}
+
+TEST_F(PainterText, MonoMatchesReference) {
+    ASSERT_GT(qp_drawtext(mono_surface, 2, 1, font, HELLO_WORLD), 0);
+    EXPECT_EQ(hash(mono_buffer, sizeof(mono_buffer)), HELLO_WORLD_MONO_HASH);
+}
+
+TEST_F(PainterText, RecolorMatchesReference) {
+    // Draw the default colors first, so a cache keyed only on the glyph would hand back the wrong pixels
+    ASSERT_GT(qp_drawtext(rgb565_surface, 2, 1, font, HELLO_WORLD), 0);
+    ASSERT_GT(qp_drawtext_recolor(rgb565_surface, 2, 1, font, HELLO_WORLD, 85, 255, 255, 170, 255, 64), 0);
+    EXPECT_EQ(hash(rgb565_buffer, sizeof(rgb565_buffer)), HELLO_WORLD_RECOLOR_HASH);
+}
+
+TEST_F(PainterText, CacheIsKeyedOnDevice) {
+    // Same font and colors on displays with different pixel formats
+    ASSERT_GT(qp_drawtext(rgb565_surface, 2, 1, font, HELLO_WORLD), 0);
+    ASSERT_GT(qp_drawtext(mono_surface, 2, 1, font, HELLO_WORLD), 0);
+    ASSERT_GT(qp_drawtext(panel, 2, 1, font, HELLO_WORLD), 0);
+    memset(rgb565_buffer, 0, sizeof(rgb565_buffer));
+    memset(mono_buffer, 0, sizeof(mono_buffer));
+    ASSERT_GT(qp_drawtext(rgb565_surface, 2, 1, font, HELLO_WORLD), 0);
+    ASSERT_GT(qp_drawtext(mono_surface, 2, 1, font, HELLO_WORLD), 0);
+    EXPECT_EQ(hash(rgb565_buffer, sizeof(rgb565_buffer)), HELLO_WORLD_RGB565_HASH);
+    EXPECT_EQ(hash(mono_buffer, sizeof(mono_buffer)), HELLO_WORLD_MONO_HASH);
+}
+
+TEST_F(PainterText, ReloadedFontIsRedrawn) {
+    ASSERT_GT(qp_drawtext(rgb565_surface, 2, 1, font, HELLO_WORLD), 0);
+    ASSERT_TRUE(qp_close_font(font));
+    font = qp_load_font_mem(font_thintel15);
+    ASSERT_NE(font, nullptr);
+    memset(rgb565_buffer, 0, sizeof(rgb565_buffer));
+    ASSERT_GT(qp_drawtext(rgb565_surface, 2, 1, font, HELLO_WORLD), 0);
+    EXPECT_EQ(hash(rgb565_buffer, sizeof(rgb565_buffer)), HELLO_WORLD_RGB565_HASH);
+}
+
+TEST_F(PainterText, PanelTraffic) {
+    const char *lines[] = {HELLO_WORLD, "WPM: 123", "Layer: QWERTY", "i", "MMMMMMMMMMMMMMMMMMMMMMMMMMMM"};
+    for (const char *line : lines) {
+        // Cold, then again with everything cached
+        for (int pass = 0; pass < 2; ++pass) {
+            dummy_comms_reset_stats();
+            ASSERT_EQ(qp_drawtext(panel, 0, 0, font, line), qp_textwidth(font, line));
+            expect_panel_traffic(line);
+        }
+    }
+}
+
+TEST_F(PainterText, Benchmark) {
+    const char *lines[]    = {"WPM: 123", "Layer: QWERTY", "Caps: off  Num: on"};
+    const int   iterations = 5000;
+
+    for (const char *line : lines) {
+        dummy_comms_reset_stats();
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            qp_drawtext(panel, 0, 0, font, line);
+        }
+        auto                elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        dummy_comms_stats_t total   = stats();
+        printf("glyph cache %3d entries, \"%s\": %4u transactions, %5u bytes, %7.0f ns per draw\n", QUANTUM_PAINTER_GLYPH_CACHE_ENTRIES, line, total.transactions / iterations, total.bytes / iterations, (double)elapsed / iterations);
+    }
+}
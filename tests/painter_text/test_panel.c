@@ -0,0 +1,62 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "qp_internal.h"
+#include "qp_comms.h"
+#include "qp_comms_dummy.h"
+#include "qp_tft_panel.h"
+#include "test_panel.h"
+
+static bool test_panel_init(painter_device_t device, painter_rotation_t rotation) {
+    // clang-format off
+    static const uint8_t test_panel_init_sequence[] = {
+        // Command,     Delay, N, Data[N]
+        0x01,           0,     0,          // software reset
+        0x11,           0,     0,          // sleep out
+        0x3A,           0,     1, 0x55,    // 16bpp
+        0x36,           0,     1, 0x08,    // memory access control
+        0x29,           0,     0,          // display on
+    };
+    // clang-format on
+    qp_comms_bulk_command_sequence(device, test_panel_init_sequence, sizeof(test_panel_init_sequence));
+    return true;
+}
+
+static const tft_panel_dc_reset_painter_driver_vtable_t test_panel_driver_vtable = {
+    .base =
+        {
+            .init            = test_panel_init,
+            .power           = qp_tft_panel_power,
+            .clear           = qp_tft_panel_clear,
+            .flush           = qp_tft_panel_flush,
+            .pixdata         = qp_tft_panel_pixdata,
+            .viewport        = qp_tft_panel_viewport,
+            .palette_convert = qp_tft_panel_palette_convert_rgb565_swapped,
+            .append_pixels   = qp_tft_panel_append_pixels_rgb565,
+            .append_pixdata  = qp_tft_panel_append_pixdata,
+        },
+    .num_window_bytes   = 2,
+    .swap_window_coords = false,
+    .opcodes =
+        {
+            .display_on         = 0x29,
+            .display_off        = 0x28,
+            .set_column_address = 0x2A,
+            .set_row_address    = 0x2B,
+            .enable_writes      = 0x2C,
+        },
+};
+
+static painter_driver_t test_panel;
+
+painter_device_t test_panel_make_device(uint16_t panel_width, uint16_t panel_height) {
+    test_panel.driver_vtable         = (const painter_driver_vtable_t *)&test_panel_driver_vtable;
+    test_panel.comms_vtable          = (const painter_comms_vtable_t *)&dummy_comms_with_command_vtable;
+    test_panel.native_bits_per_pixel = 16; // RGB565
+    test_panel.panel_width           = panel_width;
+    test_panel.panel_height          = panel_height;
+    test_panel.rotation              = QP_ROTATION_0;
+    test_panel.offset_x              = 0;
+    test_panel.offset_y              = 0;
+    return (painter_device_t)&test_panel;
+}
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <qp.h>
+
+// An RGB565 TFT panel driven through the counting dummy comms, nothing is transmitted anywhere
+painter_device_t test_panel_make_device(uint16_t panel_width, uint16_t panel_height);
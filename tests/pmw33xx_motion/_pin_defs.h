@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+// The test platform has no GPIO of its own, pins are plain indices into the mock's pin states
+typedef uint8_t pin_t;
@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define PMW33XX_CS_PIN 1
+#define PMW33XX_MOTION_PIN 2
+#define PMW33XX_MOTION_ASYNC
+
+// The tests stand in for the interrupt and the motion thread, nothing runs concurrently
+#define IGNORE_ATOMIC_BLOCK
@@ -0,0 +1,23 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gpio.h"
+
+// Pins read high until driven low, as if pulled up
+static bool pin_low[256];
+
+void gpio_set_pin_output(pin_t pin) {}
+
+void gpio_set_pin_input_high(pin_t pin) {}
+
+void gpio_write_pin_high(pin_t pin) {
+    pin_low[pin] = false;
+}
+
+void gpio_write_pin_low(pin_t pin) {
+    pin_low[pin] = true;
+}
+
+bool gpio_read_pin(pin_t pin) {
+    return !pin_low[pin];
+}
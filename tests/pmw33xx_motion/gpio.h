@@ -0,0 +1,21 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include "pin_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void gpio_set_pin_output(pin_t pin);
+void gpio_set_pin_input_high(pin_t pin);
+void gpio_write_pin_high(pin_t pin);
+void gpio_write_pin_low(pin_t pin);
+bool gpio_read_pin(pin_t pin);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,138 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "spi_master.h"
+#include <string.h>
+
+#define REG_PRODUCT_ID 0x00
+#define REG_SROM_ID 0x2a
+#define REG_INVERSE_PRODUCT_ID 0x3f
+#define REG_MOTION_BURST 0x50
+
+#define MOTION_MOT 0x80
+#define MOTION_LIFT_STAT 0x08
+
+static uint8_t registers[128];
+static bool    started;
+static bool    addressed;
+static uint8_t address;
+
+// Motion not read yet
+static pin_t   motion_pin;
+static int32_t delta_x;
+static int32_t delta_y;
+static bool    moved;
+static bool    lifted;
+static int16_t during_burst_x;
+static int16_t during_burst_y;
+static bool    move_during_burst;
+
+static uint32_t transactions;
+static uint32_t bursts;
+
+void spi_init(void) {
+    registers[REG_PRODUCT_ID]         = 0x42;
+    registers[REG_INVERSE_PRODUCT_ID] = 0xBD;
+    registers[REG_SROM_ID]            = 0x04;
+}
+
+bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
+    if (started) {
+        return false;
+    }
+    started   = true;
+    addressed = false;
+    transactions++;
+    return true;
+}
+
+spi_status_t spi_write(uint8_t data) {
+    if (!addressed) {
+        address   = data;
+        addressed = true;
+    }
+    // Anything after the address is firmware being uploaded, which the emulated sensor already runs
+    return SPI_STATUS_SUCCESS;
+}
+
+spi_status_t spi_read(void) {
+    return registers[address & 0x7f];
+}
+
+spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    if (!addressed && length == 2 && (data[0] & 0x80)) {
+        registers[data[0] & 0x7f] = data[1];
+    } else {
+        for (uint16_t i = 0; i < length; i++) {
+            spi_write(data[i]);
+        }
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
+static void burst(uint8_t *data, uint16_t length) {
+    int16_t dx = delta_x < INT16_MIN ? INT16_MIN : delta_x > INT16_MAX ? INT16_MAX : delta_x;
+    int16_t dy = delta_y < INT16_MIN ? INT16_MIN : delta_y > INT16_MAX ? INT16_MAX : delta_y;
+    uint8_t frame[6];
+    frame[0] = (moved ? MOTION_MOT : 0) | (lifted ? MOTION_LIFT_STAT : 0);
+    frame[1] = 0;
+    frame[2] = (uint16_t)dx & 0xff;
+    frame[3] = (uint16_t)dx >> 8;
+    frame[4] = (uint16_t)dy & 0xff;
+    frame[5] = (uint16_t)dy >> 8;
+    memcpy(data, frame, length < sizeof(frame) ? length : sizeof(frame));
+
+    delta_x -= dx;
+    delta_y -= dy;
+    moved  = delta_x != 0 || delta_y != 0;
+    lifted = false;
+    bursts++;
+
+    if (move_during_burst) {
+        move_during_burst = false;
+        spi_mock_move(motion_pin, during_burst_x, during_burst_y);
+    } else if (!moved) {
+        gpio_write_pin_high(motion_pin);
+    }
+}
+
+spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    if (address == REG_MOTION_BURST) {
+        burst(data, length);
+    } else {
+        memset(data, 0, length);
+    }
+    return SPI_STATUS_SUCCESS;
+}
+
+void spi_stop(void) {
+    started = false;
+}
+
+void spi_mock_move(pin_t pin, int16_t dx, int16_t dy) {
+    motion_pin = pin;
+    delta_x += dx;
+    delta_y += dy;
+    moved = true;
+    gpio_write_pin_low(pin);
+}
+
+void spi_mock_lift(pin_t pin) {
+    motion_pin = pin;
+    lifted     = true;
+    gpio_write_pin_low(pin);
+}
+
+void spi_mock_move_during_burst(int16_t dx, int16_t dy) {
+    during_burst_x    = dx;
+    during_burst_y    = dy;
+    move_during_burst = true;
+}
+
+uint32_t spi_mock_transactions(void) {
+    return transactions;
+}
+
+uint32_t spi_mock_bursts(void) {
+    return bursts;
+}
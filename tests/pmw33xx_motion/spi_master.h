@@ -0,0 +1,48 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Mirrors the SPI master API, with a PMW3360 on the other end of the bus
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "gpio.h"
+
+typedef int16_t spi_status_t;
+
+#define SPI_STATUS_SUCCESS (0)
+#define SPI_STATUS_ERROR (-1)
+#define SPI_STATUS_TIMEOUT (-2)
+
+#define SPI_TIMEOUT_IMMEDIATE (0)
+#define SPI_TIMEOUT_INFINITE (0xFFFF)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void         spi_init(void);
+bool         spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor);
+spi_status_t spi_write(uint8_t data);
+spi_status_t spi_read(void);
+spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
+spi_status_t spi_receive(uint8_t *data, uint16_t length);
+void         spi_stop(void);
+
+// Test hooks
+
+// The sensor moves by (dx, dy) in its own coordinates, and asserts MOTION on `motion_pin`
+void spi_mock_move(pin_t motion_pin, int16_t dx, int16_t dy);
+// The sensor is lifted off the surface, and asserts MOTION on `motion_pin`
+void spi_mock_lift(pin_t motion_pin);
+// Movement the sensor makes while the next burst is read, so that MOTION is asserted again right after it
+void spi_mock_move_during_burst(int16_t dx, int16_t dy);
+// Number of times the bus was started, for any register
+uint32_t spi_mock_transactions(void);
+// Number of motion bursts read
+uint32_t spi_mock_bursts(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,10 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+POINTING_DEVICE_ENABLE = yes
+POINTING_DEVICE_DRIVER = pmw3360
+
+# The test platform has no SPI or GPIO drivers, these emulate a sensor and its motion pin instead
+SRC += \
+    gpio.c \
+    spi_master.c
@@ -0,0 +1,230 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "pointing_device.h"
+#include "gpio.h"
+#include "spi_master.h"
+}
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Invoke;
+
+// The test platform has no threads: the tests stand in for the motion interrupt and the thread servicing it
+static uint32_t backend_starts;
+static uint32_t backend_wakes;
+static int      lock_depth;
+static uint32_t lock_nesting_errors;
+static uint32_t background_sleeps;
+static bool     interrupt_on_lock;
+
+extern "C" void pmw33xx_motion_backend_start(void) {
+    backend_starts++;
+}
+
+extern "C" void pmw33xx_motion_backend_wake(void) {
+    backend_wakes++;
+}
+
+extern "C" void pmw33xx_motion_backend_lock(void) {
+    if (lock_depth++ != 0) {
+        lock_nesting_errors++;
+    }
+    if (interrupt_on_lock) {
+        interrupt_on_lock = false;
+        pmw33xx_motion_interrupt_i(0);
+    }
+}
+
+extern "C" void pmw33xx_motion_backend_unlock(void) {
+    if (--lock_depth != 0) {
+        lock_nesting_errors++;
+    }
+}
+
+extern "C" void pmw33xx_motion_backend_sleep_us(uint16_t us) {
+    background_sleeps++;
+}
+
+class Pmw33xxMotion : public TestFixture {
+   public:
+    std::vector<report_mouse_t> sent;
+
+    void SetUp() override {
+        // Motion left over from the previous test, and the bursts pmw33xx_motion_start() queued for it
+        service_all();
+        pmw33xx_motion_consume(0);
+        pmw33xx_motion_reset_stats();
+        background_sleeps = 0;
+    }
+
+    void TearDown() override {
+        EXPECT_EQ(lock_depth, 0);
+        EXPECT_EQ(lock_nesting_errors, 0);
+    }
+
+    // The interrupt handler, on the falling edge of the motion pin
+    void interrupt() {
+        pmw33xx_motion_interrupt_i(0);
+    }
+
+    // The motion thread, until it would go back to waiting for an interrupt
+    void service_all() {
+        while (pmw33xx_motion_service()) {
+        }
+    }
+
+    void expect_mouse_reports(TestDriver &driver) {
+        EXPECT_CALL(driver, send_mouse_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([this](report_mouse_t &report) { sent.push_back(report); }));
+    }
+};
+
+TEST_F(Pmw33xxMotion, StartedWithTheKeyboard) {
+    EXPECT_EQ(backend_starts, 1);
+    EXPECT_GE(backend_wakes, 1);
+}
+
+TEST_F(Pmw33xxMotion, TaskOnlyConsumesMotionReadInTheBackground) {
+    TestDriver driver;
+    expect_mouse_reports(driver);
+
+    spi_mock_move(PMW33XX_MOTION_PIN, 5, -3);
+    interrupt();
+    service_all();
+    EXPECT_EQ(pmw33xx_motion_get_stats(0).bursts, 1);
+    EXPECT_TRUE(gpio_read_pin(PMW33XX_MOTION_PIN));
+    EXPECT_EQ(background_sleeps, 1);
+
+    uint32_t transactions = spi_mock_transactions();
+    run_one_scan_loop();
+    EXPECT_EQ(spi_mock_transactions(), transactions);
+
+    ASSERT_EQ(sent.size(), 1);
+    EXPECT_EQ(sent[0].x, -5);
+    EXPECT_EQ(sent[0].y, 3);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Pmw33xxMotion, IdleSensorIsNotRead) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(0);
+
+    uint32_t transactions = spi_mock_transactions();
+    service_all();
+    idle_for(10);
+    EXPECT_EQ(spi_mock_transactions(), transactions);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Pmw33xxMotion, BurstsBeforeTheTaskRunsAreMerged) {
+    spi_mock_move(PMW33XX_MOTION_PIN, 4, 1);
+    interrupt();
+    service_all();
+    spi_mock_move(PMW33XX_MOTION_PIN, 6, 2);
+    interrupt();
+    service_all();
+
+    pmw33xx_report_t report = pmw33xx_motion_consume(0);
+    EXPECT_TRUE(report.motion.b.is_motion);
+    EXPECT_EQ(report.delta_x, -10);
+    EXPECT_EQ(report.delta_y, -3);
+
+    pmw33xx_motion_stats_t stats = pmw33xx_motion_get_stats(0);
+    EXPECT_EQ(stats.interrupts, 2);
+    EXPECT_EQ(stats.bursts, 2);
+    EXPECT_EQ(stats.merged, 1);
+    EXPECT_EQ(stats.missed, 0);
+
+    report = pmw33xx_motion_consume(0);
+    EXPECT_FALSE(report.motion.b.is_motion);
+    EXPECT_EQ(report.delta_x, 0);
+    EXPECT_EQ(report.delta_y, 0);
+}
+
+TEST_F(Pmw33xxMotion, InterruptsBeforeTheBurstAreCountedAsMissed) {
+    spi_mock_move(PMW33XX_MOTION_PIN, 1, 0);
+    interrupt();
+    spi_mock_move(PMW33XX_MOTION_PIN, 2, 0);
+    interrupt();
+
+    uint32_t bursts = spi_mock_bursts();
+    service_all();
+    EXPECT_EQ(spi_mock_bursts() - bursts, 1);
+
+    pmw33xx_motion_stats_t stats = pmw33xx_motion_get_stats(0);
+    EXPECT_EQ(stats.interrupts, 2);
+    EXPECT_EQ(stats.bursts, 1);
+    EXPECT_EQ(stats.missed, 1);
+
+    // The sensor had both movements added up by the time of the burst
+    EXPECT_EQ(pmw33xx_motion_consume(0).delta_x, -3);
+}
+
+TEST_F(Pmw33xxMotion, MotionDuringTheBurstIsReadAgain) {
+    spi_mock_move(PMW33XX_MOTION_PIN, 1, 1);
+    spi_mock_move_during_burst(2, 2);
+    interrupt();
+
+    // The motion pin never went high in between, so there was no edge to interrupt on
+    EXPECT_TRUE(pmw33xx_motion_service());
+    EXPECT_FALSE(pmw33xx_motion_service());
+    EXPECT_EQ(pmw33xx_motion_get_stats(0).bursts, 2);
+    EXPECT_EQ(pmw33xx_motion_get_stats(0).interrupts, 1);
+
+    pmw33xx_report_t report = pmw33xx_motion_consume(0);
+    EXPECT_EQ(report.delta_x, -3);
+    EXPECT_EQ(report.delta_y, -3);
+}
+
+TEST_F(Pmw33xxMotion, LargeMotionIsCarriedOver) {
+    for (int i = 0; i < 3; i++) {
+        spi_mock_move(PMW33XX_MOTION_PIN, -20000, 20000);
+        interrupt();
+        service_all();
+    }
+
+    pmw33xx_report_t report = pmw33xx_motion_consume(0);
+    EXPECT_TRUE(report.motion.b.is_motion);
+    EXPECT_EQ(report.delta_x, INT16_MAX);
+    EXPECT_EQ(report.delta_y, INT16_MIN);
+
+    report = pmw33xx_motion_consume(0);
+    EXPECT_TRUE(report.motion.b.is_motion);
+    EXPECT_EQ(report.delta_x, 60000 - INT16_MAX);
+    EXPECT_EQ(report.delta_y, -60000 - INT16_MIN);
+
+    EXPECT_FALSE(pmw33xx_motion_consume(0).motion.b.is_motion);
+}
+
+TEST_F(Pmw33xxMotion, SensorIsOnlyReadOnceSetUp) {
+    uint32_t wakes = backend_wakes;
+
+    // Motion while the sensor is being set up again, as for the second sensor from pointing_device_init_kb()
+    spi_mock_move(PMW33XX_MOTION_PIN, 7, 0);
+    interrupt_on_lock = true;
+    EXPECT_TRUE(pmw33xx_init(0));
+    EXPECT_FALSE(interrupt_on_lock);
+    EXPECT_EQ(pmw33xx_motion_get_stats(0).interrupts, 0);
+    EXPECT_EQ(backend_wakes - wakes, 1);
+
+    service_all();
+    EXPECT_EQ(pmw33xx_motion_get_stats(0).bursts, 1);
+    EXPECT_EQ(pmw33xx_motion_consume(0).delta_x, -7);
+}
+
+TEST_F(Pmw33xxMotion, LiftedSensorSendsNothing) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(0);
+
+    spi_mock_lift(PMW33XX_MOTION_PIN);
+    interrupt();
+    service_all();
+    EXPECT_EQ(pmw33xx_motion_get_stats(0).bursts, 1);
+
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define POINTING_DEVICE_HIRES_ENABLE
+#define POINTING_DEVICE_HIRES_SCALE 96
+#define POINTING_DEVICE_HIRES_ACCEL_OFFSET 4
+#define POINTING_DEVICE_HIRES_ACCEL_SLOPE 32
+#define POINTING_DEVICE_HIRES_ACCEL_LIMIT 1024
+#define POINTING_DEVICE_HIRES_SCROLL_DIVISOR_V 8
@@ -0,0 +1,121 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "pointing_device.h"
+}
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Invoke;
+
+static report_mouse_t next_motion;
+static int32_t        gain_override = -1;
+static uint16_t       last_speed;
+static uint16_t       last_gain;
+
+extern "C" void pointing_device_driver_init(void) {}
+
+extern "C" report_mouse_t pointing_device_driver_get_report(report_mouse_t mouse_report) {
+    mouse_report.x = next_motion.x;
+    mouse_report.y = next_motion.y;
+    next_motion    = {};
+    return mouse_report;
+}
+
+extern "C" uint16_t pointing_device_driver_get_cpi(void) {
+    return 0;
+}
+
+extern "C" void pointing_device_driver_set_cpi(uint16_t cpi) {}
+
+extern "C" uint16_t pointing_device_hires_gain_user(uint16_t speed, uint16_t gain) {
+    last_speed = speed;
+    last_gain  = gain;
+    return gain_override >= 0 ? gain_override : gain;
+}
+
+class PointingDeviceHires : public TestFixture {
+   public:
+    void SetUp() override {
+        // Drops whatever the previous test left over
+        pointing_device_hires_set_scrolling(true);
+        pointing_device_hires_set_scrolling(false);
+        gain_override = -1;
+    }
+
+    // Runs the pointing device task once on the given sensor counts, returning what was sent, if anything
+    report_mouse_t move(mouse_xy_report_t x, mouse_xy_report_t y) {
+        TestDriver     driver;
+        report_mouse_t sent = {};
+        EXPECT_CALL(driver, send_mouse_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([&sent](report_mouse_t &report) { sent = report; }));
+        next_motion.x = x;
+        next_motion.y = y;
+        run_one_scan_loop();
+        VERIFY_AND_CLEAR(driver);
+        return sent;
+    }
+};
+
+TEST_F(PointingDeviceHires, FractionsAreCarriedOver) {
+    // Each count is 96/256 of a count on the cursor, which on its own would always truncate to nothing
+    int total_x = 0;
+    int total_y = 0;
+    for (int i = 0; i < 8; i++) {
+        report_mouse_t report = move(1, -1);
+        EXPECT_LE(report.x, 1);
+        EXPECT_GE(report.y, -1);
+        total_x += report.x;
+        total_y += report.y;
+    }
+    EXPECT_EQ(total_x, 3);
+    EXPECT_EQ(total_y, -3);
+    EXPECT_EQ(last_gain, 96);
+}
+
+TEST_F(PointingDeviceHires, FasterMotionIsAccelerated) {
+    report_mouse_t report = move(10, 0);
+    EXPECT_EQ(last_speed, 10);
+    EXPECT_EQ(last_gain, 96 + (10 - 4) * 32);
+    EXPECT_EQ(report.x, 11);
+
+    move(10, 4);
+    EXPECT_EQ(last_speed, 12);
+
+    // Up to the limit
+    move(100, 0);
+    EXPECT_EQ(last_gain, 1024);
+}
+
+TEST_F(PointingDeviceHires, MotionBeyondTheReportIsCarriedOver) {
+    gain_override = 32 * 256;
+    EXPECT_EQ(move(10, 0).x, 127);
+    // 320 counts in all, of which only one more report's worth is kept
+    EXPECT_EQ(move(0, 0).x, 127);
+    EXPECT_EQ(move(0, 0).x, 0);
+}
+
+TEST_F(PointingDeviceHires, ScrollingIsDividedWithoutLosingMotion) {
+    pointing_device_hires_set_scrolling(true);
+    EXPECT_TRUE(pointing_device_hires_get_scrolling());
+
+    for (int i = 0; i < 2; i++) {
+        report_mouse_t report = move(3, -3);
+        EXPECT_EQ(report.h, 0);
+        EXPECT_EQ(report.v, 0);
+    }
+    report_mouse_t report = move(3, -3);
+    EXPECT_EQ(report.x, 0);
+    EXPECT_EQ(report.y, 0);
+    EXPECT_EQ(report.h, 1);
+    EXPECT_EQ(report.v, -1);
+
+    // The one count left over towards the next step is dropped along with scrolling
+    pointing_device_hires_set_scrolling(false);
+    pointing_device_hires_set_scrolling(true);
+    EXPECT_EQ(move(7, 0).h, 0);
+    EXPECT_EQ(move(1, 0).h, 1);
+}
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define POINTING_DEVICE_HIRES_ENABLE
+#define POINTING_DEVICE_ROTATION_90
+#define POINTING_DEVICE_HIRES_ROTATION_ANGLE 45
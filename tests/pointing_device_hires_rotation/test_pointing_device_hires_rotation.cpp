@@ -0,0 +1,55 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "pointing_device.h"
+}
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Invoke;
+
+static report_mouse_t next_motion;
+
+extern "C" void pointing_device_driver_init(void) {}
+
+extern "C" report_mouse_t pointing_device_driver_get_report(report_mouse_t mouse_report) {
+    mouse_report.x = next_motion.x;
+    mouse_report.y = next_motion.y;
+    next_motion    = {};
+    return mouse_report;
+}
+
+extern "C" uint16_t pointing_device_driver_get_cpi(void) {
+    return 0;
+}
+
+extern "C" void pointing_device_driver_set_cpi(uint16_t cpi) {}
+
+class PointingDeviceHiresRotation : public TestFixture {
+   public:
+    report_mouse_t move(mouse_xy_report_t x, mouse_xy_report_t y) {
+        TestDriver     driver;
+        report_mouse_t sent = {};
+        EXPECT_CALL(driver, send_mouse_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([&sent](report_mouse_t &report) { sent = report; }));
+        next_motion.x = x;
+        next_motion.y = y;
+        run_one_scan_loop();
+        VERIFY_AND_CLEAR(driver);
+        return sent;
+    }
+};
+
+TEST_F(PointingDeviceHiresRotation, AnyAngleKeepsTheFraction) {
+    // A quarter turn clockwise from POINTING_DEVICE_ROTATION_90, then 45 degrees back, 70.71 counts on each axis
+    report_mouse_t first = move(100, 0);
+    EXPECT_EQ(first.x, 70);
+    EXPECT_EQ(first.y, -70);
+
+    report_mouse_t second = move(100, 0);
+    EXPECT_EQ(first.x + second.x, 141);
+    EXPECT_EQ(first.y + second.y, -141);
+}
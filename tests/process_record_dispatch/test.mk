@@ -0,0 +1,8 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+CAPS_WORD_ENABLE = yes
+TRI_LAYER_ENABLE = yes
+SPACE_CADET_ENABLE = yes
+GRAVE_ESC_ENABLE = yes
+COMMAND_ENABLE = no
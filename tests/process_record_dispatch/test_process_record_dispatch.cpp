@@ -0,0 +1,121 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <functional>
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+namespace {
+
+bool process_record_user_default(uint16_t keycode, keyrecord_t* record) {
+    return true;
+}
+
+std::function<bool(uint16_t, keyrecord_t*)> process_record_user_fun = process_record_user_default;
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+    return process_record_user_fun(keycode, record);
+}
+
+class ProcessRecordDispatch : public TestFixture {
+   public:
+    void SetUp() override {
+        process_record_user_fun = process_record_user_default;
+    }
+};
+
+/* Handlers registered for a keycode range still run after process_record_user(), which can veto them. */
+TEST_F(ProcessRecordDispatch, UserRunsBeforeRangedHandler) {
+    TestDriver driver;
+    KeymapKey  key_gesc = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+    set_keymap({key_gesc});
+
+    int user_calls          = 0;
+    process_record_user_fun = [&](uint16_t keycode, keyrecord_t* record) {
+        EXPECT_EQ(keycode, QK_GRAVE_ESCAPE);
+        user_calls++;
+        return false;
+    };
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_gesc);
+    EXPECT_EQ(user_calls, 2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, RangedHandlerHandlesItsKeycode) {
+    TestDriver driver;
+    KeymapKey  key_gesc = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+    set_keymap({key_gesc});
+
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_gesc);
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* The user hook sees a tri layer key before the tri layer handler changes the layer state. */
+TEST_F(ProcessRecordDispatch, RangedHandlerRunsAfterUserHook) {
+    TestDriver driver;
+    KeymapKey  key_lower = KeymapKey(0, 0, 0, QK_TRI_LAYER_LOWER);
+    set_keymap({key_lower, KeymapKey(1, 0, 0, KC_TRNS)});
+
+    std::vector<bool> lower_on_in_user;
+    process_record_user_fun = [&](uint16_t keycode, keyrecord_t* record) {
+        lower_on_in_user.push_back(layer_state_is(get_tri_layer_lower_layer()));
+        return true;
+    };
+
+    EXPECT_NO_REPORT(driver);
+    key_lower.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_is(get_tri_layer_lower_layer()));
+    key_lower.release();
+    run_one_scan_loop();
+    EXPECT_FALSE(layer_state_is(get_tri_layer_lower_layer()));
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(lower_on_in_user, (std::vector<bool>{false, true}));
+}
+
+/* Handlers registered for all keycodes still see keys outside of their own range. */
+TEST_F(ProcessRecordDispatch, AllKeycodeHandlerSeesOtherKeys) {
+    TestDriver driver;
+    KeymapKey  key_lspo = KeymapKey(0, 0, 0, SC_LSPO);
+    KeymapKey  key_a    = KeymapKey(0, 1, 0, KC_A);
+    set_keymap({key_lspo, key_a});
+
+    /* Pressing another key cancels the space cadet parenthesis. */
+    InSequence s;
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    key_lspo.press();
+    run_one_scan_loop();
+    tap_key(key_a);
+    key_lspo.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ProcessRecordDispatch, CapsWordSeesBasicKeycodes) {
+    TestDriver driver;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LSFT)).Times(AnyNumber());
+    EXPECT_EMPTY_REPORT(driver).Times(AnyNumber());
+    caps_word_on();
+    tap_key(key_a);
+    caps_word_off();
+    VERIFY_AND_CLEAR(driver);
+}
+
+} // namespace
@@ -0,0 +1,8 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = is31fl3731
+
+# Test builds leave out QUANTUM_LIB_SRC, which is where the I2C driver is normally added
+SRC += $(PLATFORM_PATH)/test/drivers/i2c_master.c
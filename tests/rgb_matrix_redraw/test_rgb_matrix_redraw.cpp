@@ -0,0 +1,110 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "i2c_master.h"
+#include "rgb_matrix.h"
+}
+
+// One LED in each of the first four 16 byte PWM register transfers
+const is31fl3731_led_t PROGMEM g_is31fl3731_leds[RGB_MATRIX_LED_COUNT] = {
+    {0, 0x00, 0x01, 0x02},
+    {0, 0x10, 0x11, 0x12},
+    {0, 0x20, 0x21, 0x22},
+    {0, 0x30, 0x31, 0x32},
+};
+
+led_config_t g_led_config = {
+    {{0, 1, 2, 3}},
+    {{0, 0}, {75, 0}, {150, 0}, {224, 0}},
+    {LED_FLAG_ALL, LED_FLAG_ALL, LED_FLAG_ALL, LED_FLAG_ALL},
+};
+
+static uint32_t conversions      = 0;
+static bool     indicator_active = false;
+
+extern "C" RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
+    conversions++;
+    return hsv_to_rgb(hsv);
+}
+
+extern "C" bool rgb_matrix_indicators_user(void) {
+    if (indicator_active) {
+        rgb_matrix_set_color(2, 255, 0, 0);
+    }
+    return true;
+}
+
+class RgbMatrixRedraw : public TestFixture {
+   public:
+    void SetUp() override {
+        TestDriver driver;
+        indicator_active = false;
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        rgb_matrix_sethsv_noeeprom(HSV_BLUE);
+        // Settle on a steady frame before anything is counted
+        idle_for(FRAMES);
+        start_counting();
+    }
+
+    void start_counting() {
+        conversions = 0;
+        i2c_test_clear_writes();
+    }
+
+    // PWM register transfers of the block holding the LED, see g_is31fl3731_leds
+    uint16_t block_writes(uint8_t led) {
+        return i2c_test_count_writes(IS31FL3731_FRAME_REG_PWM + led * 16, 16);
+    }
+
+    // Several complete frames, each one rendered and flushed
+    static const uint32_t FRAMES = RGB_MATRIX_LED_FLUSH_LIMIT * 5;
+};
+
+TEST_F(RgbMatrixRedraw, StaticEffectIsNotRenderedAgain) {
+    TestDriver driver;
+    idle_for(FRAMES);
+    EXPECT_EQ(conversions, 0);
+    for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+        EXPECT_EQ(block_writes(led), 0) << "LED " << +led;
+    }
+}
+
+TEST_F(RgbMatrixRedraw, SettingsChangeRendersAgain) {
+    TestDriver driver;
+    rgb_matrix_sethsv_noeeprom(HSV_GREEN);
+    idle_for(FRAMES);
+    EXPECT_GT(conversions, 0);
+    for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+        EXPECT_EQ(block_writes(led), 1) << "LED " << +led;
+    }
+
+    start_counting();
+    idle_for(FRAMES);
+    EXPECT_EQ(conversions, 0);
+}
+
+TEST_F(RgbMatrixRedraw, OnlyChangedBlocksAreSent) {
+    TestDriver driver;
+    indicator_active = true;
+    idle_for(FRAMES);
+    EXPECT_GT(block_writes(2), 0);
+    EXPECT_EQ(block_writes(0), 0);
+    EXPECT_EQ(block_writes(1), 0);
+    EXPECT_EQ(block_writes(3), 0);
+
+    // Back to the plain effect, which is rendered once more to cover the indicator
+    indicator_active = false;
+    start_counting();
+    idle_for(FRAMES);
+    EXPECT_EQ(block_writes(2), 1);
+    EXPECT_EQ(block_writes(0), 0);
+
+    start_counting();
+    idle_for(FRAMES);
+    EXPECT_EQ(conversions, 0);
+    EXPECT_EQ(block_writes(2), 0);
+}
@@ -0,0 +1,162 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "task_profiler.h"
+}
+
+using testing::_;
+
+class TaskProfiler : public TestFixture {
+   protected:
+    void SetUp() override {
+        task_profiler_reset();
+    }
+
+    static uint32_t read_u32_be(const uint8_t *data) {
+        return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+    }
+};
+
+TEST_F(TaskProfiler, SummaryStatistics) {
+    for (int i = 0; i < 99; i++) {
+        task_profiler_record(TASK_PROFILER_HOUSEKEEPING, 10);
+    }
+    task_profiler_record(TASK_PROFILER_HOUSEKEEPING, 1000);
+
+    task_profiler_summary_t summary;
+    ASSERT_TRUE(task_profiler_get_summary(TASK_PROFILER_HOUSEKEEPING, &summary));
+    EXPECT_EQ(summary.count, 100);
+    EXPECT_EQ(summary.min, 10);
+    EXPECT_EQ(summary.avg, 19);
+    EXPECT_EQ(summary.max, 1000);
+    /* 10 lands in the 8-11 bucket, the single outlier is above the 99th percentile */
+    EXPECT_EQ(summary.p99, 11);
+}
+
+TEST_F(TaskProfiler, PercentileFollowsTail) {
+    for (int i = 0; i < 90; i++) {
+        task_profiler_record(TASK_PROFILER_HOUSEKEEPING, 3);
+    }
+    for (int i = 0; i < 10; i++) {
+        task_profiler_record(TASK_PROFILER_HOUSEKEEPING, 200);
+    }
+
+    task_profiler_summary_t summary;
+    ASSERT_TRUE(task_profiler_get_summary(TASK_PROFILER_HOUSEKEEPING, &summary));
+    EXPECT_EQ(summary.p99, 200);
+}
+
+TEST_F(TaskProfiler, SaturatedHistogramIsAged) {
+    for (uint32_t i = 0; i < 100000; i++) {
+        task_profiler_record(TASK_PROFILER_HOUSEKEEPING, 3);
+    }
+    task_profiler_record(TASK_PROFILER_HOUSEKEEPING, 5);
+
+    task_profiler_summary_t summary;
+    ASSERT_TRUE(task_profiler_get_summary(TASK_PROFILER_HOUSEKEEPING, &summary));
+    EXPECT_EQ(summary.count, 100001);
+    EXPECT_EQ(summary.min, 3);
+    EXPECT_EQ(summary.max, 5);
+    EXPECT_EQ(summary.p99, 3);
+}
+
+TEST_F(TaskProfiler, EmptyAndInvalidTasks) {
+    task_profiler_summary_t summary;
+    ASSERT_TRUE(task_profiler_get_summary(TASK_PROFILER_MATRIX, &summary));
+    EXPECT_EQ(summary.count, 0);
+    EXPECT_EQ(summary.max, 0);
+
+    EXPECT_FALSE(task_profiler_get_summary(TASK_PROFILER_COUNT, &summary));
+    EXPECT_EQ(task_profiler_task_name(TASK_PROFILER_COUNT), nullptr);
+    EXPECT_STREQ(task_profiler_task_name(TASK_PROFILER_MATRIX), "matrix");
+}
+
+TEST_F(TaskProfiler, KeyboardTasksAreRecorded) {
+    TestDriver driver;
+    KeymapKey  regular_key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({regular_key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    task_profiler_reset();
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+
+    task_profiler_summary_t matrix;
+    task_profiler_summary_t led;
+    task_profiler_get_summary(TASK_PROFILER_MATRIX, &matrix);
+    task_profiler_get_summary(TASK_PROFILER_LED, &led);
+    EXPECT_EQ(matrix.count, 2);
+    EXPECT_EQ(led.count, 2);
+    EXPECT_LE(matrix.min, matrix.avg);
+    EXPECT_LE(matrix.avg, matrix.max);
+    EXPECT_LE(matrix.p99, matrix.max);
+}
+
+TEST_F(TaskProfiler, HostClock) {
+    EXPECT_EQ(task_profiler_tick_frequency(), 1000000000UL);
+
+    uint32_t start = task_profiler_ticks();
+    uint32_t end   = start;
+    for (int i = 0; i < 1000000 && end == start; i++) {
+        end = task_profiler_ticks();
+    }
+    EXPECT_NE(end, start);
+}
+
+TEST_F(TaskProfiler, RawHidInfo) {
+    uint8_t data[32] = {TASK_PROFILER_RAW_HID_COMMAND_ID, 0x01};
+    ASSERT_TRUE(task_profiler_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[0], TASK_PROFILER_RAW_HID_COMMAND_ID);
+    EXPECT_EQ(data[1], 0x01);
+    EXPECT_EQ(data[2], TASK_PROFILER_COUNT);
+    EXPECT_EQ(read_u32_be(&data[3]), 1000000000UL);
+}
+
+TEST_F(TaskProfiler, RawHidSummary) {
+    task_profiler_record(TASK_PROFILER_MATRIX, 10);
+    task_profiler_record(TASK_PROFILER_MATRIX, 30);
+
+    uint8_t data[32] = {TASK_PROFILER_RAW_HID_COMMAND_ID, 0x02, TASK_PROFILER_MATRIX};
+    ASSERT_TRUE(task_profiler_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[1], 0x02);
+    EXPECT_EQ(data[2], TASK_PROFILER_MATRIX);
+    EXPECT_EQ(read_u32_be(&data[3]), 2);
+    EXPECT_EQ(read_u32_be(&data[7]), 10);
+    EXPECT_EQ(read_u32_be(&data[11]), 20);
+    EXPECT_EQ(read_u32_be(&data[15]), 30);
+    EXPECT_EQ(read_u32_be(&data[19]), 30);
+    EXPECT_STREQ((const char *)&data[23], "matrix");
+}
+
+TEST_F(TaskProfiler, RawHidReset) {
+    task_profiler_record(TASK_PROFILER_MATRIX, 10);
+
+    uint8_t data[32] = {TASK_PROFILER_RAW_HID_COMMAND_ID, 0x03};
+    ASSERT_TRUE(task_profiler_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[1], 0x03);
+
+    task_profiler_summary_t summary;
+    task_profiler_get_summary(TASK_PROFILER_MATRIX, &summary);
+    EXPECT_EQ(summary.count, 0);
+}
+
+TEST_F(TaskProfiler, RawHidRejectsOtherPackets) {
+    uint8_t data[32] = {0x01, 0x02, 0x03};
+    EXPECT_FALSE(task_profiler_raw_hid_receive(data, sizeof(data)));
+    EXPECT_EQ(data[0], 0x01);
+    EXPECT_EQ(data[1], 0x02);
+    EXPECT_EQ(data[2], 0x03);
+
+    uint8_t bad_command[32] = {TASK_PROFILER_RAW_HID_COMMAND_ID, 0x7F};
+    ASSERT_TRUE(task_profiler_raw_hid_receive(bad_command, sizeof(bad_command)));
+    EXPECT_EQ(bad_command[1], 0xFF);
+
+    uint8_t bad_task[32] = {TASK_PROFILER_RAW_HID_COMMAND_ID, 0x02, TASK_PROFILER_COUNT};
+    ASSERT_TRUE(task_profiler_raw_hid_receive(bad_task, sizeof(bad_task)));
+    EXPECT_EQ(bad_task[1], 0xFF);
+}
@@ -100,6 +100,9 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+#ifdef LAYER_CACHE_ENABLE
+    layer_cache_invalidate();
+#endif
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {
@@ -127,6 +130,9 @@ void TestFixture::tap_combo(const std::vector<KeymapKey>& chord_keys, unsigned d
 
 void TestFixture::set_keymap(std::initializer_list<KeymapKey> keys) {
     this->keymap.clear();
+#ifdef LAYER_CACHE_ENABLE
+    layer_cache_invalidate();
+#endif
     for (auto& key : keys) {
         add_key(key);
     }
@@ -17,6 +17,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "samd51j18a.h"
 #include "keyboard.h"
+#include "task_profiler.h"
 
 #include "report.h"
 #include "host.h"
@@ -342,7 +343,7 @@ int main(void) {
             continue;
         }
 
-        keyboard_task();
+        TASK_PROFILE(KEYBOARD, keyboard_task());
 
 #ifdef CONSOLE_ENABLE
         if (timer_read64() > next_print) {
@@ -354,11 +355,16 @@ int main(void) {
 
 #ifdef DEFERRED_EXEC_ENABLE
         // Run deferred executions
-        deferred_exec_task();
+        TASK_PROFILE(DEFERRED_EXEC, deferred_exec_task());
 #endif // DEFERRED_EXEC_ENABLE
 
         // Run housekeeping
-        housekeeping_task();
+        TASK_PROFILE(HOUSEKEEPING, housekeeping_task());
+
+#ifdef KEYBOARD_IDLE_ENABLE
+        // Sleep until the next task deadline
+        keyboard_idle_task();
+#endif
     }
 
     return 1;
@@ -21,6 +21,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "host.h"
 #include "util.h"
 #include "debug.h"
+#include "timer.h"
+#include <string.h>
 
 #ifdef DIGITIZER_ENABLE
 #    include "digitizer.h"
@@ -40,9 +42,31 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 extern keymap_config_t keymap_config;
 #endif
 
-static host_driver_t *driver;
-static uint16_t       last_system_usage   = 0;
-static uint16_t       last_consumer_usage = 0;
+static host_driver_t         *driver;
+static uint16_t               last_system_usage   = 0;
+static uint16_t               last_consumer_usage = 0;
+static host_report_counters_t report_counters[HOST_REPORT_TYPE_COUNT];
+
+#ifdef HOST_COALESCE_REPORTS
+static report_keyboard_t keyboard_sent;
+static report_keyboard_t keyboard_pending;
+static bool              keyboard_pending_valid = false;
+static uint16_t          keyboard_sent_time     = 0;
+#    ifdef NKRO_ENABLE
+static report_nkro_t nkro_sent;
+static report_nkro_t nkro_pending;
+static bool          nkro_pending_valid = false;
+static uint16_t      nkro_sent_time     = 0;
+#    endif
+static report_mouse_t mouse_pending;
+static bool           mouse_pending_valid = false;
+static uint8_t        mouse_sent_buttons  = 0;
+static uint16_t       mouse_sent_time     = 0;
+
+static void keyboard_flush(void);
+static void nkro_flush(void);
+static void mouse_flush(void);
+#endif
 
 void host_set_driver(host_driver_t *d) {
     driver = d;
@@ -72,6 +96,63 @@ led_t host_keyboard_led_state(void) {
 }
 
 /* send report */
+static void keyboard_send_now(report_keyboard_t *report) {
+    (*driver->send_keyboard)(report);
+    report_counters[HOST_REPORT_KEYBOARD].sent++;
+#ifdef HOST_COALESCE_REPORTS
+    memcpy(&keyboard_sent, report, sizeof(report_keyboard_t));
+    keyboard_sent_time = timer_read();
+#endif
+
+    if (debug_keyboard) {
+        dprintf("keyboard_report: %02X | ", report->mods);
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            dprintf("%02X ", report->keys[i]);
+        }
+        dprint("\n");
+    }
+}
+
+#ifdef HOST_COALESCE_REPORTS
+static bool keyboard_report_has_key(const report_keyboard_t *report, uint8_t key) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report->keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** \brief Checks if going straight from the sent report to the next one would hide a change the pending report makes
+ *
+ * A key pressed by the pending report and released again by the next one (or the other way around) would never reach
+ * the host if the pending report was simply replaced.
+ */
+static bool keyboard_report_reverts(const report_keyboard_t *sent, const report_keyboard_t *pending, const report_keyboard_t *next) {
+    if ((sent->mods ^ pending->mods) & (pending->mods ^ next->mods)) {
+        return true;
+    }
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t pressed = pending->keys[i];
+        if (pressed && !keyboard_report_has_key(sent, pressed) && !keyboard_report_has_key(next, pressed)) {
+            return true;
+        }
+        uint8_t released = sent->keys[i];
+        if (released && !keyboard_report_has_key(pending, released) && keyboard_report_has_key(next, released)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void keyboard_flush(void) {
+    if (keyboard_pending_valid) {
+        keyboard_pending_valid = false;
+        keyboard_send_now(&keyboard_pending);
+    }
+}
+#endif
+
 void host_keyboard_send(report_keyboard_t *report) {
 #ifdef BLUETOOTH_ENABLE
     if (where_to_send() == OUTPUT_BLUETOOTH) {
@@ -84,21 +165,37 @@ void host_keyboard_send(report_keyboard_t *report) {
 #ifdef KEYBOARD_SHARED_EP
     report->report_id = REPORT_ID_KEYBOARD;
 #endif
-    (*driver->send_keyboard)(report);
 
-    if (debug_keyboard) {
-        dprintf("keyboard_report: %02X | ", report->mods);
-        for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
-            dprintf("%02X ", report->keys[i]);
+#ifdef HOST_COALESCE_REPORTS
+    nkro_flush();
+    mouse_flush();
+    if (keyboard_pending_valid) {
+        if (!keyboard_report_reverts(&keyboard_sent, &keyboard_pending, report)) {
+            memcpy(&keyboard_pending, report, sizeof(report_keyboard_t));
+            report_counters[HOST_REPORT_KEYBOARD].suppressed++;
+            return;
         }
-        dprint("\n");
+        keyboard_flush();
+    } else if (memcmp(report, &keyboard_sent, sizeof(report_keyboard_t)) == 0) {
+        report_counters[HOST_REPORT_KEYBOARD].suppressed++;
+        return;
+    }
+    if (timer_elapsed(keyboard_sent_time) < HOST_COALESCE_INTERVAL) {
+        memcpy(&keyboard_pending, report, sizeof(report_keyboard_t));
+        keyboard_pending_valid = true;
+        return;
     }
+#endif
+    keyboard_send_now(report);
 }
 
-void host_nkro_send(report_nkro_t *report) {
-    if (!driver) return;
-    report->report_id = REPORT_ID_NKRO;
+static void nkro_send_now(report_nkro_t *report) {
     (*driver->send_nkro)(report);
+    report_counters[HOST_REPORT_KEYBOARD].sent++;
+#if defined(HOST_COALESCE_REPORTS) && defined(NKRO_ENABLE)
+    memcpy(&nkro_sent, report, sizeof(report_nkro_t));
+    nkro_sent_time = timer_read();
+#endif
 
     if (debug_keyboard) {
         dprintf("nkro_report: %02X | ", report->mods);
@@ -109,6 +206,110 @@ void host_nkro_send(report_nkro_t *report) {
     }
 }
 
+#ifdef HOST_COALESCE_REPORTS
+#    ifdef NKRO_ENABLE
+/** \brief NKRO counterpart of keyboard_report_reverts() */
+static bool nkro_report_reverts(const report_nkro_t *sent, const report_nkro_t *pending, const report_nkro_t *next) {
+    if ((sent->mods ^ pending->mods) & (pending->mods ^ next->mods)) {
+        return true;
+    }
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        if ((sent->bits[i] ^ pending->bits[i]) & (pending->bits[i] ^ next->bits[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+#    endif
+
+static void nkro_flush(void) {
+#    ifdef NKRO_ENABLE
+    if (nkro_pending_valid) {
+        nkro_pending_valid = false;
+        nkro_send_now(&nkro_pending);
+    }
+#    endif
+}
+#endif
+
+void host_nkro_send(report_nkro_t *report) {
+    if (!driver) return;
+    report->report_id = REPORT_ID_NKRO;
+
+#if defined(HOST_COALESCE_REPORTS) && defined(NKRO_ENABLE)
+    keyboard_flush();
+    mouse_flush();
+    if (nkro_pending_valid) {
+        if (!nkro_report_reverts(&nkro_sent, &nkro_pending, report)) {
+            memcpy(&nkro_pending, report, sizeof(report_nkro_t));
+            report_counters[HOST_REPORT_KEYBOARD].suppressed++;
+            return;
+        }
+        nkro_flush();
+    } else if (memcmp(report, &nkro_sent, sizeof(report_nkro_t)) == 0) {
+        report_counters[HOST_REPORT_KEYBOARD].suppressed++;
+        return;
+    }
+    if (timer_elapsed(nkro_sent_time) < HOST_COALESCE_INTERVAL) {
+        memcpy(&nkro_pending, report, sizeof(report_nkro_t));
+        nkro_pending_valid = true;
+        return;
+    }
+#endif
+    nkro_send_now(report);
+}
+
+static void mouse_send_now(report_mouse_t *report) {
+#ifdef MOUSE_EXTENDED_REPORT
+    // clip and copy to Boot protocol XY
+    report->boot_x = (report->x > 127) ? 127 : ((report->x < -127) ? -127 : report->x);
+    report->boot_y = (report->y > 127) ? 127 : ((report->y < -127) ? -127 : report->y);
+#endif
+    (*driver->send_mouse)(report);
+    report_counters[HOST_REPORT_MOUSE].sent++;
+#ifdef HOST_COALESCE_REPORTS
+    mouse_sent_buttons = report->buttons;
+    mouse_sent_time    = timer_read();
+#endif
+}
+
+#ifdef HOST_COALESCE_REPORTS
+#    ifdef MOUSE_EXTENDED_REPORT
+#        define MOUSE_REPORT_XY_MIN INT16_MIN
+#        define MOUSE_REPORT_XY_MAX INT16_MAX
+#    else
+#        define MOUSE_REPORT_XY_MIN INT8_MIN
+#        define MOUSE_REPORT_XY_MAX INT8_MAX
+#    endif
+
+static bool mouse_report_moves(const report_mouse_t *report) {
+    return report->x || report->y || report->v || report->h;
+}
+
+/** \brief Adds the movement of a mouse report to another, as long as the sum fits in a report */
+static bool mouse_report_accumulate(report_mouse_t *into, const report_mouse_t *report) {
+    int32_t x = into->x + report->x;
+    int32_t y = into->y + report->y;
+    int16_t v = into->v + report->v;
+    int16_t h = into->h + report->h;
+    if (x < MOUSE_REPORT_XY_MIN || x > MOUSE_REPORT_XY_MAX || y < MOUSE_REPORT_XY_MIN || y > MOUSE_REPORT_XY_MAX || v < INT8_MIN || v > INT8_MAX || h < INT8_MIN || h > INT8_MAX) {
+        return false;
+    }
+    into->x = x;
+    into->y = y;
+    into->v = v;
+    into->h = h;
+    return true;
+}
+
+static void mouse_flush(void) {
+    if (mouse_pending_valid) {
+        mouse_pending_valid = false;
+        mouse_send_now(&mouse_pending);
+    }
+}
+#endif
+
 void host_mouse_send(report_mouse_t *report) {
 #ifdef BLUETOOTH_ENABLE
     if (where_to_send() == OUTPUT_BLUETOOTH) {
@@ -121,29 +322,55 @@ void host_mouse_send(report_mouse_t *report) {
 #ifdef MOUSE_SHARED_EP
     report->report_id = REPORT_ID_MOUSE;
 #endif
-#ifdef MOUSE_EXTENDED_REPORT
-    // clip and copy to Boot protocol XY
-    report->boot_x = (report->x > 127) ? 127 : ((report->x < -127) ? -127 : report->x);
-    report->boot_y = (report->y > 127) ? 127 : ((report->y < -127) ? -127 : report->y);
+
+#ifdef HOST_COALESCE_REPORTS
+    keyboard_flush();
+    nkro_flush();
+    if (mouse_pending_valid) {
+        // Only pure movement is merged, button changes keep their place relative to the movement around them
+        if (mouse_pending.buttons == mouse_sent_buttons && report->buttons == mouse_sent_buttons && mouse_report_accumulate(&mouse_pending, report)) {
+            report_counters[HOST_REPORT_MOUSE].suppressed++;
+            return;
+        }
+        mouse_flush();
+    } else if (report->buttons == mouse_sent_buttons && !mouse_report_moves(report)) {
+        report_counters[HOST_REPORT_MOUSE].suppressed++;
+        return;
+    }
+    if (timer_elapsed(mouse_sent_time) < HOST_COALESCE_INTERVAL) {
+        memcpy(&mouse_pending, report, sizeof(report_mouse_t));
+        mouse_pending_valid = true;
+        return;
+    }
 #endif
-    (*driver->send_mouse)(report);
+    mouse_send_now(report);
 }
 
 void host_system_send(uint16_t usage) {
-    if (usage == last_system_usage) return;
+    if (usage == last_system_usage) {
+        report_counters[HOST_REPORT_EXTRA].suppressed++;
+        return;
+    }
     last_system_usage = usage;
 
     if (!driver) return;
+#ifdef HOST_COALESCE_REPORTS
+    host_flush_reports();
+#endif
 
     report_extra_t report = {
         .report_id = REPORT_ID_SYSTEM,
         .usage     = usage,
     };
     (*driver->send_extra)(&report);
+    report_counters[HOST_REPORT_EXTRA].sent++;
 }
 
 void host_consumer_send(uint16_t usage) {
-    if (usage == last_consumer_usage) return;
+    if (usage == last_consumer_usage) {
+        report_counters[HOST_REPORT_EXTRA].suppressed++;
+        return;
+    }
     last_consumer_usage = usage;
 
 #ifdef BLUETOOTH_ENABLE
@@ -154,12 +381,16 @@ void host_consumer_send(uint16_t usage) {
 #endif
 
     if (!driver) return;
+#ifdef HOST_COALESCE_REPORTS
+    host_flush_reports();
+#endif
 
     report_extra_t report = {
         .report_id = REPORT_ID_CONSUMER,
         .usage     = usage,
     };
     (*driver->send_extra)(&report);
+    report_counters[HOST_REPORT_EXTRA].sent++;
 }
 
 #ifdef JOYSTICK_ENABLE
@@ -256,3 +487,70 @@ uint16_t host_last_system_usage(void) {
 uint16_t host_last_consumer_usage(void) {
     return last_consumer_usage;
 }
+
+/** \brief Sends any report held back for coalescing right away */
+void host_flush_reports(void) {
+#ifdef HOST_COALESCE_REPORTS
+    keyboard_flush();
+    nkro_flush();
+    mouse_flush();
+#endif
+}
+
+/** \brief Checks if a report is held back for coalescing */
+bool host_reports_pending(void) {
+#ifdef HOST_COALESCE_REPORTS
+    bool pending = keyboard_pending_valid || mouse_pending_valid;
+#    ifdef NKRO_ENABLE
+    pending |= nkro_pending_valid;
+#    endif
+    return pending;
+#else
+    return false;
+#endif
+}
+
+#if defined(HOST_COALESCE_REPORTS) && defined(KEYBOARD_IDLE_ENABLE)
+/** \brief Asks the main loop to come back when a held report is due */
+static void host_idle_request(bool pending, uint16_t sent_time) {
+    if (pending) {
+        keyboard_idle_request(HOST_COALESCE_INTERVAL - MIN(timer_elapsed(sent_time), HOST_COALESCE_INTERVAL));
+    }
+}
+#endif
+
+/** \brief Sends reports held back for coalescing once their polling interval has passed */
+void host_task(void) {
+#ifdef HOST_COALESCE_REPORTS
+    if (keyboard_pending_valid && timer_elapsed(keyboard_sent_time) >= HOST_COALESCE_INTERVAL) {
+        keyboard_flush();
+    }
+#    ifdef NKRO_ENABLE
+    if (nkro_pending_valid && timer_elapsed(nkro_sent_time) >= HOST_COALESCE_INTERVAL) {
+        nkro_flush();
+    }
+#    endif
+    if (mouse_pending_valid && timer_elapsed(mouse_sent_time) >= HOST_COALESCE_INTERVAL) {
+        mouse_flush();
+    }
+#    ifdef KEYBOARD_IDLE_ENABLE
+    host_idle_request(keyboard_pending_valid, keyboard_sent_time);
+#        ifdef NKRO_ENABLE
+    host_idle_request(nkro_pending_valid, nkro_sent_time);
+#        endif
+    host_idle_request(mouse_pending_valid, mouse_sent_time);
+#    endif
+#endif
+}
+
+bool host_get_report_counters(uint8_t type, host_report_counters_t *counters) {
+    if (type >= HOST_REPORT_TYPE_COUNT) {
+        return false;
+    }
+    memcpy(counters, &report_counters[type], sizeof(host_report_counters_t));
+    return true;
+}
+
+void host_reset_report_counters(void) {
+    memset(report_counters, 0, sizeof(report_counters));
+}
@@ -30,6 +30,28 @@ extern "C" {
 extern uint8_t keyboard_idle;
 extern uint8_t keyboard_protocol;
 
+#ifdef HOST_COALESCE_REPORTS
+#    ifndef HOST_COALESCE_INTERVAL
+#        ifdef USB_POLLING_INTERVAL_MS
+#            define HOST_COALESCE_INTERVAL USB_POLLING_INTERVAL_MS
+#        else
+#            define HOST_COALESCE_INTERVAL 1
+#        endif
+#    endif
+#endif
+
+enum host_report_type {
+    HOST_REPORT_KEYBOARD = 0,
+    HOST_REPORT_MOUSE,
+    HOST_REPORT_EXTRA,
+    HOST_REPORT_TYPE_COUNT,
+};
+
+typedef struct host_report_counters_t {
+    uint32_t sent;       // reports handed to the host driver
+    uint32_t suppressed; // duplicates dropped and reports merged into a later one
+} host_report_counters_t;
+
 /* host driver */
 void           host_set_driver(host_driver_t *driver);
 host_driver_t *host_get_driver(void);
@@ -47,6 +69,13 @@ void    host_programmable_button_send(uint32_t data);
 uint16_t host_last_system_usage(void);
 uint16_t host_last_consumer_usage(void);
 
+/* report coalescing */
+void host_task(void);
+void host_flush_reports(void);
+bool host_reports_pending(void);
+bool host_get_report_counters(uint8_t type, host_report_counters_t *counters);
+void host_reset_report_counters(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -32,24 +32,114 @@ static int8_t cb_tail  = 0;
 static int8_t cb_count = 0;
 #endif
 
-/** \brief has_anykey
- *
- * FIXME: Needs doc
+/*
+ * Keys currently in the report, as a bitmap indexed by keycode. This answers is_key_pressed() and has_anykey() without
+ * scanning the report, and is copied into the NKRO report when it is sent. The 6KRO report keeps the key order itself,
+ * as the slot a key ends up in depends on what else was pressed before it.
  */
-uint8_t has_anykey(void) {
-    uint8_t  cnt = 0;
-    uint8_t* p   = keyboard_report->keys;
-    uint8_t  lp  = sizeof(keyboard_report->keys);
+static uint8_t report_keys[32];
+static uint8_t report_key_count = 0;
+#ifndef RING_BUFFERED_6KRO_REPORT_ENABLE
+static uint8_t report_free_slots = (1 << KEYBOARD_REPORT_KEYS) - 1;
+#endif
 #ifdef NKRO_ENABLE
-    if (keyboard_protocol && keymap_config.nkro) {
-        p  = nkro_report->bits;
-        lp = sizeof(nkro_report->bits);
+static bool report_nkro_active = false;
+#endif
+
+static inline bool report_key_test(uint8_t code) {
+    return report_keys[code >> 3] & (1 << (code & 7));
+}
+
+static inline void report_key_set(uint8_t code) {
+    report_keys[code >> 3] |= 1 << (code & 7);
+    report_key_count++;
+}
+
+static inline void report_key_clear(uint8_t code) {
+    report_keys[code >> 3] &= ~(1 << (code & 7));
+    report_key_count--;
+}
+
+static void report_6kro_reset(void) {
+    memset(keyboard_report->keys, 0, sizeof(keyboard_report->keys));
+#ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
+    cb_head  = 0;
+    cb_tail  = 0;
+    cb_count = 0;
+#else
+    report_free_slots = (1 << KEYBOARD_REPORT_KEYS) - 1;
+#endif
+}
+
+static void report_6kro_add(uint8_t code) {
+#ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
+    if (cb_count == KEYBOARD_REPORT_KEYS) {
+        // The oldest key is about to be rolled over
+        report_key_clear(keyboard_report->keys[cb_head]);
     }
+    add_key_byte(keyboard_report, code);
+    report_key_set(code);
+#else
+    // Same as add_key_byte(): first free slot, or dropped when the report is full
+    if (report_free_slots == 0) {
+        return;
+    }
+    uint8_t slot                = __builtin_ctz(report_free_slots);
+    keyboard_report->keys[slot] = code;
+    report_free_slots &= ~(1 << slot);
+    report_key_set(code);
 #endif
-    while (lp--) {
-        if (*p++) cnt++;
+}
+
+static void report_6kro_del(uint8_t code) {
+#ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
+    del_key_byte(keyboard_report, code);
+#else
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keyboard_report->keys[i] == code) {
+            keyboard_report->keys[i] = 0;
+            report_free_slots |= 1 << i;
+            break;
+        }
+    }
+#endif
+    report_key_clear(code);
+}
+
+/** \brief Moves the pressed keys over when the host switches between 6KRO and NKRO */
+static void report_sync_protocol(void) {
+#ifdef NKRO_ENABLE
+    bool nkro = keyboard_protocol && keymap_config.nkro;
+    if (nkro == report_nkro_active) {
+        return;
+    }
+    report_nkro_active = nkro;
+
+    uint8_t keys[sizeof(report_keys)];
+    memcpy(keys, report_keys, sizeof(keys));
+    memset(report_keys, 0, sizeof(report_keys));
+    report_key_count = 0;
+    report_6kro_reset();
+    for (uint16_t code = 1; code < sizeof(keys) * 8; code++) {
+        if (!(keys[code >> 3] & (1 << (code & 7)))) {
+            continue;
+        }
+        if (!nkro) {
+            report_6kro_add(code);
+        } else if ((code >> 3) < NKRO_REPORT_BITS) {
+            report_key_set(code);
+        }
     }
-    return cnt;
+#endif
+}
+
+/** \brief has_anykey
+ *
+ * Returns the number of keys in the report, not counting modifiers.
+ */
+uint8_t has_anykey(void) {
+    report_sync_protocol();
+    return report_key_count;
 }
 
 /** \brief get_first_key
@@ -57,12 +147,15 @@ uint8_t has_anykey(void) {
  * FIXME: Needs doc
  */
 uint8_t get_first_key(void) {
+    report_sync_protocol();
 #ifdef NKRO_ENABLE
-    if (keyboard_protocol && keymap_config.nkro) {
-        uint8_t i = 0;
-        for (; i < NKRO_REPORT_BITS && !nkro_report->bits[i]; i++)
-            ;
-        return i << 3 | biton(nkro_report->bits[i]);
+    if (report_nkro_active) {
+        for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+            if (report_keys[i]) {
+                return i << 3 | biton(report_keys[i]);
+            }
+        }
+        return KC_NO;
     }
 #endif
 #ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
@@ -88,21 +181,8 @@ bool is_key_pressed(uint8_t key) {
     if (key == KC_NO) {
         return false;
     }
-#ifdef NKRO_ENABLE
-    if (keyboard_protocol && keymap_config.nkro) {
-        if ((key >> 3) < NKRO_REPORT_BITS) {
-            return nkro_report->bits[key >> 3] & 1 << (key & 7);
-        } else {
-            return false;
-        }
-    }
-#endif
-    for (int i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
-        if (keyboard_report->keys[i] == key) {
-            return true;
-        }
-    }
-    return false;
+    report_sync_protocol();
+    return report_key_test(key);
 }
 
 /** \brief add key byte
@@ -242,13 +322,24 @@ void del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
  * FIXME: Needs doc
  */
 void add_key_to_report(uint8_t key) {
+    if (key == KC_NO) {
+        return;
+    }
+    report_sync_protocol();
+    if (report_key_test(key)) {
+        return;
+    }
 #ifdef NKRO_ENABLE
-    if (keyboard_protocol && keymap_config.nkro) {
-        add_key_bit(nkro_report, key);
+    if (report_nkro_active) {
+        if ((key >> 3) < NKRO_REPORT_BITS) {
+            report_key_set(key);
+        } else {
+            dprintf("add_key_to_report: can't add: %02X\n", key);
+        }
         return;
     }
 #endif
-    add_key_byte(keyboard_report, key);
+    report_6kro_add(key);
 }
 
 /** \brief del key from report
@@ -256,13 +347,20 @@ void add_key_to_report(uint8_t key) {
  * FIXME: Needs doc
  */
 void del_key_from_report(uint8_t key) {
+    if (key == KC_NO) {
+        return;
+    }
+    report_sync_protocol();
+    if (!report_key_test(key)) {
+        return;
+    }
 #ifdef NKRO_ENABLE
-    if (keyboard_protocol && keymap_config.nkro) {
-        del_key_bit(nkro_report, key);
+    if (report_nkro_active) {
+        report_key_clear(key);
         return;
     }
 #endif
-    del_key_byte(keyboard_report, key);
+    report_6kro_del(key);
 }
 
 /** \brief clear key from report
@@ -271,13 +369,24 @@ void del_key_from_report(uint8_t key) {
  */
 void clear_keys_from_report(void) {
     // not clear mods
+    report_sync_protocol();
+    memset(report_keys, 0, sizeof(report_keys));
+    report_key_count = 0;
+    report_6kro_reset();
+}
+
+/** \brief Writes the pressed keys into the report for the active protocol
+ *
+ * Called right before a keyboard report is sent. The 6KRO report is kept up to date as keys are added and removed,
+ * the NKRO bitmap is only filled in here.
+ */
+void sync_keys_to_report(void) {
+    report_sync_protocol();
 #ifdef NKRO_ENABLE
-    if (keyboard_protocol && keymap_config.nkro) {
-        memset(nkro_report->bits, 0, sizeof(nkro_report->bits));
-        return;
+    if (report_nkro_active) {
+        memcpy(nkro_report->bits, report_keys, sizeof(nkro_report->bits));
     }
 #endif
-    memset(keyboard_report->keys, 0, sizeof(keyboard_report->keys));
 }
 
 #ifdef MOUSE_ENABLE
@@ -0,0 +1,211 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <random>
+#include <vector>
+
+extern "C" {
+#include "report.h"
+#include "keycode_config.h"
+
+uint8_t         keyboard_protocol = 1;
+keymap_config_t keymap_config;
+
+static report_keyboard_t report_storage;
+static report_nkro_t     nkro_storage;
+static report_keyboard_t reference_report_storage;
+static report_nkro_t     reference_nkro_storage;
+
+report_keyboard_t *keyboard_report           = &report_storage;
+report_nkro_t     *nkro_report               = &nkro_storage;
+report_keyboard_t *reference_keyboard_report = &reference_report_storage;
+report_nkro_t     *reference_nkro_report     = &reference_nkro_storage;
+
+uint8_t reference_has_anykey(void);
+uint8_t reference_get_first_key(void);
+bool    reference_is_key_pressed(uint8_t key);
+void    reference_add_key_to_report(uint8_t key);
+void    reference_del_key_from_report(uint8_t key);
+void    reference_clear_keys_from_report(void);
+}
+
+class Report : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_nkro(false);
+        clear_keys_from_report();
+    }
+
+    void TearDown() override {
+        // Releasing everything is the only way to reset the reference ring buffer
+        for (uint16_t code = 1; code < 256; code++) {
+            reference_del_key_from_report(code);
+        }
+    }
+
+    void set_nkro(bool nkro) {
+        keymap_config.nkro = nkro;
+    }
+
+    void add(uint8_t key) {
+        add_key_to_report(key);
+        reference_add_key_to_report(key);
+    }
+
+    void del(uint8_t key) {
+        del_key_from_report(key);
+        reference_del_key_from_report(key);
+    }
+
+    std::vector<uint8_t> keys() {
+        sync_keys_to_report();
+        return std::vector<uint8_t>(keyboard_report->keys, keyboard_report->keys + KEYBOARD_REPORT_KEYS);
+    }
+
+    void expect_same_as_reference(size_t step) {
+        sync_keys_to_report();
+#ifdef NKRO_ENABLE
+        if (keymap_config.nkro) {
+            std::vector<uint8_t> bits(nkro_report->bits, nkro_report->bits + NKRO_REPORT_BITS);
+            std::vector<uint8_t> reference_bits(reference_nkro_report->bits, reference_nkro_report->bits + NKRO_REPORT_BITS);
+            ASSERT_EQ(bits, reference_bits) << "step " << step;
+        } else
+#endif
+        {
+            std::vector<uint8_t> reference_keys(reference_keyboard_report->keys, reference_keyboard_report->keys + KEYBOARD_REPORT_KEYS);
+            ASSERT_EQ(keys(), reference_keys) << "step " << step;
+        }
+
+        bool any = has_anykey();
+        ASSERT_EQ(any, reference_has_anykey() != 0) << "step " << step;
+        // The old NKRO lookup reads past the report when nothing is pressed
+        if (any || !keymap_config.nkro) {
+            ASSERT_EQ(get_first_key(), reference_get_first_key()) << "step " << step;
+        }
+        for (uint16_t code = 0; code < 256; code++) {
+            ASSERT_EQ(is_key_pressed(code), reference_is_key_pressed(code)) << "step " << step << " code " << code;
+        }
+    }
+
+    void run_stream(uint32_t seed, uint8_t first, uint8_t last, size_t steps, bool with_clear) {
+        std::mt19937                       rng(seed);
+        std::uniform_int_distribution<int> code(first, last);
+        std::uniform_int_distribution<int> action(0, 99);
+
+        for (size_t step = 0; step < steps; step++) {
+            int a = action(rng);
+            if (with_clear && a == 0) {
+                clear_keys_from_report();
+                reference_clear_keys_from_report();
+            } else if (a < 55) {
+                add(code(rng));
+            } else {
+                del(code(rng));
+            }
+            expect_same_as_reference(step);
+            if (HasFatalFailure()) {
+                return;
+            }
+        }
+    }
+};
+
+#ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
+// The old ring buffer is left inconsistent by clear_keys_from_report(), so the streams only press and release
+#    define STREAM_WITH_CLEAR false
+#else
+#    define STREAM_WITH_CLEAR true
+#endif
+
+TEST_F(Report, RandomStreamsFewKeys) {
+    for (uint32_t seed = 1; seed <= 10; seed++) {
+        run_stream(seed, KC_A, KC_L, 2000, STREAM_WITH_CLEAR);
+        if (HasFatalFailure()) {
+            FAIL() << "seed " << seed;
+        }
+    }
+}
+
+TEST_F(Report, RandomStreamsAllKeys) {
+    for (uint32_t seed = 1; seed <= 10; seed++) {
+        run_stream(seed, 1, 255, 2000, STREAM_WITH_CLEAR);
+        if (HasFatalFailure()) {
+            FAIL() << "seed " << seed;
+        }
+    }
+}
+
+TEST_F(Report, HasAnykeyCountsKeys) {
+    EXPECT_EQ(has_anykey(), 0);
+    add_key_to_report(KC_A);
+    add_key_to_report(KC_B);
+    add_key_to_report(KC_A);
+    EXPECT_EQ(has_anykey(), 2);
+    del_key_from_report(KC_A);
+    EXPECT_EQ(has_anykey(), 1);
+    clear_keys_from_report();
+    EXPECT_EQ(has_anykey(), 0);
+}
+
+#ifdef NKRO_ENABLE
+TEST_F(Report, RandomStreamsNkro) {
+    set_nkro(true);
+    clear_keys_from_report();
+    reference_clear_keys_from_report();
+    for (uint32_t seed = 1; seed <= 10; seed++) {
+        run_stream(seed, 1, 255, 2000, true);
+        if (HasFatalFailure()) {
+            FAIL() << "seed " << seed;
+        }
+    }
+}
+
+TEST_F(Report, SwitchToSixKroKeepsLowestKeys) {
+    set_nkro(true);
+    for (uint8_t key = KC_H; key >= KC_A; key--) {
+        add_key_to_report(key);
+    }
+    EXPECT_EQ(has_anykey(), 8);
+
+    set_nkro(false);
+    EXPECT_EQ(keys(), std::vector<uint8_t>({KC_A, KC_B, KC_C, KC_D, KC_E, KC_F}));
+    EXPECT_EQ(has_anykey(), 6);
+    EXPECT_FALSE(is_key_pressed(KC_G));
+
+    del_key_from_report(KC_C);
+    add_key_to_report(KC_Z);
+    EXPECT_EQ(keys(), std::vector<uint8_t>({KC_A, KC_B, KC_Z, KC_D, KC_E, KC_F}));
+}
+
+TEST_F(Report, SwitchToNkroDropsKeysOutsideReport) {
+    add_key_to_report(KC_A);
+    add_key_to_report(0xFE);
+    EXPECT_EQ(has_anykey(), 2);
+
+    set_nkro(true);
+    sync_keys_to_report();
+    EXPECT_EQ(has_anykey(), 1);
+    EXPECT_TRUE(is_key_pressed(KC_A));
+    EXPECT_FALSE(is_key_pressed(0xFE));
+    EXPECT_EQ(nkro_report->bits[KC_A >> 3], 1 << (KC_A & 7));
+}
+#endif
+
+#ifdef RING_BUFFERED_6KRO_REPORT_ENABLE
+TEST_F(Report, ClearResetsRollover) {
+    for (uint8_t key = KC_A; key <= KC_F; key++) {
+        add_key_to_report(key);
+    }
+    clear_keys_from_report();
+    EXPECT_EQ(has_anykey(), 0);
+
+    for (uint8_t key = KC_A; key <= KC_G; key++) {
+        add_key_to_report(key);
+    }
+    EXPECT_EQ(keys(), std::vector<uint8_t>({KC_G, KC_B, KC_C, KC_D, KC_E, KC_F}));
+    EXPECT_FALSE(is_key_pressed(KC_A));
+    EXPECT_EQ(get_first_key(), KC_B);
+}
+#endif
@@ -0,0 +1,15 @@
+report_DEFS := -DNO_DEBUG -DEEPROM_TEST_HARNESS
+report_INC := $(TMK_PATH)/protocol
+report_SRC := \
+	$(TMK_PATH)/protocol/report.c \
+	$(TMK_PATH)/protocol/tests/report_reference.c \
+	$(TMK_PATH)/protocol/tests/report_tests.cpp
+
+report_nkro_DEFS := $(report_DEFS) -DNKRO_ENABLE
+report_nkro_INC := $(report_INC)
+report_nkro_SRC := $(report_SRC) \
+	$(QUANTUM_PATH)/bitwise.c
+
+report_ring_buffered_DEFS := $(report_DEFS) -DRING_BUFFERED_6KRO_REPORT_ENABLE
+report_ring_buffered_INC := $(report_INC)
+report_ring_buffered_SRC := $(report_SRC)
@@ -0,0 +1,4 @@
+TEST_LIST += \
+	report \
+	report_nkro \
+	report_ring_buffered